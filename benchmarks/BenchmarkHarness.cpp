@@ -0,0 +1,143 @@
+#include "BenchmarkHarness.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace container::bench {
+
+namespace {
+
+volatile size_t gResultSink = 0;
+
+[[nodiscard]] std::vector<double> sortedSamples(
+    const std::vector<double>& samples) {
+  std::vector<double> sorted = samples;
+  std::ranges::sort(sorted);
+  return sorted;
+}
+
+}  // namespace
+
+double BenchmarkResult::minNs() const {
+  return samplesNs.empty() ? 0.0 : std::ranges::min(samplesNs);
+}
+
+double BenchmarkResult::medianNs() const {
+  if (samplesNs.empty()) {
+    return 0.0;
+  }
+  const std::vector<double> sorted = sortedSamples(samplesNs);
+  const size_t mid = sorted.size() / 2u;
+  return sorted.size() % 2u == 1u ? sorted[mid]
+                                  : 0.5 * (sorted[mid - 1u] + sorted[mid]);
+}
+
+double BenchmarkResult::meanNs() const {
+  if (samplesNs.empty()) {
+    return 0.0;
+  }
+  return std::accumulate(samplesNs.begin(), samplesNs.end(), 0.0) /
+         static_cast<double>(samplesNs.size());
+}
+
+double BenchmarkResult::maxNs() const {
+  return samplesNs.empty() ? 0.0 : std::ranges::max(samplesNs);
+}
+
+double BenchmarkResult::itemsPerSecond() const {
+  const double median = medianNs();
+  if (items == 0u || median <= 0.0) {
+    return 0.0;
+  }
+  return static_cast<double>(items) * 1.0e9 / median;
+}
+
+size_t BenchmarkState::scaled(size_t nominal, size_t minimum) const {
+  const double value = std::round(static_cast<double>(nominal) *
+                                  settings_.scale);
+  return std::max(minimum, static_cast<size_t>(std::max(value, 0.0)));
+}
+
+void keepResult(size_t value) { gResultSink = gResultSink + value; }
+
+BenchmarkResult runBenchmark(const Benchmark& benchmark,
+                             const BenchmarkSettings& settings) {
+  BenchmarkResult result{.name = benchmark.name};
+  BenchmarkState state(settings, result);
+  benchmark.run(state);
+  if (result.samplesNs.empty()) {
+    throw std::runtime_error("benchmark " + benchmark.name +
+                             " did not call measure()");
+  }
+  return result;
+}
+
+std::string benchmarkReportJson(const BenchmarkSettings& settings,
+                                const std::vector<BenchmarkResult>& results) {
+  nlohmann::json report;
+  report["schema"] = "vulkan-scene-renderer-bench/1";
+  report["settings"] = {
+      {"seed", settings.seed},
+      {"scale", settings.scale},
+      {"warmup_iterations", settings.warmupIterations},
+      {"iterations", settings.iterations},
+  };
+  nlohmann::json benchmarks = nlohmann::json::array();
+  for (const BenchmarkResult& result : results) {
+    nlohmann::json counters = nlohmann::json::object();
+    for (const auto& [name, value] : result.counters) {
+      counters[name] = value;
+    }
+    benchmarks.push_back({
+        {"name", result.name},
+        {"items", result.items},
+        {"min_ns", result.minNs()},
+        {"median_ns", result.medianNs()},
+        {"mean_ns", result.meanNs()},
+        {"max_ns", result.maxNs()},
+        {"items_per_second", result.itemsPerSecond()},
+        {"samples_ns", result.samplesNs},
+        {"counters", std::move(counters)},
+    });
+  }
+  report["benchmarks"] = std::move(benchmarks);
+  return report.dump(2);
+}
+
+std::vector<BenchmarkComparison> compareWithBaseline(
+    std::string_view baselineJson,
+    const std::vector<BenchmarkResult>& results) {
+  const nlohmann::json baseline =
+      nlohmann::json::parse(baselineJson, nullptr, false);
+  if (baseline.is_discarded() || !baseline.contains("benchmarks") ||
+      !baseline["benchmarks"].is_array()) {
+    throw std::runtime_error("baseline is not a benchmark report");
+  }
+
+  std::unordered_map<std::string, double> baselineMedians;
+  for (const nlohmann::json& entry : baseline["benchmarks"]) {
+    if (entry.contains("name") && entry.contains("median_ns")) {
+      baselineMedians[entry["name"].get<std::string>()] =
+          entry["median_ns"].get<double>();
+    }
+  }
+
+  std::vector<BenchmarkComparison> comparisons;
+  for (const BenchmarkResult& result : results) {
+    const auto it = baselineMedians.find(result.name);
+    if (it == baselineMedians.end()) {
+      continue;
+    }
+    comparisons.push_back({.name = result.name,
+                           .baselineMedianNs = it->second,
+                           .medianNs = result.medianNs()});
+  }
+  return comparisons;
+}
+
+}  // namespace container::bench
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace container::bench {
+
+// Run-wide settings shared by every benchmark. Inputs are generated from
+// `seed`, and `scale` multiplies their nominal size, so a run is reproducible
+// from its settings alone.
+struct BenchmarkSettings {
+  uint64_t seed{0x5eed5eedu};
+  double scale{1.0};
+  uint32_t warmupIterations{1};
+  uint32_t iterations{5};
+};
+
+struct BenchmarkResult {
+  std::string name;
+  uint64_t items{0};
+  std::vector<double> samplesNs;
+  std::vector<std::pair<std::string, double>> counters;
+
+  [[nodiscard]] double minNs() const;
+  [[nodiscard]] double medianNs() const;
+  [[nodiscard]] double meanNs() const;
+  [[nodiscard]] double maxNs() const;
+  // Items per second at the median sample; 0 when no items were set.
+  [[nodiscard]] double itemsPerSecond() const;
+};
+
+// Handed to a benchmark body. Setup runs before measure() and is not timed;
+// measure() runs the warmup and timed iterations of `body`.
+class BenchmarkState {
+ public:
+  BenchmarkState(const BenchmarkSettings& settings, BenchmarkResult& result)
+      : settings_(settings), result_(result) {}
+
+  [[nodiscard]] uint64_t seed() const { return settings_.seed; }
+  // `nominal` scaled by the run's scale factor, never below `minimum`.
+  [[nodiscard]] size_t scaled(size_t nominal, size_t minimum = 1u) const;
+
+  // Work units processed by one iteration (objects, triangles, ...).
+  void setItems(uint64_t items) { result_.items = items; }
+  // Output statistic recorded alongside the timings, e.g. emitted vertices.
+  void counter(std::string name, double value) {
+    result_.counters.emplace_back(std::move(name), value);
+  }
+
+  template <typename Fn>
+  void measure(Fn&& body) {
+    for (uint32_t i = 0; i < settings_.warmupIterations; ++i) {
+      body();
+    }
+    result_.samplesNs.reserve(settings_.iterations);
+    for (uint32_t i = 0; i < settings_.iterations; ++i) {
+      const auto start = std::chrono::steady_clock::now();
+      body();
+      const auto end = std::chrono::steady_clock::now();
+      result_.samplesNs.push_back(
+          std::chrono::duration<double, std::nano>(end - start).count());
+    }
+  }
+
+ private:
+  const BenchmarkSettings& settings_;
+  BenchmarkResult& result_;
+};
+
+using BenchmarkFn = std::function<void(BenchmarkState&)>;
+
+struct Benchmark {
+  std::string name;
+  BenchmarkFn run;
+};
+
+class BenchmarkRegistry {
+ public:
+  void add(std::string name, BenchmarkFn run) {
+    benchmarks_.push_back({std::move(name), std::move(run)});
+  }
+  [[nodiscard]] const std::vector<Benchmark>& benchmarks() const {
+    return benchmarks_;
+  }
+
+ private:
+  std::vector<Benchmark> benchmarks_;
+};
+
+// Keeps a benchmark's result observable so the measured call is not elided.
+void keepResult(size_t value);
+
+[[nodiscard]] BenchmarkResult runBenchmark(const Benchmark& benchmark,
+                                           const BenchmarkSettings& settings);
+
+// Machine-readable report of a run; see docs/build-and-test.md for the
+// schema.
+[[nodiscard]] std::string benchmarkReportJson(
+    const BenchmarkSettings& settings,
+    const std::vector<BenchmarkResult>& results);
+
+struct BenchmarkComparison {
+  std::string name;
+  double baselineMedianNs{0.0};
+  double medianNs{0.0};
+
+  [[nodiscard]] double ratio() const {
+    return baselineMedianNs > 0.0 ? medianNs / baselineMedianNs : 1.0;
+  }
+};
+
+// Pairs results with the benchmarks of the same name in a previous report.
+// Benchmarks missing from either side are left out. Throws
+// std::runtime_error when `baselineJson` is not a benchmark report.
+[[nodiscard]] std::vector<BenchmarkComparison> compareWithBaseline(
+    std::string_view baselineJson, const std::vector<BenchmarkResult>& results);
+
+void registerLoaderBenchmarks(BenchmarkRegistry& registry);
+void registerRendererBenchmarks(BenchmarkRegistry& registry);
+void registerSceneBenchmarks(BenchmarkRegistry& registry);
+
+}  // namespace container::bench
@@ -0,0 +1,48 @@
+# ── Headless benchmark suite ─────────────────────────────────────────────────
+# VulkanSceneRenderer_bench times loaders, planners and scene/graph updates on
+# seeded synthetic inputs without creating a Vulkan device. Run it with
+# --out <file> for a JSON report and --baseline <file> to compare with one.
+
+set(BENCHMARKS_DIR "${CMAKE_SOURCE_DIR}/benchmarks")
+
+add_executable(VulkanSceneRenderer_bench
+    ${BENCHMARKS_DIR}/bench_main.cpp
+    ${BENCHMARKS_DIR}/BenchmarkHarness.cpp
+    ${BENCHMARKS_DIR}/loader_benchmarks.cpp
+    ${BENCHMARKS_DIR}/renderer_benchmarks.cpp
+    ${BENCHMARKS_DIR}/scene_benchmarks.cpp
+)
+
+target_link_libraries(VulkanSceneRenderer_bench PRIVATE
+    VulkanSceneRenderer_renderer
+    VulkanSceneRenderer_geometry
+    VulkanSceneRenderer_scene
+    nlohmann_json::nlohmann_json
+)
+
+target_include_directories(VulkanSceneRenderer_bench PRIVATE
+    ${CMAKE_SOURCE_DIR}/include
+    ${BENCHMARKS_DIR}
+)
+
+set_target_properties(VulkanSceneRenderer_bench PROPERTIES
+    RUNTIME_OUTPUT_DIRECTORY ${CMAKE_BINARY_DIR}/benchmarks
+    RUNTIME_OUTPUT_DIRECTORY_DEBUG ${CMAKE_BINARY_DIR}/benchmarks
+    RUNTIME_OUTPUT_DIRECTORY_RELEASE ${CMAKE_BINARY_DIR}/benchmarks
+    RUNTIME_OUTPUT_DIRECTORY_RELWITHDEBINFO ${CMAKE_BINARY_DIR}/benchmarks
+    RUNTIME_OUTPUT_DIRECTORY_MINSIZEREL ${CMAKE_BINARY_DIR}/benchmarks
+    CXX_STANDARD 23
+    CXX_STANDARD_REQUIRED ON
+    CXX_EXTENSIONS OFF
+)
+
+# Smoke run on tiny inputs so the suite keeps building and running with the
+# tests; timings from this run are not meaningful.
+if(ENABLE_TESTS)
+    add_test(
+        NAME VulkanSceneRenderer_bench_smoke
+        COMMAND VulkanSceneRenderer_bench --scale 0.01 --iterations 1
+                --warmup 0 --out ${CMAKE_BINARY_DIR}/test_results/bench_smoke.json
+    )
+    set_tests_properties(VulkanSceneRenderer_bench_smoke PROPERTIES LABELS "benchmark")
+endif()
@@ -0,0 +1,227 @@
+#include "BenchmarkHarness.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <print>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using container::bench::BenchmarkRegistry;
+using container::bench::BenchmarkResult;
+using container::bench::BenchmarkSettings;
+
+struct BenchOptions {
+  BenchmarkSettings settings{};
+  std::vector<std::string> filters;
+  std::string outputPath;
+  std::string baselinePath;
+  // Allowed slowdown of a median against the baseline, in percent.
+  double maxRegressionPercent{-1.0};
+  bool listOnly{false};
+};
+
+void printUsage() {
+  std::println(
+      "usage: VulkanSceneRenderer_bench [options]\n"
+      "  --filter <text>          run benchmarks whose name contains text;\n"
+      "                           may be repeated\n"
+      "  --seed <n>               input generator seed\n"
+      "  --scale <f>              multiply nominal input sizes\n"
+      "  --iterations <n>         timed iterations per benchmark\n"
+      "  --warmup <n>             untimed iterations per benchmark\n"
+      "  --out <file>             write the JSON report to file ('-' for "
+      "stdout)\n"
+      "  --baseline <file>        compare medians with a previous report\n"
+      "  --max-regression <pct>   fail when a median exceeds the baseline\n"
+      "                           by more than pct percent\n"
+      "  --list                   print benchmark names and exit");
+}
+
+std::string_view requireValue(int argc, char** argv, int& index,
+                              std::string_view option) {
+  if (index + 1 >= argc || argv[index + 1] == nullptr) {
+    throw std::runtime_error("missing value for " + std::string(option));
+  }
+  ++index;
+  return argv[index];
+}
+
+double parseDouble(std::string_view value, std::string_view option) {
+  try {
+    return std::stod(std::string(value));
+  } catch (...) {
+    throw std::runtime_error("invalid number for " + std::string(option) +
+                             ": " + std::string(value));
+  }
+}
+
+uint64_t parseUint(std::string_view value, std::string_view option) {
+  try {
+    return std::stoull(std::string(value));
+  } catch (...) {
+    throw std::runtime_error("invalid integer for " + std::string(option) +
+                             ": " + std::string(value));
+  }
+}
+
+BenchOptions parseCommandLine(int argc, char** argv) {
+  BenchOptions options{};
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    if (arg == "--filter") {
+      options.filters.emplace_back(requireValue(argc, argv, i, arg));
+    } else if (arg == "--seed") {
+      options.settings.seed = parseUint(requireValue(argc, argv, i, arg), arg);
+    } else if (arg == "--scale") {
+      options.settings.scale =
+          parseDouble(requireValue(argc, argv, i, arg), arg);
+      if (!(options.settings.scale > 0.0)) {
+        throw std::runtime_error("--scale must be positive");
+      }
+    } else if (arg == "--iterations") {
+      options.settings.iterations = static_cast<uint32_t>(
+          parseUint(requireValue(argc, argv, i, arg), arg));
+      if (options.settings.iterations == 0u) {
+        throw std::runtime_error("--iterations must be at least 1");
+      }
+    } else if (arg == "--warmup") {
+      options.settings.warmupIterations = static_cast<uint32_t>(
+          parseUint(requireValue(argc, argv, i, arg), arg));
+    } else if (arg == "--out") {
+      options.outputPath = requireValue(argc, argv, i, arg);
+    } else if (arg == "--baseline") {
+      options.baselinePath = requireValue(argc, argv, i, arg);
+    } else if (arg == "--max-regression") {
+      options.maxRegressionPercent =
+          parseDouble(requireValue(argc, argv, i, arg), arg);
+    } else if (arg == "--list") {
+      options.listOnly = true;
+    } else if (arg == "--help" || arg == "-h") {
+      printUsage();
+      std::exit(0);
+    } else {
+      throw std::runtime_error("unknown option: " + std::string(arg));
+    }
+  }
+  return options;
+}
+
+bool selected(const BenchOptions& options, std::string_view name) {
+  if (options.filters.empty()) {
+    return true;
+  }
+  for (const std::string& filter : options.filters) {
+    if (name.find(filter) != std::string_view::npos) {
+      return true;
+    }
+  }
+  return false;
+}
+
+std::string readFile(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    throw std::runtime_error("cannot read " + path);
+  }
+  return {std::istreambuf_iterator<char>(file),
+          std::istreambuf_iterator<char>()};
+}
+
+// Returns false when a benchmark regressed past the allowed threshold.
+bool reportBaseline(const BenchOptions& options,
+                    const std::vector<BenchmarkResult>& results,
+                    std::FILE* log) {
+  const auto comparisons = container::bench::compareWithBaseline(
+      readFile(options.baselinePath), results);
+  bool withinThreshold = true;
+  std::println(log, "\n{:<44} {:>12} {:>12} {:>8}", "benchmark",
+               "baseline ms", "median ms", "ratio");
+  for (const auto& comparison : comparisons) {
+    const bool regressed =
+        options.maxRegressionPercent >= 0.0 &&
+        comparison.ratio() > 1.0 + options.maxRegressionPercent / 100.0;
+    withinThreshold = withinThreshold && !regressed;
+    std::println(log, "{:<44} {:>12.3f} {:>12.3f} {:>7.3f}x{}",
+                 comparison.name, comparison.baselineMedianNs * 1.0e-6,
+                 comparison.medianNs * 1.0e-6, comparison.ratio(),
+                 regressed ? "  REGRESSED" : "");
+  }
+  return withinThreshold;
+}
+
+int run(int argc, char** argv) {
+  const BenchOptions options = parseCommandLine(argc, argv);
+
+  BenchmarkRegistry registry;
+  container::bench::registerLoaderBenchmarks(registry);
+  container::bench::registerRendererBenchmarks(registry);
+  container::bench::registerSceneBenchmarks(registry);
+
+  if (options.listOnly) {
+    for (const auto& benchmark : registry.benchmarks()) {
+      std::println("{}", benchmark.name);
+    }
+    return 0;
+  }
+
+  // With the report on stdout the table goes to stderr so the JSON stays
+  // parseable.
+  std::FILE* log = options.outputPath == "-" ? stderr : stdout;
+  std::println(log, "seed {} scale {} iterations {} warmup {}",
+               options.settings.seed, options.settings.scale,
+               options.settings.iterations,
+               options.settings.warmupIterations);
+  std::println(log, "{:<44} {:>12} {:>12} {:>14}", "benchmark", "median ms",
+               "min ms", "items/s");
+
+  std::vector<BenchmarkResult> results;
+  for (const auto& benchmark : registry.benchmarks()) {
+    if (!selected(options, benchmark.name)) {
+      continue;
+    }
+    BenchmarkResult result =
+        container::bench::runBenchmark(benchmark, options.settings);
+    std::println(log, "{:<44} {:>12.3f} {:>12.3f} {:>14.0f}", result.name,
+                 result.medianNs() * 1.0e-6, result.minNs() * 1.0e-6,
+                 result.itemsPerSecond());
+    results.push_back(std::move(result));
+  }
+
+  const std::string report =
+      container::bench::benchmarkReportJson(options.settings, results);
+  if (options.outputPath == "-") {
+    std::println("{}", report);
+  } else if (!options.outputPath.empty()) {
+    std::ofstream file(options.outputPath, std::ios::binary);
+    if (!file) {
+      throw std::runtime_error("cannot write " + options.outputPath);
+    }
+    file << report << '\n';
+  }
+
+  if (!options.baselinePath.empty() &&
+      !reportBaseline(options, results, log)) {
+    return 1;
+  }
+  return 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  try {
+    return run(argc, argv);
+  } catch (const std::exception& error) {
+    std::println(stderr, "VulkanSceneRenderer_bench: {}", error.what());
+    return 2;
+  }
+}
@@ -0,0 +1,415 @@
+#include "BenchmarkHarness.h"
+
+#include "Container/geometry/DotBimLoader.h"
+#include "Container/geometry/GltfModelLoader.h"
+#include "Container/geometry/IfcTessellatedLoader.h"
+#include "Container/geometry/IfcxLoader.h"
+#include "Container/geometry/UsdLoader.h"
+
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace container::bench {
+
+namespace {
+
+// Every loader reads the same scene: `patchCount` height-field patches of
+// `gridSize` x `gridSize` points scattered on a plane, two triangles per grid
+// cell. Positions and heights come from the run seed.
+struct PatchScene {
+  uint32_t gridSize{0};
+  std::vector<glm::vec3> offsets;
+  // gridSize * gridSize heights per patch.
+  std::vector<float> heights;
+
+  [[nodiscard]] size_t patchCount() const { return offsets.size(); }
+  [[nodiscard]] uint32_t pointCount() const { return gridSize * gridSize; }
+  [[nodiscard]] uint32_t triangleCount() const {
+    return (gridSize - 1u) * (gridSize - 1u) * 2u;
+  }
+  [[nodiscard]] glm::vec3 point(size_t patch, uint32_t index) const {
+    return {static_cast<float>(index % gridSize) * 0.1f,
+            static_cast<float>(index / gridSize) * 0.1f,
+            heights[patch * pointCount() + index]};
+  }
+  // Zero-based triangle corners of the grid.
+  template <typename Fn>
+  void forEachTriangle(Fn&& fn) const {
+    for (uint32_t y = 0; y + 1u < gridSize; ++y) {
+      for (uint32_t x = 0; x + 1u < gridSize; ++x) {
+        const uint32_t i = y * gridSize + x;
+        fn(i, i + 1u, i + gridSize);
+        fn(i + 1u, i + gridSize + 1u, i + gridSize);
+      }
+    }
+  }
+};
+
+[[nodiscard]] PatchScene makePatchScene(uint64_t seed, size_t patchCount,
+                                        uint32_t gridSize) {
+  std::mt19937_64 rng(seed);
+  std::uniform_real_distribution<float> position(-200.0f, 200.0f);
+  std::uniform_real_distribution<float> height(-0.25f, 0.25f);
+  PatchScene scene{.gridSize = gridSize};
+  scene.offsets.reserve(patchCount);
+  scene.heights.resize(patchCount * scene.pointCount());
+  for (size_t p = 0; p < patchCount; ++p) {
+    scene.offsets.push_back({position(rng), position(rng), 0.0f});
+  }
+  for (float& value : scene.heights) {
+    value = height(rng);
+  }
+  return scene;
+}
+
+[[nodiscard]] std::string stepReal(float value) {
+  std::ostringstream out;
+  out.setf(std::ios::fixed);
+  out.precision(4);
+  out << value;
+  return out.str();
+}
+
+[[nodiscard]] std::string ifcStepText(const PatchScene& scene) {
+  std::ostringstream data;
+  data << "ISO-10303-21;\nHEADER;\nENDSEC;\nDATA;\n"
+       << "#1=IFCSIUNIT(*,.LENGTHUNIT.,$,.METRE.);\n"
+       << "#2=IFCCARTESIANPOINT((0.,0.,0.));\n"
+       << "#3=IFCDIRECTION((0.,0.,1.));\n"
+       << "#4=IFCDIRECTION((1.,0.,0.));\n"
+       << "#5=IFCAXIS2PLACEMENT3D(#2,#3,#4);\n"
+       << "#6=IFCLOCALPLACEMENT($,#5);\n"
+       << "#10=IFCBUILDINGSTOREY('storey',$,'Level 01',$,$,#6,$,$,$);\n"
+       << "#11=IFCMATERIAL('Concrete',$,'Structural');\n";
+
+  std::ostringstream products;
+  for (size_t p = 0; p < scene.patchCount(); ++p) {
+    const size_t base = 100u + p * 10u;
+    const auto ref = [base](size_t local) {
+      return "#" + std::to_string(base + local);
+    };
+    const glm::vec3 offset = scene.offsets[p];
+    data << ref(0) << "=IFCCARTESIANPOINT((" << stepReal(offset.x) << ","
+         << stepReal(offset.y) << ",0.));\n"
+         << ref(1) << "=IFCAXIS2PLACEMENT3D(" << ref(0) << ",#3,#4);\n"
+         << ref(2) << "=IFCLOCALPLACEMENT(#6," << ref(1) << ");\n"
+         << ref(3) << "=IFCCARTESIANPOINTLIST3D((";
+    for (uint32_t i = 0; i < scene.pointCount(); ++i) {
+      const glm::vec3 point = scene.point(p, i);
+      data << (i != 0u ? ",(" : "(") << stepReal(point.x) << ","
+           << stepReal(point.y) << "," << stepReal(point.z) << ")";
+    }
+    data << "));\n" << ref(4) << "=IFCTRIANGULATEDFACESET(" << ref(3)
+         << ",$,.T.,(";
+    bool first = true;
+    scene.forEachTriangle([&](uint32_t a, uint32_t b, uint32_t c) {
+      data << (first ? "(" : ",(") << a + 1u << "," << b + 1u << ","
+           << c + 1u << ")";
+      first = false;
+    });
+    data << "),$);\n"
+         << ref(5) << "=IFCSHAPEREPRESENTATION($,'Body','Tessellation',("
+         << ref(4) << "));\n"
+         << ref(6) << "=IFCPRODUCTDEFINITIONSHAPE($,$,(" << ref(5) << "));\n"
+         << ref(7) << "=IFCBUILDINGELEMENTPROXY('product-" << p
+         << "',$,'Product " << p << "',$,$," << ref(2) << "," << ref(6)
+         << ",$,$);\n";
+    products << (p != 0u ? "," : "") << ref(7);
+  }
+  data << "#12=IFCRELCONTAINEDINSPATIALSTRUCTURE('containment',$,$,$,("
+       << products.str() << "),#10);\n"
+       << "#13=IFCRELASSOCIATESMATERIAL('material',$,$,$,(" << products.str()
+       << "),#11);\n"
+       << "ENDSEC;\nEND-ISO-10303-21;\n";
+  return data.str();
+}
+
+[[nodiscard]] std::string ifcxJsonText(const PatchScene& scene) {
+  nlohmann::json data = nlohmann::json::array();
+  for (size_t p = 0; p < scene.patchCount(); ++p) {
+    const glm::vec3 offset = scene.offsets[p];
+    const std::string product = "product-" + std::to_string(p);
+    const std::string mesh = "mesh-" + std::to_string(p);
+    data.push_back({
+        {"path", product},
+        {"children", {{"Body", mesh}}},
+        {"attributes",
+         {{"usd::xformop",
+           {{"transform",
+             {{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0},
+              {offset.x, offset.y, offset.z, 1}}}}},
+          {"bsi::ifc::globalId", product},
+          {"bsi::ifc::class", {{"code", "IfcBuildingElementProxy"}}},
+          {"bsi::ifc::storeyName", "Level 01"},
+          {"bsi::ifc::materialName", "Concrete"}}},
+    });
+
+    nlohmann::json points = nlohmann::json::array();
+    for (uint32_t i = 0; i < scene.pointCount(); ++i) {
+      const glm::vec3 point = scene.point(p, i);
+      points.push_back({point.x, point.y, point.z});
+    }
+    nlohmann::json indices = nlohmann::json::array();
+    scene.forEachTriangle([&](uint32_t a, uint32_t b, uint32_t c) {
+      indices.push_back(a);
+      indices.push_back(b);
+      indices.push_back(c);
+    });
+    data.push_back({
+        {"path", mesh},
+        {"attributes",
+         {{"usd::usdgeom::mesh",
+           {{"faceVertexIndices", std::move(indices)},
+            {"points", std::move(points)}}}}},
+    });
+  }
+  return nlohmann::json{{"data", std::move(data)}}.dump();
+}
+
+[[nodiscard]] std::string usdText(const PatchScene& scene) {
+  std::ostringstream usd;
+  usd << "#usda 1.0\n\ndef Xform \"Root\"\n{\n";
+  for (size_t p = 0; p < scene.patchCount(); ++p) {
+    const glm::vec3 offset = scene.offsets[p];
+    usd << "    def Xform \"Product" << p << "\"\n    {\n"
+        << "        matrix4d xformOp:transform = ((1, 0, 0, 0), (0, 1, 0, 0), "
+           "(0, 0, 1, 0), ("
+        << offset.x << ", " << offset.y << ", " << offset.z << ", 1))\n"
+        << "        uniform token[] xformOpOrder = [\"xformOp:transform\"]\n"
+        << "        def Mesh \"Patch\"\n        {\n"
+        << "            int[] faceVertexCounts = [";
+    for (uint32_t t = 0; t < scene.triangleCount(); ++t) {
+      usd << (t != 0u ? ", 3" : "3");
+    }
+    usd << "]\n            int[] faceVertexIndices = [";
+    bool first = true;
+    scene.forEachTriangle([&](uint32_t a, uint32_t b, uint32_t c) {
+      usd << (first ? "" : ", ") << a << ", " << b << ", " << c;
+      first = false;
+    });
+    usd << "]\n            point3f[] points = [";
+    for (uint32_t i = 0; i < scene.pointCount(); ++i) {
+      const glm::vec3 point = scene.point(p, i);
+      usd << (i != 0u ? ", (" : "(") << point.x << ", " << point.y << ", "
+          << point.z << ")";
+    }
+    usd << "]\n        }\n    }\n";
+  }
+  usd << "}\n";
+  return usd.str();
+}
+
+[[nodiscard]] std::string dotbimJsonText(const PatchScene& scene) {
+  nlohmann::json meshes = nlohmann::json::array();
+  nlohmann::json elements = nlohmann::json::array();
+  for (size_t p = 0; p < scene.patchCount(); ++p) {
+    nlohmann::json coordinates = nlohmann::json::array();
+    for (uint32_t i = 0; i < scene.pointCount(); ++i) {
+      const glm::vec3 point = scene.point(p, i);
+      coordinates.push_back(point.x);
+      coordinates.push_back(point.y);
+      coordinates.push_back(point.z);
+    }
+    nlohmann::json indices = nlohmann::json::array();
+    scene.forEachTriangle([&](uint32_t a, uint32_t b, uint32_t c) {
+      indices.push_back(a);
+      indices.push_back(b);
+      indices.push_back(c);
+    });
+    meshes.push_back({{"mesh_id", p},
+                      {"coordinates", std::move(coordinates)},
+                      {"indices", std::move(indices)}});
+
+    const glm::vec3 offset = scene.offsets[p];
+    elements.push_back({
+        {"mesh_id", p},
+        {"guid", "element-" + std::to_string(p)},
+        {"type", "BuildingElementProxy"},
+        {"storeyName", "Level 01"},
+        {"materialName", "Concrete"},
+        {"vector", {{"x", offset.x}, {"y", offset.y}, {"z", offset.z}}},
+        {"rotation", {{"qx", 0.0}, {"qy", 0.0}, {"qz", 0.0}, {"qw", 1.0}}},
+        {"color", {{"r", 180}, {"g", 180}, {"b", 180}, {"a", 255}}},
+    });
+  }
+  return nlohmann::json{{"schema_version", "1.1.0"},
+                        {"meshes", std::move(meshes)},
+                        {"elements", std::move(elements)}}
+      .dump();
+}
+
+// glTF loads from disk, so the scene is written next to the other temporary
+// files once per run: one mesh and node per patch, sharing a single buffer.
+[[nodiscard]] std::filesystem::path writeGltf(const PatchScene& scene,
+                                              uint64_t seed) {
+  const std::filesystem::path dir =
+      std::filesystem::temp_directory_path() / "container_bench";
+  std::filesystem::create_directories(dir);
+  const std::string stem = "patches_" + std::to_string(seed) + "_" +
+                           std::to_string(scene.patchCount()) + "_" +
+                           std::to_string(scene.gridSize);
+  const std::filesystem::path gltfPath = dir / (stem + ".gltf");
+
+  std::vector<char> bytes;
+  const auto append = [&bytes](const auto& value) {
+    const auto* raw = reinterpret_cast<const char*>(&value);
+    bytes.insert(bytes.end(), raw, raw + sizeof(value));
+  };
+
+  nlohmann::json bufferViews = nlohmann::json::array();
+  nlohmann::json accessors = nlohmann::json::array();
+  nlohmann::json meshes = nlohmann::json::array();
+  nlohmann::json nodes = nlohmann::json::array();
+  nlohmann::json sceneNodes = nlohmann::json::array();
+  const uint32_t indexCount = scene.triangleCount() * 3u;
+  for (size_t p = 0; p < scene.patchCount(); ++p) {
+    glm::vec3 minimum{std::numeric_limits<float>::max()};
+    glm::vec3 maximum{std::numeric_limits<float>::lowest()};
+    const size_t positionOffset = bytes.size();
+    for (uint32_t i = 0; i < scene.pointCount(); ++i) {
+      const glm::vec3 point = scene.point(p, i);
+      minimum = glm::min(minimum, point);
+      maximum = glm::max(maximum, point);
+      append(point.x);
+      append(point.y);
+      append(point.z);
+    }
+    const size_t indexOffset = bytes.size();
+    scene.forEachTriangle([&](uint32_t a, uint32_t b, uint32_t c) {
+      append(a);
+      append(b);
+      append(c);
+    });
+
+    const size_t view = bufferViews.size();
+    bufferViews.push_back({{"buffer", 0},
+                           {"byteOffset", positionOffset},
+                           {"byteLength", indexOffset - positionOffset}});
+    bufferViews.push_back({{"buffer", 0},
+                           {"byteOffset", indexOffset},
+                           {"byteLength", bytes.size() - indexOffset}});
+    accessors.push_back({{"bufferView", view},
+                         {"componentType", 5126},
+                         {"count", scene.pointCount()},
+                         {"type", "VEC3"},
+                         {"min", {minimum.x, minimum.y, minimum.z}},
+                         {"max", {maximum.x, maximum.y, maximum.z}}});
+    accessors.push_back({{"bufferView", view + 1u},
+                         {"componentType", 5125},
+                         {"count", indexCount},
+                         {"type", "SCALAR"}});
+    meshes.push_back(
+        {{"primitives",
+          {{{"attributes", {{"POSITION", view}}}, {"indices", view + 1u}}}}});
+    const glm::vec3 offset = scene.offsets[p];
+    nodes.push_back({{"mesh", p},
+                     {"translation", {offset.x, offset.y, offset.z}}});
+    sceneNodes.push_back(p);
+  }
+
+  const nlohmann::json gltf = {
+      {"asset", {{"version", "2.0"}}},
+      {"scene", 0},
+      {"scenes", {{{"nodes", std::move(sceneNodes)}}}},
+      {"nodes", std::move(nodes)},
+      {"meshes", std::move(meshes)},
+      {"accessors", std::move(accessors)},
+      {"bufferViews", std::move(bufferViews)},
+      {"buffers", {{{"uri", stem + ".bin"}, {"byteLength", bytes.size()}}}},
+  };
+  std::ofstream(dir / (stem + ".bin"), std::ios::binary)
+      .write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+  std::ofstream(gltfPath, std::ios::binary) << gltf.dump();
+  return gltfPath;
+}
+
+// Times `load` and records the size of the model it produced.
+template <typename LoadFn>
+void measureBimLoad(BenchmarkState& state, LoadFn&& load) {
+  size_t vertices = 0;
+  size_t indices = 0;
+  size_t elements = 0;
+  state.measure([&] {
+    const container::geometry::dotbim::Model model = load();
+    vertices = model.vertices.size();
+    indices = model.indices.size();
+    elements = model.elements.size();
+    keepResult(indices);
+  });
+  state.counter("vertices", static_cast<double>(vertices));
+  state.counter("indices", static_cast<double>(indices));
+  state.counter("elements", static_cast<double>(elements));
+}
+
+constexpr uint32_t kLoaderGridSize = 16u;
+
+}  // namespace
+
+void registerLoaderBenchmarks(BenchmarkRegistry& registry) {
+  registry.add("loader/ifc_step", [](BenchmarkState& state) {
+    const PatchScene scene =
+        makePatchScene(state.seed(), state.scaled(2000u), kLoaderGridSize);
+    const std::string text = ifcStepText(scene);
+    state.setItems(scene.patchCount() * scene.triangleCount());
+    state.counter("input_bytes", static_cast<double>(text.size()));
+    measureBimLoad(state,
+                   [&] { return container::geometry::ifc::LoadFromStep(text); });
+  });
+
+  registry.add("loader/ifcx_json", [](BenchmarkState& state) {
+    const PatchScene scene =
+        makePatchScene(state.seed(), state.scaled(2000u), kLoaderGridSize);
+    const std::string text = ifcxJsonText(scene);
+    state.setItems(scene.patchCount() * scene.triangleCount());
+    state.counter("input_bytes", static_cast<double>(text.size()));
+    measureBimLoad(state,
+                   [&] { return container::geometry::ifcx::LoadFromJson(text); });
+  });
+
+  registry.add("loader/usd_text", [](BenchmarkState& state) {
+    const PatchScene scene =
+        makePatchScene(state.seed(), state.scaled(2000u), kLoaderGridSize);
+    const std::string text = usdText(scene);
+    state.setItems(scene.patchCount() * scene.triangleCount());
+    state.counter("input_bytes", static_cast<double>(text.size()));
+    measureBimLoad(state,
+                   [&] { return container::geometry::usd::LoadFromText(text); });
+  });
+
+  registry.add("loader/dotbim_json", [](BenchmarkState& state) {
+    const PatchScene scene =
+        makePatchScene(state.seed(), state.scaled(4000u), kLoaderGridSize);
+    const std::string text = dotbimJsonText(scene);
+    state.setItems(scene.patchCount() * scene.triangleCount());
+    state.counter("input_bytes", static_cast<double>(text.size()));
+    measureBimLoad(state,
+                   [&] { return container::geometry::dotbim::LoadFromJson(text); });
+  });
+
+  registry.add("loader/gltf_file", [](BenchmarkState& state) {
+    const PatchScene scene =
+        makePatchScene(state.seed(), state.scaled(1000u), 32u);
+    const std::string path = writeGltf(scene, state.seed()).string();
+    state.setItems(scene.patchCount() * scene.triangleCount());
+    size_t vertices = 0;
+    size_t indices = 0;
+    state.measure([&] {
+      const auto model = container::geometry::gltf::LoadModelFromFile(path);
+      vertices = model.vertices().size();
+      indices = model.indices().size();
+      keepResult(indices);
+    });
+    state.counter("vertices", static_cast<double>(vertices));
+    state.counter("indices", static_cast<double>(indices));
+  });
+}
+
+}  // namespace container::bench
@@ -0,0 +1,453 @@
+#include "BenchmarkHarness.h"
+
+#include "Container/renderer/bim/BimDrawCompactionPlanner.h"
+#include "Container/renderer/bim/BimDrawFilterState.h"
+#include "Container/renderer/bim/BimManager.h"
+#include "Container/renderer/bim/BimSectionCapBuilder.h"
+#include "Container/renderer/bim/BimSnapFeatureGrid.h"
+#include "Container/renderer/core/RenderGraph.h"
+#include "Container/renderer/shadow/ShadowCascadeDrawPlanner.h"
+
+#include "Container/geometry/DotBimLoader.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace container::renderer::detail {
+
+// Defined next to the cluster builder in BimManager.cpp and only declared
+// here, so the forwarder stays out of the public BimManager header.
+[[nodiscard]] std::vector<BimMeshletClusterMetadata>
+bimMeshletClusterMetadataForModel(
+    const container::geometry::dotbim::Model &model);
+
+}  // namespace container::renderer::detail
+
+namespace container::bench {
+
+namespace {
+
+using container::renderer::BimDrawFilter;
+using container::renderer::BimDrawFilterState;
+using container::renderer::BimDrawFilterStateInputs;
+using container::renderer::BimElementMetadata;
+using container::renderer::BimElementMetadataStore;
+using container::renderer::DrawCommand;
+using container::renderer::RenderGraph;
+using container::renderer::RenderPassId;
+
+// Draw commands over objects [0, objectCount), mostly single instances with
+// occasional instanced runs, as the BIM and scene draw builders emit them.
+[[nodiscard]] std::vector<DrawCommand> makeDrawCommands(std::mt19937_64& rng,
+                                                        size_t objectCount) {
+  std::uniform_int_distribution<uint32_t> indexCount(12u, 3000u);
+  std::uniform_int_distribution<uint32_t> runLength(1u, 16u);
+  std::bernoulli_distribution instanced(0.1);
+  std::vector<DrawCommand> commands;
+  uint32_t firstIndex = 0;
+  for (size_t object = 0; object < objectCount;) {
+    const uint32_t instances = static_cast<uint32_t>(
+        std::min<size_t>(instanced(rng) ? runLength(rng) : 1u,
+                         objectCount - object));
+    const uint32_t indices = indexCount(rng) / 3u * 3u;
+    commands.push_back({.objectIndex = static_cast<uint32_t>(object),
+                        .firstIndex = firstIndex,
+                        .indexCount = indices,
+                        .instanceCount = instances});
+    firstIndex += indices;
+    object += instances;
+  }
+  return commands;
+}
+
+[[nodiscard]] std::vector<container::gpu::ObjectData> makeObjectData(
+    std::mt19937_64& rng, size_t objectCount) {
+  std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+  std::uniform_real_distribution<float> radius(0.1f, 8.0f);
+  std::vector<container::gpu::ObjectData> objects(objectCount);
+  for (auto& object : objects) {
+    const glm::vec3 center{position(rng), position(rng) * 0.1f, position(rng)};
+    object.model = glm::translate(glm::mat4(1.0f), center);
+    object.boundingSphere = glm::vec4(center, radius(rng));
+  }
+  return objects;
+}
+
+// A dotbim model whose meshes are split into many ranges, with no
+// importer-provided clusters so cluster metadata has to be derived.
+[[nodiscard]] container::geometry::dotbim::Model makeClusterModel(
+    std::mt19937_64& rng, size_t meshCount) {
+  std::uniform_int_distribution<uint32_t> triangles(8u, 2048u);
+  std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+  container::geometry::dotbim::Model model;
+  model.meshRanges.reserve(meshCount);
+  model.elements.reserve(meshCount);
+  uint32_t firstIndex = 0;
+  for (size_t mesh = 0; mesh < meshCount; ++mesh) {
+    const uint32_t indexCount = triangles(rng) * 3u;
+    const auto meshId = static_cast<uint32_t>(mesh);
+    model.meshRanges.push_back(
+        {.meshId = meshId,
+         .firstIndex = firstIndex,
+         .indexCount = indexCount,
+         .boundsCenter = {position(rng), position(rng), position(rng)},
+         .boundsRadius = 2.0f});
+    model.elements.push_back({.meshId = meshId});
+    firstIndex += indexCount;
+  }
+  return model;
+}
+
+[[nodiscard]] std::string pickLabel(std::mt19937_64& rng,
+                                    std::span<const std::string> labels) {
+  return labels[std::uniform_int_distribution<size_t>(
+      0u, labels.size() - 1u)(rng)];
+}
+
+[[nodiscard]] BimElementMetadataStore makeMetadataStore(std::mt19937_64& rng,
+                                                        size_t count) {
+  const std::array<std::string, 6u> types{
+      "IfcWall", "IfcDoor",  "IfcSlab",
+      "IfcBeam", "IfcPipeSegment", "IfcDuctSegment"};
+  const std::array<std::string, 3u> disciplines{"Architecture", "Structure",
+                                                "MEP"};
+  const std::array<std::string, 3u> materials{"Concrete", "Steel", "Glass"};
+  const std::array<std::string, 3u> phases{"Existing", "New", "Future"};
+  const std::array<std::string, 3u> statuses{"Existing", "New", "Demolished"};
+  std::uniform_int_distribution<uint32_t> storey(1u, 40u);
+
+  BimElementMetadataStore store;
+  store.reserve(count);
+  for (size_t index = 0; index < count; ++index) {
+    BimElementMetadata element{};
+    element.objectIndex = static_cast<uint32_t>(index);
+    element.guid = "guid-" + std::to_string(index);
+    element.type = pickLabel(rng, types);
+    element.storeyName = "Level " + std::to_string(storey(rng));
+    element.materialName = pickLabel(rng, materials);
+    element.discipline = pickLabel(rng, disciplines);
+    element.phase = pickLabel(rng, phases);
+    element.status = pickLabel(rng, statuses);
+    store.append(element);
+  }
+  return store;
+}
+
+// Builds an axis-aligned box of 12 triangles per object.
+void appendBoxTriangles(
+    std::vector<container::renderer::BimSectionCapTriangle>& triangles,
+    uint32_t objectIndex, uint32_t materialIndex, const glm::vec3& center,
+    const glm::vec3& halfExtent) {
+  std::array<glm::vec3, 8> v{};
+  for (uint32_t corner = 0; corner < 8u; ++corner) {
+    v[corner] = center + halfExtent * glm::vec3((corner & 1u) ? 1.0f : -1.0f,
+                                                (corner & 2u) ? 1.0f : -1.0f,
+                                                (corner & 4u) ? 1.0f : -1.0f);
+  }
+  constexpr std::array<std::array<uint32_t, 3>, 12> kFaces{{
+      {{0u, 2u, 3u}}, {{0u, 3u, 1u}}, {{4u, 5u, 7u}}, {{4u, 7u, 6u}},
+      {{0u, 1u, 5u}}, {{0u, 5u, 4u}}, {{2u, 6u, 7u}}, {{2u, 7u, 3u}},
+      {{0u, 4u, 6u}}, {{0u, 6u, 2u}}, {{1u, 3u, 7u}}, {{1u, 7u, 5u}},
+  }};
+  for (const auto& face : kFaces) {
+    triangles.push_back({.objectIndex = objectIndex,
+                         .materialIndex = materialIndex,
+                         .p0 = v[face[0]],
+                         .p1 = v[face[1]],
+                         .p2 = v[face[2]]});
+  }
+}
+
+// Tessellated pipe runs along random axes, the dense kind of mesh MEP
+// elements produce: `segments` facets around, `rings` bands along.
+[[nodiscard]] std::vector<container::renderer::BimSnapTriangle>
+makePipeTriangles(std::mt19937_64& rng, size_t pipeCount, uint32_t segments,
+                  uint32_t rings) {
+  std::uniform_real_distribution<float> position(-20.0f, 20.0f);
+  std::uniform_real_distribution<float> length(2.0f, 8.0f);
+  std::uniform_int_distribution<int> axisPick(0, 2);
+  std::vector<container::renderer::BimSnapTriangle> triangles;
+  triangles.reserve(pipeCount * segments * rings * 2u);
+  for (size_t pipe = 0; pipe < pipeCount; ++pipe) {
+    const int axis = axisPick(rng);
+    const glm::vec3 start{position(rng), position(rng), position(rng)};
+    const float pipeLength = length(rng);
+    auto point = [&](uint32_t ring, uint32_t segment) {
+      const float angle = 6.2831853f * static_cast<float>(segment % segments) /
+                          static_cast<float>(segments);
+      glm::vec3 world = start;
+      world[axis] +=
+          pipeLength * static_cast<float>(ring) / static_cast<float>(rings);
+      world[(axis + 1) % 3] += 0.08f * std::cos(angle);
+      world[(axis + 2) % 3] += 0.08f * std::sin(angle);
+      return world;
+    };
+    for (uint32_t ring = 0; ring < rings; ++ring) {
+      for (uint32_t segment = 0; segment < segments; ++segment) {
+        const glm::vec3 a = point(ring, segment);
+        const glm::vec3 b = point(ring, segment + 1u);
+        const glm::vec3 c = point(ring + 1u, segment + 1u);
+        const glm::vec3 d = point(ring + 1u, segment);
+        const auto object = static_cast<uint32_t>(pipe);
+        triangles.push_back({.objectIndex = object, .p0 = a, .p1 = b, .p2 = c});
+        triangles.push_back({.objectIndex = object, .p0 = a, .p1 = c, .p2 = d});
+      }
+    }
+  }
+  return triangles;
+}
+
+}  // namespace
+
+void registerRendererBenchmarks(BenchmarkRegistry& registry) {
+  registry.add("bim/meshlet_cluster_metadata", [](BenchmarkState& state) {
+    std::mt19937_64 rng(state.seed());
+    const auto model = makeClusterModel(rng, state.scaled(50000u));
+    state.setItems(model.meshRanges.size());
+    size_t clusters = 0;
+    state.measure([&] {
+      const auto metadata =
+          container::renderer::detail::bimMeshletClusterMetadataForModel(
+              model);
+      clusters = metadata.size();
+      keepResult(clusters);
+    });
+    state.counter("clusters", static_cast<double>(clusters));
+  });
+
+  registry.add("bim/draw_compaction_plan", [](BenchmarkState& state) {
+    std::mt19937_64 rng(state.seed());
+    constexpr size_t kSlotCount = 11u;
+    std::array<std::vector<DrawCommand>, kSlotCount> lists{};
+    for (auto& list : lists) {
+      list = makeDrawCommands(rng, state.scaled(10000u));
+    }
+    const container::renderer::BimDrawCompactionPlanInputs inputs{
+        .opaqueSingleSided = &lists[0],
+        .opaqueWindingFlipped = &lists[1],
+        .opaqueDoubleSided = &lists[2],
+        .transparentAggregate = &lists[3],
+        .transparentSingleSided = &lists[4],
+        .transparentWindingFlipped = &lists[5],
+        .transparentDoubleSided = &lists[6],
+        .nativePointOpaque = &lists[7],
+        .nativePointTransparent = &lists[8],
+        .nativeCurveOpaque = &lists[9],
+        .nativeCurveTransparent = &lists[10],
+    };
+    // Planning is per frame and cheap, so each iteration plans a batch.
+    const size_t batch = state.scaled(10000u);
+    state.setItems(batch);
+    state.measure([&] {
+      for (size_t i = 0; i < batch; ++i) {
+        const container::renderer::BimDrawCompactionPlanner planner(inputs);
+        keepResult(planner.build().size());
+      }
+    });
+  });
+
+  registry.add("shadow/cascade_draw_plan", [](BenchmarkState& state) {
+    std::mt19937_64 rng(state.seed());
+    const size_t objectCount = state.scaled(200000u);
+    const auto objects = makeObjectData(rng, objectCount);
+    const auto singleSided = makeDrawCommands(rng, objectCount);
+
+    container::renderer::ShadowCascadeDrawPlannerInputs inputs{};
+    inputs.scene = {.objectData = &objects, .objectDataRevision = 1u};
+    inputs.sceneDraws = {.singleSided = &singleSided};
+    inputs.shadowPassActive.fill(true);
+    // Cascades cover growing distances from the origin.
+    inputs.cascadeIntersectsSphere = [](uint32_t cascadeIndex,
+                                        const glm::vec4& bounds) {
+      const float limit = 60.0f * static_cast<float>(1u << (cascadeIndex * 2u));
+      return glm::length(glm::vec3(bounds)) - bounds.w <= limit;
+    };
+    state.setItems(objectCount);
+    size_t planned = 0;
+    state.measure([&] {
+      const auto plan =
+          container::renderer::ShadowCascadeDrawPlanner(inputs).build();
+      planned = 0;
+      for (uint32_t cascade = 0; cascade < container::gpu::kShadowCascadeCount;
+           ++cascade) {
+        planned += plan.cpuCommandCount(cascade, true);
+      }
+      keepResult(planned);
+    });
+    state.counter("planned_commands", static_cast<double>(planned));
+  });
+
+  registry.add("bim/draw_filter_index_rebuild", [](BenchmarkState& state) {
+    std::mt19937_64 rng(state.seed());
+    const BimElementMetadataStore metadata =
+        makeMetadataStore(rng, state.scaled(200000u));
+    const auto draws = makeDrawCommands(rng, metadata.size());
+    BimDrawFilter filter{};
+    filter.typeFilterEnabled = true;
+    filter.type = "IfcWall";
+    BimDrawFilterState filterState;
+    uint64_t revision = 0;
+    state.setItems(metadata.size());
+    // A new revision forces the per-label bitmaps to be rebuilt.
+    state.measure([&] {
+      const BimDrawFilterStateInputs inputs{
+          .revision = ++revision,
+          .objectCount = metadata.size(),
+          .metadata = &metadata,
+          .opaqueSingleSidedDrawCommands = &draws,
+      };
+      keepResult(filterState.visibleObjects(filter, inputs).cardinality());
+    });
+    state.counter("index_bytes",
+                  static_cast<double>(filterState.indexMemoryBytes()));
+  });
+
+  registry.add("bim/draw_filter_evaluate", [](BenchmarkState& state) {
+    std::mt19937_64 rng(state.seed());
+    const BimElementMetadataStore metadata =
+        makeMetadataStore(rng, state.scaled(200000u));
+    const auto draws = makeDrawCommands(rng, metadata.size());
+    const BimDrawFilterStateInputs inputs{
+        .revision = 1u,
+        .objectCount = metadata.size(),
+        .metadata = &metadata,
+        .opaqueSingleSidedDrawCommands = &draws,
+    };
+    // Alternate between two filters so every call re-evaluates and refilters
+    // the draw lists against an already built index.
+    std::array<BimDrawFilter, 2u> filters{};
+    filters[0].storeyFilterEnabled = true;
+    filters[0].storey = "Level 3";
+    filters[0].materialFilterEnabled = true;
+    filters[0].material = "Concrete";
+    filters[1].disciplineFilterEnabled = true;
+    filters[1].discipline = "MEP";
+    filters[1].statusFilterEnabled = true;
+    filters[1].status = "New";
+    BimDrawFilterState filterState;
+    (void)filterState.visibleObjects(filters[0], inputs);
+    size_t next = 0;
+    state.setItems(metadata.size());
+    state.measure([&] {
+      const BimDrawFilter& filter = filters[next++ % filters.size()];
+      const auto& lists = filterState.filteredDrawLists(filter, inputs);
+      keepResult(lists.opaqueSingleSidedDrawCommands.size());
+    });
+  });
+
+  registry.add("render_graph/compile", [](BenchmarkState& state) {
+    std::mt19937_64 rng(state.seed());
+    // Each graph registers every pass with its canonical dependencies, in a
+    // seeded order so the sort does not always see a presorted input.
+    std::vector<RenderPassId> order;
+    for (size_t id = 0; id < container::renderer::kRenderPassIdCount; ++id) {
+      order.push_back(static_cast<RenderPassId>(id));
+    }
+    std::vector<std::unique_ptr<RenderGraph>> graphs(state.scaled(1000u));
+    for (auto& graph : graphs) {
+      std::ranges::shuffle(order, rng);
+      graph = std::make_unique<RenderGraph>();
+      for (const RenderPassId id : order) {
+        graph->addPass(id, [](VkCommandBuffer,
+                              const container::renderer::FrameRecordParams&) {
+        });
+      }
+    }
+    state.setItems(graphs.size());
+    state.counter("passes",
+                  static_cast<double>(container::renderer::kRenderPassIdCount));
+    state.measure([&] {
+      for (const auto& graph : graphs) {
+        graph->compile();
+        keepResult(graph->executionPassIds().size());
+      }
+    });
+  });
+
+  registry.add("bim/section_cap_build", [](BenchmarkState& state) {
+    std::mt19937_64 rng(state.seed());
+    std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> extent(0.2f, 3.0f);
+    std::uniform_int_distribution<uint32_t> material(0u, 7u);
+    const size_t objectCount = state.scaled(20000u);
+    std::vector<container::renderer::BimSectionCapTriangle> triangles;
+    triangles.reserve(objectCount * 12u);
+    for (size_t object = 0; object < objectCount; ++object) {
+      appendBoxTriangles(triangles, static_cast<uint32_t>(object),
+                         material(rng),
+                         {position(rng), position(rng) * 0.2f, position(rng)},
+                         {extent(rng), extent(rng), extent(rng)});
+    }
+    container::renderer::BimSectionCapBuildOptions options{};
+    options.sectionPlane = {0.0f, 1.0f, 0.0f, 0.0f};
+    const container::renderer::BimSectionCapBuilder builder;
+    state.setItems(triangles.size());
+    size_t capIndices = 0;
+    state.measure([&] {
+      const auto cap = builder.build(triangles, options);
+      capIndices = cap.indices.size();
+      keepResult(capIndices);
+    });
+    state.counter("cap_indices", static_cast<double>(capIndices));
+  });
+
+  registry.add("bim/snap_feature_grid_build", [](BenchmarkState& state) {
+    std::mt19937_64 rng(state.seed());
+    const auto triangles =
+        makePipeTriangles(rng, state.scaled(800u), 32u, 24u);
+    state.setItems(triangles.size());
+    size_t featureCount = 0;
+    state.measure([&] {
+      const container::renderer::BimSnapFeatureGrid grid(triangles);
+      featureCount = grid.features().size();
+      keepResult(featureCount);
+    });
+    state.counter("features", static_cast<double>(featureCount));
+  });
+
+  registry.add("bim/snap_feature_query", [](BenchmarkState& state) {
+    std::mt19937_64 rng(state.seed());
+    const container::renderer::BimSnapFeatureGrid grid(
+        makePipeTriangles(rng, state.scaled(800u), 32u, 24u));
+    if (grid.empty()) {
+      return;
+    }
+    const glm::mat4 projection = container::math::perspectiveRH_ReverseZ(
+        0.9f, 16.0f / 9.0f, 0.05f, 500.0f);
+    std::uniform_int_distribution<size_t> pick(0u,
+                                               grid.features().size() - 1u);
+    // One query per simulated mouse move, each from a camera a few metres
+    // away from the hovered feature.
+    std::vector<container::renderer::BimSnapFeatureQuery> queries(1024u);
+    for (auto& query : queries) {
+      query.hitPoint = grid.features()[pick(rng)].position;
+      query.viewProj =
+          projection * container::math::lookAt(
+                           query.hitPoint + glm::vec3(3.0f, 4.0f, 5.0f),
+                           query.hitPoint, glm::vec3(0.0f, 1.0f, 0.0f));
+      query.inverseViewProj = glm::inverse(query.viewProj);
+      query.viewportSize = {1920.0f, 1080.0f};
+      query.maxScreenDistancePixels = 12.0f;
+    }
+    state.setItems(queries.size());
+    std::vector<container::renderer::BimSnapCandidate> candidates;
+    state.measure([&] {
+      size_t total = 0;
+      for (const auto& query : queries) {
+        candidates.clear();
+        grid.query(query, candidates);
+        total += candidates.size();
+      }
+      keepResult(total);
+    });
+    state.counter("features", static_cast<double>(grid.features().size()));
+  });
+}
+
+}  // namespace container::bench
@@ -0,0 +1,138 @@
+#include "BenchmarkHarness.h"
+
+#include "Container/renderer/scene/LooseOctree.h"
+#include "Container/utility/SceneGraph.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace container::bench {
+
+namespace {
+
+using container::renderer::LooseOctree;
+using container::renderer::LooseOctreeBounds;
+using container::renderer::LooseOctreeRayHit;
+using container::scene::SceneGraph;
+
+// A forest of `nodeCount` nodes: every node picks a random earlier node as
+// its parent, except for roughly one root per hundred nodes. Parenting right
+// after creation keeps the roots list, and so setup, short.
+[[nodiscard]] SceneGraph makeSceneGraph(std::mt19937_64& rng,
+                                        size_t nodeCount) {
+  std::uniform_real_distribution<float> offset(-10.0f, 10.0f);
+  std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+  std::bernoulli_distribution root(0.01);
+  SceneGraph graph;
+  for (size_t index = 0; index < nodeCount; ++index) {
+    const glm::mat4 local = glm::rotate(
+        glm::translate(glm::mat4(1.0f),
+                       {offset(rng), offset(rng), offset(rng)}),
+        angle(rng), glm::vec3(0.0f, 1.0f, 0.0f));
+    const bool renderable = index % 4u != 0u;
+    const uint32_t node = graph.createNode(local, 0u, renderable);
+    if (index != 0u && !root(rng)) {
+      const auto parent = std::uniform_int_distribution<uint32_t>(
+          0u, node - 1u)(rng);
+      graph.setParent(node, parent);
+    }
+  }
+  return graph;
+}
+
+void updateWorldTransforms(BenchmarkState& state) {
+  std::mt19937_64 rng(state.seed());
+  SceneGraph graph = makeSceneGraph(rng, state.scaled(200000u));
+  state.setItems(graph.nodeCount());
+  state.counter("roots", static_cast<double>(graph.rootNodes().size()));
+  state.measure([&] {
+    graph.updateWorldTransforms();
+    keepResult(graph.nodeCount());
+  });
+}
+
+// `count` small boxes scattered through a 1000-unit cube, the way object
+// bounds spread over a large model.
+[[nodiscard]] std::vector<LooseOctreeBounds> makeObjectBounds(
+    std::mt19937_64& rng, size_t count) {
+  std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+  std::uniform_real_distribution<float> extent(0.05f, 2.0f);
+  std::vector<LooseOctreeBounds> bounds;
+  bounds.reserve(count);
+  for (size_t index = 0; index < count; ++index) {
+    const glm::vec3 center{position(rng), position(rng), position(rng)};
+    const glm::vec3 half{extent(rng), extent(rng), extent(rng)};
+    bounds.push_back({.min = center - half, .max = center + half});
+  }
+  return bounds;
+}
+
+[[nodiscard]] LooseOctree makeObjectOctree(
+    const std::vector<LooseOctreeBounds>& bounds) {
+  LooseOctree octree({.min = glm::vec3(-500.0f), .max = glm::vec3(500.0f)});
+  for (size_t index = 0; index < bounds.size(); ++index) {
+    octree.insert(static_cast<uint32_t>(index), bounds[index]);
+  }
+  return octree;
+}
+
+void octreeMoveObjects(BenchmarkState& state) {
+  std::mt19937_64 rng(state.seed());
+  std::vector<LooseOctreeBounds> bounds =
+      makeObjectBounds(rng, state.scaled(1000000u));
+  LooseOctree octree = makeObjectOctree(bounds);
+  state.setItems(bounds.size());
+  // Alternating small nudges, as animated objects produce frame to frame.
+  float step = 0.01f;
+  state.measure([&] {
+    for (size_t index = 0; index < bounds.size(); ++index) {
+      bounds[index].min.x += step;
+      bounds[index].max.x += step;
+      octree.move(static_cast<uint32_t>(index), bounds[index]);
+    }
+    step = -step;
+    keepResult(octree.size());
+  });
+  const auto stats = octree.stats();
+  state.counter("nodes", static_cast<double>(stats.nodeCount));
+  state.counter("relinked_moves", static_cast<double>(stats.relinkedMoves));
+}
+
+void octreeRayQueries(BenchmarkState& state) {
+  std::mt19937_64 rng(state.seed());
+  const std::vector<LooseOctreeBounds> bounds =
+      makeObjectBounds(rng, state.scaled(1000000u));
+  const LooseOctree octree = makeObjectOctree(bounds);
+  std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+  std::vector<std::pair<glm::vec3, glm::vec3>> rays(state.scaled(1024u));
+  for (auto& [origin, direction] : rays) {
+    origin = {unit(rng) * 500.0f, unit(rng) * 500.0f, unit(rng) * 500.0f};
+    direction = glm::normalize(
+        glm::vec3{unit(rng), unit(rng), 0.5f + 0.5f * unit(rng)});
+  }
+  state.setItems(rays.size());
+  std::vector<LooseOctreeRayHit> hits;
+  state.measure([&] {
+    size_t total = 0;
+    for (const auto& [origin, direction] : rays) {
+      hits.clear();
+      octree.queryRay(origin, direction, 2000.0f, hits);
+      total += hits.size();
+    }
+    keepResult(total);
+  });
+}
+
+}  // namespace
+
+void registerSceneBenchmarks(BenchmarkRegistry& registry) {
+  registry.add("scene_graph/update_world_transforms", updateWorldTransforms);
+  registry.add("loose_octree/move_objects", octreeMoveObjects);
+  registry.add("loose_octree/ray_queries", octreeRayQueries);
+}
+
+}  // namespace container::bench
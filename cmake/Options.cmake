@@ -1,5 +1,7 @@
 option(ENABLE_TESTS "Enable building and running tests" ON)
+option(ENABLE_BENCHMARKS "Build the headless VulkanSceneRenderer_bench target" OFF)
 option(ENABLE_WINDOWED_TESTS "Build tests that require a Vulkan runtime and display" OFF)
+option(ENABLE_GPU_INSTANCE_CULLING "Cull GPU-driven draws per instance and compact the survivors (not yet validated on hardware)" OFF)
 option(ENABLE_VULKAN_VALIDATION_LAYERS "Enable Vulkan Validation Layers" ON)
 option(ENABLE_SAMPLE_MODEL_DOWNLOAD "Download pinned glTF Sample Models during asset generation" ON)
 set(GLTF_SAMPLE_MODELS_DOWNLOAD_TIMEOUT_SECONDS "900" CACHE STRING
@@ -31,6 +31,10 @@ set(SLANG_SPIRV_FLAGS
     -I "${SHADERS_DIR}"
     ${SLANG_MATRIX_LAYOUT_FLAG}
 )
+# Scene vertex shaders read the compacted per-instance cull lists.
+if(ENABLE_GPU_INSTANCE_CULLING)
+    list(APPEND SLANG_SPIRV_FLAGS -DGPU_INSTANCE_CULLING)
+endif()
 
 file(GLOB SLANG_SOURCES CONFIGURE_DEPENDS "${SHADERS_DIR}/*.slang")
 set(SLANG_INCLUDE_SHADER_NAMES
@@ -73,6 +77,15 @@ set(SLANG_COMPUTE_SHADER_NAMES
     exposure_adapt.slang
 )
 
+# Per-instance GPU culling. Not yet validated on hardware, so it is only
+# compiled with ENABLE_GPU_INSTANCE_CULLING; GpuCullManager otherwise uses
+# frustum_cull and occlusion_cull.
+set(SLANG_GPU_INSTANCE_CULL_SHADER_NAMES
+    frustum_cull_instances.slang
+    occlusion_cull_instances.slang
+    cull_emit_draws.slang
+)
+
 set(SLANG_GEOMETRY_SHADER_NAMES
     surface_normals.slang
     wireframe_fallback.slang
@@ -90,7 +103,12 @@ endforeach()
 set(SLANG_RENDER_SHADER_EXCLUDE_NAMES
     ${SLANG_INCLUDE_SHADER_NAMES}
     ${SLANG_COMPUTE_SHADER_NAMES}
+    ${SLANG_GPU_INSTANCE_CULL_SHADER_NAMES}
 )
+if(ENABLE_GPU_INSTANCE_CULLING)
+    list(APPEND SLANG_COMPUTE_SHADER_NAMES
+        ${SLANG_GPU_INSTANCE_CULL_SHADER_NAMES})
+endif()
 foreach(SLANG_RENDER_SHADER_EXCLUDE_NAME IN LISTS SLANG_RENDER_SHADER_EXCLUDE_NAMES)
     string(REPLACE "." "\\." SLANG_RENDER_SHADER_EXCLUDE_REGEX
         "${SLANG_RENDER_SHADER_EXCLUDE_NAME}")
@@ -52,6 +52,9 @@ struct AppConfig {
   uint32_t screenshotWarmupFrames{8};
   uint32_t screenshotCaptureFrame{9};
   float screenshotFixedTimestepSeconds{1.0f / 60.0f};
+  // When set, the frames still in the telemetry history are written here as
+  // a Chrome trace once the main loop ends.
+  std::string telemetryTracePath{};
   bool hasCameraOverride{false};
   std::array<float, 3> cameraPosition{0.0f, 0.0f, 3.0f};
   std::array<float, 3> cameraTarget{0.0f, 0.0f, 0.0f};
@@ -66,6 +66,13 @@ public:
   // Number of entities that carry the LightTag.
   [[nodiscard]] uint32_t pointLightCount() const;
 
+  // Incremented whenever point-light entities are created or destroyed
+  // through this class.  Editing a LightComponent in place through registry()
+  // does not change it.
+  [[nodiscard]] uint64_t pointLightRevision() const {
+    return pointLightRevision_;
+  }
+
   // Number of total entities in the registry.
   [[nodiscard]] uint32_t entityCount() const;
 
@@ -81,6 +88,7 @@ private:
 
   entt::registry registry_;
   entt::entity activeCameraEntity_{entt::null};
+  uint64_t pointLightRevision_{0};
 };
 
 } // namespace container::ecs
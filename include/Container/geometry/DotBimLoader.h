@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Container/common/CommonMath.h"
+#include "Container/geometry/MeshOptimizer.h"
 #include "Container/geometry/Vertex.h"
 #include "Container/utility/Material.h"
 
@@ -162,7 +163,22 @@ struct Model {
 
 [[nodiscard]] Model LoadFromFile(const std::filesystem::path& path,
                                  float importScale = 1.0f);
+[[nodiscard]] Model LoadFromFile(
+    const std::filesystem::path& path, float importScale,
+    const MeshOptimizationOptions& meshOptimization);
+// Both entry points stream the document through a SAX reader: mesh arrays are
+// decoded straight into typed buffers and only one element at a time is held
+// as JSON, so the document tree is never built.
 [[nodiscard]] Model LoadFromJson(std::string_view jsonText,
                                  float importScale = 1.0f);
+namespace detail {
+
+// Parses the whole document into a JSON tree first. Only the tests use it, as
+// the reference the streaming reader must match model for model and error
+// for error.
+[[nodiscard]] Model LoadFromJsonDom(std::string_view jsonText,
+                                    float importScale = 1.0f);
+
+}  // namespace detail
 
 }  // namespace container::geometry::dotbim
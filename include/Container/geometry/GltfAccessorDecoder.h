@@ -0,0 +1,61 @@
+#pragma once
+
+#include <Container/geometry/Vertex.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace container::geometry::gltf {
+
+// glTF 2.0 accessor component types (the TINYGLTF_COMPONENT_TYPE_* values).
+enum class AccessorComponentType : int {
+  Byte = 5120,
+  UnsignedByte = 5121,
+  Short = 5122,
+  UnsignedShort = 5123,
+  UnsignedInt = 5125,
+  Float = 5126,
+};
+
+// A validated, non-sparse accessor: `count` elements of `componentCount`
+// components each, the first one at `data`, `strideBytes` apart.
+struct AccessorSource {
+  const uint8_t* data{nullptr};
+  size_t count{0};
+  size_t strideBytes{0};
+  AccessorComponentType componentType{AccessorComponentType::Float};
+  uint32_t componentCount{0};
+  bool normalized{false};
+};
+
+enum class VertexAttribute {
+  Position,
+  Color,
+  TexCoord0,
+  TexCoord1,
+  Normal,
+  Tangent,
+};
+
+// Converts one component to float, applying glTF normalization rules.  This
+// is the per-scalar reference the bulk decoders are tested against.
+[[nodiscard]] float decodeAccessorComponent(const uint8_t* data,
+                                            AccessorComponentType type,
+                                            bool normalized);
+
+// Decodes the first `outComponents` components of the first `count`
+// elements into floats written `outStrideBytes` apart starting at `out`.
+// Component type, normalization and width are dispatched once per call.
+// Throws std::runtime_error for unsupported component types or when the
+// source is too short.
+void decodeAccessorFloats(const AccessorSource& source, uint32_t outComponents,
+                          size_t count, void* out, size_t outStrideBytes);
+
+// Writes `attribute` of every vertex straight from the accessor.  Colors
+// keep only RGB; TexCoord0 does not touch texCoord1.
+void decodeVertexAttribute(const AccessorSource& source,
+                           VertexAttribute attribute,
+                           std::span<Vertex> vertices);
+
+}  // namespace container::geometry::gltf
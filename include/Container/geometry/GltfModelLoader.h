@@ -1,9 +1,11 @@
 #pragma once
 
+#include <Container/geometry/MeshOptimizer.h>
 #include <Container/geometry/Model.h>
 
 #include <tiny_gltf.h>
 
+#include <cstddef>
 #include <string>
 
 namespace container::geometry {
@@ -13,13 +15,26 @@ struct GltfLoadResult {
   tinygltf::Model gltfModel;
 };
 
+struct GltfLoadOptions {
+  // Threads used for per-primitive processing (normals, winding repair,
+  // tangents). 0 uses the hardware concurrency, 1 stays on the calling
+  // thread. Output is identical for every value.
+  size_t workerCount{0};
+  // Applied to each primitive after normals and tangents are final.
+  MeshOptimizationOptions meshOptimization{};
+};
+
 namespace gltf {
 
 // Responsible solely for reading glTF assets and converting them into
 // runtime geometry structures. Keeps file I/O away from Model.
 Model LoadModelFromFile(const std::string& path);
+Model LoadModelFromFile(const std::string& path,
+                        const GltfLoadOptions& options);
 
 GltfLoadResult LoadModelWithSource(const std::string& path);
+GltfLoadResult LoadModelWithSource(const std::string& path,
+                                   const GltfLoadOptions& options);
 
 }  // namespace gltf
 }  // namespace container::geometry
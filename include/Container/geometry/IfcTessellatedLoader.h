@@ -2,6 +2,7 @@
 
 #include "Container/geometry/DotBimLoader.h"
 
+#include <cstddef>
 #include <filesystem>
 #include <string_view>
 
@@ -11,9 +12,25 @@ namespace container::geometry::ifc {
 // files with tessellated mesh geometry or simple extruded closed profiles.
 using Model = container::geometry::dotbim::Model;
 
+struct IfcLoadOptions {
+  // Threads used to tessellate geometry items and evaluate products. 0 uses
+  // the hardware concurrency, 1 stays on the calling thread. Output is
+  // identical for every value.
+  size_t workerCount{0};
+  // IFC tessellations repeat vertices per face and arrive in authoring order,
+  // so the optimization stage is on by default. Triangles only move within
+  // meshlet-sized blocks, so the clusters built later stay spatially tight.
+  MeshOptimizationOptions meshOptimization{.enabled = true};
+};
+
 [[nodiscard]] Model LoadFromFile(const std::filesystem::path& path,
                                  float importScale = 1.0f);
+[[nodiscard]] Model LoadFromFile(const std::filesystem::path& path,
+                                 float importScale,
+                                 const IfcLoadOptions& options);
 [[nodiscard]] Model LoadFromStep(std::string_view stepText,
                                  float importScale = 1.0f);
+[[nodiscard]] Model LoadFromStep(std::string_view stepText, float importScale,
+                                 const IfcLoadOptions& options);
 
 }  // namespace container::geometry::ifc
@@ -13,6 +13,9 @@ using Model = container::geometry::dotbim::Model;
 
 [[nodiscard]] Model LoadFromFile(const std::filesystem::path& path,
                                  float importScale = 1.0f);
+[[nodiscard]] Model LoadFromFile(
+    const std::filesystem::path& path, float importScale,
+    const MeshOptimizationOptions& meshOptimization);
 [[nodiscard]] Model LoadFromJson(std::string_view jsonText,
                                  float importScale = 1.0f);
 
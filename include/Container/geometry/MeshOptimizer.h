@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Container/geometry/Vertex.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace container::geometry {
+
+namespace dotbim {
+struct Model;
+}  // namespace dotbim
+
+// Post-load index and vertex reordering for GPU efficiency. Every pass keeps
+// the set of triangles (and each triangle's winding) intact; only the order
+// of triangles and the numbering of vertices change.
+struct MeshOptimizationOptions {
+  bool enabled{false};
+  // Merges vertices whose attributes are bit-for-bit identical.
+  bool weldVertices{true};
+  // Forsyth-style triangle ordering for post-transform cache reuse.
+  bool optimizeVertexCache{true};
+  // Reorders cache-friendly triangle clusters so outward-facing ones draw
+  // first, giving up at most `overdrawThreshold` times the cluster's ACMR.
+  bool optimizeOverdraw{true};
+  float overdrawThreshold{1.05f};
+  // Renumbers vertices in first-use order and drops unreferenced ones.
+  bool optimizeVertexFetch{true};
+};
+
+struct VertexCacheStatistics {
+  uint32_t vertexTransforms{0};
+  uint32_t triangleCount{0};
+  uint32_t vertexCount{0};
+  // Average cache miss ratio: transforms per triangle (0.5 is ideal for
+  // large grids, 3 is the worst case).
+  float acmr{0.0f};
+  // Average transform to vertex ratio: transforms per referenced vertex
+  // (1 is ideal).
+  float atvr{0.0f};
+};
+
+// Simulates a FIFO post-transform cache of `cacheSize` entries over a
+// triangle list.
+[[nodiscard]] VertexCacheStatistics analyzeVertexCache(
+    std::span<const uint32_t> indices, size_t vertexCount,
+    uint32_t cacheSize = 16);
+
+// Returns the number of vertices kept. Unreferenced vertices survive until
+// optimizeVertexFetch.
+size_t weldVertices(std::vector<Vertex>& vertices,
+                    std::span<uint32_t> indices);
+void optimizeVertexCache(std::span<uint32_t> indices, size_t vertexCount);
+void optimizeOverdraw(std::span<uint32_t> indices,
+                      std::span<const Vertex> vertices,
+                      float threshold = 1.05f);
+void optimizeVertexFetch(std::vector<Vertex>& vertices,
+                         std::span<uint32_t> indices);
+
+// Runs the enabled passes over one triangle list.
+void optimizeMesh(std::vector<Vertex>& vertices,
+                  std::vector<uint32_t>& indices,
+                  const MeshOptimizationOptions& options);
+
+// Runs the enabled passes over a BIM model. Welding and vertex fetch work on
+// the shared vertex buffer. Triangles are only reordered inside meshlet-sized
+// blocks of each mesh range that never cross a meshlet cluster boundary, so
+// range, native-primitive and cluster index spans keep their triangles and
+// cluster bounds stay exact.
+void optimizeModelGeometry(dotbim::Model& model,
+                           const MeshOptimizationOptions& options);
+
+}  // namespace container::geometry
@@ -9,6 +9,9 @@ namespace container::geometry::usd {
 
 [[nodiscard]] dotbim::Model LoadFromFile(const std::filesystem::path& path,
                                          float importScale = 1.0f);
+[[nodiscard]] dotbim::Model LoadFromFile(
+    const std::filesystem::path& path, float importScale,
+    const MeshOptimizationOptions& meshOptimization);
 [[nodiscard]] dotbim::Model LoadFromText(std::string_view usdText,
                                          float importScale = 1.0f);
 
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace container::geometry::usd {
+
+enum class TokenKind {
+  Identifier,
+  String,
+  Number,
+  // A run of numbers bulk-parsed from a homogeneous array literal such as
+  // `[(0, 0, 0), (1, 0, 0)]`. Emitted between the literal's `[` and `]` in
+  // place of its numbers, commas and parentheses.
+  NumberArray,
+  Symbol,
+  End,
+};
+
+// Token text views the tokenized source, or TokenStream storage for strings
+// that contained escapes; it stays valid while both are alive.
+struct Token {
+  TokenKind kind{TokenKind::End};
+  std::string_view text{};
+  double number{0.0};
+  size_t firstNumber{0};
+  size_t numberCount{0};
+};
+
+struct TokenStream {
+  std::vector<Token> tokens{};
+  std::vector<double> numbers{};
+  std::deque<std::string> unescapedStrings{};
+
+  [[nodiscard]] std::span<const double> numbersOf(const Token& token) const {
+    return std::span<const double>(numbers).subspan(token.firstNumber,
+                                                    token.numberCount);
+  }
+};
+
+struct TokenizeOptions {
+  bool bulkNumberArrays{true};
+};
+
+// Splits USDA text into identifiers, strings, numbers and single-character
+// symbols, skipping whitespace and `#` comments. The stream always ends with
+// an End token. Numbers are parsed with std::from_chars and match strtod in
+// the C locale.
+[[nodiscard]] TokenStream tokenize(std::string_view text,
+                                   TokenizeOptions options = {});
+
+}  // namespace container::geometry::usd
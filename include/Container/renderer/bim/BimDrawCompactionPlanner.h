@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory_resource>
 #include <vector>
 
 namespace container::renderer {
@@ -32,7 +33,11 @@ class BimDrawCompactionPlanner {
 public:
   explicit BimDrawCompactionPlanner(BimDrawCompactionPlanInputs inputs);
 
-  [[nodiscard]] std::vector<BimDrawCompactionPlanSource> build() const;
+  // The plan only lives for the frame it is built in, so callers pass the
+  // frame arena.
+  [[nodiscard]] std::pmr::vector<BimDrawCompactionPlanSource>
+  build(std::pmr::memory_resource *resource =
+            std::pmr::get_default_resource()) const;
 
 private:
   BimDrawCompactionPlanInputs inputs_{};
@@ -41,7 +46,9 @@ private:
 [[nodiscard]] BimDrawCompactionPlanInputs
 makeBimDrawCompactionPlanInputs(const BimManager &bimManager);
 
-[[nodiscard]] std::vector<BimDrawCompactionPlanSource>
-buildBimDrawCompactionPlan(const BimDrawCompactionPlanInputs &inputs);
+[[nodiscard]] std::pmr::vector<BimDrawCompactionPlanSource>
+buildBimDrawCompactionPlan(const BimDrawCompactionPlanInputs &inputs,
+                           std::pmr::memory_resource *resource =
+                               std::pmr::get_default_resource());
 
 } // namespace container::renderer
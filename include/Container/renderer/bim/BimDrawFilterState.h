@@ -1,11 +1,17 @@
 #pragma once
 
+#include "Container/renderer/bim/BimElementMetadataStore.h"
 #include "Container/renderer/bim/BimManager.h"
+#include "Container/renderer/bim/BimMetadataCatalog.h"
+#include "Container/renderer/bim/BimObjectBitmap.h"
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <span>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace container::renderer {
@@ -13,8 +19,11 @@ namespace container::renderer {
 struct BimDrawFilterStateInputs {
   uint64_t revision{0};
   size_t objectCount{0};
-  std::span<const BimElementMetadata> metadata{};
+  const BimElementMetadataStore *metadata{nullptr};
   std::span<const std::string> phaseOrder{};
+  // Optional shared label catalog. When absent, or when it does not know a
+  // label present in `metadata`, the filter index registers its own labels.
+  const BimMetadataCatalog *catalog{nullptr};
   const std::vector<DrawCommand> *opaqueDrawCommands{nullptr};
   const std::vector<DrawCommand> *opaqueSingleSidedDrawCommands{nullptr};
   const std::vector<DrawCommand> *opaqueWindingFlippedDrawCommands{nullptr};
@@ -30,6 +39,9 @@ struct BimDrawFilterStateInputs {
   const BimGeometryDrawLists *nativeCurveDrawLists{nullptr};
 };
 
+// Evaluates BIM draw filters as set algebra over per-label object bitmaps.
+// The bitmaps are built once per metadata revision; objectMatchesFilter()
+// keeps the per-object string matching path as the reference behavior.
 class BimDrawFilterState {
 public:
   void clear();
@@ -37,14 +49,62 @@ public:
   [[nodiscard]] bool
   objectMatchesFilter(uint32_t objectIndex, const BimDrawFilter &filter,
                       const BimDrawFilterStateInputs &inputs) const;
+  [[nodiscard]] const BimObjectBitmap &
+  visibleObjects(const BimDrawFilter &filter,
+                 const BimDrawFilterStateInputs &inputs);
   [[nodiscard]] const BimDrawLists &
   filteredDrawLists(const BimDrawFilter &filter,
                     const BimDrawFilterStateInputs &inputs);
+  [[nodiscard]] size_t indexMemoryBytes() const;
 
 private:
+  [[nodiscard]] bool indexCurrent(const BimDrawFilterStateInputs &inputs) const;
+  void rebuildIndex(const BimDrawFilterStateInputs &inputs);
+  [[nodiscard]] bool
+  indexLabels(const BimDrawFilterStateInputs &inputs,
+              const BimMetadataCatalog &catalog);
+  [[nodiscard]] const BimMetadataCatalog &
+  indexCatalog(const BimDrawFilterStateInputs &inputs) const;
+  [[nodiscard]] const BimObjectBitmap &
+  labelObjects(BimMetadataSemanticCategory category, std::string_view label,
+               const BimDrawFilterStateInputs &inputs) const;
+  [[nodiscard]] BimObjectBitmap
+  productIdentityObjects(BimElementMetadataView selected,
+                         const BimDrawFilterStateInputs &inputs) const;
+  [[nodiscard]] BimObjectBitmap
+  phaseTimelineObjects(const BimDrawFilter &filter,
+                       const BimDrawFilterStateInputs &inputs) const;
+  [[nodiscard]] BimObjectBitmap
+  evaluate(const BimDrawFilter &filter,
+           const BimDrawFilterStateInputs &inputs) const;
+
   BimDrawFilter cachedFilter_{};
   uint64_t cachedRevision_{std::numeric_limits<uint64_t>::max()};
   BimDrawLists filteredDrawLists_{};
+
+  BimDrawFilter cachedVisibleFilter_{};
+  uint64_t cachedVisibleRevision_{std::numeric_limits<uint64_t>::max()};
+  BimObjectBitmap visibleObjects_{};
+
+  uint64_t indexRevision_{std::numeric_limits<uint64_t>::max()};
+  const BimElementMetadataStore *indexedMetadata_{nullptr};
+  size_t indexedMetadataCount_{0};
+  size_t indexedPhaseCount_{0};
+  bool indexUsesLocalCatalog_{false};
+  BimMetadataCatalog localCatalog_{};
+  std::array<std::vector<BimObjectBitmap>, kBimMetadataSemanticCategoryCount>
+      objectsByLabelId_{};
+  BimObjectBitmap indexedObjects_{};
+  BimObjectBitmap mepObjects_{};
+  BimObjectBitmap demolishedObjects_{};
+  BimObjectBitmap unphasedObjects_{};
+  std::vector<BimObjectBitmap> objectsByPhaseIndex_{};
+  BimObjectBitmap emptyGuidObjects_{};
+  BimObjectIndexLookup objectsByGuid_{};
+  BimObjectIndexLookup objectsBySourceId_{};
+  // (metadata.objectIndex, position) pairs for entries whose stored object
+  // index differs from their row in the metadata store.
+  std::vector<std::pair<uint32_t, uint32_t>> relocatedObjectIndices_{};
 };
 
 [[nodiscard]] bool bimDrawFiltersEqual(const BimDrawFilter &lhs,
@@ -0,0 +1,230 @@
+#pragma once
+
+#include "Container/renderer/bim/BimManager.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace container::renderer {
+
+// Append-only string interner. Id 0 is always the empty string and views stay
+// valid until clear(), so they can be handed out without copying.
+class BimStringTable {
+public:
+  static constexpr uint32_t kEmptyStringId = 0u;
+  static constexpr uint32_t kInvalidStringId =
+      std::numeric_limits<uint32_t>::max();
+
+  BimStringTable();
+
+  void clear();
+  [[nodiscard]] uint32_t intern(std::string_view text);
+  [[nodiscard]] uint32_t find(std::string_view text) const;
+  [[nodiscard]] std::string_view view(uint32_t id) const;
+  [[nodiscard]] size_t size() const { return views_.size(); }
+  [[nodiscard]] size_t memoryBytes() const;
+
+private:
+  [[nodiscard]] std::string_view store(std::string_view text);
+
+  std::vector<std::unique_ptr<char[]>> blocks_{};
+  size_t blockUsed_{0};
+  size_t blockCapacity_{0};
+  size_t characterBytes_{0};
+  std::vector<std::string_view> views_{};
+  std::unordered_map<std::string_view, uint32_t> ids_{};
+};
+
+enum class BimElementStringField : uint8_t {
+  Guid,
+  Type,
+  DisplayName,
+  ObjectType,
+  StoreyName,
+  StoreyId,
+  MaterialName,
+  MaterialCategory,
+  Discipline,
+  Phase,
+  FireRating,
+  LoadBearing,
+  Status,
+  SourceId,
+};
+
+inline constexpr size_t kBimElementStringFieldCount = 14u;
+
+struct BimElementPropertyRecord {
+  uint32_t elementIndex{0};
+  uint32_t setId{BimStringTable::kEmptyStringId};
+  uint32_t nameId{BimStringTable::kEmptyStringId};
+  uint32_t valueId{BimStringTable::kEmptyStringId};
+  uint32_t categoryId{BimStringTable::kEmptyStringId};
+};
+
+struct BimElementPropertyView {
+  std::string_view set{};
+  std::string_view name{};
+  std::string_view value{};
+  std::string_view category{};
+};
+
+class BimElementMetadataStore;
+
+// Non-owning handle to one row of a BimElementMetadataStore. A default
+// constructed view is invalid and converts to false.
+class BimElementMetadataView {
+public:
+  BimElementMetadataView() = default;
+  BimElementMetadataView(const BimElementMetadataStore *store, uint32_t row)
+      : store_(store), row_(row) {}
+
+  [[nodiscard]] bool valid() const { return store_ != nullptr; }
+  explicit operator bool() const { return valid(); }
+  [[nodiscard]] uint32_t row() const { return row_; }
+
+  [[nodiscard]] uint32_t objectIndex() const;
+  [[nodiscard]] uint32_t sourceElementIndex() const;
+  [[nodiscard]] uint32_t meshId() const;
+  [[nodiscard]] uint32_t sourceMaterialIndex() const;
+  [[nodiscard]] uint32_t materialIndex() const;
+  [[nodiscard]] uint32_t semanticTypeId() const;
+  [[nodiscard]] uint32_t productIdentityId() const;
+  [[nodiscard]] const glm::vec4 &sourceColor() const;
+  [[nodiscard]] bool transparent() const;
+  [[nodiscard]] bool doubleSided() const;
+  [[nodiscard]] const BimElementBounds &bounds() const;
+  [[nodiscard]] BimGeometryKind geometryKind() const;
+
+  [[nodiscard]] std::string_view field(BimElementStringField field) const;
+  [[nodiscard]] uint32_t fieldId(BimElementStringField field) const;
+  [[nodiscard]] std::string_view guid() const;
+  [[nodiscard]] std::string_view type() const;
+  [[nodiscard]] std::string_view displayName() const;
+  [[nodiscard]] std::string_view objectType() const;
+  [[nodiscard]] std::string_view storeyName() const;
+  [[nodiscard]] std::string_view storeyId() const;
+  [[nodiscard]] std::string_view materialName() const;
+  [[nodiscard]] std::string_view materialCategory() const;
+  [[nodiscard]] std::string_view discipline() const;
+  [[nodiscard]] std::string_view phase() const;
+  [[nodiscard]] std::string_view fireRating() const;
+  [[nodiscard]] std::string_view loadBearing() const;
+  [[nodiscard]] std::string_view status() const;
+  [[nodiscard]] std::string_view sourceId() const;
+
+  [[nodiscard]] std::span<const BimElementPropertyRecord>
+  propertyRecords() const;
+  [[nodiscard]] size_t propertyCount() const;
+  [[nodiscard]] BimElementPropertyView property(size_t index) const;
+
+  // Copies the row back into an owning record, e.g. for export or tests.
+  [[nodiscard]] BimElementMetadata toMetadata() const;
+
+private:
+  const BimElementMetadataStore *store_{nullptr};
+  uint32_t row_{0};
+};
+
+// Columnar element metadata. Every string field is a 32-bit id into a shared
+// BimStringTable, numeric fields live in parallel arrays, and properties are
+// flat (element, set, name, value, category) id records.
+class BimElementMetadataStore {
+public:
+  class Iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = BimElementMetadataView;
+    using difference_type = std::ptrdiff_t;
+
+    Iterator() = default;
+    Iterator(const BimElementMetadataStore *store, uint32_t row)
+        : store_(store), row_(row) {}
+
+    [[nodiscard]] BimElementMetadataView operator*() const {
+      return {store_, row_};
+    }
+    Iterator &operator++() {
+      ++row_;
+      return *this;
+    }
+    Iterator operator++(int) {
+      Iterator previous = *this;
+      ++row_;
+      return previous;
+    }
+    [[nodiscard]] bool operator==(const Iterator &other) const = default;
+
+  private:
+    const BimElementMetadataStore *store_{nullptr};
+    uint32_t row_{0};
+  };
+
+  void clear();
+  void reserve(size_t elementCount);
+  uint32_t append(const BimElementMetadata &metadata);
+
+  [[nodiscard]] size_t size() const { return objectIndices_.size(); }
+  [[nodiscard]] bool empty() const { return objectIndices_.empty(); }
+  [[nodiscard]] BimElementMetadataView operator[](size_t row) const {
+    return {this, static_cast<uint32_t>(row)};
+  }
+  [[nodiscard]] BimElementMetadataView back() const {
+    return (*this)[size() - 1u];
+  }
+  [[nodiscard]] Iterator begin() const { return {this, 0u}; }
+  [[nodiscard]] Iterator end() const {
+    return {this, static_cast<uint32_t>(size())};
+  }
+
+  [[nodiscard]] const BimStringTable &strings() const { return strings_; }
+  [[nodiscard]] std::span<const uint32_t>
+  fieldIds(BimElementStringField field) const;
+  [[nodiscard]] std::span<const BimElementPropertyRecord>
+  propertyRecords() const {
+    return properties_;
+  }
+  [[nodiscard]] size_t memoryBytes() const;
+
+private:
+  friend class BimElementMetadataView;
+
+  [[nodiscard]] std::vector<uint32_t> &column(BimElementStringField field) {
+    return stringColumns_[static_cast<size_t>(field)];
+  }
+
+  std::vector<uint32_t> objectIndices_{};
+  std::vector<uint32_t> sourceElementIndices_{};
+  std::vector<uint32_t> meshIds_{};
+  std::vector<uint32_t> sourceMaterialIndices_{};
+  std::vector<uint32_t> materialIndices_{};
+  std::vector<uint32_t> semanticTypeIds_{};
+  std::vector<uint32_t> productIdentityIds_{};
+  std::vector<glm::vec4> sourceColors_{};
+  std::vector<BimElementBounds> bounds_{};
+  std::vector<BimGeometryKind> geometryKinds_{};
+  std::vector<uint8_t> surfaceFlags_{};
+  std::array<std::vector<uint32_t>, kBimElementStringFieldCount>
+      stringColumns_{};
+  // propertyOffsets_[row] .. propertyOffsets_[row + 1] index properties_.
+  std::vector<uint32_t> propertyOffsets_{0u};
+  std::vector<BimElementPropertyRecord> properties_{};
+  BimStringTable strings_{};
+};
+
+[[nodiscard]] bool sameBimProductIdentity(BimElementMetadataView selected,
+                                          BimElementMetadataView candidate);
+[[nodiscard]] std::string_view
+bimMetadataStoreyLabel(BimElementMetadataView metadata);
+[[nodiscard]] std::string_view
+bimMetadataMaterialLabel(BimElementMetadataView metadata);
+
+} // namespace container::renderer
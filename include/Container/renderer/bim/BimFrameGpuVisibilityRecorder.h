@@ -2,6 +2,8 @@
 
 #include "Container/common/CommonVulkan.h"
 
+#include <memory_resource>
+
 namespace container::renderer {
 
 class BimManager;
@@ -15,7 +17,10 @@ struct BimFrameGpuVisibilityRecordInputs {
   VkDeviceSize objectBufferSize{0};
 };
 
-void prepareBimFrameGpuVisibility(BimManager *manager);
+// `frameArena` backs the per-frame compaction plan; it may be null, in which
+// case the default resource is used.
+void prepareBimFrameGpuVisibility(
+    BimManager *manager, std::pmr::memory_resource *frameArena = nullptr);
 
 [[nodiscard]] bool recordBimFrameGpuVisibilityCommands(
     const BimFrameGpuVisibilityRecordInputs &inputs);
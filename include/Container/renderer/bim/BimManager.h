@@ -7,7 +7,9 @@
 #include "Container/renderer/bim/BimFloorPlanOverlayData.h"
 #include "Container/renderer/bim/BimRelationshipGraph.h"
 #include "Container/renderer/bim/BimSectionCapBuilder.h"
+#include "Container/renderer/bim/BimSectionCapCache.h"
 #include "Container/renderer/bim/BimSemanticColorMode.h"
+#include "Container/renderer/bim/BimSnapFeatureGrid.h"
 #include "Container/renderer/debug/DebugOverlayRenderer.h"
 #include "Container/scene/SceneProvider.h"
 #include "Container/utility/SceneData.h"
@@ -48,6 +50,8 @@ class SceneManager;
 namespace container::renderer {
 
 class BimDrawFilterState;
+class BimElementMetadataStore;
+class BimElementMetadataView;
 class BimMetadataCatalog;
 class BimMetadataIndex;
 struct BimDrawFilterStateInputs;
@@ -649,9 +653,7 @@ public:
   objectData() const {
     return objectData_;
   }
-  [[nodiscard]] const std::vector<BimElementMetadata> &elementMetadata() const {
-    return elementMetadata_;
-  }
+  [[nodiscard]] const BimElementMetadataStore &elementMetadata() const;
   [[nodiscard]] BimCoordinationOverlayResult buildCoordinationOverlay(
       const BimCoordinationOverlayBuildOptions &options,
       std::span<const BimCoordinationOverlayClashPair> clashPairs = {},
@@ -673,7 +675,8 @@ public:
   [[nodiscard]] const BimRelationshipGraph &relationshipGraph() const {
     return relationshipGraph_;
   }
-  [[nodiscard]] const BimElementMetadata *
+  // Invalid (false) view when the object index is out of range.
+  [[nodiscard]] BimElementMetadataView
   metadataForObject(uint32_t objectIndex) const;
   [[nodiscard]] std::span<const uint32_t>
   objectIndicesForGuid(std::string_view guid) const;
@@ -681,6 +684,14 @@ public:
   objectIndicesForSourceId(std::string_view sourceId) const;
   [[nodiscard]] BimElementBounds
   elementBoundsForObject(uint32_t objectIndex) const;
+  // Appends the geometric snap candidates (vertices, feature-edge midpoints
+  // and planar face centres) of the element that owns objectIndex near the
+  // query's hit point. Each element's feature grid is built on first use and
+  // kept until the geometry changes; past a fixed count the least recently
+  // queried grid is dropped.
+  void collectSnapCandidatesForObject(
+      uint32_t objectIndex, const BimSnapFeatureQuery &query,
+      std::vector<BimSnapCandidate> &outCandidates) const;
   [[nodiscard]] const std::vector<std::string> &elementTypes() const;
   [[nodiscard]] const std::vector<std::string> &elementStoreys() const;
   [[nodiscard]] const std::vector<std::string> &elementMaterials() const;
@@ -824,6 +835,8 @@ public:
   [[nodiscard]] bool hasFloorPlanOverlay() const {
     return floorPlanGround_.valid() || floorPlanSourceElevation_.valid();
   }
+  // Only the objects a moved cap plane sweeps across are rebuilt; any other
+  // option change rebuilds every cap.
   bool rebuildSectionClipCapGeometry(const BimSectionCapBuildOptions &options);
   void clearSectionClipCapGeometry();
   [[nodiscard]] const BimSectionClipCapDrawData &
@@ -921,12 +934,12 @@ private:
   uint64_t objectDataRevision_{0};
   std::unique_ptr<BimMetadataCatalog> metadataCatalog_{};
   std::unique_ptr<BimMetadataIndex> metadataIndex_{};
+  std::unique_ptr<BimElementMetadataStore> elementMetadata_{};
   std::unique_ptr<BimDrawFilterState> drawFilterState_{};
 
   std::vector<container::geometry::Vertex> vertices_{};
   std::vector<uint32_t> indices_{};
   std::vector<container::gpu::ObjectData> objectData_{};
-  std::vector<BimElementMetadata> elementMetadata_{};
   BimRelationshipGraph relationshipGraph_{};
   std::vector<DrawCommand> objectDrawCommands_{};
   std::vector<uint32_t> objectDrawCommandOffsets_{};
@@ -992,8 +1005,8 @@ private:
   BimSectionClipCapDrawData sectionClipCapDrawData_{};
   BimCoordinationMarkerDrawData coordinationMarkerDrawData_{};
   BimSectionPlaneVisualDrawData sectionPlaneVisualDrawData_{};
-  std::vector<container::geometry::Vertex> sectionClipCapVertices_{};
-  std::vector<uint32_t> sectionClipCapIndices_{};
+  // Per-object caps laid out in slices of the two cap buffers below.
+  BimSectionCapCache sectionClipCapCache_{};
   container::gpu::AllocatedBuffer sectionClipCapVertexBuffer_{};
   container::gpu::AllocatedBuffer sectionClipCapIndexBuffer_{};
   BimSectionCapBuildOptions sectionClipCapBuildOptions_{};
@@ -1008,6 +1021,14 @@ private:
   container::gpu::AllocatedBuffer sectionPlaneVisualVertexBuffer_{};
   container::gpu::AllocatedBuffer sectionPlaneVisualIndexBuffer_{};
   size_t sectionPlaneVisualGeometrySignature_{0};
+  struct CachedSnapFeatureGrid {
+    BimSnapFeatureGrid grid{};
+    uint64_t lastUsed{0};
+  };
+  // Keyed by the lowest object index of the element's product group.
+  mutable std::unordered_map<uint32_t, CachedSnapFeatureGrid>
+      snapFeatureGrids_{};
+  mutable uint64_t snapFeatureGridClock_{0};
 };
 
 } // namespace container::renderer
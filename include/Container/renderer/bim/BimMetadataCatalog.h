@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Container/renderer/bim/BimElementMetadataStore.h"
 #include "Container/renderer/bim/BimManager.h"
 
 #include <cstddef>
@@ -22,6 +23,8 @@ enum class BimMetadataSemanticCategory : uint8_t {
   Status,
 };
 
+inline constexpr size_t kBimMetadataSemanticCategoryCount = 8u;
+
 class BimMetadataCatalog {
 public:
   void clear();
@@ -48,7 +51,10 @@ public:
   [[nodiscard]] uint32_t registerType(std::string label);
   void registerStorey(const BimElementMetadata &metadata,
                       const BimElementBounds &bounds);
+  void registerStorey(BimElementMetadataView metadata,
+                      const BimElementBounds &bounds);
   void registerMaterial(const BimElementMetadata &metadata);
+  void registerMaterial(BimElementMetadataView metadata);
   void registerDiscipline(std::string label);
   void registerPhase(std::string label);
   void registerFireRating(std::string label);
@@ -56,19 +62,33 @@ public:
   void registerStatus(std::string label);
   void sortStoreyRanges();
 
+  // Zero-based label id in registration order, or UINT32_MAX when the label
+  // is empty or was never registered for the category.
+  [[nodiscard]] uint32_t
+  labelIdForCategory(BimMetadataSemanticCategory category,
+                     std::string_view label) const;
+  [[nodiscard]] size_t
+  labelCountForCategory(BimMetadataSemanticCategory category) const;
   [[nodiscard]] uint32_t
   semanticIdForCategory(BimMetadataSemanticCategory category,
                         std::string_view label) const;
   [[nodiscard]] uint32_t
-  semanticIdForMetadata(const BimElementMetadata &metadata,
+  semanticIdForMetadata(BimElementMetadataView metadata,
                         BimSemanticColorMode mode) const;
   [[nodiscard]] BimVisibilityGpuObjectMetadata
-  visibilityGpuMetadata(const BimElementMetadata &metadata) const;
+  visibilityGpuMetadata(BimElementMetadataView metadata) const;
 
 private:
-  uint32_t registerUniqueLabel(std::unordered_map<std::string, uint32_t> &ids,
+  using LabelIdMap = std::unordered_map<std::string, uint32_t,
+                                        BimIdentityStringHash,
+                                        BimIdentityStringEqual>;
+
+  uint32_t registerUniqueLabel(LabelIdMap &ids,
                                std::vector<std::string> &values,
                                std::string label);
+  void registerStoreyLabel(std::string label, const BimElementBounds &bounds);
+  [[nodiscard]] const LabelIdMap &
+  labelIds(BimMetadataSemanticCategory category) const;
 
   std::vector<std::string> types_{};
   std::vector<std::string> storeys_{};
@@ -80,14 +100,14 @@ private:
   std::vector<std::string> statuses_{};
   std::vector<BimStoreyRange> storeyRanges_{};
 
-  std::unordered_map<std::string, uint32_t> typeIds_{};
-  std::unordered_map<std::string, uint32_t> storeyIds_{};
-  std::unordered_map<std::string, uint32_t> materialIds_{};
-  std::unordered_map<std::string, uint32_t> disciplineIds_{};
-  std::unordered_map<std::string, uint32_t> phaseIds_{};
-  std::unordered_map<std::string, uint32_t> fireRatingIds_{};
-  std::unordered_map<std::string, uint32_t> loadBearingIds_{};
-  std::unordered_map<std::string, uint32_t> statusIds_{};
+  LabelIdMap typeIds_{};
+  LabelIdMap storeyIds_{};
+  LabelIdMap materialIds_{};
+  LabelIdMap disciplineIds_{};
+  LabelIdMap phaseIds_{};
+  LabelIdMap fireRatingIds_{};
+  LabelIdMap loadBearingIds_{};
+  LabelIdMap statusIds_{};
   std::unordered_map<std::string, size_t> storeyRangeIndices_{};
 
   BimModelUnitMetadata modelUnitMetadata_{};
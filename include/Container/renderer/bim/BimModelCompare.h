@@ -38,6 +38,9 @@ enum class BimModelCompareChangeKind : uint32_t {
 
 struct BimModelCompareOptions {
   float boundsTolerance{0.001f};
+  // Upper bound on threads used for fingerprinting and classification; 0
+  // uses the hardware concurrency. Small revisions always run inline.
+  uint32_t workerCount{0};
 };
 
 struct BimModelCompareChange {
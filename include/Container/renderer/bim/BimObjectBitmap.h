@@ -0,0 +1,96 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace container::renderer {
+
+// Roaring-style compressed set of BIM object indices. Indices are bucketed by
+// their high 16 bits; each bucket stores its low 16 bits either as a sorted
+// array (sparse buckets) or as a 65536-bit bitset once it holds more than
+// kBimObjectBitmapArrayLimit entries.
+inline constexpr uint32_t kBimObjectBitmapArrayLimit = 4096u;
+
+namespace detail {
+struct BimObjectBitmapContainer {
+  uint16_t key{0};
+  uint32_t cardinality{0};
+  std::vector<uint16_t> array{};
+  std::vector<uint64_t> bits{};
+
+  [[nodiscard]] bool dense() const { return !bits.empty(); }
+};
+} // namespace detail
+
+class BimObjectBitmap {
+public:
+  [[nodiscard]] static BimObjectBitmap range(uint32_t begin, uint32_t end);
+  [[nodiscard]] static BimObjectBitmap
+  fromIndices(std::span<const uint32_t> indices);
+
+  void clear();
+  void add(uint32_t index);
+
+  [[nodiscard]] bool contains(uint32_t index) const;
+  [[nodiscard]] bool empty() const { return containers_.empty(); }
+  [[nodiscard]] size_t cardinality() const;
+  [[nodiscard]] size_t containerCount() const { return containers_.size(); }
+  [[nodiscard]] size_t memoryBytes() const;
+  [[nodiscard]] std::vector<uint32_t> toVector() const;
+
+  template <typename Fn> void forEach(Fn &&fn) const {
+    for (const Container &container : containers_) {
+      const uint32_t high = static_cast<uint32_t>(container.key) << 16u;
+      if (container.dense()) {
+        for (size_t word = 0; word < container.bits.size(); ++word) {
+          uint64_t bits = container.bits[word];
+          while (bits != 0u) {
+            const uint32_t bit =
+                static_cast<uint32_t>(std::countr_zero(bits));
+            fn(high | static_cast<uint32_t>(word * 64u + bit));
+            bits &= bits - 1u;
+          }
+        }
+      } else {
+        for (uint16_t low : container.array) {
+          fn(high | low);
+        }
+      }
+    }
+  }
+
+  BimObjectBitmap &operator&=(const BimObjectBitmap &other);
+  BimObjectBitmap &operator|=(const BimObjectBitmap &other);
+  BimObjectBitmap &operator-=(const BimObjectBitmap &other);
+
+  [[nodiscard]] friend BimObjectBitmap operator&(BimObjectBitmap lhs,
+                                                 const BimObjectBitmap &rhs) {
+    lhs &= rhs;
+    return lhs;
+  }
+  [[nodiscard]] friend BimObjectBitmap operator|(BimObjectBitmap lhs,
+                                                 const BimObjectBitmap &rhs) {
+    lhs |= rhs;
+    return lhs;
+  }
+  [[nodiscard]] friend BimObjectBitmap operator-(BimObjectBitmap lhs,
+                                                 const BimObjectBitmap &rhs) {
+    lhs -= rhs;
+    return lhs;
+  }
+  friend bool operator==(const BimObjectBitmap &lhs,
+                         const BimObjectBitmap &rhs);
+
+private:
+  using Container = detail::BimObjectBitmapContainer;
+
+  [[nodiscard]] const Container *findContainer(uint16_t key) const;
+  Container &containerFor(uint16_t key);
+
+  std::vector<Container> containers_{};
+};
+
+} // namespace container::renderer
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Container/common/CommonMath.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace container::renderer {
+
+// What the load-time object ordering knows about one renderable element.
+// Objects with equal (bucket, geometryKind, firstIndex, indexCount) can share
+// an instanced draw when their object indices are consecutive.
+struct BimObjectOrderKey {
+  uint8_t bucket{0};
+  uint8_t geometryKind{0};
+  uint32_t firstIndex{0};
+  uint32_t indexCount{0};
+  std::string_view storey{};
+  uint32_t materialIndex{0};
+  bool hasBounds{false};
+  glm::vec3 center{0.0f};
+  float floorElevation{0.0f};
+  uint32_t sourceElementIndex{0};
+};
+
+// Returns the permutation that assigns object indices: element order[i] of
+// `keys` becomes object i. Draw groups stay contiguous; inside a group
+// objects are clustered by storey (lowest first), material and Morton order
+// of their bounds centers, so storey, material and budget filters keep long
+// instance runs. Ties fall back to source element order, making the result
+// deterministic.
+[[nodiscard]] std::vector<uint32_t>
+orderBimObjects(std::span<const BimObjectOrderKey> keys);
+
+// Number of instanced draws appendDrawCommand would emit for the objects in
+// `order` whose `visible` entry is non-zero (all of them when `visible` is
+// empty). `visible` is indexed like `keys`.
+[[nodiscard]] size_t
+countBimInstancedDrawRuns(std::span<const BimObjectOrderKey> keys,
+                          std::span<const uint32_t> order,
+                          std::span<const uint8_t> visible = {});
+
+} // namespace container::renderer
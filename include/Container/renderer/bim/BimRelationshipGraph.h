@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <span>
@@ -14,7 +15,8 @@ struct ElementRelationship;
 
 namespace container::renderer {
 
-struct BimElementMetadata;
+class BimElementMetadataStore;
+class BimElementMetadataView;
 
 enum class BimRelationshipKind : uint32_t {
   SpatialParent,
@@ -47,6 +49,11 @@ struct BimRelationshipSearchResult {
   std::string reason{};
 };
 
+struct BimRelationshipSearchPage {
+  std::vector<BimRelationshipSearchResult> results{};
+  size_t totalMatches{0};
+};
+
 struct BimPropertySetProperty {
   std::string name{};
   std::string value{};
@@ -63,7 +70,7 @@ class BimRelationshipGraph {
 public:
   void clear();
   void build(
-      std::span<const BimElementMetadata> metadata,
+      const BimElementMetadataStore &metadata,
       std::span<const container::geometry::dotbim::ElementRelationship>
           relationships = {});
 
@@ -82,6 +89,10 @@ public:
   edgesForObject(uint32_t objectIndex) const;
   [[nodiscard]] std::vector<BimRelationshipSearchResult>
   search(std::string_view query) const;
+  // Ranked case-insensitive matches in [offset, offset + limit). Exact field
+  // matches rank first, then prefix, word-start and inner substring matches.
+  [[nodiscard]] BimRelationshipSearchPage
+  searchPage(std::string_view query, size_t offset, size_t limit) const;
   [[nodiscard]] std::span<const BimPropertySetGroup>
   propertySetsForObject(uint32_t objectIndex) const;
 
@@ -89,11 +100,12 @@ private:
   struct SearchField {
     uint32_t objectIndex{std::numeric_limits<uint32_t>::max()};
     std::string text{};
+    std::string normalizedText{};
     std::string reason{};
   };
 
   [[nodiscard]] uint32_t addNode(BimRelationshipNode node);
-  [[nodiscard]] uint32_t addObjectNode(const BimElementMetadata &metadata);
+  [[nodiscard]] uint32_t addObjectNode(BimElementMetadataView metadata);
   [[nodiscard]] uint32_t syntheticNode(std::string key, std::string label,
                                        std::string ifcClass,
                                        std::string guid = {},
@@ -111,10 +123,13 @@ private:
       std::string_view guid, std::string_view sourceId) const;
   void addEdge(uint32_t from, uint32_t to, BimRelationshipKind kind,
                std::string label);
-  void addSearchField(uint32_t objectIndex, std::string text,
+  void addSearchField(uint32_t objectIndex, std::string_view text,
                       std::string reason);
   void indexNodeIdentity(uint32_t nodeIndex, const BimRelationshipNode &node);
-  void buildPropertySets(const BimElementMetadata &metadata);
+  void buildSearchIndex();
+  [[nodiscard]] std::vector<uint32_t>
+  searchCandidates(std::string_view normalizedQuery) const;
+  void buildPropertySets(BimElementMetadataView metadata);
 
   std::vector<BimRelationshipNode> nodes_{};
   std::vector<BimRelationshipEdge> edges_{};
@@ -126,6 +141,8 @@ private:
   std::unordered_map<uint32_t, std::vector<BimPropertySetGroup>>
       propertySetsByObject_{};
   std::vector<SearchField> searchFields_{};
+  // Packed lowercase trigram -> ascending search field indices.
+  std::unordered_map<uint32_t, std::vector<uint32_t>> searchPostings_{};
 };
 
 [[nodiscard]] std::string_view
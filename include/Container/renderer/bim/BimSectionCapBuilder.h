@@ -74,6 +74,9 @@ struct BimSectionCapBuildOptions {
   bool sectionMarkersEnabled{true};
   glm::vec3 sectionMarkerColor{0.95f, 0.62f, 0.12f};
   float sectionMarkerLineWidth{2.0f};
+  // Threads used to build independent (object, material) surfaces; 0 uses
+  // the hardware concurrency. Small inputs always build inline.
+  uint32_t workerCount{0};
 };
 
 bool appendBimSectionCapClipPlane(BimSectionCapBuildOptions& options,
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Container/renderer/bim/BimSectionCapBuilder.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace container::renderer {
+
+// Element range of the shared cap vertex or index array that changed in a
+// commit and has to be copied to the GPU.
+struct BimSectionCapBufferRange {
+  size_t first{0};
+  size_t count{0};
+};
+
+struct BimSectionCapCacheUpdate {
+  // The slices were laid out again, so the whole geometry (at its new
+  // capacity) has to be uploaded instead of the ranges below.
+  bool reallocated{false};
+  std::vector<BimSectionCapBufferRange> vertexRanges{};
+  std::vector<BimSectionCapBufferRange> indexRanges{};
+  uint32_t rebuiltObjectCount{0};
+};
+
+// Expands the marker lines of a built cap into line geometry (segment plus
+// arrow heads) drawn through hatch commands with the marker's line width.
+void appendBimSectionMarkerGeometry(BimSectionCapGeneratedMesh& mesh,
+                                    uint32_t objectIndex);
+
+// Per-object section caps from the last build, each kept in its own slice of
+// one shared vertex and index array. Caps are stored with the object-local
+// options they were built from, so when only the cap planes move just the
+// objects whose bounds the planes sweep across need building again; every
+// other object keeps its cached cap bit for bit. Rebuilt caps that still fit
+// their slice are rewritten in place and reported as ranged updates.
+class BimSectionCapCache {
+ public:
+  void reset();
+
+  // True when the cap of `objectIndex` may differ from its cached one if
+  // built with `localOptions`. Only the cap planes are compared; callers
+  // reset() the cache when any other build option changes.
+  [[nodiscard]] bool needsRebuild(
+      uint32_t objectIndex,
+      const BimSectionCapBuildOptions& localOptions) const;
+
+  // Replaces the cap of `objectIndex` with `mesh`, the builder's output for
+  // `triangles` and `localOptions`. Marker lines are expanded here.
+  void store(uint32_t objectIndex,
+             const BimSectionCapBuildOptions& localOptions,
+             std::span<const BimSectionCapTriangle> triangles,
+             BimSectionCapGeneratedMesh mesh);
+
+  // Writes the caps stored since the last commit into their slices and
+  // rebuilds the draw lists in object order.
+  [[nodiscard]] BimSectionCapCacheUpdate commit();
+
+  // Shared geometry sized to the slice capacity. Draw commands index it
+  // directly; vertices and indices outside the slices are never drawn.
+  [[nodiscard]] const BimSectionCapGeneratedMesh& geometry() const {
+    return geometry_;
+  }
+
+ private:
+  struct Entry {
+    bool built{false};
+    bool dirty{false};
+    uint32_t capPlaneCount{0};
+    std::array<glm::vec4, kBimSectionCapMaxPlanes> capPlanes{};
+    bool hasBounds{false};
+    glm::vec3 boundsMin{0.0f};
+    glm::vec3 boundsMax{0.0f};
+    BimSectionCapGeneratedMesh mesh{};
+    size_t firstVertex{0};
+    size_t vertexCapacity{0};
+    size_t firstIndex{0};
+    size_t indexCapacity{0};
+  };
+
+  void layoutSlices();
+  void writeSlice(const Entry& entry);
+  void rebuildDrawLists();
+
+  std::vector<Entry> entries_{};
+  BimSectionCapGeneratedMesh geometry_{};
+  size_t vertexEnd_{0};
+  size_t indexEnd_{0};
+};
+
+}  // namespace container::renderer
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "Container/common/CommonMath.h"
+#include "Container/renderer/bim/BimMeasurementSnapping.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace container::renderer {
+
+// World-space triangle of the element whose snap features are indexed.
+struct BimSnapTriangle {
+  uint32_t objectIndex{std::numeric_limits<uint32_t>::max()};
+  glm::vec3 p0{0.0f};
+  glm::vec3 p1{0.0f};
+  glm::vec3 p2{0.0f};
+};
+
+struct BimSnapFeature {
+  BimSnapKind kind{BimSnapKind::None};
+  uint32_t objectIndex{std::numeric_limits<uint32_t>::max()};
+  glm::vec3 position{0.0f};
+};
+
+// Screen-space neighbourhood of the point under the cursor.
+struct BimSnapFeatureQuery {
+  glm::vec3 hitPoint{0.0f};
+  glm::mat4 viewProj{1.0f};
+  glm::mat4 inverseViewProj{1.0f};
+  glm::vec2 viewportSize{0.0f};
+  float maxScreenDistancePixels{12.0f};
+};
+
+// Work done by one BimSnapFeatureGrid::query.
+struct BimSnapFeatureQueryStats {
+  // Occupied cells whose features were tested.
+  uint32_t visitedCells{0};
+  // Features tested against the pixel radius, whether or not they matched.
+  uint32_t visitedFeatures{0};
+};
+
+// Pixel distance between the projections of `position` and the hit point;
+// nullopt when either lies behind the camera.
+[[nodiscard]] std::optional<float>
+BimSnapScreenDistancePixels(const BimSnapFeatureQuery &query,
+                            glm::vec3 position);
+
+// Geometric snap features of one element bucketed into a uniform grid keyed
+// by quantized position. Construction welds coincident corners and derives
+// vertices, midpoints of feature edges (boundary, creased or non-manifold;
+// the diagonals inside planar faces are skipped) and area-weighted centres
+// of connected coplanar faces. A query only visits the cells whose
+// projection comes within the pixel radius of the hit point, so its cost
+// follows the features under the cursor rather than the element's triangle
+// count.
+class BimSnapFeatureGrid {
+public:
+  BimSnapFeatureGrid() = default;
+  explicit BimSnapFeatureGrid(std::span<const BimSnapTriangle> triangles);
+
+  [[nodiscard]] bool empty() const { return features_.empty(); }
+  // Features grouped by cell.
+  [[nodiscard]] std::span<const BimSnapFeature> features() const {
+    return features_;
+  }
+  [[nodiscard]] float cellSize() const { return cellSize_; }
+  [[nodiscard]] size_t cellCount() const { return cells_.size(); }
+
+  // Appends the features in front of the camera whose projection lies
+  // within maxScreenDistancePixels of the hit point's, with
+  // screenDistancePixels filled in.
+  BimSnapFeatureQueryStats query(const BimSnapFeatureQuery &query,
+                                 std::vector<BimSnapCandidate> &out) const;
+
+private:
+  struct CellRange {
+    uint32_t first{0};
+    uint32_t count{0};
+  };
+  struct OccupiedCell {
+    glm::ivec3 cell{0};
+    CellRange features{};
+  };
+
+  [[nodiscard]] glm::ivec3 cellCoordinate(glm::vec3 position) const;
+  [[nodiscard]] static glm::ivec3 blockCoordinate(glm::ivec3 cell);
+  [[nodiscard]] static uint64_t cellKey(glm::ivec3 cell);
+
+  std::vector<BimSnapFeature> features_{};
+  // Occupied cells, those of a block contiguous. Queries flood the blocks,
+  // which keeps the empty space along the line of sight cheap to skip.
+  std::vector<OccupiedCell> cells_{};
+  std::unordered_map<uint64_t, CellRange> blocks_{};  // Ranges of cells_.
+  glm::vec3 origin_{0.0f};
+  glm::ivec3 maxCell_{0};
+  glm::ivec3 maxBlock_{0};
+  float cellSize_{1.0f};
+};
+
+} // namespace container::renderer
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace container::renderer {
+
+#ifdef NDEBUG
+inline constexpr bool kFrameArenaPoisonOnResetDefault = false;
+#else
+inline constexpr bool kFrameArenaPoisonOnResetDefault = true;
+#endif
+
+struct FrameArenaStats {
+  // Bytes and allocations handed out since the last reset.
+  size_t bytesAllocated{0};
+  size_t allocationCount{0};
+  // Bytes owned by the arena across all of its blocks.
+  size_t capacityBytes{0};
+  // Largest per-frame footprint seen so far, including alignment padding.
+  size_t highWaterBytes{0};
+  // Blocks requested from the upstream resource over the arena's lifetime.
+  // Stays constant once the frame footprint has stabilised.
+  uint64_t upstreamAllocationCount{0};
+  uint64_t resetCount{0};
+};
+
+// Monotonic allocator for data that lives exactly one frame in flight, e.g.
+// planner outputs consumed while recording that frame's command buffer.
+// Allocation bumps a pointer and deallocation is a no-op; reset() rewinds the
+// arena once the frame's fence has signalled. When a frame overflows the
+// primary block the overflow is served from extra blocks, and the next reset
+// folds them into a single block large enough for the high-water mark, so a
+// steady-state frame does not touch the upstream resource at all.
+//
+// With poisonOnReset the used bytes are overwritten with kPoisonByte on every
+// reset, which turns a stale pointer into an obviously bogus read.
+class FrameArena final : public std::pmr::memory_resource {
+public:
+  static constexpr size_t kDefaultInitialCapacity = 64u * 1024u;
+  static constexpr unsigned char kPoisonByte = 0xcdu;
+
+  explicit FrameArena(
+      size_t initialCapacity = kDefaultInitialCapacity,
+      bool poisonOnReset = kFrameArenaPoisonOnResetDefault,
+      std::pmr::memory_resource *upstream = std::pmr::new_delete_resource());
+  ~FrameArena() override;
+
+  FrameArena(const FrameArena &) = delete;
+  FrameArena &operator=(const FrameArena &) = delete;
+
+  // Invalidates every allocation made since the previous reset.
+  void reset();
+
+  [[nodiscard]] bool poisonOnReset() const { return poisonOnReset_; }
+  void setPoisonOnReset(bool enabled) { poisonOnReset_ = enabled; }
+
+  [[nodiscard]] FrameArenaStats stats() const;
+
+private:
+  struct Block {
+    std::byte *data{nullptr};
+    size_t size{0};
+    size_t used{0};
+  };
+
+  void *do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void *, size_t, size_t) override {}
+  [[nodiscard]] bool
+  do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+  [[nodiscard]] Block allocateBlock(size_t size);
+  void releaseBlocks();
+  [[nodiscard]] size_t usedBytes() const;
+
+  std::pmr::memory_resource *upstream_{nullptr};
+  // blocks_[0] is the primary block; later entries only exist between an
+  // overflowing frame and the next reset.
+  std::vector<Block> blocks_{};
+  size_t bytesAllocated_{0};
+  size_t allocationCount_{0};
+  size_t highWaterBytes_{0};
+  uint64_t upstreamAllocationCount_{0};
+  uint64_t resetCount_{0};
+  bool poisonOnReset_{kFrameArenaPoisonOnResetDefault};
+};
+
+} // namespace container::renderer
@@ -15,6 +15,7 @@
 #include <cstdint>
 #include <functional>
 #include <limits>
+#include <memory_resource>
 #include <string_view>
 #include <vector>
 
@@ -56,6 +57,9 @@ struct FrameRecordLifecycleHooks {
 
 struct FrameRuntimeResources {
   uint32_t imageIndex{0};
+  // Reset once this frame slot's fence signals; holds planner outputs that
+  // are only read while recording the frame.
+  std::pmr::memory_resource *frameArena{nullptr};
 };
 
 struct FrameSceneGeometry {
@@ -4,6 +4,8 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <span>
+#include <string>
 #include <vector>
 
 namespace container::renderer {
@@ -26,7 +28,9 @@ struct RayTracingGeometryBuildInput {
   uint64_t instanceRevision{0};
   container::scene::SceneProviderBounds bounds{};
   bool hasOpaqueGeometry{false};
-  std::vector<container::scene::SceneProviderTriangleBatch> triangleBatches{};
+  // Points into the provider; valid for the frame it was extracted in.
+  std::span<const container::scene::SceneProviderTriangleBatch>
+      triangleBatches{};
 };
 
 struct SplattingDispatchInput {
@@ -46,12 +50,17 @@ struct RadianceFieldDispatchInput {
   bool usesOccupancyData{false};
 };
 
+[[nodiscard]] inline container::scene::SceneProviderId providerId(
+    const container::scene::SceneProviderView& provider) {
+  return container::scene::SceneProviderId{std::string(provider.id)};
+}
+
 class MeshRasterExtractor {
  public:
   virtual ~MeshRasterExtractor() = default;
 
   [[nodiscard]] virtual RasterDrawBatchDesc extract(
-      const container::scene::SceneProviderSnapshot& provider) const = 0;
+      const container::scene::SceneProviderView& provider) const = 0;
 };
 
 class BimRasterExtractor {
@@ -59,7 +68,7 @@ class BimRasterExtractor {
   virtual ~BimRasterExtractor() = default;
 
   [[nodiscard]] virtual RasterDrawBatchDesc extract(
-      const container::scene::SceneProviderSnapshot& provider) const = 0;
+      const container::scene::SceneProviderView& provider) const = 0;
 };
 
 class RayTracingSceneExtractor {
@@ -67,7 +76,7 @@ class RayTracingSceneExtractor {
   virtual ~RayTracingSceneExtractor() = default;
 
   [[nodiscard]] virtual std::vector<RayTracingGeometryBuildInput> extract(
-      const std::vector<container::scene::SceneProviderSnapshot>& providers)
+      std::span<const container::scene::SceneProviderView> providers)
       const = 0;
 };
 
@@ -76,7 +85,7 @@ class SplattingExtractor {
   virtual ~SplattingExtractor() = default;
 
   [[nodiscard]] virtual std::vector<SplattingDispatchInput> extract(
-      const std::vector<container::scene::SceneProviderSnapshot>& providers)
+      std::span<const container::scene::SceneProviderView> providers)
       const = 0;
 };
 
@@ -85,12 +94,14 @@ class RadianceFieldExtractor {
   virtual ~RadianceFieldExtractor() = default;
 
   [[nodiscard]] virtual std::vector<RadianceFieldDispatchInput> extract(
-      const std::vector<container::scene::SceneProviderSnapshot>& providers)
+      std::span<const container::scene::SceneProviderView> providers)
       const = 0;
 };
 
+// Everything here borrows from the registered providers and is only valid
+// until they are next synchronized, i.e. for the frame being recorded.
 struct ProviderSceneExtraction {
-  std::vector<container::scene::SceneProviderSnapshot> snapshots{};
+  std::vector<container::scene::SceneProviderView> providers{};
   std::vector<RasterDrawBatchDesc> rasterBatches{};
   std::vector<RayTracingGeometryBuildInput> rayTracingBuildInputs{};
   std::vector<SplattingDispatchInput> splattingDispatchInputs{};
@@ -100,14 +111,14 @@ struct ProviderSceneExtraction {
 class ProviderBackedMeshRasterExtractor final : public MeshRasterExtractor {
  public:
   [[nodiscard]] RasterDrawBatchDesc extract(
-      const container::scene::SceneProviderSnapshot& provider) const override {
+      const container::scene::SceneProviderView& provider) const override {
     if (provider.kind != container::scene::SceneProviderKind::Mesh) {
-      return {.providerId = provider.id, .providerKind = provider.kind};
+      return {.providerId = providerId(provider), .providerKind = provider.kind};
     }
     const std::size_t primitiveCount =
         provider.primitiveCount > 0 ? provider.primitiveCount
                                     : provider.elementCount;
-    return {.providerId = provider.id,
+    return {.providerId = providerId(provider),
             .providerKind = provider.kind,
             .opaqueBatchCount = primitiveCount,
             .transparentBatchCount = 0,
@@ -118,14 +129,14 @@ class ProviderBackedMeshRasterExtractor final : public MeshRasterExtractor {
 class ProviderBackedBimRasterExtractor final : public BimRasterExtractor {
  public:
   [[nodiscard]] RasterDrawBatchDesc extract(
-      const container::scene::SceneProviderSnapshot& provider) const override {
+      const container::scene::SceneProviderView& provider) const override {
     if (provider.kind != container::scene::SceneProviderKind::Bim) {
-      return {.providerId = provider.id, .providerKind = provider.kind};
+      return {.providerId = providerId(provider), .providerKind = provider.kind};
     }
     const std::size_t opaqueBatchCount =
         provider.opaqueBatchCount > 0 ? provider.opaqueBatchCount
                                       : provider.primitiveCount;
-    return {.providerId = provider.id,
+    return {.providerId = providerId(provider),
             .providerKind = provider.kind,
             .opaqueBatchCount = opaqueBatchCount,
             .transparentBatchCount = provider.transparentBatchCount,
@@ -137,10 +148,10 @@ class ProviderBackedRayTracingSceneExtractor final
     : public RayTracingSceneExtractor {
  public:
   [[nodiscard]] std::vector<RayTracingGeometryBuildInput> extract(
-      const std::vector<container::scene::SceneProviderSnapshot>& providers)
+      std::span<const container::scene::SceneProviderView> providers)
       const override {
     std::vector<RayTracingGeometryBuildInput> inputs;
-    for (const container::scene::SceneProviderSnapshot& provider : providers) {
+    for (const container::scene::SceneProviderView& provider : providers) {
       if (provider.kind != container::scene::SceneProviderKind::Mesh &&
           provider.kind != container::scene::SceneProviderKind::Bim) {
         continue;
@@ -155,7 +166,7 @@ class ProviderBackedRayTracingSceneExtractor final
           !provider.triangleBatches.empty() ? provider.triangleBatches.size()
                                             : primitiveCount;
       inputs.push_back({
-          .providerId = provider.id,
+          .providerId = providerId(provider),
           .triangleGeometryCount = triangleGeometryCount,
           .instanceCount = instanceCount,
           .geometryRevision = provider.revision.geometry,
@@ -173,17 +184,17 @@ class ProviderBackedRayTracingSceneExtractor final
 class ProviderBackedSplattingExtractor final : public SplattingExtractor {
  public:
   [[nodiscard]] std::vector<SplattingDispatchInput> extract(
-      const std::vector<container::scene::SceneProviderSnapshot>& providers)
+      std::span<const container::scene::SceneProviderView> providers)
       const override {
     std::vector<SplattingDispatchInput> inputs;
-    for (const container::scene::SceneProviderSnapshot& provider : providers) {
+    for (const container::scene::SceneProviderView& provider : providers) {
       if (provider.kind !=
           container::scene::SceneProviderKind::GaussianSplatting) {
         continue;
       }
       const std::size_t splatCount =
           provider.splatCount > 0 ? provider.splatCount : provider.elementCount;
-      inputs.push_back({.providerId = provider.id,
+      inputs.push_back({.providerId = providerId(provider),
                         .splatCount = splatCount,
                         .geometryRevision = provider.revision.geometry,
                         .sphericalHarmonicCoefficientCount =
@@ -198,10 +209,10 @@ class ProviderBackedRadianceFieldExtractor final
     : public RadianceFieldExtractor {
  public:
   [[nodiscard]] std::vector<RadianceFieldDispatchInput> extract(
-      const std::vector<container::scene::SceneProviderSnapshot>& providers)
+      std::span<const container::scene::SceneProviderView> providers)
       const override {
     std::vector<RadianceFieldDispatchInput> inputs;
-    for (const container::scene::SceneProviderSnapshot& provider : providers) {
+    for (const container::scene::SceneProviderView& provider : providers) {
       if (provider.kind != container::scene::SceneProviderKind::RadianceField) {
         continue;
       }
@@ -209,7 +220,7 @@ class ProviderBackedRadianceFieldExtractor final
           provider.fieldCount > 0
               ? provider.fieldCount
               : static_cast<uint32_t>(provider.elementCount);
-      inputs.push_back({.providerId = provider.id,
+      inputs.push_back({.providerId = providerId(provider),
                         .fieldCount = fieldCount,
                         .geometryRevision = provider.revision.geometry,
                         .bounds = provider.bounds,
@@ -222,12 +233,12 @@ class ProviderBackedRadianceFieldExtractor final
 [[nodiscard]] inline ProviderSceneExtraction extractProviderSceneFrameInputs(
     const container::scene::SceneProviderRegistry& registry) {
   ProviderSceneExtraction extraction{};
-  extraction.snapshots = registry.snapshots();
+  extraction.providers = registry.views();
 
   const ProviderBackedMeshRasterExtractor meshRasterExtractor;
   const ProviderBackedBimRasterExtractor bimRasterExtractor;
-  for (const container::scene::SceneProviderSnapshot& provider :
-       extraction.snapshots) {
+  for (const container::scene::SceneProviderView& provider :
+       extraction.providers) {
     if (provider.kind == container::scene::SceneProviderKind::Mesh) {
       extraction.rasterBatches.push_back(meshRasterExtractor.extract(provider));
     } else if (provider.kind == container::scene::SceneProviderKind::Bim) {
@@ -239,11 +250,11 @@ class ProviderBackedRadianceFieldExtractor final
   const ProviderBackedSplattingExtractor splattingExtractor;
   const ProviderBackedRadianceFieldExtractor radianceFieldExtractor;
   extraction.rayTracingBuildInputs =
-      rayTracingExtractor.extract(extraction.snapshots);
+      rayTracingExtractor.extract(extraction.providers);
   extraction.splattingDispatchInputs =
-      splattingExtractor.extract(extraction.snapshots);
+      splattingExtractor.extract(extraction.providers);
   extraction.radianceFieldDispatchInputs =
-      radianceFieldExtractor.extract(extraction.snapshots);
+      radianceFieldExtractor.extract(extraction.providers);
   return extraction;
 }
 
@@ -10,6 +10,9 @@
 
 #include <glm/vec3.hpp>
 
+#include "Container/renderer/bim/BimMeasurementSnapping.h"
+#include "Container/renderer/bim/BimModelCompare.h"
+#include "Container/renderer/bim/BimScheduleExtractor.h"
 #include "Container/renderer/core/PushConstantBlock.h"
 #include "Container/renderer/core/RendererDeviceCapabilities.h"
 #include "Container/renderer/debug/DebugRenderState.h"
@@ -37,6 +40,7 @@ class CommandBufferManager;
 class EnvironmentManager;
 class ExposureManager;
 class DeferredRasterFrameGraphContext;
+class FrameArena;
 class FrameResourceRegistry;
 class FrameRecorder;
 struct FrameRecordParams;
@@ -120,6 +124,9 @@ public:
   // Capture the next submitted swapchain image to an sRGB PNG.
   void requestScreenshot(std::filesystem::path outputPath);
 
+  // Write the frames still in the telemetry history as a Chrome trace.
+  void exportTelemetryTrace(const std::filesystem::path &outputPath) const;
+
   // Scene operations forwarded from the application.
   bool reloadSceneModel(const std::string &path, float importScale = 1.0f);
 
@@ -221,6 +228,26 @@ private:
     uint32_t bimObject{std::numeric_limits<uint32_t>::max()};
   };
   SelectionNavigationAnchor selectionNavigationAnchor_{};
+  // Where the cursor last touched a BIM object; only tracked while
+  // measurement snapping looks at element geometry.
+  struct BimSnapCursorHit {
+    bool valid{false};
+    uint32_t objectIndex{std::numeric_limits<uint32_t>::max()};
+    glm::vec3 point{0.0f};
+  };
+  BimSnapCursorHit bimSnapCursorHit_{};
+  std::vector<BimSnapCandidate> bimSnapCandidates_{};
+  // Schedules and compare rows derived from BIM metadata, rebuilt when the
+  // BIM object data revision moves rather than every frame.
+  struct BimScheduleCache {
+    bool valid{false};
+    uint64_t revision{0};
+    std::vector<BimScheduleRow> byClassAndStorey{};
+    std::vector<BimScheduleRow> byTypeAndStorey{};
+    std::vector<BimScheduleRow> byMaterial{};
+    std::vector<BimModelCompareElement> compareElements{};
+  };
+  BimScheduleCache bimScheduleCache_{};
   struct HoverPickCache {
     bool valid{false};
     double cursorX{0.0};
@@ -280,6 +307,8 @@ private:
   // Per-frame synchronisation / bookkeeping.
   struct FrameState {
     std::vector<VkFence> imagesInFlight;
+    // One transient allocator per frame in flight, reset after its fence.
+    std::vector<std::unique_ptr<FrameArena>> arenas;
     uint32_t currentFrame{0};
     uint64_t submittedFrameCount{0};
   };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Container/renderer/core/RenderGraph.h"
 #include "Container/utility/SceneData.h"
 
 #include <array>
@@ -12,10 +13,15 @@
 
 namespace container::renderer {
 
-class RenderGraph;
-enum class RenderPassId : uint8_t;
 struct CullStats;
 
+// Index into RendererTelemetry's interned string table. Frame records carry
+// ids instead of strings so recording a frame never allocates; resolve them
+// with RendererTelemetry::text or RendererTelemetryView::text.
+using RendererTelemetryStringId = uint16_t;
+inline constexpr RendererTelemetryStringId kRendererTelemetryNoString = 0;
+inline constexpr size_t kRendererTelemetryMaxStrings = 64;
+
 enum class RendererTelemetryPhase : uint8_t {
   Frame,
   WaitForFrame,
@@ -53,6 +59,9 @@ struct RendererCullingTelemetry {
   uint32_t inputCount{0};
   uint32_t frustumPassedCount{0};
   uint32_t occlusionPassedCount{0};
+  // CPU-side cull work: descriptor writes and cull input bytes uploaded.
+  uint32_t descriptorWrites{0};
+  uint64_t uploadedBytes{0};
 };
 
 struct RendererWorkloadTelemetry {
@@ -76,7 +85,7 @@ struct RendererSyncTelemetry {
   uint32_t frameSlot{0};
   uint32_t maxFramesInFlight{0};
   bool serializedConcurrency{false};
-  std::string concurrencyReason{};
+  RendererTelemetryStringId concurrencyReason{kRendererTelemetryNoString};
   uint64_t swapchainRecreateCount{0};
   uint64_t deviceWaitIdleCount{0};
 };
@@ -94,19 +103,24 @@ struct RendererGpuProfilerTelemetry {
   RendererGpuTimingSource source{RendererGpuTimingSource::None};
   bool available{false};
   uint32_t resultLatencyFrames{0};
-  std::string status{};
+  RendererTelemetryStringId status{kRendererTelemetryNoString};
 };
 
+// Names, statuses and blockers are enum ids; see renderPassName,
+// rendererPassTelemetryStatus and rendererPassTelemetryBlocker.
 struct RendererPassTelemetry {
-  std::string name{};
+  RenderPassId id{RenderPassId::Invalid};
   bool enabled{false};
   bool active{false};
   bool cpuTimed{false};
   bool gpuTimed{false};
+  // False when the graph reported no execution status for the pass.
+  bool statusKnown{false};
   float cpuRecordMs{0.0f};
   float gpuKnownMs{0.0f};
-  std::string status{};
-  std::string blocker{};
+  RenderPassSkipReason skipReason{RenderPassSkipReason::None};
+  RenderPassId blockingPass{RenderPassId::Invalid};
+  RenderResourceId blockingResource{RenderResourceId::Invalid};
 };
 
 struct RendererPassGpuTiming {
@@ -126,7 +140,13 @@ struct RendererTelemetrySnapshot {
   RendererSyncTelemetry sync{};
   RendererGraphTelemetry graph{};
   RendererGpuProfilerTelemetry gpuProfiler{};
-  std::vector<RendererPassTelemetry> passes{};
+  // Graph passes in graph order; only the first passCount entries are set.
+  std::array<RendererPassTelemetry, kRenderPassIdCount> passes{};
+  uint32_t passCount{0};
+
+  [[nodiscard]] std::span<const RendererPassTelemetry> passList() const {
+    return {passes.data(), passCount};
+  }
 };
 
 struct RendererTelemetryHistorySample {
@@ -150,8 +170,17 @@ struct RendererTelemetryView {
   RendererTelemetrySnapshot latest{};
   std::vector<RendererTelemetryHistorySample> history{};
   RendererTelemetrySummary summary{};
+  std::vector<std::string> strings{};
+
+  [[nodiscard]] std::string_view text(RendererTelemetryStringId id) const {
+    return id < strings.size() ? std::string_view(strings[id])
+                               : std::string_view{};
+  }
 };
 
+// Frames are recorded into a fixed ring of historyCapacity snapshots. Once
+// every string a frame refers to has been interned, beginFrame..endFrame
+// performs no heap allocation.
 class RendererTelemetry {
  public:
   explicit RendererTelemetry(size_t historyCapacity = 240);
@@ -170,7 +199,9 @@ class RendererTelemetry {
   void recordPassCpuTime(RenderPassId id, float milliseconds);
   void setPassGpuTimings(std::span<const RendererPassGpuTiming> timings,
                          RendererGpuTimingSource source);
-  void setGpuProfilerStatus(RendererGpuProfilerTelemetry status);
+  // `profiler.status` is ignored; `status` is interned in its place.
+  void setGpuProfilerStatus(RendererGpuProfilerTelemetry profiler,
+                            std::string_view status);
   void setWorkload(RendererWorkloadTelemetry workload);
   void setResources(RendererResourceTelemetry resources);
   void setRenderGraph(const RenderGraph& graph);
@@ -179,24 +210,36 @@ class RendererTelemetry {
   void endFrame();
 
   [[nodiscard]] RendererTelemetryView view() const;
-  [[nodiscard]] const RendererTelemetrySnapshot& latest() const {
-    return latest_;
-  }
+  [[nodiscard]] const RendererTelemetrySnapshot& latest() const;
+
+  // Recorded frames with firstFrame <= frameIndex <= lastFrame that are still
+  // in the ring, oldest first.
+  [[nodiscard]] std::vector<RendererTelemetrySnapshot> capturedFrames(
+      uint64_t firstFrame, uint64_t lastFrame) const;
+
+  // Returns the id of `value`, adding it on first use. Once the table is full
+  // unknown strings map to kRendererTelemetryNoString.
+  RendererTelemetryStringId intern(std::string_view value);
+  [[nodiscard]] std::string_view text(RendererTelemetryStringId id) const;
 
  private:
   [[nodiscard]] RendererTelemetrySummary buildSummary() const;
+  // Ring index of the i-th oldest recorded frame.
+  [[nodiscard]] size_t frameSlot(size_t i) const;
 
   size_t historyCapacity_{240};
   uint64_t swapchainRecreateCount_{0};
   uint64_t deviceWaitIdleCount_{0};
   bool activeRecording_{false};
   RendererTelemetrySnapshot active_{};
-  RendererTelemetrySnapshot latest_{};
-  std::vector<RendererTelemetryHistorySample> history_;
-  std::vector<float> activePassCpuMs_;
-  std::vector<float> activePassGpuMs_;
-  std::vector<uint8_t> activePassCpuRecorded_;
-  std::vector<uint8_t> activePassGpuRecorded_;
+  std::vector<RendererTelemetrySnapshot> frames_;
+  size_t frameHead_{0};
+  size_t frameCount_{0};
+  std::vector<std::string> strings_;
+  std::array<float, kRenderPassIdCount> activePassCpuMs_{};
+  std::array<float, kRenderPassIdCount> activePassGpuMs_{};
+  std::array<uint8_t, kRenderPassIdCount> activePassCpuRecorded_{};
+  std::array<uint8_t, kRenderPassIdCount> activePassGpuRecorded_{};
   bool activePassGpuTimingAvailable_{false};
 };
 
@@ -204,5 +247,11 @@ class RendererTelemetry {
     RendererTelemetryPhase phase);
 [[nodiscard]] std::string_view rendererGpuTimingSourceName(
     RendererGpuTimingSource source);
+// "Active", the skip reason, or "Unknown"/"Disabled" without a status.
+[[nodiscard]] std::string_view rendererPassTelemetryStatus(
+    const RendererPassTelemetry& pass);
+// Name of the pass or resource that blocked the pass, if any.
+[[nodiscard]] std::string_view rendererPassTelemetryBlocker(
+    const RendererPassTelemetry& pass);
 
 }  // namespace container::renderer
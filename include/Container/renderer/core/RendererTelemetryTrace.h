@@ -0,0 +1,19 @@
+#pragma once
+
+#include "Container/renderer/core/RendererTelemetry.h"
+
+#include <span>
+#include <string>
+
+namespace container::renderer {
+
+// Chrome trace event JSON (chrome://tracing, ui.perfetto.dev) for recorded
+// frames, e.g. from RendererTelemetry::capturedFrames. Telemetry keeps
+// durations rather than timestamps, so frames are laid end to end, CPU
+// phases back to back in RendererTelemetryPhase order, pass record times
+// inside the command record phase, and pass GPU times on their own track
+// from the start of the frame that reported them.
+[[nodiscard]] std::string
+exportRendererChromeTrace(std::span<const RendererTelemetrySnapshot> frames);
+
+}  // namespace container::renderer
@@ -2,13 +2,16 @@
 
 #include "Container/common/CommonVulkan.h"
 #include "Container/common/CommonMath.h"
+#include "Container/renderer/culling/InstanceCullPacking.h"
 #include "Container/renderer/debug/DebugOverlayRenderer.h"
 #include "Container/utility/SceneData.h"
 #include "Container/utility/VulkanMemoryManager.h"
 
+#include <array>
 #include <cstdint>
 #include <filesystem>
 #include <memory>
+#include <span>
 #include <vector>
 
 namespace container::gpu {
@@ -20,14 +23,26 @@ class VulkanDevice;
 namespace container::renderer {
 
 // Culling statistics — available one frame after dispatch (no GPU stall).
+// Counts are instances: an instanced run contributes one per object.
 struct CullStats {
   uint32_t totalInputCount{0};        // Objects submitted for culling.
   uint32_t frustumPassedCount{0};     // Objects that passed frustum culling.
   uint32_t occlusionPassedCount{0};   // Objects that passed occlusion culling.
+  // CPU-side work of the last recorded frame.
+  uint32_t descriptorWrites{0};       // VkWriteDescriptorSets issued.
+  uint64_t uploadedBytes{0};          // Cull input bytes written.
 };
 
 // Manages GPU-driven indirect draw buffers, frustum culling compute
 // pipeline, Hi-Z mip chain, and occlusion culling compute pipeline.
+//
+// By default every instance of a DrawCommand is uploaded as its own
+// single-instance indirect command and frustum_cull / occlusion_cull copy
+// the survivors. With ENABLE_GPU_INSTANCE_CULLING each DrawCommand is a run
+// of consecutive objects instead: the *_instances cull shaders compact the
+// surviving instances into per-run lists, cull_emit_draws writes one
+// command per run, and vertex shaders read the lists through scene set
+// binding 7 (see ResolveCulledObjectIndex in object_index_common.slang).
 class GpuCullManager {
  public:
   GpuCullManager(
@@ -42,22 +57,34 @@ class GpuCullManager {
   // Create compute pipelines and descriptor resources.
   void createResources(const std::filesystem::path& shaderDir);
 
-  // Ensure indirect draw buffers are large enough for the given object count.
-  // Returns true if buffers were recreated (descriptor sets need re-write).
-  bool ensureBufferCapacity(uint32_t maxObjectCount);
+  // Ensure the cull buffers hold `runCount` draw runs and `instanceCount`
+  // instances (equal on the per-object path). Grows geometrically and
+  // never shrinks. Returns true if buffers were recreated (descriptor sets
+  // are re-written); recreation waits for the device to go idle first.
+  bool ensureBufferCapacity(uint32_t runCount, uint32_t instanceCount);
 
-  // Upload CPU-side draw commands to the input SSBO and prepare for culling.
-  void uploadDrawCommands(const std::vector<DrawCommand>& commands);
+  // Expand the draw commands into per-instance cull input and upload it,
+  // growing the buffers so no instance is dropped. A non-zero `revision`
+  // equal to the last upload's (for the same list) skips the upload;
+  // otherwise only the range that differs from the buffers is written.
+  void uploadDrawCommands(const std::vector<DrawCommand>& commands,
+                          uint64_t revision = 0);
+
+  // Point binding 7 of a scene descriptor set at the culled instance lists.
+  // Call before the set is bound for the frame's indirect draws. No-op on
+  // the per-object path.
+  void updateSceneInstanceDescriptor(VkDescriptorSet sceneDescriptorSet);
 
   // Reset per-frame validity bits before recording the render graph.
   void beginFrameCulling();
 
-  // Dispatch frustum culling compute shader.  After this call, the indirect
-  // draw buffer and draw count buffer are ready for vkCmdDrawIndexedIndirect.
+  // Dispatch frustum culling over the uploaded instances (and, per
+  // instance, emit one command per surviving run).  After this call, the
+  // indirect draw buffer and draw count buffer are ready for
+  // vkCmdDrawIndexedIndirectCount.
   void dispatchFrustumCull(VkCommandBuffer cmd,
                            VkBuffer cameraBuffer,
-                           VkDeviceSize cameraBufferSize,
-                           uint32_t objectCount);
+                           VkDeviceSize cameraBufferSize);
 
   // Dispatch Hi-Z mip chain generation from depth image.
   void dispatchHiZGenerate(VkCommandBuffer cmd,
@@ -65,11 +92,11 @@ class GpuCullManager {
                            VkSampler depthSampler,
                            uint32_t width, uint32_t height);
 
-  // Dispatch occlusion culling against Hi-Z pyramid.
+  // Dispatch occlusion culling of the frustum survivors against the Hi-Z
+  // pyramid, writing the occlusion-culled commands.
   void dispatchOcclusionCull(VkCommandBuffer cmd,
                              VkBuffer cameraBuffer,
-                             VkDeviceSize cameraBufferSize,
-                             uint32_t objectCount);
+                             VkDeviceSize cameraBufferSize);
 
   // Issue a single vkCmdDrawIndexedIndirectCount or equivalent.
   // Uses frustum-culled results (depth prepass + shadow passes).
@@ -82,12 +109,18 @@ class GpuCullManager {
   // Call once per swapchain resize.
   void ensureHiZImage(uint32_t width, uint32_t height);
 
+  // Forget the depth views the Hi-Z descriptors point at. Call when the
+  // depth buffers are recreated, as new views may reuse old handles.
+  void invalidateHiZDepthSources();
+
   // Access the indirect draw count (for secondary passes like shadow that
   // don't do occlusion culling, we use the frustum-culled count).
   VkBuffer indirectDrawBuffer() const { return indirectDrawBuffer_.buffer; }
   VkBuffer drawCountBuffer() const { return drawCountBuffer_.buffer; }
-  uint32_t maxDrawCount() const { return maxObjectCount_; }
+  uint32_t maxDrawCount() const { return maxRunCount_; }
 
+  // True when built with ENABLE_GPU_INSTANCE_CULLING.
+  [[nodiscard]] static bool instanceCullingEnabled();
   [[nodiscard]] bool isReady() const;
   [[nodiscard]] bool canRecordOcclusionCull() const;
   [[nodiscard]] bool frustumDrawsValid() const { return frustumDrawsValid_; }
@@ -130,27 +163,69 @@ class GpuCullManager {
 
  private:
   void createFrustumCullPipeline(const std::filesystem::path& shaderDir);
+  void createEmitDrawsPipeline(const std::filesystem::path& shaderDir);
   void createHiZPipeline(const std::filesystem::path& shaderDir);
   void createOcclusionCullPipeline(const std::filesystem::path& shaderDir);
   void createHiZDescriptorSets();
   void writeDescriptorSets();
   void destroyHiZImage();
+  // Depth buffers are per frame resource, so the Hi-Z source alternates
+  // between a few views. Each gets its own mip-0 set, written the first
+  // time the view is seen.
+  static constexpr uint32_t kHiZDepthSourceSlots = 4;
+  struct HiZDepthSource {
+    VkImageView     depthView{VK_NULL_HANDLE};
+    VkSampler       depthSampler{VK_NULL_HANDLE};
+    VkDescriptorSet levelSet{VK_NULL_HANDLE};   // hiz_generate, mip 0.
+    uint64_t        lastUsed{0};
+  };
+  const HiZDepthSource& acquireHiZDepthSource(VkImageView depthView,
+                                              VkSampler depthSampler);
+
+  void recordEmitDraws(VkCommandBuffer cmd, VkDescriptorSet emitSet,
+                       uint32_t instanceListOffset);
+  // Write the Hi-Z descriptors that only change with the pyramid.
+  void writeHiZDescriptorSets();
+  void writeOcclusionHiZDescriptors();
+  void updateDescriptorSets(std::span<const VkWriteDescriptorSet> writes);
 
   std::shared_ptr<container::gpu::VulkanDevice> device_;
   container::gpu::AllocationManager&            allocationManager_;
   container::gpu::PipelineManager&            pipelineManager_;
 
-  uint32_t maxObjectCount_{0};
-  std::vector<container::gpu::GpuDrawIndexedIndirectCommand> uploadScratch_{};
-
-  // Input: draw commands + object bounding spheres (read by cull shaders).
-  container::gpu::AllocatedBuffer inputDrawBuffer_{};   // DrawCommand[]
+  uint32_t maxRunCount_{0};
+  uint32_t maxInstanceCount_{0};
+  InstanceCullInput cullInput_{};          // Contents of the input buffers.
+  InstanceCullInput previousCullInput_{};  // Diff base, reused across frames.
+  // Per-object path: one single-instance command per object, plus the diff
+  // base.
+  std::vector<container::gpu::GpuDrawIndexedIndirectCommand> objectDraws_;
+  std::vector<container::gpu::GpuDrawIndexedIndirectCommand>
+      previousObjectDraws_;
+  const std::vector<DrawCommand>* uploadedDrawCommands_{nullptr};
+  uint64_t uploadedDrawRevision_{0};
+  bool     cullInputUploaded_{false};      // False after buffer recreation.
+
+  // Input: draw runs, per-instance entries + object bounding spheres.
+  container::gpu::AllocatedBuffer cullRunBuffer_{};       // GpuCullRun[]
+  container::gpu::AllocatedBuffer cullInstanceBuffer_{};  // GpuCullInstance[]
+  // Per-object input: GpuDrawIndexedIndirectCommand[], CPU-writable.
+  container::gpu::AllocatedBuffer inputDrawBuffer_{};
   VkBuffer                        objectSsboBuffer_{VK_NULL_HANDLE};
   VkDeviceSize                    objectSsboSize_{0};
 
-  // Output: VkDrawIndexedIndirectCommand[] written by cull shader.
+  // Compacted object indices: frustum lists in [0, maxInstanceCount_),
+  // occlusion lists in [maxInstanceCount_, 2 * maxInstanceCount_).
+  container::gpu::AllocatedBuffer culledInstanceBuffer_{};
+  // Surviving instances per run, one uint32 per run and pass.
+  container::gpu::AllocatedBuffer frustumRunCountBuffer_{};
+  container::gpu::AllocatedBuffer occlusionRunCountBuffer_{};
+
+  // Output: VkDrawIndexedIndirectCommand[] written by frustum_cull or
+  // cull_emit_draws.
   container::gpu::AllocatedBuffer indirectDrawBuffer_{};
-  // Output: draw count (single uint32).
+  // Output: draw count, then surviving instance count (2 × uint32). The
+  // per-object shaders only write the draw count.
   container::gpu::AllocatedBuffer drawCountBuffer_{};
 
   // Second output: occlusion-culled indirect commands for G-Buffer pass.
@@ -164,6 +239,14 @@ class GpuCullManager {
   VkDescriptorPool     frustumCullPool_{VK_NULL_HANDLE};
   VkDescriptorSet      frustumCullSet_{VK_NULL_HANDLE};
 
+  // Run compaction → indirect commands; one set per cull pass.
+  VkPipeline           emitDrawsPipeline_{VK_NULL_HANDLE};
+  VkPipelineLayout     emitDrawsPipelineLayout_{VK_NULL_HANDLE};
+  VkDescriptorSetLayout emitDrawsSetLayout_{VK_NULL_HANDLE};
+  VkDescriptorPool     emitDrawsPool_{VK_NULL_HANDLE};
+  VkDescriptorSet      frustumEmitSet_{VK_NULL_HANDLE};
+  VkDescriptorSet      occlusionEmitSet_{VK_NULL_HANDLE};
+
   // Hi-Z generation.
   VkPipeline           hizPipeline_{VK_NULL_HANDLE};
   VkPipelineLayout     hizPipelineLayout_{VK_NULL_HANDLE};
@@ -179,6 +262,8 @@ class GpuCullManager {
   uint32_t             hizHeight_{0};
   uint32_t             hizMipLevels_{0};
   bool                 hizInitialized_{false};
+  std::array<HiZDepthSource, kHiZDepthSourceSlots> hizDepthSources_{};
+  uint64_t             hizDepthSourceClock_{0};
 
   // Occlusion cull compute pipeline.
   VkPipeline           occlusionCullPipeline_{VK_NULL_HANDLE};
@@ -190,6 +275,8 @@ class GpuCullManager {
   // Stats readback (1-frame latency).
   container::gpu::AllocatedBuffer statsReadbackBuffer_{};  // 2 × uint32_t, HOST_VISIBLE
   CullStats lastStats_{};
+  uint32_t  frameDescriptorWrites_{0};   // Published by collectStats.
+  uint64_t  frameUploadedBytes_{0};
 
   // Freeze-culling: snapshot of camera data used for cull dispatches.
   container::gpu::AllocatedBuffer frozenCameraBuffer_{};   // CameraData, GPU-only
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Container/renderer/scene/DrawCommand.h"
+#include "Container/utility/SceneData.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace container::renderer {
+
+// Set on firstInstance of GPU-culled draws: the low bits are an offset into
+// the culled instance list instead of an object index. Mirrors
+// kCulledInstanceListBit in shaders/draw_indirect_common.slang.
+inline constexpr uint32_t kCulledInstanceListBit = 0x80000000u;
+
+// Smallest capacity the cull buffers are created with.
+inline constexpr uint32_t kMinCullBufferCapacity = 64u;
+
+// Per-frame GPU cull input. A DrawCommand covers objects
+// [objectIndex, objectIndex + instanceCount); each becomes one run, and its
+// instances are stored contiguously so the run's compacted list occupies
+// [instanceOffset, instanceOffset + instanceCount) of the output.
+struct InstanceCullInput {
+  std::vector<container::gpu::GpuCullRun> runs;
+  std::vector<container::gpu::GpuCullInstance> instances;
+
+  [[nodiscard]] uint32_t runCount() const {
+    return static_cast<uint32_t>(runs.size());
+  }
+  [[nodiscard]] uint32_t instanceCount() const {
+    return static_cast<uint32_t>(instances.size());
+  }
+};
+
+// Rebuilds `input` from `commands`, reusing its storage. Commands without
+// indices or instances are dropped, as are instances whose object index
+// would collide with kCulledInstanceListBit.
+void packInstanceCullInput(std::span<const DrawCommand> commands,
+                           InstanceCullInput &input);
+
+// Rebuilds `draws` for the per-object cull shaders (frustum_cull.slang and
+// occlusion_cull.slang): every instance of every command becomes its own
+// single-instance indirect command with the object index in firstInstance.
+void packObjectCullDraws(
+    std::span<const DrawCommand> commands,
+    std::vector<container::gpu::GpuDrawIndexedIndirectCommand> &draws);
+
+// Capacity to grow a cull buffer to so it holds `required` entries. Grows
+// geometrically so a slowly growing scene does not reallocate every frame.
+[[nodiscard]] uint32_t growCullBufferCapacity(uint32_t capacity,
+                                              uint32_t required);
+
+// Element range of a cull buffer that must be re-uploaded.
+struct CullUploadRange {
+  size_t first{0};
+  size_t count{0};
+
+  [[nodiscard]] bool empty() const { return count == 0u; }
+};
+
+// Smallest contiguous range of `next` that differs from what was last
+// uploaded. Entries past the end of a shrunk list are left stale on the GPU;
+// the dispatch size keeps them from being read.
+[[nodiscard]] CullUploadRange
+changedCullRunRange(std::span<const container::gpu::GpuCullRun> uploaded,
+                    std::span<const container::gpu::GpuCullRun> next);
+[[nodiscard]] CullUploadRange changedCullInstanceRange(
+    std::span<const container::gpu::GpuCullInstance> uploaded,
+    std::span<const container::gpu::GpuCullInstance> next);
+[[nodiscard]] CullUploadRange changedCullDrawRange(
+    std::span<const container::gpu::GpuDrawIndexedIndirectCommand> uploaded,
+    std::span<const container::gpu::GpuDrawIndexedIndirectCommand> next);
+
+// CPU model of the cull shaders' compaction: instances with a non-zero
+// `visible` entry are appended to their run's list in input order.
+struct CompactedInstanceCull {
+  std::vector<uint32_t> runVisibleCounts;
+  // Same length as the input instances; slots past a run's visible count
+  // are left zero.
+  std::vector<uint32_t> instanceIds;
+};
+
+[[nodiscard]] CompactedInstanceCull
+compactVisibleInstances(const InstanceCullInput &input,
+                        std::span<const uint8_t> visible);
+
+// CPU model of cull_emit_draws: one indirect command per run with at least
+// one survivor, instanceCount set to the compacted count and firstInstance
+// pointing at the run's list at `instanceListOffset`.
+[[nodiscard]] std::vector<container::gpu::GpuDrawIndexedIndirectCommand>
+buildCompactedDrawCommands(const InstanceCullInput &input,
+                           std::span<const uint32_t> runVisibleCounts,
+                           uint32_t instanceListOffset);
+
+// Object index a vertex shader sees for `instanceId` of a draw, following
+// ResolveCulledObjectIndex in shaders/object_index_common.slang.
+[[nodiscard]] uint32_t
+resolveCulledObjectIndex(uint32_t firstInstance, uint32_t instanceId,
+                         std::span<const uint32_t> culledInstanceIds);
+
+} // namespace container::renderer
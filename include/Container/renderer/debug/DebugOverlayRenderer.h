@@ -6,6 +6,7 @@
 #include "Container/utility/GuiManager.h"
 #include "Container/utility/SceneData.h"
 
+#include <span>
 #include <vector>
 
 namespace container::renderer {
@@ -17,14 +18,16 @@ class DebugOverlayRenderer {
   DebugOverlayRenderer() = default;
 
   // --- Geometry draw helpers ---
+  // Spans so callers can draw arena-backed or single-command ranges without
+  // copying them into a std::vector first.
   void drawScene(VkCommandBuffer cmd,
                  VkPipelineLayout layout,
-                 const std::vector<DrawCommand>& commands,
+                 std::span<const DrawCommand> commands,
                  container::gpu::BindlessPushConstants& pc) const;
 
   void drawWireframe(VkCommandBuffer cmd,
                      VkPipelineLayout layout,
-                     const std::vector<DrawCommand>& commands,
+                     std::span<const DrawCommand> commands,
                      const glm::vec3& color,
                      float intensity,
                      float lineWidth,
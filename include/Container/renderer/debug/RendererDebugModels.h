@@ -3,6 +3,7 @@
 #include "Container/renderer/core/TechniqueDebugModel.h"
 #include "Container/scene/SceneProvider.h"
 
+#include <span>
 #include <string>
 #include <vector>
 
@@ -24,13 +25,13 @@ namespace container::renderer {
 }
 
 [[nodiscard]] inline SceneDebugModel buildSceneDebugModel(
-    const std::vector<container::scene::SceneProviderSnapshot>& providers) {
+    std::span<const container::scene::SceneProviderView> providers) {
   SceneDebugModel model{};
   model.providers.reserve(providers.size());
-  for (const container::scene::SceneProviderSnapshot& provider : providers) {
+  for (const container::scene::SceneProviderView& provider : providers) {
     model.providers.push_back(SceneProviderDebugState{
-        .providerId = provider.id.value,
-        .displayName = provider.displayName,
+        .providerId = std::string(provider.id),
+        .displayName = std::string(provider.displayName),
         .kind = sceneProviderKindName(provider.kind),
         .elementCount = provider.elementCount,
     });
@@ -3,6 +3,7 @@
 #include "Container/common/CommonVulkan.h"
 #include "Container/renderer/deferred/DeferredRasterFrustumCullPassPlanner.h"
 
+#include <cstdint>
 #include <vector>
 
 namespace container::renderer {
@@ -14,10 +15,15 @@ struct DeferredRasterFrustumCullPassRecordInputs {
   GpuCullManager *gpuCullManager{nullptr};
   DeferredRasterFrustumCullPassPlan plan{};
   const std::vector<DrawCommand> *drawCommands{nullptr};
+  // Revision of `drawCommands`; an unchanged non-zero revision skips the
+  // cull input upload.
+  uint64_t drawCommandsRevision{0};
   VkBuffer cameraBuffer{VK_NULL_HANDLE};
   VkDeviceSize cameraBufferSize{0};
   VkBuffer objectBuffer{VK_NULL_HANDLE};
   VkDeviceSize objectBufferSize{0};
+  // Receives the compacted instance lists at binding 7.
+  VkDescriptorSet sceneDescriptorSet{VK_NULL_HANDLE};
 };
 
 [[nodiscard]] bool recordDeferredRasterFrustumCullPassCommands(
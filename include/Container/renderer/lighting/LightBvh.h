@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Container/utility/SceneData.h"
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace container::renderer {
+
+// Bounding-volume hierarchy over the influence spheres of the published point
+// lights.  Rebuilt whenever the light set changes; queried every frame to pick
+// the working set handed to the clustered cull.
+class LightBvh {
+public:
+  struct Node {
+    glm::vec3 boundsMin{0.0f};
+    // Leaf: first entry in lightIndices(); interior: index of the left child
+    // (the right child always follows it).
+    uint32_t firstOrChild{0};
+    glm::vec3 boundsMax{0.0f};
+    // Zero for interior nodes.
+    uint32_t lightCount{0};
+
+    [[nodiscard]] bool isLeaf() const { return lightCount != 0u; }
+  };
+
+  static constexpr uint32_t kMaxLeafLights = 4u;
+
+  // Lights with an unbounded range or without renderable intensity are kept
+  // out of the tree; unbounded ones are listed in unboundedLights().
+  void build(std::span<const container::gpu::PointLightData> lights);
+  void clear();
+
+  [[nodiscard]] bool empty() const { return nodes_.empty(); }
+  [[nodiscard]] std::span<const Node> nodes() const { return nodes_; }
+  [[nodiscard]] std::span<const uint32_t> lightIndices() const {
+    return lightIndices_;
+  }
+  [[nodiscard]] std::span<const uint32_t> unboundedLights() const {
+    return unboundedLights_;
+  }
+  [[nodiscard]] uint32_t sourceLightCount() const { return sourceLightCount_; }
+
+  // Appends every bounded light whose sphere is not fully outside any of the
+  // planes.  Planes are (normal, d) with the inside at dot(n, p) + d >= 0.
+  void queryFrustum(std::span<const glm::vec4> planes,
+                    std::vector<uint32_t> &out) const;
+
+private:
+  struct BuildItem {
+    glm::vec3 center{0.0f};
+    float radius{0.0f};
+    uint32_t light{0};
+  };
+
+  void buildNode(uint32_t nodeIndex, std::span<BuildItem> items,
+                 uint32_t firstItem);
+
+  std::vector<Node> nodes_{};
+  std::vector<uint32_t> lightIndices_{};
+  // Influence sphere of each lightIndices_ entry, stored alongside so leaf
+  // tests do not chase the source array.
+  std::vector<glm::vec4> lightSpheres_{};
+  std::vector<uint32_t> unboundedLights_{};
+  std::vector<BuildItem> buildItems_{};
+  mutable std::vector<uint32_t> traversalStack_{};
+  uint32_t sourceLightCount_{0};
+};
+
+// Side planes of a view-projection frustum plus the eye plane (w >= 0).  The
+// depth planes are left out so reverse-Z and infinite projections cull alike.
+[[nodiscard]] std::array<glm::vec4, 5>
+lightCullFrustumPlanes(const glm::mat4 &viewProj);
+
+// Screen-space importance of a light seen through viewProj: its projected
+// size squared times its peak radiance.  Unbounded lights rank above all
+// bounded ones.
+[[nodiscard]] float
+pointLightScreenImportance(const container::gpu::PointLightData &light,
+                           const glm::mat4 &viewProj);
+
+struct LightWorkingSetStats {
+  uint32_t visibleLights{0};
+  uint32_t selectedLights{0};
+  uint32_t droppedVisibleLights{0};
+};
+
+// Selects at most `budget` lights that can affect the view, preferring the
+// most important ones.  `out` receives light indices in ascending order so a
+// stable camera keeps a stable GPU array.  `scratch` is reused between calls.
+LightWorkingSetStats selectLightWorkingSet(
+    const LightBvh &bvh,
+    std::span<const container::gpu::PointLightData> lights,
+    const glm::mat4 &viewProj, uint32_t budget, std::vector<uint32_t> &out,
+    std::vector<float> &scratch);
+
+} // namespace container::renderer
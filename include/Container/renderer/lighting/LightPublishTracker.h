@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Container/utility/SceneData.h"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace container::renderer {
+
+// Everything the published light set is derived from.  Two frames with equal
+// inputs produce identical point/area light arrays, so the second one can skip
+// the rebuild entirely.
+struct LightPublishInputs {
+  glm::mat4 sceneTransform{1.0f};
+  glm::vec3 modelCenter{0.0f};
+  float modelRadius{0.0f};
+  bool modelBoundsValid{false};
+  uint32_t rootNode{0};
+  // SceneManager::authoredLightRevision(); changes whenever the authored
+  // point/area/directional lights are reloaded.
+  uint64_t authoredLightRevision{0};
+  // Bumped by LightingManager for overrides, manual lights and settings.
+  uint64_t editRevision{0};
+  // World::pointLightRevision(); catches ECS light entities being created,
+  // replaced or cleared behind the manager's back.  In-place edits of a
+  // LightComponent are not detected.
+  uint64_t ecsPointLightRevision{0};
+
+  [[nodiscard]] bool operator==(const LightPublishInputs &) const = default;
+};
+
+// Element range of a light SSBO that still has to be written to the GPU.
+struct LightUploadRange {
+  uint32_t first{0};
+  uint32_t count{0};
+
+  [[nodiscard]] bool empty() const { return count == 0u; }
+  [[nodiscard]] uint32_t end() const { return first + count; }
+  void merge(LightUploadRange other);
+};
+
+// Returns the smallest range of `next` that differs from `previous`.  Elements
+// past the end of `previous` are always part of the range; a shrinking array
+// needs no upload because the GPU only reads the published count.
+[[nodiscard]] LightUploadRange
+changedPointLightRange(std::span<const container::gpu::PointLightData> previous,
+                       std::span<const container::gpu::PointLightData> next);
+[[nodiscard]] LightUploadRange
+changedAreaLightRange(std::span<const container::gpu::AreaLightData> previous,
+                      std::span<const container::gpu::AreaLightData> next);
+
+// Tracks the inputs of the last published light set and the SSBO ranges that
+// changed since the last upload.
+class LightPublishTracker {
+public:
+  [[nodiscard]] bool needsPublish(const LightPublishInputs &inputs) const;
+
+  // Records a completed publish and accumulates the SSBO ranges that differ
+  // from the previously published arrays.
+  void
+  markPublished(const LightPublishInputs &inputs,
+                std::span<const container::gpu::PointLightData> pointLights,
+                std::span<const container::gpu::AreaLightData> areaLights);
+
+  // Replaces the published point light array without a new publish, e.g.
+  // when the camera-dependent working set changed.  Only the differing range
+  // is queued for upload.
+  void updatePointLights(
+      std::span<const container::gpu::PointLightData> pointLights);
+
+  // Forces the next needsPublish() to return true.
+  void invalidate() { published_.reset(); }
+  // Marks every published light as pending, e.g. after the SSBO was created.
+  void invalidateUploads();
+
+  [[nodiscard]] LightUploadRange takePointLightUpload();
+  [[nodiscard]] LightUploadRange takeAreaLightUpload();
+
+  [[nodiscard]] uint64_t publishCount() const { return publishCount_; }
+
+private:
+  std::optional<LightPublishInputs> published_{};
+  std::vector<container::gpu::PointLightData> publishedPointLights_{};
+  std::vector<container::gpu::AreaLightData> publishedAreaLights_{};
+  LightUploadRange pendingPointUpload_{};
+  LightUploadRange pendingAreaUpload_{};
+  uint64_t publishCount_{0};
+};
+
+} // namespace container::renderer
@@ -3,6 +3,8 @@
 #include "Container/common/CommonMath.h"
 #include "Container/common/CommonVulkan.h"
 #include "Container/renderer/lighting/EditableLight.h"
+#include "Container/renderer/lighting/LightBvh.h"
+#include "Container/renderer/lighting/LightPublishTracker.h"
 #include "Container/renderer/lighting/LightPushConstants.h"
 #include "Container/utility/SceneData.h"
 #include "Container/utility/SceneGraph.h"
@@ -74,11 +76,16 @@ public:
 
   // ---- Per-frame updates --------------------------------------------------
 
-  // Recomputes CPU lighting state from the current scene anchor.
+  // Recomputes CPU lighting state from the current scene anchor.  The light
+  // set is only rebuilt and republished to the ECS when its inputs (root
+  // transform, authored lights, overrides, manual lights or settings) changed.
   void updateLightingData();
   void updateLightingData(const container::scene::BaseCamera *camera);
+  // Also reselects the clustered light working set from the active camera
+  // when the published set exceeds kMaxClusteredLights.
   void updateLightingDataForActiveCamera();
-  // Uploads the compact lighting UBO and the point-light SSBO once per frame.
+  // Uploads the compact lighting UBO once per frame, and the point/area light
+  // SSBO ranges that changed since the previous upload.
   void uploadLightingData() const;
   void uploadLightingData(uint32_t imageIndex) const;
   void collectStats();
@@ -127,6 +134,15 @@ public:
     return lastStats_;
   }
   uint32_t lightVolumeIndexCount() const { return lightVolumeIndexCount_; }
+  // Number of times the light set was rebuilt and republished.
+  uint64_t lightPublishCount() const {
+    return lightPublishTracker_.publishCount();
+  }
+  // Visible/selected/dropped counts of the last working-set selection.  Zero
+  // while every published light fits the clustered budget.
+  const LightWorkingSetStats &lightWorkingSetStats() const {
+    return lightWorkingSetStats_;
+  }
 
   // Descriptor set / buffer accessors (valid after createDescriptorResources())
   VkDescriptorSetLayout lightDescriptorSetLayout() const {
@@ -169,10 +185,11 @@ public:
   }
   bool lightGizmoIconsReady() const { return lightGizmoIconsReady_; }
 
-  // Returns the point light SSBO contents.  Updated each frame by
-  // updateLightingData().
+  // Returns the point light SSBO contents.  Rebuilt by updateLightingData()
+  // whenever the published light set changes; above kMaxClusteredLights this
+  // is the camera-dependent working set rather than every published light.
   const std::vector<container::gpu::PointLightData> &pointLightsSsbo() const {
-    return pointLightsSsbo_;
+    return lightWorkingSetActive_ ? clusteredPointLights_ : pointLightsSsbo_;
   }
   const std::vector<container::gpu::AreaLightData> &areaLightsSsbo() const {
     return areaLightsSsbo_;
@@ -214,10 +231,15 @@ private:
                              size_t sourcePointCount,
                              EditableLightSource areaSource,
                              size_t sourceAreaCount);
+  [[nodiscard]] LightPublishInputs
+  lightPublishInputs(const SceneLightingAnchor &anchor) const;
   void assignLocalShadowLayerMetadata();
   void publishPointLights();
   void publishAreaLights();
   void rebuildPointLightSsboFromEcs();
+  void rebuildLightBvh();
+  // Returns true when the selected lights differ from the previous selection.
+  bool selectClusteredPointLights();
   void writeLightDescriptorStorageBuffers() const;
   void allocateClusterBuffers(VkExtent2D extent);
   void writeTiledResourceDescriptors() const;
@@ -259,6 +281,18 @@ private:
       importedAreaOverrides_{};
   std::vector<container::gpu::PointLightData> manualPointLights_{};
   std::vector<container::gpu::AreaLightData> manualAreaLights_{};
+  // Bumped by every edit that changes the published light set.
+  uint64_t lightEditRevision_{0};
+  mutable LightPublishTracker lightPublishTracker_{};
+  // Working set used once the published lights exceed kMaxClusteredLights.
+  LightBvh lightBvh_{};
+  bool lightWorkingSetActive_{false};
+  std::optional<glm::mat4> lightWorkingSetViewProj_{};
+  std::vector<uint32_t> lightWorkingSet_{};
+  std::vector<uint32_t> nextLightWorkingSet_{};
+  std::vector<float> lightImportanceScratch_{};
+  std::vector<container::gpu::PointLightData> clusteredPointLights_{};
+  LightWorkingSetStats lightWorkingSetStats_{};
 
   // SSBOs
   container::gpu::AllocatedBuffer lightSsbo_{};
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace container::renderer {
+
+struct LooseOctreeBounds {
+  glm::vec3 min{0.0f};
+  glm::vec3 max{0.0f};
+};
+
+struct LooseOctreeRayHit {
+  uint32_t id{0};
+  // Ray parameter at which the ray enters the item's box; zero when the
+  // origin is already inside it.
+  float distance{0.0f};
+};
+
+struct LooseOctreeStats {
+  size_t itemCount{0};
+  size_t nodeCount{0};
+  uint32_t deepestOccupiedDepth{0};
+  // move() calls that kept the item in its node vs. ones that relinked it.
+  uint64_t inPlaceMoves{0};
+  uint64_t relinkedMoves{0};
+};
+
+// Loose octree over axis-aligned boxes keyed by small caller-chosen ids
+// (object indices).  A cell at depth d has half size h = rootHalf / 2^d and
+// loose bounds of twice that, so a box lives in the deepest cell whose half
+// size covers the box's largest half extent, picked by the box center.
+// Insert and remove are O(depth), and a move that keeps the box in its cell
+// only rewrites the stored bounds.
+//
+// Each node keeps its boxes in blocks of four so queries test four boxes per
+// step (SSE2 where available).  Boxes centred outside the root cell stay in
+// the root, which every query scans, so results remain exact when objects
+// wander outside the bounds the tree was built for; reset() around the new
+// scene bounds restores the pruning.
+//
+// Queries reuse an internal traversal stack and are not safe to run
+// concurrently on the same tree.
+class LooseOctree {
+public:
+  static constexpr uint32_t kDefaultMaxDepth = 10u;
+  static constexpr uint32_t kMaxDepthLimit = 20u;
+
+  LooseOctree() = default;
+  explicit LooseOctree(const LooseOctreeBounds &worldBounds,
+                       uint32_t maxDepth = kDefaultMaxDepth);
+
+  // Drops every item and re-roots the tree around worldBounds.
+  void reset(const LooseOctreeBounds &worldBounds,
+             uint32_t maxDepth = kDefaultMaxDepth);
+  void clear();
+
+  // Ids index a dense table, so keep them close to zero.  insert() throws
+  // std::invalid_argument for an id that is already present; move() throws
+  // std::out_of_range for one that is not.
+  void insert(uint32_t id, const LooseOctreeBounds &bounds);
+  void move(uint32_t id, const LooseOctreeBounds &bounds);
+  // Returns false when the id was not present.
+  bool remove(uint32_t id);
+
+  [[nodiscard]] bool contains(uint32_t id) const {
+    return id < items_.size() && items_[id].node != kInvalid;
+  }
+  [[nodiscard]] LooseOctreeBounds bounds(uint32_t id) const;
+  [[nodiscard]] size_t size() const { return itemCount_; }
+  [[nodiscard]] bool empty() const { return itemCount_ == 0u; }
+  [[nodiscard]] const LooseOctreeBounds &worldBounds() const {
+    return worldBounds_;
+  }
+  [[nodiscard]] LooseOctreeStats stats() const;
+
+  // Queries append matching ids to `out` in no particular order.
+  //
+  // Planes are (normal, d) with the inside at dot(n, p) + d >= 0; a box is
+  // reported unless it lies fully outside one of them.
+  void queryFrustum(std::span<const glm::vec4> planes,
+                    std::vector<uint32_t> &out) const;
+  void querySphere(const glm::vec3 &center, float radius,
+                   std::vector<uint32_t> &out) const;
+  void queryBox(const LooseOctreeBounds &box,
+                std::vector<uint32_t> &out) const;
+  // Boxes with corners on both sides of (or touching) the plane.
+  void queryPlane(const glm::vec4 &plane, std::vector<uint32_t> &out) const;
+  // Boxes the ray enters within [0, maxDistance], in units of direction's
+  // length.
+  void queryRay(const glm::vec3 &origin, const glm::vec3 &direction,
+                float maxDistance, std::vector<LooseOctreeRayHit> &out) const;
+
+private:
+  static constexpr uint32_t kInvalid = std::numeric_limits<uint32_t>::max();
+
+  struct alignas(16) BoxBlock {
+    std::array<float, 4> minX{};
+    std::array<float, 4> minY{};
+    std::array<float, 4> minZ{};
+    std::array<float, 4> maxX{};
+    std::array<float, 4> maxY{};
+    std::array<float, 4> maxZ{};
+  };
+
+  struct Node {
+    glm::vec3 center{0.0f};
+    float halfSize{0.0f};
+    uint32_t parent{kInvalid};
+    uint32_t depth{0};
+    // Items in this node and all of its descendants; empty subtrees are
+    // skipped by queries.
+    uint32_t subtreeItemCount{0};
+    std::array<uint32_t, 8> children{kInvalid, kInvalid, kInvalid, kInvalid,
+                                     kInvalid, kInvalid, kInvalid, kInvalid};
+    // ids[i] owns lane i % 4 of boxes[i / 4].
+    std::vector<uint32_t> ids{};
+    std::vector<BoxBlock> boxes{};
+  };
+
+  struct ItemSlot {
+    uint32_t node{kInvalid};
+    uint32_t slot{0};
+  };
+
+  enum class Overlap : uint8_t { Outside, Partial, Inside };
+
+  [[nodiscard]] uint32_t targetNode(const LooseOctreeBounds &bounds);
+  [[nodiscard]] bool staysInNode(const Node &node,
+                                 const LooseOctreeBounds &bounds) const;
+  void link(uint32_t id, uint32_t nodeIndex, const LooseOctreeBounds &bounds);
+  void unlink(uint32_t id);
+  void adjustSubtreeCounts(uint32_t nodeIndex, int32_t delta);
+
+  // Walks the nodes nodeTest does not reject and hands every block to
+  // visitBlock(node, blockIndex, laneCount, fullyInside).
+  template <typename NodeTest, typename VisitBlock>
+  void traverse(const NodeTest &nodeTest, const VisitBlock &visitBlock) const;
+
+  std::vector<Node> nodes_{};
+  std::vector<ItemSlot> items_{};
+  LooseOctreeBounds worldBounds_{};
+  size_t itemCount_{0};
+  uint32_t maxDepth_{kDefaultMaxDepth};
+  uint64_t inPlaceMoves_{0};
+  uint64_t relinkedMoves_{0};
+  mutable std::vector<uint32_t> traversalStack_{};
+};
+
+} // namespace container::renderer
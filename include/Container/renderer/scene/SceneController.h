@@ -3,6 +3,7 @@
 #include "Container/common/CommonVulkan.h"
 #include "Container/common/CommonMath.h"
 #include "Container/renderer/debug/DebugOverlayRenderer.h"
+#include "Container/renderer/scene/LooseOctree.h"
 #include "Container/utility/SceneData.h"
 #include "Container/utility/VulkanMemoryManager.h"
 
@@ -158,7 +159,8 @@ class SceneController {
       container::gpu::AllocationManager&      allocationManager,
       const container::gpu::AllocatedBuffer&  buffer,
       const void*                              data,
-      size_t                                   size);
+      size_t                                   size,
+      size_t                                   offset = 0);
 
   // Ensure objectBuffer capacity >= requiredObjectCount.  Returns true if the
   // buffer was (re)created and descriptor sets must be refreshed.
@@ -193,6 +195,10 @@ class SceneController {
   }
   const std::vector<container::gpu::ObjectData>&  objectData()              const { return objectData_; }
   uint64_t objectDataRevision() const { return objectDataRevision_; }
+  // World-space bounds of the renderable objects keyed by object index, kept
+  // in step with objectData(). CPU spatial queries should start here instead
+  // of scanning objectData().
+  const LooseOctree& objectSpatialIndex() const { return objectOctree_; }
 
   container::gpu::BufferSlice vertexSlice()         const { return vertexSlice_; }
   container::gpu::BufferSlice indexSlice()          const { return indexSlice_; }
@@ -212,7 +218,19 @@ class SceneController {
     bool valid{false};
   };
 
+  // Per-object triangle range and raster state, so picking can walk objects
+  // in ray order instead of walking the draw lists.
+  struct ObjectPickRange {
+    uint32_t firstIndex{0};
+    uint32_t indexCount{0};
+    bool pickable{false};
+    bool transparent{false};
+    bool doubleSided{false};
+    bool windingFlipped{false};
+  };
+
   void rebuildPrimitiveBoundsCache();
+  void syncObjectSpatialIndex();
   void invalidateObjectDataCache();
   void refreshObjectDataCache(bool showDiagCube);
   [[nodiscard]] SceneNodePickHit pickRenderableNodeHitForDraws(
@@ -246,6 +264,12 @@ class SceneController {
   std::vector<DrawCommand>  transparentDoubleSidedDrawCommands_;
   std::vector<PrimitiveBounds> primitiveBounds_;
   std::vector<uint32_t> objectNodeIndices_;
+  std::vector<ObjectPickRange> objectPickRanges_;
+  LooseOctree objectOctree_;
+  // Pickable objects without a bounding sphere; every pick tests them.
+  std::vector<uint32_t> unboundedPickObjects_;
+  size_t indexedObjectCount_{0};
+  mutable std::vector<LooseOctreeRayHit> pickCandidates_;
 
   uint64_t cachedSceneGraphRevision_{std::numeric_limits<uint64_t>::max()};
   uint64_t objectDataRevision_{0};
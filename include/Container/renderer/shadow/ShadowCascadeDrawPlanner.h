@@ -66,6 +66,10 @@ public:
 
   [[nodiscard]] uint64_t signature() const;
   [[nodiscard]] ShadowCascadeDrawPlan build() const;
+  // Rebuilds into an existing plan. The lists are cleared rather than
+  // replaced, so a plan that is rebuilt every frame (the signature follows
+  // the cascade matrices) stops allocating once its capacity has settled.
+  void build(ShadowCascadeDrawPlan &plan) const;
 
 private:
   ShadowCascadeDrawPlannerInputs inputs_{};
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -20,6 +22,8 @@ enum class SceneProviderKind {
   RadianceField,
 };
 
+inline constexpr std::size_t kSceneProviderKindCount = 4;
+
 struct SceneProviderId {
   std::string value{};
 
@@ -107,13 +111,103 @@ struct SceneProviderSnapshot {
   uint32_t sphericalHarmonicCoefficientCount{0};
   uint32_t fieldCount{0};
   bool hasOccupancyData{false};
+
+  [[nodiscard]] struct SceneProviderView view() const;
+};
+
+// Non-owning counterpart of SceneProviderSnapshot. The strings and batches
+// point into the provider, so a view is only valid until the provider is next
+// updated or destroyed; use toSnapshot() to keep the data longer.
+struct SceneProviderView {
+  SceneProviderKind kind{SceneProviderKind::Mesh};
+  std::string_view id{};
+  std::string_view displayName{};
+  SceneProviderRevision revision{};
+  SceneProviderBounds bounds{};
+  std::size_t elementCount{0};
+  std::size_t primitiveCount{0};
+  std::size_t materialCount{0};
+  std::size_t instanceCount{0};
+  std::size_t opaqueBatchCount{0};
+  std::size_t transparentBatchCount{0};
+  std::span<const SceneProviderTriangleBatch> triangleBatches{};
+  std::size_t nativePointRangeCount{0};
+  std::size_t nativeCurveRangeCount{0};
+  std::size_t nativePointOpaqueRangeCount{0};
+  std::size_t nativePointTransparentRangeCount{0};
+  std::size_t nativeCurveOpaqueRangeCount{0};
+  std::size_t nativeCurveTransparentRangeCount{0};
+  std::size_t splatCount{0};
+  uint32_t sphericalHarmonicCoefficientCount{0};
+  uint32_t fieldCount{0};
+  bool hasOccupancyData{false};
+
+  [[nodiscard]] SceneProviderSnapshot toSnapshot() const {
+    return {
+        .kind = kind,
+        .id = SceneProviderId{std::string(id)},
+        .displayName = std::string(displayName),
+        .revision = revision,
+        .bounds = bounds,
+        .elementCount = elementCount,
+        .primitiveCount = primitiveCount,
+        .materialCount = materialCount,
+        .instanceCount = instanceCount,
+        .opaqueBatchCount = opaqueBatchCount,
+        .transparentBatchCount = transparentBatchCount,
+        .triangleBatches = {triangleBatches.begin(), triangleBatches.end()},
+        .nativePointRangeCount = nativePointRangeCount,
+        .nativeCurveRangeCount = nativeCurveRangeCount,
+        .nativePointOpaqueRangeCount = nativePointOpaqueRangeCount,
+        .nativePointTransparentRangeCount = nativePointTransparentRangeCount,
+        .nativeCurveOpaqueRangeCount = nativeCurveOpaqueRangeCount,
+        .nativeCurveTransparentRangeCount = nativeCurveTransparentRangeCount,
+        .splatCount = splatCount,
+        .sphericalHarmonicCoefficientCount = sphericalHarmonicCoefficientCount,
+        .fieldCount = fieldCount,
+        .hasOccupancyData = hasOccupancyData,
+    };
+  }
 };
 
+inline SceneProviderView SceneProviderSnapshot::view() const {
+  return {
+      .kind = kind,
+      .id = id.value,
+      .displayName = displayName,
+      .revision = revision,
+      .bounds = bounds,
+      .elementCount = elementCount,
+      .primitiveCount = primitiveCount,
+      .materialCount = materialCount,
+      .instanceCount = instanceCount,
+      .opaqueBatchCount = opaqueBatchCount,
+      .transparentBatchCount = transparentBatchCount,
+      .triangleBatches = triangleBatches,
+      .nativePointRangeCount = nativePointRangeCount,
+      .nativeCurveRangeCount = nativeCurveRangeCount,
+      .nativePointOpaqueRangeCount = nativePointOpaqueRangeCount,
+      .nativePointTransparentRangeCount = nativePointTransparentRangeCount,
+      .nativeCurveOpaqueRangeCount = nativeCurveOpaqueRangeCount,
+      .nativeCurveTransparentRangeCount = nativeCurveTransparentRangeCount,
+      .splatCount = splatCount,
+      .sphericalHarmonicCoefficientCount = sphericalHarmonicCoefficientCount,
+      .fieldCount = fieldCount,
+      .hasOccupancyData = hasOccupancyData,
+  };
+}
+
 class IRenderSceneProvider {
  public:
   virtual ~IRenderSceneProvider() = default;
 
-  [[nodiscard]] virtual SceneProviderSnapshot snapshot() const = 0;
+  // Cheap, non-owning view of the provider's current state.
+  [[nodiscard]] virtual SceneProviderView view() const = 0;
+
+  // Owning copy of view(); copies the triangle batches.
+  [[nodiscard]] SceneProviderSnapshot snapshot() const {
+    return view().toSnapshot();
+  }
 };
 
 class MeshSceneProvider final : public IRenderSceneProvider {
@@ -132,10 +226,10 @@ class MeshSceneProvider final : public IRenderSceneProvider {
     }
   }
 
-  [[nodiscard]] SceneProviderSnapshot snapshot() const override {
+  [[nodiscard]] SceneProviderView view() const override {
     return {
         .kind = SceneProviderKind::Mesh,
-        .id = id_,
+        .id = id_.value,
         .displayName = displayName_,
         .revision = revision_,
         .bounds = asset_.bounds,
@@ -174,10 +268,10 @@ class BimSceneProvider final : public IRenderSceneProvider {
     }
   }
 
-  [[nodiscard]] SceneProviderSnapshot snapshot() const override {
+  [[nodiscard]] SceneProviderView view() const override {
     return {
         .kind = SceneProviderKind::Bim,
-        .id = id_,
+        .id = id_.value,
         .displayName = displayName_,
         .revision = revision_,
         .bounds = asset_.bounds,
@@ -224,10 +318,10 @@ class GaussianSplatSceneProvider final : public IRenderSceneProvider {
     }
   }
 
-  [[nodiscard]] SceneProviderSnapshot snapshot() const override {
+  [[nodiscard]] SceneProviderView view() const override {
     return {
         .kind = SceneProviderKind::GaussianSplatting,
-        .id = id_,
+        .id = id_.value,
         .displayName = displayName_,
         .revision = revision_,
         .bounds = asset_.bounds,
@@ -266,10 +360,10 @@ class RadianceFieldSceneProvider final : public IRenderSceneProvider {
     }
   }
 
-  [[nodiscard]] SceneProviderSnapshot snapshot() const override {
+  [[nodiscard]] SceneProviderView view() const override {
     return {
         .kind = SceneProviderKind::RadianceField,
-        .id = id_,
+        .id = id_.value,
         .displayName = displayName_,
         .revision = revision_,
         .bounds = asset_.bounds,
@@ -290,47 +384,54 @@ class RadianceFieldSceneProvider final : public IRenderSceneProvider {
   SceneProviderRevision revision_{};
 };
 
+// Registration reads each provider's id and kind once and indexes them, so
+// lookups never touch the providers. Providers must keep their id and kind
+// fixed while registered.
 class SceneProviderRegistry {
  public:
   void registerProvider(const IRenderSceneProvider& provider) {
-    const SceneProviderSnapshot providerSnapshot = provider.snapshot();
-    if (providerSnapshot.id.value.empty()) {
+    const SceneProviderView providerView = provider.view();
+    if (providerView.id.empty()) {
       throw std::invalid_argument("scene provider id must not be empty");
     }
-    if (find(providerSnapshot.id) != nullptr) {
+    const auto [entry, inserted] =
+        indexById_.try_emplace(std::string(providerView.id), providers_.size());
+    if (!inserted) {
       throw std::invalid_argument("scene provider is already registered");
     }
     providers_.push_back(&provider);
+    providersByKind_[static_cast<std::size_t>(providerView.kind)].push_back(
+        &provider);
   }
 
   [[nodiscard]] const IRenderSceneProvider* find(
       const SceneProviderId& id) const {
-    for (const IRenderSceneProvider* provider : providers_) {
-      if (provider != nullptr && provider->snapshot().id == id) {
-        return provider;
-      }
-    }
-    return nullptr;
+    const auto entry = indexById_.find(id.value);
+    return entry != indexById_.end() ? providers_[entry->second] : nullptr;
   }
 
-  [[nodiscard]] std::vector<const IRenderSceneProvider*> providersForKind(
+  [[nodiscard]] std::span<const IRenderSceneProvider* const> providersForKind(
       SceneProviderKind kind) const {
-    std::vector<const IRenderSceneProvider*> matches;
+    const auto& matches = providersByKind_[static_cast<std::size_t>(kind)];
+    return {matches.data(), matches.size()};
+  }
+
+  // Views stay valid until the providers are next updated; nothing is copied
+  // out of them.
+  [[nodiscard]] std::vector<SceneProviderView> views() const {
+    std::vector<SceneProviderView> result;
+    result.reserve(providers_.size());
     for (const IRenderSceneProvider* provider : providers_) {
-      if (provider != nullptr && provider->snapshot().kind == kind) {
-        matches.push_back(provider);
-      }
+      result.push_back(provider->view());
     }
-    return matches;
+    return result;
   }
 
   [[nodiscard]] std::vector<SceneProviderSnapshot> snapshots() const {
     std::vector<SceneProviderSnapshot> result;
     result.reserve(providers_.size());
     for (const IRenderSceneProvider* provider : providers_) {
-      if (provider != nullptr) {
-        result.push_back(provider->snapshot());
-      }
+      result.push_back(provider->snapshot());
     }
     return result;
   }
@@ -339,10 +440,19 @@ class SceneProviderRegistry {
     return {providers_.data(), providers_.size()};
   }
 
-  void clear() { providers_.clear(); }
+  void clear() {
+    providers_.clear();
+    indexById_.clear();
+    for (auto& matches : providersByKind_) {
+      matches.clear();
+    }
+  }
 
  private:
   std::vector<const IRenderSceneProvider*> providers_{};
+  std::unordered_map<std::string, std::size_t> indexById_{};
+  std::array<std::vector<const IRenderSceneProvider*>, kSceneProviderKindCount>
+      providersByKind_{};
 };
 
 }  // namespace container::scene
@@ -28,6 +28,12 @@ enum class TextureAllocationResetScope : uint32_t {
   All = 1,
 };
 
+// Bytes to copy into an existing buffer at `offset`.
+struct BufferRangeWrite {
+  VkDeviceSize offset{0};
+  std::span<const std::byte> bytes{};
+};
+
 struct TextureAllocation {
   VkImage image{VK_NULL_HANDLE};
   VkImageView imageView{VK_NULL_HANDLE};
@@ -50,6 +56,11 @@ class AllocationManager {
   BufferSlice uploadIndices(std::span<const uint32_t> indices);
   AllocatedBuffer uploadBuffer(std::span<const std::byte> bytes,
                                VkBufferUsageFlags usage);
+  // Copies every write into `buffer`, which needs TRANSFER_DST usage (as
+  // uploadBuffer() gives it), through one staging buffer and one submit.
+  // The copy waits for earlier vertex and index reads of `buffer`.
+  void updateBufferRanges(const AllocatedBuffer& buffer,
+                          std::span<const BufferRangeWrite> writes);
 
   [[nodiscard]] AllocatedBuffer createBuffer(
       VkDeviceSize size, VkBufferUsageFlags usage, VmaMemoryUsage memoryUsage,
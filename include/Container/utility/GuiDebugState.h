@@ -46,6 +46,8 @@ struct GuiRendererCullingTelemetry {
   uint32_t inputCount{0};
   uint32_t frustumPassedCount{0};
   uint32_t occlusionPassedCount{0};
+  uint32_t descriptorWrites{0};
+  uint64_t uploadedBytes{0};
 };
 
 struct GuiRendererLightCullingTelemetry {
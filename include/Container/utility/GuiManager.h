@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -18,6 +19,7 @@
 #include "Container/renderer/bim/BimScheduleExtractor.h"
 #include "Container/renderer/lighting/EditableLight.h"
 #include "Container/utility/GuiDebugState.h"
+#include "Container/utility/GuiTableRowModel.h"
 #include "Container/utility/SceneData.h"
 
 struct GLFWwindow;
@@ -32,6 +34,7 @@ enum class BimSemanticColorMode : uint32_t;
 enum class BimSnapKind : uint32_t;
 enum class ScenePrimitiveKind : uint32_t;
 struct BimElementProperty;
+struct BimSnapCandidate;
 class BimRelationshipGraph;
 struct BimStoreyRange;
 struct CullStats;
@@ -246,6 +249,11 @@ struct BimMeasurementCapturedPoint {
   container::renderer::BimSnapKind snapKind{};
 };
 
+// Vertex, edge and face snapping use the element's geometric snap features
+// when the renderer supplies them.
+[[nodiscard]] bool
+BimMeasurementSnapModeUsesGeometry(BimMeasurementSnapMode mode);
+
 struct BimInspectionState;
 
 [[nodiscard]] std::optional<BimMeasurementCapturedPoint>
@@ -314,6 +322,9 @@ struct BimInspectionState {
   bool hasScene{false};
   std::string modelPath{};
   size_t objectCount{0};
+  // Changes whenever the BIM metadata behind the spans below is reloaded;
+  // keys the cached row order of the BIM tables.
+  uint64_t dataRevision{0};
   size_t meshObjectCount{0};
   size_t pointObjectCount{0};
   size_t curveObjectCount{0};
@@ -431,6 +442,10 @@ struct BimInspectionState {
   glm::vec3 selectionBoundsSize{0.0f};
   float selectionBoundsRadius{0.0f};
   float selectionFloorElevation{0.0f};
+  // Geometric snap features of the selected element around the cursor (or
+  // the point it was picked at), with screen distances filled in.
+  std::span<const container::renderer::BimSnapCandidate>
+      geometricSnapCandidates{};
 };
 
 struct ViewpointSnapshotState {
@@ -461,6 +476,29 @@ struct SceneHierarchyParentCandidateCacheState {
   std::vector<SceneHierarchyParentCandidateRow> rows{};
 };
 
+// Expanded nodes of the scene hierarchy and the flattened rows they produce,
+// so the tree can be drawn as one clipped list.
+struct SceneHierarchyRowCacheState {
+  uint64_t revision{std::numeric_limits<uint64_t>::max()};
+  size_t nodeCount{0};
+  uint64_t expansionRevision{0};
+  uint64_t rowsExpansionRevision{std::numeric_limits<uint64_t>::max()};
+  std::vector<uint8_t> expanded{};
+  std::vector<GuiTreeRow> rows{};
+};
+
+struct BimPropertySetSummaryRow {
+  std::string set{};
+  std::string category{};
+  size_t propertyCount{0};
+};
+
+struct BimPropertySetSummaryCacheState {
+  GuiTableRowKey key{};
+  bool valid{false};
+  std::vector<BimPropertySetSummaryRow> rows{};
+};
+
 class GuiManager {
 public:
   GuiManager() = default;
@@ -626,6 +664,10 @@ public:
   bimClipCapHatchingUiState() const {
     return bimClipCapHatchingUiState_;
   }
+  [[nodiscard]] const BimMeasurementSnapUiState &
+  bimMeasurementSnapState() const {
+    return bimMeasurementSnapState_;
+  }
   [[nodiscard]] bool wireframeSupported() const { return wireframeSupported_; }
   [[nodiscard]] const std::string &statusMessage() const {
     return statusMessage_;
@@ -825,6 +867,13 @@ private:
   std::vector<container::renderer::BimModelCompareChange>
       bimCompareChanges_{};
   SceneHierarchyParentCandidateCacheState sceneHierarchyParentCandidateCache_{};
+  SceneHierarchyRowCacheState sceneHierarchyRowCache_{};
+  std::array<GuiTableRowIndex, 3> bimScheduleRowIndices_{};
+  GuiTableRowIndex bimQuickFilterMatchRows_{};
+  GuiTableRowIndex bimPropertyRows_{};
+  GuiTableRowIndex bimSelectedRelationshipEdgeRows_{};
+  GuiTableRowIndex bimSpatialEdgeRows_{};
+  BimPropertySetSummaryCacheState bimPropertySetSummaryCache_{};
   BimLodStreamingUiState bimLodStreamingUiState_{};
   BimClipCapHatchingUiState bimClipCapHatchingUiState_{};
   std::string bimMeasurementModelPath_{};
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace container::ui {
+
+// ASCII case-insensitive substring filter. The needle is folded once, so
+// testing a row does not allocate.
+class GuiRowTextFilter {
+public:
+  GuiRowTextFilter() = default;
+  explicit GuiRowTextFilter(std::string_view needle);
+
+  [[nodiscard]] bool empty() const { return needle_.empty(); }
+  [[nodiscard]] bool matches(std::string_view haystack) const;
+
+private:
+  std::string needle_{};
+};
+
+// ASCII case-insensitive three-way comparison; byte order breaks ties so
+// distinct strings never compare equal.
+[[nodiscard]] int GuiRowCompareText(std::string_view lhs,
+                                    std::string_view rhs);
+
+// Item count to hand to ImGuiListClipper, which counts rows in an int.
+[[nodiscard]] int GuiClipperItemCount(size_t rowCount);
+
+// Everything the visible row order of a table depends on. `scope` tells apart
+// row sets that share a revision, e.g. the properties of different elements.
+struct GuiTableRowKey {
+  uint64_t dataRevision{std::numeric_limits<uint64_t>::max()};
+  uint64_t scope{0};
+  size_t rowCount{0};
+  std::string filter{};
+  int sortColumn{-1};
+  bool sortDescending{false};
+
+  bool operator==(const GuiTableRowKey &) const = default;
+};
+
+// Source-row indices of a table after filtering and sorting. refresh() only
+// rebuilds when the key changes, so drawing an unchanged table costs just the
+// rows the list clipper submits.
+class GuiTableRowIndex {
+public:
+  // `matches(row)` keeps a source row; `less(lhs, rhs)` orders two kept rows
+  // by key.sortColumn and is not called when sortColumn is negative. Equal
+  // rows keep their source order in either direction. Returns true when the
+  // rows were rebuilt.
+  template <typename Matches, typename Less>
+  bool refresh(const GuiTableRowKey &key, Matches &&matches, Less &&less) {
+    if (valid_ && key == key_) {
+      return false;
+    }
+    key_ = key;
+    valid_ = true;
+    ++rebuildCount_;
+    rows_.clear();
+    const size_t rowCount = std::min(
+        key.rowCount,
+        static_cast<size_t>(std::numeric_limits<uint32_t>::max()));
+    for (size_t row = 0u; row < rowCount; ++row) {
+      if (matches(static_cast<uint32_t>(row))) {
+        rows_.push_back(static_cast<uint32_t>(row));
+      }
+    }
+    if (key.sortColumn >= 0) {
+      if (key.sortDescending) {
+        std::ranges::stable_sort(rows_, [&](uint32_t lhs, uint32_t rhs) {
+          return less(rhs, lhs);
+        });
+      } else {
+        std::ranges::stable_sort(rows_, [&](uint32_t lhs, uint32_t rhs) {
+          return less(lhs, rhs);
+        });
+      }
+    }
+    return true;
+  }
+
+  void invalidate() { valid_ = false; }
+
+  [[nodiscard]] std::span<const uint32_t> rows() const { return rows_; }
+  [[nodiscard]] size_t size() const { return rows_.size(); }
+  [[nodiscard]] bool empty() const { return rows_.empty(); }
+  [[nodiscard]] uint64_t rebuildCount() const { return rebuildCount_; }
+
+private:
+  GuiTableRowKey key_{};
+  std::vector<uint32_t> rows_{};
+  uint64_t rebuildCount_{0};
+  bool valid_{false};
+};
+
+struct GuiTreeRow {
+  uint32_t node{0};
+  uint32_t depth{0};
+};
+
+// Depth-first rows of the expanded part of a forest, for drawing a tree as a
+// flat clipped list. `children(node)` returns the node's child indices and
+// `expanded(node)` whether they are shown. Iterative, so deep hierarchies do
+// not recurse.
+template <typename Children, typename Expanded>
+void GuiFlattenTreeRows(std::span<const uint32_t> roots, Children &&children,
+                        Expanded &&expanded, std::vector<GuiTreeRow> &rows) {
+  rows.clear();
+  std::vector<GuiTreeRow> stack;
+  for (auto root = roots.rbegin(); root != roots.rend(); ++root) {
+    stack.push_back(GuiTreeRow{.node = *root, .depth = 0u});
+  }
+  while (!stack.empty()) {
+    const GuiTreeRow row = stack.back();
+    stack.pop_back();
+    rows.push_back(row);
+    if (!expanded(row.node)) {
+      continue;
+    }
+    const auto &nodeChildren = children(row.node);
+    for (auto child = std::rbegin(nodeChildren);
+         child != std::rend(nodeChildren); ++child) {
+      stack.push_back(GuiTreeRow{.node = *child, .depth = row.depth + 1u});
+    }
+  }
+}
+
+} // namespace container::ui
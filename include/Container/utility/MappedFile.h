@@ -0,0 +1,146 @@
+#pragma once
+
+#include "Container/utility/Platform.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace container::util {
+
+// Read-only memory mapping of a whole file. Parsers can tokenize straight
+// from the page cache instead of copying the file into a heap buffer. The
+// mapped bytes are not NUL-terminated. Empty files map to an empty view.
+class MappedFile {
+ public:
+  MappedFile() = default;
+
+  explicit MappedFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+    file_ = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                        OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE) {
+      throw std::runtime_error("failed to open file: " + pathToUtf8(path));
+    }
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(file_, &fileSize)) {
+      close();
+      throw std::runtime_error("failed to stat file: " + pathToUtf8(path));
+    }
+    size_ = static_cast<size_t>(fileSize.QuadPart);
+    if (size_ == 0) {
+      return;
+    }
+    mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    data_ = mapping_ != nullptr
+                ? MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0)
+                : nullptr;
+#else
+    descriptor_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (descriptor_ < 0) {
+      throw std::runtime_error("failed to open file: " + pathToUtf8(path));
+    }
+    struct stat status{};
+    if (::fstat(descriptor_, &status) != 0) {
+      close();
+      throw std::runtime_error("failed to stat file: " + pathToUtf8(path));
+    }
+    size_ = static_cast<size_t>(status.st_size);
+    if (size_ == 0) {
+      return;
+    }
+    void* mapped =
+        ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, descriptor_, 0);
+    data_ = mapped != MAP_FAILED ? mapped : nullptr;
+    if (data_ != nullptr) {
+      (void)::madvise(data_, size_, MADV_SEQUENTIAL);
+    }
+#endif
+    if (data_ == nullptr) {
+      close();
+      throw std::runtime_error("failed to map file: " + pathToUtf8(path));
+    }
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+
+  MappedFile& operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+      close();
+      data_ = std::exchange(other.data_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+#ifdef _WIN32
+      file_ = std::exchange(other.file_, INVALID_HANDLE_VALUE);
+      mapping_ = std::exchange(other.mapping_, nullptr);
+#else
+      descriptor_ = std::exchange(other.descriptor_, -1);
+#endif
+    }
+    return *this;
+  }
+
+  ~MappedFile() { close(); }
+
+  [[nodiscard]] size_t size() const noexcept { return size_; }
+
+  [[nodiscard]] std::span<const uint8_t> bytes() const noexcept {
+    return {static_cast<const uint8_t*>(data_), data_ != nullptr ? size_ : 0};
+  }
+
+  [[nodiscard]] std::string_view text() const noexcept {
+    return {static_cast<const char*>(data_), data_ != nullptr ? size_ : 0};
+  }
+
+ private:
+  void close() noexcept {
+#ifdef _WIN32
+    if (data_ != nullptr) {
+      UnmapViewOfFile(data_);
+    }
+    if (mapping_ != nullptr) {
+      CloseHandle(mapping_);
+    }
+    if (file_ != INVALID_HANDLE_VALUE) {
+      CloseHandle(file_);
+    }
+    mapping_ = nullptr;
+    file_ = INVALID_HANDLE_VALUE;
+#else
+    if (data_ != nullptr) {
+      ::munmap(data_, size_);
+    }
+    if (descriptor_ >= 0) {
+      ::close(descriptor_);
+    }
+    descriptor_ = -1;
+#endif
+    data_ = nullptr;
+    size_ = 0;
+  }
+
+  void* data_{nullptr};
+  size_t size_{0};
+#ifdef _WIN32
+  HANDLE file_{INVALID_HANDLE_VALUE};
+  HANDLE mapping_{nullptr};
+#else
+  int descriptor_{-1};
+#endif
+};
+
+}  // namespace container::util
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace container::util {
+
+// Worker count for splitting `itemCount` items so every worker gets at least
+// `minItemsPerWorker` of them. A request of 0 means the hardware concurrency.
+[[nodiscard]] inline size_t parallelWorkerCount(size_t itemCount,
+                                                size_t requestedWorkers,
+                                                size_t minItemsPerWorker) {
+  size_t workers = requestedWorkers;
+  if (workers == 0u) {
+    workers = std::max(1u, std::thread::hardware_concurrency());
+  }
+  return std::clamp<size_t>(itemCount / std::max<size_t>(minItemsPerWorker, 1u),
+                            1u, workers);
+}
+
+// Splits [0, count) into `workerCount` contiguous ranges and calls
+// fn(begin, end) for each. The first range runs on the calling thread, the
+// others on std::async workers; exceptions propagate from get().
+template <typename Fn>
+void forEachParallelRange(size_t count, size_t workerCount, const Fn& fn) {
+  workerCount = std::min(workerCount, count);
+  if (workerCount <= 1u) {
+    fn(size_t{0}, count);
+    return;
+  }
+
+  std::vector<std::future<void>> workers;
+  workers.reserve(workerCount - 1u);
+  const size_t rangeSize = (count + workerCount - 1u) / workerCount;
+  for (size_t begin = rangeSize; begin < count; begin += rangeSize) {
+    const size_t end = std::min(begin + rangeSize, count);
+    workers.emplace_back(std::async(std::launch::async,
+                                    [&fn, begin, end]() { fn(begin, end); }));
+  }
+  fn(size_t{0}, rangeSize);
+  for (auto& worker : workers) {
+    worker.get();
+  }
+}
+
+// Calls fn(index) for every index in [0, count) on up to `workerCount`
+// threads, including the calling one. Indices are handed out one at a time,
+// so items of very different cost still balance across workers.
+template <typename Fn>
+void forEachParallelIndex(size_t count, size_t workerCount, const Fn& fn) {
+  workerCount = std::min(workerCount, count);
+  if (workerCount <= 1u) {
+    for (size_t index = 0; index < count; ++index) {
+      fn(index);
+    }
+    return;
+  }
+
+  std::atomic<size_t> next{0};
+  const auto drain = [&]() {
+    for (size_t index = next.fetch_add(1u); index < count;
+         index = next.fetch_add(1u)) {
+      fn(index);
+    }
+  };
+  std::vector<std::future<void>> workers;
+  workers.reserve(workerCount - 1u);
+  for (size_t worker = 1u; worker < workerCount; ++worker) {
+    workers.emplace_back(std::async(std::launch::async, drain));
+  }
+  drain();
+  for (auto& worker : workers) {
+    worker.get();
+  }
+}
+
+}  // namespace container::util
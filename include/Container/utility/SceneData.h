@@ -452,7 +452,8 @@ struct GpuDrawIndexedIndirectCommand {
   uint32_t instanceCount{0};
   uint32_t firstIndex{0};
   int32_t vertexOffset{0};
-  uint32_t firstInstance{0}; // Encodes objectIndex.
+  // Encodes objectIndex, or an instance-list offset on GPU-culled draws.
+  uint32_t firstInstance{0};
 };
 static_assert(sizeof(GpuDrawIndexedIndirectCommand) == 20,
               "GpuDrawIndexedIndirectCommand size mismatch with "
@@ -468,6 +469,40 @@ static_assert(offsetof(GpuDrawIndexedIndirectCommand, vertexOffset) == 12,
 static_assert(offsetof(GpuDrawIndexedIndirectCommand, firstInstance) == 16,
               "GpuDrawIndexedIndirectCommand.firstInstance offset");
 
+// GPU culling input: one run per instanced DrawCommand. Surviving instances
+// are compacted into [instanceOffset, instanceOffset + instanceCount) of the
+// culled instance list.
+struct GpuCullRun {
+  uint32_t indexCount{0};
+  uint32_t firstIndex{0};
+  uint32_t instanceOffset{0};
+  uint32_t instanceCount{0};
+};
+static_assert(sizeof(GpuCullRun) == 16,
+              "GpuCullRun size mismatch with "
+              "shaders/draw_indirect_common.slang.");
+static_assert(offsetof(GpuCullRun, indexCount) == 0,
+              "GpuCullRun.indexCount offset");
+static_assert(offsetof(GpuCullRun, firstIndex) == 4,
+              "GpuCullRun.firstIndex offset");
+static_assert(offsetof(GpuCullRun, instanceOffset) == 8,
+              "GpuCullRun.instanceOffset offset");
+static_assert(offsetof(GpuCullRun, instanceCount) == 12,
+              "GpuCullRun.instanceCount offset");
+
+// GPU culling input: one entry per instance, stored run by run.
+struct GpuCullInstance {
+  uint32_t objectIndex{0};
+  uint32_t runIndex{0};
+};
+static_assert(sizeof(GpuCullInstance) == 8,
+              "GpuCullInstance size mismatch with "
+              "shaders/draw_indirect_common.slang.");
+static_assert(offsetof(GpuCullInstance, objectIndex) == 0,
+              "GpuCullInstance.objectIndex offset");
+static_assert(offsetof(GpuCullInstance, runIndex) == 4,
+              "GpuCullInstance.runIndex offset");
+
 static_assert(kMaterialSamplerDescriptorCapacity == 9,
               "Material sampler table currently stores S/T wrap combinations.");
 static_assert(sizeof(GpuTextureMetadata) == 16,
@@ -478,10 +513,21 @@ static_assert(offsetof(GpuTextureMetadata, samplerIndex) == 0,
               "GpuTextureMetadata.samplerIndex offset");
 
 struct CullPushConstants {
+  // Instances tested by the dispatch (one thread each).
   uint32_t objectCount{0};
   uint32_t pad0{0};
   uint32_t pad1{0};
-  uint32_t pad2{0};
+  // Where this pass's compacted instance lists start in the shared buffer.
+  uint32_t instanceListOffset{0};
+};
+
+// cull_emit_draws: one thread per run turns compacted instance counts into
+// indirect commands.
+struct CullEmitPushConstants {
+  uint32_t runCount{0};
+  uint32_t instanceListOffset{0};
+  uint32_t pad0{0};
+  uint32_t pad1{0};
 };
 
 struct HiZPushConstants {
@@ -956,8 +1002,16 @@ static_assert(offsetof(CullPushConstants, pad0) == 4,
               "CullPushConstants.pad0 offset");
 static_assert(offsetof(CullPushConstants, pad1) == 8,
               "CullPushConstants.pad1 offset");
-static_assert(offsetof(CullPushConstants, pad2) == 12,
-              "CullPushConstants.pad2 offset");
+static_assert(offsetof(CullPushConstants, instanceListOffset) == 12,
+              "CullPushConstants.instanceListOffset offset");
+
+static_assert(sizeof(CullEmitPushConstants) == 16,
+              "CullEmitPushConstants size mismatch with "
+              "shaders/push_constants_common.slang CullEmitPushConstants.");
+static_assert(offsetof(CullEmitPushConstants, runCount) == 0,
+              "CullEmitPushConstants.runCount offset");
+static_assert(offsetof(CullEmitPushConstants, instanceListOffset) == 4,
+              "CullEmitPushConstants.instanceListOffset offset");
 
 static_assert(sizeof(HiZPushConstants) == 16,
               "HiZPushConstants size mismatch with "
@@ -134,6 +134,10 @@ class SceneManager {
   const std::vector<container::gpu::AreaLightData>& authoredAreaLights() const {
     return authoredAreaLights_;
   }
+  // Incremented whenever the authored light lists are reset or reloaded.
+  [[nodiscard]] uint64_t authoredLightRevision() const {
+    return authoredLightRevision_;
+  }
   bool isDefaultTestSceneActive() const;
   void populateSceneGraph(SceneGraph& sceneGraph) const;
   [[nodiscard]] uint32_t appendRuntimeMesh(
@@ -239,6 +243,7 @@ class SceneManager {
   std::vector<container::gpu::PointLightData> authoredPointLights_{};
   std::vector<AuthoredDirectionalLight> authoredDirectionalLights_{};
   std::vector<container::gpu::AreaLightData> authoredAreaLights_{};
+  uint64_t authoredLightRevision_{0};
 
   VkIndexType indexType_{VK_INDEX_TYPE_UINT32};
 
@@ -110,6 +110,9 @@ void applyCommandLine(container::app::AppConfig& config, int argc,
     } else if (arg == "--fixed-dt") {
       config.screenshotFixedTimestepSeconds =
           parseFloat(requireValue(argc, argv, i, arg), arg);
+    } else if (arg == "--telemetry-trace") {
+      config.telemetryTracePath =
+          std::string(requireValue(argc, argv, i, arg));
     } else if (arg == "--camera-position") {
       config.cameraPosition = parseVec3(argc, argv, i, arg);
       config.hasCameraOverride = true;
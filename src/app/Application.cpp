@@ -123,6 +123,7 @@ void Application::mainLoop() {
     renderer_->drawFrame(framebufferResized_);
   }
   vkDeviceWaitIdle(vulkanContext_->result().deviceWrapper->device());
+  exportTelemetryTrace();
 
   onMainLoop();
 }
@@ -146,10 +147,17 @@ void Application::screenshotCaptureLoop() {
     renderer_->drawFrame(framebufferResized_);
   }
   vkDeviceWaitIdle(vulkanContext_->result().deviceWrapper->device());
+  exportTelemetryTrace();
 
   onMainLoop();
 }
 
+void Application::exportTelemetryTrace() {
+  if (!config_.telemetryTracePath.empty()) {
+    renderer_->exportTelemetryTrace(config_.telemetryTracePath);
+  }
+}
+
 void Application::cleanup() {
   onCleanup();
 
@@ -59,6 +59,7 @@ void World::forEachRenderableWithNode(
 entt::entity
 World::createPointLight(const container::gpu::PointLightData &data) {
   const auto entity = registry_.create();
+  ++pointLightRevision_;
   registry_.emplace<LightComponent>(entity, LightComponent{data});
   registry_.emplace<LightTag>(entity);
   return entity;
@@ -80,6 +81,7 @@ void World::forEachPointLight(const LightVisitor &visitor) const {
 }
 
 void World::clearPointLights() {
+  ++pointLightRevision_;
   auto view = registry_.view<const LightTag>();
 
   std::vector<entt::entity> entities;
@@ -145,6 +147,7 @@ uint32_t World::entityCount() const {
 }
 
 void World::clear() {
+  ++pointLightRevision_;
   registry_.clear();
   activeCameraEntity_ = entt::null;
 }
@@ -7,14 +7,16 @@
 
 #include <algorithm>
 #include <cmath>
+#include <exception>
 #include <fstream>
 #include <initializer_list>
-#include <iterator>
 #include <limits>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <unordered_set>
+#include <utility>
 
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/quaternion.hpp>
@@ -499,7 +501,7 @@ std::vector<uint32_t> readIndices(const Json &mesh, std::string_view context,
 }
 
 std::pair<glm::vec3, float>
-computeBounds(const std::vector<glm::vec3> &coordinates) {
+computeBounds(std::span<const glm::vec3> coordinates) {
   if (coordinates.empty()) {
     return {{0.0f, 0.0f, 0.0f}, 0.0f};
   }
@@ -539,9 +541,695 @@ ModelUnitMetadata makeUnitMetadata(float importScale) {
   return metadata;
 }
 
+void appendMeshGeometry(Model &model, uint32_t meshId,
+                        std::span<const glm::vec3> coordinates,
+                        std::span<const uint32_t> sourceIndices) {
+  MeshRange range{};
+  range.meshId = meshId;
+  range.firstIndex = static_cast<uint32_t>(model.indices.size());
+  const auto [center, radius] = computeBounds(coordinates);
+  range.boundsCenter = center;
+  range.boundsRadius = radius;
+
+  for (size_t i = 0; i < sourceIndices.size(); i += 3u) {
+    const glm::vec3 &a = coordinates[sourceIndices[i]];
+    const glm::vec3 &b = coordinates[sourceIndices[i + 1u]];
+    const glm::vec3 &c = coordinates[sourceIndices[i + 2u]];
+    const glm::vec3 normal = safeNormal(a, b, c);
+    const glm::vec3 tangent = safeTangent(a, b, normal);
+    const uint32_t base = static_cast<uint32_t>(model.vertices.size());
+    model.vertices.push_back(makeVertex(a, normal, tangent));
+    model.vertices.push_back(makeVertex(b, normal, tangent));
+    model.vertices.push_back(makeVertex(c, normal, tangent));
+    model.indices.insert(model.indices.end(), {base, base + 1u, base + 2u});
+  }
+
+  range.indexCount =
+      static_cast<uint32_t>(model.indices.size()) - range.firstIndex;
+  model.meshRanges.push_back(range);
+}
+
+void insertMeshId(std::unordered_set<uint32_t> &seenMeshIds, uint32_t meshId) {
+  if (!seenMeshIds.insert(meshId).second) {
+    throw std::runtime_error("dotbim duplicate mesh_id " +
+                             std::to_string(meshId));
+  }
+}
+
+std::string meshContext(size_t meshIndex) {
+  return "mesh[" + std::to_string(meshIndex) + "]";
+}
+
+void appendJsonMesh(Model &model, const Json &mesh, size_t meshIndex,
+                    std::unordered_set<uint32_t> &seenMeshIds) {
+  const std::string context = meshContext(meshIndex);
+  const uint32_t meshId = requiredMeshId(mesh, context);
+  insertMeshId(seenMeshIds, meshId);
+  const auto coordinates = readCoordinates(mesh, context);
+  const auto sourceIndices = readIndices(mesh, context, coordinates.size());
+  appendMeshGeometry(model, meshId, coordinates, sourceIndices);
+}
+
+Element readElement(const Json &source, size_t elementIndex,
+                    float importScale) {
+  const std::string context = "element[" + std::to_string(elementIndex) + "]";
+  Element element{};
+  element.meshId = requiredMeshId(source, context);
+  element.transform = makeTransform(source, importScale);
+  element.color = readColor(source);
+  element.guid = stringOrEmpty(source, "guid");
+  element.type = stringOrEmpty(source, "type");
+  element.displayName =
+      firstStringOrEmpty(source, {"displayName", "display_name", "name"});
+  element.objectType =
+      firstStringOrEmpty(source, {"objectType", "object_type"});
+  element.storeyName =
+      firstStringOrEmpty(source, {"storeyName", "storey_name"});
+  element.storeyId =
+      firstStringOrEmpty(source, {"storeyId", "storey_id", "storeyGuid",
+                                  "storey_guid"});
+  element.materialName =
+      firstStringOrEmpty(source, {"materialName", "material_name"});
+  element.materialCategory =
+      firstStringOrEmpty(source, {"materialCategory", "material_category"});
+  element.discipline =
+      firstScalarStringOrEmpty(source, {"discipline", "ifcDiscipline",
+                                        "ifc_discipline"});
+  element.phase = firstScalarStringOrEmpty(
+      source, {"phase", "phaseName", "phase_name", "constructionPhase",
+               "construction_phase"});
+  element.fireRating =
+      firstScalarStringOrEmpty(source, {"fireRating", "fire_rating",
+                                        "FireRating"});
+  element.loadBearing =
+      firstScalarStringOrEmpty(source, {"loadBearing", "load_bearing",
+                                        "LoadBearing", "isLoadBearing",
+                                        "is_load_bearing"});
+  element.status =
+      firstScalarStringOrEmpty(source, {"status", "Status", "elementStatus",
+                                        "element_status"});
+  element.sourceId =
+      firstStringOrEmpty(source, {"sourceId", "source_id"});
+  element.properties = readElementProperties(source);
+  return element;
+}
+
+// Rebuilds one JSON value from SAX events. The streaming reader only uses it
+// for small values (elements, mesh scalars, root metadata).
+class JsonFragmentBuilder {
+public:
+  void value(Json value) {
+    if (stack_.empty()) {
+      root_ = std::move(value);
+      complete_ = true;
+      return;
+    }
+    Json &parent = *stack_.back();
+    if (parent.is_array()) {
+      parent.push_back(std::move(value));
+    } else {
+      parent[key_] = std::move(value);
+    }
+  }
+
+  void beginContainer(Json container) {
+    if (stack_.empty()) {
+      root_ = std::move(container);
+      stack_.push_back(&root_);
+      return;
+    }
+    Json &parent = *stack_.back();
+    if (parent.is_array()) {
+      parent.push_back(std::move(container));
+      stack_.push_back(&parent.back());
+    } else {
+      Json &child = parent[key_];
+      child = std::move(container);
+      stack_.push_back(&child);
+    }
+  }
+
+  void key(std::string &key) { key_ = std::move(key); }
+
+  void endContainer() {
+    stack_.pop_back();
+    complete_ = stack_.empty();
+  }
+
+  [[nodiscard]] bool complete() const { return complete_; }
+
+  [[nodiscard]] Json take() {
+    complete_ = false;
+    return std::move(root_);
+  }
+
+private:
+  Json root_{};
+  std::vector<Json *> stack_{};
+  std::string key_{};
+  bool complete_{false};
+};
+
+// A mesh array decoded straight from SAX events. Non-numeric entries are
+// recorded instead of thrown so validation can follow the DOM loader's order.
+struct CoordinateCapture {
+  bool present{false};
+  size_t count{0};
+  bool nonNumber{false};
+  std::vector<glm::vec3> points{};
+
+  void reset() {
+    present = false;
+    count = 0;
+    nonNumber = false;
+    points.clear();
+  }
+
+  void append(float value) {
+    const size_t component = count % 3u;
+    if (component == 0u) {
+      points.emplace_back(0.0f);
+    }
+    points.back()[static_cast<glm::length_t>(component)] = value;
+    ++count;
+  }
+
+  void appendNonNumber() {
+    nonNumber = true;
+    append(0.0f);
+  }
+};
+
+struct IndexCapture {
+  static constexpr uint32_t kOutOfRange = std::numeric_limits<uint32_t>::max();
+
+  bool present{false};
+  size_t firstNonInteger{std::numeric_limits<size_t>::max()};
+  std::vector<uint32_t> values{};
+
+  void reset() {
+    present = false;
+    firstNonInteger = std::numeric_limits<size_t>::max();
+    values.clear();
+  }
+
+  void append(int64_t value) {
+    values.push_back(value < 0 || value > std::numeric_limits<uint32_t>::max()
+                         ? kOutOfRange
+                         : static_cast<uint32_t>(value));
+  }
+
+  void appendNonInteger() {
+    firstNonInteger = std::min(firstNonInteger, values.size());
+    values.push_back(0u);
+  }
+};
+
+// SAX consumer for .bim documents. Mesh coordinates and indices are decoded
+// into reusable typed buffers and turned into geometry as soon as each mesh
+// closes; every element is materialized on its own and appended to the model.
+// Errors are reported exactly as the DOM loader reports them.
+class DotBimStreamReader {
+public:
+  explicit DotBimStreamReader(float importScale) : importScale_(importScale) {}
+
+  bool null() { return scalar(Json(nullptr)); }
+  bool boolean(bool value) { return scalar(Json(value)); }
+  bool number_integer(Json::number_integer_t value) {
+    if (scope_ == Scope::MeshArray && nestedDepth_ == 0u) {
+      if (activeIndices_ != nullptr) {
+        activeIndices_->append(value);
+      } else {
+        activeCoordinates_->append(static_cast<float>(value));
+      }
+      return true;
+    }
+    return scalar(Json(value));
+  }
+  bool number_unsigned(Json::number_unsigned_t value) {
+    if (scope_ == Scope::MeshArray && nestedDepth_ == 0u) {
+      if (activeIndices_ != nullptr) {
+        activeIndices_->append(static_cast<int64_t>(value));
+      } else {
+        activeCoordinates_->append(static_cast<float>(value));
+      }
+      return true;
+    }
+    return scalar(Json(value));
+  }
+  bool number_float(Json::number_float_t value, const Json::string_t &) {
+    if (scope_ == Scope::MeshArray && nestedDepth_ == 0u) {
+      if (activeIndices_ != nullptr) {
+        activeIndices_->appendNonInteger();
+      } else {
+        activeCoordinates_->append(static_cast<float>(value));
+      }
+      return true;
+    }
+    return scalar(Json(value));
+  }
+  bool string(Json::string_t &value) { return scalar(Json(std::move(value))); }
+  bool binary(Json::binary_t &value) {
+    return scalar(Json::binary(std::move(value)));
+  }
+
+  bool start_object(std::size_t) { return beginContainer(Json::object()); }
+  bool start_array(std::size_t) { return beginContainer(Json::array()); }
+
+  bool key(Json::string_t &key) {
+    switch (scope_) {
+    case Scope::Root:
+      rootKey_ = std::move(key);
+      break;
+    case Scope::Mesh:
+      meshKey_ = std::move(key);
+      break;
+    case Scope::Fragment:
+      fragment_.key(key);
+      break;
+    default:
+      break;
+    }
+    return true;
+  }
+
+  bool end_object() { return endContainer(); }
+  bool end_array() { return endContainer(); }
+
+  template <typename Exception>
+  bool parse_error(std::size_t, const std::string &, const Exception &error) {
+    throw error;
+  }
+
+  Model finish() {
+    const Json notAnObject{};
+    const Json &root = rootIsObject_ ? rootMembers_ : notAnObject;
+    if (!meshesAreArray_) {
+      (void)requiredArray(root, "meshes", "file");
+    }
+    if (!elementsAreArray_) {
+      (void)requiredArray(root, "elements", "file");
+    }
+    if (meshError_) {
+      std::rethrow_exception(meshError_);
+    }
+    if (elementError_) {
+      std::rethrow_exception(elementError_);
+    }
+    model_.unitMetadata = makeUnitMetadata(importScale_);
+    model_.georeferenceMetadata = readGeoreferenceMetadata(root);
+    model_.relationships = readElementRelationships(root);
+    return std::move(model_);
+  }
+
+private:
+  enum class Scope : uint8_t {
+    Document,
+    Root,
+    Meshes,
+    Mesh,
+    MeshArray,
+    Elements,
+    Fragment,
+    Skip,
+    Done,
+  };
+  enum class FragmentTarget : uint8_t { RootMember, Mesh, MeshMember, Element };
+
+  bool scalar(Json value) {
+    switch (scope_) {
+    case Scope::Document:
+      scope_ = Scope::Done;
+      break;
+    case Scope::Root:
+      setRootMember(std::move(value));
+      break;
+    case Scope::Meshes:
+      appendMesh(value);
+      break;
+    case Scope::Mesh:
+      setMeshMember(std::move(value));
+      break;
+    case Scope::MeshArray:
+      if (nestedDepth_ == 0u) {
+        appendNonNumber();
+      }
+      break;
+    case Scope::Elements:
+      appendElement(value);
+      break;
+    case Scope::Fragment:
+      fragment_.value(std::move(value));
+      if (fragment_.complete()) {
+        finishFragment();
+      }
+      break;
+    case Scope::Skip:
+    case Scope::Done:
+      break;
+    }
+    return true;
+  }
+
+  bool beginContainer(Json container) {
+    const bool isArray = container.is_array();
+    switch (scope_) {
+    case Scope::Document:
+      rootIsObject_ = !isArray;
+      scope_ = isArray ? Scope::Skip : Scope::Root;
+      nestedDepth_ = isArray ? 1u : 0u;
+      break;
+    case Scope::Root:
+      if (isArray && rootKey_ == "meshes") {
+        resetMeshes(true);
+        scope_ = Scope::Meshes;
+      } else if (isArray && rootKey_ == "elements") {
+        resetElements(true);
+        scope_ = Scope::Elements;
+      } else {
+        beginFragment(FragmentTarget::RootMember, std::move(container));
+      }
+      break;
+    case Scope::Meshes:
+      if (isArray) {
+        beginFragment(FragmentTarget::Mesh, std::move(container));
+      } else {
+        beginMesh();
+      }
+      break;
+    case Scope::Mesh:
+      if (isArray && beginMeshArray()) {
+        scope_ = Scope::MeshArray;
+        nestedDepth_ = 0u;
+      } else {
+        beginFragment(FragmentTarget::MeshMember, std::move(container));
+      }
+      break;
+    case Scope::MeshArray:
+      if (nestedDepth_++ == 0u) {
+        appendNonNumber();
+      }
+      break;
+    case Scope::Elements:
+      beginFragment(FragmentTarget::Element, std::move(container));
+      break;
+    case Scope::Fragment:
+      fragment_.beginContainer(std::move(container));
+      break;
+    case Scope::Skip:
+      ++nestedDepth_;
+      break;
+    case Scope::Done:
+      break;
+    }
+    return true;
+  }
+
+  bool endContainer() {
+    switch (scope_) {
+    case Scope::Root:
+      scope_ = Scope::Done;
+      break;
+    case Scope::Meshes:
+    case Scope::Elements:
+      scope_ = Scope::Root;
+      break;
+    case Scope::Mesh:
+      finishMesh();
+      scope_ = Scope::Meshes;
+      break;
+    case Scope::MeshArray:
+      if (nestedDepth_ > 0u) {
+        --nestedDepth_;
+      } else {
+        activeCoordinates_ = nullptr;
+        activeIndices_ = nullptr;
+        scope_ = Scope::Mesh;
+      }
+      break;
+    case Scope::Fragment:
+      fragment_.endContainer();
+      if (fragment_.complete()) {
+        finishFragment();
+      }
+      break;
+    case Scope::Skip:
+      if (--nestedDepth_ == 0u) {
+        scope_ = Scope::Done;
+      }
+      break;
+    case Scope::Document:
+    case Scope::Done:
+      break;
+    }
+    return true;
+  }
+
+  void beginFragment(FragmentTarget target, Json container) {
+    fragmentTarget_ = target;
+    fragmentParent_ = scope_;
+    scope_ = Scope::Fragment;
+    fragment_.beginContainer(std::move(container));
+  }
+
+  void finishFragment() {
+    scope_ = fragmentParent_;
+    Json value = fragment_.take();
+    switch (fragmentTarget_) {
+    case FragmentTarget::RootMember:
+      setRootMember(std::move(value));
+      break;
+    case FragmentTarget::Mesh:
+      appendMesh(value);
+      break;
+    case FragmentTarget::MeshMember:
+      setMeshMember(std::move(value));
+      break;
+    case FragmentTarget::Element:
+      appendElement(value);
+      break;
+    }
+  }
+
+  // Later duplicates of a root key replace earlier ones, as in the DOM.
+  void setRootMember(Json value) {
+    if (rootKey_ == "meshes") {
+      resetMeshes(false);
+    } else if (rootKey_ == "elements") {
+      resetElements(false);
+    }
+    rootMembers_[rootKey_] = std::move(value);
+  }
+
+  void resetMeshes(bool isArray) {
+    meshesAreArray_ = isArray;
+    rootMembers_.erase("meshes");
+    model_.vertices.clear();
+    model_.indices.clear();
+    model_.meshRanges.clear();
+    seenMeshIds_.clear();
+    meshIndex_ = 0;
+    meshError_ = nullptr;
+  }
+
+  void resetElements(bool isArray) {
+    elementsAreArray_ = isArray;
+    rootMembers_.erase("elements");
+    model_.elements.clear();
+    elementIndex_ = 0;
+    elementError_ = nullptr;
+  }
+
+  void appendMesh(const Json &mesh) {
+    if (!meshError_) {
+      try {
+        appendJsonMesh(model_, mesh, meshIndex_, seenMeshIds_);
+      } catch (...) {
+        meshError_ = std::current_exception();
+      }
+    }
+    ++meshIndex_;
+  }
+
+  void appendElement(const Json &source) {
+    if (!elementError_) {
+      try {
+        model_.elements.push_back(
+            readElement(source, elementIndex_, importScale_));
+      } catch (...) {
+        elementError_ = std::current_exception();
+      }
+    }
+    ++elementIndex_;
+  }
+
+  void beginMesh() {
+    scope_ = Scope::Mesh;
+    meshMembers_ = Json::object();
+    coordinates_.reset();
+    verticesCoordinates_.reset();
+    indices_.reset();
+  }
+
+  bool beginMeshArray() {
+    activeCoordinates_ = nullptr;
+    activeIndices_ = nullptr;
+    if (meshKey_ == "coordinates") {
+      activeCoordinates_ = &coordinates_;
+    } else if (meshKey_ == "vertices_coordinates") {
+      activeCoordinates_ = &verticesCoordinates_;
+    } else if (meshKey_ == "indices") {
+      activeIndices_ = &indices_;
+    } else {
+      return false;
+    }
+    meshMembers_.erase(meshKey_);
+    if (activeCoordinates_ != nullptr) {
+      activeCoordinates_->reset();
+      activeCoordinates_->present = true;
+    } else {
+      activeIndices_->reset();
+      activeIndices_->present = true;
+    }
+    return true;
+  }
+
+  void appendNonNumber() {
+    if (activeIndices_ != nullptr) {
+      activeIndices_->appendNonInteger();
+    } else {
+      activeCoordinates_->appendNonNumber();
+    }
+  }
+
+  void setMeshMember(Json value) {
+    if (meshKey_ == "coordinates") {
+      coordinates_.reset();
+    } else if (meshKey_ == "vertices_coordinates") {
+      verticesCoordinates_.reset();
+    } else if (meshKey_ == "indices") {
+      indices_.reset();
+    }
+    meshMembers_[meshKey_] = std::move(value);
+  }
+
+  // Mirrors appendJsonMesh/readCoordinates/readIndices check for check.
+  void finishMesh() {
+    const size_t meshIndex = meshIndex_++;
+    if (meshError_) {
+      return;
+    }
+    try {
+      const std::string context = meshContext(meshIndex);
+      const uint32_t meshId = requiredMeshId(meshMembers_, context);
+      insertMeshId(seenMeshIds_, meshId);
+
+      const bool useCoordinates =
+          coordinates_.present || meshMembers_.contains("coordinates");
+      const CoordinateCapture &coordinates =
+          useCoordinates ? coordinates_ : verticesCoordinates_;
+      if (!coordinates.present) {
+        (void)requiredArray(meshMembers_,
+                            useCoordinates ? "coordinates"
+                                           : "vertices_coordinates",
+                            context);
+      }
+      if ((coordinates.count % 3u) != 0u) {
+        throw std::runtime_error(std::string("dotbim ") + context +
+                                 " coordinates count must be divisible by 3");
+      }
+      if (coordinates.nonNumber) {
+        throw std::runtime_error(std::string("dotbim ") + context +
+                                 " coordinates must contain numbers");
+      }
+
+      if (!indices_.present) {
+        (void)requiredArray(meshMembers_, "indices", context);
+      }
+      if ((indices_.values.size() % 3u) != 0u) {
+        throw std::runtime_error(std::string("dotbim ") + context +
+                                 " indices count must be divisible by 3");
+      }
+      const size_t vertexCount = coordinates.points.size();
+      const auto outOfRange = std::ranges::find_if(
+          indices_.values,
+          [vertexCount](uint32_t index) { return index >= vertexCount; });
+      const size_t firstOutOfRange =
+          static_cast<size_t>(outOfRange - indices_.values.begin());
+      if (indices_.firstNonInteger <= firstOutOfRange &&
+          indices_.firstNonInteger < indices_.values.size()) {
+        throw std::runtime_error(std::string("dotbim ") + context +
+                                 " indices must contain integers");
+      }
+      if (outOfRange != indices_.values.end()) {
+        throw std::runtime_error(std::string("dotbim ") + context +
+                                 " contains an out-of-range index");
+      }
+      appendMeshGeometry(model_, meshId, coordinates.points, indices_.values);
+    } catch (...) {
+      meshError_ = std::current_exception();
+    }
+  }
+
+  float importScale_{1.0f};
+  Model model_{};
+  Scope scope_{Scope::Document};
+  bool rootIsObject_{false};
+  std::string rootKey_{};
+  Json rootMembers_ = Json::object();
+  bool meshesAreArray_{false};
+  bool elementsAreArray_{false};
+
+  JsonFragmentBuilder fragment_{};
+  FragmentTarget fragmentTarget_{FragmentTarget::RootMember};
+  Scope fragmentParent_{Scope::Root};
+  size_t nestedDepth_{0};
+
+  std::string meshKey_{};
+  Json meshMembers_ = Json::object();
+  CoordinateCapture coordinates_{};
+  CoordinateCapture verticesCoordinates_{};
+  IndexCapture indices_{};
+  CoordinateCapture *activeCoordinates_{nullptr};
+  IndexCapture *activeIndices_{nullptr};
+  std::unordered_set<uint32_t> seenMeshIds_{};
+  size_t meshIndex_{0};
+  std::exception_ptr meshError_{};
+  size_t elementIndex_{0};
+  std::exception_ptr elementError_{};
+};
+
+template <typename Input> Model streamModel(Input &&input, float importScale) {
+  DotBimStreamReader reader(importScale);
+  Json::sax_parse(std::forward<Input>(input), &reader);
+  return reader.finish();
+}
+
 } // namespace
 
 Model LoadFromJson(std::string_view jsonText, float importScale) {
+  return streamModel(jsonText, importScale);
+}
+
+Model LoadFromFile(const std::filesystem::path &path, float importScale) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    throw std::runtime_error("failed to open dotbim file: " +
+                             container::util::pathToUtf8(path));
+  }
+  return streamModel(file, importScale);
+}
+
+Model LoadFromFile(const std::filesystem::path &path, float importScale,
+                   const MeshOptimizationOptions &meshOptimization) {
+  Model model = LoadFromFile(path, importScale);
+  optimizeModelGeometry(model, meshOptimization);
+  return model;
+}
+
+namespace detail {
+
+Model LoadFromJsonDom(std::string_view jsonText, float importScale) {
   const Json root = Json::parse(jsonText.begin(), jsonText.end());
   const Json &meshes = requiredArray(root, "meshes", "file");
   const Json &elements = requiredArray(root, "elements", "file");
@@ -552,102 +1240,20 @@ Model LoadFromJson(std::string_view jsonText, float importScale) {
   model.relationships = readElementRelationships(root);
   model.meshRanges.reserve(meshes.size());
   std::unordered_set<uint32_t> seenMeshIds;
-
   for (size_t meshIndex = 0; meshIndex < meshes.size(); ++meshIndex) {
-    const Json &mesh = meshes[meshIndex];
-    const std::string context = "mesh[" + std::to_string(meshIndex) + "]";
-    const uint32_t meshId = requiredMeshId(mesh, context);
-    if (!seenMeshIds.insert(meshId).second) {
-      throw std::runtime_error("dotbim duplicate mesh_id " +
-                               std::to_string(meshId));
-    }
-
-    const auto coordinates = readCoordinates(mesh, context);
-    const auto sourceIndices = readIndices(mesh, context, coordinates.size());
-
-    MeshRange range{};
-    range.meshId = meshId;
-    range.firstIndex = static_cast<uint32_t>(model.indices.size());
-    const auto [center, radius] = computeBounds(coordinates);
-    range.boundsCenter = center;
-    range.boundsRadius = radius;
-
-    for (size_t i = 0; i < sourceIndices.size(); i += 3u) {
-      const glm::vec3 &a = coordinates[sourceIndices[i]];
-      const glm::vec3 &b = coordinates[sourceIndices[i + 1u]];
-      const glm::vec3 &c = coordinates[sourceIndices[i + 2u]];
-      const glm::vec3 normal = safeNormal(a, b, c);
-      const glm::vec3 tangent = safeTangent(a, b, normal);
-      const uint32_t base = static_cast<uint32_t>(model.vertices.size());
-      model.vertices.push_back(makeVertex(a, normal, tangent));
-      model.vertices.push_back(makeVertex(b, normal, tangent));
-      model.vertices.push_back(makeVertex(c, normal, tangent));
-      model.indices.insert(model.indices.end(), {base, base + 1u, base + 2u});
-    }
-
-    range.indexCount =
-        static_cast<uint32_t>(model.indices.size()) - range.firstIndex;
-    model.meshRanges.push_back(range);
+    appendJsonMesh(model, meshes[meshIndex], meshIndex, seenMeshIds);
   }
 
   model.elements.reserve(elements.size());
   for (size_t elementIndex = 0; elementIndex < elements.size();
        ++elementIndex) {
-    const Json &source = elements[elementIndex];
-    const std::string context = "element[" + std::to_string(elementIndex) + "]";
-    Element element{};
-    element.meshId = requiredMeshId(source, context);
-    element.transform = makeTransform(source, importScale);
-    element.color = readColor(source);
-    element.guid = stringOrEmpty(source, "guid");
-    element.type = stringOrEmpty(source, "type");
-    element.displayName =
-        firstStringOrEmpty(source, {"displayName", "display_name", "name"});
-    element.objectType =
-        firstStringOrEmpty(source, {"objectType", "object_type"});
-    element.storeyName =
-        firstStringOrEmpty(source, {"storeyName", "storey_name"});
-    element.storeyId =
-        firstStringOrEmpty(source, {"storeyId", "storey_id", "storeyGuid",
-                                    "storey_guid"});
-    element.materialName =
-        firstStringOrEmpty(source, {"materialName", "material_name"});
-    element.materialCategory =
-        firstStringOrEmpty(source, {"materialCategory", "material_category"});
-    element.discipline =
-        firstScalarStringOrEmpty(source, {"discipline", "ifcDiscipline",
-                                          "ifc_discipline"});
-    element.phase = firstScalarStringOrEmpty(
-        source, {"phase", "phaseName", "phase_name", "constructionPhase",
-                 "construction_phase"});
-    element.fireRating =
-        firstScalarStringOrEmpty(source, {"fireRating", "fire_rating",
-                                          "FireRating"});
-    element.loadBearing =
-        firstScalarStringOrEmpty(source, {"loadBearing", "load_bearing",
-                                          "LoadBearing", "isLoadBearing",
-                                          "is_load_bearing"});
-    element.status =
-        firstScalarStringOrEmpty(source, {"status", "Status", "elementStatus",
-                                          "element_status"});
-    element.sourceId =
-        firstStringOrEmpty(source, {"sourceId", "source_id"});
-    element.properties = readElementProperties(source);
-    model.elements.push_back(std::move(element));
+    model.elements.push_back(
+        readElement(elements[elementIndex], elementIndex, importScale));
   }
 
   return model;
 }
 
-Model LoadFromFile(const std::filesystem::path &path, float importScale) {
-  std::ifstream file(path, std::ios::binary);
-  if (!file) {
-    throw std::runtime_error("failed to open dotbim file: " +
-                             container::util::pathToUtf8(path));
-  }
-  std::string text((std::istreambuf_iterator<char>(file)),
-                   std::istreambuf_iterator<char>());
-  return LoadFromJson(text, importScale);
-}
+} // namespace detail
 
 } // namespace container::geometry::dotbim
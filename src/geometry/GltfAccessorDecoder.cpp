@@ -0,0 +1,266 @@
+#include <Container/geometry/GltfAccessorDecoder.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CONTAINER_GLTF_DECODE_SSE2 1
+#endif
+
+namespace container::geometry::gltf {
+namespace {
+
+template <typename T>
+T loadScalar(const uint8_t* data) {
+  T value{};
+  std::memcpy(&value, data, sizeof(T));
+  return value;
+}
+
+template <typename T>
+constexpr float kNormalizationDivisor =
+    static_cast<float>(std::numeric_limits<T>::max());
+
+// glTF normalizes integer components only; UNSIGNED_INT and FLOAT ignore the
+// flag, matching the per-component reference.
+template <typename T>
+constexpr bool kSupportsNormalization =
+    std::is_integral_v<T> && !std::is_same_v<T, uint32_t>;
+
+template <typename T, bool Normalized>
+float convertScalar(T raw) {
+  const auto value = static_cast<float>(raw);
+  if constexpr (!Normalized || !kSupportsNormalization<T>) {
+    return value;
+  } else if constexpr (std::is_signed_v<T>) {
+    return std::max(value / kNormalizationDivisor<T>, -1.0f);
+  } else {
+    return value / kNormalizationDivisor<T>;
+  }
+}
+
+#if defined(CONTAINER_GLTF_DECODE_SSE2)
+// Loads up to four integer components into int32 lanes.  Lanes are built in
+// registers; staging them through memory stalls on store forwarding.
+template <typename T, uint32_t Components>
+__m128i loadLanes(const uint8_t* element) {
+  auto lane = [element](uint32_t c) {
+    return c < Components
+               ? static_cast<int>(loadScalar<T>(element + c * sizeof(T)))
+               : 0;
+  };
+  return _mm_setr_epi32(lane(0), lane(1), lane(2), lane(3));
+}
+
+template <uint32_t Components>
+void storeLanes(uint8_t* out, __m128 values) {
+  auto* floats = reinterpret_cast<float*>(out);
+  if constexpr (Components == 4) {
+    _mm_storeu_ps(floats, values);
+  } else {
+    if constexpr (Components >= 2) {
+      _mm_storel_pi(reinterpret_cast<__m64*>(floats), values);
+    } else {
+      _mm_store_ss(floats, values);
+    }
+    if constexpr (Components == 3) {
+      _mm_store_ss(floats + 2, _mm_movehl_ps(values, values));
+    }
+  }
+}
+
+template <typename T, bool Normalized, uint32_t Components>
+void convertElementTo(const uint8_t* element, uint8_t* out) {
+  __m128 values = _mm_cvtepi32_ps(loadLanes<T, Components>(element));
+  if constexpr (Normalized) {
+    // Division rather than a reciprocal multiply keeps results bit-identical
+    // to the scalar path.
+    values = _mm_div_ps(values, _mm_set1_ps(kNormalizationDivisor<T>));
+    if constexpr (std::is_signed_v<T>) {
+      values = _mm_max_ps(values, _mm_set1_ps(-1.0f));
+    }
+  }
+  storeLanes<Components>(out, values);
+}
+#else
+template <typename T, bool Normalized, uint32_t Components>
+void convertElementTo(const uint8_t* element, uint8_t* out) {
+  float lanes[Components];
+  for (uint32_t c = 0; c < Components; ++c) {
+    lanes[c] = convertScalar<T, Normalized>(
+        loadScalar<T>(element + c * sizeof(T)));
+  }
+  std::memcpy(out, lanes, sizeof(lanes));
+}
+#endif
+
+template <typename T, bool Normalized, uint32_t Components>
+void decodeElements(const AccessorSource& source, size_t count, uint8_t* out,
+                    size_t outStrideBytes) {
+  const uint8_t* element = source.data;
+  if constexpr (std::is_same_v<T, float>) {
+    for (size_t i = 0; i < count; ++i) {
+      std::memcpy(out, element, Components * sizeof(float));
+      element += source.strideBytes;
+      out += outStrideBytes;
+    }
+  } else if constexpr (!kSupportsNormalization<T>) {
+    for (size_t i = 0; i < count; ++i) {
+      float lanes[Components];
+      for (uint32_t c = 0; c < Components; ++c) {
+        lanes[c] = static_cast<float>(loadScalar<T>(element + c * sizeof(T)));
+      }
+      std::memcpy(out, lanes, sizeof(lanes));
+      element += source.strideBytes;
+      out += outStrideBytes;
+    }
+  } else {
+    for (size_t i = 0; i < count; ++i) {
+      convertElementTo<T, Normalized, Components>(element, out);
+      element += source.strideBytes;
+      out += outStrideBytes;
+    }
+  }
+}
+
+template <typename T, bool Normalized>
+void decodeWithWidth(const AccessorSource& source, uint32_t outComponents,
+                     size_t count, uint8_t* out, size_t outStrideBytes) {
+  switch (outComponents) {
+    case 1:
+      decodeElements<T, Normalized, 1>(source, count, out, outStrideBytes);
+      break;
+    case 2:
+      decodeElements<T, Normalized, 2>(source, count, out, outStrideBytes);
+      break;
+    case 3:
+      decodeElements<T, Normalized, 3>(source, count, out, outStrideBytes);
+      break;
+    default:
+      decodeElements<T, Normalized, 4>(source, count, out, outStrideBytes);
+      break;
+  }
+}
+
+template <typename T>
+void decodeTyped(const AccessorSource& source, uint32_t outComponents,
+                 size_t count, uint8_t* out, size_t outStrideBytes) {
+  if (kSupportsNormalization<T> && source.normalized) {
+    decodeWithWidth<T, true>(source, outComponents, count, out,
+                             outStrideBytes);
+  } else {
+    decodeWithWidth<T, false>(source, outComponents, count, out,
+                              outStrideBytes);
+  }
+}
+
+struct VertexAttributeLayout {
+  size_t offset{0};
+  uint32_t components{0};
+};
+
+VertexAttributeLayout vertexAttributeLayout(VertexAttribute attribute) {
+  switch (attribute) {
+    case VertexAttribute::Position:
+      return {offsetof(Vertex, position), 3};
+    case VertexAttribute::Color:
+      return {offsetof(Vertex, color), 3};
+    case VertexAttribute::TexCoord0:
+      return {offsetof(Vertex, texCoord), 2};
+    case VertexAttribute::TexCoord1:
+      return {offsetof(Vertex, texCoord1), 2};
+    case VertexAttribute::Normal:
+      return {offsetof(Vertex, normal), 3};
+    case VertexAttribute::Tangent:
+      return {offsetof(Vertex, tangent), 4};
+  }
+  throw std::runtime_error("Unknown glTF vertex attribute");
+}
+
+}  // namespace
+
+float decodeAccessorComponent(const uint8_t* data, AccessorComponentType type,
+                              bool normalized) {
+  switch (type) {
+    case AccessorComponentType::Float:
+      return loadScalar<float>(data);
+    case AccessorComponentType::UnsignedByte: {
+      const auto value = static_cast<float>(loadScalar<uint8_t>(data));
+      return normalized ? value / 255.0f : value;
+    }
+    case AccessorComponentType::Byte: {
+      const auto value = static_cast<float>(loadScalar<int8_t>(data));
+      return normalized ? std::max(value / 127.0f, -1.0f) : value;
+    }
+    case AccessorComponentType::UnsignedShort: {
+      const auto value = static_cast<float>(loadScalar<uint16_t>(data));
+      return normalized ? value / 65535.0f : value;
+    }
+    case AccessorComponentType::Short: {
+      const auto value = static_cast<float>(loadScalar<int16_t>(data));
+      return normalized ? std::max(value / 32767.0f, -1.0f) : value;
+    }
+    case AccessorComponentType::UnsignedInt:
+      return static_cast<float>(loadScalar<uint32_t>(data));
+  }
+  throw std::runtime_error("Unsupported glTF component type");
+}
+
+void decodeAccessorFloats(const AccessorSource& source, uint32_t outComponents,
+                          size_t count, void* out, size_t outStrideBytes) {
+  if (outComponents == 0 || outComponents > 4 ||
+      outComponents > source.componentCount) {
+    throw std::runtime_error(
+        "glTF accessor has fewer components than requested");
+  }
+  if (count > source.count) {
+    throw std::runtime_error("glTF accessor has fewer elements than requested");
+  }
+  if (count == 0) return;
+
+  auto* output = static_cast<uint8_t*>(out);
+  switch (source.componentType) {
+    case AccessorComponentType::Float:
+      decodeTyped<float>(source, outComponents, count, output, outStrideBytes);
+      return;
+    case AccessorComponentType::UnsignedByte:
+      decodeTyped<uint8_t>(source, outComponents, count, output,
+                           outStrideBytes);
+      return;
+    case AccessorComponentType::Byte:
+      decodeTyped<int8_t>(source, outComponents, count, output,
+                          outStrideBytes);
+      return;
+    case AccessorComponentType::UnsignedShort:
+      decodeTyped<uint16_t>(source, outComponents, count, output,
+                            outStrideBytes);
+      return;
+    case AccessorComponentType::Short:
+      decodeTyped<int16_t>(source, outComponents, count, output,
+                           outStrideBytes);
+      return;
+    case AccessorComponentType::UnsignedInt:
+      decodeTyped<uint32_t>(source, outComponents, count, output,
+                            outStrideBytes);
+      return;
+  }
+  throw std::runtime_error("Unsupported glTF component type");
+}
+
+void decodeVertexAttribute(const AccessorSource& source,
+                           VertexAttribute attribute,
+                           std::span<Vertex> vertices) {
+  if (vertices.empty()) return;
+  const VertexAttributeLayout layout = vertexAttributeLayout(attribute);
+  auto* first = reinterpret_cast<uint8_t*>(vertices.data()) + layout.offset;
+  decodeAccessorFloats(source, layout.components, vertices.size(), first,
+                       sizeof(Vertex));
+}
+
+}  // namespace container::geometry::gltf
@@ -1,6 +1,9 @@
 #include <Container/geometry/GltfModelLoader.h>
 
+#include <Container/geometry/GltfAccessorDecoder.h>
 #include <Container/geometry/Mesh.h>
+#include <Container/geometry/MeshOptimizer.h>
+#include <Container/utility/ParallelRanges.h>
 
 #include <tiny_gltf.h>
 
@@ -15,6 +18,7 @@ extern "C" {
 #include <cmath>
 #include <cstdint>
 #include <cstring>
+#include <exception>
 #include <iostream>
 #include <limits>
 #include <stdexcept>
@@ -163,85 +167,20 @@ AccessorReadView checkedAccessorReadView(const tinygltf::Model& model,
   return {accessor, view, buffer};
 }
 
-const uint8_t* accessorElementData(const tinygltf::Accessor& accessor,
-                                   const tinygltf::BufferView& view,
-                                   const tinygltf::Buffer& buffer,
-                                   size_t index) {
-  if (index >= accessor.count) {
-    throw std::runtime_error("glTF accessor read index is out of range");
-  }
-  const size_t stride = accessorStrideBytes(accessor, view, "accessor read");
-  const auto* dataStart = buffer.data.data() + view.byteOffset + accessor.byteOffset;
-  return dataStart + index * stride;
-}
-
-float readComponentAsFloat(const uint8_t* data, int componentType,
-                           bool normalized) {
-  switch (componentType) {
-    case TINYGLTF_COMPONENT_TYPE_FLOAT:
-      return readUnalignedScalar<float>(data);
-    case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE: {
-      const auto value = static_cast<float>(readUnalignedScalar<uint8_t>(data));
-      return normalized ? value / 255.0f : value;
-    }
-    case TINYGLTF_COMPONENT_TYPE_BYTE: {
-      const auto value = static_cast<float>(readUnalignedScalar<int8_t>(data));
-      return normalized ? std::max(value / 127.0f, -1.0f) : value;
-    }
-    case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT: {
-      const auto value =
-          static_cast<float>(readUnalignedScalar<uint16_t>(data));
-      return normalized ? value / 65535.0f : value;
-    }
-    case TINYGLTF_COMPONENT_TYPE_SHORT: {
-      const auto value = static_cast<float>(readUnalignedScalar<int16_t>(data));
-      return normalized ? std::max(value / 32767.0f, -1.0f) : value;
-    }
-    case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
-      return static_cast<float>(readUnalignedScalar<uint32_t>(data));
-    default:
-      throw std::runtime_error("Unsupported glTF component type");
-  }
-}
-
-glm::vec2 readVec2f(const tinygltf::Accessor& accessor,
-                    const tinygltf::BufferView& view,
-                    const tinygltf::Buffer& buffer, size_t index) {
-  const uint8_t* element = accessorElementData(accessor, view, buffer, index);
-  const size_t componentSize = componentSizeBytes(accessor.componentType);
-  return glm::vec2(readComponentAsFloat(element, accessor.componentType,
-                                        accessor.normalized),
-                   readComponentAsFloat(element + componentSize,
-                                        accessor.componentType,
-                                        accessor.normalized));
-}
-
-glm::vec3 readVec3f(const tinygltf::Accessor& accessor,
-                    const tinygltf::BufferView& view,
-                    const tinygltf::Buffer& buffer, size_t index) {
-  const uint8_t* element = accessorElementData(accessor, view, buffer, index);
-  const size_t componentSize = componentSizeBytes(accessor.componentType);
-  return glm::vec3(
-      readComponentAsFloat(element, accessor.componentType, accessor.normalized),
-      readComponentAsFloat(element + componentSize, accessor.componentType,
-                           accessor.normalized),
-      readComponentAsFloat(element + componentSize * 2,
-                           accessor.componentType, accessor.normalized));
-}
-
-glm::vec4 readVec4f(const tinygltf::Accessor& accessor,
-                    const tinygltf::BufferView& view,
-                    const tinygltf::Buffer& buffer, size_t index) {
-  const uint8_t* element = accessorElementData(accessor, view, buffer, index);
-  const size_t componentSize = componentSizeBytes(accessor.componentType);
-  return glm::vec4(
-      readComponentAsFloat(element, accessor.componentType, accessor.normalized),
-      readComponentAsFloat(element + componentSize, accessor.componentType,
-                           accessor.normalized),
-      readComponentAsFloat(element + componentSize * 2,
-                           accessor.componentType, accessor.normalized),
-      readComponentAsFloat(element + componentSize * 3,
-                           accessor.componentType, accessor.normalized));
+AccessorSource accessorSource(const AccessorReadView& data,
+                              std::string_view label) {
+  const auto& accessor = data.accessor;
+  return {
+      .data = data.buffer.data.data() + data.view.byteOffset +
+              accessor.byteOffset,
+      .count = accessor.count,
+      .strideBytes = accessorStrideBytes(accessor, data.view, label),
+      .componentType =
+          static_cast<AccessorComponentType>(accessor.componentType),
+      .componentCount = static_cast<uint32_t>(
+          tinygltf::GetNumComponentsInType(accessor.type)),
+      .normalized = accessor.normalized,
+  };
 }
 
 bool isColorComponentTypeSupported(const tinygltf::Accessor& accessor) {
@@ -823,15 +762,10 @@ PrimitiveVertexData mergeAttributes(const tinygltf::Model& model,
     throw std::runtime_error("POSITION must be a VEC3 float attribute");
   }
 
-  const auto& positionView = positionData.view;
-  const auto& positionBuffer = positionData.buffer;
-
   PrimitiveVertexData primitiveData{};
   primitiveData.vertices.resize(positionAccessor.count);
-  for (size_t i = 0; i < positionAccessor.count; ++i) {
-    primitiveData.vertices[i].position =
-        readVec3f(positionAccessor, positionView, positionBuffer, i);
-  }
+  decodeVertexAttribute(accessorSource(positionData, "POSITION"),
+                        VertexAttribute::Position, primitiveData.vertices);
 
   auto colorIt = primitive.attributes.find("COLOR_0");
   if (colorIt != primitive.attributes.end()) {
@@ -844,21 +778,12 @@ PrimitiveVertexData mergeAttributes(const tinygltf::Model& model,
       throw std::runtime_error(
           "COLOR_0 must be VEC3/VEC4 float or normalized unsigned integer");
     }
-    const auto& colorView = colorData.view;
-    const auto& colorBuffer = colorData.buffer;
     if (colorAccessor.count < primitiveData.vertices.size()) {
       throw std::runtime_error("COLOR_0 attribute count is smaller than POSITION count");
     }
 
-    for (size_t i = 0; i < primitiveData.vertices.size(); ++i) {
-      if (colorAccessor.type == TINYGLTF_TYPE_VEC3) {
-        primitiveData.vertices[i].color =
-            readVec3f(colorAccessor, colorView, colorBuffer, i);
-      } else {
-        primitiveData.vertices[i].color =
-            glm::vec3(readVec4f(colorAccessor, colorView, colorBuffer, i));
-      }
-    }
+    decodeVertexAttribute(accessorSource(colorData, "COLOR_0"),
+                          VertexAttribute::Color, primitiveData.vertices);
   }
 
   auto texCoordIt = primitive.attributes.find("TEXCOORD_0");
@@ -872,16 +797,14 @@ PrimitiveVertexData mergeAttributes(const tinygltf::Model& model,
           "TEXCOORD_0 must be a VEC2 float or normalized unsigned integer");
     }
 
-    const auto& texCoordView = texCoordData.view;
-    const auto& texCoordBuffer = texCoordData.buffer;
     if (texCoordAccessor.count < primitiveData.vertices.size()) {
       throw std::runtime_error("TEXCOORD_0 attribute count is smaller than POSITION count");
     }
 
-    for (size_t i = 0; i < primitiveData.vertices.size(); ++i) {
-      primitiveData.vertices[i].texCoord =
-          readVec2f(texCoordAccessor, texCoordView, texCoordBuffer, i);
-      primitiveData.vertices[i].texCoord1 = primitiveData.vertices[i].texCoord;
+    decodeVertexAttribute(accessorSource(texCoordData, "TEXCOORD_0"),
+                          VertexAttribute::TexCoord0, primitiveData.vertices);
+    for (Vertex& vertex : primitiveData.vertices) {
+      vertex.texCoord1 = vertex.texCoord;
     }
   }
 
@@ -896,16 +819,12 @@ PrimitiveVertexData mergeAttributes(const tinygltf::Model& model,
           "TEXCOORD_1 must be a VEC2 float or normalized unsigned integer");
     }
 
-    const auto& texCoordView = texCoordData.view;
-    const auto& texCoordBuffer = texCoordData.buffer;
     if (texCoordAccessor.count < primitiveData.vertices.size()) {
       throw std::runtime_error("TEXCOORD_1 attribute count is smaller than POSITION count");
     }
 
-    for (size_t i = 0; i < primitiveData.vertices.size(); ++i) {
-      primitiveData.vertices[i].texCoord1 =
-          readVec2f(texCoordAccessor, texCoordView, texCoordBuffer, i);
-    }
+    decodeVertexAttribute(accessorSource(texCoordData, "TEXCOORD_1"),
+                          VertexAttribute::TexCoord1, primitiveData.vertices);
   }
 
   auto normalIt = primitive.attributes.find("NORMAL");
@@ -918,17 +837,13 @@ PrimitiveVertexData mergeAttributes(const tinygltf::Model& model,
       throw std::runtime_error(
           "NORMAL must be a VEC3 float or normalized signed integer attribute");
     }
-    const auto& normalView = normalData.view;
-    const auto& normalBuffer = normalData.buffer;
     if (normalAccessor.count < primitiveData.vertices.size()) {
       throw std::runtime_error("NORMAL attribute count is smaller than POSITION count");
     }
 
     primitiveData.hasNormals = true;
-    for (size_t i = 0; i < primitiveData.vertices.size(); ++i) {
-      primitiveData.vertices[i].normal =
-          readVec3f(normalAccessor, normalView, normalBuffer, i);
-    }
+    decodeVertexAttribute(accessorSource(normalData, "NORMAL"),
+                          VertexAttribute::Normal, primitiveData.vertices);
   }
 
   auto tangentIt = primitive.attributes.find("TANGENT");
@@ -941,47 +856,73 @@ PrimitiveVertexData mergeAttributes(const tinygltf::Model& model,
       throw std::runtime_error(
           "TANGENT must be a VEC4 float or normalized signed integer attribute");
     }
-    const auto& tangentView = tangentData.view;
-    const auto& tangentBuffer = tangentData.buffer;
     if (tangentAccessor.count < primitiveData.vertices.size()) {
       throw std::runtime_error("TANGENT attribute count is smaller than POSITION count");
     }
 
     primitiveData.hasTangents = true;
-    for (size_t i = 0; i < primitiveData.vertices.size(); ++i) {
-      primitiveData.vertices[i].tangent =
-          readVec4f(tangentAccessor, tangentView, tangentBuffer, i);
-    }
+    decodeVertexAttribute(accessorSource(tangentData, "TANGENT"),
+                          VertexAttribute::Tangent, primitiveData.vertices);
   }
 
   return primitiveData;
 }
 
-std::vector<Mesh> parseMeshes(const tinygltf::Model& model) {
-  std::vector<Mesh> meshes;
+Mesh processPrimitive(const tinygltf::Model& model,
+                      const tinygltf::Primitive& primitive,
+                      const MeshOptimizationOptions& meshOptimization) {
+  auto primitiveData = mergeAttributes(model, primitive);
+  auto indices = readIndices(model, primitive, primitiveData.vertices.size());
+  WindingRepairResult windingRepair{};
+  if (!primitiveData.hasNormals) {
+    generateMissingNormals(primitiveData.vertices, indices);
+  } else {
+    normalizeLoadedNormals(primitiveData.vertices);
+    windingRepair =
+        repairTriangleWindingFromNormals(primitiveData.vertices, indices);
+  }
+  const bool disableBackfaceCulling =
+      windingRepair.disableBackfaceCulling ||
+      isDenseOpenReliefTopology(indices);
+  if (!primitiveData.hasTangents || windingRepair.repairedTriangleCount > 0) {
+    generateTangentsFromGeometry(primitiveData.vertices, indices);
+  } else {
+    repairInvalidTangents(primitiveData.vertices, indices);
+  }
+  optimizeMesh(primitiveData.vertices, indices, meshOptimization);
+  return Mesh(std::move(primitiveData.vertices), std::move(indices),
+              primitive.material, disableBackfaceCulling);
+}
+
+std::vector<Mesh> parseMeshes(const tinygltf::Model& model,
+                              const GltfLoadOptions& options) {
+  std::vector<const tinygltf::Primitive*> primitives;
   for (const auto& mesh : model.meshes) {
     for (const auto& primitive : mesh.primitives) {
-      auto primitiveData = mergeAttributes(model, primitive);
-      auto indices = readIndices(model, primitive, primitiveData.vertices.size());
-      WindingRepairResult windingRepair{};
-      if (!primitiveData.hasNormals) {
-        generateMissingNormals(primitiveData.vertices, indices);
-      } else {
-        normalizeLoadedNormals(primitiveData.vertices);
-        windingRepair =
-            repairTriangleWindingFromNormals(primitiveData.vertices, indices);
-      }
-      const bool disableBackfaceCulling =
-          windingRepair.disableBackfaceCulling ||
-          isDenseOpenReliefTopology(indices);
-      if (!primitiveData.hasTangents ||
-          windingRepair.repairedTriangleCount > 0) {
-        generateTangentsFromGeometry(primitiveData.vertices, indices);
-      } else {
-        repairInvalidTangents(primitiveData.vertices, indices);
-      }
-      meshes.emplace_back(std::move(primitiveData.vertices), std::move(indices),
-                          primitive.material, disableBackfaceCulling);
+      primitives.push_back(&primitive);
+    }
+  }
+
+  // Primitives are independent; each result lands in its own slot so the
+  // output order never depends on scheduling. Errors are rethrown for the
+  // first failing primitive, as the serial loop would.
+  std::vector<Mesh> meshes(primitives.size());
+  std::vector<std::exception_ptr> errors(primitives.size());
+  container::util::forEachParallelIndex(
+      primitives.size(),
+      container::util::parallelWorkerCount(primitives.size(),
+                                           options.workerCount, 2u),
+      [&](size_t index) {
+        try {
+          meshes[index] = processPrimitive(model, *primitives[index],
+                                           options.meshOptimization);
+        } catch (...) {
+          errors[index] = std::current_exception();
+        }
+      });
+  for (const std::exception_ptr& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
     }
   }
   return meshes;
@@ -1013,24 +954,35 @@ tinygltf::Model loadGltfModel(const std::string& path) {
 }  // namespace
 
 Model LoadModelFromFile(const std::string& path) {
+  return LoadModelFromFile(path, GltfLoadOptions{});
+}
+
+Model LoadModelFromFile(const std::string& path,
+                        const GltfLoadOptions& options) {
   auto model = loadGltfModel(path);
-  auto meshes = parseMeshes(model);
+  auto meshes = parseMeshes(model, options);
   if (meshes.empty()) {
     throw std::runtime_error("No renderable primitives found in glTF file");
   }
 
-  return Model{std::move(meshes)};
+  return Model::FromMeshes(std::move(meshes));
 }
 
 GltfLoadResult LoadModelWithSource(const std::string& path) {
+  return LoadModelWithSource(path, GltfLoadOptions{});
+}
+
+GltfLoadResult LoadModelWithSource(const std::string& path,
+                                   const GltfLoadOptions& options) {
   auto gltfModel = loadGltfModel(path);
 
-  auto meshes = parseMeshes(gltfModel);
+  auto meshes = parseMeshes(gltfModel, options);
   if (meshes.empty()) {
     throw std::runtime_error("No renderable primitives found in glTF file");
   }
 
-  return GltfLoadResult{Model{std::move(meshes)}, std::move(gltfModel)};
+  return GltfLoadResult{Model::FromMeshes(std::move(meshes)),
+                        std::move(gltfModel)};
 }
 
 }  // namespace gltf
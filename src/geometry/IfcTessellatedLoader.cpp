@@ -1,6 +1,7 @@
 #include "Container/geometry/IfcTessellatedLoader.h"
 
 #include "Container/geometry/CoordinateSystem.h"
+#include "Container/utility/ParallelRanges.h"
 #include "Container/utility/Platform.h"
 
 #include <algorithm>
@@ -12,7 +13,9 @@
 #include <iterator>
 #include <limits>
 #include <map>
+#include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <span>
 #include <stdexcept>
 #include <string>
@@ -573,12 +576,51 @@ std::optional<uint32_t> firstRef(const Entity &entity, size_t index) {
   return refValue(argAt(entity, index));
 }
 
+// Memoizes pure per-entity lookups shared by the tessellation workers. Keys
+// are spread over independently locked shards so concurrent readers rarely
+// contend; racing writers store the same value, and the first one wins.
+template <typename Value> class ShardedCache {
+public:
+  void reserve(size_t count) {
+    for (Shard &shard : shards_) {
+      shard.values.reserve(count / kShardCount);
+    }
+  }
+
+  std::optional<Value> find(uint32_t key) const {
+    const Shard &shard = shards_[key % kShardCount];
+    std::shared_lock lock(shard.mutex);
+    const auto it = shard.values.find(key);
+    if (it == shard.values.end()) {
+      return std::nullopt;
+    }
+    return it->second;
+  }
+
+  void insert(uint32_t key, const Value &value) {
+    Shard &shard = shards_[key % kShardCount];
+    std::unique_lock lock(shard.mutex);
+    shard.values.try_emplace(key, value);
+  }
+
+private:
+  static constexpr size_t kShardCount = 64;
+
+  struct Shard {
+    mutable std::shared_mutex mutex{};
+    std::unordered_map<uint32_t, Value> values{};
+  };
+
+  std::array<Shard, kShardCount> shards_{};
+};
+
 class IfcModelBuilder {
 public:
   IfcModelBuilder(std::unordered_map<uint32_t, Entity> entities,
-                  float importScale)
+                  float importScale, size_t workerCount)
       : entities_(std::move(entities)),
-        importScale_(sanitizeImportScale(importScale)) {
+        importScale_(sanitizeImportScale(importScale)),
+        workerCount_(workerCount) {
     sortedEntityIds_.reserve(entities_.size());
     for (const auto &[id, _] : entities_) {
       sortedEntityIds_.push_back(id);
@@ -611,8 +653,7 @@ public:
     cacheGroupRelations();
     cacheHierarchyRelations();
     cacheTypeRelations();
-    appendTessellatedGeometry();
-    appendSweptSolidGeometry();
+    appendItemGeometry();
     appendProductElements();
     appendFallbackElements();
     return std::move(model_);
@@ -625,9 +666,8 @@ private:
   }
 
   glm::vec3 readDirection(uint32_t ref, glm::vec3 fallback) const {
-    if (const auto cached = directionCache_.find(ref);
-        cached != directionCache_.end()) {
-      return cached->second;
+    if (const auto cached = directionCache_.find(ref)) {
+      return *cached;
     }
 
     const Entity *direction = entity(ref);
@@ -645,14 +685,13 @@ private:
       return fallback;
     }
     value = glm::normalize(value);
-    directionCache_[ref] = value;
+    directionCache_.insert(ref, value);
     return value;
   }
 
   glm::vec3 readPoint(uint32_t ref, glm::vec3 fallback) const {
-    if (const auto cached = pointCache_.find(ref);
-        cached != pointCache_.end()) {
-      return cached->second;
+    if (const auto cached = pointCache_.find(ref)) {
+      return *cached;
     }
 
     const Entity *point = entity(ref);
@@ -666,7 +705,7 @@ private:
     const glm::vec3 value{
         static_cast<float>(coords[0]), static_cast<float>(coords[1]),
         coords.size() > 2u ? static_cast<float>(coords[2]) : 0.0f};
-    pointCache_[ref] = value;
+    pointCache_.insert(ref, value);
     return value;
   }
 
@@ -753,6 +792,25 @@ private:
   struct TriangleVertices {
     std::array<glm::vec3, 3> positions{};
   };
+  // One mesh with indices local to its own vertices, built without touching
+  // model_ so items can be tessellated concurrently.
+  struct TriangleMesh {
+    std::vector<Vertex> vertices{};
+    std::vector<uint32_t> indices{};
+    glm::vec3 boundsCenter{0.0f};
+    float boundsRadius{0.0f};
+    glm::vec4 color{defaultColor()};
+  };
+  struct ItemGeometry {
+    std::vector<TriangleMesh> meshes{};
+    std::optional<BoxSolid> boxSolid{};
+  };
+  struct ProductGeometry {
+    std::vector<container::geometry::dotbim::Element> elements{};
+    // Host mesh with its opening cut out; elements.front() takes its mesh id
+    // once it is appended.
+    std::optional<TriangleMesh> voidedMesh{};
+  };
   using AxisIndex = glm::vec3::length_type;
 
   static glm::vec3 safeNormal(const glm::vec3 &a, const glm::vec3 &b,
@@ -886,9 +944,8 @@ private:
   }
 
   glm::mat4 axis2Placement3D(uint32_t ref) const {
-    if (const auto cached = axisPlacementCache_.find(ref);
-        cached != axisPlacementCache_.end()) {
-      return cached->second;
+    if (const auto cached = axisPlacementCache_.find(ref)) {
+      return *cached;
     }
 
     const Entity *placement = entity(ref);
@@ -911,28 +968,31 @@ private:
       xAxis = readDirection(*directionRef, {1.0f, 0.0f, 0.0f});
     }
     const glm::mat4 result = basisTransform(location, xAxis, zAxis);
-    axisPlacementCache_[ref] = result;
+    axisPlacementCache_.insert(ref, result);
     return result;
   }
 
   glm::mat4 localPlacement(uint32_t ref) const {
-    if (const auto cached = localPlacementCache_.find(ref);
-        cached != localPlacementCache_.end()) {
-      return cached->second;
+    if (const auto cached = localPlacementCache_.find(ref)) {
+      return *cached;
     }
 
     std::unordered_set<uint32_t> visiting;
-    return localPlacementRecursive(ref, visiting);
+    bool cyclic = false;
+    return localPlacementRecursive(ref, visiting, cyclic);
   }
 
-  glm::mat4
-  localPlacementRecursive(uint32_t ref,
-                          std::unordered_set<uint32_t> &visiting) const {
-    if (const auto cached = localPlacementCache_.find(ref);
-        cached != localPlacementCache_.end()) {
-      return cached->second;
+  // Placements resolved through a cycle depend on where the walk started, so
+  // they are not cached; otherwise the result would depend on which worker
+  // reached the cycle first.
+  glm::mat4 localPlacementRecursive(uint32_t ref,
+                                    std::unordered_set<uint32_t> &visiting,
+                                    bool &cyclic) const {
+    if (const auto cached = localPlacementCache_.find(ref)) {
+      return *cached;
     }
     if (!visiting.insert(ref).second) {
+      cyclic = true;
       return glm::mat4(1.0f);
     }
 
@@ -944,7 +1004,7 @@ private:
 
     glm::mat4 parent(1.0f);
     if (const auto parentRef = firstRef(*placement, 0); parentRef.has_value()) {
-      parent = localPlacementRecursive(*parentRef, visiting);
+      parent = localPlacementRecursive(*parentRef, visiting, cyclic);
     }
     glm::mat4 relative(1.0f);
     if (const auto relativeRef = firstRef(*placement, 1);
@@ -953,7 +1013,9 @@ private:
     }
     const glm::mat4 result = parent * relative;
     visiting.erase(ref);
-    localPlacementCache_[ref] = result;
+    if (!cyclic) {
+      localPlacementCache_.insert(ref, result);
+    }
     return result;
   }
 
@@ -2142,27 +2204,75 @@ private:
     element.properties = metadata.properties;
   }
 
-  void appendTessellatedGeometry() {
-    for (const auto id : sortedEntityIds_) {
-      const Entity *faceSet = entity(id);
-      if (faceSet == nullptr || faceSet->type != "IFCTRIANGULATEDFACESET") {
-        continue;
+  // Items are tessellated concurrently, then appended in the serial order:
+  // every face set by id, then every swept solid by id. Mesh ids and buffer
+  // offsets match a single-threaded build.
+  void appendItemGeometry() {
+    std::vector<const Entity *> items;
+    for (const std::string_view type :
+         {"IFCTRIANGULATEDFACESET", "IFCEXTRUDEDAREASOLID"}) {
+      for (const auto id : sortedEntityIds_) {
+        const Entity *item = entity(id);
+        if (item != nullptr && item->type == type) {
+          items.push_back(item);
+        }
+      }
+    }
+
+    std::vector<ItemGeometry> geometry(items.size());
+    container::util::forEachParallelIndex(
+        items.size(),
+        container::util::parallelWorkerCount(items.size(), workerCount_, 32u),
+        [&](size_t index) { geometry[index] = itemGeometry(*items[index]); });
+
+    size_t vertexCount = 0;
+    size_t indexCount = 0;
+    for (const ItemGeometry &item : geometry) {
+      for (const TriangleMesh &mesh : item.meshes) {
+        vertexCount += mesh.vertices.size();
+        indexCount += mesh.indices.size();
+      }
+    }
+    model_.vertices.reserve(model_.vertices.size() + vertexCount);
+    model_.indices.reserve(model_.indices.size() + indexCount);
+    for (size_t index = 0; index < items.size(); ++index) {
+      const uint32_t id = items[index]->id;
+      ItemGeometry item = std::move(geometry[index]);
+      if (item.boxSolid.has_value()) {
+        boxSolidsByItem_[id] = *item.boxSolid;
+      }
+      std::vector<MeshGroup> groups;
+      groups.reserve(item.meshes.size());
+      for (const TriangleMesh &mesh : item.meshes) {
+        groups.push_back(appendMesh(mesh));
       }
-      auto groups = appendFaceSetGeometry(*faceSet);
       if (!groups.empty()) {
         groupsByItem_[id] = std::move(groups);
       }
     }
   }
 
-  std::optional<MeshGroup>
-  appendTriangleMesh(std::span<const TriangleVertices> triangles,
-                     glm::vec4 color) {
+  ItemGeometry itemGeometry(const Entity &item) const {
+    ItemGeometry geometry{};
+    if (item.type == "IFCTRIANGULATEDFACESET") {
+      geometry.meshes = faceSetMeshes(item);
+    } else if (auto mesh = extrudedAreaSolidMesh(item, geometry.boxSolid);
+               mesh.has_value()) {
+      geometry.meshes.push_back(std::move(*mesh));
+    }
+    return geometry;
+  }
+
+  static std::optional<TriangleMesh>
+  buildTriangleMesh(std::span<const TriangleVertices> triangles,
+                    glm::vec4 color) {
     if (triangles.empty()) {
       return std::nullopt;
     }
 
-    const uint32_t firstIndex = static_cast<uint32_t>(model_.indices.size());
+    TriangleMesh mesh{};
+    mesh.vertices.reserve(triangles.size() * 3u);
+    mesh.indices.reserve(triangles.size() * 3u);
     glm::vec3 minBounds(std::numeric_limits<float>::max());
     glm::vec3 maxBounds(std::numeric_limits<float>::lowest());
 
@@ -2171,11 +2281,11 @@ private:
       const glm::vec3 normal =
           safeNormal(positions[0], positions[1], positions[2]);
       const glm::vec3 tangent = safeTangent(positions[0], positions[1], normal);
-      const uint32_t base = static_cast<uint32_t>(model_.vertices.size());
-      model_.vertices.push_back(makeVertex(positions[0], normal, tangent));
-      model_.vertices.push_back(makeVertex(positions[1], normal, tangent));
-      model_.vertices.push_back(makeVertex(positions[2], normal, tangent));
-      model_.indices.insert(model_.indices.end(), {base, base + 1u, base + 2u});
+      const uint32_t base = static_cast<uint32_t>(mesh.vertices.size());
+      mesh.vertices.push_back(makeVertex(positions[0], normal, tangent));
+      mesh.vertices.push_back(makeVertex(positions[1], normal, tangent));
+      mesh.vertices.push_back(makeVertex(positions[2], normal, tangent));
+      mesh.indices.insert(mesh.indices.end(), {base, base + 1u, base + 2u});
 
       for (const auto &position : positions) {
         minBounds = glm::min(minBounds, position);
@@ -2183,12 +2293,6 @@ private:
       }
     }
 
-    const uint32_t indexCount =
-        static_cast<uint32_t>(model_.indices.size()) - firstIndex;
-    if (indexCount == 0u) {
-      return std::nullopt;
-    }
-
     const glm::vec3 center = (minBounds + maxBounds) * 0.5f;
     float radius = 0.0f;
     for (const auto &triangle : triangles) {
@@ -2197,13 +2301,29 @@ private:
       }
     }
 
+    mesh.boundsCenter = center;
+    mesh.boundsRadius = radius;
+    mesh.color = sanitizeColor(color);
+    return mesh;
+  }
+
+  MeshGroup appendMesh(const TriangleMesh &mesh) {
+    const uint32_t firstIndex = static_cast<uint32_t>(model_.indices.size());
+    const uint32_t baseVertex = static_cast<uint32_t>(model_.vertices.size());
+    model_.vertices.insert(model_.vertices.end(), mesh.vertices.begin(),
+                           mesh.vertices.end());
+    for (const uint32_t index : mesh.indices) {
+      model_.indices.push_back(baseVertex + index);
+    }
+
     const uint32_t meshId = nextMeshId_++;
     model_.meshRanges.push_back(
-        {meshId, firstIndex, indexCount, center, radius});
-    return MeshGroup{meshId, sanitizeColor(color)};
+        {meshId, firstIndex, static_cast<uint32_t>(mesh.indices.size()),
+         mesh.boundsCenter, mesh.boundsRadius});
+    return MeshGroup{meshId, mesh.color};
   }
 
-  std::vector<MeshGroup> appendFaceSetGeometry(const Entity &faceSet) {
+  std::vector<TriangleMesh> faceSetMeshes(const Entity &faceSet) const {
     const auto pointsRef = firstRef(faceSet, 0);
     if (!pointsRef.has_value()) {
       return {};
@@ -2251,7 +2371,7 @@ private:
       ++faceIndex;
     }
 
-    std::vector<MeshGroup> meshGroups;
+    std::vector<TriangleMesh> meshes;
     for (const auto &[_, group] : groups) {
       if (group.triangles.empty()) {
         continue;
@@ -2276,31 +2396,18 @@ private:
         triangles.push_back({positions});
       }
 
-      auto meshGroup = appendTriangleMesh(triangles, group.color);
-      if (!meshGroup.has_value()) {
-        continue;
+      if (auto mesh = buildTriangleMesh(triangles, group.color);
+          mesh.has_value()) {
+        meshes.push_back(std::move(*mesh));
       }
-      meshGroups.push_back(*meshGroup);
     }
 
-    return meshGroups;
+    return meshes;
   }
 
-  void appendSweptSolidGeometry() {
-    for (const auto id : sortedEntityIds_) {
-      const Entity *solid = entity(id);
-      if (solid == nullptr || solid->type != "IFCEXTRUDEDAREASOLID") {
-        continue;
-      }
-      if (auto group = appendExtrudedAreaSolidGeometry(*solid);
-          group.has_value()) {
-        groupsByItem_[id] = {*group};
-      }
-    }
-  }
-
-  std::optional<MeshGroup>
-  appendExtrudedAreaSolidGeometry(const Entity &solid) {
+  std::optional<TriangleMesh>
+  extrudedAreaSolidMesh(const Entity &solid,
+                        std::optional<BoxSolid> &boxSolid) const {
     const auto profileRef = firstRef(solid, 0);
     if (!profileRef.has_value()) {
       return std::nullopt;
@@ -2366,11 +2473,8 @@ private:
     const glm::vec4 color = styleColorByItem_.contains(solid.id)
                                 ? styleColorByItem_.at(solid.id)
                                 : defaultColor();
-    if (auto boxSolid = makeBoxSolid(bottom, top, color);
-        boxSolid.has_value()) {
-      boxSolidsByItem_[solid.id] = *boxSolid;
-    }
-    return appendTriangleMesh(triangles, color);
+    boxSolid = makeBoxSolid(bottom, top, color);
+    return buildTriangleMesh(triangles, color);
   }
 
   static void appendCapTriangle(std::vector<TriangleVertices> &triangles,
@@ -2581,8 +2685,8 @@ private:
                       expectedNormal);
   }
 
-  std::optional<MeshGroup> appendBoxWithSingleThroughVoid(const BoxSolid &host,
-                                                          const BoxSolid &cut) {
+  static std::optional<TriangleMesh>
+  boxWithSingleThroughVoidMesh(const BoxSolid &host, const BoxSolid &cut) {
     const auto throughAxis = throughAxisForCut(host, cut);
     if (!throughAxis.has_value()) {
       return std::nullopt;
@@ -2637,7 +2741,7 @@ private:
                       host.maxBounds[*throughAxis], axisA, cut.minBounds[axisA],
                       cut.maxBounds[axisA], axisDirection(axisB, -1.0f));
 
-    return appendTriangleMesh(triangles, host.color);
+    return buildTriangleMesh(triangles, host.color);
   }
 
   void
@@ -2712,11 +2816,11 @@ private:
     }
   }
 
-  bool appendVoidedProductElement(const Entity &product,
-                                  const glm::mat4 &placement,
-                                  std::span<const GeometryInstance> instances,
-                                  const ProductMetadata &metadata,
-                                  const glm::mat4 &unitTransform) {
+  bool voidedProductGeometry(const Entity &product, const glm::mat4 &placement,
+                             std::span<const GeometryInstance> instances,
+                             const ProductMetadata &metadata,
+                             const glm::mat4 &unitTransform,
+                             ProductGeometry &geometry) const {
     const auto openingIt = openingsByHostProduct_.find(product.id);
     if (openingIt == openingsByHostProduct_.end() ||
         openingIt->second.size() != 1u || instances.size() != 1u) {
@@ -2765,31 +2869,32 @@ private:
       return false;
     }
 
-    auto group = appendBoxWithSingleThroughVoid(hostBox, *cutBox);
-    if (!group.has_value()) {
+    auto mesh = boxWithSingleThroughVoidMesh(hostBox, *cutBox);
+    if (!mesh.has_value()) {
       return false;
     }
 
     container::geometry::dotbim::Element element{};
-    element.meshId = group->meshId;
     element.transform = unitTransform * placement * hostInstance.transform;
-    element.color = group->color;
+    element.color = mesh->color;
     element.type = product.type;
     applyProductMetadata(element, metadata);
-    model_.elements.push_back(std::move(element));
+    geometry.elements.push_back(std::move(element));
+    geometry.voidedMesh = std::move(*mesh);
     return true;
   }
 
+  // Products are evaluated concurrently and appended in id order; voided
+  // host meshes take their mesh ids here, after every item mesh.
   void appendProductElements() {
-    const glm::mat4 unitTransform = importUnitTransform();
+    std::vector<const Entity *> products;
     for (const auto id : sortedEntityIds_) {
       const Entity *product = entity(id);
       if (product == nullptr || product->args.kind != StepValue::Kind::List ||
-          product->args.list.size() < 7u) {
+          product->args.list.size() < 7u ||
+          product->type == "IFCOPENINGELEMENT") {
         continue;
       }
-
-      const auto placementRef = firstRef(*product, 5);
       const auto representationRef = firstRef(*product, 6);
       if (!representationRef.has_value()) {
         continue;
@@ -2799,37 +2904,61 @@ private:
           representation->type != "IFCPRODUCTDEFINITIONSHAPE") {
         continue;
       }
+      products.push_back(product);
+    }
 
-      const glm::mat4 placement = placementRef.has_value()
-                                      ? localPlacement(*placementRef)
-                                      : glm::mat4(1.0f);
-      std::vector<GeometryInstance> instances;
-      collectGeometryInstances(*representationRef, glm::mat4(1.0f), instances);
+    const glm::mat4 unitTransform = importUnitTransform();
+    std::vector<ProductGeometry> geometry(products.size());
+    container::util::forEachParallelIndex(
+        products.size(),
+        container::util::parallelWorkerCount(products.size(), workerCount_,
+                                             32u),
+        [&](size_t index) {
+          geometry[index] = productGeometry(*products[index], unitTransform);
+        });
 
-      const ProductMetadata metadata = productMetadata(*product);
-      if (product->type == "IFCOPENINGELEMENT") {
-        continue;
+    for (ProductGeometry &product : geometry) {
+      if (product.voidedMesh.has_value()) {
+        const MeshGroup group = appendMesh(*product.voidedMesh);
+        product.elements.front().meshId = group.meshId;
       }
-      if (appendVoidedProductElement(*product, placement, instances, metadata,
-                                     unitTransform)) {
+      std::ranges::move(product.elements, std::back_inserter(model_.elements));
+      product = {};
+    }
+  }
+
+  ProductGeometry productGeometry(const Entity &product,
+                                  const glm::mat4 &unitTransform) const {
+    const auto placementRef = firstRef(product, 5);
+    const auto representationRef = firstRef(product, 6);
+    const glm::mat4 placement = placementRef.has_value()
+                                    ? localPlacement(*placementRef)
+                                    : glm::mat4(1.0f);
+    std::vector<GeometryInstance> instances;
+    collectGeometryInstances(*representationRef, glm::mat4(1.0f), instances);
+
+    ProductGeometry geometry{};
+    const ProductMetadata metadata = productMetadata(product);
+    if (voidedProductGeometry(product, placement, instances, metadata,
+                              unitTransform, geometry)) {
+      return geometry;
+    }
+    for (const auto &instance : instances) {
+      const auto groupIt = groupsByItem_.find(instance.geometryId);
+      if (groupIt == groupsByItem_.end()) {
         continue;
       }
-      for (const auto &instance : instances) {
-        const auto groupIt = groupsByItem_.find(instance.geometryId);
-        if (groupIt == groupsByItem_.end()) {
-          continue;
-        }
-        for (const auto &group : groupIt->second) {
-          container::geometry::dotbim::Element element{};
-          element.meshId = group.meshId;
-          element.transform = unitTransform * placement * instance.transform;
-          element.color = group.color;
-          element.type = product->type;
-          applyProductMetadata(element, metadata);
-          model_.elements.push_back(std::move(element));
-        }
+      for (const auto &group : groupIt->second) {
+        container::geometry::dotbim::Element element{};
+        element.meshId = group.meshId;
+        element.transform = unitTransform * placement * instance.transform;
+        element.color = group.color;
+        element.type = product.type;
+        applyProductMetadata(element, metadata);
+        geometry.elements.push_back(std::move(element));
       }
     }
+    return geometry;
   }
 
   void appendFallbackElements() {
@@ -2858,14 +2987,15 @@ private:
   std::unordered_map<uint32_t, Entity> entities_;
   std::vector<uint32_t> sortedEntityIds_{};
   float importScale_{1.0f};
+  size_t workerCount_{0};
   LengthUnitMetadata unitMetadata_{};
   float unitScale_{1.0f};
   uint32_t nextMeshId_{1};
   Model model_{};
-  mutable std::unordered_map<uint32_t, glm::vec3> pointCache_{};
-  mutable std::unordered_map<uint32_t, glm::vec3> directionCache_{};
-  mutable std::unordered_map<uint32_t, glm::mat4> axisPlacementCache_{};
-  mutable std::unordered_map<uint32_t, glm::mat4> localPlacementCache_{};
+  mutable ShardedCache<glm::vec3> pointCache_{};
+  mutable ShardedCache<glm::vec3> directionCache_{};
+  mutable ShardedCache<glm::mat4> axisPlacementCache_{};
+  mutable ShardedCache<glm::mat4> localPlacementCache_{};
   std::unordered_map<uint32_t, glm::vec4> styleColorByItem_{};
   std::unordered_map<uint32_t, std::vector<glm::vec4>> faceColorsByFaceSet_{};
   std::unordered_map<uint32_t, std::vector<MeshGroup>> groupsByItem_{};
@@ -2880,10 +3010,24 @@ private:
 } // namespace
 
 Model LoadFromStep(std::string_view stepText, float importScale) {
-  return IfcModelBuilder(parseEntities(stepText), importScale).build();
+  return LoadFromStep(stepText, importScale, IfcLoadOptions{});
+}
+
+Model LoadFromStep(std::string_view stepText, float importScale,
+                   const IfcLoadOptions &options) {
+  Model model = IfcModelBuilder(parseEntities(stepText), importScale,
+                                options.workerCount)
+                    .build();
+  optimizeModelGeometry(model, options.meshOptimization);
+  return model;
 }
 
 Model LoadFromFile(const std::filesystem::path &path, float importScale) {
+  return LoadFromFile(path, importScale, IfcLoadOptions{});
+}
+
+Model LoadFromFile(const std::filesystem::path &path, float importScale,
+                   const IfcLoadOptions &options) {
   std::ifstream file(path, std::ios::binary);
   if (!file) {
     throw std::runtime_error("failed to open IFC file: " +
@@ -2891,7 +3035,7 @@ Model LoadFromFile(const std::filesystem::path &path, float importScale) {
   }
   std::string text((std::istreambuf_iterator<char>(file)),
                    std::istreambuf_iterator<char>());
-  return LoadFromStep(text, importScale);
+  return LoadFromStep(text, importScale, options);
 }
 
 } // namespace container::geometry::ifc
@@ -14,7 +14,6 @@
 #include <filesystem>
 #include <fstream>
 #include <initializer_list>
-#include <iterator>
 #include <limits>
 #include <optional>
 #include <sstream>
@@ -2351,25 +2350,33 @@ void normalizeRootMaterialTexturePaths(Json &root,
   }
 }
 
-void appendRootData(Json &data, const Json &root) {
+void appendRootData(Json &data, Json &&root) {
   if (!root.is_object() || !root.contains("data") ||
       !root.at("data").is_array()) {
     return;
   }
-  for (const Json &item : root.at("data")) {
-    data.push_back(item);
+  for (Json &item : root.at("data")) {
+    data.push_back(std::move(item));
   }
 }
 
+// Parses straight from the stream and drops every top-level member that file
+// composition does not read, so neither the text nor headers are kept. The
+// data and imports members are still built as a full JSON tree: composition
+// and the node graph read node attributes as JSON.
 Json readJsonFile(const std::filesystem::path &path) {
   std::ifstream file(path, std::ios::binary);
   if (!file) {
     throw std::runtime_error("failed to open IFCX file: " +
                              container::util::pathToUtf8(path));
   }
-  std::string text((std::istreambuf_iterator<char>(file)),
-                   std::istreambuf_iterator<char>());
-  return Json::parse(text.begin(), text.end());
+  return Json::parse(
+      file, [](int depth, Json::parse_event_t event, Json &parsed) {
+        if (depth == 1 && event == Json::parse_event_t::key) {
+          return parsed == "data" || parsed == "imports";
+        }
+        return true;
+      });
 }
 
 bool startsWith(std::string_view value, std::string_view prefix) {
@@ -2480,23 +2487,24 @@ Json composeRootFromFile(const std::filesystem::path &path,
     return Json{{"data", Json::array()}};
   }
 
-  const Json root = readJsonFile(normalized);
-  Json localRoot = root;
-  normalizeRootMaterialTexturePaths(localRoot, normalized.parent_path());
+  Json root = readJsonFile(normalized);
   Json composed{{"data", Json::array()}};
   const std::vector<std::filesystem::path> imports =
       localImportPaths(root, normalized.parent_path());
+  const bool needsBaseLayer =
+      imports.empty() &&
+      (!hasRenderableData(root) || hasUnresolvedGraphReferences(root));
+  normalizeRootMaterialTexturePaths(root, normalized.parent_path());
   for (const std::filesystem::path &importPath : imports) {
     appendRootData(composed["data"], composeRootFromFile(importPath, visiting));
   }
-  if (imports.empty() &&
-      (!hasRenderableData(root) || hasUnresolvedGraphReferences(root))) {
+  if (needsBaseLayer) {
     if (auto baseLayer = heuristicBaseLayerPath(normalized)) {
       appendRootData(composed["data"],
                      composeRootFromFile(*baseLayer, visiting));
     }
   }
-  appendRootData(composed["data"], localRoot);
+  appendRootData(composed["data"], std::move(root));
 
   visiting.erase(key);
   return composed;
@@ -2566,4 +2574,11 @@ Model LoadFromFile(const std::filesystem::path &path, float importScale) {
   return loadFromRoot(root, importScale, &sourceDir);
 }
 
+Model LoadFromFile(const std::filesystem::path &path, float importScale,
+                   const MeshOptimizationOptions &meshOptimization) {
+  Model model = LoadFromFile(path, importScale);
+  optimizeModelGeometry(model, meshOptimization);
+  return model;
+}
+
 } // namespace container::geometry::ifcx
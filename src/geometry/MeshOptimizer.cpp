@@ -0,0 +1,605 @@
+#include <Container/geometry/MeshOptimizer.h>
+
+#include <Container/geometry/DotBimLoader.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+
+#include <glm/geometric.hpp>
+
+namespace container::geometry {
+namespace {
+
+constexpr uint32_t kInvalidIndex = std::numeric_limits<uint32_t>::max();
+
+// Tom Forsyth, "Linear-Speed Vertex Cache Optimisation". Scores assume an
+// LRU cache of this many entries, which also serves FIFO hardware well.
+constexpr uint32_t kForsythCacheSize = 32;
+constexpr uint32_t kForsythValenceLimit = 32;
+
+// Overdraw clustering simulates the same FIFO as analyzeVertexCache.
+constexpr uint32_t kClusterCacheSize = 16;
+
+// Triangle budget of the meshlet clusters the IFCX and USD loaders build and
+// BimManager estimates for other models, both counted from the start of each
+// mesh range. Model triangles are only reordered inside blocks of this size
+// so every cluster keeps its own triangles and tight bounds.
+constexpr uint32_t kMeshletIndexBudget = 64u * 3u;
+
+struct ForsythScoreTables {
+  std::array<float, kForsythCacheSize + 1> cache{};
+  std::array<float, kForsythValenceLimit + 1> valence{};
+};
+
+const ForsythScoreTables& forsythScoreTables() {
+  static const ForsythScoreTables tables = [] {
+    ForsythScoreTables result{};
+    // The three most recent vertices belong to the triangle just emitted, so
+    // they score flat to avoid favouring strips over fans.
+    for (uint32_t position = 0; position < kForsythCacheSize; ++position) {
+      result.cache[position] =
+          position < 3u
+              ? 0.75f
+              : std::pow(1.0f - static_cast<float>(position - 3u) /
+                                    static_cast<float>(kForsythCacheSize - 3u),
+                         1.5f);
+    }
+    result.cache[kForsythCacheSize] = 0.0f;
+    result.valence[0] = 0.0f;
+    for (uint32_t valence = 1; valence <= kForsythValenceLimit; ++valence) {
+      result.valence[valence] =
+          2.0f / std::sqrt(static_cast<float>(valence));
+    }
+    return result;
+  }();
+  return tables;
+}
+
+// `cachePosition` == kForsythCacheSize means "not cached".
+float forsythVertexScore(uint32_t cachePosition, uint32_t remainingValence) {
+  if (remainingValence == 0u) {
+    return -1.0f;
+  }
+  const ForsythScoreTables& tables = forsythScoreTables();
+  return tables.cache[cachePosition] +
+         tables.valence[std::min(remainingValence, kForsythValenceLimit)];
+}
+
+// FIFO cache simulation by insertion timestamp: a vertex is resident while
+// fewer than `cacheSize` misses happened since it was inserted.
+class FifoCache {
+ public:
+  FifoCache(size_t vertexCount, uint32_t cacheSize)
+      : timestamps_(vertexCount, 0u),
+        cacheSize_(cacheSize),
+        timestamp_(cacheSize + 1u) {}
+
+  uint32_t access(uint32_t vertex) {
+    if (timestamp_ - timestamps_[vertex] > cacheSize_) {
+      timestamps_[vertex] = timestamp_++;
+      return 1u;
+    }
+    return 0u;
+  }
+
+  uint32_t accessTriangle(const uint32_t* triangle) {
+    return access(triangle[0]) + access(triangle[1]) + access(triangle[2]);
+  }
+
+  void flush() { timestamp_ += cacheSize_ + 1u; }
+
+ private:
+  std::vector<uint32_t> timestamps_;
+  uint32_t cacheSize_{0};
+  uint32_t timestamp_{0};
+};
+
+uint64_t hashVertex(const Vertex& vertex) {
+  std::array<uint32_t, sizeof(Vertex) / sizeof(uint32_t)> words{};
+  std::memcpy(words.data(), &vertex, sizeof(words));
+  uint64_t hash = 14695981039346656037ull;
+  for (const uint32_t word : words) {
+    hash = (hash ^ word) * 1099511628211ull;
+  }
+  return hash ^ (hash >> 29u);
+}
+
+bool sameVertex(const Vertex& lhs, const Vertex& rhs) {
+  return std::memcmp(&lhs, &rhs, sizeof(Vertex)) == 0;
+}
+
+void optimizeVertexCacheImpl(std::span<uint32_t> indices, size_t vertexCount) {
+  const size_t triangleCount = indices.size() / 3u;
+  if (triangleCount < 2u) {
+    return;
+  }
+
+  // Triangles adjacent to each vertex; the first remainingValence entries of
+  // a vertex's slot are the triangles not yet emitted.
+  std::vector<uint32_t> remainingValence(vertexCount, 0u);
+  for (size_t i = 0; i < triangleCount * 3u; ++i) {
+    ++remainingValence[indices[i]];
+  }
+  // Without shared vertices every order misses three times per triangle.
+  if (std::ranges::all_of(remainingValence,
+                          [](uint32_t valence) { return valence <= 1u; })) {
+    return;
+  }
+  std::vector<uint32_t> adjacencyOffsets(vertexCount + 1u, 0u);
+  for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+    adjacencyOffsets[vertex + 1u] =
+        adjacencyOffsets[vertex] + remainingValence[vertex];
+  }
+  std::vector<uint32_t> adjacency(triangleCount * 3u);
+  {
+    std::vector<uint32_t> fill(adjacencyOffsets.begin(),
+                               adjacencyOffsets.end() - 1);
+    for (size_t triangle = 0; triangle < triangleCount; ++triangle) {
+      for (size_t corner = 0; corner < 3u; ++corner) {
+        adjacency[fill[indices[triangle * 3u + corner]]++] =
+            static_cast<uint32_t>(triangle);
+      }
+    }
+  }
+
+  std::vector<float> vertexScore(vertexCount, 0.0f);
+  for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+    vertexScore[vertex] =
+        forsythVertexScore(kForsythCacheSize, remainingValence[vertex]);
+  }
+  std::vector<float> triangleScore(triangleCount, 0.0f);
+  for (size_t triangle = 0; triangle < triangleCount; ++triangle) {
+    for (size_t corner = 0; corner < 3u; ++corner) {
+      triangleScore[triangle] += vertexScore[indices[triangle * 3u + corner]];
+    }
+  }
+
+  const std::vector<uint32_t> source(indices.begin(),
+                                     indices.begin() + triangleCount * 3u);
+  std::vector<bool> emitted(triangleCount, false);
+  std::array<uint32_t, kForsythCacheSize + 3u> cache{};
+  std::array<uint32_t, kForsythCacheSize + 3u> nextCache{};
+  size_t cacheCount = 0;
+  size_t deadEndCursor = 0;
+
+  uint32_t bestTriangle = static_cast<uint32_t>(
+      std::ranges::max_element(triangleScore) - triangleScore.begin());
+  for (size_t output = 0; output < triangleCount; ++output) {
+    if (bestTriangle == kInvalidIndex) {
+      // Dead end: nothing in the cache has triangles left. Resume from the
+      // next unemitted triangle in input order.
+      while (emitted[deadEndCursor]) {
+        ++deadEndCursor;
+      }
+      bestTriangle = static_cast<uint32_t>(deadEndCursor);
+    }
+
+    const uint32_t* corners = &source[bestTriangle * 3u];
+    std::copy_n(corners, 3u, indices.begin() + output * 3u);
+    emitted[bestTriangle] = true;
+
+    for (size_t corner = 0; corner < 3u; ++corner) {
+      const uint32_t vertex = corners[corner];
+      const auto first = adjacency.begin() + adjacencyOffsets[vertex];
+      const auto last = first + remainingValence[vertex];
+      const auto found = std::find(first, last, bestTriangle);
+      std::iter_swap(found, last - 1);
+      --remainingValence[vertex];
+    }
+
+    size_t nextCount = 0;
+    for (size_t corner = 0; corner < 3u; ++corner) {
+      const uint32_t vertex = corners[corner];
+      if (std::find(nextCache.begin(), nextCache.begin() + nextCount,
+                    vertex) == nextCache.begin() + nextCount) {
+        nextCache[nextCount++] = vertex;
+      }
+    }
+    for (size_t slot = 0; slot < cacheCount; ++slot) {
+      const uint32_t vertex = cache[slot];
+      if (vertex != corners[0] && vertex != corners[1] &&
+          vertex != corners[2]) {
+        nextCache[nextCount++] = vertex;
+      }
+    }
+
+    // Rescore every vertex that entered, moved within or left the cache and
+    // push the change into its remaining triangles.
+    bestTriangle = kInvalidIndex;
+    float bestScore = 0.0f;
+    for (size_t slot = 0; slot < nextCount; ++slot) {
+      const uint32_t vertex = nextCache[slot];
+      const uint32_t position =
+          slot < kForsythCacheSize ? static_cast<uint32_t>(slot)
+                                   : kForsythCacheSize;
+      const float score =
+          forsythVertexScore(position, remainingValence[vertex]);
+      const float delta = score - vertexScore[vertex];
+      vertexScore[vertex] = score;
+      const auto first = adjacency.begin() + adjacencyOffsets[vertex];
+      for (auto it = first; it != first + remainingValence[vertex]; ++it) {
+        triangleScore[*it] += delta;
+      }
+    }
+    for (size_t slot = 0; slot < std::min<size_t>(nextCount,
+                                                  kForsythCacheSize);
+         ++slot) {
+      const uint32_t vertex = nextCache[slot];
+      const auto first = adjacency.begin() + adjacencyOffsets[vertex];
+      for (auto it = first; it != first + remainingValence[vertex]; ++it) {
+        if (triangleScore[*it] > bestScore) {
+          bestScore = triangleScore[*it];
+          bestTriangle = *it;
+        }
+      }
+    }
+
+    cacheCount = std::min<size_t>(nextCount, kForsythCacheSize);
+    std::copy_n(nextCache.begin(), cacheCount, cache.begin());
+  }
+}
+
+struct TriangleCluster {
+  uint32_t firstTriangle{0};
+  uint32_t triangleCount{0};
+  float sortKey{0.0f};
+};
+
+void optimizeOverdrawImpl(std::span<uint32_t> indices,
+                          std::span<const glm::vec3> positions,
+                          float threshold) {
+  const size_t triangleCount = indices.size() / 3u;
+  if (triangleCount < 2u) {
+    return;
+  }
+
+  // Hard boundaries: a triangle that misses on all three vertices starts a
+  // new patch. Each patch is then cut wherever the running ACMR reaches the
+  // patch ACMR scaled by `threshold`, giving clusters that can be reordered
+  // while losing little cache efficiency.
+  FifoCache cache(positions.size(), kClusterCacheSize);
+  std::vector<uint32_t> hardBoundaries;
+  for (size_t triangle = 0; triangle < triangleCount; ++triangle) {
+    if (cache.accessTriangle(&indices[triangle * 3u]) == 3u ||
+        triangle == 0u) {
+      hardBoundaries.push_back(static_cast<uint32_t>(triangle));
+    }
+  }
+  hardBoundaries.push_back(static_cast<uint32_t>(triangleCount));
+
+  std::vector<uint32_t> boundaries;
+  for (size_t patch = 0; patch + 1u < hardBoundaries.size(); ++patch) {
+    const uint32_t begin = hardBoundaries[patch];
+    const uint32_t end = hardBoundaries[patch + 1u];
+    cache.flush();
+    uint32_t patchMisses = 0;
+    for (uint32_t triangle = begin; triangle < end; ++triangle) {
+      patchMisses += cache.accessTriangle(&indices[triangle * 3u]);
+    }
+    const float targetAcmr = threshold * static_cast<float>(patchMisses) /
+                             static_cast<float>(end - begin);
+
+    const size_t patchStart = boundaries.size();
+    boundaries.push_back(begin);
+    cache.flush();
+    uint32_t misses = 0;
+    uint32_t triangles = 0;
+    for (uint32_t triangle = begin; triangle < end; ++triangle) {
+      misses += cache.accessTriangle(&indices[triangle * 3u]);
+      ++triangles;
+      if (static_cast<float>(misses) <=
+          targetAcmr * static_cast<float>(triangles)) {
+        boundaries.push_back(triangle + 1u);
+        cache.flush();
+        misses = 0;
+        triangles = 0;
+      }
+    }
+    // The tail after the last cut is rarely a good cluster on its own, and a
+    // cut at `end` is empty; fold either into the previous cluster.
+    if (boundaries.size() - patchStart > 1u) {
+      boundaries.pop_back();
+    }
+  }
+  boundaries.push_back(static_cast<uint32_t>(triangleCount));
+
+  // Sort clusters so those facing away from the mesh centroid draw first;
+  // they are the most likely to occlude the rest.
+  std::vector<TriangleCluster> clusters;
+  clusters.reserve(boundaries.size() - 1u);
+  std::vector<glm::vec3> centroids;
+  std::vector<glm::vec3> normals;
+  centroids.reserve(boundaries.size() - 1u);
+  normals.reserve(boundaries.size() - 1u);
+  glm::vec3 meshCentroid(0.0f);
+  float meshArea = 0.0f;
+  for (size_t cluster = 0; cluster + 1u < boundaries.size(); ++cluster) {
+    glm::vec3 centroid(0.0f);
+    glm::vec3 normal(0.0f);
+    float area = 0.0f;
+    for (uint32_t triangle = boundaries[cluster];
+         triangle < boundaries[cluster + 1u]; ++triangle) {
+      const glm::vec3& a = positions[indices[triangle * 3u]];
+      const glm::vec3& b = positions[indices[triangle * 3u + 1u]];
+      const glm::vec3& c = positions[indices[triangle * 3u + 2u]];
+      const glm::vec3 cross = glm::cross(b - a, c - a);
+      const float triangleArea = glm::length(cross);
+      centroid += (a + b + c) * (triangleArea / 3.0f);
+      normal += cross;
+      area += triangleArea;
+    }
+    meshCentroid += centroid;
+    meshArea += area;
+    centroids.push_back(area > 0.0f ? centroid / area : centroid);
+    normals.push_back(normal);
+    clusters.push_back({boundaries[cluster],
+                        boundaries[cluster + 1u] - boundaries[cluster], 0.0f});
+  }
+  if (meshArea > 0.0f) {
+    meshCentroid /= meshArea;
+  }
+  for (size_t cluster = 0; cluster < clusters.size(); ++cluster) {
+    const float length = glm::length(normals[cluster]);
+    clusters[cluster].sortKey =
+        length > 0.0f
+            ? glm::dot(centroids[cluster] - meshCentroid, normals[cluster]) /
+                  length
+            : 0.0f;
+  }
+  std::ranges::stable_sort(clusters, std::ranges::greater{},
+                           &TriangleCluster::sortKey);
+
+  const std::vector<uint32_t> source(indices.begin(),
+                                     indices.begin() + triangleCount * 3u);
+  size_t output = 0;
+  for (const TriangleCluster& cluster : clusters) {
+    const size_t count = static_cast<size_t>(cluster.triangleCount) * 3u;
+    std::copy_n(source.begin() + cluster.firstTriangle * 3u, count,
+                indices.begin() + output);
+    output += count;
+  }
+}
+
+bool validTriangleList(std::span<const uint32_t> indices,
+                       size_t vertexCount) {
+  return indices.size() % 3u == 0u &&
+         std::ranges::all_of(indices, [vertexCount](uint32_t index) {
+           return index < vertexCount;
+         });
+}
+
+}  // namespace
+
+VertexCacheStatistics analyzeVertexCache(std::span<const uint32_t> indices,
+                                         size_t vertexCount,
+                                         uint32_t cacheSize) {
+  VertexCacheStatistics statistics{};
+  statistics.triangleCount = static_cast<uint32_t>(indices.size() / 3u);
+  if (statistics.triangleCount == 0u) {
+    return statistics;
+  }
+
+  FifoCache cache(vertexCount, cacheSize);
+  std::vector<bool> referenced(vertexCount, false);
+  for (size_t i = 0; i < statistics.triangleCount * 3u; ++i) {
+    const uint32_t vertex = indices[i];
+    statistics.vertexTransforms += cache.access(vertex);
+    if (!referenced[vertex]) {
+      referenced[vertex] = true;
+      ++statistics.vertexCount;
+    }
+  }
+  statistics.acmr = static_cast<float>(statistics.vertexTransforms) /
+                    static_cast<float>(statistics.triangleCount);
+  statistics.atvr = static_cast<float>(statistics.vertexTransforms) /
+                    static_cast<float>(statistics.vertexCount);
+  return statistics;
+}
+
+size_t weldVertices(std::vector<Vertex>& vertices,
+                    std::span<uint32_t> indices) {
+  if (vertices.empty()) {
+    return 0;
+  }
+
+  size_t bucketCount = 1;
+  while (bucketCount < vertices.size() * 2u) {
+    bucketCount <<= 1u;
+  }
+  // Open addressing over indices of kept vertices.
+  std::vector<uint32_t> buckets(bucketCount, kInvalidIndex);
+  std::vector<uint32_t> remap(vertices.size());
+  size_t kept = 0;
+  for (size_t vertex = 0; vertex < vertices.size(); ++vertex) {
+    size_t bucket = hashVertex(vertices[vertex]) & (bucketCount - 1u);
+    while (buckets[bucket] != kInvalidIndex &&
+           !sameVertex(vertices[buckets[bucket]], vertices[vertex])) {
+      bucket = (bucket + 1u) & (bucketCount - 1u);
+    }
+    if (buckets[bucket] == kInvalidIndex) {
+      vertices[kept] = vertices[vertex];
+      buckets[bucket] = static_cast<uint32_t>(kept++);
+    }
+    remap[vertex] = buckets[bucket];
+  }
+  vertices.resize(kept);
+  for (uint32_t& index : indices) {
+    if (index < remap.size()) {
+      index = remap[index];
+    }
+  }
+  return kept;
+}
+
+void optimizeVertexCache(std::span<uint32_t> indices, size_t vertexCount) {
+  if (!validTriangleList(indices, vertexCount)) {
+    return;
+  }
+  optimizeVertexCacheImpl(indices, vertexCount);
+}
+
+void optimizeOverdraw(std::span<uint32_t> indices,
+                      std::span<const Vertex> vertices, float threshold) {
+  if (!validTriangleList(indices, vertices.size())) {
+    return;
+  }
+  std::vector<glm::vec3> positions;
+  positions.reserve(vertices.size());
+  for (const Vertex& vertex : vertices) {
+    positions.push_back(vertex.position);
+  }
+  optimizeOverdrawImpl(indices, positions, threshold);
+}
+
+void optimizeVertexFetch(std::vector<Vertex>& vertices,
+                         std::span<uint32_t> indices) {
+  if (!std::ranges::all_of(indices, [&](uint32_t index) {
+        return index < vertices.size();
+      })) {
+    return;
+  }
+  std::vector<uint32_t> remap(vertices.size(), kInvalidIndex);
+  std::vector<Vertex> reordered;
+  reordered.reserve(vertices.size());
+  for (uint32_t& index : indices) {
+    if (remap[index] == kInvalidIndex) {
+      remap[index] = static_cast<uint32_t>(reordered.size());
+      reordered.push_back(vertices[index]);
+    }
+    index = remap[index];
+  }
+  vertices = std::move(reordered);
+}
+
+void optimizeMesh(std::vector<Vertex>& vertices,
+                  std::vector<uint32_t>& indices,
+                  const MeshOptimizationOptions& options) {
+  if (!options.enabled || !validTriangleList(indices, vertices.size())) {
+    return;
+  }
+  if (options.weldVertices) {
+    weldVertices(vertices, indices);
+  }
+  if (options.optimizeVertexCache) {
+    optimizeVertexCacheImpl(indices, vertices.size());
+  }
+  if (options.optimizeOverdraw) {
+    optimizeOverdraw(indices, vertices, options.overdrawThreshold);
+  }
+  if (options.optimizeVertexFetch) {
+    optimizeVertexFetch(vertices, indices);
+  }
+}
+
+void optimizeModelGeometry(dotbim::Model& model,
+                           const MeshOptimizationOptions& options) {
+  if (!options.enabled || model.vertices.empty() ||
+      !std::ranges::all_of(model.indices, [&](uint32_t index) {
+        return index < model.vertices.size();
+      })) {
+    return;
+  }
+  if (options.weldVertices) {
+    weldVertices(model.vertices, model.indices);
+  }
+
+  if (options.optimizeVertexCache || options.optimizeOverdraw) {
+    // Distinct, non-overlapping triangle spans; ranges that share a span are
+    // reordered once and partially overlapping spans are left alone.
+    std::vector<std::pair<uint32_t, uint32_t>> spans;
+    for (const dotbim::MeshRange& range : model.meshRanges) {
+      if (range.indexCount >= 6u && range.indexCount % 3u == 0u &&
+          static_cast<size_t>(range.firstIndex) + range.indexCount <=
+              model.indices.size()) {
+        spans.emplace_back(range.firstIndex,
+                           range.firstIndex + range.indexCount);
+      }
+    }
+    std::ranges::sort(spans);
+    const auto duplicates = std::ranges::unique(spans);
+    spans.erase(duplicates.begin(), duplicates.end());
+
+    // Cluster ends that do not fall on the budget grid still cut a block.
+    std::vector<uint32_t> clusterCuts;
+    clusterCuts.reserve(model.meshletClusters.size() * 2u);
+    for (const dotbim::MeshletClusterRange& cluster : model.meshletClusters) {
+      clusterCuts.push_back(cluster.firstIndex);
+      clusterCuts.push_back(cluster.firstIndex + cluster.indexCount);
+    }
+    std::ranges::sort(clusterCuts);
+
+    // Each block is renumbered to local vertex ids so the passes cost only
+    // the block's own size.
+    std::vector<uint32_t> localIndex(model.vertices.size(), kInvalidIndex);
+    std::vector<uint32_t> globalIndex;
+    std::vector<glm::vec3> positions;
+    auto optimizeBlock = [&](uint32_t begin, uint32_t end) {
+      const std::span<uint32_t> indices(model.indices.data() + begin,
+                                        end - begin);
+      globalIndex.clear();
+      positions.clear();
+      for (uint32_t& index : indices) {
+        if (localIndex[index] == kInvalidIndex) {
+          localIndex[index] = static_cast<uint32_t>(globalIndex.size());
+          globalIndex.push_back(index);
+          positions.push_back(model.vertices[index].position);
+        }
+        index = localIndex[index];
+      }
+      if (options.optimizeVertexCache) {
+        optimizeVertexCacheImpl(indices, globalIndex.size());
+      }
+      if (options.optimizeOverdraw) {
+        optimizeOverdrawImpl(indices, positions, options.overdrawThreshold);
+      }
+      for (uint32_t& index : indices) {
+        index = globalIndex[index];
+      }
+      for (const uint32_t vertex : globalIndex) {
+        localIndex[vertex] = kInvalidIndex;
+      }
+    };
+
+    uint32_t previousEnd = 0;
+    for (size_t i = 0; i < spans.size(); ++i) {
+      const auto [begin, end] = spans[i];
+      const bool overlapsNext = i + 1u < spans.size() &&
+                                spans[i + 1u].first < end;
+      if (begin < previousEnd || overlapsNext) {
+        previousEnd = std::max(previousEnd, end);
+        continue;
+      }
+      previousEnd = end;
+
+      auto cut = std::ranges::upper_bound(clusterCuts, begin);
+      for (uint32_t blockBegin = begin; blockBegin < end;) {
+        uint32_t blockEnd =
+            std::min(end, blockBegin + kMeshletIndexBudget -
+                              (blockBegin - begin) % kMeshletIndexBudget);
+        while (cut != clusterCuts.end() && *cut <= blockBegin) {
+          ++cut;
+        }
+        if (cut != clusterCuts.end() && *cut < blockEnd) {
+          blockEnd = *cut;
+        }
+        // A cluster boundary off the triangle grid leaves blocks without
+        // whole triangles; those keep their order.
+        if ((blockEnd - blockBegin) % 3u == 0u &&
+            blockEnd - blockBegin >= 6u) {
+          optimizeBlock(blockBegin, blockEnd);
+        }
+        blockBegin = blockEnd;
+      }
+    }
+  }
+
+  if (options.optimizeVertexFetch) {
+    optimizeVertexFetch(model.vertices, model.indices);
+  }
+}
+
+}  // namespace container::geometry
@@ -1,6 +1,8 @@
 #include "Container/geometry/UsdLoader.h"
 
 #include "Container/geometry/CoordinateSystem.h"
+#include "Container/geometry/UsdTokenizer.h"
+#include "Container/utility/MappedFile.h"
 #include "Container/utility/Platform.h"
 #include "Container/utility/SceneData.h"
 
@@ -9,7 +11,6 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <cstdlib>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
@@ -17,6 +18,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <span>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -41,14 +43,6 @@
 namespace container::geometry::usd {
 namespace {
 
-enum class TokenKind { Identifier, String, Number, Symbol, End };
-
-struct Token {
-  TokenKind kind{TokenKind::End};
-  std::string text{};
-  double number{0.0};
-};
-
 struct StageUnitMetadata {
   bool authored{false};
   float metersPerUnit{1.0f};
@@ -98,98 +92,6 @@ struct Node {
   bool hasVisibility{false};
 };
 
-bool isSymbol(char c) {
-  switch (c) {
-  case '{':
-  case '}':
-  case '[':
-  case ']':
-  case '(':
-  case ')':
-  case ',':
-  case '=':
-  case ';':
-    return true;
-  default:
-    return false;
-  }
-}
-
-bool isNumberStart(std::string_view text, size_t offset) {
-  const char c = text[offset];
-  if (std::isdigit(static_cast<unsigned char>(c))) {
-    return true;
-  }
-  if ((c == '+' || c == '-' || c == '.') && offset + 1u < text.size()) {
-    return std::isdigit(static_cast<unsigned char>(text[offset + 1u]));
-  }
-  return false;
-}
-
-std::vector<Token> tokenize(std::string_view text) {
-  std::vector<Token> tokens;
-  size_t cursor = 0;
-  while (cursor < text.size()) {
-    const char c = text[cursor];
-    if (std::isspace(static_cast<unsigned char>(c))) {
-      ++cursor;
-      continue;
-    }
-    if (c == '#') {
-      while (cursor < text.size() && text[cursor] != '\n') {
-        ++cursor;
-      }
-      continue;
-    }
-    if (c == '"') {
-      ++cursor;
-      std::string value;
-      while (cursor < text.size()) {
-        const char current = text[cursor++];
-        if (current == '"') {
-          break;
-        }
-        if (current == '\\' && cursor < text.size()) {
-          value.push_back(text[cursor++]);
-        } else {
-          value.push_back(current);
-        }
-      }
-      tokens.push_back({TokenKind::String, std::move(value), 0.0});
-      continue;
-    }
-    if (isSymbol(c)) {
-      tokens.push_back({TokenKind::Symbol, std::string(1, c), 0.0});
-      ++cursor;
-      continue;
-    }
-    if (isNumberStart(text, cursor)) {
-      const char *begin = text.data() + cursor;
-      char *end = nullptr;
-      const double value = std::strtod(begin, &end);
-      if (end != begin) {
-        tokens.push_back({TokenKind::Number,
-                          std::string(begin, static_cast<size_t>(end - begin)),
-                          value});
-        cursor += static_cast<size_t>(end - begin);
-        continue;
-      }
-    }
-
-    const size_t start = cursor;
-    while (cursor < text.size() &&
-           !std::isspace(static_cast<unsigned char>(text[cursor])) &&
-           !isSymbol(text[cursor]) && text[cursor] != '"' &&
-           text[cursor] != '#') {
-      ++cursor;
-    }
-    tokens.push_back({TokenKind::Identifier,
-                      std::string(text.substr(start, cursor - start)), 0.0});
-  }
-  tokens.push_back({TokenKind::End, {}, 0.0});
-  return tokens;
-}
-
 std::string lowerAscii(std::string value) {
   std::ranges::transform(value, value.begin(), [](unsigned char c) {
     return static_cast<char>(std::tolower(c));
@@ -436,8 +338,8 @@ dotbim::ModelUnitMetadata makeUnitMetadata(StageUnitMetadata stageUnits,
   return metadata;
 }
 
-std::string stageUpAxisFromText(std::string_view usdText) {
-  const std::vector<Token> tokens = tokenize(usdText);
+std::string stageUpAxisFromTokens(const TokenStream &stream) {
+  const std::vector<Token> &tokens = stream.tokens;
   int braceDepth = 0;
   for (size_t i = 0; i < tokens.size(); ++i) {
     const Token &token = tokens[i];
@@ -465,7 +367,7 @@ std::string stageUpAxisFromText(std::string_view usdText) {
       const Token &value = tokens[i + 2u];
       if (value.kind == TokenKind::String ||
           value.kind == TokenKind::Identifier) {
-        return value.text;
+        return std::string(value.text);
       }
     }
   }
@@ -480,8 +382,8 @@ void applySourceUpAxis(dotbim::Model& model, std::string upAxis) {
   model.georeferenceMetadata.sourceUpAxis = std::move(upAxis);
 }
 
-StageUnitMetadata stageMetersPerUnitFromText(std::string_view usdText) {
-  const std::vector<Token> tokens = tokenize(usdText);
+StageUnitMetadata stageMetersPerUnitFromTokens(const TokenStream &stream) {
+  const std::vector<Token> &tokens = stream.tokens;
   int braceDepth = 0;
   for (size_t i = 0; i < tokens.size(); ++i) {
     const Token &token = tokens[i];
@@ -629,7 +531,8 @@ std::vector<uint32_t> triangulateIndices(const MeshData &mesh,
 
 class UsdParser {
 public:
-  explicit UsdParser(std::string_view text) : tokens_(tokenize(text)) {}
+  explicit UsdParser(const TokenStream &stream)
+      : stream_(stream), tokens_(stream.tokens) {}
 
   std::vector<Node> parse() {
     parseBlock(-1);
@@ -678,6 +581,14 @@ private:
     collectValue([&](const Token &token) {
       if (token.kind == TokenKind::Number && std::isfinite(token.number)) {
         values.push_back(token.number);
+      } else if (token.kind == TokenKind::NumberArray) {
+        const std::span<const double> numbers = stream_.numbersOf(token);
+        values.reserve(values.size() + numbers.size());
+        for (const double number : numbers) {
+          if (std::isfinite(number)) {
+            values.push_back(number);
+          }
+        }
       }
     });
     return values;
@@ -688,7 +599,7 @@ private:
     collectValue([&](const Token &token) {
       if (token.kind == TokenKind::String ||
           token.kind == TokenKind::Identifier) {
-        values.push_back(token.text);
+        values.emplace_back(token.text);
       }
     });
     return values;
@@ -699,7 +610,7 @@ private:
     collectValue([&](const Token &token) {
       if (!result && (token.kind == TokenKind::String ||
                       token.kind == TokenKind::Identifier)) {
-        result = token.text;
+        result = std::string(token.text);
       }
     });
     return result;
@@ -890,9 +801,16 @@ private:
         return;
       if (token.kind == TokenKind::Number && std::isfinite(token.number)) {
         result = token.number != 0.0;
+      } else if (token.kind == TokenKind::NumberArray) {
+        for (const double number : stream_.numbersOf(token)) {
+          if (std::isfinite(number)) {
+            result = number != 0.0;
+            break;
+          }
+        }
       } else if (token.kind == TokenKind::Identifier ||
                  token.kind == TokenKind::String) {
-        const std::string value = lowerAscii(token.text);
+        const std::string value = lowerAscii(std::string(token.text));
         if (value == "true" || value == "1") {
           result = true;
         } else if (value == "false" || value == "0") {
@@ -908,7 +826,7 @@ private:
     for (size_t i = equal; i > start;) {
       --i;
       if (tokens_[i].kind == TokenKind::Identifier) {
-        return tokens_[i].text;
+        return std::string(tokens_[i].text);
       }
     }
     return std::nullopt;
@@ -957,14 +875,14 @@ private:
     ++position_;
     std::string typeName = "Prim";
     if (peek().kind == TokenKind::Identifier) {
-      typeName = peek().text;
+      typeName = std::string(peek().text);
       ++position_;
     }
 
     std::string name = typeName + std::to_string(nodes_.size());
     if (peek().kind == TokenKind::String ||
         peek().kind == TokenKind::Identifier) {
-      name = peek().text;
+      name = std::string(peek().text);
       ++position_;
     }
 
@@ -1018,7 +936,7 @@ private:
       }
 
       if (peek().kind == TokenKind::Identifier) {
-        key = peek().text;
+        key = std::string(peek().text);
         ++position_;
         continue;
       }
@@ -1028,13 +946,12 @@ private:
         ++position_;
         if (peek().kind == TokenKind::String ||
             peek().kind == TokenKind::Identifier) {
-          applyCommonMetadataValue(name, peek().text, node.guid,
-                                   node.semanticType, node.displayName,
-                                   &node.objectType, &node.storeyName,
-                                   &node.storeyId, &node.materialName,
-                                   &node.materialCategory, &node.discipline,
-                                   &node.phase, &node.fireRating,
-                                   &node.loadBearing, &node.status);
+          applyCommonMetadataValue(
+              name, std::string(peek().text), node.guid, node.semanticType,
+              node.displayName, &node.objectType, &node.storeyName,
+              &node.storeyId, &node.materialName, &node.materialCategory,
+              &node.discipline, &node.phase, &node.fireRating,
+              &node.loadBearing, &node.status);
         }
         key.reset();
         continue;
@@ -1158,7 +1075,8 @@ private:
     }
   }
 
-  std::vector<Token> tokens_{};
+  const TokenStream &stream_;
+  const std::vector<Token> &tokens_;
   size_t position_{0};
   std::vector<Node> nodes_{};
 };
@@ -3933,14 +3851,13 @@ dotbim::Model LoadWithTinyUsd(const std::filesystem::path &path,
 
 #endif
 
-std::vector<uint8_t> readBinaryFile(const std::filesystem::path &path) {
-  std::ifstream file(path, std::ios::binary);
-  if (!file) {
+container::util::MappedFile mapUsdFile(const std::filesystem::path &path) {
+  try {
+    return container::util::MappedFile(path);
+  } catch (const std::runtime_error &) {
     throw std::runtime_error("failed to open USD file: " +
                              container::util::pathToUtf8(path));
   }
-  return {std::istreambuf_iterator<char>(file),
-          std::istreambuf_iterator<char>()};
 }
 
 bool fileStartsWithUsdc(const std::filesystem::path &path) {
@@ -3954,18 +3871,16 @@ bool fileStartsWithUsdc(const std::filesystem::path &path) {
          std::string_view(magic, sizeof(magic)) == "PXR-USDC";
 }
 
-std::string readTextFile(const std::filesystem::path &path) {
-  const std::vector<uint8_t> bytes = readBinaryFile(path);
-  if (bytes.size() >= 8u &&
-      std::string_view(reinterpret_cast<const char *>(bytes.data()), 8u) ==
-          "PXR-USDC") {
+std::string_view usdTextLayer(const container::util::MappedFile &file) {
+  const std::string_view text = file.text();
+  if (text.starts_with("PXR-USDC")) {
     throw std::runtime_error(
         "binary USDC payloads are not supported by the lightweight USD loader");
   }
-  return {reinterpret_cast<const char *>(bytes.data()), bytes.size()};
+  return text;
 }
 
-uint16_t readLe16(const std::vector<uint8_t> &bytes, size_t offset) {
+uint16_t readLe16(std::span<const uint8_t> bytes, size_t offset) {
   if (offset + 2u > bytes.size()) {
     throw std::runtime_error("truncated USDZ archive");
   }
@@ -3973,7 +3888,7 @@ uint16_t readLe16(const std::vector<uint8_t> &bytes, size_t offset) {
          (static_cast<uint16_t>(bytes[offset + 1u]) << 8u);
 }
 
-uint32_t readLe32(const std::vector<uint8_t> &bytes, size_t offset) {
+uint32_t readLe32(std::span<const uint8_t> bytes, size_t offset) {
   if (offset + 4u > bytes.size()) {
     throw std::runtime_error("truncated USDZ archive");
   }
@@ -3989,8 +3904,8 @@ bool hasUsdTextExtension(std::string_view name) {
   return extension == ".usd" || extension == ".usda";
 }
 
-std::string extractFirstUsdTextFromUsdz(const std::filesystem::path &path) {
-  const std::vector<uint8_t> bytes = readBinaryFile(path);
+// Stored (uncompressed) entries are returned as views into `bytes`.
+std::string_view firstUsdTextInUsdz(std::span<const uint8_t> bytes) {
   if (bytes.size() < 22u) {
     throw std::runtime_error("USDZ archive is too small");
   }
@@ -4073,13 +3988,14 @@ std::string extractFirstUsdTextFromUsdz(const std::filesystem::path &path) {
 } // namespace
 
 dotbim::Model LoadFromText(std::string_view usdText, float importScale) {
-  UsdParser parser(usdText);
+  const TokenStream tokens = tokenize(usdText);
+  UsdParser parser(tokens);
   const std::vector<Node> nodes = parser.parse();
 
   dotbim::Model model{};
-  const StageUnitMetadata stageUnits = stageMetersPerUnitFromText(usdText);
+  const StageUnitMetadata stageUnits = stageMetersPerUnitFromTokens(tokens);
   model.unitMetadata = makeUnitMetadata(stageUnits, importScale);
-  const std::string sourceUpAxis = stageUpAxisFromText(usdText);
+  const std::string sourceUpAxis = stageUpAxisFromTokens(tokens);
   applySourceUpAxis(model, sourceUpAxis);
   std::vector<std::optional<glm::mat4>> transformCache(nodes.size());
   const float unitScale =
@@ -4192,10 +4108,11 @@ dotbim::Model LoadFromFile(const std::filesystem::path &path,
     }
 
     try {
+      const container::util::MappedFile file = mapUsdFile(path);
       if (extension == ".usdz") {
-        return LoadFromText(extractFirstUsdTextFromUsdz(path), importScale);
+        return LoadFromText(firstUsdTextInUsdz(file.bytes()), importScale);
       }
-      return LoadFromText(readTextFile(path), importScale);
+      return LoadFromText(usdTextLayer(file), importScale);
     } catch (const std::exception &fallbackError) {
       throw std::runtime_error(
           std::string(tinyUsdError.what()) +
@@ -4203,15 +4120,24 @@ dotbim::Model LoadFromFile(const std::filesystem::path &path,
     }
   }
 #else
-  if (extension == ".usdz") {
-    return LoadFromText(extractFirstUsdTextFromUsdz(path), importScale);
-  }
   if (extension == ".usdc") {
     throw std::runtime_error(
         "binary .usdc files are not supported by the lightweight USD loader");
   }
-  return LoadFromText(readTextFile(path), importScale);
+  const container::util::MappedFile file = mapUsdFile(path);
+  if (extension == ".usdz") {
+    return LoadFromText(firstUsdTextInUsdz(file.bytes()), importScale);
+  }
+  return LoadFromText(usdTextLayer(file), importScale);
 #endif
 }
 
+dotbim::Model LoadFromFile(const std::filesystem::path &path,
+                           float importScale,
+                           const MeshOptimizationOptions &meshOptimization) {
+  dotbim::Model model = LoadFromFile(path, importScale);
+  optimizeModelGeometry(model, meshOptimization);
+  return model;
+}
+
 } // namespace container::geometry::usd
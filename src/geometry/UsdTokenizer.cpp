@@ -0,0 +1,211 @@
+#include "Container/geometry/UsdTokenizer.h"
+
+#include <cctype>
+#include <charconv>
+#include <cstdlib>
+#include <system_error>
+#include <utility>
+
+namespace container::geometry::usd {
+namespace {
+
+bool isSpace(char c) { return std::isspace(static_cast<unsigned char>(c)); }
+
+bool isDigit(char c) { return std::isdigit(static_cast<unsigned char>(c)); }
+
+bool isSymbol(char c) {
+  switch (c) {
+  case '{':
+  case '}':
+  case '[':
+  case ']':
+  case '(':
+  case ')':
+  case ',':
+  case '=':
+  case ';':
+    return true;
+  default:
+    return false;
+  }
+}
+
+bool isNumberStart(std::string_view text, size_t offset) {
+  const char c = text[offset];
+  if (isDigit(c)) {
+    return true;
+  }
+  if ((c == '+' || c == '-' || c == '.') && offset + 1u < text.size()) {
+    return isDigit(text[offset + 1u]);
+  }
+  return false;
+}
+
+// Every character strtod can consume in a decimal or hexadecimal float.
+bool isFloatCharacter(char c) {
+  return std::isxdigit(static_cast<unsigned char>(c)) || c == 'x' ||
+         c == 'X' || c == 'p' || c == 'P' || c == '.' || c == '+' ||
+         c == '-';
+}
+
+// strtod needs a NUL-terminated copy; only hex floats and out-of-range values
+// take this path.
+size_t parseNumberWithStrtod(std::string_view text, size_t offset,
+                             double &value) {
+  size_t last = offset;
+  while (last < text.size() && isFloatCharacter(text[last])) {
+    ++last;
+  }
+  const std::string copy(text.substr(offset, last - offset));
+  char *end = nullptr;
+  value = std::strtod(copy.c_str(), &end);
+  return static_cast<size_t>(end - copy.c_str());
+}
+
+// Returns the number of characters consumed; 0 when there is no number.
+size_t parseNumber(std::string_view text, size_t offset, double &value) {
+  const char *begin = text.data() + offset;
+  const char *end = text.data() + text.size();
+  // from_chars rejects the leading '+' strtod accepts.
+  const char *first = *begin == '+' ? begin + 1 : begin;
+  const char *digits = *first == '-' ? first + 1 : first;
+  const bool hex = end - digits >= 2 && digits[0] == '0' &&
+                   (digits[1] == 'x' || digits[1] == 'X');
+  if (!hex) {
+    const auto [last, error] = std::from_chars(first, end, value);
+    if (error == std::errc()) {
+      return static_cast<size_t>(last - begin);
+    }
+  }
+  return parseNumberWithStrtod(text, offset, value);
+}
+
+bool endsArrayNumber(char c) {
+  return c == ',' || c == ')' || c == '(' || c == ']' || isSpace(c);
+}
+
+// Bulk-parses the array literal opened at `open` when it contains only
+// numbers, commas, parentheses and whitespace. Returns the offset of its `]`,
+// or npos with `numbers` left unchanged.
+size_t parseNumberArray(std::string_view text, size_t open,
+                        std::vector<double> &numbers) {
+  const size_t firstNumber = numbers.size();
+  size_t cursor = open + 1u;
+  while (cursor < text.size()) {
+    const char c = text[cursor];
+    if (c == ']') {
+      if (numbers.size() > firstNumber) {
+        return cursor;
+      }
+      break;
+    }
+    if (c == ',' || c == '(' || c == ')' || isSpace(c)) {
+      ++cursor;
+      continue;
+    }
+    if (!isNumberStart(text, cursor)) {
+      break;
+    }
+    double value = 0.0;
+    cursor += parseNumber(text, cursor, value);
+    numbers.push_back(value);
+    if (cursor < text.size() && !endsArrayNumber(text[cursor])) {
+      break;
+    }
+  }
+  numbers.resize(firstNumber);
+  return std::string_view::npos;
+}
+
+} // namespace
+
+TokenStream tokenize(std::string_view text, TokenizeOptions options) {
+  TokenStream stream;
+  std::vector<Token> &tokens = stream.tokens;
+  size_t cursor = 0;
+  while (cursor < text.size()) {
+    const char c = text[cursor];
+    if (isSpace(c)) {
+      ++cursor;
+      continue;
+    }
+    if (c == '#') {
+      while (cursor < text.size() && text[cursor] != '\n') {
+        ++cursor;
+      }
+      continue;
+    }
+    if (c == '"') {
+      const size_t start = ++cursor;
+      while (cursor < text.size() && text[cursor] != '"' &&
+             text[cursor] != '\\') {
+        ++cursor;
+      }
+      if (cursor == text.size() || text[cursor] == '"') {
+        tokens.push_back(
+            {TokenKind::String, text.substr(start, cursor - start), 0.0});
+        cursor += cursor < text.size() ? 1u : 0u;
+        continue;
+      }
+
+      std::string value(text.substr(start, cursor - start));
+      while (cursor < text.size()) {
+        const char current = text[cursor++];
+        if (current == '"') {
+          break;
+        }
+        if (current == '\\' && cursor < text.size()) {
+          value.push_back(text[cursor++]);
+        } else {
+          value.push_back(current);
+        }
+      }
+      tokens.push_back({TokenKind::String,
+                        stream.unescapedStrings.emplace_back(std::move(value)),
+                        0.0});
+      continue;
+    }
+    if (isSymbol(c)) {
+      tokens.push_back({TokenKind::Symbol, text.substr(cursor, 1u), 0.0});
+      if (c == '[' && options.bulkNumberArrays) {
+        const size_t firstNumber = stream.numbers.size();
+        const size_t close =
+            parseNumberArray(text, cursor, stream.numbers);
+        if (close != std::string_view::npos) {
+          tokens.push_back({TokenKind::NumberArray,
+                            text.substr(cursor + 1u, close - cursor - 1u),
+                            0.0, firstNumber,
+                            stream.numbers.size() - firstNumber});
+          tokens.push_back({TokenKind::Symbol, text.substr(close, 1u), 0.0});
+          cursor = close + 1u;
+          continue;
+        }
+      }
+      ++cursor;
+      continue;
+    }
+    if (isNumberStart(text, cursor)) {
+      double value = 0.0;
+      if (const size_t length = parseNumber(text, cursor, value);
+          length > 0u) {
+        tokens.push_back(
+            {TokenKind::Number, text.substr(cursor, length), value});
+        cursor += length;
+        continue;
+      }
+    }
+
+    const size_t start = cursor;
+    while (cursor < text.size() && !isSpace(text[cursor]) &&
+           !isSymbol(text[cursor]) && text[cursor] != '"' &&
+           text[cursor] != '#') {
+      ++cursor;
+    }
+    tokens.push_back(
+        {TokenKind::Identifier, text.substr(start, cursor - start), 0.0});
+  }
+  tokens.push_back({TokenKind::End, {}, 0.0});
+  return stream;
+}
+
+} // namespace container::geometry::usd
@@ -10,7 +10,7 @@ namespace {
   return commands != nullptr && !commands->empty();
 }
 
-void appendSource(std::vector<BimDrawCompactionPlanSource> &plan,
+void appendSource(std::pmr::vector<BimDrawCompactionPlanSource> &plan,
                   BimDrawCompactionSlot slot,
                   const std::vector<DrawCommand> *commands) {
   if (hasDrawCommands(commands)) {
@@ -31,9 +31,9 @@ BimDrawCompactionPlanner::BimDrawCompactionPlanner(
     BimDrawCompactionPlanInputs inputs)
     : inputs_(inputs) {}
 
-std::vector<BimDrawCompactionPlanSource>
-BimDrawCompactionPlanner::build() const {
-  std::vector<BimDrawCompactionPlanSource> plan;
+std::pmr::vector<BimDrawCompactionPlanSource>
+BimDrawCompactionPlanner::build(std::pmr::memory_resource *resource) const {
+  std::pmr::vector<BimDrawCompactionPlanSource> plan(resource);
   plan.reserve(kBimDrawCompactionSlotCount);
 
   appendSource(plan, BimDrawCompactionSlot::OpaqueSingleSided,
@@ -84,9 +84,10 @@ makeBimDrawCompactionPlanInputs(const BimManager &bimManager) {
   };
 }
 
-std::vector<BimDrawCompactionPlanSource>
-buildBimDrawCompactionPlan(const BimDrawCompactionPlanInputs &inputs) {
-  return BimDrawCompactionPlanner(inputs).build();
+std::pmr::vector<BimDrawCompactionPlanSource>
+buildBimDrawCompactionPlan(const BimDrawCompactionPlanInputs &inputs,
+                           std::pmr::memory_resource *resource) {
+  return BimDrawCompactionPlanner(inputs).build(resource);
 }
 
 } // namespace container::renderer
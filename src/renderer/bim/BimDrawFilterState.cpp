@@ -9,17 +9,22 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 
 namespace container::renderer {
 namespace {
 
-[[nodiscard]] const BimElementMetadata *
-metadataForObject(std::span<const BimElementMetadata> metadata,
+[[nodiscard]] size_t metadataCount(const BimDrawFilterStateInputs &inputs) {
+  return inputs.metadata != nullptr ? inputs.metadata->size() : 0u;
+}
+
+[[nodiscard]] BimElementMetadataView
+metadataForObject(const BimDrawFilterStateInputs &inputs,
                   uint32_t objectIndex) {
-  if (objectIndex >= metadata.size()) {
-    return nullptr;
+  if (objectIndex >= metadataCount(inputs)) {
+    return {};
   }
-  return &metadata[objectIndex];
+  return (*inputs.metadata)[objectIndex];
 }
 
 [[nodiscard]] std::string lowerAscii(std::string_view value) {
@@ -76,11 +81,11 @@ metadataForObject(std::span<const BimElementMetadata> metadata,
          containsBoundedToken(lowered, "hvac");
 }
 
-[[nodiscard]] bool containsAnyMepToken(const BimElementMetadata &metadata) {
+[[nodiscard]] bool containsAnyMepToken(BimElementMetadataView metadata) {
   const std::array<std::string_view, 3u> values{{
-      metadata.type,
-      metadata.objectType,
-      metadata.discipline,
+      metadata.type(),
+      metadata.objectType(),
+      metadata.discipline(),
   }};
   for (std::string_view value : values) {
     if (containsMepClassificationToken(value)) {
@@ -90,8 +95,9 @@ metadataForObject(std::span<const BimElementMetadata> metadata,
   return false;
 }
 
-[[nodiscard]] bool metadataMatchesDisciplinePreset(
-    const BimElementMetadata &metadata, BimDisciplinePreset preset) {
+[[nodiscard]] bool
+metadataMatchesDisciplinePreset(BimElementMetadataView metadata,
+                                BimDisciplinePreset preset) {
   switch (preset) {
   case BimDisciplinePreset::None:
     return true;
@@ -103,9 +109,9 @@ metadataForObject(std::span<const BimElementMetadata> metadata,
   return true;
 }
 
-[[nodiscard]] bool phaseIsDemolished(const BimElementMetadata &metadata) {
-  return containsToken(metadata.status, "demolish") ||
-         containsToken(metadata.phase, "demolish");
+[[nodiscard]] bool phaseIsDemolished(BimElementMetadataView metadata) {
+  return containsToken(metadata.status(), "demolish") ||
+         containsToken(metadata.phase(), "demolish");
 }
 
 [[nodiscard]] std::optional<size_t>
@@ -122,7 +128,7 @@ phaseIndex(std::span<const std::string> phaseOrder,
 }
 
 [[nodiscard]] bool metadataMatchesPhaseTimeline(
-    const BimElementMetadata &metadata, const BimDrawFilter &filter,
+    BimElementMetadataView metadata, const BimDrawFilter &filter,
     const BimDrawFilterStateInputs &inputs) {
   if (!filter.phaseTimelineEnabled) {
     return true;
@@ -130,7 +136,7 @@ phaseIndex(std::span<const std::string> phaseOrder,
   if (phaseIsDemolished(metadata)) {
     return filter.phaseTimelineShowDemolished;
   }
-  const auto currentPhase = phaseIndex(inputs.phaseOrder, metadata.phase);
+  const auto currentPhase = phaseIndex(inputs.phaseOrder, metadata.phase());
   if (!currentPhase) {
     return true;
   }
@@ -148,26 +154,98 @@ phaseIndex(std::span<const std::string> phaseOrder,
   return filter.phaseTimelineGhostFuture;
 }
 
+[[nodiscard]] std::string_view
+categoryLabel(BimElementMetadataView metadata,
+              BimMetadataSemanticCategory category) {
+  switch (category) {
+  case BimMetadataSemanticCategory::Type:
+    return metadata.type();
+  case BimMetadataSemanticCategory::Storey:
+    return bimMetadataStoreyLabel(metadata);
+  case BimMetadataSemanticCategory::Material:
+    return bimMetadataMaterialLabel(metadata);
+  case BimMetadataSemanticCategory::Discipline:
+    return metadata.discipline();
+  case BimMetadataSemanticCategory::Phase:
+    return metadata.phase();
+  case BimMetadataSemanticCategory::FireRating:
+    return metadata.fireRating();
+  case BimMetadataSemanticCategory::LoadBearing:
+    return metadata.loadBearing();
+  case BimMetadataSemanticCategory::Status:
+    return metadata.status();
+  }
+  return {};
+}
+
+struct BimLabelFilter {
+  BimMetadataSemanticCategory category{BimMetadataSemanticCategory::Type};
+  bool enabled{false};
+  const std::string *label{nullptr};
+};
+
+[[nodiscard]] std::array<BimLabelFilter, kBimMetadataSemanticCategoryCount>
+labelFilters(const BimDrawFilter &filter) {
+  return {{
+      {BimMetadataSemanticCategory::Type, filter.typeFilterEnabled,
+       &filter.type},
+      {BimMetadataSemanticCategory::Storey, filter.storeyFilterEnabled,
+       &filter.storey},
+      {BimMetadataSemanticCategory::Material, filter.materialFilterEnabled,
+       &filter.material},
+      {BimMetadataSemanticCategory::Discipline, filter.disciplineFilterEnabled,
+       &filter.discipline},
+      {BimMetadataSemanticCategory::Phase, filter.phaseFilterEnabled,
+       &filter.phase},
+      {BimMetadataSemanticCategory::FireRating, filter.fireRatingFilterEnabled,
+       &filter.fireRating},
+      {BimMetadataSemanticCategory::LoadBearing,
+       filter.loadBearingFilterEnabled, &filter.loadBearing},
+      {BimMetadataSemanticCategory::Status, filter.statusFilterEnabled,
+       &filter.status},
+  }};
+}
+
+[[nodiscard]] size_t categorySlot(BimMetadataSemanticCategory category) {
+  return static_cast<size_t>(category);
+}
+
+void registerCatalogLabels(BimMetadataCatalog &catalog,
+                           BimElementMetadataView metadata) {
+  (void)catalog.registerType(std::string(metadata.type()));
+  catalog.registerStorey(metadata, BimElementBounds{});
+  catalog.registerMaterial(metadata);
+  catalog.registerDiscipline(std::string(metadata.discipline()));
+  catalog.registerPhase(std::string(metadata.phase()));
+  catalog.registerFireRating(std::string(metadata.fireRating()));
+  catalog.registerLoadBearing(std::string(metadata.loadBearing()));
+  catalog.registerStatus(std::string(metadata.status()));
+}
+
+[[nodiscard]] const BimObjectBitmap &emptyBitmap() {
+  static const BimObjectBitmap empty{};
+  return empty;
+}
+
 [[nodiscard]] bool
-metadataMatchesFilter(uint32_t objectIndex, const BimElementMetadata &metadata,
+metadataMatchesFilter(uint32_t objectIndex, BimElementMetadataView metadata,
                       const BimDrawFilter &filter,
-                      const BimElementMetadata *selectedMetadata,
+                      BimElementMetadataView selectedMetadata,
                       const BimDrawFilterStateInputs &inputs) {
   const bool hasSelectedFilter =
       filter.selectedObjectIndex != std::numeric_limits<uint32_t>::max();
   if (filter.isolateSelection && hasSelectedFilter) {
-    if (selectedMetadata == nullptr ||
-        !sameBimProductIdentity(*selectedMetadata, metadata)) {
+    if (!selectedMetadata ||
+        !sameBimProductIdentity(selectedMetadata, metadata)) {
       return false;
     }
   }
-  if (filter.hideSelection && hasSelectedFilter &&
-      selectedMetadata != nullptr &&
-      sameBimProductIdentity(*selectedMetadata, metadata)) {
+  if (filter.hideSelection && hasSelectedFilter && selectedMetadata &&
+      sameBimProductIdentity(selectedMetadata, metadata)) {
     return false;
   }
   if (filter.typeFilterEnabled && !filter.type.empty() &&
-      metadata.type != filter.type) {
+      metadata.type() != filter.type) {
     return false;
   }
   if (filter.storeyFilterEnabled && !filter.storey.empty() &&
@@ -179,23 +257,23 @@ metadataMatchesFilter(uint32_t objectIndex, const BimElementMetadata &metadata,
     return false;
   }
   if (filter.disciplineFilterEnabled && !filter.discipline.empty() &&
-      metadata.discipline != filter.discipline) {
+      metadata.discipline() != filter.discipline) {
     return false;
   }
   if (filter.phaseFilterEnabled && !filter.phase.empty() &&
-      metadata.phase != filter.phase) {
+      metadata.phase() != filter.phase) {
     return false;
   }
   if (filter.fireRatingFilterEnabled && !filter.fireRating.empty() &&
-      metadata.fireRating != filter.fireRating) {
+      metadata.fireRating() != filter.fireRating) {
     return false;
   }
   if (filter.loadBearingFilterEnabled && !filter.loadBearing.empty() &&
-      metadata.loadBearing != filter.loadBearing) {
+      metadata.loadBearing() != filter.loadBearing) {
     return false;
   }
   if (filter.statusFilterEnabled && !filter.status.empty() &&
-      metadata.status != filter.status) {
+      metadata.status() != filter.status) {
     return false;
   }
   if (!metadataMatchesDisciplinePreset(metadata, filter.disciplinePreset)) {
@@ -290,6 +368,27 @@ void BimDrawFilterState::clear() {
   filteredDrawLists_.clear();
   cachedFilter_ = {};
   cachedRevision_ = std::numeric_limits<uint64_t>::max();
+  visibleObjects_.clear();
+  cachedVisibleFilter_ = {};
+  cachedVisibleRevision_ = std::numeric_limits<uint64_t>::max();
+  indexRevision_ = std::numeric_limits<uint64_t>::max();
+  indexedMetadata_ = nullptr;
+  indexedMetadataCount_ = 0;
+  indexedPhaseCount_ = 0;
+  indexUsesLocalCatalog_ = false;
+  localCatalog_.clearLabels();
+  for (std::vector<BimObjectBitmap> &objects : objectsByLabelId_) {
+    objects.clear();
+  }
+  indexedObjects_.clear();
+  mepObjects_.clear();
+  demolishedObjects_.clear();
+  unphasedObjects_.clear();
+  objectsByPhaseIndex_.clear();
+  emptyGuidObjects_.clear();
+  objectsByGuid_.clear();
+  objectsBySourceId_.clear();
+  relocatedObjectIndices_.clear();
 }
 
 bool BimDrawFilterState::objectMatchesFilter(
@@ -299,20 +398,308 @@ bool BimDrawFilterState::objectMatchesFilter(
     return objectIndex < inputs.objectCount;
   }
 
-  const BimElementMetadata *metadata =
-      metadataForObject(inputs.metadata, objectIndex);
-  if (metadata == nullptr) {
+  const BimElementMetadataView metadata =
+      metadataForObject(inputs, objectIndex);
+  if (!metadata) {
     return false;
   }
 
-  const BimElementMetadata *selectedMetadata = nullptr;
+  BimElementMetadataView selectedMetadata;
   if ((filter.isolateSelection || filter.hideSelection) &&
       filter.selectedObjectIndex != std::numeric_limits<uint32_t>::max()) {
-    selectedMetadata =
-        metadataForObject(inputs.metadata, filter.selectedObjectIndex);
+    selectedMetadata = metadataForObject(inputs, filter.selectedObjectIndex);
+  }
+  return metadataMatchesFilter(objectIndex, metadata, filter, selectedMetadata,
+                               inputs);
+}
+
+const BimObjectBitmap &
+BimDrawFilterState::visibleObjects(const BimDrawFilter &filter,
+                                   const BimDrawFilterStateInputs &inputs) {
+  if (!indexCurrent(inputs)) {
+    rebuildIndex(inputs);
+    cachedVisibleRevision_ = std::numeric_limits<uint64_t>::max();
+  }
+  if (cachedVisibleRevision_ == inputs.revision &&
+      bimDrawFiltersEqual(cachedVisibleFilter_, filter)) {
+    return visibleObjects_;
+  }
+  visibleObjects_ = evaluate(filter, inputs);
+  cachedVisibleFilter_ = filter;
+  cachedVisibleRevision_ = inputs.revision;
+  return visibleObjects_;
+}
+
+size_t BimDrawFilterState::indexMemoryBytes() const {
+  size_t bytes = indexedObjects_.memoryBytes() + mepObjects_.memoryBytes() +
+                 demolishedObjects_.memoryBytes() +
+                 unphasedObjects_.memoryBytes() +
+                 emptyGuidObjects_.memoryBytes();
+  for (const std::vector<BimObjectBitmap> &objects : objectsByLabelId_) {
+    for (const BimObjectBitmap &bitmap : objects) {
+      bytes += bitmap.memoryBytes();
+    }
+  }
+  for (const BimObjectBitmap &bitmap : objectsByPhaseIndex_) {
+    bytes += bitmap.memoryBytes();
+  }
+  return bytes;
+}
+
+bool BimDrawFilterState::indexCurrent(
+    const BimDrawFilterStateInputs &inputs) const {
+  return indexRevision_ == inputs.revision &&
+         indexedMetadata_ == inputs.metadata &&
+         indexedMetadataCount_ == metadataCount(inputs) &&
+         indexedPhaseCount_ == inputs.phaseOrder.size();
+}
+
+void BimDrawFilterState::rebuildIndex(const BimDrawFilterStateInputs &inputs) {
+  indexRevision_ = inputs.revision;
+  indexedMetadata_ = inputs.metadata;
+  indexedMetadataCount_ = metadataCount(inputs);
+  indexedPhaseCount_ = inputs.phaseOrder.size();
+  indexedObjects_.clear();
+  mepObjects_.clear();
+  demolishedObjects_.clear();
+  unphasedObjects_.clear();
+  objectsByPhaseIndex_.assign(inputs.phaseOrder.size(), BimObjectBitmap{});
+  emptyGuidObjects_.clear();
+  objectsByGuid_.clear();
+  objectsBySourceId_.clear();
+  relocatedObjectIndices_.clear();
+
+  std::unordered_map<std::string_view, size_t> phaseIndices;
+  phaseIndices.reserve(inputs.phaseOrder.size());
+  for (size_t index = 0; index < inputs.phaseOrder.size(); ++index) {
+    phaseIndices.try_emplace(inputs.phaseOrder[index], index);
+  }
+
+  // Object indices are rows in the metadata store; the last uint32 value
+  // is the invalid-object sentinel and never matches a filter.
+  const size_t objectCount =
+      std::min(metadataCount(inputs),
+               static_cast<size_t>(std::numeric_limits<uint32_t>::max()));
+  for (size_t position = 0; position < objectCount; ++position) {
+    const BimElementMetadataView metadata = (*inputs.metadata)[position];
+    const uint32_t objectIndex = static_cast<uint32_t>(position);
+    indexedObjects_.add(objectIndex);
+    if (containsAnyMepToken(metadata)) {
+      mepObjects_.add(objectIndex);
+    }
+    if (phaseIsDemolished(metadata)) {
+      demolishedObjects_.add(objectIndex);
+    } else if (const auto phase = metadata.phase().empty()
+                                      ? phaseIndices.end()
+                                      : phaseIndices.find(metadata.phase());
+               phase != phaseIndices.end()) {
+      objectsByPhaseIndex_[phase->second].add(objectIndex);
+    } else {
+      unphasedObjects_.add(objectIndex);
+    }
+    if (metadata.guid().empty()) {
+      emptyGuidObjects_.add(objectIndex);
+    } else {
+      objectsByGuid_[std::string(metadata.guid())].push_back(objectIndex);
+    }
+    if (!metadata.sourceId().empty()) {
+      objectsBySourceId_[std::string(metadata.sourceId())].push_back(
+          objectIndex);
+    }
+    if (metadata.objectIndex() != objectIndex &&
+        metadata.objectIndex() != std::numeric_limits<uint32_t>::max()) {
+      relocatedObjectIndices_.emplace_back(metadata.objectIndex(), objectIndex);
+    }
   }
-  return metadataMatchesFilter(objectIndex, *metadata, filter,
-                               selectedMetadata, inputs);
+
+  indexUsesLocalCatalog_ = false;
+  if (inputs.catalog != nullptr && indexLabels(inputs, *inputs.catalog)) {
+    return;
+  }
+  // The shared catalog is missing or stale for this metadata; register the
+  // labels locally so every categorical value still gets a bitmap.
+  localCatalog_.clearLabels();
+  for (size_t position = 0; position < objectCount; ++position) {
+    registerCatalogLabels(localCatalog_, (*inputs.metadata)[position]);
+  }
+  indexUsesLocalCatalog_ = true;
+  (void)indexLabels(inputs, localCatalog_);
+}
+
+bool BimDrawFilterState::indexLabels(const BimDrawFilterStateInputs &inputs,
+                                     const BimMetadataCatalog &catalog) {
+  const std::array<BimLabelFilter, kBimMetadataSemanticCategoryCount>
+      categories = labelFilters(BimDrawFilter{});
+  for (const BimLabelFilter &category : categories) {
+    objectsByLabelId_[categorySlot(category.category)].assign(
+        catalog.labelCountForCategory(category.category), BimObjectBitmap{});
+  }
+
+  const size_t objectCount =
+      std::min(metadataCount(inputs),
+               static_cast<size_t>(std::numeric_limits<uint32_t>::max()));
+  for (size_t position = 0; position < objectCount; ++position) {
+    const BimElementMetadataView metadata = (*inputs.metadata)[position];
+    for (const BimLabelFilter &category : categories) {
+      const std::string_view label = categoryLabel(metadata, category.category);
+      if (label.empty()) {
+        continue;
+      }
+      std::vector<BimObjectBitmap> &objects =
+          objectsByLabelId_[categorySlot(category.category)];
+      const uint32_t labelId =
+          catalog.labelIdForCategory(category.category, label);
+      if (labelId >= objects.size()) {
+        return false;
+      }
+      objects[labelId].add(static_cast<uint32_t>(position));
+    }
+  }
+  return true;
+}
+
+const BimMetadataCatalog &BimDrawFilterState::indexCatalog(
+    const BimDrawFilterStateInputs &inputs) const {
+  if (indexUsesLocalCatalog_ || inputs.catalog == nullptr) {
+    return localCatalog_;
+  }
+  return *inputs.catalog;
+}
+
+const BimObjectBitmap &
+BimDrawFilterState::labelObjects(BimMetadataSemanticCategory category,
+                                 std::string_view label,
+                                 const BimDrawFilterStateInputs &inputs) const {
+  const std::vector<BimObjectBitmap> &objects =
+      objectsByLabelId_[categorySlot(category)];
+  const uint32_t labelId =
+      indexCatalog(inputs).labelIdForCategory(category, label);
+  if (labelId >= objects.size()) {
+    return emptyBitmap();
+  }
+  return objects[labelId];
+}
+
+BimObjectBitmap BimDrawFilterState::productIdentityObjects(
+    BimElementMetadataView selected,
+    const BimDrawFilterStateInputs &inputs) const {
+  // Mirrors sameBimProductIdentity(): object index, then GUID when both sides
+  // have one, then source id.
+  BimObjectBitmap objects;
+  constexpr uint32_t invalidObjectIndex = std::numeric_limits<uint32_t>::max();
+  if (selected.objectIndex() != invalidObjectIndex) {
+    if (selected.objectIndex() < metadataCount(inputs) &&
+        (*inputs.metadata)[selected.objectIndex()].objectIndex() ==
+            selected.objectIndex()) {
+      objects.add(selected.objectIndex());
+    }
+    for (const auto &[storedIndex, position] : relocatedObjectIndices_) {
+      if (storedIndex == selected.objectIndex()) {
+        objects.add(position);
+      }
+    }
+  }
+
+  const auto sourceIdIt = selected.sourceId().empty()
+                              ? objectsBySourceId_.end()
+                              : objectsBySourceId_.find(selected.sourceId());
+  if (!selected.guid().empty()) {
+    if (const auto guidIt = objectsByGuid_.find(selected.guid());
+        guidIt != objectsByGuid_.end()) {
+      objects |= BimObjectBitmap::fromIndices(guidIt->second);
+    }
+    if (sourceIdIt != objectsBySourceId_.end()) {
+      objects |= BimObjectBitmap::fromIndices(sourceIdIt->second) &
+                 emptyGuidObjects_;
+    }
+  } else if (sourceIdIt != objectsBySourceId_.end()) {
+    objects |= BimObjectBitmap::fromIndices(sourceIdIt->second);
+  }
+  return objects;
+}
+
+BimObjectBitmap BimDrawFilterState::phaseTimelineObjects(
+    const BimDrawFilter &filter, const BimDrawFilterStateInputs &inputs) const {
+  BimObjectBitmap objects = unphasedObjects_;
+  if (filter.phaseTimelineShowDemolished) {
+    objects |= demolishedObjects_;
+  }
+  const size_t activePhaseIndex =
+      inputs.phaseOrder.empty()
+          ? static_cast<size_t>(filter.phaseTimelineActiveIndex)
+          : std::min(static_cast<size_t>(filter.phaseTimelineActiveIndex),
+                     inputs.phaseOrder.size() - 1u);
+  for (size_t phase = 0; phase < objectsByPhaseIndex_.size(); ++phase) {
+    bool visible = filter.phaseTimelineGhostFuture;
+    if (phase < activePhaseIndex) {
+      visible = filter.phaseTimelineShowExisting;
+    } else if (phase == activePhaseIndex) {
+      visible = filter.phaseTimelineShowNew;
+    }
+    if (visible) {
+      objects |= objectsByPhaseIndex_[phase];
+    }
+  }
+  return objects;
+}
+
+BimObjectBitmap
+BimDrawFilterState::evaluate(const BimDrawFilter &filter,
+                             const BimDrawFilterStateInputs &inputs) const {
+  BimObjectBitmap visible = indexedObjects_;
+  if (!filter.active()) {
+    return visible;
+  }
+
+  const bool hasSelectedFilter =
+      filter.selectedObjectIndex != std::numeric_limits<uint32_t>::max();
+  BimElementMetadataView selectedMetadata;
+  if ((filter.isolateSelection || filter.hideSelection) && hasSelectedFilter) {
+    selectedMetadata = metadataForObject(inputs, filter.selectedObjectIndex);
+  }
+  if (filter.isolateSelection && hasSelectedFilter) {
+    if (!selectedMetadata) {
+      return {};
+    }
+    visible &= productIdentityObjects(selectedMetadata, inputs);
+  }
+  if (filter.hideSelection && hasSelectedFilter && selectedMetadata) {
+    visible -= productIdentityObjects(selectedMetadata, inputs);
+  }
+
+  for (const BimLabelFilter &labelFilter : labelFilters(filter)) {
+    if (labelFilter.enabled && !labelFilter.label->empty()) {
+      visible &= labelObjects(labelFilter.category, *labelFilter.label, inputs);
+    }
+  }
+
+  switch (filter.disciplinePreset) {
+  case BimDisciplinePreset::None:
+    break;
+  case BimDisciplinePreset::Architecture:
+    visible -= mepObjects_;
+    break;
+  case BimDisciplinePreset::MepXray:
+    visible &= mepObjects_;
+    break;
+  }
+
+  if (filter.phaseTimelineEnabled) {
+    visible &= phaseTimelineObjects(filter, inputs);
+  }
+
+  if (filter.drawBudgetEnabled && filter.drawBudgetMaxObjects > 0u) {
+    // Clamped so a large budget does not build a bitmap past the model.
+    const auto objectCount = static_cast<uint32_t>(std::min<size_t>(
+        inputs.objectCount, std::numeric_limits<uint32_t>::max()));
+    BimObjectBitmap budget = BimObjectBitmap::range(
+        0u, std::min(filter.drawBudgetMaxObjects, objectCount));
+    if (hasSelectedFilter) {
+      budget.add(filter.selectedObjectIndex);
+    }
+    visible &= budget;
+  }
+  return visible;
 }
 
 const BimDrawLists &
@@ -327,12 +714,7 @@ BimDrawFilterState::filteredDrawLists(const BimDrawFilter &filter,
   cachedFilter_ = filter;
   cachedRevision_ = inputs.revision;
 
-  const BimElementMetadata *selectedMetadata = nullptr;
-  if ((filter.isolateSelection || filter.hideSelection) &&
-      filter.selectedObjectIndex != std::numeric_limits<uint32_t>::max()) {
-    selectedMetadata =
-        metadataForObject(inputs.metadata, filter.selectedObjectIndex);
-  }
+  const BimObjectBitmap &visible = visibleObjects(filter, inputs);
 
   reserveLike(filteredDrawLists_.opaqueDrawCommands, inputs.opaqueDrawCommands);
   reserveLike(filteredDrawLists_.opaqueSingleSidedDrawCommands,
@@ -368,11 +750,7 @@ BimDrawFilterState::filteredDrawLists(const BimDrawFilter &filter,
           break;
         }
         const uint32_t objectIndex = command.objectIndex + instanceOffset;
-        const BimElementMetadata *metadata =
-            metadataForObject(inputs.metadata, objectIndex);
-        if (metadata == nullptr ||
-            !metadataMatchesFilter(objectIndex, *metadata, filter,
-                                   selectedMetadata, inputs)) {
+        if (!visible.contains(objectIndex)) {
           continue;
         }
         appendDrawCommand(out, objectIndex, command.firstIndex,
@@ -0,0 +1,390 @@
+#include "Container/renderer/bim/BimElementMetadataStore.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace container::renderer {
+namespace {
+
+constexpr size_t kStringBlockBytes = 64u * 1024u;
+constexpr uint8_t kTransparentFlag = 1u << 0u;
+constexpr uint8_t kDoubleSidedFlag = 1u << 1u;
+
+template <typename T>
+[[nodiscard]] size_t vectorBytes(const std::vector<T> &values) {
+  return values.capacity() * sizeof(T);
+}
+
+} // namespace
+
+BimStringTable::BimStringTable() { clear(); }
+
+void BimStringTable::clear() {
+  blocks_.clear();
+  blockUsed_ = 0u;
+  blockCapacity_ = 0u;
+  characterBytes_ = 0u;
+  views_.clear();
+  ids_.clear();
+  views_.emplace_back();
+  ids_.emplace(std::string_view{}, kEmptyStringId);
+}
+
+std::string_view BimStringTable::store(std::string_view text) {
+  if (blockUsed_ + text.size() > blockCapacity_) {
+    // Oversized strings get a block of their own so small ones keep packing.
+    const size_t capacity = std::max(kStringBlockBytes, text.size());
+    blocks_.push_back(std::make_unique<char[]>(capacity));
+    blockUsed_ = 0u;
+    blockCapacity_ = capacity;
+    characterBytes_ += capacity;
+  }
+  char *destination = blocks_.back().get() + blockUsed_;
+  std::memcpy(destination, text.data(), text.size());
+  blockUsed_ += text.size();
+  return {destination, text.size()};
+}
+
+uint32_t BimStringTable::intern(std::string_view text) {
+  if (const auto it = ids_.find(text); it != ids_.end()) {
+    return it->second;
+  }
+  const std::string_view stored = store(text);
+  const auto id = static_cast<uint32_t>(views_.size());
+  views_.push_back(stored);
+  ids_.emplace(stored, id);
+  return id;
+}
+
+uint32_t BimStringTable::find(std::string_view text) const {
+  const auto it = ids_.find(text);
+  return it == ids_.end() ? kInvalidStringId : it->second;
+}
+
+std::string_view BimStringTable::view(uint32_t id) const {
+  return id < views_.size() ? views_[id] : std::string_view{};
+}
+
+size_t BimStringTable::memoryBytes() const {
+  // Approximates one heap node per hash entry plus the bucket array.
+  const size_t nodeBytes =
+      sizeof(std::string_view) + sizeof(uint32_t) + 2u * sizeof(void *);
+  return characterBytes_ + vectorBytes(views_) +
+         ids_.size() * nodeBytes + ids_.bucket_count() * sizeof(void *) +
+         blocks_.capacity() * sizeof(std::unique_ptr<char[]>);
+}
+
+void BimElementMetadataStore::clear() {
+  objectIndices_.clear();
+  sourceElementIndices_.clear();
+  meshIds_.clear();
+  sourceMaterialIndices_.clear();
+  materialIndices_.clear();
+  semanticTypeIds_.clear();
+  productIdentityIds_.clear();
+  sourceColors_.clear();
+  bounds_.clear();
+  geometryKinds_.clear();
+  surfaceFlags_.clear();
+  for (std::vector<uint32_t> &column : stringColumns_) {
+    column.clear();
+  }
+  propertyOffsets_.assign(1u, 0u);
+  properties_.clear();
+  strings_.clear();
+}
+
+void BimElementMetadataStore::reserve(size_t elementCount) {
+  objectIndices_.reserve(elementCount);
+  sourceElementIndices_.reserve(elementCount);
+  meshIds_.reserve(elementCount);
+  sourceMaterialIndices_.reserve(elementCount);
+  materialIndices_.reserve(elementCount);
+  semanticTypeIds_.reserve(elementCount);
+  productIdentityIds_.reserve(elementCount);
+  sourceColors_.reserve(elementCount);
+  bounds_.reserve(elementCount);
+  geometryKinds_.reserve(elementCount);
+  surfaceFlags_.reserve(elementCount);
+  for (std::vector<uint32_t> &column : stringColumns_) {
+    column.reserve(elementCount);
+  }
+  propertyOffsets_.reserve(elementCount + 1u);
+}
+
+uint32_t BimElementMetadataStore::append(const BimElementMetadata &metadata) {
+  const auto row = static_cast<uint32_t>(size());
+  objectIndices_.push_back(metadata.objectIndex);
+  sourceElementIndices_.push_back(metadata.sourceElementIndex);
+  meshIds_.push_back(metadata.meshId);
+  sourceMaterialIndices_.push_back(metadata.sourceMaterialIndex);
+  materialIndices_.push_back(metadata.materialIndex);
+  semanticTypeIds_.push_back(metadata.semanticTypeId);
+  productIdentityIds_.push_back(metadata.productIdentityId);
+  sourceColors_.push_back(metadata.sourceColor);
+  bounds_.push_back(metadata.bounds);
+  geometryKinds_.push_back(metadata.geometryKind);
+  surfaceFlags_.push_back(
+      static_cast<uint8_t>((metadata.transparent ? kTransparentFlag : 0u) |
+                           (metadata.doubleSided ? kDoubleSidedFlag : 0u)));
+
+  const auto internField = [&](BimElementStringField field,
+                               const std::string &value) {
+    column(field).push_back(strings_.intern(value));
+  };
+  internField(BimElementStringField::Guid, metadata.guid);
+  internField(BimElementStringField::Type, metadata.type);
+  internField(BimElementStringField::DisplayName, metadata.displayName);
+  internField(BimElementStringField::ObjectType, metadata.objectType);
+  internField(BimElementStringField::StoreyName, metadata.storeyName);
+  internField(BimElementStringField::StoreyId, metadata.storeyId);
+  internField(BimElementStringField::MaterialName, metadata.materialName);
+  internField(BimElementStringField::MaterialCategory,
+              metadata.materialCategory);
+  internField(BimElementStringField::Discipline, metadata.discipline);
+  internField(BimElementStringField::Phase, metadata.phase);
+  internField(BimElementStringField::FireRating, metadata.fireRating);
+  internField(BimElementStringField::LoadBearing, metadata.loadBearing);
+  internField(BimElementStringField::Status, metadata.status);
+  internField(BimElementStringField::SourceId, metadata.sourceId);
+
+  for (const BimElementProperty &property : metadata.properties) {
+    properties_.push_back(BimElementPropertyRecord{
+        .elementIndex = row,
+        .setId = strings_.intern(property.set),
+        .nameId = strings_.intern(property.name),
+        .valueId = strings_.intern(property.value),
+        .categoryId = strings_.intern(property.category),
+    });
+  }
+  propertyOffsets_.push_back(static_cast<uint32_t>(properties_.size()));
+  return row;
+}
+
+std::span<const uint32_t>
+BimElementMetadataStore::fieldIds(BimElementStringField field) const {
+  return stringColumns_[static_cast<size_t>(field)];
+}
+
+size_t BimElementMetadataStore::memoryBytes() const {
+  size_t bytes = vectorBytes(objectIndices_) +
+                 vectorBytes(sourceElementIndices_) + vectorBytes(meshIds_) +
+                 vectorBytes(sourceMaterialIndices_) +
+                 vectorBytes(materialIndices_) +
+                 vectorBytes(semanticTypeIds_) +
+                 vectorBytes(productIdentityIds_) +
+                 vectorBytes(sourceColors_) + vectorBytes(bounds_) +
+                 vectorBytes(geometryKinds_) + vectorBytes(surfaceFlags_) +
+                 vectorBytes(propertyOffsets_) + vectorBytes(properties_);
+  for (const std::vector<uint32_t> &column : stringColumns_) {
+    bytes += vectorBytes(column);
+  }
+  return bytes + strings_.memoryBytes();
+}
+
+uint32_t BimElementMetadataView::objectIndex() const {
+  return store_->objectIndices_[row_];
+}
+
+uint32_t BimElementMetadataView::sourceElementIndex() const {
+  return store_->sourceElementIndices_[row_];
+}
+
+uint32_t BimElementMetadataView::meshId() const {
+  return store_->meshIds_[row_];
+}
+
+uint32_t BimElementMetadataView::sourceMaterialIndex() const {
+  return store_->sourceMaterialIndices_[row_];
+}
+
+uint32_t BimElementMetadataView::materialIndex() const {
+  return store_->materialIndices_[row_];
+}
+
+uint32_t BimElementMetadataView::semanticTypeId() const {
+  return store_->semanticTypeIds_[row_];
+}
+
+uint32_t BimElementMetadataView::productIdentityId() const {
+  return store_->productIdentityIds_[row_];
+}
+
+const glm::vec4 &BimElementMetadataView::sourceColor() const {
+  return store_->sourceColors_[row_];
+}
+
+bool BimElementMetadataView::transparent() const {
+  return (store_->surfaceFlags_[row_] & kTransparentFlag) != 0u;
+}
+
+bool BimElementMetadataView::doubleSided() const {
+  return (store_->surfaceFlags_[row_] & kDoubleSidedFlag) != 0u;
+}
+
+const BimElementBounds &BimElementMetadataView::bounds() const {
+  return store_->bounds_[row_];
+}
+
+BimGeometryKind BimElementMetadataView::geometryKind() const {
+  return store_->geometryKinds_[row_];
+}
+
+uint32_t BimElementMetadataView::fieldId(BimElementStringField field) const {
+  return store_->stringColumns_[static_cast<size_t>(field)][row_];
+}
+
+std::string_view
+BimElementMetadataView::field(BimElementStringField field) const {
+  return store_->strings_.view(fieldId(field));
+}
+
+std::string_view BimElementMetadataView::guid() const {
+  return field(BimElementStringField::Guid);
+}
+
+std::string_view BimElementMetadataView::type() const {
+  return field(BimElementStringField::Type);
+}
+
+std::string_view BimElementMetadataView::displayName() const {
+  return field(BimElementStringField::DisplayName);
+}
+
+std::string_view BimElementMetadataView::objectType() const {
+  return field(BimElementStringField::ObjectType);
+}
+
+std::string_view BimElementMetadataView::storeyName() const {
+  return field(BimElementStringField::StoreyName);
+}
+
+std::string_view BimElementMetadataView::storeyId() const {
+  return field(BimElementStringField::StoreyId);
+}
+
+std::string_view BimElementMetadataView::materialName() const {
+  return field(BimElementStringField::MaterialName);
+}
+
+std::string_view BimElementMetadataView::materialCategory() const {
+  return field(BimElementStringField::MaterialCategory);
+}
+
+std::string_view BimElementMetadataView::discipline() const {
+  return field(BimElementStringField::Discipline);
+}
+
+std::string_view BimElementMetadataView::phase() const {
+  return field(BimElementStringField::Phase);
+}
+
+std::string_view BimElementMetadataView::fireRating() const {
+  return field(BimElementStringField::FireRating);
+}
+
+std::string_view BimElementMetadataView::loadBearing() const {
+  return field(BimElementStringField::LoadBearing);
+}
+
+std::string_view BimElementMetadataView::status() const {
+  return field(BimElementStringField::Status);
+}
+
+std::string_view BimElementMetadataView::sourceId() const {
+  return field(BimElementStringField::SourceId);
+}
+
+std::span<const BimElementPropertyRecord>
+BimElementMetadataView::propertyRecords() const {
+  const uint32_t begin = store_->propertyOffsets_[row_];
+  const uint32_t end = store_->propertyOffsets_[row_ + 1u];
+  return std::span<const BimElementPropertyRecord>(store_->properties_)
+      .subspan(begin, end - begin);
+}
+
+size_t BimElementMetadataView::propertyCount() const {
+  return store_->propertyOffsets_[row_ + 1u] - store_->propertyOffsets_[row_];
+}
+
+BimElementPropertyView BimElementMetadataView::property(size_t index) const {
+  const BimElementPropertyRecord &record = propertyRecords()[index];
+  const BimStringTable &strings = store_->strings_;
+  return {
+      .set = strings.view(record.setId),
+      .name = strings.view(record.nameId),
+      .value = strings.view(record.valueId),
+      .category = strings.view(record.categoryId),
+  };
+}
+
+BimElementMetadata BimElementMetadataView::toMetadata() const {
+  BimElementMetadata metadata{};
+  metadata.objectIndex = objectIndex();
+  metadata.sourceElementIndex = sourceElementIndex();
+  metadata.meshId = meshId();
+  metadata.sourceMaterialIndex = sourceMaterialIndex();
+  metadata.materialIndex = materialIndex();
+  metadata.semanticTypeId = semanticTypeId();
+  metadata.productIdentityId = productIdentityId();
+  metadata.sourceColor = sourceColor();
+  metadata.guid = std::string(guid());
+  metadata.type = std::string(type());
+  metadata.displayName = std::string(displayName());
+  metadata.objectType = std::string(objectType());
+  metadata.storeyName = std::string(storeyName());
+  metadata.storeyId = std::string(storeyId());
+  metadata.materialName = std::string(materialName());
+  metadata.materialCategory = std::string(materialCategory());
+  metadata.discipline = std::string(discipline());
+  metadata.phase = std::string(phase());
+  metadata.fireRating = std::string(fireRating());
+  metadata.loadBearing = std::string(loadBearing());
+  metadata.status = std::string(status());
+  metadata.sourceId = std::string(sourceId());
+  metadata.properties.reserve(propertyCount());
+  for (size_t index = 0; index < propertyCount(); ++index) {
+    const BimElementPropertyView entry = property(index);
+    metadata.properties.push_back(BimElementProperty{
+        .set = std::string(entry.set),
+        .name = std::string(entry.name),
+        .value = std::string(entry.value),
+        .category = std::string(entry.category),
+    });
+  }
+  metadata.transparent = transparent();
+  metadata.doubleSided = doubleSided();
+  metadata.bounds = bounds();
+  metadata.geometryKind = geometryKind();
+  return metadata;
+}
+
+bool sameBimProductIdentity(BimElementMetadataView selected,
+                            BimElementMetadataView candidate) {
+  constexpr uint32_t invalidObjectIndex = std::numeric_limits<uint32_t>::max();
+  if (selected.objectIndex() != invalidObjectIndex &&
+      selected.objectIndex() == candidate.objectIndex()) {
+    return true;
+  }
+  if (!selected.guid().empty() && !candidate.guid().empty()) {
+    return selected.guid() == candidate.guid();
+  }
+  if (!selected.sourceId().empty() &&
+      selected.sourceId() == candidate.sourceId()) {
+    return true;
+  }
+  return false;
+}
+
+std::string_view bimMetadataStoreyLabel(BimElementMetadataView metadata) {
+  const std::string_view storeyName = metadata.storeyName();
+  return storeyName.empty() ? metadata.storeyId() : storeyName;
+}
+
+std::string_view bimMetadataMaterialLabel(BimElementMetadataView metadata) {
+  const std::string_view materialName = metadata.materialName();
+  return materialName.empty() ? metadata.materialCategory() : materialName;
+}
+
+} // namespace container::renderer
@@ -4,13 +4,15 @@
 
 namespace container::renderer {
 
-void prepareBimFrameGpuVisibility(BimManager *manager) {
+void prepareBimFrameGpuVisibility(BimManager *manager,
+                                  std::pmr::memory_resource *frameArena) {
   if (manager == nullptr) {
     return;
   }
 
-  const auto compactionPlan =
-      buildBimDrawCompactionPlan(makeBimDrawCompactionPlanInputs(*manager));
+  const auto compactionPlan = buildBimDrawCompactionPlan(
+      makeBimDrawCompactionPlanInputs(*manager),
+      frameArena != nullptr ? frameArena : std::pmr::get_default_resource());
   for (const BimDrawCompactionPlanSource &source : compactionPlan) {
     manager->prepareDrawCompaction(source.slot, *source.commands);
   }
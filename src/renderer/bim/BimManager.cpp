@@ -6,8 +6,10 @@
 #include "Container/geometry/Model.h"
 #include "Container/geometry/UsdLoader.h"
 #include "Container/renderer/bim/BimDrawFilterState.h"
+#include "Container/renderer/bim/BimElementMetadataStore.h"
 #include "Container/renderer/bim/BimMetadataCatalog.h"
 #include "Container/renderer/bim/BimMetadataIndex.h"
+#include "Container/renderer/bim/BimObjectOrdering.h"
 #include "Container/renderer/scene/SceneController.h"
 #include "Container/utility/AllocationManager.h"
 #include "Container/utility/FileLoader.h"
@@ -57,6 +59,9 @@ constexpr uint32_t kBimVisibilityFilterStatus = 1u << 7u;
 constexpr uint32_t kBimVisibilityFilterDrawBudget = 1u << 8u;
 constexpr uint32_t kBimVisibilityFilterIsolateSelection = 1u << 9u;
 constexpr uint32_t kBimVisibilityFilterHideSelection = 1u << 10u;
+// Snapping follows the cursor across a handful of elements at a time; the
+// cap only bounds a long session that hovers over thousands of them.
+constexpr size_t kMaxSnapFeatureGrids = 64u;
 
 size_t drawCompactionSlotIndex(BimDrawCompactionSlot slot) {
   return std::min(static_cast<size_t>(slot), kBimDrawCompactionSlotCount - 1u);
@@ -334,11 +339,11 @@ bool insideSectionCapBounds(const glm::vec3 &worldPosition,
          worldPosition.z <= bounds.max.z + tolerance;
 }
 
-bool sameSectionCapBuildOptions(const BimSectionCapBuildOptions &lhs,
+// Everything a cap depends on apart from where the cap planes are.
+bool sameSectionCapStyleOptions(const BimSectionCapBuildOptions &lhs,
                                 const BimSectionCapBuildOptions &rhs) {
   constexpr float kEpsilon = 1.0e-5f;
-  if (glm::length(lhs.sectionPlane - rhs.sectionPlane) > kEpsilon ||
-      lhs.clipPlaneCount != rhs.clipPlaneCount ||
+  if (lhs.clipPlaneCount != rhs.clipPlaneCount ||
       glm::length(lhs.fillColor - rhs.fillColor) > kEpsilon ||
       std::abs(lhs.fillOpacity - rhs.fillOpacity) > kEpsilon ||
       glm::length(lhs.hatchColor - rhs.hatchColor) > kEpsilon ||
@@ -356,14 +361,6 @@ bool sameSectionCapBuildOptions(const BimSectionCapBuildOptions &lhs,
     return false;
   }
 
-  const uint32_t clipPlaneCount = std::min<uint32_t>(
-      lhs.clipPlaneCount, static_cast<uint32_t>(lhs.clipPlanes.size()));
-  for (uint32_t planeIndex = 0; planeIndex < clipPlaneCount; ++planeIndex) {
-    if (glm::length(lhs.clipPlanes[planeIndex] - rhs.clipPlanes[planeIndex]) >
-        kEpsilon) {
-      return false;
-    }
-  }
   for (size_t styleIndex = 0; styleIndex < lhs.materialStyles.size();
        ++styleIndex) {
     const BimSectionCapMaterialStyle &lhsStyle =
@@ -383,6 +380,39 @@ bool sameSectionCapBuildOptions(const BimSectionCapBuildOptions &lhs,
   return true;
 }
 
+bool sameSectionCapBuildOptions(const BimSectionCapBuildOptions &lhs,
+                                const BimSectionCapBuildOptions &rhs) {
+  constexpr float kEpsilon = 1.0e-5f;
+  if (!sameSectionCapStyleOptions(lhs, rhs) ||
+      glm::length(lhs.sectionPlane - rhs.sectionPlane) > kEpsilon) {
+    return false;
+  }
+  const uint32_t clipPlaneCount = std::min<uint32_t>(
+      lhs.clipPlaneCount, static_cast<uint32_t>(lhs.clipPlanes.size()));
+  for (uint32_t planeIndex = 0; planeIndex < clipPlaneCount; ++planeIndex) {
+    if (glm::length(lhs.clipPlanes[planeIndex] - rhs.clipPlanes[planeIndex]) >
+        kEpsilon) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename Element>
+std::vector<container::gpu::BufferRangeWrite>
+sectionCapRangeWrites(std::span<const Element> source,
+                      std::span<const BimSectionCapBufferRange> ranges) {
+  std::vector<container::gpu::BufferRangeWrite> writes;
+  writes.reserve(ranges.size());
+  for (const BimSectionCapBufferRange &range : ranges) {
+    writes.push_back(container::gpu::BufferRangeWrite{
+        .offset = static_cast<VkDeviceSize>(sizeof(Element) * range.first),
+        .bytes = std::as_bytes(source.subspan(range.first, range.count)),
+    });
+  }
+  return writes;
+}
+
 container::gpu::ObjectData
 makeObjectData(const glm::mat4 &transform, uint32_t materialIndex,
                bool doubleSided, glm::vec3 boundsCenter, float boundsRadius) {
@@ -1447,6 +1477,12 @@ namespace detail {
                                              objectDataRevision);
 }
 
+// Declared by the benchmark suite (benchmarks/renderer_benchmarks.cpp) only.
+std::vector<BimMeshletClusterMetadata> bimMeshletClusterMetadataForModel(
+    const container::geometry::dotbim::Model &model) {
+  return buildMeshletClusterMetadataForModel(model);
+}
+
 } // namespace detail
 
 BimManager::BimManager(std::shared_ptr<container::gpu::VulkanDevice> device,
@@ -1456,6 +1492,7 @@ BimManager::BimManager(std::shared_ptr<container::gpu::VulkanDevice> device,
       pipelineManager_(pipelineManager),
       metadataCatalog_(std::make_unique<BimMetadataCatalog>()),
       metadataIndex_(std::make_unique<BimMetadataIndex>()),
+      elementMetadata_(std::make_unique<BimElementMetadataStore>()),
       drawFilterState_(std::make_unique<BimDrawFilterState>()) {}
 
 BimManager::~BimManager() {
@@ -1484,7 +1521,7 @@ void BimManager::clear() {
   vertices_.clear();
   indices_.clear();
   objectData_.clear();
-  elementMetadata_.clear();
+  elementMetadata_->clear();
   relationshipGraph_.clear();
   objectDrawCommands_.clear();
   objectDrawCommandOffsets_.clear();
@@ -1508,6 +1545,8 @@ void BimManager::clear() {
   meshletClusters_.clear();
   objectLodMetadata_.clear();
   optimizedModelMetadata_ = {};
+  snapFeatureGrids_.clear();
+  snapFeatureGridClock_ = 0;
   destroyMeshletResidencyBuffers();
   destroyVisibilityFilterBuffers();
   destroyDrawCompactionBuffers();
@@ -1550,8 +1589,7 @@ void BimManager::clearSectionClipCapGeometry() {
     allocationManager_.destroyBuffer(sectionClipCapIndexBuffer_);
   }
   sectionClipCapDrawData_ = {};
-  sectionClipCapVertices_.clear();
-  sectionClipCapIndices_.clear();
+  sectionClipCapCache_.reset();
   sectionClipCapBuildOptionsValid_ = false;
 }
 
@@ -1824,150 +1862,26 @@ bool BimManager::rebuildSectionPlaneVisualGeometry(glm::vec4 plane, float size,
 bool BimManager::rebuildSectionClipCapGeometry(
     const BimSectionCapBuildOptions &options) {
   if (sectionClipCapBuildOptionsValid_ &&
-      sameSectionCapBuildOptions(sectionClipCapBuildOptions_, options) &&
-      sectionClipCapDrawData_.valid()) {
-    return true;
+      sameSectionCapBuildOptions(sectionClipCapBuildOptions_, options)) {
+    return sectionClipCapDrawData_.valid();
   }
-  clearSectionClipCapGeometry();
   if (vertices_.empty() || indices_.empty() || objectData_.empty() ||
       objectDrawCommands_.empty()) {
+    clearSectionClipCapGeometry();
     return false;
   }
-
-  auto appendGeneratedMesh = [this](const BimSectionCapGeneratedMesh &mesh,
-                                    uint32_t objectIndex) {
-    const uint32_t baseVertex = static_cast<uint32_t>(std::min<size_t>(
-        sectionClipCapVertices_.size(), std::numeric_limits<uint32_t>::max()));
-    const uint32_t baseIndex = static_cast<uint32_t>(std::min<size_t>(
-        sectionClipCapIndices_.size(), std::numeric_limits<uint32_t>::max()));
-    sectionClipCapVertices_.insert(sectionClipCapVertices_.end(),
-                                   mesh.vertices.begin(), mesh.vertices.end());
-    sectionClipCapIndices_.reserve(sectionClipCapIndices_.size() +
-                                   mesh.indices.size());
-    for (uint32_t index : mesh.indices) {
-      sectionClipCapIndices_.push_back(baseVertex + index);
-    }
-    auto appendCommands = [baseIndex](const std::vector<DrawCommand> &source,
-                                      std::vector<DrawCommand> &target) {
-      target.reserve(target.size() + source.size());
-      for (DrawCommand command : source) {
-        command.firstIndex += baseIndex;
-        target.push_back(command);
-      }
-    };
-    appendCommands(mesh.fillDrawCommands,
-                   sectionClipCapDrawData_.fillDrawCommands);
-    appendCommands(mesh.hatchDrawCommands,
-                   sectionClipCapDrawData_.hatchDrawCommands);
-    sectionClipCapDrawData_.fillDrawStyles.insert(
-        sectionClipCapDrawData_.fillDrawStyles.end(),
-        mesh.fillDrawStyles.begin(), mesh.fillDrawStyles.end());
-    sectionClipCapDrawData_.hatchDrawStyles.insert(
-        sectionClipCapDrawData_.hatchDrawStyles.end(),
-        mesh.hatchDrawStyles.begin(), mesh.hatchDrawStyles.end());
-    sectionClipCapDrawData_.sectionMarkerLines.insert(
-        sectionClipCapDrawData_.sectionMarkerLines.end(),
-        mesh.sectionMarkerLines.begin(), mesh.sectionMarkerLines.end());
-    auto appendSectionMarkerGeometry =
-        [this, objectIndex](const BimSectionMarkerLine &marker) {
-          if (objectIndex >= objectData_.size() || !isFiniteVec3(marker.a) ||
-              !isFiniteVec3(marker.b) || !isFiniteVec3(marker.color)) {
-            return;
-          }
-
-          const glm::vec3 line = marker.b - marker.a;
-          const float lineLength = glm::length(line);
-          if (!std::isfinite(lineLength) || lineLength <= 0.0001f) {
-            return;
-          }
-
-          const uint32_t baseVertex = static_cast<uint32_t>(std::min<size_t>(
-              sectionClipCapVertices_.size(),
-              std::numeric_limits<uint32_t>::max()));
-          const uint32_t firstIndex = static_cast<uint32_t>(std::min<size_t>(
-              sectionClipCapIndices_.size(),
-              std::numeric_limits<uint32_t>::max()));
-
-          auto pushVertex = [&](const glm::vec3 &position) {
-            container::geometry::Vertex vertex{};
-            vertex.position = position;
-            vertex.color = marker.color;
-            sectionClipCapVertices_.push_back(vertex);
-            return static_cast<uint32_t>(
-                sectionClipCapVertices_.size() - 1u);
-          };
-          auto pushSegment = [&](const glm::vec3 &a, const glm::vec3 &b) {
-            const uint32_t ia = pushVertex(a);
-            const uint32_t ib = pushVertex(b);
-            sectionClipCapIndices_.push_back(ia);
-            sectionClipCapIndices_.push_back(ib);
-          };
-
-          pushSegment(marker.a, marker.b);
-
-          const glm::vec3 direction = line / lineLength;
-          const glm::vec3 reference =
-              std::abs(direction.y) < 0.9f ? glm::vec3{0.0f, 1.0f, 0.0f}
-                                           : glm::vec3{1.0f, 0.0f, 0.0f};
-          glm::vec3 side = glm::cross(direction, reference);
-          const float sideLength = glm::length(side);
-          if (std::isfinite(sideLength) && sideLength > 0.0001f) {
-            side /= sideLength;
-          } else {
-            side = {0.0f, 0.0f, 1.0f};
-          }
-          const float arrowLength =
-              std::clamp(lineLength * 0.08f, 0.05f, 1.0f);
-          const float arrowWidth = arrowLength * 0.45f;
-          auto pushArrow = [&](const glm::vec3 &tip,
-                               const glm::vec3 &inwardDirection) {
-            const glm::vec3 wingCenter = tip + inwardDirection * arrowLength;
-            pushSegment(tip, wingCenter + side * arrowWidth);
-            pushSegment(tip, wingCenter - side * arrowWidth);
-          };
-          if (marker.startArrow) {
-            pushArrow(marker.a, direction);
-          }
-          if (marker.endArrow) {
-            pushArrow(marker.b, -direction);
-          }
-
-          const uint32_t indexCount = static_cast<uint32_t>(
-              sectionClipCapIndices_.size() - firstIndex);
-          if (indexCount == 0u) {
-            sectionClipCapVertices_.resize(baseVertex);
-            return;
-          }
-
-          sectionClipCapDrawData_.hatchDrawCommands.push_back(DrawCommand{
-              .objectIndex = objectIndex,
-              .firstIndex = firstIndex,
-              .indexCount = indexCount,
-              .instanceCount = 1u,
-          });
-          sectionClipCapDrawData_.hatchDrawStyles.push_back(
-              BimSectionCapDrawStyle{
-                  .objectIndex = objectIndex,
-                  .materialIndex = kInvalidBimSectionCapMaterialIndex,
-                  .fillColor = marker.color,
-                  .fillOpacity = 1.0f,
-                  .hatchSpacing = 0.0f,
-                  .hatchAngleRadians = 0.0f,
-                  .hatchColor = marker.color,
-                  .lineWidth = marker.lineWidth,
-              });
-        };
-    for (const BimSectionMarkerLine &marker : mesh.sectionMarkerLines) {
-      appendSectionMarkerGeometry(marker);
-    }
-  };
+  // Cached caps stay valid while only the cap planes move.
+  if (!sectionClipCapBuildOptionsValid_ ||
+      !sameSectionCapStyleOptions(sectionClipCapBuildOptions_, options)) {
+    sectionClipCapCache_.reset();
+  }
 
   BimSectionCapBuilder sectionCapBuilder;
   std::vector<BimSectionCapTriangle> triangles;
-  for (uint32_t objectIndex = 0u; objectIndex < elementMetadata_.size();
+  for (uint32_t objectIndex = 0u; objectIndex < elementMetadata_->size();
        ++objectIndex) {
-    const BimElementMetadata &metadata = elementMetadata_[objectIndex];
-    if (metadata.geometryKind != BimGeometryKind::Mesh ||
+    const BimElementMetadataView metadata = (*elementMetadata_)[objectIndex];
+    if (metadata.geometryKind() != BimGeometryKind::Mesh ||
         objectIndex >= objectData_.size() ||
         objectIndex >= objectDrawCommandOffsets_.size() ||
         objectIndex >= objectDrawCommandCounts_.size()) {
@@ -1988,6 +1902,10 @@ bool BimManager::rebuildSectionClipCapGeometry(
           localPlaneTransform * options.clipPlanes[planeIndex]);
     }
 
+    if (!sectionClipCapCache_.needsRebuild(objectIndex, localOptions)) {
+      continue;
+    }
+
     triangles.clear();
     const uint32_t commandOffset = objectDrawCommandOffsets_[objectIndex];
     const uint32_t commandCount = objectDrawCommandCounts_[objectIndex];
@@ -2011,7 +1929,7 @@ bool BimManager::rebuildSectionClipCapGeometry(
         }
         triangles.push_back(BimSectionCapTriangle{
             .objectIndex = objectIndex,
-            .materialIndex = metadata.materialIndex,
+            .materialIndex = metadata.materialIndex(),
             .p0 = vertices_[i0].position,
             .p1 = vertices_[i1].position,
             .p2 = vertices_[i2].position,
@@ -2019,45 +1937,78 @@ bool BimManager::rebuildSectionClipCapGeometry(
       }
     }
 
-    const BimSectionCapGeneratedMesh generated =
-        sectionCapBuilder.build(triangles, localOptions);
-    if (generated.valid()) {
-      appendGeneratedMesh(generated, objectIndex);
-    }
+    sectionClipCapCache_.store(objectIndex, localOptions, triangles,
+                               sectionCapBuilder.build(triangles,
+                                                       localOptions));
   }
 
-  if (sectionClipCapVertices_.empty() || sectionClipCapIndices_.empty()) {
-    clearSectionClipCapGeometry();
+  const BimSectionCapCacheUpdate update = sectionClipCapCache_.commit();
+  sectionClipCapBuildOptions_ = options;
+  sectionClipCapBuildOptionsValid_ = true;
+  if (update.rebuiltObjectCount == 0u) {
+    return sectionClipCapDrawData_.valid();
+  }
+  const BimSectionCapGeneratedMesh &geometry = sectionClipCapCache_.geometry();
+  sectionClipCapDrawData_.fillDrawCommands = geometry.fillDrawCommands;
+  sectionClipCapDrawData_.hatchDrawCommands = geometry.hatchDrawCommands;
+  sectionClipCapDrawData_.fillDrawStyles = geometry.fillDrawStyles;
+  sectionClipCapDrawData_.hatchDrawStyles = geometry.hatchDrawStyles;
+  sectionClipCapDrawData_.sectionMarkerLines = geometry.sectionMarkerLines;
+  if (geometry.vertices.empty() || geometry.indices.empty()) {
     return false;
   }
 
   const VkDeviceSize vertexBufferSize = static_cast<VkDeviceSize>(
-      sizeof(container::geometry::Vertex) * sectionClipCapVertices_.size());
+      sizeof(container::geometry::Vertex) * geometry.vertices.size());
   const VkDeviceSize indexBufferSize = static_cast<VkDeviceSize>(
-      sizeof(uint32_t) * sectionClipCapIndices_.size());
-  sectionClipCapVertexBuffer_ = allocationManager_.uploadBuffer(
-      {reinterpret_cast<const std::byte *>(sectionClipCapVertices_.data()),
-       static_cast<size_t>(vertexBufferSize)},
-      VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
-  sectionClipCapIndexBuffer_ = allocationManager_.uploadBuffer(
-      {reinterpret_cast<const std::byte *>(sectionClipCapIndices_.data()),
-       static_cast<size_t>(indexBufferSize)},
-      VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+      sizeof(uint32_t) * geometry.indices.size());
+  if (update.reallocated ||
+      sectionClipCapVertexBuffer_.buffer == VK_NULL_HANDLE ||
+      sectionClipCapIndexBuffer_.buffer == VK_NULL_HANDLE) {
+    if (sectionClipCapVertexBuffer_.buffer != VK_NULL_HANDLE) {
+      allocationManager_.destroyBuffer(sectionClipCapVertexBuffer_);
+    }
+    if (sectionClipCapIndexBuffer_.buffer != VK_NULL_HANDLE) {
+      allocationManager_.destroyBuffer(sectionClipCapIndexBuffer_);
+    }
+    sectionClipCapVertexBuffer_ = allocationManager_.uploadBuffer(
+        {reinterpret_cast<const std::byte *>(geometry.vertices.data()),
+         static_cast<size_t>(vertexBufferSize)},
+        VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+    sectionClipCapIndexBuffer_ = allocationManager_.uploadBuffer(
+        {reinterpret_cast<const std::byte *>(geometry.indices.data()),
+         static_cast<size_t>(indexBufferSize)},
+        VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+  } else {
+    // Only the slices rebuilt in place are copied; the rest of both buffers
+    // is already current.
+    allocationManager_.updateBufferRanges(
+        sectionClipCapVertexBuffer_,
+        sectionCapRangeWrites(
+            std::span<const container::geometry::Vertex>(geometry.vertices),
+            update.vertexRanges));
+    allocationManager_.updateBufferRanges(
+        sectionClipCapIndexBuffer_,
+        sectionCapRangeWrites(std::span<const uint32_t>(geometry.indices),
+                              update.indexRanges));
+  }
   sectionClipCapDrawData_.vertexSlice = container::gpu::BufferSlice{
       sectionClipCapVertexBuffer_.buffer, 0, vertexBufferSize};
   sectionClipCapDrawData_.indexSlice = container::gpu::BufferSlice{
       sectionClipCapIndexBuffer_.buffer, 0, indexBufferSize};
-  sectionClipCapBuildOptions_ = options;
-  sectionClipCapBuildOptionsValid_ = sectionClipCapDrawData_.valid();
-  return sectionClipCapBuildOptionsValid_;
+  return sectionClipCapDrawData_.valid();
 }
 
-const BimElementMetadata *
+const BimElementMetadataStore &BimManager::elementMetadata() const {
+  return *elementMetadata_;
+}
+
+BimElementMetadataView
 BimManager::metadataForObject(uint32_t objectIndex) const {
-  if (objectIndex >= elementMetadata_.size()) {
-    return nullptr;
+  if (objectIndex >= elementMetadata_->size()) {
+    return {};
   }
-  return &elementMetadata_[objectIndex];
+  return (*elementMetadata_)[objectIndex];
 }
 
 BimCoordinationOverlayResult BimManager::buildCoordinationOverlay(
@@ -2065,19 +2016,19 @@ BimCoordinationOverlayResult BimManager::buildCoordinationOverlay(
     std::span<const BimCoordinationOverlayClashPair> clashPairs,
     std::span<const BimCoordinationOverlayIssuePin> issuePins) const {
   std::vector<BimCoordinationOverlayElement> elements;
-  elements.reserve(elementMetadata_.size());
-  for (const BimElementMetadata &metadata : elementMetadata_) {
+  elements.reserve(elementMetadata_->size());
+  for (const BimElementMetadataView metadata : *elementMetadata_) {
     BimCoordinationOverlayBounds bounds{};
-    if (metadata.bounds.valid) {
-      bounds = {.min = metadata.bounds.min,
-                .max = metadata.bounds.max,
+    if (metadata.bounds().valid) {
+      bounds = {.min = metadata.bounds().min,
+                .max = metadata.bounds().max,
                 .valid = true};
     }
-    elements.push_back({.objectIndex = metadata.objectIndex,
-                        .ifcClass = metadata.type,
-                        .type = metadata.objectType,
-                        .name = metadata.displayName,
-                        .guid = metadata.guid,
+    elements.push_back({.objectIndex = metadata.objectIndex(),
+                        .ifcClass = std::string(metadata.type()),
+                        .type = std::string(metadata.objectType()),
+                        .name = std::string(metadata.displayName()),
+                        .guid = std::string(metadata.guid()),
                         .bounds = bounds});
   }
 
@@ -2138,27 +2089,27 @@ BimManager::objectIndicesForSourceId(std::string_view sourceId) const {
 
 BimElementBounds
 BimManager::elementBoundsForObject(uint32_t objectIndex) const {
-  if (const BimElementMetadata *metadata = metadataForObject(objectIndex);
-      metadata != nullptr) {
+  if (const BimElementMetadataView metadata = metadataForObject(objectIndex)) {
     glm::vec3 boundsMin{0.0f};
     glm::vec3 boundsMax{0.0f};
     bool hasBounds = false;
 
     auto includeIndexedBounds = [&](std::span<const uint32_t> objectIndices) {
       for (uint32_t candidateObjectIndex : objectIndices) {
-        if (const BimElementMetadata *candidate =
+        if (const BimElementMetadataView candidate =
                 metadataForObject(candidateObjectIndex)) {
-          includeBoundsBox(candidate->bounds, boundsMin, boundsMax, hasBounds);
+          includeBoundsBox(candidate.bounds(), boundsMin, boundsMax,
+                           hasBounds);
         }
       }
     };
 
-    if (!metadata->guid.empty()) {
-      includeIndexedBounds(objectIndicesForGuid(metadata->guid));
-    } else if (!metadata->sourceId.empty()) {
-      includeIndexedBounds(objectIndicesForSourceId(metadata->sourceId));
+    if (!metadata.guid().empty()) {
+      includeIndexedBounds(objectIndicesForGuid(metadata.guid()));
+    } else if (!metadata.sourceId().empty()) {
+      includeIndexedBounds(objectIndicesForSourceId(metadata.sourceId()));
     } else {
-      includeBoundsBox(metadata->bounds, boundsMin, boundsMax, hasBounds);
+      includeBoundsBox(metadata.bounds(), boundsMin, boundsMax, hasBounds);
     }
     if (hasBounds) {
       BimElementBounds bounds{};
@@ -2237,6 +2188,78 @@ BimManager::elementBoundsForObject(uint32_t objectIndex) const {
   return bounds;
 }
 
+void BimManager::collectSnapCandidatesForObject(
+    uint32_t objectIndex, const BimSnapFeatureQuery &query,
+    std::vector<BimSnapCandidate> &outCandidates) const {
+  const BimElementMetadataView metadata = metadataForObject(objectIndex);
+  if (!metadata) {
+    return;
+  }
+  std::span<const uint32_t> group{};
+  if (!metadata.guid().empty()) {
+    group = objectIndicesForGuid(metadata.guid());
+  } else if (!metadata.sourceId().empty()) {
+    group = objectIndicesForSourceId(metadata.sourceId());
+  }
+  const uint32_t elementKey =
+      group.empty() ? objectIndex : std::ranges::min(group);
+
+  auto grid = snapFeatureGrids_.find(elementKey);
+  if (grid == snapFeatureGrids_.end()) {
+    if (snapFeatureGrids_.size() >= kMaxSnapFeatureGrids) {
+      snapFeatureGrids_.erase(std::ranges::min_element(
+          snapFeatureGrids_, {}, [](const auto &entry) {
+            return entry.second.lastUsed;
+          }));
+    }
+    std::vector<DrawCommand> commands;
+    collectDrawCommandsForObject(objectIndex, commands);
+    std::vector<BimSnapTriangle> triangles;
+    for (const DrawCommand &command : commands) {
+      if (command.firstIndex >= indices_.size()) {
+        continue;
+      }
+      const size_t firstIndex = command.firstIndex;
+      const size_t endIndex =
+          firstIndex + std::min(static_cast<size_t>(command.indexCount),
+                                indices_.size() - firstIndex);
+      const uint32_t instanceCount = std::max(command.instanceCount, 1u);
+      for (uint32_t instanceOffset = 0u; instanceOffset < instanceCount;
+           ++instanceOffset) {
+        if (command.objectIndex >
+            std::numeric_limits<uint32_t>::max() - instanceOffset) {
+          break;
+        }
+        const uint32_t commandObjectIndex =
+            command.objectIndex + instanceOffset;
+        if (commandObjectIndex >= objectData_.size()) {
+          continue;
+        }
+        const glm::mat4 &model = objectData_[commandObjectIndex].model;
+        for (size_t index = firstIndex; index + 2u < endIndex; index += 3u) {
+          const uint32_t i0 = indices_[index];
+          const uint32_t i1 = indices_[index + 1u];
+          const uint32_t i2 = indices_[index + 2u];
+          if (i0 >= vertices_.size() || i1 >= vertices_.size() ||
+              i2 >= vertices_.size()) {
+            continue;
+          }
+          triangles.push_back(BimSnapTriangle{
+              .objectIndex = commandObjectIndex,
+              .p0 = glm::vec3(model * glm::vec4(vertices_[i0].position, 1.0f)),
+              .p1 = glm::vec3(model * glm::vec4(vertices_[i1].position, 1.0f)),
+              .p2 = glm::vec3(model * glm::vec4(vertices_[i2].position, 1.0f)),
+          });
+        }
+      }
+    }
+    grid = snapFeatureGrids_.try_emplace(elementKey).first;
+    grid->second.grid = BimSnapFeatureGrid(triangles);
+  }
+  grid->second.lastUsed = ++snapFeatureGridClock_;
+  grid->second.grid.query(query, outCandidates);
+}
+
 const std::vector<std::string> &BimManager::elementTypes() const {
   return metadataCatalog_->types();
 }
@@ -2324,13 +2347,13 @@ bool BimManager::setSemanticColorMode(BimSemanticColorMode mode) {
   }
   semanticColorMode_ = mode;
   bool objectDataChanged = false;
-  for (const BimElementMetadata &metadata : elementMetadata_) {
-    if (metadata.objectIndex >= objectData_.size()) {
+  for (const BimElementMetadataView metadata : *elementMetadata_) {
+    if (metadata.objectIndex() >= objectData_.size()) {
       continue;
     }
     const uint32_t semanticId =
         metadataCatalog_->semanticIdForMetadata(metadata, mode);
-    container::gpu::ObjectData &object = objectData_[metadata.objectIndex];
+    container::gpu::ObjectData &object = objectData_[metadata.objectIndex()];
     if (object.objectInfo.w == semanticId) {
       continue;
     }
@@ -2348,8 +2371,8 @@ BimSceneStats BimManager::sceneStats() const {
   size_t meshObjectCount = 0;
   size_t pointObjectCount = 0;
   size_t curveObjectCount = 0;
-  for (const BimElementMetadata &metadata : elementMetadata_) {
-    switch (metadata.geometryKind) {
+  for (const BimElementMetadataView metadata : *elementMetadata_) {
+    switch (metadata.geometryKind()) {
     case BimGeometryKind::Points:
       ++pointObjectCount;
       break;
@@ -2380,7 +2403,7 @@ BimSceneStats BimManager::sceneStats() const {
   }
 
   return BimSceneStats{
-      .objectCount = elementMetadata_.size(),
+      .objectCount = elementMetadata_->size(),
       .meshObjectCount = meshObjectCount,
       .pointObjectCount = pointObjectCount,
       .curveObjectCount = curveObjectCount,
@@ -2460,20 +2483,19 @@ BimManager::sceneProviderTriangleBatches() const {
         continue;
       }
 
-      const BimElementMetadata *metadata =
+      const BimElementMetadataView metadata =
           metadataForObject(command.objectIndex);
-      if (metadata != nullptr &&
-          metadata->geometryKind != BimGeometryKind::Mesh) {
+      if (metadata && metadata.geometryKind() != BimGeometryKind::Mesh) {
         continue;
       }
 
       uint32_t materialIndex = std::numeric_limits<uint32_t>::max();
       bool doubleSided = false;
       bool batchTransparent = transparent;
-      if (metadata != nullptr) {
-        materialIndex = metadata->materialIndex;
-        doubleSided = metadata->doubleSided;
-        batchTransparent = batchTransparent || metadata->transparent;
+      if (metadata) {
+        materialIndex = metadata.materialIndex();
+        doubleSided = metadata.doubleSided();
+        batchTransparent = batchTransparent || metadata.transparent();
       } else if (command.objectIndex < objectData_.size()) {
         const container::gpu::ObjectData &object =
             objectData_[command.objectIndex];
@@ -2506,14 +2528,14 @@ BimManager::drawBudgetLodStats(const BimDrawFilter &filter) const {
   stats.maxObjects = filter.drawBudgetMaxObjects;
 
   const BimDrawFilterStateInputs inputs = drawFilterStateInputs();
-  for (uint32_t objectIndex = 0u; objectIndex < elementMetadata_.size();
+  for (uint32_t objectIndex = 0u; objectIndex < elementMetadata_->size();
        ++objectIndex) {
-    const BimElementMetadata &metadata = elementMetadata_[objectIndex];
+    const BimElementMetadataView metadata = (*elementMetadata_)[objectIndex];
     if (!drawFilterState_->objectMatchesFilter(objectIndex, filter, inputs)) {
       continue;
     }
     ++stats.visibleObjectCount;
-    if (metadata.geometryKind != BimGeometryKind::Mesh) {
+    if (metadata.geometryKind() != BimGeometryKind::Mesh) {
       continue;
     }
     ++stats.visibleMeshObjectCount;
@@ -2533,8 +2555,9 @@ BimDrawFilterStateInputs BimManager::drawFilterStateInputs() const {
   return BimDrawFilterStateInputs{
       .revision = objectDataRevision_,
       .objectCount = objectData_.size(),
-      .metadata = {elementMetadata_.data(), elementMetadata_.size()},
+      .metadata = elementMetadata_.get(),
       .phaseOrder = metadataCatalog_->phases(),
+      .catalog = metadataCatalog_.get(),
       .opaqueDrawCommands = &opaqueDrawCommands_,
       .opaqueSingleSidedDrawCommands = &opaqueSingleSidedDrawCommands_,
       .opaqueWindingFlippedDrawCommands = &opaqueWindingFlippedDrawCommands_,
@@ -2630,19 +2653,19 @@ BimPickHit BimManager::pickRenderableObjectForDraws(
         }
 
         const glm::mat4 &model = objectData_[objectIndex].model;
-        const BimElementMetadata *metadata = metadataForObject(objectIndex);
+        const BimElementMetadataView metadata = metadataForObject(objectIndex);
         float sectionCapHitDistance = 0.0f;
         glm::vec3 sectionCapHitPosition{0.0f};
         bool sectionCapCandidate = false;
         bool sectionCapCrossesObject = false;
-        if (sectionPlaneEnabled && metadata != nullptr &&
+        if (sectionPlaneEnabled && metadata &&
             intersectRaySectionPlane(ray, sectionPlane,
                                      sectionCapHitDistance) &&
             sectionCapHitDistance < nearest.distance) {
           sectionCapHitPosition =
               ray.origin + ray.direction * sectionCapHitDistance;
           sectionCapCandidate =
-              insideSectionCapBounds(sectionCapHitPosition, metadata->bounds);
+              insideSectionCapBounds(sectionCapHitPosition, metadata.bounds());
         }
 
         for (size_t index = firstIndex; index + 2u < endIndex; index += 3u) {
@@ -2757,22 +2780,22 @@ BimPickHit BimManager::pickRenderableObjectForDraws(
   testGeometryDrawLists(curveDrawLists_);
 
   std::vector<DrawCommand> pointCurvePickingCommands;
-  pointCurvePickingCommands.reserve(elementMetadata_.size());
-  for (const BimElementMetadata &metadata : elementMetadata_) {
-    if (metadata.geometryKind != BimGeometryKind::Points &&
-        metadata.geometryKind != BimGeometryKind::Curves) {
+  pointCurvePickingCommands.reserve(elementMetadata_->size());
+  for (const BimElementMetadataView metadata : *elementMetadata_) {
+    if (metadata.geometryKind() != BimGeometryKind::Points &&
+        metadata.geometryKind() != BimGeometryKind::Curves) {
       continue;
     }
-    if ((metadata.transparent && !includeTransparent) ||
-        (!metadata.transparent && !includeOpaque)) {
+    if ((metadata.transparent() && !includeTransparent) ||
+        (!metadata.transparent() && !includeOpaque)) {
       continue;
     }
-    if (metadata.objectIndex >= objectDrawCommandOffsets_.size() ||
-        metadata.objectIndex >= objectDrawCommandCounts_.size()) {
+    if (metadata.objectIndex() >= objectDrawCommandOffsets_.size() ||
+        metadata.objectIndex() >= objectDrawCommandCounts_.size()) {
       continue;
     }
-    const uint32_t offset = objectDrawCommandOffsets_[metadata.objectIndex];
-    const uint32_t count = objectDrawCommandCounts_[metadata.objectIndex];
+    const uint32_t offset = objectDrawCommandOffsets_[metadata.objectIndex()];
+    const uint32_t count = objectDrawCommandCounts_[metadata.objectIndex()];
     if (offset > objectDrawCommands_.size() ||
         count > objectDrawCommands_.size() - offset) {
       continue;
@@ -2792,20 +2815,21 @@ void BimManager::collectDrawCommandsForObject(
   if (objectIndex == std::numeric_limits<uint32_t>::max()) {
     return;
   }
-  const BimElementMetadata *selectedMetadata = metadataForObject(objectIndex);
-  if (selectedMetadata == nullptr) {
+  const BimElementMetadataView selectedMetadata =
+      metadataForObject(objectIndex);
+  if (!selectedMetadata) {
     return;
   }
 
   auto nativePointCurveObjectHasNativeDraw =
-      [&](const BimElementMetadata &metadata) {
-        switch (metadata.geometryKind) {
+      [&](const BimElementMetadataView metadata) {
+        switch (metadata.geometryKind()) {
         case BimGeometryKind::Points:
           return geometryDrawListsCoverObject(nativePointDrawLists_,
-                                              metadata.objectIndex);
+                                              metadata.objectIndex());
         case BimGeometryKind::Curves:
           return geometryDrawListsCoverObject(nativeCurveDrawLists_,
-                                              metadata.objectIndex);
+                                              metadata.objectIndex());
         case BimGeometryKind::Mesh:
         default:
           return false;
@@ -2813,10 +2837,10 @@ void BimManager::collectDrawCommandsForObject(
       };
 
   auto appendCommandsForObject = [&](uint32_t candidateObjectIndex) {
-    const BimElementMetadata *candidateMetadata =
+    const BimElementMetadataView candidateMetadata =
         metadataForObject(candidateObjectIndex);
-    if (candidateMetadata != nullptr &&
-        nativePointCurveObjectHasNativeDraw(*candidateMetadata)) {
+    if (candidateMetadata &&
+        nativePointCurveObjectHasNativeDraw(candidateMetadata)) {
       return;
     }
     if (candidateObjectIndex >= objectDrawCommandOffsets_.size() ||
@@ -2836,16 +2860,17 @@ void BimManager::collectDrawCommandsForObject(
 
   auto appendIndexedCommands = [&](std::span<const uint32_t> objectIndices) {
     for (uint32_t candidateObjectIndex : objectIndices) {
-      if (metadataForObject(candidateObjectIndex) != nullptr) {
+      if (metadataForObject(candidateObjectIndex)) {
         appendCommandsForObject(candidateObjectIndex);
       }
     }
   };
 
-  if (!selectedMetadata->guid.empty()) {
-    appendIndexedCommands(objectIndicesForGuid(selectedMetadata->guid));
-  } else if (!selectedMetadata->sourceId.empty()) {
-    appendIndexedCommands(objectIndicesForSourceId(selectedMetadata->sourceId));
+  if (!selectedMetadata.guid().empty()) {
+    appendIndexedCommands(objectIndicesForGuid(selectedMetadata.guid()));
+  } else if (!selectedMetadata.sourceId().empty()) {
+    appendIndexedCommands(
+        objectIndicesForSourceId(selectedMetadata.sourceId()));
   } else {
     appendCommandsForObject(objectIndex);
   }
@@ -2871,17 +2896,17 @@ void BimManager::collectNativeDrawCommandsForObject(
   if (objectIndex == std::numeric_limits<uint32_t>::max()) {
     return;
   }
-  const BimElementMetadata *selectedMetadata = metadataForObject(objectIndex);
-  if (selectedMetadata == nullptr ||
-      selectedMetadata->geometryKind != geometryKind) {
+  const BimElementMetadataView selectedMetadata =
+      metadataForObject(objectIndex);
+  if (!selectedMetadata || selectedMetadata.geometryKind() != geometryKind) {
     return;
   }
 
   auto appendCommandsForObject = [&](uint32_t candidateObjectIndex) {
-    const BimElementMetadata *candidateMetadata =
+    const BimElementMetadataView candidateMetadata =
         metadataForObject(candidateObjectIndex);
-    if (candidateMetadata == nullptr ||
-        candidateMetadata->geometryKind != geometryKind) {
+    if (!candidateMetadata ||
+        candidateMetadata.geometryKind() != geometryKind) {
       return;
     }
 
@@ -2907,10 +2932,11 @@ void BimManager::collectNativeDrawCommandsForObject(
     }
   };
 
-  if (!selectedMetadata->guid.empty()) {
-    appendIndexedCommands(objectIndicesForGuid(selectedMetadata->guid));
-  } else if (!selectedMetadata->sourceId.empty()) {
-    appendIndexedCommands(objectIndicesForSourceId(selectedMetadata->sourceId));
+  if (!selectedMetadata.guid().empty()) {
+    appendIndexedCommands(objectIndicesForGuid(selectedMetadata.guid()));
+  } else if (!selectedMetadata.sourceId().empty()) {
+    appendIndexedCommands(
+        objectIndicesForSourceId(selectedMetadata.sourceId()));
   } else {
     appendCommandsForObject(objectIndex);
   }
@@ -3015,7 +3041,7 @@ void BimManager::loadPreparedModel(
 
   uploadGeometry(uploadVertices, uploadIndices);
   buildDrawDataFromModel(model, sceneManager);
-  relationshipGraph_.build(elementMetadata_, model.relationships);
+  relationshipGraph_.build(*elementMetadata_, model.relationships);
   uploadMeshletResidencyBuffers();
   if (!hasScene()) {
     clear();
@@ -3064,7 +3090,7 @@ void BimManager::buildDrawDataFromModel(
   std::vector<PendingDraw> transparentPendingDraws;
   opaquePendingDraws.reserve(model.elements.size());
   transparentPendingDraws.reserve(model.elements.size());
-  elementMetadata_.clear();
+  elementMetadata_->clear();
   objectLodMetadata_.clear();
   metadataIndex_->clear();
   metadataCatalog_->clearLabels();
@@ -3248,34 +3274,37 @@ void BimManager::buildDrawDataFromModel(
 
   metadataCatalog_->sortStoreyRanges();
 
-  std::ranges::sort(
-      opaquePendingDraws, [](const PendingDraw &lhs, const PendingDraw &rhs) {
-        if (lhs.bucket != rhs.bucket) {
-          return bucketSortKey(lhs.bucket) < bucketSortKey(rhs.bucket);
-        }
-        if (lhs.metadata.geometryKind != rhs.metadata.geometryKind) {
-          return geometryKindSortKey(lhs.metadata.geometryKind) <
-                 geometryKindSortKey(rhs.metadata.geometryKind);
-        }
-        if (lhs.firstIndex != rhs.firstIndex) {
-          return lhs.firstIndex < rhs.firstIndex;
-        }
-        return lhs.indexCount < rhs.indexCount;
+  // Object indices follow the load-time ordering, so identical meshes end up
+  // consecutive (and instanceable) even after storey or material filtering.
+  auto orderPendingDraws = [](std::vector<PendingDraw> &draws) {
+    std::vector<BimObjectOrderKey> keys;
+    keys.reserve(draws.size());
+    for (const PendingDraw &pending : draws) {
+      const BimElementMetadata &metadata = pending.metadata;
+      keys.push_back(BimObjectOrderKey{
+          .bucket = bucketSortKey(pending.bucket),
+          .geometryKind = geometryKindSortKey(metadata.geometryKind),
+          .firstIndex = pending.firstIndex,
+          .indexCount = pending.indexCount,
+          .storey = metadata.storeyId.empty() ? metadata.storeyName
+                                              : metadata.storeyId,
+          .materialIndex = metadata.materialIndex,
+          .hasBounds = metadata.bounds.valid,
+          .center = metadata.bounds.center,
+          .floorElevation = metadata.bounds.floorElevation,
+          .sourceElementIndex = metadata.sourceElementIndex,
       });
-  std::ranges::sort(transparentPendingDraws, [](const PendingDraw &lhs,
-                                                const PendingDraw &rhs) {
-    if (lhs.bucket != rhs.bucket) {
-      return bucketSortKey(lhs.bucket) < bucketSortKey(rhs.bucket);
     }
-    if (lhs.metadata.geometryKind != rhs.metadata.geometryKind) {
-      return geometryKindSortKey(lhs.metadata.geometryKind) <
-             geometryKindSortKey(rhs.metadata.geometryKind);
+    const std::vector<uint32_t> order = orderBimObjects(keys);
+    std::vector<PendingDraw> ordered;
+    ordered.reserve(draws.size());
+    for (const uint32_t index : order) {
+      ordered.push_back(std::move(draws[index]));
     }
-    if (lhs.firstIndex != rhs.firstIndex) {
-      return lhs.firstIndex < rhs.firstIndex;
-    }
-    return lhs.indexCount < rhs.indexCount;
-  });
+    draws = std::move(ordered);
+  };
+  orderPendingDraws(opaquePendingDraws);
+  orderPendingDraws(transparentPendingDraws);
 
   auto countPendingKind = [](const std::vector<PendingDraw> &draws,
                              BimGeometryKind kind) {
@@ -3306,7 +3335,7 @@ void BimManager::buildDrawDataFromModel(
   objectDrawCommands_.reserve(totalDraws + floorPlanDrawCount);
   objectDrawCommandOffsets_.reserve(totalDraws + floorPlanDrawCount);
   objectDrawCommandCounts_.reserve(totalDraws + floorPlanDrawCount);
-  elementMetadata_.reserve(totalDraws);
+  elementMetadata_->reserve(totalDraws);
   objectLodMetadata_.reserve(totalDraws);
   opaqueDrawCommands_.reserve(opaqueMeshDrawCount);
   opaqueSingleSidedDrawCommands_.reserve(opaqueMeshDrawCount);
@@ -3352,16 +3381,15 @@ void BimManager::buildDrawDataFromModel(
                         std::numeric_limits<uint32_t>::max())));
     (void)insertedProduct;
     metadata.productIdentityId = productIt->second;
-    elementMetadata_.push_back(std::move(metadata));
-    metadataIndex_->index(elementMetadata_.back());
+    metadataIndex_->index(metadata);
+    elementMetadata_->append(metadata);
     BimObjectLodStreamingMetadata lodMetadata{};
     lodMetadata.objectIndex = objectIndex;
-    lodMetadata.sourceElementIndex = elementMetadata_.back().sourceElementIndex;
-    lodMetadata.meshId = elementMetadata_.back().meshId;
-    lodMetadata.geometryKind = elementMetadata_.back().geometryKind;
-    if (elementMetadata_.back().geometryKind == BimGeometryKind::Mesh) {
-      if (const auto spanIt =
-              clusterSpansByMeshId.find(elementMetadata_.back().meshId);
+    lodMetadata.sourceElementIndex = metadata.sourceElementIndex;
+    lodMetadata.meshId = metadata.meshId;
+    lodMetadata.geometryKind = metadata.geometryKind;
+    if (metadata.geometryKind == BimGeometryKind::Mesh) {
+      if (const auto spanIt = clusterSpansByMeshId.find(metadata.meshId);
           spanIt != clusterSpansByMeshId.end()) {
         lodMetadata.firstCluster = spanIt->second.firstCluster;
         lodMetadata.clusterCount = spanIt->second.clusterCount;
@@ -3510,7 +3538,7 @@ void BimManager::loadGltfFallback(
       static_cast<uint32_t>(objectDrawCommands_.size()));
   metadataCatalog_->clearLabels();
   const uint32_t semanticTypeId = metadataCatalog_->registerType("glTF");
-  elementMetadata_.push_back(BimElementMetadata{
+  const BimElementMetadata metadata{
       .objectIndex = 0u,
       .sourceElementIndex = 0u,
       .meshId = 0u,
@@ -3519,8 +3547,9 @@ void BimManager::loadGltfFallback(
       .productIdentityId = 1u,
       .type = "glTF",
       .sourceId = container::util::pathToUtf8(path.lexically_normal()),
-  });
-  metadataIndex_->index(elementMetadata_.back());
+  };
+  metadataIndex_->index(metadata);
+  elementMetadata_->append(metadata);
 
   opaqueDrawCommands_.reserve(model.primitiveRanges().size());
   opaqueSingleSidedDrawCommands_.reserve(model.primitiveRanges().size());
@@ -3548,7 +3577,7 @@ void BimManager::loadGltfFallback(
   }
   objectDrawCommandCounts_.push_back(objectDrawCommandCount);
 
-  relationshipGraph_.build(elementMetadata_);
+  relationshipGraph_.build(*elementMetadata_);
   uploadObjects();
   uploadVisibilityFilterBuffers();
   if (!hasScene()) {
@@ -3562,6 +3591,7 @@ void BimManager::uploadGeometry(
     std::span<const uint32_t> indices) {
   vertices_.clear();
   indices_.clear();
+  snapFeatureGrids_.clear();
   if (vertices.empty() || indices.empty()) {
     return;
   }
@@ -4073,9 +4103,9 @@ void BimManager::updateVisibilityFilterSettings(const BimDrawFilter &filter) {
       filter.selectedObjectIndex != std::numeric_limits<uint32_t>::max()) {
     settings.flags |= kBimVisibilityFilterHideSelection;
   }
-  if (const BimElementMetadata *selected =
+  if (const BimElementMetadataView selected =
           metadataForObject(filter.selectedObjectIndex)) {
-    settings.selectedProductId = selected->productIdentityId;
+    settings.selectedProductId = selected.productIdentityId();
   }
 
   const bool settingsChanged =
@@ -4642,14 +4672,14 @@ void BimManager::drawCompactedOpaqueSingleSided(VkCommandBuffer cmd) const {
 
 void BimManager::uploadVisibilityFilterBuffers() {
   destroyVisibilityFilterBuffers();
-  if (elementMetadata_.empty()) {
+  if (elementMetadata_->empty()) {
     return;
   }
 
-  visibilityFilterMetadata_.reserve(elementMetadata_.size());
+  visibilityFilterMetadata_.reserve(elementMetadata_->size());
   std::vector<uint32_t> visibilityMask;
-  visibilityMask.reserve(elementMetadata_.size());
-  for (const BimElementMetadata &metadata : elementMetadata_) {
+  visibilityMask.reserve(elementMetadata_->size());
+  for (const BimElementMetadataView metadata : *elementMetadata_) {
     visibilityFilterMetadata_.push_back(
         metadataCatalog_->visibilityGpuMetadata(metadata));
     visibilityMask.push_back(1u);
@@ -1,7 +1,6 @@
 #include "Container/renderer/bim/BimMetadataCatalog.h"
 
 #include <algorithm>
-#include <iterator>
 #include <limits>
 #include <string>
 #include <string_view>
@@ -14,22 +13,6 @@ uint32_t semanticIdFromZeroBased(uint32_t id) {
   return id == std::numeric_limits<uint32_t>::max() ? 0u : id + 1u;
 }
 
-uint32_t semanticIdFromLabel(std::string_view label,
-                             const std::vector<std::string> &values) {
-  if (label.empty()) {
-    return 0u;
-  }
-  const auto it = std::ranges::find(values, label);
-  if (it == values.end()) {
-    return 0u;
-  }
-  const size_t offset = static_cast<size_t>(std::distance(values.begin(), it));
-  if (offset >= std::numeric_limits<uint32_t>::max()) {
-    return 0u;
-  }
-  return static_cast<uint32_t>(offset + 1u);
-}
-
 } // namespace
 
 std::string bimMetadataStoreyLabel(const BimElementMetadata &metadata) {
@@ -141,8 +124,7 @@ const std::vector<BimStoreyRange> &BimMetadataCatalog::storeyRanges() const {
 }
 
 uint32_t BimMetadataCatalog::registerUniqueLabel(
-    std::unordered_map<std::string, uint32_t> &ids,
-    std::vector<std::string> &values, std::string label) {
+    LabelIdMap &ids, std::vector<std::string> &values, std::string label) {
   if (label.empty()) {
     return std::numeric_limits<uint32_t>::max();
   }
@@ -160,7 +142,16 @@ uint32_t BimMetadataCatalog::registerType(std::string label) {
 
 void BimMetadataCatalog::registerStorey(const BimElementMetadata &metadata,
                                         const BimElementBounds &bounds) {
-  const std::string label = bimMetadataStoreyLabel(metadata);
+  registerStoreyLabel(bimMetadataStoreyLabel(metadata), bounds);
+}
+
+void BimMetadataCatalog::registerStorey(BimElementMetadataView metadata,
+                                        const BimElementBounds &bounds) {
+  registerStoreyLabel(std::string(bimMetadataStoreyLabel(metadata)), bounds);
+}
+
+void BimMetadataCatalog::registerStoreyLabel(std::string label,
+                                             const BimElementBounds &bounds) {
   if (label.empty()) {
     return;
   }
@@ -192,6 +183,11 @@ void BimMetadataCatalog::registerMaterial(const BimElementMetadata &metadata) {
                       bimMetadataMaterialLabel(metadata));
 }
 
+void BimMetadataCatalog::registerMaterial(BimElementMetadataView metadata) {
+  registerUniqueLabel(materialIds_, materials_,
+                      std::string(bimMetadataMaterialLabel(metadata)));
+}
+
 void BimMetadataCatalog::registerDiscipline(std::string label) {
   registerUniqueLabel(disciplineIds_, disciplines_, std::move(label));
 }
@@ -222,37 +218,61 @@ void BimMetadataCatalog::sortStoreyRanges() {
                     });
 }
 
-uint32_t
-BimMetadataCatalog::semanticIdForCategory(BimMetadataSemanticCategory category,
-                                          std::string_view label) const {
+const BimMetadataCatalog::LabelIdMap &
+BimMetadataCatalog::labelIds(BimMetadataSemanticCategory category) const {
   switch (category) {
   case BimMetadataSemanticCategory::Type:
-    return semanticIdFromLabel(label, types_);
+    return typeIds_;
   case BimMetadataSemanticCategory::Storey:
-    return semanticIdFromLabel(label, storeys_);
+    return storeyIds_;
   case BimMetadataSemanticCategory::Material:
-    return semanticIdFromLabel(label, materials_);
+    return materialIds_;
   case BimMetadataSemanticCategory::Discipline:
-    return semanticIdFromLabel(label, disciplines_);
+    return disciplineIds_;
   case BimMetadataSemanticCategory::Phase:
-    return semanticIdFromLabel(label, phases_);
+    return phaseIds_;
   case BimMetadataSemanticCategory::FireRating:
-    return semanticIdFromLabel(label, fireRatings_);
+    return fireRatingIds_;
   case BimMetadataSemanticCategory::LoadBearing:
-    return semanticIdFromLabel(label, loadBearingValues_);
+    return loadBearingIds_;
   case BimMetadataSemanticCategory::Status:
-    return semanticIdFromLabel(label, statuses_);
+    return statusIds_;
   }
-  return 0u;
+  return typeIds_;
+}
+
+uint32_t
+BimMetadataCatalog::labelIdForCategory(BimMetadataSemanticCategory category,
+                                       std::string_view label) const {
+  if (label.empty()) {
+    return std::numeric_limits<uint32_t>::max();
+  }
+  const LabelIdMap &ids = labelIds(category);
+  const auto it = ids.find(label);
+  if (it == ids.end()) {
+    return std::numeric_limits<uint32_t>::max();
+  }
+  return it->second;
+}
+
+size_t BimMetadataCatalog::labelCountForCategory(
+    BimMetadataSemanticCategory category) const {
+  return labelIds(category).size();
+}
+
+uint32_t
+BimMetadataCatalog::semanticIdForCategory(BimMetadataSemanticCategory category,
+                                          std::string_view label) const {
+  return semanticIdFromZeroBased(labelIdForCategory(category, label));
 }
 
 uint32_t
-BimMetadataCatalog::semanticIdForMetadata(const BimElementMetadata &metadata,
+BimMetadataCatalog::semanticIdForMetadata(BimElementMetadataView metadata,
                                           BimSemanticColorMode mode) const {
   switch (mode) {
   case BimSemanticColorMode::Type:
   case BimSemanticColorMode::Off:
-    return semanticIdFromZeroBased(metadata.semanticTypeId);
+    return semanticIdFromZeroBased(metadata.semanticTypeId());
   case BimSemanticColorMode::Storey:
     return semanticIdForCategory(BimMetadataSemanticCategory::Storey,
                                  bimMetadataStoreyLabel(metadata));
@@ -261,42 +281,43 @@ BimMetadataCatalog::semanticIdForMetadata(const BimElementMetadata &metadata,
                                  bimMetadataMaterialLabel(metadata));
   case BimSemanticColorMode::FireRating:
     return semanticIdForCategory(BimMetadataSemanticCategory::FireRating,
-                                 metadata.fireRating);
+                                 metadata.fireRating());
   case BimSemanticColorMode::LoadBearing:
     return semanticIdForCategory(BimMetadataSemanticCategory::LoadBearing,
-                                 metadata.loadBearing);
+                                 metadata.loadBearing());
   case BimSemanticColorMode::Status:
     return semanticIdForCategory(BimMetadataSemanticCategory::Status,
-                                 metadata.status);
+                                 metadata.status());
   }
   return 0u;
 }
 
 BimVisibilityGpuObjectMetadata BimMetadataCatalog::visibilityGpuMetadata(
-    const BimElementMetadata &metadata) const {
+    BimElementMetadataView metadata) const {
   BimVisibilityGpuObjectMetadata gpuMetadata{};
   gpuMetadata.semanticIds = {
-      semanticIdFromZeroBased(metadata.semanticTypeId),
+      semanticIdFromZeroBased(metadata.semanticTypeId()),
       semanticIdForCategory(BimMetadataSemanticCategory::Storey,
                             bimMetadataStoreyLabel(metadata)),
       semanticIdForCategory(BimMetadataSemanticCategory::Material,
                             bimMetadataMaterialLabel(metadata)),
       semanticIdForCategory(BimMetadataSemanticCategory::Discipline,
-                            metadata.discipline),
+                            metadata.discipline()),
   };
   gpuMetadata.propertyIds = {
-      semanticIdForCategory(BimMetadataSemanticCategory::Phase, metadata.phase),
+      semanticIdForCategory(BimMetadataSemanticCategory::Phase,
+                            metadata.phase()),
       semanticIdForCategory(BimMetadataSemanticCategory::FireRating,
-                            metadata.fireRating),
+                            metadata.fireRating()),
       semanticIdForCategory(BimMetadataSemanticCategory::LoadBearing,
-                            metadata.loadBearing),
+                            metadata.loadBearing()),
       semanticIdForCategory(BimMetadataSemanticCategory::Status,
-                            metadata.status),
+                            metadata.status()),
   };
   gpuMetadata.identity = {
-      metadata.productIdentityId,
-      metadata.objectIndex,
-      static_cast<uint32_t>(metadata.geometryKind),
+      metadata.productIdentityId(),
+      metadata.objectIndex(),
+      static_cast<uint32_t>(metadata.geometryKind()),
       0u,
   };
   return gpuMetadata;
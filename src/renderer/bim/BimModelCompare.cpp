@@ -1,15 +1,66 @@
 #include "Container/renderer/bim/BimModelCompare.h"
 
+#include "Container/utility/ParallelRanges.h"
+
 #include <algorithm>
+#include <bit>
 #include <cmath>
-#include <map>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
 namespace container::renderer {
 namespace {
 
+constexpr uint64_t kFnvOffset = 14695981039346656037ull;
+constexpr uint64_t kFnvPrime = 1099511628211ull;
+constexpr uint32_t kInvalidGroup = std::numeric_limits<uint32_t>::max();
+constexpr size_t kMinElementsPerWorker = 16384u;
+
+enum class MatchPhase : uint8_t {
+  Guid = 0,
+  SourceId = 1,
+};
+
+enum ChangeMask : uint8_t {
+  kTypeChanged = 1u << 0u,
+  kStoreyChanged = 1u << 1u,
+  kMaterialChanged = 1u << 2u,
+  kBoundsChanged = 1u << 3u,
+};
+
+[[nodiscard]] uint64_t appendFnv1a(uint64_t hash, std::string_view text) {
+  for (const char character : text) {
+    hash ^= static_cast<uint8_t>(character);
+    hash *= kFnvPrime;
+  }
+  return hash;
+}
+
+[[nodiscard]] uint64_t appendFnv1a(uint64_t hash, uint32_t value) {
+  for (uint32_t byte = 0; byte < 4u; ++byte) {
+    hash ^= (value >> (byte * 8u)) & 0xffu;
+    hash *= kFnvPrime;
+  }
+  return hash;
+}
+
+// FNV-1a spreads poorly into the low bits used for table slots, so every
+// finished hash goes through a splitmix64 finalizer.
+[[nodiscard]] uint64_t finishHash(uint64_t hash) {
+  hash ^= hash >> 30u;
+  hash *= 0xbf58476d1ce4e5b9ull;
+  hash ^= hash >> 27u;
+  hash *= 0x94d049bb133111ebull;
+  hash ^= hash >> 31u;
+  return hash;
+}
+
+[[nodiscard]] uint64_t hashKey(std::string_view text) {
+  return finishHash(appendFnv1a(kFnvOffset, text));
+}
+
 [[nodiscard]] bool finiteVec3(const glm::vec3& value) {
   return std::isfinite(value.x) && std::isfinite(value.y) &&
          std::isfinite(value.z);
@@ -21,13 +72,9 @@ namespace {
          bounds.max.z >= bounds.min.z;
 }
 
-[[nodiscard]] std::string identityKey(const BimModelCompareElement& element) {
-  return !element.guid.empty() ? element.guid : element.sourceId;
-}
-
-[[nodiscard]] std::string identityValue(
+[[nodiscard]] std::string_view identityValue(
     const BimModelCompareElement& element) {
-  return identityKey(element);
+  return !element.guid.empty() ? element.guid : element.sourceId;
 }
 
 [[nodiscard]] std::string typeValue(const BimModelCompareElement& element) {
@@ -40,156 +87,226 @@ namespace {
   return element.ifcClass;
 }
 
-struct IndexedElement {
-  size_t index{0};
-  const BimModelCompareElement* element{nullptr};
-};
+// Hashes the same byte sequence typeValue() would build, without building it.
+[[nodiscard]] uint64_t appendTypeValue(uint64_t hash,
+                                       const BimModelCompareElement& element) {
+  if (!element.ifcClass.empty() && !element.type.empty()) {
+    hash = appendFnv1a(hash, element.ifcClass);
+    hash = appendFnv1a(hash, std::string_view(" / "));
+    return appendFnv1a(hash, element.type);
+  }
+  return appendFnv1a(hash, element.type.empty() ? element.ifcClass
+                                                : element.type);
+}
 
-struct MatchedPair {
-  IndexedElement before{};
-  IndexedElement after{};
-  std::string identity{};
-  size_t occurrence{1};
-};
+// Field separators keep ("ab", "c") and ("a", "bc") apart.
+[[nodiscard]] uint64_t propertyFingerprint(
+    const BimModelCompareElement& element) {
+  uint64_t hash = appendTypeValue(kFnvOffset, element);
+  hash = appendFnv1a(hash, std::string_view("\x1f", 1u));
+  hash = appendFnv1a(hash, element.storey);
+  hash = appendFnv1a(hash, std::string_view("\x1f", 1u));
+  hash = appendFnv1a(hash, element.material);
+  return finishHash(hash);
+}
 
-struct MatchPlan {
-  std::vector<MatchedPair> pairs{};
-  std::vector<IndexedElement> unmatchedBefore{};
-  std::vector<IndexedElement> unmatchedAfter{};
-};
+// Invalid bounds all compare equal, so they share one fingerprint. Valid
+// bounds hash their exact bits; a mismatch falls back to the tolerance test.
+[[nodiscard]] uint64_t geometryFingerprint(
+    const BimModelCompareBounds& bounds) {
+  if (!validBounds(bounds)) {
+    return 0u;
+  }
+  uint64_t hash = appendFnv1a(kFnvOffset, 1u);
+  for (const float value : {bounds.min.x, bounds.min.y, bounds.min.z,
+                            bounds.max.x, bounds.max.y, bounds.max.z}) {
+    hash = appendFnv1a(hash, std::bit_cast<uint32_t>(value));
+  }
+  return finishHash(hash) | 1u;
+}
 
-using IdentityGroups = std::map<std::string, std::vector<size_t>>;
+struct ElementFingerprint {
+  uint64_t guid{0};
+  uint64_t sourceId{0};
+  uint64_t properties{0};
+  uint64_t geometry{0};
+};
 
-[[nodiscard]] IdentityGroups groupByGuid(
-    std::span<const BimModelCompareElement> elements) {
-  IdentityGroups groups;
-  for (size_t index = 0; index < elements.size(); ++index) {
-    if (elements[index].guid.empty()) {
-      continue;
-    }
-    groups[elements[index].guid].push_back(index);
-  }
-  return groups;
+template <typename Fn>
+void forEachRange(size_t count, const BimModelCompareOptions& options,
+                  const Fn& fn) {
+  container::util::forEachParallelRange(
+      count,
+      container::util::parallelWorkerCount(count, options.workerCount,
+                                           kMinElementsPerWorker),
+      fn);
 }
 
-void appendIndexedElement(std::vector<IndexedElement>& output,
-                          std::span<const BimModelCompareElement> elements,
-                          size_t index) {
-  output.push_back({.index = index, .element = &elements[index]});
+[[nodiscard]] std::vector<ElementFingerprint> fingerprintElements(
+    std::span<const BimModelCompareElement> elements,
+    const BimModelCompareOptions& options) {
+  std::vector<ElementFingerprint> fingerprints(elements.size());
+  forEachRange(elements.size(), options, [&](size_t begin, size_t end) {
+    for (size_t index = begin; index < end; ++index) {
+      const BimModelCompareElement& element = elements[index];
+      fingerprints[index] = {
+          .guid = element.guid.empty() ? 0u : hashKey(element.guid),
+          .sourceId = element.sourceId.empty() ? 0u : hashKey(element.sourceId),
+          .properties = propertyFingerprint(element),
+          .geometry = geometryFingerprint(element.bounds)};
+    }
+  });
+  return fingerprints;
 }
 
-void appendOccurrenceMatches(MatchPlan& plan,
-                             std::span<const BimModelCompareElement> before,
-                             std::span<const BimModelCompareElement> after,
-                             std::string_view identity,
-                             const std::vector<size_t>& beforeIndices,
-                             const std::vector<size_t>& afterIndices,
-                             std::vector<bool>& beforeMatched,
-                             std::vector<bool>& afterMatched) {
-  const size_t matchedCount = std::min(beforeIndices.size(),
-                                       afterIndices.size());
-  for (size_t occurrence = 0; occurrence < matchedCount; ++occurrence) {
-    const size_t beforeIndex = beforeIndices[occurrence];
-    const size_t afterIndex = afterIndices[occurrence];
-    beforeMatched[beforeIndex] = true;
-    afterMatched[afterIndex] = true;
-    plan.pairs.push_back({.before = {.index = beforeIndex,
-                                     .element = &before[beforeIndex]},
-                          .after = {.index = afterIndex,
-                                    .element = &after[afterIndex]},
-                          .identity = std::string(identity),
-                          .occurrence = occurrence + 1u});
+// Open-addressing map from a hashed identity string to a dense group id.
+// Hash hits are confirmed with a string compare, so grouping stays exact.
+class IdentityTable {
+public:
+  explicit IdentityTable(size_t maxKeys) {
+    const size_t capacity =
+        std::bit_ceil(std::max<size_t>(16u, maxKeys + maxKeys / 2u + 1u));
+    slots_.resize(capacity);
+    keys_.reserve(maxKeys);
   }
-}
 
-void matchByGuid(MatchPlan& plan,
-                 std::span<const BimModelCompareElement> before,
-                 std::span<const BimModelCompareElement> after,
-                 std::vector<bool>& beforeMatched,
-                 std::vector<bool>& afterMatched) {
-  const IdentityGroups beforeGroups = groupByGuid(before);
-  const IdentityGroups afterGroups = groupByGuid(after);
-  for (const auto& [guid, beforeIndices] : beforeGroups) {
-    const auto afterFound = afterGroups.find(guid);
-    if (afterFound == afterGroups.end()) {
-      continue;
+  [[nodiscard]] uint32_t findOrInsert(std::string_view key, uint64_t hash) {
+    size_t slot = slotFor(key, hash);
+    if (slots_[slot].group == kInvalidGroup) {
+      slots_[slot] = {.hash = hash,
+                      .group = static_cast<uint32_t>(keys_.size())};
+      keys_.push_back(key);
     }
-    appendOccurrenceMatches(plan, before, after, guid, beforeIndices,
-                            afterFound->second, beforeMatched, afterMatched);
+    return slots_[slot].group;
   }
-}
 
-[[nodiscard]] IdentityGroups groupUnmatchedBySourceId(
-    std::span<const BimModelCompareElement> elements,
-    const std::vector<bool>& matched) {
-  IdentityGroups groups;
-  for (size_t index = 0; index < elements.size(); ++index) {
-    if (matched[index] || elements[index].sourceId.empty()) {
-      continue;
-    }
-    groups[elements[index].sourceId].push_back(index);
+  [[nodiscard]] uint32_t find(std::string_view key, uint64_t hash) const {
+    return slots_[slotFor(key, hash)].group;
   }
-  return groups;
-}
 
-void matchBySourceId(MatchPlan& plan,
-                     std::span<const BimModelCompareElement> before,
-                     std::span<const BimModelCompareElement> after,
-                     std::vector<bool>& beforeMatched,
-                     std::vector<bool>& afterMatched) {
-  const IdentityGroups beforeGroups =
-      groupUnmatchedBySourceId(before, beforeMatched);
-  const IdentityGroups afterGroups = groupUnmatchedBySourceId(after, afterMatched);
-  for (const auto& [sourceId, beforeIndices] : beforeGroups) {
-    const auto afterFound = afterGroups.find(sourceId);
-    if (afterFound == afterGroups.end()) {
-      continue;
+  [[nodiscard]] size_t size() const { return keys_.size(); }
+
+private:
+  struct Slot {
+    uint64_t hash{0};
+    uint32_t group{kInvalidGroup};
+  };
+
+  [[nodiscard]] size_t slotFor(std::string_view key, uint64_t hash) const {
+    const size_t mask = slots_.size() - 1u;
+    size_t slot = static_cast<size_t>(hash) & mask;
+    while (slots_[slot].group != kInvalidGroup &&
+           (slots_[slot].hash != hash || keys_[slots_[slot].group] != key)) {
+      slot = (slot + 1u) & mask;
     }
-    appendOccurrenceMatches(plan, before, after, sourceId, beforeIndices,
-                            afterFound->second, beforeMatched, afterMatched);
+    return slot;
   }
+
+  std::vector<Slot> slots_{};
+  std::vector<std::string_view> keys_{};
+};
+
+struct MatchedPair {
+  size_t beforeIndex{0};
+  size_t afterIndex{0};
+  uint32_t group{0};
+  uint32_t occurrence{1};
+  MatchPhase phase{MatchPhase::Guid};
+};
+
+[[nodiscard]] std::string_view phaseKey(const BimModelCompareElement& element,
+                                        MatchPhase phase) {
+  return phase == MatchPhase::Guid ? std::string_view(element.guid)
+                                   : std::string_view(element.sourceId);
 }
 
-[[nodiscard]] MatchPlan matchElements(
-    std::span<const BimModelCompareElement> before,
-    std::span<const BimModelCompareElement> after) {
-  MatchPlan plan;
-  std::vector<bool> beforeMatched(before.size(), false);
-  std::vector<bool> afterMatched(after.size(), false);
-  matchByGuid(plan, before, after, beforeMatched, afterMatched);
-  matchBySourceId(plan, before, after, beforeMatched, afterMatched);
+[[nodiscard]] uint64_t phaseHash(const ElementFingerprint& fingerprint,
+                                 MatchPhase phase) {
+  return phase == MatchPhase::Guid ? fingerprint.guid : fingerprint.sourceId;
+}
 
+// Pairs the k-th unmatched before occurrence of a key with its k-th unmatched
+// after occurrence, scanning each revision once in index order.
+void matchPhase(MatchPhase phase,
+                std::span<const BimModelCompareElement> before,
+                std::span<const BimModelCompareElement> after,
+                const std::vector<ElementFingerprint>& beforeFingerprints,
+                const std::vector<ElementFingerprint>& afterFingerprints,
+                std::vector<uint8_t>& beforeMatched,
+                std::vector<uint8_t>& afterMatched,
+                std::vector<MatchedPair>& pairs) {
+  const auto candidate = [phase](const BimModelCompareElement& element,
+                                 uint8_t matched) {
+    return matched == 0u && !phaseKey(element, phase).empty();
+  };
+
+  size_t candidateCount = 0;
+  for (size_t index = 0; index < before.size(); ++index) {
+    candidateCount += candidate(before[index], beforeMatched[index]) ? 1u : 0u;
+  }
+  if (candidateCount == 0u) {
+    return;
+  }
+
+  IdentityTable table(candidateCount);
+  std::vector<uint32_t> beforeGroups(before.size(), kInvalidGroup);
   for (size_t index = 0; index < before.size(); ++index) {
-    if (!beforeMatched[index] && !identityValue(before[index]).empty()) {
-      appendIndexedElement(plan.unmatchedBefore, before, index);
+    if (candidate(before[index], beforeMatched[index])) {
+      beforeGroups[index] =
+          table.findOrInsert(phaseKey(before[index], phase),
+                             phaseHash(beforeFingerprints[index], phase));
     }
   }
-  for (size_t index = 0; index < after.size(); ++index) {
-    if (!afterMatched[index] && !identityValue(after[index]).empty()) {
-      appendIndexedElement(plan.unmatchedAfter, after, index);
+
+  std::vector<uint32_t> groupOffsets(table.size() + 1u, 0u);
+  for (const uint32_t group : beforeGroups) {
+    if (group != kInvalidGroup) {
+      ++groupOffsets[group + 1u];
+    }
+  }
+  for (size_t group = 0; group < table.size(); ++group) {
+    groupOffsets[group + 1u] += groupOffsets[group];
+  }
+  std::vector<uint32_t> groupFill(groupOffsets.begin(), groupOffsets.end() - 1);
+  std::vector<size_t> groupIndices(candidateCount);
+  for (size_t index = 0; index < before.size(); ++index) {
+    if (beforeGroups[index] != kInvalidGroup) {
+      groupIndices[groupFill[beforeGroups[index]]++] = index;
     }
   }
-  return plan;
-}
 
-[[nodiscard]] size_t occurrenceInSpan(
-    std::span<const BimModelCompareElement> elements, size_t index) {
-  size_t occurrence = 0;
-  const std::string identity = identityValue(elements[index]);
-  for (size_t candidate = 0; candidate <= index; ++candidate) {
-    if (identityValue(elements[candidate]) == identity) {
-      ++occurrence;
+  std::vector<uint32_t> afterOccurrences(table.size(), 0u);
+  for (size_t index = 0; index < after.size(); ++index) {
+    if (!candidate(after[index], afterMatched[index])) {
+      continue;
     }
+    const uint32_t group =
+        table.find(phaseKey(after[index], phase),
+                   phaseHash(afterFingerprints[index], phase));
+    if (group == kInvalidGroup) {
+      continue;
+    }
+    const uint32_t occurrence = afterOccurrences[group]++;
+    if (occurrence >= groupOffsets[group + 1u] - groupOffsets[group]) {
+      continue;
+    }
+    const size_t beforeIndex = groupIndices[groupOffsets[group] + occurrence];
+    beforeMatched[beforeIndex] = 1u;
+    afterMatched[index] = 1u;
+    pairs.push_back({.beforeIndex = beforeIndex,
+                     .afterIndex = index,
+                     .group = group,
+                     .occurrence = occurrence + 1u,
+                     .phase = phase});
   }
-  return occurrence;
 }
 
-[[nodiscard]] std::string occurrenceIdentity(std::string identity,
+[[nodiscard]] std::string occurrenceIdentity(std::string_view identity,
                                              size_t occurrence) {
   if (occurrence <= 1u) {
-    return identity;
+    return std::string(identity);
   }
-  return identity + "#" + std::to_string(occurrence);
+  return std::string(identity) + "#" + std::to_string(occurrence);
 }
 
 [[nodiscard]] bool componentChanged(float before, float after,
@@ -217,6 +334,32 @@ void matchBySourceId(MatchPlan& plan,
          componentChanged(before.max.z, after.max.z, clampedTolerance);
 }
 
+// Equal fingerprints mean the pair is unchanged; only mismatching pairs pay
+// for string and tolerance comparisons.
+[[nodiscard]] uint8_t classifyPair(const BimModelCompareElement& oldElement,
+                                   const BimModelCompareElement& newElement,
+                                   const ElementFingerprint& oldFingerprint,
+                                   const ElementFingerprint& newFingerprint,
+                                   float tolerance) {
+  uint8_t mask = 0u;
+  if (oldFingerprint.properties != newFingerprint.properties) {
+    if (typeValue(oldElement) != typeValue(newElement)) {
+      mask |= kTypeChanged;
+    }
+    if (oldElement.storey != newElement.storey) {
+      mask |= kStoreyChanged;
+    }
+    if (oldElement.material != newElement.material) {
+      mask |= kMaterialChanged;
+    }
+  }
+  if (oldFingerprint.geometry != newFingerprint.geometry &&
+      boundsChanged(oldElement.bounds, newElement.bounds, tolerance)) {
+    mask |= kBoundsChanged;
+  }
+  return mask;
+}
+
 void appendChange(BimModelCompareResult& result,
                   BimModelCompareChangeKind kind, std::string identity,
                   size_t beforeIndex, size_t afterIndex,
@@ -229,56 +372,136 @@ void appendChange(BimModelCompareResult& result,
                             .afterValue = std::move(afterValue)});
 }
 
+// Unmatched elements are reported in index order; their occurrence counts
+// every element of the revision sharing the same identity up to that index.
+void appendUnmatched(BimModelCompareResult& result,
+                     BimModelCompareChangeKind kind,
+                     std::span<const BimModelCompareElement> elements,
+                     const std::vector<ElementFingerprint>& fingerprints,
+                     const std::vector<uint8_t>& matched) {
+  size_t lastUnmatched = elements.size();
+  for (size_t index = elements.size(); index > 0u; --index) {
+    if (matched[index - 1u] == 0u &&
+        !identityValue(elements[index - 1u]).empty()) {
+      lastUnmatched = index - 1u;
+      break;
+    }
+  }
+  if (lastUnmatched == elements.size()) {
+    return;
+  }
+
+  IdentityTable table(lastUnmatched + 1u);
+  std::vector<uint32_t> occurrences;
+  occurrences.reserve(lastUnmatched + 1u);
+  for (size_t index = 0; index <= lastUnmatched; ++index) {
+    const BimModelCompareElement& element = elements[index];
+    const std::string_view identity = identityValue(element);
+    if (identity.empty()) {
+      continue;
+    }
+    const uint64_t hash = !element.guid.empty() ? fingerprints[index].guid
+                                                : fingerprints[index].sourceId;
+    const uint32_t group = table.findOrInsert(identity, hash);
+    if (group == occurrences.size()) {
+      occurrences.push_back(0u);
+    }
+    const uint32_t occurrence = ++occurrences[group];
+    if (matched[index] != 0u) {
+      continue;
+    }
+    const bool removed = kind == BimModelCompareChangeKind::Removed;
+    appendChange(result, kind, occurrenceIdentity(identity, occurrence),
+                 removed ? index : std::numeric_limits<size_t>::max(),
+                 removed ? std::numeric_limits<size_t>::max() : index);
+  }
+}
+
 } // namespace
 
 BimModelCompareResult compareBimModels(
     std::span<const BimModelCompareElement> before,
     std::span<const BimModelCompareElement> after,
     const BimModelCompareOptions& options) {
-  const MatchPlan matchPlan = matchElements(before, after);
+  const std::vector<ElementFingerprint> beforeFingerprints =
+      fingerprintElements(before, options);
+  const std::vector<ElementFingerprint> afterFingerprints =
+      fingerprintElements(after, options);
+
+  std::vector<uint8_t> beforeMatched(before.size(), 0u);
+  std::vector<uint8_t> afterMatched(after.size(), 0u);
+  std::vector<MatchedPair> pairs;
+  pairs.reserve(std::min(before.size(), after.size()));
+  for (const MatchPhase phase : {MatchPhase::Guid, MatchPhase::SourceId}) {
+    matchPhase(phase, before, after, beforeFingerprints, afterFingerprints,
+               beforeMatched, afterMatched, pairs);
+  }
+
+  std::vector<uint8_t> changeMasks(pairs.size(), 0u);
+  forEachRange(pairs.size(), options, [&](size_t begin, size_t end) {
+    for (size_t pairIndex = begin; pairIndex < end; ++pairIndex) {
+      const MatchedPair& pair = pairs[pairIndex];
+      changeMasks[pairIndex] = classifyPair(
+          before[pair.beforeIndex], after[pair.afterIndex],
+          beforeFingerprints[pair.beforeIndex],
+          afterFingerprints[pair.afterIndex], options.boundsTolerance);
+    }
+  });
+
+  // Changed pairs are reported GUID matches first, then source id matches,
+  // each ordered by identity and occurrence.
+  std::vector<uint32_t> changedPairs;
+  for (size_t pairIndex = 0; pairIndex < pairs.size(); ++pairIndex) {
+    if (changeMasks[pairIndex] != 0u) {
+      changedPairs.push_back(static_cast<uint32_t>(pairIndex));
+    }
+  }
+  std::ranges::sort(changedPairs, [&](uint32_t lhsIndex, uint32_t rhsIndex) {
+    const MatchedPair& lhs = pairs[lhsIndex];
+    const MatchedPair& rhs = pairs[rhsIndex];
+    if (lhs.phase != rhs.phase) {
+      return lhs.phase < rhs.phase;
+    }
+    if (lhs.group == rhs.group) {
+      return lhs.occurrence < rhs.occurrence;
+    }
+    return phaseKey(before[lhs.beforeIndex], lhs.phase) <
+           phaseKey(before[rhs.beforeIndex], rhs.phase);
+  });
+
   BimModelCompareResult result{};
-  for (const MatchedPair& pair : matchPlan.pairs) {
-    const BimModelCompareElement& oldElement = *pair.before.element;
-    const BimModelCompareElement& newElement = *pair.after.element;
-    const std::string identity =
-        occurrenceIdentity(pair.identity, pair.occurrence);
-    if (typeValue(oldElement) != typeValue(newElement)) {
+  for (const uint32_t pairIndex : changedPairs) {
+    const MatchedPair& pair = pairs[pairIndex];
+    const uint8_t mask = changeMasks[pairIndex];
+    const BimModelCompareElement& oldElement = before[pair.beforeIndex];
+    const BimModelCompareElement& newElement = after[pair.afterIndex];
+    const std::string identity = occurrenceIdentity(
+        phaseKey(oldElement, pair.phase), pair.occurrence);
+    if ((mask & kTypeChanged) != 0u) {
       appendChange(result, BimModelCompareChangeKind::ChangedType, identity,
-                   pair.before.index, pair.after.index, typeValue(oldElement),
+                   pair.beforeIndex, pair.afterIndex, typeValue(oldElement),
                    typeValue(newElement));
     }
-    if (oldElement.storey != newElement.storey) {
+    if ((mask & kStoreyChanged) != 0u) {
       appendChange(result, BimModelCompareChangeKind::ChangedStorey, identity,
-                   pair.before.index, pair.after.index, oldElement.storey,
+                   pair.beforeIndex, pair.afterIndex, oldElement.storey,
                    newElement.storey);
     }
-    if (oldElement.material != newElement.material) {
+    if ((mask & kMaterialChanged) != 0u) {
       appendChange(result, BimModelCompareChangeKind::ChangedMaterial, identity,
-                   pair.before.index, pair.after.index, oldElement.material,
+                   pair.beforeIndex, pair.afterIndex, oldElement.material,
                    newElement.material);
     }
-    if (boundsChanged(oldElement.bounds, newElement.bounds,
-                      options.boundsTolerance)) {
+    if ((mask & kBoundsChanged) != 0u) {
       appendChange(result, BimModelCompareChangeKind::ChangedBounds, identity,
-                   pair.before.index, pair.after.index);
+                   pair.beforeIndex, pair.afterIndex);
     }
   }
 
-  for (const IndexedElement& beforeElement : matchPlan.unmatchedBefore) {
-    appendChange(result, BimModelCompareChangeKind::Removed,
-                 occurrenceIdentity(identityValue(*beforeElement.element),
-                                    occurrenceInSpan(before,
-                                                     beforeElement.index)),
-                 beforeElement.index, std::numeric_limits<size_t>::max());
-  }
-
-  for (const IndexedElement& afterElement : matchPlan.unmatchedAfter) {
-    appendChange(result, BimModelCompareChangeKind::Added,
-                 occurrenceIdentity(identityValue(*afterElement.element),
-                                    occurrenceInSpan(after, afterElement.index)),
-                 std::numeric_limits<size_t>::max(), afterElement.index);
-  }
-
+  appendUnmatched(result, BimModelCompareChangeKind::Removed, before,
+                  beforeFingerprints, beforeMatched);
+  appendUnmatched(result, BimModelCompareChangeKind::Added, after,
+                  afterFingerprints, afterMatched);
   return result;
 }
 
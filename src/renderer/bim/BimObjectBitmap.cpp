@@ -0,0 +1,362 @@
+#include "Container/renderer/bim/BimObjectBitmap.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace container::renderer {
+namespace {
+
+using Container = detail::BimObjectBitmapContainer;
+
+constexpr size_t kBitsetWordCount = 65536u / 64u;
+
+[[nodiscard]] uint16_t highBits(uint32_t index) {
+  return static_cast<uint16_t>(index >> 16u);
+}
+
+[[nodiscard]] uint16_t lowBits(uint32_t index) {
+  return static_cast<uint16_t>(index & 0xffffu);
+}
+
+[[nodiscard]] bool testBit(const std::vector<uint64_t> &bits, uint16_t low) {
+  return (bits[low >> 6u] & (uint64_t{1} << (low & 63u))) != 0u;
+}
+
+void setBit(std::vector<uint64_t> &bits, uint16_t low) {
+  bits[low >> 6u] |= uint64_t{1} << (low & 63u);
+}
+
+[[nodiscard]] uint32_t countBits(const std::vector<uint64_t> &bits) {
+  uint32_t count = 0u;
+  for (uint64_t word : bits) {
+    count += static_cast<uint32_t>(std::popcount(word));
+  }
+  return count;
+}
+
+void convertToBitset(Container &container) {
+  container.bits.assign(kBitsetWordCount, 0u);
+  for (uint16_t low : container.array) {
+    setBit(container.bits, low);
+  }
+  container.array.clear();
+  container.array.shrink_to_fit();
+}
+
+void convertToArray(Container &container) {
+  std::vector<uint16_t> array;
+  array.reserve(container.cardinality);
+  for (size_t word = 0; word < container.bits.size(); ++word) {
+    uint64_t bits = container.bits[word];
+    while (bits != 0u) {
+      array.push_back(static_cast<uint16_t>(
+          word * 64u + static_cast<uint32_t>(std::countr_zero(bits))));
+      bits &= bits - 1u;
+    }
+  }
+  container.bits.clear();
+  container.bits.shrink_to_fit();
+  container.array = std::move(array);
+}
+
+// Keeps the representation invariant after a bulk operation: dense buckets
+// that shrank below the array limit go back to sorted arrays and vice versa.
+void normalize(Container &container) {
+  if (container.dense()) {
+    container.cardinality = countBits(container.bits);
+    if (container.cardinality <= kBimObjectBitmapArrayLimit) {
+      convertToArray(container);
+    }
+  } else {
+    container.cardinality = static_cast<uint32_t>(container.array.size());
+    if (container.cardinality > kBimObjectBitmapArrayLimit) {
+      convertToBitset(container);
+    }
+  }
+}
+
+void intersectContainer(Container &lhs, const Container &rhs) {
+  if (lhs.dense() && rhs.dense()) {
+    for (size_t word = 0; word < kBitsetWordCount; ++word) {
+      lhs.bits[word] &= rhs.bits[word];
+    }
+  } else if (lhs.dense()) {
+    std::vector<uint16_t> array;
+    array.reserve(rhs.array.size());
+    for (uint16_t low : rhs.array) {
+      if (testBit(lhs.bits, low)) {
+        array.push_back(low);
+      }
+    }
+    lhs.bits.clear();
+    lhs.array = std::move(array);
+  } else if (rhs.dense()) {
+    std::erase_if(lhs.array,
+                  [&](uint16_t low) { return !testBit(rhs.bits, low); });
+  } else {
+    std::vector<uint16_t> array;
+    array.reserve(std::min(lhs.array.size(), rhs.array.size()));
+    std::ranges::set_intersection(lhs.array, rhs.array,
+                                  std::back_inserter(array));
+    lhs.array = std::move(array);
+  }
+  normalize(lhs);
+}
+
+void uniteContainer(Container &lhs, const Container &rhs) {
+  if (!lhs.dense() && !rhs.dense() &&
+      lhs.array.size() + rhs.array.size() <= kBimObjectBitmapArrayLimit) {
+    std::vector<uint16_t> array;
+    array.reserve(lhs.array.size() + rhs.array.size());
+    std::ranges::set_union(lhs.array, rhs.array, std::back_inserter(array));
+    lhs.array = std::move(array);
+    normalize(lhs);
+    return;
+  }
+  if (!lhs.dense()) {
+    convertToBitset(lhs);
+  }
+  if (rhs.dense()) {
+    for (size_t word = 0; word < kBitsetWordCount; ++word) {
+      lhs.bits[word] |= rhs.bits[word];
+    }
+  } else {
+    for (uint16_t low : rhs.array) {
+      setBit(lhs.bits, low);
+    }
+  }
+  normalize(lhs);
+}
+
+void subtractContainer(Container &lhs, const Container &rhs) {
+  if (lhs.dense() && rhs.dense()) {
+    for (size_t word = 0; word < kBitsetWordCount; ++word) {
+      lhs.bits[word] &= ~rhs.bits[word];
+    }
+  } else if (lhs.dense()) {
+    for (uint16_t low : rhs.array) {
+      lhs.bits[low >> 6u] &= ~(uint64_t{1} << (low & 63u));
+    }
+  } else if (rhs.dense()) {
+    std::erase_if(lhs.array,
+                  [&](uint16_t low) { return testBit(rhs.bits, low); });
+  } else {
+    std::vector<uint16_t> array;
+    array.reserve(lhs.array.size());
+    std::ranges::set_difference(lhs.array, rhs.array,
+                                std::back_inserter(array));
+    lhs.array = std::move(array);
+  }
+  normalize(lhs);
+}
+
+[[nodiscard]] bool sameContents(const Container &lhs, const Container &rhs) {
+  if (lhs.key != rhs.key || lhs.cardinality != rhs.cardinality) {
+    return false;
+  }
+  if (lhs.dense() != rhs.dense()) {
+    return false;
+  }
+  return lhs.dense() ? lhs.bits == rhs.bits : lhs.array == rhs.array;
+}
+
+} // namespace
+
+BimObjectBitmap BimObjectBitmap::range(uint32_t begin, uint32_t end) {
+  BimObjectBitmap bitmap;
+  if (begin >= end) {
+    return bitmap;
+  }
+  const uint32_t last = end - 1u;
+  for (uint32_t key = highBits(begin); key <= highBits(last); ++key) {
+    const uint32_t first = key == highBits(begin) ? lowBits(begin) : 0u;
+    const uint32_t final = key == highBits(last) ? lowBits(last) : 0xffffu;
+    Container container{};
+    container.key = static_cast<uint16_t>(key);
+    container.cardinality = final - first + 1u;
+    if (container.cardinality > kBimObjectBitmapArrayLimit) {
+      container.bits.assign(kBitsetWordCount, 0u);
+      for (uint32_t low = first; low <= final; ++low) {
+        setBit(container.bits, static_cast<uint16_t>(low));
+      }
+    } else {
+      container.array.reserve(container.cardinality);
+      for (uint32_t low = first; low <= final; ++low) {
+        container.array.push_back(static_cast<uint16_t>(low));
+      }
+    }
+    bitmap.containers_.push_back(std::move(container));
+  }
+  return bitmap;
+}
+
+BimObjectBitmap
+BimObjectBitmap::fromIndices(std::span<const uint32_t> indices) {
+  BimObjectBitmap bitmap;
+  for (uint32_t index : indices) {
+    bitmap.add(index);
+  }
+  return bitmap;
+}
+
+void BimObjectBitmap::clear() { containers_.clear(); }
+
+const BimObjectBitmap::Container *
+BimObjectBitmap::findContainer(uint16_t key) const {
+  const auto it = std::ranges::lower_bound(containers_, key, {},
+                                           &Container::key);
+  if (it == containers_.end() || it->key != key) {
+    return nullptr;
+  }
+  return &*it;
+}
+
+BimObjectBitmap::Container &BimObjectBitmap::containerFor(uint16_t key) {
+  // Index builds append in ascending order, so check the tail first.
+  if (!containers_.empty() && containers_.back().key == key) {
+    return containers_.back();
+  }
+  if (containers_.empty() || containers_.back().key < key) {
+    containers_.push_back(Container{.key = key});
+    return containers_.back();
+  }
+  auto it = std::ranges::lower_bound(containers_, key, {}, &Container::key);
+  if (it == containers_.end() || it->key != key) {
+    it = containers_.insert(it, Container{.key = key});
+  }
+  return *it;
+}
+
+void BimObjectBitmap::add(uint32_t index) {
+  Container &container = containerFor(highBits(index));
+  const uint16_t low = lowBits(index);
+  if (container.dense()) {
+    if (!testBit(container.bits, low)) {
+      setBit(container.bits, low);
+      ++container.cardinality;
+    }
+    return;
+  }
+  if (container.array.empty() || container.array.back() < low) {
+    container.array.push_back(low);
+  } else {
+    const auto it = std::ranges::lower_bound(container.array, low);
+    if (it != container.array.end() && *it == low) {
+      return;
+    }
+    container.array.insert(it, low);
+  }
+  ++container.cardinality;
+  if (container.cardinality > kBimObjectBitmapArrayLimit) {
+    convertToBitset(container);
+  }
+}
+
+bool BimObjectBitmap::contains(uint32_t index) const {
+  const Container *container = findContainer(highBits(index));
+  if (container == nullptr) {
+    return false;
+  }
+  const uint16_t low = lowBits(index);
+  if (container->dense()) {
+    return testBit(container->bits, low);
+  }
+  return std::ranges::binary_search(container->array, low);
+}
+
+size_t BimObjectBitmap::cardinality() const {
+  size_t count = 0u;
+  for (const Container &container : containers_) {
+    count += container.cardinality;
+  }
+  return count;
+}
+
+size_t BimObjectBitmap::memoryBytes() const {
+  size_t bytes = containers_.capacity() * sizeof(Container);
+  for (const Container &container : containers_) {
+    bytes += container.array.capacity() * sizeof(uint16_t);
+    bytes += container.bits.capacity() * sizeof(uint64_t);
+  }
+  return bytes;
+}
+
+std::vector<uint32_t> BimObjectBitmap::toVector() const {
+  std::vector<uint32_t> indices;
+  indices.reserve(cardinality());
+  forEach([&](uint32_t index) { indices.push_back(index); });
+  return indices;
+}
+
+BimObjectBitmap &BimObjectBitmap::operator&=(const BimObjectBitmap &other) {
+  std::vector<Container> result;
+  result.reserve(std::min(containers_.size(), other.containers_.size()));
+  auto lhs = containers_.begin();
+  auto rhs = other.containers_.begin();
+  while (lhs != containers_.end() && rhs != other.containers_.end()) {
+    if (lhs->key < rhs->key) {
+      ++lhs;
+    } else if (rhs->key < lhs->key) {
+      ++rhs;
+    } else {
+      intersectContainer(*lhs, *rhs);
+      if (lhs->cardinality != 0u) {
+        result.push_back(std::move(*lhs));
+      }
+      ++lhs;
+      ++rhs;
+    }
+  }
+  containers_ = std::move(result);
+  return *this;
+}
+
+BimObjectBitmap &BimObjectBitmap::operator|=(const BimObjectBitmap &other) {
+  std::vector<Container> result;
+  result.reserve(containers_.size() + other.containers_.size());
+  auto lhs = containers_.begin();
+  auto rhs = other.containers_.begin();
+  while (lhs != containers_.end() || rhs != other.containers_.end()) {
+    if (rhs == other.containers_.end() ||
+        (lhs != containers_.end() && lhs->key < rhs->key)) {
+      result.push_back(std::move(*lhs));
+      ++lhs;
+    } else if (lhs == containers_.end() || rhs->key < lhs->key) {
+      result.push_back(*rhs);
+      ++rhs;
+    } else {
+      uniteContainer(*lhs, *rhs);
+      result.push_back(std::move(*lhs));
+      ++lhs;
+      ++rhs;
+    }
+  }
+  containers_ = std::move(result);
+  return *this;
+}
+
+BimObjectBitmap &BimObjectBitmap::operator-=(const BimObjectBitmap &other) {
+  std::vector<Container> result;
+  result.reserve(containers_.size());
+  auto rhs = other.containers_.begin();
+  for (Container &lhs : containers_) {
+    while (rhs != other.containers_.end() && rhs->key < lhs.key) {
+      ++rhs;
+    }
+    if (rhs != other.containers_.end() && rhs->key == lhs.key) {
+      subtractContainer(lhs, *rhs);
+    }
+    if (lhs.cardinality != 0u) {
+      result.push_back(std::move(lhs));
+    }
+  }
+  containers_ = std::move(result);
+  return *this;
+}
+
+bool operator==(const BimObjectBitmap &lhs, const BimObjectBitmap &rhs) {
+  return std::ranges::equal(lhs.containers_, rhs.containers_, sameContents);
+}
+
+} // namespace container::renderer
@@ -0,0 +1,141 @@
+#include "Container/renderer/bim/BimObjectOrdering.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+namespace container::renderer {
+
+namespace {
+
+constexpr uint32_t kMortonAxisBits = 10u;
+constexpr uint32_t kNoBoundsMortonCode = std::numeric_limits<uint32_t>::max();
+
+uint32_t spreadMortonBits(uint32_t value) {
+  value &= 0x3ffu;
+  value = (value | (value << 16u)) & 0x030000ffu;
+  value = (value | (value << 8u)) & 0x0300f00fu;
+  value = (value | (value << 4u)) & 0x030c30c3u;
+  value = (value | (value << 2u)) & 0x09249249u;
+  return value;
+}
+
+bool finiteCenter(const BimObjectOrderKey &key) {
+  return key.hasBounds && std::isfinite(key.center.x) &&
+         std::isfinite(key.center.y) && std::isfinite(key.center.z);
+}
+
+std::vector<uint32_t>
+mortonCodes(std::span<const BimObjectOrderKey> keys) {
+  glm::vec3 boundsMin{std::numeric_limits<float>::max()};
+  glm::vec3 boundsMax{std::numeric_limits<float>::lowest()};
+  for (const BimObjectOrderKey &key : keys) {
+    if (finiteCenter(key)) {
+      boundsMin = glm::min(boundsMin, key.center);
+      boundsMax = glm::max(boundsMax, key.center);
+    }
+  }
+
+  constexpr float kCellCount = static_cast<float>((1u << kMortonAxisBits) - 1u);
+  const glm::vec3 extent = glm::max(boundsMax - boundsMin, glm::vec3(1.0e-6f));
+  std::vector<uint32_t> codes(keys.size(), kNoBoundsMortonCode);
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (!finiteCenter(keys[i])) {
+      continue;
+    }
+    const glm::vec3 cell = glm::clamp((keys[i].center - boundsMin) / extent,
+                                      glm::vec3(0.0f), glm::vec3(1.0f)) *
+                           kCellCount;
+    codes[i] = spreadMortonBits(static_cast<uint32_t>(cell.x)) |
+               (spreadMortonBits(static_cast<uint32_t>(cell.y)) << 1u) |
+               (spreadMortonBits(static_cast<uint32_t>(cell.z)) << 2u);
+  }
+  return codes;
+}
+
+// Storeys ranked bottom-up by their lowest element; storeys without bounds go
+// last. Names break ties so the ranking never depends on hash order.
+std::vector<uint32_t> storeyRanks(std::span<const BimObjectOrderKey> keys) {
+  std::unordered_map<std::string_view, float> elevations;
+  elevations.reserve(keys.size());
+  for (const BimObjectOrderKey &key : keys) {
+    auto [it, inserted] = elevations.try_emplace(
+        key.storey, std::numeric_limits<float>::infinity());
+    (void)inserted;
+    if (key.hasBounds && std::isfinite(key.floorElevation)) {
+      it->second = std::min(it->second, key.floorElevation);
+    }
+  }
+
+  std::vector<std::pair<float, std::string_view>> storeys;
+  storeys.reserve(elevations.size());
+  for (const auto &[storey, elevation] : elevations) {
+    storeys.emplace_back(elevation, storey);
+  }
+  std::ranges::sort(storeys);
+  std::unordered_map<std::string_view, uint32_t> rankByStorey;
+  rankByStorey.reserve(storeys.size());
+  for (size_t rank = 0; rank < storeys.size(); ++rank) {
+    rankByStorey.emplace(storeys[rank].second, static_cast<uint32_t>(rank));
+  }
+
+  std::vector<uint32_t> ranks(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    ranks[i] = rankByStorey.at(keys[i].storey);
+  }
+  return ranks;
+}
+
+bool sameDrawGroup(const BimObjectOrderKey &lhs, const BimObjectOrderKey &rhs) {
+  return lhs.bucket == rhs.bucket && lhs.geometryKind == rhs.geometryKind &&
+         lhs.firstIndex == rhs.firstIndex && lhs.indexCount == rhs.indexCount;
+}
+
+} // namespace
+
+std::vector<uint32_t>
+orderBimObjects(std::span<const BimObjectOrderKey> keys) {
+  const std::vector<uint32_t> storeys = storeyRanks(keys);
+  const std::vector<uint32_t> morton = mortonCodes(keys);
+
+  std::vector<uint32_t> order(keys.size());
+  std::iota(order.begin(), order.end(), 0u);
+  std::ranges::sort(order, [&](uint32_t lhsIndex, uint32_t rhsIndex) {
+    const BimObjectOrderKey &lhs = keys[lhsIndex];
+    const BimObjectOrderKey &rhs = keys[rhsIndex];
+    return std::tie(lhs.bucket, lhs.geometryKind, lhs.firstIndex,
+                    lhs.indexCount, storeys[lhsIndex], lhs.materialIndex,
+                    morton[lhsIndex], lhs.sourceElementIndex, lhsIndex) <
+           std::tie(rhs.bucket, rhs.geometryKind, rhs.firstIndex,
+                    rhs.indexCount, storeys[rhsIndex], rhs.materialIndex,
+                    morton[rhsIndex], rhs.sourceElementIndex, rhsIndex);
+  });
+  return order;
+}
+
+size_t countBimInstancedDrawRuns(std::span<const BimObjectOrderKey> keys,
+                                 std::span<const uint32_t> order,
+                                 std::span<const uint8_t> visible) {
+  size_t runs = 0;
+  bool previousVisible = false;
+  const BimObjectOrderKey *previous = nullptr;
+  for (const uint32_t keyIndex : order) {
+    const bool isVisible = visible.empty() || visible[keyIndex] != 0u;
+    const BimObjectOrderKey &key = keys[keyIndex];
+    if (isVisible && key.indexCount > 0u &&
+        !(previousVisible && previous != nullptr &&
+          sameDrawGroup(*previous, key))) {
+      ++runs;
+    }
+    previousVisible = isVisible && key.indexCount > 0u;
+    previous = &key;
+  }
+  return runs;
+}
+
+} // namespace container::renderer
@@ -1,10 +1,12 @@
 #include "Container/renderer/bim/BimRelationshipGraph.h"
 
 #include "Container/geometry/DotBimLoader.h"
+#include "Container/renderer/bim/BimElementMetadataStore.h"
 #include "Container/renderer/bim/BimManager.h"
 
 #include <algorithm>
 #include <cctype>
+#include <numeric>
 #include <string>
 
 namespace container::renderer {
@@ -22,14 +24,60 @@ constexpr uint32_t kInvalidNodeIndex = std::numeric_limits<uint32_t>::max();
   return result;
 }
 
-[[nodiscard]] bool containsCaseInsensitive(std::string_view text,
-                                           std::string_view query) {
-  if (query.empty()) {
-    return true;
+constexpr size_t kSearchGramLength = 3u;
+
+[[nodiscard]] uint32_t packTrigram(std::string_view text, size_t offset) {
+  return static_cast<uint32_t>(static_cast<unsigned char>(text[offset])) |
+         static_cast<uint32_t>(static_cast<unsigned char>(text[offset + 1u]))
+             << 8u |
+         static_cast<uint32_t>(static_cast<unsigned char>(text[offset + 2u]))
+             << 16u;
+}
+
+// Lower rank sorts first: whole-field match, prefix, word start, substring.
+enum class SearchMatchRank : uint32_t {
+  Exact,
+  Prefix,
+  WordStart,
+  Substring,
+  None,
+};
+
+[[nodiscard]] SearchMatchRank searchMatchRank(std::string_view text,
+                                              std::string_view query) {
+  size_t position = text.find(query);
+  if (position == std::string_view::npos) {
+    return SearchMatchRank::None;
+  }
+  if (position == 0u) {
+    return text.size() == query.size() ? SearchMatchRank::Exact
+                                       : SearchMatchRank::Prefix;
+  }
+  while (position != std::string_view::npos) {
+    if (!std::isalnum(static_cast<unsigned char>(text[position - 1u]))) {
+      return SearchMatchRank::WordStart;
+    }
+    position = text.find(query, position + 1u);
   }
-  return lowerAscii(text).find(lowerAscii(query)) != std::string::npos;
+  return SearchMatchRank::Substring;
 }
 
+struct RankedSearchMatch {
+  SearchMatchRank rank{SearchMatchRank::None};
+  uint32_t fieldIndex{0};
+  size_t textLength{0};
+
+  [[nodiscard]] bool operator<(const RankedSearchMatch &other) const {
+    if (rank != other.rank) {
+      return rank < other.rank;
+    }
+    if (textLength != other.textLength) {
+      return textLength < other.textLength;
+    }
+    return fieldIndex < other.fieldIndex;
+  }
+};
+
 [[nodiscard]] bool isValidObjectIndex(uint32_t objectIndex) {
   return objectIndex != kInvalidObjectIndex;
 }
@@ -142,10 +190,11 @@ void BimRelationshipGraph::clear() {
   syntheticNodeByKey_.clear();
   propertySetsByObject_.clear();
   searchFields_.clear();
+  searchPostings_.clear();
 }
 
 void BimRelationshipGraph::build(
-    std::span<const BimElementMetadata> metadata,
+    const BimElementMetadataStore &metadata,
     std::span<const container::geometry::dotbim::ElementRelationship>
         relationships) {
   clear();
@@ -156,28 +205,28 @@ void BimRelationshipGraph::build(
   nodeByLabel_.reserve(metadata.size());
   propertySetsByObject_.reserve(metadata.size());
 
-  for (const BimElementMetadata &element : metadata) {
+  for (const BimElementMetadataView element : metadata) {
     (void)addObjectNode(element);
   }
 
-  for (const BimElementMetadata &element : metadata) {
-    const uint32_t elementNode = objectNodeIndex(element.objectIndex);
+  for (const BimElementMetadataView element : metadata) {
+    const uint32_t elementNode = objectNodeIndex(element.objectIndex());
     if (elementNode == kInvalidNodeIndex) {
       continue;
     }
 
     const std::string storey =
-        firstNonEmpty({element.storeyName, element.storeyId});
+        firstNonEmpty({element.storeyName(), element.storeyId()});
     if (!storey.empty()) {
       const uint32_t storeyNode =
           syntheticNode("storey:" + storey, storey, "IfcBuildingStorey", {},
-                        element.storeyId);
+                        std::string(element.storeyId()));
       addEdge(storeyNode, elementNode, BimRelationshipKind::SpatialParent,
               defaultRelationshipLabel(BimRelationshipKind::SpatialParent));
     }
 
     const std::string material =
-        firstNonEmpty({element.materialName, element.materialCategory});
+        firstNonEmpty({element.materialName(), element.materialCategory()});
     if (!material.empty()) {
       const uint32_t materialNode =
           syntheticNode("material:" + material, material, "IfcMaterial");
@@ -186,7 +235,8 @@ void BimRelationshipGraph::build(
                   BimRelationshipKind::MaterialAssignment));
     }
 
-    const std::string type = firstNonEmpty({element.objectType, element.type});
+    const std::string type =
+        firstNonEmpty({element.objectType(), element.type()});
     if (!type.empty()) {
       const uint32_t typeNode =
           syntheticNode("type:" + type, type, "IfcTypeObject");
@@ -226,6 +276,8 @@ void BimRelationshipGraph::build(
       }
     }
   }
+
+  buildSearchIndex();
 }
 
 std::vector<BimRelationshipNode>
@@ -279,23 +331,51 @@ BimRelationshipGraph::edgesForObject(uint32_t objectIndex) const {
 
 std::vector<BimRelationshipSearchResult>
 BimRelationshipGraph::search(std::string_view query) const {
-  std::vector<BimRelationshipSearchResult> result;
+  return searchPage(query, 0u, std::numeric_limits<size_t>::max()).results;
+}
+
+BimRelationshipSearchPage
+BimRelationshipGraph::searchPage(std::string_view query, size_t offset,
+                                 size_t limit) const {
+  BimRelationshipSearchPage page;
   if (query.empty()) {
-    return result;
-  }
-  result.reserve(16u);
-  for (const SearchField &field : searchFields_) {
-    if (!isValidObjectIndex(field.objectIndex) ||
-        !containsCaseInsensitive(field.text, query)) {
-      continue;
+    return page;
+  }
+  const std::string normalizedQuery = lowerAscii(query);
+  const std::vector<uint32_t> candidates = searchCandidates(normalizedQuery);
+
+  std::vector<RankedSearchMatch> matches;
+  matches.reserve(std::min<size_t>(candidates.size(), 1024u));
+  for (const uint32_t fieldIndex : candidates) {
+    const SearchField &field = searchFields_[fieldIndex];
+    const SearchMatchRank rank =
+        searchMatchRank(field.normalizedText, normalizedQuery);
+    if (rank != SearchMatchRank::None) {
+      matches.push_back(RankedSearchMatch{.rank = rank,
+                                          .fieldIndex = fieldIndex,
+                                          .textLength = field.text.size()});
     }
-    result.push_back(BimRelationshipSearchResult{
+  }
+  page.totalMatches = matches.size();
+  if (offset >= matches.size() || limit == 0u) {
+    return page;
+  }
+
+  // Only the requested page has to be ordered; the tail stays unsorted.
+  const size_t end = offset + std::min(limit, matches.size() - offset);
+  std::partial_sort(matches.begin(),
+                    matches.begin() + static_cast<std::ptrdiff_t>(end),
+                    matches.end());
+  page.results.reserve(end - offset);
+  for (size_t i = offset; i < end; ++i) {
+    const SearchField &field = searchFields_[matches[i].fieldIndex];
+    page.results.push_back(BimRelationshipSearchResult{
         .objectIndex = field.objectIndex,
         .matchedText = field.text,
         .reason = field.reason,
     });
   }
-  return result;
+  return page;
 }
 
 std::span<const BimPropertySetGroup>
@@ -321,30 +401,31 @@ uint32_t BimRelationshipGraph::addNode(BimRelationshipNode node) {
 }
 
 uint32_t
-BimRelationshipGraph::addObjectNode(const BimElementMetadata &metadata) {
-  if (!isValidObjectIndex(metadata.objectIndex)) {
+BimRelationshipGraph::addObjectNode(BimElementMetadataView metadata) {
+  const uint32_t objectIndex = metadata.objectIndex();
+  if (!isValidObjectIndex(objectIndex)) {
     return kInvalidNodeIndex;
   }
   const uint32_t nodeIndex = addNode(BimRelationshipNode{
-      .objectIndex = metadata.objectIndex,
-      .guid = metadata.guid,
-      .sourceId = metadata.sourceId,
-      .label = firstNonEmpty({metadata.displayName, metadata.objectType,
-                              metadata.type, metadata.guid,
-                              metadata.sourceId}),
-      .ifcClass = metadata.type,
+      .objectIndex = objectIndex,
+      .guid = std::string(metadata.guid()),
+      .sourceId = std::string(metadata.sourceId()),
+      .label = firstNonEmpty({metadata.displayName(), metadata.objectType(),
+                              metadata.type(), metadata.guid(),
+                              metadata.sourceId()}),
+      .ifcClass = std::string(metadata.type()),
   });
-  nodeByObjectIndex_[metadata.objectIndex] = nodeIndex;
-
-  addSearchField(metadata.objectIndex, metadata.displayName, "element name");
-  addSearchField(metadata.objectIndex, metadata.guid, "guid");
-  addSearchField(metadata.objectIndex, metadata.sourceId, "source id");
-  addSearchField(metadata.objectIndex, metadata.type, "IFC class");
-  addSearchField(metadata.objectIndex, metadata.objectType, "IFC class");
-  addSearchField(metadata.objectIndex, metadata.storeyName, "storey");
-  addSearchField(metadata.objectIndex, metadata.storeyId, "storey");
-  addSearchField(metadata.objectIndex, metadata.materialName, "material");
-  addSearchField(metadata.objectIndex, metadata.materialCategory, "material");
+  nodeByObjectIndex_[objectIndex] = nodeIndex;
+
+  addSearchField(objectIndex, metadata.displayName(), "element name");
+  addSearchField(objectIndex, metadata.guid(), "guid");
+  addSearchField(objectIndex, metadata.sourceId(), "source id");
+  addSearchField(objectIndex, metadata.type(), "IFC class");
+  addSearchField(objectIndex, metadata.objectType(), "IFC class");
+  addSearchField(objectIndex, metadata.storeyName(), "storey");
+  addSearchField(objectIndex, metadata.storeyId(), "storey");
+  addSearchField(objectIndex, metadata.materialName(), "material");
+  addSearchField(objectIndex, metadata.materialCategory(), "material");
   return nodeIndex;
 }
 
@@ -473,18 +554,74 @@ void BimRelationshipGraph::addEdge(uint32_t from, uint32_t to,
 }
 
 void BimRelationshipGraph::addSearchField(uint32_t objectIndex,
-                                          std::string text,
+                                          std::string_view text,
                                           std::string reason) {
   if (!isValidObjectIndex(objectIndex) || text.empty()) {
     return;
   }
+  std::string normalizedText = lowerAscii(text);
   searchFields_.push_back(SearchField{
       .objectIndex = objectIndex,
-      .text = std::move(text),
+      .text = std::string(text),
+      .normalizedText = std::move(normalizedText),
       .reason = std::move(reason),
   });
 }
 
+void BimRelationshipGraph::buildSearchIndex() {
+  searchPostings_.clear();
+  for (size_t fieldIndex = 0; fieldIndex < searchFields_.size();
+       ++fieldIndex) {
+    const std::string &text = searchFields_[fieldIndex].normalizedText;
+    for (size_t offset = 0; offset + kSearchGramLength <= text.size();
+         ++offset) {
+      std::vector<uint32_t> &postings =
+          searchPostings_[packTrigram(text, offset)];
+      // Fields are visited in order, so repeats are always at the tail.
+      if (postings.empty() || postings.back() != fieldIndex) {
+        postings.push_back(static_cast<uint32_t>(fieldIndex));
+      }
+    }
+  }
+}
+
+std::vector<uint32_t> BimRelationshipGraph::searchCandidates(
+    std::string_view normalizedQuery) const {
+  std::vector<uint32_t> candidates;
+  if (normalizedQuery.size() < kSearchGramLength) {
+    // Too short for a trigram; every field is verified directly.
+    candidates.resize(searchFields_.size());
+    std::iota(candidates.begin(), candidates.end(), 0u);
+    return candidates;
+  }
+
+  std::vector<const std::vector<uint32_t> *> postingLists;
+  for (size_t offset = 0;
+       offset + kSearchGramLength <= normalizedQuery.size(); ++offset) {
+    const auto it =
+        searchPostings_.find(packTrigram(normalizedQuery, offset));
+    if (it == searchPostings_.end()) {
+      return candidates;
+    }
+    if (!std::ranges::contains(postingLists, &it->second)) {
+      postingLists.push_back(&it->second);
+    }
+  }
+  std::ranges::sort(postingLists, {}, [](const auto *postings) {
+    return postings->size();
+  });
+
+  candidates = *postingLists.front();
+  for (size_t list = 1u; list < postingLists.size() && !candidates.empty();
+       ++list) {
+    const std::vector<uint32_t> &postings = *postingLists[list];
+    std::erase_if(candidates, [&](uint32_t fieldIndex) {
+      return !std::ranges::binary_search(postings, fieldIndex);
+    });
+  }
+  return candidates;
+}
+
 void BimRelationshipGraph::indexNodeIdentity(
     uint32_t nodeIndex, const BimRelationshipNode &node) {
   if (!node.guid.empty()) {
@@ -498,41 +635,43 @@ void BimRelationshipGraph::indexNodeIdentity(
   }
 }
 
-void BimRelationshipGraph::buildPropertySets(
-    const BimElementMetadata &metadata) {
-  if (!isValidObjectIndex(metadata.objectIndex) || metadata.properties.empty()) {
+void BimRelationshipGraph::buildPropertySets(BimElementMetadataView metadata) {
+  if (!isValidObjectIndex(metadata.objectIndex()) ||
+      metadata.propertyCount() == 0u) {
     return;
   }
 
-  auto &groups = propertySetsByObject_[metadata.objectIndex];
-  for (const BimElementProperty &property : metadata.properties) {
-    const std::string set =
+  auto &groups = propertySetsByObject_[metadata.objectIndex()];
+  for (size_t index = 0; index < metadata.propertyCount(); ++index) {
+    const BimElementPropertyView property = metadata.property(index);
+    const std::string_view set =
         !property.set.empty() ? property.set : "(unassigned set)";
-    const std::string category = !property.category.empty()
-                                     ? property.category
-                                     : "(unassigned category)";
+    const std::string_view category = !property.category.empty()
+                                          ? property.category
+                                          : "(unassigned category)";
     auto groupIt = std::ranges::find_if(
         groups, [&](const BimPropertySetGroup &group) {
           return group.set == set && group.category == category;
         });
     if (groupIt == groups.end()) {
-      groups.push_back(BimPropertySetGroup{.set = set, .category = category});
+      groups.push_back(BimPropertySetGroup{.set = std::string(set),
+                                           .category = std::string(category)});
       groupIt = groups.end() - 1;
     }
     groupIt->properties.push_back(BimPropertySetProperty{
-        .name = property.name,
-        .value = property.value,
-        .category = property.category,
+        .name = std::string(property.name),
+        .value = std::string(property.value),
+        .category = std::string(property.category),
     });
 
-    addSearchField(metadata.objectIndex, set, "property set");
-    addSearchField(metadata.objectIndex, property.name, "property name");
-    addSearchField(metadata.objectIndex, property.value, "property value");
+    addSearchField(metadata.objectIndex(), set, "property set");
+    addSearchField(metadata.objectIndex(), property.name, "property name");
+    addSearchField(metadata.objectIndex(), property.value, "property value");
   }
 
-  const uint32_t elementNode = objectNodeIndex(metadata.objectIndex);
+  const uint32_t elementNode = objectNodeIndex(metadata.objectIndex());
   for (const BimPropertySetGroup &group : groups) {
-    const std::string key = "pset:" + std::to_string(metadata.objectIndex) +
+    const std::string key = "pset:" + std::to_string(metadata.objectIndex()) +
                             ":" + group.set + ":" + group.category;
     const uint32_t propertySetNode =
         syntheticNode(key, group.set, "IfcPropertySet");
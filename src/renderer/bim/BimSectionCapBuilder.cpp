@@ -1,16 +1,348 @@
 #include "Container/renderer/bim/BimSectionCapBuilder.h"
 
+#include "Container/utility/ParallelRanges.h"
+
 #include <glm/common.hpp>
 #include <glm/geometric.hpp>
 
 #include <algorithm>
+#include <bit>
 #include <cmath>
 #include <cstddef>
 #include <limits>
-#include <map>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace container::renderer {
 
+namespace {
+
+constexpr float kDistanceEpsilon = 1.0e-5f;
+constexpr float kPointMergeEpsilon2 = 1.0e-10f;
+constexpr float kMinSegmentLength2 = 1.0e-8f;
+// Any cell at least as wide as the merge radius keeps every merge candidate
+// inside the 3x3x3 block of cells around a point.
+constexpr double kPointMergeCellSize = 1.0e-4;
+constexpr size_t kPlaneDistanceBatchSize = 8u;
+constexpr size_t kMinTrianglesPerWorker = 4096u;
+
+// Triangles grouped into (object, material) surfaces. `order` maps surface
+// slots back to input triangles and stays empty when the input is already
+// grouped, which is the common one-object-per-call case.
+struct SectionCapSurface {
+  uint32_t objectIndex{std::numeric_limits<uint32_t>::max()};
+  uint32_t materialIndex{kInvalidBimSectionCapMaterialIndex};
+  size_t firstSlot{0};
+  size_t slotCount{0};
+  glm::vec3 boundsMin{std::numeric_limits<float>::max()};
+  glm::vec3 boundsMax{std::numeric_limits<float>::lowest()};
+};
+
+struct SectionCapSurfaces {
+  std::span<const BimSectionCapTriangle> triangles{};
+  std::vector<uint32_t> order{};
+  std::vector<SectionCapSurface> surfaces{};
+  size_t validTriangleCount{0};
+
+  [[nodiscard]] const BimSectionCapTriangle& triangle(size_t slot) const {
+    return triangles[order.empty() ? slot : order[slot]];
+  }
+};
+
+[[nodiscard]] bool finiteSectionCapPoint(const glm::vec3& point) {
+  return std::isfinite(point.x) && std::isfinite(point.y) &&
+         std::isfinite(point.z);
+}
+
+[[nodiscard]] bool validSectionCapTriangle(
+    const BimSectionCapTriangle& triangle) {
+  return triangle.objectIndex != std::numeric_limits<uint32_t>::max() &&
+         finiteSectionCapPoint(triangle.p0) &&
+         finiteSectionCapPoint(triangle.p1) &&
+         finiteSectionCapPoint(triangle.p2);
+}
+
+[[nodiscard]] SectionCapSurfaces groupSectionCapSurfaces(
+    std::span<const BimSectionCapTriangle> triangles) {
+  auto surfaceLess = [](const BimSectionCapTriangle& lhs,
+                        const BimSectionCapTriangle& rhs) {
+    if (lhs.objectIndex != rhs.objectIndex) {
+      return lhs.objectIndex < rhs.objectIndex;
+    }
+    return lhs.materialIndex < rhs.materialIndex;
+  };
+
+  SectionCapSurfaces grouped{.triangles = triangles};
+  if (!std::ranges::is_sorted(triangles, surfaceLess)) {
+    grouped.order.resize(triangles.size());
+    for (size_t index = 0; index < triangles.size(); ++index) {
+      grouped.order[index] = static_cast<uint32_t>(index);
+    }
+    std::ranges::stable_sort(grouped.order, [&](uint32_t lhs, uint32_t rhs) {
+      return surfaceLess(triangles[lhs], triangles[rhs]);
+    });
+  }
+
+  SectionCapSurface current{};
+  size_t currentValid = 0;
+  auto flush = [&]() {
+    if (currentValid > 0u) {
+      grouped.surfaces.push_back(current);
+      grouped.validTriangleCount += currentValid;
+    }
+  };
+  for (size_t slot = 0; slot < triangles.size(); ++slot) {
+    const BimSectionCapTriangle& triangle = grouped.triangle(slot);
+    if (slot == 0u || triangle.objectIndex != current.objectIndex ||
+        triangle.materialIndex != current.materialIndex) {
+      flush();
+      current = SectionCapSurface{.objectIndex = triangle.objectIndex,
+                                  .materialIndex = triangle.materialIndex,
+                                  .firstSlot = slot};
+      currentValid = 0u;
+    }
+    ++current.slotCount;
+    if (!validSectionCapTriangle(triangle)) {
+      continue;
+    }
+    ++currentValid;
+    for (const glm::vec3& point : {triangle.p0, triangle.p1, triangle.p2}) {
+      current.boundsMin = glm::min(current.boundsMin, point);
+      current.boundsMax = glm::max(current.boundsMax, point);
+    }
+  }
+  flush();
+  return grouped;
+}
+
+// Conservative: only rejects a surface when rounding in the per-vertex
+// distances could not bring any vertex across the plane epsilon.
+[[nodiscard]] bool surfaceMayCrossPlane(const SectionCapSurface& surface,
+                                        const glm::vec4& plane) {
+  const glm::vec3 normal{plane};
+  const glm::vec3 center = (surface.boundsMin + surface.boundsMax) * 0.5f;
+  const glm::vec3 extent = (surface.boundsMax - surface.boundsMin) * 0.5f;
+  const float centerDistance = glm::dot(normal, center) + plane.w;
+  const float radius = glm::dot(glm::abs(normal), extent);
+  const float slack =
+      kDistanceEpsilon + 1.0e-4f * (glm::dot(glm::abs(normal),
+                                             glm::abs(center)) +
+                                    radius + std::abs(plane.w) + 1.0f);
+  return centerDistance - radius <= slack &&
+         centerDistance + radius >= -slack;
+}
+
+// Up to kPlaneDistanceBatchSize triangles gathered into structure-of-arrays
+// lanes, so the distance and crossing tests below vectorize.
+struct PlaneDistanceBatch {
+  std::array<std::array<float, kPlaneDistanceBatchSize>, 3> x{};
+  std::array<std::array<float, kPlaneDistanceBatchSize>, 3> y{};
+  std::array<std::array<float, kPlaneDistanceBatchSize>, 3> z{};
+  std::array<std::array<float, kPlaneDistanceBatchSize>, 3> distances{};
+  std::array<size_t, kPlaneDistanceBatchSize> slots{};
+  uint32_t crossingMask{0};
+};
+
+// Evaluates the same dot(normal, p) + w as a scalar per-vertex test would, so
+// the crossing classification is bit-identical to it.
+void computePlaneDistanceBatch(const SectionCapSurfaces& grouped,
+                               size_t firstSlot, size_t slotCount,
+                               const glm::vec4& plane,
+                               PlaneDistanceBatch& batch) {
+  uint32_t validMask = 0u;
+  size_t laneCount = 0;
+  for (size_t slot = firstSlot; slot < firstSlot + slotCount; ++slot) {
+    const BimSectionCapTriangle& triangle = grouped.triangle(slot);
+    if (!validSectionCapTriangle(triangle)) {
+      continue;
+    }
+    const std::array<glm::vec3, 3> points{triangle.p0, triangle.p1,
+                                          triangle.p2};
+    for (size_t corner = 0; corner < 3u; ++corner) {
+      batch.x[corner][laneCount] = points[corner].x;
+      batch.y[corner][laneCount] = points[corner].y;
+      batch.z[corner][laneCount] = points[corner].z;
+    }
+    batch.slots[laneCount] = slot;
+    validMask |= 1u << laneCount;
+    ++laneCount;
+  }
+
+  for (size_t corner = 0; corner < 3u; ++corner) {
+    for (size_t lane = 0; lane < kPlaneDistanceBatchSize; ++lane) {
+      batch.distances[corner][lane] = batch.x[corner][lane] * plane.x +
+                                      batch.y[corner][lane] * plane.y +
+                                      batch.z[corner][lane] * plane.z +
+                                      plane.w;
+    }
+  }
+  uint32_t crossingMask = 0u;
+  for (size_t lane = 0; lane < kPlaneDistanceBatchSize; ++lane) {
+    const float d0 = batch.distances[0][lane];
+    const float d1 = batch.distances[1][lane];
+    const float d2 = batch.distances[2][lane];
+    const bool hasPositive = d0 > kDistanceEpsilon || d1 > kDistanceEpsilon ||
+                             d2 > kDistanceEpsilon;
+    const bool hasNegative = d0 < -kDistanceEpsilon ||
+                             d1 < -kDistanceEpsilon || d2 < -kDistanceEpsilon;
+    crossingMask |= static_cast<uint32_t>(hasPositive && hasNegative) << lane;
+  }
+  batch.crossingMask = crossingMask & validMask;
+}
+
+// Welds loop points within the merge radius, returning the lowest-index match
+// like a linear first-match scan would. Small loops are scanned directly; past
+// kLinearWeldLimit points lookups go through a spatial hash of grid cells.
+class SectionCapPointWelder {
+ public:
+  static constexpr size_t kLinearWeldLimit = 32u;
+
+  explicit SectionCapPointWelder(std::vector<glm::vec3>& points)
+      : points_(points) {}
+
+  [[nodiscard]] uint32_t indexFor(const glm::vec3& point) {
+    const uint32_t found =
+        hashed_ ? findHashed(point) : findLinear(point);
+    if (found != kNoPoint) {
+      return found;
+    }
+
+    const uint32_t index = static_cast<uint32_t>(std::min<size_t>(
+        points_.size(), std::numeric_limits<uint32_t>::max()));
+    points_.push_back(point);
+    if (hashed_) {
+      insertHashed(index);
+    } else if (points_.size() > kLinearWeldLimit) {
+      hashed_ = true;
+      for (uint32_t existing = 0; existing < points_.size(); ++existing) {
+        insertHashed(existing);
+      }
+    }
+    return index;
+  }
+
+ private:
+  static constexpr uint32_t kNoPoint = std::numeric_limits<uint32_t>::max();
+
+  [[nodiscard]] bool merges(uint32_t index, const glm::vec3& point) const {
+    return glm::dot(points_[index] - point, points_[index] - point) <=
+           kPointMergeEpsilon2;
+  }
+
+  [[nodiscard]] uint32_t findLinear(const glm::vec3& point) const {
+    for (uint32_t index = 0; index < points_.size(); ++index) {
+      if (merges(index, point)) {
+        return index;
+      }
+    }
+    return kNoPoint;
+  }
+
+  [[nodiscard]] uint32_t findHashed(const glm::vec3& point) const {
+    const std::array<int64_t, 3> cell{cellCoordinate(point.x),
+                                      cellCoordinate(point.y),
+                                      cellCoordinate(point.z)};
+    uint32_t found = kNoPoint;
+    for (int64_t dz = -1; dz <= 1; ++dz) {
+      for (int64_t dy = -1; dy <= 1; ++dy) {
+        for (int64_t dx = -1; dx <= 1; ++dx) {
+          const auto head =
+              heads_.find(cellKey(cell[0] + dx, cell[1] + dy, cell[2] + dz));
+          if (head == heads_.end()) {
+            continue;
+          }
+          for (uint32_t index = head->second; index != kNoPoint;
+               index = next_[index]) {
+            if (index < found && merges(index, point)) {
+              found = index;
+            }
+          }
+        }
+      }
+    }
+    return found;
+  }
+
+  void insertHashed(uint32_t index) {
+    const glm::vec3& point = points_[index];
+    const uint64_t key = cellKey(cellCoordinate(point.x),
+                                 cellCoordinate(point.y),
+                                 cellCoordinate(point.z));
+    next_.resize(std::max<size_t>(next_.size(), index + 1u), kNoPoint);
+    auto [head, inserted] = heads_.try_emplace(key, index);
+    if (!inserted) {
+      next_[index] = head->second;
+      head->second = index;
+    }
+  }
+
+  [[nodiscard]] static int64_t cellCoordinate(float value) {
+    const double cell =
+        std::floor(static_cast<double>(value) / kPointMergeCellSize);
+    return static_cast<int64_t>(std::clamp(cell, -4.0e18, 4.0e18));
+  }
+
+  [[nodiscard]] static uint64_t cellKey(int64_t x, int64_t y, int64_t z) {
+    return static_cast<uint64_t>(x) * 0x9e3779b97f4a7c15ull ^
+           static_cast<uint64_t>(y) * 0xc2b2ae3d27d4eb4full ^
+           static_cast<uint64_t>(z) * 0x165667b19e3779f9ull;
+  }
+
+  std::vector<glm::vec3>& points_;
+  bool hashed_{false};
+  std::unordered_map<uint64_t, uint32_t> heads_{};
+  std::vector<uint32_t> next_{};
+};
+
+// Caps built by one worker from a contiguous range of surfaces on one cap
+// plane. Indices and draw commands are local to `mesh`.
+struct SectionCapChunk {
+  BimSectionCapGeneratedMesh mesh{};
+  bool hasMarkerExtents{false};
+  glm::vec2 markerMin{std::numeric_limits<float>::max()};
+  glm::vec2 markerMax{std::numeric_limits<float>::lowest()};
+};
+
+void appendSectionCapChunk(BimSectionCapGeneratedMesh& mesh,
+                           BimSectionCapGeneratedMesh&& chunk) {
+  if (mesh.vertices.empty() && mesh.indices.empty() &&
+      mesh.fillDrawCommands.empty() && mesh.hatchDrawCommands.empty()) {
+    std::vector<BimSectionMarkerLine> markerLines =
+        std::move(mesh.sectionMarkerLines);
+    mesh = std::move(chunk);
+    mesh.sectionMarkerLines = std::move(markerLines);
+    return;
+  }
+
+  const uint32_t baseVertex = static_cast<uint32_t>(std::min<size_t>(
+      mesh.vertices.size(), std::numeric_limits<uint32_t>::max()));
+  const uint32_t baseIndex = static_cast<uint32_t>(std::min<size_t>(
+      mesh.indices.size(), std::numeric_limits<uint32_t>::max()));
+  mesh.vertices.insert(mesh.vertices.end(), chunk.vertices.begin(),
+                       chunk.vertices.end());
+  mesh.indices.reserve(mesh.indices.size() + chunk.indices.size());
+  for (const uint32_t index : chunk.indices) {
+    mesh.indices.push_back(baseVertex + index);
+  }
+  auto appendCommands = [baseIndex](const std::vector<DrawCommand>& source,
+                                    std::vector<DrawCommand>& target) {
+    for (DrawCommand command : source) {
+      command.firstIndex += baseIndex;
+      target.push_back(command);
+    }
+  };
+  appendCommands(chunk.fillDrawCommands, mesh.fillDrawCommands);
+  appendCommands(chunk.hatchDrawCommands, mesh.hatchDrawCommands);
+  mesh.fillDrawStyles.insert(mesh.fillDrawStyles.end(),
+                             chunk.fillDrawStyles.begin(),
+                             chunk.fillDrawStyles.end());
+  mesh.hatchDrawStyles.insert(mesh.hatchDrawStyles.end(),
+                              chunk.hatchDrawStyles.begin(),
+                              chunk.hatchDrawStyles.end());
+}
+
+}  // namespace
+
 [[nodiscard]] glm::vec4 normalizedSectionCapPlane(glm::vec4 plane) {
   const glm::vec3 normal{plane};
   const float length = glm::length(normal);
@@ -47,23 +379,13 @@ bool appendBimSectionCapClipPlane(BimSectionCapBuildOptions& options,
     glm::vec3 b{0.0f};
   };
 
-  struct SurfaceKey {
-    uint32_t objectIndex{std::numeric_limits<uint32_t>::max()};
-    uint32_t materialIndex{kInvalidBimSectionCapMaterialIndex};
-
-    [[nodiscard]] bool operator<(const SurfaceKey& other) const {
-      if (objectIndex != other.objectIndex) {
-        return objectIndex < other.objectIndex;
-      }
-      return materialIndex < other.materialIndex;
-    }
-  };
-
-  constexpr float kDistanceEpsilon = 1.0e-5f;
-  constexpr float kPointMergeEpsilon2 = 1.0e-10f;
-  constexpr float kMinSegmentLength2 = 1.0e-8f;
-
   BimSectionCapGeneratedMesh mesh{};
+  const SectionCapSurfaces grouped = groupSectionCapSurfaces(triangles);
+  if (grouped.surfaces.empty()) {
+    return mesh;
+  }
+  const size_t workerCount = container::util::parallelWorkerCount(
+      grouped.validTriangleCount, options.workerCount, kMinTrianglesPerWorker);
   std::array<glm::vec4, kBimSectionCapMaxPlanes> clipPlanes{};
   uint32_t clipPlaneCount =
       std::min<uint32_t>(options.clipPlaneCount,
@@ -132,11 +454,6 @@ bool appendBimSectionCapClipPlane(BimSectionCapBuildOptions& options,
     return style;
   };
 
-  auto finitePoint = [](const glm::vec3& point) {
-    return std::isfinite(point.x) && std::isfinite(point.y) &&
-           std::isfinite(point.z);
-  };
-
   auto addUniquePoint = [](std::vector<glm::vec3>& points,
                            const glm::vec3& point) {
     for (const glm::vec3& existing : points) {
@@ -207,87 +524,72 @@ bool appendBimSectionCapClipPlane(BimSectionCapBuildOptions& options,
     const glm::vec3 axisV = glm::normalize(glm::cross(normal, axisU));
     const glm::vec3 planeOrigin = -plane.w * normal;
 
-    std::vector<Segment> segments;
-    segments.reserve(triangles.size());
-
-    for (const BimSectionCapTriangle& triangle : triangles) {
-      if (triangle.objectIndex == std::numeric_limits<uint32_t>::max() ||
-          !finitePoint(triangle.p0) || !finitePoint(triangle.p1) ||
-          !finitePoint(triangle.p2)) {
-        continue;
-      }
-
-      const std::array<glm::vec3, 3> points{
-          triangle.p0, triangle.p1, triangle.p2};
-      const std::array<float, 3> distances{
-          signedDistanceToPlane(plane, points[0]),
-          signedDistanceToPlane(plane, points[1]),
-          signedDistanceToPlane(plane, points[2])};
-      const bool hasPositive =
-          distances[0] > kDistanceEpsilon ||
-          distances[1] > kDistanceEpsilon ||
-          distances[2] > kDistanceEpsilon;
-      const bool hasNegative =
-          distances[0] < -kDistanceEpsilon ||
-          distances[1] < -kDistanceEpsilon ||
-          distances[2] < -kDistanceEpsilon;
-      if (!hasPositive || !hasNegative) {
-        continue;
-      }
+    auto collectSurfaceSegments = [&](const SectionCapSurface& surface,
+                                      std::vector<Segment>& segments) {
+      PlaneDistanceBatch batch;
+      const size_t surfaceEnd = surface.firstSlot + surface.slotCount;
+      for (size_t batchStart = surface.firstSlot; batchStart < surfaceEnd;
+           batchStart += kPlaneDistanceBatchSize) {
+        const size_t batchCount =
+            std::min(kPlaneDistanceBatchSize, surfaceEnd - batchStart);
+        computePlaneDistanceBatch(grouped, batchStart, batchCount, plane,
+                                  batch);
+        for (uint32_t crossing = batch.crossingMask; crossing != 0u;
+             crossing &= crossing - 1u) {
+          const size_t lane = static_cast<size_t>(std::countr_zero(crossing));
+          const BimSectionCapTriangle& triangle =
+              grouped.triangle(batch.slots[lane]);
+          const std::array<glm::vec3, 3> points{triangle.p0, triangle.p1,
+                                                triangle.p2};
+          const std::array<float, 3> distances{batch.distances[0][lane],
+                                               batch.distances[1][lane],
+                                               batch.distances[2][lane]};
+
+          std::vector<glm::vec3> crossingPoints;
+          crossingPoints.reserve(2u);
+          for (uint32_t edge = 0; edge < 3u; ++edge) {
+            const uint32_t next = (edge + 1u) % 3u;
+            const float d0 = distances[edge];
+            const float d1 = distances[next];
+            if (std::abs(d0) <= kDistanceEpsilon) {
+              addUniquePoint(crossingPoints, points[edge]);
+            }
+            if ((d0 > kDistanceEpsilon && d1 < -kDistanceEpsilon) ||
+                (d0 < -kDistanceEpsilon && d1 > kDistanceEpsilon)) {
+              const float t = d0 / (d0 - d1);
+              addUniquePoint(crossingPoints,
+                             points[edge] + (points[next] - points[edge]) * t);
+            }
+            if (std::abs(d1) <= kDistanceEpsilon) {
+              addUniquePoint(crossingPoints, points[next]);
+            }
+          }
+          if (crossingPoints.size() != 2u) {
+            continue;
+          }
 
-      std::vector<glm::vec3> crossingPoints;
-      crossingPoints.reserve(2u);
-      for (uint32_t edge = 0; edge < 3u; ++edge) {
-        const uint32_t next = (edge + 1u) % 3u;
-        const float d0 = distances[edge];
-        const float d1 = distances[next];
-        if (std::abs(d0) <= kDistanceEpsilon) {
-          addUniquePoint(crossingPoints, points[edge]);
-        }
-        if ((d0 > kDistanceEpsilon && d1 < -kDistanceEpsilon) ||
-            (d0 < -kDistanceEpsilon && d1 > kDistanceEpsilon)) {
-          const float t = d0 / (d0 - d1);
-          addUniquePoint(crossingPoints,
-                         points[edge] + (points[next] - points[edge]) * t);
-        }
-        if (std::abs(d1) <= kDistanceEpsilon) {
-          addUniquePoint(crossingPoints, points[next]);
+          if (glm::dot(crossingPoints[0] - crossingPoints[1],
+                       crossingPoints[0] - crossingPoints[1]) <=
+              kMinSegmentLength2) {
+            continue;
+          }
+          segments.push_back(Segment{surface.objectIndex,
+                                     surface.materialIndex, crossingPoints[0],
+                                     crossingPoints[1]});
         }
       }
-      if (crossingPoints.size() != 2u) {
-        continue;
-      }
-
-      if (glm::dot(crossingPoints[0] - crossingPoints[1],
-                   crossingPoints[0] - crossingPoints[1]) <=
-          kMinSegmentLength2) {
-        continue;
-      }
-      segments.push_back(Segment{triangle.objectIndex, triangle.materialIndex,
-                                 crossingPoints[0], crossingPoints[1]});
-    }
-
-    if (segments.empty()) {
-      continue;
-    }
-
-    std::map<SurfaceKey, std::vector<Segment>> segmentsBySurface;
-    for (const Segment& segment : segments) {
-      segmentsBySurface[SurfaceKey{segment.objectIndex,
-                                   segment.materialIndex}]
-          .push_back(segment);
-    }
+    };
 
-    auto addVertex = [&](uint32_t objectIndex, const glm::vec3& position,
+    auto addVertex = [&](SectionCapChunk& chunk,
+                         const glm::vec3& position,
                          const glm::vec3& color) -> uint32_t {
-      (void)objectIndex;
       container::geometry::Vertex vertex{};
       vertex.position = position + normal * options.capOffset;
       vertex.normal = normal;
       vertex.color = color;
       const uint32_t index = static_cast<uint32_t>(std::min<size_t>(
-          mesh.vertices.size(), std::numeric_limits<uint32_t>::max()));
-      mesh.vertices.push_back(vertex);
+          chunk.mesh.vertices.size(), std::numeric_limits<uint32_t>::max()));
+      chunk.mesh.vertices.push_back(vertex);
       return index;
     };
 
@@ -302,12 +604,13 @@ bool appendBimSectionCapClipPlane(BimSectionCapBuildOptions& options,
     bool hasMarkerExtents = false;
     glm::vec2 markerMin{std::numeric_limits<float>::max()};
     glm::vec2 markerMax{std::numeric_limits<float>::lowest()};
-    auto expandMarkerExtents = [&](const std::vector<glm::vec3>& polygon) {
+    auto expandMarkerExtents = [&](SectionCapChunk& chunk,
+                                   const std::vector<glm::vec3>& polygon) {
       for (const glm::vec3& point : polygon) {
         const glm::vec2 planePoint = toPlane2(point);
-        markerMin = glm::min(markerMin, planePoint);
-        markerMax = glm::max(markerMax, planePoint);
-        hasMarkerExtents = true;
+        chunk.markerMin = glm::min(chunk.markerMin, planePoint);
+        chunk.markerMax = glm::max(chunk.markerMax, planePoint);
+        chunk.hasMarkerExtents = true;
       }
     };
     auto appendSectionMarker = [&]() {
@@ -336,7 +639,8 @@ bool appendBimSectionCapClipPlane(BimSectionCapBuildOptions& options,
     };
 
     auto appendHatchesForPolygon =
-        [&](uint32_t objectIndex, const std::vector<glm::vec3>& polygon,
+        [&](SectionCapChunk& chunk,
+            const std::vector<glm::vec3>& polygon,
             const BimSectionCapDrawStyle& style, float angle) {
           if (polygon.size() < 3u) {
             return;
@@ -413,10 +717,10 @@ bool appendBimSectionCapClipPlane(BimSectionCapBuildOptions& options,
               if (glm::dot(h0 - h1, h0 - h1) <= kMinSegmentLength2) {
                 continue;
               }
-              const uint32_t i0 = addVertex(objectIndex, h0, style.hatchColor);
-              const uint32_t i1 = addVertex(objectIndex, h1, style.hatchColor);
-              mesh.indices.push_back(i0);
-              mesh.indices.push_back(i1);
+              const uint32_t i0 = addVertex(chunk, h0, style.hatchColor);
+              const uint32_t i1 = addVertex(chunk, h1, style.hatchColor);
+              chunk.mesh.indices.push_back(i0);
+              chunk.mesh.indices.push_back(i1);
             }
           }
         };
@@ -433,33 +737,19 @@ bool appendBimSectionCapClipPlane(BimSectionCapBuildOptions& options,
           std::vector<LoopEdge> edges;
           points.reserve(objectSegments.size() * 2u);
           edges.reserve(objectSegments.size());
-
-          auto pointIndexFor = [&](const glm::vec3& point) {
-            for (uint32_t index = 0; index < points.size(); ++index) {
-              if (glm::dot(points[index] - point, points[index] - point) <=
-                  kPointMergeEpsilon2) {
-                return index;
-              }
-            }
-            const uint32_t index = static_cast<uint32_t>(std::min<size_t>(
-                points.size(), std::numeric_limits<uint32_t>::max()));
-            points.push_back(point);
-            return index;
-          };
+          SectionCapPointWelder welder(points);
+          std::unordered_set<uint64_t> edgeKeys;
+          edgeKeys.reserve(objectSegments.size());
 
           auto addEdge = [&](uint32_t a, uint32_t b) {
             if (a == b) {
               return;
             }
-            const uint32_t lo = std::min(a, b);
-            const uint32_t hi = std::max(a, b);
-            for (const LoopEdge& edge : edges) {
-              if (std::min(edge.a, edge.b) == lo &&
-                  std::max(edge.a, edge.b) == hi) {
-                return;
-              }
+            const uint64_t lo = std::min(a, b);
+            const uint64_t hi = std::max(a, b);
+            if (edgeKeys.insert((lo << 32u) | hi).second) {
+              edges.push_back(LoopEdge{a, b, false});
             }
-            edges.push_back(LoopEdge{a, b, false});
           };
 
           for (const Segment& segment : objectSegments) {
@@ -467,7 +757,26 @@ bool appendBimSectionCapClipPlane(BimSectionCapBuildOptions& options,
                 kMinSegmentLength2) {
               continue;
             }
-            addEdge(pointIndexFor(segment.a), pointIndexFor(segment.b));
+            const uint32_t a = welder.indexFor(segment.a);
+            addEdge(a, welder.indexFor(segment.b));
+          }
+
+          // Incident edges per point, in edge order, so the walk below picks
+          // the same edge a scan over every edge would.
+          std::vector<uint32_t> incidentOffsets(points.size() + 1u, 0u);
+          for (const LoopEdge& edge : edges) {
+            ++incidentOffsets[edge.a + 1u];
+            ++incidentOffsets[edge.b + 1u];
+          }
+          for (size_t point = 0; point < points.size(); ++point) {
+            incidentOffsets[point + 1u] += incidentOffsets[point];
+          }
+          std::vector<uint32_t> incidentEdges(edges.size() * 2u);
+          std::vector<uint32_t> incidentFill(incidentOffsets.begin(),
+                                             incidentOffsets.end() - 1);
+          for (uint32_t edgeIndex = 0; edgeIndex < edges.size(); ++edgeIndex) {
+            incidentEdges[incidentFill[edges[edgeIndex].a]++] = edgeIndex;
+            incidentEdges[incidentFill[edges[edgeIndex].b]++] = edgeIndex;
           }
 
           std::vector<std::vector<glm::vec3>> loops;
@@ -485,22 +794,21 @@ bool appendBimSectionCapClipPlane(BimSectionCapBuildOptions& options,
             for (size_t guard = 0; guard < edges.size(); ++guard) {
               size_t nextEdgeIndex = edges.size();
               uint32_t nextVertex = 0;
-              for (size_t candidateIndex = 0; candidateIndex < edges.size();
-                   ++candidateIndex) {
+              for (uint32_t incident = incidentOffsets[current];
+                   incident < incidentOffsets[current + 1u]; ++incident) {
+                const uint32_t candidateIndex = incidentEdges[incident];
                 if (edges[candidateIndex].used) {
                   continue;
                 }
                 const LoopEdge& candidate = edges[candidateIndex];
-                if (candidate.a == current || candidate.b == current) {
-                  const uint32_t other =
-                      candidate.a == current ? candidate.b : candidate.a;
-                  if (other == previous && other != loop.front()) {
-                    continue;
-                  }
-                  nextEdgeIndex = candidateIndex;
-                  nextVertex = other;
-                  break;
+                const uint32_t other =
+                    candidate.a == current ? candidate.b : candidate.a;
+                if (other == previous && other != loop.front()) {
+                  continue;
                 }
+                nextEdgeIndex = candidateIndex;
+                nextVertex = other;
+                break;
               }
 
               if (nextEdgeIndex == edges.size()) {
@@ -661,14 +969,24 @@ bool appendBimSectionCapClipPlane(BimSectionCapBuildOptions& options,
       return trianglesOut;
     };
 
-    for (const auto& [surfaceKey, objectSegments] : segmentsBySurface) {
-      const uint32_t objectIndex = surfaceKey.objectIndex;
+    auto buildSurface = [&](const SectionCapSurface& surface,
+                            std::vector<Segment>& objectSegments,
+                            SectionCapChunk& chunk) {
+      if (!surfaceMayCrossPlane(surface, plane)) {
+        return;
+      }
+      objectSegments.clear();
+      collectSurfaceSegments(surface, objectSegments);
+      if (objectSegments.empty()) {
+        return;
+      }
+      const uint32_t objectIndex = surface.objectIndex;
       const BimSectionCapDrawStyle drawStyle =
-          resolveStyle(objectIndex, surfaceKey.materialIndex);
+          resolveStyle(objectIndex, surface.materialIndex);
       std::vector<std::vector<glm::vec3>> polygons =
           reconstructSegmentLoops(objectSegments);
       if (polygons.empty()) {
-        continue;
+        return;
       }
 
       std::vector<std::vector<glm::vec3>> clippedPolygons;
@@ -689,8 +1007,9 @@ bool appendBimSectionCapClipPlane(BimSectionCapBuildOptions& options,
         }
       }
 
+      BimSectionCapGeneratedMesh& target = chunk.mesh;
       const uint32_t fillFirstIndex = static_cast<uint32_t>(std::min<size_t>(
-          mesh.indices.size(), std::numeric_limits<uint32_t>::max()));
+          target.indices.size(), std::numeric_limits<uint32_t>::max()));
       std::vector<std::vector<glm::vec3>> hatchPolygons;
       hatchPolygons.reserve(clippedPolygons.size());
       for (size_t polygonIndex = 0; polygonIndex < clippedPolygons.size();
@@ -737,52 +1056,82 @@ bool appendBimSectionCapClipPlane(BimSectionCapBuildOptions& options,
             continue;
           }
           const uint32_t i0 =
-              addVertex(objectIndex, triangle[0], drawStyle.fillColor);
+              addVertex(chunk, triangle[0], drawStyle.fillColor);
           const uint32_t i1 =
-              addVertex(objectIndex, triangle[1], drawStyle.fillColor);
+              addVertex(chunk, triangle[1], drawStyle.fillColor);
           const uint32_t i2 =
-              addVertex(objectIndex, triangle[2], drawStyle.fillColor);
-          mesh.indices.push_back(i0);
-          mesh.indices.push_back(i1);
-          mesh.indices.push_back(i2);
+              addVertex(chunk, triangle[2], drawStyle.fillColor);
+          target.indices.push_back(i0);
+          target.indices.push_back(i1);
+          target.indices.push_back(i2);
         }
       }
       const uint32_t fillIndexCount =
-          static_cast<uint32_t>(mesh.indices.size() - fillFirstIndex);
+          static_cast<uint32_t>(target.indices.size() - fillFirstIndex);
       if (fillIndexCount > 0u) {
         for (const std::vector<glm::vec3>& polygon : hatchPolygons) {
-          expandMarkerExtents(polygon);
+          expandMarkerExtents(chunk, polygon);
         }
-        mesh.fillDrawCommands.push_back(DrawCommand{
+        target.fillDrawCommands.push_back(DrawCommand{
             .objectIndex = objectIndex,
             .firstIndex = fillFirstIndex,
             .indexCount = fillIndexCount,
             .instanceCount = 1u,
         });
-        mesh.fillDrawStyles.push_back(drawStyle);
+        target.fillDrawStyles.push_back(drawStyle);
       }
 
       const uint32_t hatchFirstIndex = static_cast<uint32_t>(std::min<size_t>(
-          mesh.indices.size(), std::numeric_limits<uint32_t>::max()));
+          target.indices.size(), std::numeric_limits<uint32_t>::max()));
       for (const std::vector<glm::vec3>& polygon : hatchPolygons) {
-        appendHatchesForPolygon(objectIndex, polygon, drawStyle,
+        appendHatchesForPolygon(chunk, polygon, drawStyle,
                                 drawStyle.hatchAngleRadians);
         if (options.crossHatch) {
-          appendHatchesForPolygon(objectIndex, polygon, drawStyle,
+          appendHatchesForPolygon(chunk, polygon, drawStyle,
                                   drawStyle.hatchAngleRadians +
                                       1.57079632679f);
         }
       }
       const uint32_t hatchIndexCount =
-          static_cast<uint32_t>(mesh.indices.size() - hatchFirstIndex);
+          static_cast<uint32_t>(target.indices.size() - hatchFirstIndex);
       if (hatchIndexCount > 0u) {
-        mesh.hatchDrawCommands.push_back(DrawCommand{
+        target.hatchDrawCommands.push_back(DrawCommand{
             .objectIndex = objectIndex,
             .firstIndex = hatchFirstIndex,
             .indexCount = hatchIndexCount,
             .instanceCount = 1u,
         });
-        mesh.hatchDrawStyles.push_back(drawStyle);
+        target.hatchDrawStyles.push_back(drawStyle);
+      }
+    };
+
+    // Surfaces are independent: each worker builds a contiguous range of
+    // them into its own chunk, and chunks are stitched together in order.
+    const size_t chunkCount = std::min(workerCount, grouped.surfaces.size());
+    std::vector<SectionCapChunk> chunks(chunkCount);
+    const size_t surfacesPerChunk =
+        (grouped.surfaces.size() + chunkCount - 1u) / chunkCount;
+    container::util::forEachParallelRange(
+        chunkCount, chunkCount, [&](size_t begin, size_t end) {
+          std::vector<Segment> segments;
+          for (size_t chunkIndex = begin; chunkIndex < end; ++chunkIndex) {
+            const size_t surfaceEnd =
+                std::min(grouped.surfaces.size(),
+                         (chunkIndex + 1u) * surfacesPerChunk);
+            for (size_t surfaceIndex = chunkIndex * surfacesPerChunk;
+                 surfaceIndex < surfaceEnd; ++surfaceIndex) {
+              buildSurface(grouped.surfaces[surfaceIndex], segments,
+                           chunks[chunkIndex]);
+            }
+          }
+        });
+
+    for (SectionCapChunk& chunk : chunks) {
+      appendSectionCapChunk(mesh, std::move(chunk.mesh));
+      if (chunk.hasMarkerExtents) {
+        markerMin = glm::min(markerMin, chunk.markerMin);
+        markerMax = glm::max(markerMax, chunk.markerMax);
+        hasMarkerExtents = true;
       }
     }
     appendSectionMarker();
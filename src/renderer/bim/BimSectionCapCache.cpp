@@ -0,0 +1,360 @@
+#include "Container/renderer/bim/BimSectionCapCache.h"
+
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace container::renderer {
+
+namespace {
+
+// Matches the builder's plane epsilon: a point closer to a cap plane than
+// this counts as on it, both for cutting and for clipping.
+constexpr float kDistanceEpsilon = 1.0e-5f;
+// A rebuilt cap that grows by up to a quarter still fits its slice.
+constexpr size_t kSliceSlackDivisor = 4u;
+// Room past the last slice for caps that outgrow theirs, or objects a moved
+// plane newly reaches, before every slice is laid out again.
+constexpr size_t kTailSlackDivisor = 2u;
+constexpr size_t kMinTailVertices = 1024u;
+constexpr size_t kMinTailIndices = 2048u;
+
+[[nodiscard]] bool finiteVec3(const glm::vec3& value) {
+  return std::isfinite(value.x) && std::isfinite(value.y) &&
+         std::isfinite(value.z);
+}
+
+// The planes the builder cuts caps on: the clip planes when there are any,
+// otherwise the section plane alone.
+uint32_t effectiveCapPlanes(
+    const BimSectionCapBuildOptions& options,
+    std::array<glm::vec4, kBimSectionCapMaxPlanes>& planes) {
+  const uint32_t clipPlaneCount = std::min<uint32_t>(
+      options.clipPlaneCount, static_cast<uint32_t>(planes.size()));
+  if (clipPlaneCount == 0u) {
+    planes[0] = normalizedSectionCapPlane(options.sectionPlane);
+    return 1u;
+  }
+  for (uint32_t planeIndex = 0; planeIndex < clipPlaneCount; ++planeIndex) {
+    planes[planeIndex] =
+        normalizedSectionCapPlane(options.clipPlanes[planeIndex]);
+  }
+  return clipPlaneCount;
+}
+
+// +1 or -1 when every point inside the bounds is clearly on that side of the
+// plane, 0 when the plane may touch them. The slack covers the builder's
+// epsilon plus rounding in its per-vertex and interpolated distances.
+[[nodiscard]] int boundsPlaneSide(const glm::vec4& plane,
+                                  const glm::vec3& boundsMin,
+                                  const glm::vec3& boundsMax) {
+  const glm::vec3 normal{plane};
+  const glm::vec3 center = (boundsMin + boundsMax) * 0.5f;
+  const glm::vec3 extent = (boundsMax - boundsMin) * 0.5f;
+  const float centerDistance = glm::dot(normal, center) + plane.w;
+  const float radius = glm::dot(glm::abs(normal), extent);
+  const float slack =
+      2.0f * kDistanceEpsilon +
+      1.0e-4f * (glm::dot(glm::abs(normal), glm::abs(center)) + radius +
+                 std::abs(plane.w) + 1.0f);
+  if (centerDistance - radius > slack) {
+    return 1;
+  }
+  if (centerDistance + radius < -slack) {
+    return -1;
+  }
+  return 0;
+}
+
+}  // namespace
+
+void appendBimSectionMarkerGeometry(BimSectionCapGeneratedMesh& mesh,
+                                    uint32_t objectIndex) {
+  for (const BimSectionMarkerLine& marker : mesh.sectionMarkerLines) {
+    if (!finiteVec3(marker.a) || !finiteVec3(marker.b) ||
+        !finiteVec3(marker.color)) {
+      continue;
+    }
+
+    const glm::vec3 line = marker.b - marker.a;
+    const float lineLength = glm::length(line);
+    if (!std::isfinite(lineLength) || lineLength <= 0.0001f) {
+      continue;
+    }
+
+    const size_t baseVertex = mesh.vertices.size();
+    const uint32_t firstIndex = static_cast<uint32_t>(std::min<size_t>(
+        mesh.indices.size(), std::numeric_limits<uint32_t>::max()));
+
+    auto pushVertex = [&](const glm::vec3& position) {
+      container::geometry::Vertex vertex{};
+      vertex.position = position;
+      vertex.color = marker.color;
+      mesh.vertices.push_back(vertex);
+      return static_cast<uint32_t>(mesh.vertices.size() - 1u);
+    };
+    auto pushSegment = [&](const glm::vec3& a, const glm::vec3& b) {
+      const uint32_t ia = pushVertex(a);
+      const uint32_t ib = pushVertex(b);
+      mesh.indices.push_back(ia);
+      mesh.indices.push_back(ib);
+    };
+
+    pushSegment(marker.a, marker.b);
+
+    const glm::vec3 direction = line / lineLength;
+    const glm::vec3 reference = std::abs(direction.y) < 0.9f
+                                    ? glm::vec3{0.0f, 1.0f, 0.0f}
+                                    : glm::vec3{1.0f, 0.0f, 0.0f};
+    glm::vec3 side = glm::cross(direction, reference);
+    const float sideLength = glm::length(side);
+    if (std::isfinite(sideLength) && sideLength > 0.0001f) {
+      side /= sideLength;
+    } else {
+      side = {0.0f, 0.0f, 1.0f};
+    }
+    const float arrowLength = std::clamp(lineLength * 0.08f, 0.05f, 1.0f);
+    const float arrowWidth = arrowLength * 0.45f;
+    auto pushArrow = [&](const glm::vec3& tip,
+                         const glm::vec3& inwardDirection) {
+      const glm::vec3 wingCenter = tip + inwardDirection * arrowLength;
+      pushSegment(tip, wingCenter + side * arrowWidth);
+      pushSegment(tip, wingCenter - side * arrowWidth);
+    };
+    if (marker.startArrow) {
+      pushArrow(marker.a, direction);
+    }
+    if (marker.endArrow) {
+      pushArrow(marker.b, -direction);
+    }
+
+    const uint32_t indexCount =
+        static_cast<uint32_t>(mesh.indices.size() - firstIndex);
+    if (indexCount == 0u) {
+      mesh.vertices.resize(baseVertex);
+      continue;
+    }
+
+    mesh.hatchDrawCommands.push_back(DrawCommand{
+        .objectIndex = objectIndex,
+        .firstIndex = firstIndex,
+        .indexCount = indexCount,
+        .instanceCount = 1u,
+    });
+    mesh.hatchDrawStyles.push_back(BimSectionCapDrawStyle{
+        .objectIndex = objectIndex,
+        .materialIndex = kInvalidBimSectionCapMaterialIndex,
+        .fillColor = marker.color,
+        .fillOpacity = 1.0f,
+        .hatchSpacing = 0.0f,
+        .hatchAngleRadians = 0.0f,
+        .hatchColor = marker.color,
+        .lineWidth = marker.lineWidth,
+    });
+  }
+}
+
+void BimSectionCapCache::reset() {
+  entries_.clear();
+  geometry_ = {};
+  vertexEnd_ = 0;
+  indexEnd_ = 0;
+}
+
+bool BimSectionCapCache::needsRebuild(
+    uint32_t objectIndex, const BimSectionCapBuildOptions& localOptions) const {
+  if (objectIndex >= entries_.size() || !entries_[objectIndex].built) {
+    return true;
+  }
+  const Entry& entry = entries_[objectIndex];
+  std::array<glm::vec4, kBimSectionCapMaxPlanes> planes{};
+  const uint32_t planeCount = effectiveCapPlanes(localOptions, planes);
+  if (planeCount != entry.capPlaneCount) {
+    return true;
+  }
+  if (!entry.hasBounds) {
+    // Nothing valid to cut, whatever the planes.
+    return false;
+  }
+  // A plane that stays clear of the bounds on one side neither cuts the
+  // object nor changes what the other planes' caps keep after clipping.
+  for (uint32_t planeIndex = 0; planeIndex < planeCount; ++planeIndex) {
+    const glm::vec4& previous = entry.capPlanes[planeIndex];
+    const glm::vec4& next = planes[planeIndex];
+    if (previous == next) {
+      continue;
+    }
+    const int previousSide =
+        boundsPlaneSide(previous, entry.boundsMin, entry.boundsMax);
+    if (previousSide == 0 ||
+        previousSide !=
+            boundsPlaneSide(next, entry.boundsMin, entry.boundsMax)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void BimSectionCapCache::store(uint32_t objectIndex,
+                               const BimSectionCapBuildOptions& localOptions,
+                               std::span<const BimSectionCapTriangle> triangles,
+                               BimSectionCapGeneratedMesh mesh) {
+  if (objectIndex >= entries_.size()) {
+    entries_.resize(static_cast<size_t>(objectIndex) + 1u);
+  }
+  Entry& entry = entries_[objectIndex];
+  entry.built = true;
+  entry.dirty = true;
+  entry.capPlaneCount = effectiveCapPlanes(localOptions, entry.capPlanes);
+
+  entry.hasBounds = false;
+  entry.boundsMin = glm::vec3{std::numeric_limits<float>::max()};
+  entry.boundsMax = glm::vec3{std::numeric_limits<float>::lowest()};
+  for (const BimSectionCapTriangle& triangle : triangles) {
+    if (!finiteVec3(triangle.p0) || !finiteVec3(triangle.p1) ||
+        !finiteVec3(triangle.p2)) {
+      continue;
+    }
+    for (const glm::vec3& point : {triangle.p0, triangle.p1, triangle.p2}) {
+      entry.boundsMin = glm::min(entry.boundsMin, point);
+      entry.boundsMax = glm::max(entry.boundsMax, point);
+    }
+    entry.hasBounds = true;
+  }
+
+  if (mesh.valid()) {
+    appendBimSectionMarkerGeometry(mesh, objectIndex);
+    entry.mesh = std::move(mesh);
+  } else {
+    entry.mesh = {};
+  }
+}
+
+BimSectionCapCacheUpdate BimSectionCapCache::commit() {
+  BimSectionCapCacheUpdate update{};
+  for (Entry& entry : entries_) {
+    if (!entry.dirty) {
+      continue;
+    }
+    ++update.rebuiltObjectCount;
+    const size_t vertexCount = entry.mesh.vertices.size();
+    const size_t indexCount = entry.mesh.indices.size();
+    if (vertexCount <= entry.vertexCapacity &&
+        indexCount <= entry.indexCapacity) {
+      continue;
+    }
+    if (vertexEnd_ + vertexCount <= geometry_.vertices.size() &&
+        indexEnd_ + indexCount <= geometry_.indices.size()) {
+      entry.firstVertex = vertexEnd_;
+      entry.vertexCapacity = vertexCount;
+      entry.firstIndex = indexEnd_;
+      entry.indexCapacity = indexCount;
+      vertexEnd_ += vertexCount;
+      indexEnd_ += indexCount;
+      continue;
+    }
+    update.reallocated = true;
+  }
+
+  if (update.reallocated) {
+    layoutSlices();
+  } else {
+    for (const Entry& entry : entries_) {
+      if (!entry.dirty) {
+        continue;
+      }
+      writeSlice(entry);
+      if (!entry.mesh.vertices.empty()) {
+        update.vertexRanges.push_back(BimSectionCapBufferRange{
+            .first = entry.firstVertex, .count = entry.mesh.vertices.size()});
+      }
+      if (!entry.mesh.indices.empty()) {
+        update.indexRanges.push_back(BimSectionCapBufferRange{
+            .first = entry.firstIndex, .count = entry.mesh.indices.size()});
+      }
+    }
+  }
+  for (Entry& entry : entries_) {
+    entry.dirty = false;
+  }
+  if (update.rebuiltObjectCount > 0u) {
+    rebuildDrawLists();
+  }
+  return update;
+}
+
+void BimSectionCapCache::layoutSlices() {
+  size_t vertexTotal = 0;
+  size_t indexTotal = 0;
+  for (Entry& entry : entries_) {
+    const size_t vertexCount = entry.mesh.vertices.size();
+    const size_t indexCount = entry.mesh.indices.size();
+    entry.firstVertex = vertexTotal;
+    entry.vertexCapacity = vertexCount + vertexCount / kSliceSlackDivisor;
+    entry.firstIndex = indexTotal;
+    entry.indexCapacity = indexCount + indexCount / kSliceSlackDivisor;
+    vertexTotal += entry.vertexCapacity;
+    indexTotal += entry.indexCapacity;
+  }
+  vertexEnd_ = vertexTotal;
+  indexEnd_ = indexTotal;
+  geometry_.vertices.assign(
+      vertexTotal +
+          std::max(vertexTotal / kTailSlackDivisor, kMinTailVertices),
+      container::geometry::Vertex{});
+  geometry_.indices.assign(
+      indexTotal + std::max(indexTotal / kTailSlackDivisor, kMinTailIndices),
+      0u);
+  for (const Entry& entry : entries_) {
+    writeSlice(entry);
+  }
+}
+
+void BimSectionCapCache::writeSlice(const Entry& entry) {
+  std::ranges::copy(entry.mesh.vertices,
+                    geometry_.vertices.begin() +
+                        static_cast<std::ptrdiff_t>(entry.firstVertex));
+  const uint32_t baseVertex = static_cast<uint32_t>(std::min<size_t>(
+      entry.firstVertex, std::numeric_limits<uint32_t>::max()));
+  for (size_t index = 0; index < entry.mesh.indices.size(); ++index) {
+    geometry_.indices[entry.firstIndex + index] =
+        baseVertex + entry.mesh.indices[index];
+  }
+}
+
+void BimSectionCapCache::rebuildDrawLists() {
+  geometry_.fillDrawCommands.clear();
+  geometry_.hatchDrawCommands.clear();
+  geometry_.fillDrawStyles.clear();
+  geometry_.hatchDrawStyles.clear();
+  geometry_.sectionMarkerLines.clear();
+  for (const Entry& entry : entries_) {
+    const BimSectionCapGeneratedMesh& mesh = entry.mesh;
+    const uint32_t baseIndex = static_cast<uint32_t>(std::min<size_t>(
+        entry.firstIndex, std::numeric_limits<uint32_t>::max()));
+    auto appendCommands = [baseIndex](const std::vector<DrawCommand>& source,
+                                      std::vector<DrawCommand>& target) {
+      for (DrawCommand command : source) {
+        command.firstIndex += baseIndex;
+        target.push_back(command);
+      }
+    };
+    appendCommands(mesh.fillDrawCommands, geometry_.fillDrawCommands);
+    appendCommands(mesh.hatchDrawCommands, geometry_.hatchDrawCommands);
+    geometry_.fillDrawStyles.insert(geometry_.fillDrawStyles.end(),
+                                    mesh.fillDrawStyles.begin(),
+                                    mesh.fillDrawStyles.end());
+    geometry_.hatchDrawStyles.insert(geometry_.hatchDrawStyles.end(),
+                                     mesh.hatchDrawStyles.begin(),
+                                     mesh.hatchDrawStyles.end());
+    geometry_.sectionMarkerLines.insert(geometry_.sectionMarkerLines.end(),
+                                        mesh.sectionMarkerLines.begin(),
+                                        mesh.sectionMarkerLines.end());
+  }
+}
+
+}  // namespace container::renderer
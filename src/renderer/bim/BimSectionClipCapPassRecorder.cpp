@@ -2,6 +2,8 @@
 
 #include "Container/renderer/bim/BimSectionCapBuilder.h"
 
+#include <span>
+
 namespace container::renderer {
 
 namespace {
@@ -91,17 +93,15 @@ hasRequiredInputs(const BimSectionClipCapPassRecordInputs &inputs) {
   }
 
   bool recorded = false;
-  std::vector<DrawCommand> commandBatch;
-  commandBatch.reserve(1u);
   for (size_t commandIndex = 0u; commandIndex < route.commands->size();
        ++commandIndex) {
     const BimSectionCapDrawStyle &style = (*route.drawStyles)[commandIndex];
     if (route.markerCommandsOnly && style.lineWidth <= 0.0f) {
       continue;
     }
-    commandBatch.clear();
-    commandBatch.push_back((*route.commands)[commandIndex]);
-    debugOverlay.drawWireframe(cmd, wireframeLayout, commandBatch,
+    debugOverlay.drawWireframe(cmd, wireframeLayout,
+                               std::span(route.commands->data() + commandIndex,
+                                         1u),
                                routeStyleColor(route, style),
                                routeStyleOpacity(route, style),
                                routeStyleLineWidth(route, style), pc);
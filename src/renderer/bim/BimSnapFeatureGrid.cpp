@@ -0,0 +1,501 @@
+#include "Container/renderer/bim/BimSnapFeatureGrid.h"
+
+#include <glm/geometric.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <tuple>
+#include <unordered_set>
+
+namespace container::renderer {
+namespace {
+
+// Adjacent triangles whose normals differ by less than about one degree
+// belong to the same planar face.
+constexpr float kCoplanarCosine = 0.99985f;
+// Corners closer than this fraction of the element's bounds diagonal weld.
+constexpr float kWeldRelativeTolerance = 1.0e-6f;
+constexpr float kMinWeldTolerance = 1.0e-7f;
+constexpr float kTargetFeaturesPerCell = 4.0f;
+// Keeps cell coordinates within the 21 bits per axis of a cell key.
+constexpr float kMaxCellsPerAxis = 1024.0f;
+constexpr float kProjectionEpsilon = 1.0e-6f;
+// Cell reach tests pad the cell and the pixel radius so features on a cell
+// face are not lost to rounding.
+constexpr float kCellPadding = 1.0e-4f;
+constexpr float kCellReachSlackPixels = 0.5f;
+constexpr int32_t kCellsPerBlock = 16;
+constexpr std::array<glm::ivec3, 6> kFaceSteps{
+    glm::ivec3{1, 0, 0},  glm::ivec3{-1, 0, 0}, glm::ivec3{0, 1, 0},
+    glm::ivec3{0, -1, 0}, glm::ivec3{0, 0, 1},  glm::ivec3{0, 0, -1}};
+
+[[nodiscard]] bool IsFinite(glm::vec3 value) {
+  return std::isfinite(value.x) && std::isfinite(value.y) &&
+         std::isfinite(value.z);
+}
+
+[[nodiscard]] std::optional<glm::vec2>
+ProjectToPixels(const BimSnapFeatureQuery &query, glm::vec3 position) {
+  const glm::vec4 clip = query.viewProj * glm::vec4(position, 1.0f);
+  if (!(clip.w > kProjectionEpsilon)) {
+    return std::nullopt;
+  }
+  const glm::vec2 ndc{clip.x / clip.w, clip.y / clip.w};
+  return (ndc * 0.5f + 0.5f) * query.viewportSize;
+}
+
+// Whether any point of the cube [low, low + size] in front of the camera can
+// project within `reach` pixels of `hitPixel`. The box is clipped at the
+// camera plane and the projection of what is left bounded by a rectangle,
+// so the answer errs towards true.
+[[nodiscard]] bool BoxInScreenReach(const BimSnapFeatureQuery &query,
+                                    glm::vec3 low, float size,
+                                    glm::vec2 hitPixel, float reach) {
+  // Clip coordinates are affine in position, so the corners follow from
+  // one transform and the matrix columns.
+  std::array<glm::vec4, 8> clip{};
+  clip[0] = query.viewProj * glm::vec4(low, 1.0f);
+  for (uint32_t axis = 0; axis < 3u; ++axis) {
+    const uint32_t bit = 1u << axis;
+    const glm::vec4 step = query.viewProj[axis] * size;
+    for (uint32_t corner = 0; corner < bit; ++corner) {
+      clip[corner | bit] = clip[corner] + step;
+    }
+  }
+
+  glm::vec2 boundsMin{std::numeric_limits<float>::max()};
+  glm::vec2 boundsMax{std::numeric_limits<float>::lowest()};
+  bool unbounded = false;
+  auto include = [&](glm::vec4 point) {
+    if (!(point.w > 0.0f)) {
+      unbounded = true;
+      return;
+    }
+    const glm::vec2 ndc{point.x / point.w, point.y / point.w};
+    const glm::vec2 pixel = (ndc * 0.5f + 0.5f) * query.viewportSize;
+    boundsMin = glm::min(boundsMin, pixel);
+    boundsMax = glm::max(boundsMax, pixel);
+  };
+  bool anyInFront = false;
+  for (uint32_t corner = 0; corner < 8u; ++corner) {
+    if (clip[corner].w > kProjectionEpsilon) {
+      include(clip[corner]);
+      anyInFront = true;
+    }
+    // Box edges that cross the camera plane end where they cross it.
+    for (uint32_t axis = 1u; axis < 8u; axis <<= 1u) {
+      if ((corner & axis) != 0u) {
+        continue;
+      }
+      const float w0 = clip[corner].w;
+      const float w1 = clip[corner | axis].w;
+      if ((w0 > kProjectionEpsilon) == (w1 > kProjectionEpsilon)) {
+        continue;
+      }
+      const float t = (kProjectionEpsilon - w0) / (w1 - w0);
+      include(clip[corner] + (clip[corner | axis] - clip[corner]) * t);
+    }
+  }
+  if (!anyInFront) {
+    return false;
+  }
+  if (unbounded || !IsFinite(glm::vec3(boundsMin, 0.0f)) ||
+      !IsFinite(glm::vec3(boundsMax, 0.0f))) {
+    return true;
+  }
+  const glm::vec2 nearest = glm::clamp(hitPixel, boundsMin, boundsMax);
+  return glm::length(nearest - hitPixel) <= reach;
+}
+
+struct WeldCorner {
+  std::array<int64_t, 3> key{};
+  uint32_t corner{0};
+};
+
+struct SnapEdge {
+  uint32_t a{0};
+  uint32_t b{0};
+  uint32_t triangle{0};
+};
+
+[[nodiscard]] uint32_t FindRoot(std::vector<uint32_t> &parents,
+                                uint32_t index) {
+  while (parents[index] != index) {
+    parents[index] = parents[parents[index]];
+    index = parents[index];
+  }
+  return index;
+}
+
+void Unite(std::vector<uint32_t> &parents, uint32_t a, uint32_t b) {
+  a = FindRoot(parents, a);
+  b = FindRoot(parents, b);
+  if (a != b) {
+    // The lower triangle index stays the root so a face reports the object
+    // of its first triangle.
+    parents[std::max(a, b)] = std::min(a, b);
+  }
+}
+
+} // namespace
+
+std::optional<float>
+BimSnapScreenDistancePixels(const BimSnapFeatureQuery &query,
+                            glm::vec3 position) {
+  const std::optional<glm::vec2> hit = ProjectToPixels(query, query.hitPoint);
+  const std::optional<glm::vec2> projected = ProjectToPixels(query, position);
+  if (!hit.has_value() || !projected.has_value()) {
+    return std::nullopt;
+  }
+  return glm::length(*projected - *hit);
+}
+
+BimSnapFeatureGrid::BimSnapFeatureGrid(
+    std::span<const BimSnapTriangle> triangles) {
+  glm::vec3 boundsMin{std::numeric_limits<float>::max()};
+  glm::vec3 boundsMax{std::numeric_limits<float>::lowest()};
+  std::vector<uint32_t> finiteTriangles;
+  finiteTriangles.reserve(triangles.size());
+  for (uint32_t index = 0; index < triangles.size(); ++index) {
+    const BimSnapTriangle &triangle = triangles[index];
+    if (!IsFinite(triangle.p0) || !IsFinite(triangle.p1) ||
+        !IsFinite(triangle.p2)) {
+      continue;
+    }
+    for (const glm::vec3 &p : {triangle.p0, triangle.p1, triangle.p2}) {
+      boundsMin = glm::min(boundsMin, p);
+      boundsMax = glm::max(boundsMax, p);
+    }
+    finiteTriangles.push_back(index);
+  }
+  if (finiteTriangles.empty()) {
+    return;
+  }
+
+  // Weld corners on a fine lattice so shared positions become shared ids.
+  const float weldTolerance =
+      std::max(glm::length(boundsMax - boundsMin) * kWeldRelativeTolerance,
+               kMinWeldTolerance);
+  std::vector<WeldCorner> corners;
+  corners.reserve(finiteTriangles.size() * 3u);
+  auto cornerPosition = [&](uint32_t corner) {
+    const BimSnapTriangle &triangle = triangles[finiteTriangles[corner / 3u]];
+    switch (corner % 3u) {
+    case 0u:
+      return triangle.p0;
+    case 1u:
+      return triangle.p1;
+    default:
+      return triangle.p2;
+    }
+  };
+  for (uint32_t corner = 0; corner < finiteTriangles.size() * 3u; ++corner) {
+    const glm::vec3 lattice =
+        (cornerPosition(corner) - boundsMin) / weldTolerance;
+    corners.push_back(WeldCorner{
+        .key = {std::llround(lattice.x), std::llround(lattice.y),
+                std::llround(lattice.z)},
+        .corner = corner,
+    });
+  }
+  std::ranges::sort(corners, [](const WeldCorner &a, const WeldCorner &b) {
+    return std::tie(a.key, a.corner) < std::tie(b.key, b.corner);
+  });
+
+  std::vector<uint32_t> cornerVertex(corners.size(), 0u);
+  std::vector<uint32_t> vertexFirstCorner;
+  for (size_t index = 0; index < corners.size(); ++index) {
+    if (index == 0u || corners[index].key != corners[index - 1u].key) {
+      vertexFirstCorner.push_back(corners[index].corner);
+    }
+    cornerVertex[corners[index].corner] =
+        static_cast<uint32_t>(vertexFirstCorner.size() - 1u);
+  }
+
+  // Drop triangles that collapse under the weld; they have no face or edges.
+  const uint32_t triangleCount = static_cast<uint32_t>(finiteTriangles.size());
+  std::vector<glm::vec3> normals(triangleCount, glm::vec3(0.0f));
+  std::vector<float> areas(triangleCount, 0.0f);
+  std::vector<SnapEdge> edges;
+  edges.reserve(triangleCount * 3u);
+  float totalArea = 0.0f;
+  for (uint32_t triangle = 0; triangle < triangleCount; ++triangle) {
+    const std::array<uint32_t, 3> ids{cornerVertex[triangle * 3u],
+                                      cornerVertex[triangle * 3u + 1u],
+                                      cornerVertex[triangle * 3u + 2u]};
+    if (ids[0] == ids[1] || ids[1] == ids[2] || ids[0] == ids[2]) {
+      continue;
+    }
+    const glm::vec3 p0 = cornerPosition(triangle * 3u);
+    const glm::vec3 cross = glm::cross(cornerPosition(triangle * 3u + 1u) - p0,
+                                       cornerPosition(triangle * 3u + 2u) - p0);
+    const float doubleArea = glm::length(cross);
+    if (!(doubleArea > 0.0f) || !std::isfinite(doubleArea)) {
+      continue;
+    }
+    normals[triangle] = cross / doubleArea;
+    areas[triangle] = doubleArea * 0.5f;
+    totalArea += areas[triangle];
+    for (uint32_t edge = 0; edge < 3u; ++edge) {
+      const uint32_t a = ids[edge];
+      const uint32_t b = ids[(edge + 1u) % 3u];
+      edges.push_back(SnapEdge{.a = std::min(a, b),
+                               .b = std::max(a, b),
+                               .triangle = triangle});
+    }
+  }
+  std::ranges::sort(edges, [](const SnapEdge &lhs, const SnapEdge &rhs) {
+    return std::tie(lhs.a, lhs.b, lhs.triangle) <
+           std::tie(rhs.a, rhs.b, rhs.triangle);
+  });
+
+  std::vector<BimSnapFeature> features;
+  std::vector<bool> vertexUsed(vertexFirstCorner.size(), false);
+  for (const SnapEdge &edge : edges) {
+    vertexUsed[edge.a] = true;
+    vertexUsed[edge.b] = true;
+  }
+  for (uint32_t vertex = 0; vertex < vertexFirstCorner.size(); ++vertex) {
+    if (!vertexUsed[vertex]) {
+      continue;
+    }
+    const uint32_t corner = vertexFirstCorner[vertex];
+    features.push_back(BimSnapFeature{
+        .kind = BimSnapKind::Vertex,
+        .objectIndex = triangles[finiteTriangles[corner / 3u]].objectIndex,
+        .position = cornerPosition(corner),
+    });
+  }
+
+  // An edge shared by exactly two coplanar triangles is internal to a face;
+  // every other edge is one a user would see and snap to.
+  std::vector<uint32_t> faceParents(triangleCount);
+  std::iota(faceParents.begin(), faceParents.end(), 0u);
+  for (size_t first = 0; first < edges.size();) {
+    size_t last = first + 1u;
+    while (last < edges.size() && edges[last].a == edges[first].a &&
+           edges[last].b == edges[first].b) {
+      ++last;
+    }
+    const uint32_t t0 = edges[first].triangle;
+    if (last - first == 2u &&
+        glm::dot(normals[t0], normals[edges[first + 1u].triangle]) >=
+            kCoplanarCosine) {
+      Unite(faceParents, t0, edges[first + 1u].triangle);
+    } else {
+      const glm::vec3 a = cornerPosition(vertexFirstCorner[edges[first].a]);
+      const glm::vec3 b = cornerPosition(vertexFirstCorner[edges[first].b]);
+      features.push_back(BimSnapFeature{
+          .kind = BimSnapKind::EdgeMidpoint,
+          .objectIndex = triangles[finiteTriangles[t0]].objectIndex,
+          .position = (a + b) * 0.5f,
+      });
+    }
+    first = last;
+  }
+
+  std::vector<glm::vec3> faceWeightedCentroids(triangleCount, glm::vec3(0.0f));
+  std::vector<float> faceAreas(triangleCount, 0.0f);
+  for (uint32_t triangle = 0; triangle < triangleCount; ++triangle) {
+    if (areas[triangle] <= 0.0f) {
+      continue;
+    }
+    const uint32_t root = FindRoot(faceParents, triangle);
+    const glm::vec3 centroid = (cornerPosition(triangle * 3u) +
+                                cornerPosition(triangle * 3u + 1u) +
+                                cornerPosition(triangle * 3u + 2u)) /
+                               3.0f;
+    faceWeightedCentroids[root] += centroid * areas[triangle];
+    faceAreas[root] += areas[triangle];
+  }
+  for (uint32_t root = 0; root < triangleCount; ++root) {
+    if (faceAreas[root] <= 0.0f) {
+      continue;
+    }
+    features.push_back(BimSnapFeature{
+        .kind = BimSnapKind::FaceCenter,
+        .objectIndex = triangles[finiteTriangles[root]].objectIndex,
+        .position = faceWeightedCentroids[root] / faceAreas[root],
+    });
+  }
+  if (features.empty()) {
+    return;
+  }
+
+  // Size cells so a cell holds a handful of features on average; features
+  // lie on surfaces, so area rather than volume sets the density.
+  const glm::vec3 extent = boundsMax - boundsMin;
+  const float largestExtent = std::max({extent.x, extent.y, extent.z});
+  float cellSize = std::sqrt(kTargetFeaturesPerCell * totalArea /
+                             static_cast<float>(features.size()));
+  cellSize = std::max({cellSize, largestExtent / kMaxCellsPerAxis,
+                       weldTolerance});
+  if (!std::isfinite(cellSize) || cellSize <= 0.0f) {
+    cellSize = 1.0f;
+  }
+  origin_ = boundsMin;
+  cellSize_ = cellSize;
+  const glm::vec3 maxCell = glm::floor(extent / cellSize);
+  maxCell_ = glm::ivec3(static_cast<int32_t>(maxCell.x),
+                        static_cast<int32_t>(maxCell.y),
+                        static_cast<int32_t>(maxCell.z));
+  maxBlock_ = blockCoordinate(maxCell_);
+
+  std::vector<std::tuple<uint64_t, uint64_t, uint32_t>> keyed;
+  keyed.reserve(features.size());
+  for (uint32_t index = 0; index < features.size(); ++index) {
+    const glm::ivec3 cell = cellCoordinate(features[index].position);
+    keyed.emplace_back(cellKey(blockCoordinate(cell)), cellKey(cell), index);
+  }
+  std::ranges::sort(keyed);
+  features_.reserve(features.size());
+  for (size_t sorted = 0; sorted < keyed.size(); ++sorted) {
+    const auto [block, cell, index] = keyed[sorted];
+    if (sorted == 0u || cell != std::get<1>(keyed[sorted - 1u])) {
+      cells_.push_back(OccupiedCell{
+          .cell = cellCoordinate(features[index].position),
+          .features = {.first = static_cast<uint32_t>(features_.size())}});
+      auto [blockRange, inserted] = blocks_.try_emplace(
+          block,
+          CellRange{.first = static_cast<uint32_t>(cells_.size() - 1u)});
+      ++blockRange->second.count;
+    }
+    ++cells_.back().features.count;
+    features_.push_back(features[index]);
+  }
+}
+
+glm::ivec3 BimSnapFeatureGrid::cellCoordinate(glm::vec3 position) const {
+  // Clamp in float space first so far-away points cannot overflow the cast.
+  const glm::vec3 cell = glm::floor((position - origin_) / cellSize_);
+  auto axis = [](float value, int32_t maxValue) {
+    return static_cast<int32_t>(
+        std::clamp(value, -1.0f, static_cast<float>(maxValue) + 1.0f));
+  };
+  return {axis(cell.x, maxCell_.x), axis(cell.y, maxCell_.y),
+          axis(cell.z, maxCell_.z)};
+}
+
+glm::ivec3 BimSnapFeatureGrid::blockCoordinate(glm::ivec3 cell) {
+  return {cell.x / kCellsPerBlock, cell.y / kCellsPerBlock,
+          cell.z / kCellsPerBlock};
+}
+
+uint64_t BimSnapFeatureGrid::cellKey(glm::ivec3 cell) {
+  return (static_cast<uint64_t>(cell.x) << 42u) |
+         (static_cast<uint64_t>(cell.y) << 21u) |
+         static_cast<uint64_t>(cell.z);
+}
+
+BimSnapFeatureQueryStats
+BimSnapFeatureGrid::query(const BimSnapFeatureQuery &query,
+                          std::vector<BimSnapCandidate> &out) const {
+  BimSnapFeatureQueryStats stats{};
+  if (features_.empty() || !(query.viewportSize.x > 0.0f) ||
+      !(query.viewportSize.y > 0.0f) ||
+      !(query.maxScreenDistancePixels > 0.0f) ||
+      !std::isfinite(query.maxScreenDistancePixels) ||
+      !IsFinite(query.hitPoint)) {
+    return stats;
+  }
+  const std::optional<glm::vec2> hitPixel =
+      ProjectToPixels(query, query.hitPoint);
+  if (!hitPixel.has_value()) {
+    return stats;
+  }
+
+  const size_t firstCandidate = out.size();
+  auto visit = [&](const BimSnapFeature &feature) {
+    ++stats.visitedFeatures;
+    const std::optional<glm::vec2> projected =
+        ProjectToPixels(query, feature.position);
+    if (!projected.has_value()) {
+      return;
+    }
+    const float screenDistance = glm::length(*projected - *hitPixel);
+    if (screenDistance > query.maxScreenDistancePixels) {
+      return;
+    }
+    out.push_back(BimSnapCandidate{.kind = feature.kind,
+                                   .objectIndex = feature.objectIndex,
+                                   .worldPosition = feature.position,
+                                   .screenDistancePixels = screenDistance});
+  };
+  const float reach = query.maxScreenDistancePixels + kCellReachSlackPixels;
+  const float padding = cellSize_ * kCellPadding;
+  auto inReach = [&](glm::ivec3 firstCell, int32_t cellsPerAxis) {
+    const glm::vec3 low = origin_ + glm::vec3(firstCell) * cellSize_ - padding;
+    const float size = cellSize_ * static_cast<float>(cellsPerAxis);
+    return BoxInScreenReach(query, low, size + 2.0f * padding, *hitPixel,
+                            reach);
+  };
+  auto blockInReach = [&](glm::ivec3 block) {
+    return inReach(block * kCellsPerBlock, kCellsPerBlock);
+  };
+
+  // The points that project within the radius form a cone from the eye
+  // through the hit point. It is convex, so the closed blocks it touches
+  // share faces: flood them from the hit point's block, then test the
+  // occupied cells of each. Once more blocks have been tested than are
+  // occupied, or when the flood cannot start, scanning the features
+  // directly is cheaper.
+  const glm::ivec3 start = blockCoordinate(
+      glm::clamp(cellCoordinate(query.hitPoint), glm::ivec3(0), maxCell_));
+  bool scanAll = !blockInReach(start);
+  std::vector<glm::ivec3> pending;
+  std::unordered_set<uint64_t> tested;
+  if (!scanAll) {
+    pending.push_back(start);
+    tested.insert(cellKey(start));
+  }
+  while (!pending.empty() && !scanAll) {
+    const glm::ivec3 block = pending.back();
+    pending.pop_back();
+    if (const auto occupied = blocks_.find(cellKey(block));
+        occupied != blocks_.end()) {
+      const CellRange cells = occupied->second;
+      for (uint32_t cell = cells.first; cell < cells.first + cells.count;
+           ++cell) {
+        if (!inReach(cells_[cell].cell, 1)) {
+          continue;
+        }
+        ++stats.visitedCells;
+        const CellRange range = cells_[cell].features;
+        for (uint32_t index = range.first; index < range.first + range.count;
+             ++index) {
+          visit(features_[index]);
+        }
+      }
+    }
+    for (const glm::ivec3 step : kFaceSteps) {
+      const glm::ivec3 next = block + step;
+      if (next.x < 0 || next.y < 0 || next.z < 0 || next.x > maxBlock_.x ||
+          next.y > maxBlock_.y || next.z > maxBlock_.z ||
+          !tested.insert(cellKey(next)).second) {
+        continue;
+      }
+      if (tested.size() > blocks_.size()) {
+        scanAll = true;
+        break;
+      }
+      if (blockInReach(next)) {
+        pending.push_back(next);
+      }
+    }
+  }
+  if (!scanAll) {
+    return stats;
+  }
+
+  out.resize(firstCandidate);
+  stats = BimSnapFeatureQueryStats{
+      .visitedCells = static_cast<uint32_t>(cells_.size())};
+  for (const BimSnapFeature &feature : features_) {
+    visit(feature);
+  }
+  return stats;
+}
+
+} // namespace container::renderer
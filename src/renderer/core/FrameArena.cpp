@@ -0,0 +1,135 @@
+#include "Container/renderer/core/FrameArena.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace container::renderer {
+
+namespace {
+
+constexpr size_t kBlockAlignment = alignof(std::max_align_t);
+
+// Offset of the first `alignment`-aligned address at or after data + used.
+[[nodiscard]] size_t alignedOffset(const std::byte *data, size_t used,
+                                   size_t alignment) {
+  const auto address = reinterpret_cast<uintptr_t>(data) + used;
+  const uintptr_t aligned = (address + alignment - 1u) & ~(alignment - 1u);
+  return used + static_cast<size_t>(aligned - address);
+}
+
+} // namespace
+
+FrameArena::FrameArena(size_t initialCapacity, bool poisonOnReset,
+                       std::pmr::memory_resource *upstream)
+    : upstream_(upstream != nullptr ? upstream
+                                    : std::pmr::new_delete_resource()),
+      poisonOnReset_(poisonOnReset) {
+  // Room for a few overflow blocks so an overflowing frame does not also
+  // grow the block list.
+  blocks_.reserve(8u);
+  if (initialCapacity > 0u) {
+    blocks_.push_back(allocateBlock(initialCapacity));
+  }
+}
+
+FrameArena::~FrameArena() { releaseBlocks(); }
+
+void FrameArena::reset() {
+  const size_t used = usedBytes();
+  highWaterBytes_ = std::max(highWaterBytes_, used);
+  if (poisonOnReset_) {
+    for (const Block &block : blocks_) {
+      std::memset(block.data, kPoisonByte, block.used);
+    }
+  }
+
+  if (blocks_.size() > 1u) {
+    // The frame overflowed: replace the chain with one block that holds the
+    // whole chain's capacity so the next frame of this size fits in place.
+    size_t capacity = 0u;
+    for (const Block &block : blocks_) {
+      capacity += block.size;
+    }
+    releaseBlocks();
+    blocks_.push_back(allocateBlock(capacity));
+  } else if (!blocks_.empty()) {
+    blocks_.front().used = 0u;
+  }
+
+  bytesAllocated_ = 0u;
+  allocationCount_ = 0u;
+  ++resetCount_;
+}
+
+FrameArenaStats FrameArena::stats() const {
+  FrameArenaStats stats{};
+  stats.bytesAllocated = bytesAllocated_;
+  stats.allocationCount = allocationCount_;
+  for (const Block &block : blocks_) {
+    stats.capacityBytes += block.size;
+  }
+  stats.highWaterBytes = std::max(highWaterBytes_, usedBytes());
+  stats.upstreamAllocationCount = upstreamAllocationCount_;
+  stats.resetCount = resetCount_;
+  return stats;
+}
+
+void *FrameArena::do_allocate(size_t bytes, size_t alignment) {
+  alignment = std::max<size_t>(alignment, 1u);
+  if (!blocks_.empty()) {
+    Block &block = blocks_.back();
+    const size_t offset = alignedOffset(block.data, block.used, alignment);
+    if (offset <= block.size && bytes <= block.size - offset) {
+      block.used = offset + bytes;
+      bytesAllocated_ += bytes;
+      ++allocationCount_;
+      return block.data + offset;
+    }
+  }
+
+  // Blocks are max_align_t aligned, so over-aligned requests may need up to
+  // alignment - 1 bytes of padding at the front.
+  const size_t previousSize = blocks_.empty() ? 0u : blocks_.back().size;
+  const size_t required =
+      bytes + (alignment > kBlockAlignment ? alignment : 0u);
+  blocks_.push_back(allocateBlock(
+      std::max({previousSize * 2u, required, kDefaultInitialCapacity})));
+
+  Block &block = blocks_.back();
+  const size_t offset = alignedOffset(block.data, 0u, alignment);
+  block.used = offset + bytes;
+  bytesAllocated_ += bytes;
+  ++allocationCount_;
+  return block.data + offset;
+}
+
+bool FrameArena::do_is_equal(
+    const std::pmr::memory_resource &other) const noexcept {
+  return this == &other;
+}
+
+FrameArena::Block FrameArena::allocateBlock(size_t size) {
+  ++upstreamAllocationCount_;
+  return {.data = static_cast<std::byte *>(
+              upstream_->allocate(size, kBlockAlignment)),
+          .size = size,
+          .used = 0u};
+}
+
+void FrameArena::releaseBlocks() {
+  for (const Block &block : blocks_) {
+    upstream_->deallocate(block.data, block.size, kBlockAlignment);
+  }
+  blocks_.clear();
+}
+
+size_t FrameArena::usedBytes() const {
+  size_t used = 0u;
+  for (const Block &block : blocks_) {
+    used += block.used;
+  }
+  return used;
+}
+
+} // namespace container::renderer
@@ -21,11 +21,13 @@
 #include "Container/app/AppConfig.h"
 #include "Container/ecs/World.h"
 #include "Container/renderer/bim/BimDrawingExport.h"
+#include "Container/renderer/bim/BimElementMetadataStore.h"
 #include "Container/renderer/bim/BimFrameDrawRoutingPlanner.h"
 #include "Container/renderer/bim/BimGeoreferenceTransform.h"
 #include "Container/renderer/bim/BimManager.h"
 #include "Container/renderer/bim/BimModelCompare.h"
 #include "Container/renderer/bim/BimScheduleExtractor.h"
+#include "Container/renderer/core/FrameArena.h"
 #include "Container/renderer/core/FrameConcurrencyPolicy.h"
 #include "Container/renderer/core/FrameRecorder.h"
 #include "Container/renderer/core/RenderExtraction.h"
@@ -33,6 +35,7 @@
 #include "Container/renderer/core/RenderTechnique.h"
 #include "Container/renderer/core/RendererMsaa.h"
 #include "Container/renderer/core/RendererTelemetry.h"
+#include "Container/renderer/core/RendererTelemetryTrace.h"
 #include "Container/renderer/culling/GpuCullManager.h"
 #include "Container/renderer/debug/DebugUiPresenter.h"
 #include "Container/renderer/deferred/DeferredLightGizmoPlanner.h"
@@ -109,41 +112,35 @@ bimModelCompareBounds(const BimElementBounds &bounds) {
 }
 
 [[nodiscard]] std::vector<BimScheduleElement> buildBimScheduleElements(
-    std::span<const BimElementMetadata> metadata) {
+    const BimElementMetadataStore &metadata) {
   std::vector<BimScheduleElement> elements;
   elements.reserve(metadata.size());
-  for (const BimElementMetadata &element : metadata) {
-    elements.push_back({.guid = element.guid,
-                        .sourceId = element.sourceId,
-                        .ifcClass = element.type,
-                        .type = element.objectType,
-                        .storey = !element.storeyName.empty()
-                                      ? element.storeyName
-                                      : element.storeyId,
-                        .material = !element.materialName.empty()
-                                        ? element.materialName
-                                        : element.materialCategory,
-                        .bounds = bimScheduleBounds(element.bounds)});
+  for (const BimElementMetadataView element : metadata) {
+    elements.push_back({.guid = std::string(element.guid()),
+                        .sourceId = std::string(element.sourceId()),
+                        .ifcClass = std::string(element.type()),
+                        .type = std::string(element.objectType()),
+                        .storey = std::string(bimMetadataStoreyLabel(element)),
+                        .material =
+                            std::string(bimMetadataMaterialLabel(element)),
+                        .bounds = bimScheduleBounds(element.bounds())});
   }
   return elements;
 }
 
 [[nodiscard]] std::vector<BimModelCompareElement> buildBimModelCompareElements(
-    std::span<const BimElementMetadata> metadata) {
+    const BimElementMetadataStore &metadata) {
   std::vector<BimModelCompareElement> elements;
   elements.reserve(metadata.size());
-  for (const BimElementMetadata &element : metadata) {
-    elements.push_back({.guid = element.guid,
-                        .sourceId = element.sourceId,
-                        .ifcClass = element.type,
-                        .type = element.objectType,
-                        .storey = !element.storeyName.empty()
-                                      ? element.storeyName
-                                      : element.storeyId,
-                        .material = !element.materialName.empty()
-                                        ? element.materialName
-                                        : element.materialCategory,
-                        .bounds = bimModelCompareBounds(element.bounds)});
+  for (const BimElementMetadataView element : metadata) {
+    elements.push_back({.guid = std::string(element.guid()),
+                        .sourceId = std::string(element.sourceId()),
+                        .ifcClass = std::string(element.type()),
+                        .type = std::string(element.objectType()),
+                        .storey = std::string(bimMetadataStoreyLabel(element)),
+                        .material =
+                            std::string(bimMetadataMaterialLabel(element)),
+                        .bounds = bimModelCompareBounds(element.bounds())});
   }
   return elements;
 }
@@ -852,14 +849,14 @@ bool displayModeRecordsGtao(container::ui::GBufferViewMode mode) {
          mode == container::ui::GBufferViewMode::Overview;
 }
 
-std::string bimSelectionLabel(const BimElementMetadata &metadata) {
+std::string bimSelectionLabel(BimElementMetadataView metadata) {
   std::string label =
-      "Selected BIM object " + std::to_string(metadata.objectIndex);
-  if (!metadata.type.empty() && metadata.type != "Unknown") {
-    label += " (" + metadata.type + ")";
+      "Selected BIM object " + std::to_string(metadata.objectIndex());
+  if (!metadata.type().empty() && metadata.type() != "Unknown") {
+    label += " (" + std::string(metadata.type()) + ")";
   }
-  if (!metadata.guid.empty()) {
-    label += " [" + metadata.guid + "]";
+  if (!metadata.guid().empty()) {
+    label += " [" + std::string(metadata.guid()) + "]";
   }
   return label;
 }
@@ -1070,22 +1067,23 @@ container::scene::SceneProviderBounds sceneProviderBoundsFromModelBounds(
 container::scene::SceneProviderBounds
 sceneProviderBoundsFromBim(const BimManager &bimManager) {
   container::scene::SceneProviderBounds bounds{};
-  for (const BimElementMetadata &metadata : bimManager.elementMetadata()) {
-    if (!metadata.bounds.valid) {
+  for (const BimElementMetadataView metadata : bimManager.elementMetadata()) {
+    const BimElementBounds &elementBounds = metadata.bounds();
+    if (!elementBounds.valid) {
       continue;
     }
     if (!bounds.valid) {
-      bounds.min = metadata.bounds.min;
-      bounds.max = metadata.bounds.max;
+      bounds.min = elementBounds.min;
+      bounds.max = elementBounds.max;
       bounds.valid = true;
       continue;
     }
-    bounds.min.x = std::min(bounds.min.x, metadata.bounds.min.x);
-    bounds.min.y = std::min(bounds.min.y, metadata.bounds.min.y);
-    bounds.min.z = std::min(bounds.min.z, metadata.bounds.min.z);
-    bounds.max.x = std::max(bounds.max.x, metadata.bounds.max.x);
-    bounds.max.y = std::max(bounds.max.y, metadata.bounds.max.y);
-    bounds.max.z = std::max(bounds.max.z, metadata.bounds.max.z);
+    bounds.min.x = std::min(bounds.min.x, elementBounds.min.x);
+    bounds.min.y = std::min(bounds.min.y, elementBounds.min.y);
+    bounds.min.z = std::min(bounds.min.z, elementBounds.min.z);
+    bounds.max.x = std::max(bounds.max.x, elementBounds.max.x);
+    bounds.max.y = std::max(bounds.max.y, elementBounds.max.y);
+    bounds.max.z = std::max(bounds.max.z, elementBounds.max.z);
   }
   return bounds;
 }
@@ -1335,6 +1333,10 @@ void RendererFrontend::initialize() {
       static_cast<uint32_t>(svc_.swapChainManager.imageCount()));
   frame_.imagesInFlight.assign(svc_.swapChainManager.imageCount(),
                                VK_NULL_HANDLE);
+  frame_.arenas.clear();
+  for (uint32_t i = 0; i < svc_.config.maxFramesInFlight; ++i) {
+    frame_.arenas.push_back(std::make_unique<FrameArena>());
+  }
   subs_.renderPassGpuProfiler = std::make_unique<RenderPassGpuProfiler>();
   subs_.renderPassGpuProfiler->initialize(
       svc_.ctx.deviceWrapper->device(), svc_.ctx.instance,
@@ -1365,6 +1367,11 @@ bool RendererFrontend::drawFrame(bool &framebufferResized) {
   auto phaseStart = TelemetryClock::now();
   concurrencyPolicy.waitBeforeAcquire(*subs_.frameSyncManager,
                                       frame_.currentFrame);
+  // The frame that last used this slot has retired, so nothing recorded from
+  // its arena is still referenced.
+  if (frame_.currentFrame < frame_.arenas.size()) {
+    frame_.arenas[frame_.currentFrame]->reset();
+  }
   if (telemetry) {
     telemetry->setCpuPhase(RendererTelemetryPhase::WaitForFrame,
                            elapsedMilliseconds(phaseStart));
@@ -1372,13 +1379,14 @@ bool RendererFrontend::drawFrame(bool &framebufferResized) {
       const auto gpuTimings = subs_.renderPassGpuProfiler->collectLatest();
       telemetry->setPassGpuTimings(gpuTimings,
                                    subs_.renderPassGpuProfiler->timingSource());
-      telemetry->setGpuProfilerStatus(RendererGpuProfilerTelemetry{
-          .source = subs_.renderPassGpuProfiler->timingSource(),
-          .available = subs_.renderPassGpuProfiler->isReady(),
-          .resultLatencyFrames =
-              subs_.renderPassGpuProfiler->resultLatencyFrames(),
-          .status = std::string(subs_.renderPassGpuProfiler->backendStatus()),
-      });
+      telemetry->setGpuProfilerStatus(
+          RendererGpuProfilerTelemetry{
+              .source = subs_.renderPassGpuProfiler->timingSource(),
+              .available = subs_.renderPassGpuProfiler->isReady(),
+              .resultLatencyFrames =
+                  subs_.renderPassGpuProfiler->resultLatencyFrames(),
+          },
+          subs_.renderPassGpuProfiler->backendStatus());
     }
   }
 
@@ -1682,6 +1690,9 @@ void RendererFrontend::handleResize() {
         static_cast<uint32_t>(svc_.swapChainManager.imageCount()));
   }
   createFrameResources();
+  if (subs_.gpuCullManager) {
+    subs_.gpuCullManager->invalidateHiZDepthSources();
+  }
   if (subs_.environmentManager) {
     const VkExtent2D ext = svc_.swapChainManager.extent();
     subs_.environmentManager->recreateGtaoTextures(ext.width, ext.height);
@@ -1848,9 +1859,9 @@ void RendererFrontend::selectMeshNodeAtCursor(double cursorX, double cursorY) {
     if (subs_.guiManager) {
       subs_.guiManager->setSectionPlaneVisualEditable(false);
       if (subs_.bimManager) {
-        if (const auto *metadata =
+        if (const BimElementMetadataView metadata =
                 subs_.bimManager->metadataForObject(objectIndex)) {
-          subs_.guiManager->setStatusMessage(bimSelectionLabel(*metadata));
+          subs_.guiManager->setStatusMessage(bimSelectionLabel(metadata));
           return;
         }
       }
@@ -2094,11 +2105,28 @@ void RendererFrontend::hoverMeshNodeAtCursor(double cursorX, double cursorY) {
 
   uint32_t hoveredNode = container::scene::SceneGraph::kInvalidNode;
   uint32_t hoveredBimObject = std::numeric_limits<uint32_t>::max();
+  const bool trackBimSnapCursor =
+      subs_.guiManager && subs_.bimManager &&
+      container::ui::BimMeasurementSnapModeUsesGeometry(
+          subs_.guiManager->bimMeasurementSnapState().mode);
+  bimSnapCursorHit_ = {};
 
   uint32_t gpuPickId = container::gpu::kPickIdNone;
   const bool hasGpuPick = samplePickIdAtCursor(cursorX, cursorY, gpuPickId);
   if (hasGpuPick) {
     const GpuPickTarget target = decodeGpuPickId(gpuPickId);
+    float pickDepth = 0.0f;
+    if (trackBimSnapCursor && target.kind == GpuPickTargetKind::Bim &&
+        (samplePickDepthAtCursor(cursorX, cursorY, pickDepth) ||
+         sampleDepthAtCursor(cursorX, cursorY, pickDepth))) {
+      if (const std::optional<glm::vec3> point = unprojectDepthAtCursor(
+              depthVisibility_.cameraData, depthVisibility_.extent, cursorX,
+              cursorY, pickDepth)) {
+        bimSnapCursorHit_ = {.valid = true,
+                             .objectIndex = target.objectIndex,
+                             .point = *point};
+      }
+    }
     if (target.kind == GpuPickTargetKind::Bim && subs_.bimManager &&
         target.objectIndex < subs_.bimManager->objectData().size() &&
         subs_.bimManager->objectMatchesFilter(target.objectIndex, bimFilter) &&
@@ -2127,6 +2155,11 @@ void RendererFrontend::hoverMeshNodeAtCursor(double cursorX, double cursorY) {
     }
 
     if (bimHit.hit && (!sceneHit.hit || bimHit.distance < sceneHit.distance)) {
+      if (trackBimSnapCursor && bimHit.hasWorldPosition) {
+        bimSnapCursorHit_ = {.valid = true,
+                             .objectIndex = bimHit.objectIndex,
+                             .point = bimHit.worldPosition};
+      }
       hoveredBimObject = bimHit.objectIndex;
     } else if (sceneHit.hit) {
       hoveredNode = sceneHit.nodeIndex;
@@ -2139,12 +2172,12 @@ void RendererFrontend::hoverMeshNodeAtCursor(double cursorX, double cursorY) {
   if (hoveredBimObject != std::numeric_limits<uint32_t>::max() &&
       selectedBimObjectIndex_ != std::numeric_limits<uint32_t>::max() &&
       subs_.bimManager) {
-    const auto *selectedMetadata =
+    const BimElementMetadataView selectedMetadata =
         subs_.bimManager->metadataForObject(selectedBimObjectIndex_);
-    const auto *hoveredMetadata =
+    const BimElementMetadataView hoveredMetadata =
         subs_.bimManager->metadataForObject(hoveredBimObject);
-    if (selectedMetadata != nullptr && hoveredMetadata != nullptr &&
-        sameBimProductIdentity(*selectedMetadata, *hoveredMetadata)) {
+    if (selectedMetadata && hoveredMetadata &&
+        sameBimProductIdentity(selectedMetadata, hoveredMetadata)) {
       hoveredBimObject = std::numeric_limits<uint32_t>::max();
     }
   }
@@ -2163,6 +2196,7 @@ void RendererFrontend::hoverMeshNodeAtCursor(double cursorX, double cursorY) {
 
 void RendererFrontend::clearHoveredMeshNode() {
   hoverPickCache_.valid = false;
+  bimSnapCursorHit_ = {};
   if (hoveredMeshNode_ == container::scene::SceneGraph::kInvalidNode &&
       hoveredBimObjectIndex_ == std::numeric_limits<uint32_t>::max()) {
     return;
@@ -2762,6 +2796,29 @@ void RendererFrontend::requestScreenshot(std::filesystem::path outputPath) {
   screenshot_.pending = true;
 }
 
+void RendererFrontend::exportTelemetryTrace(
+    const std::filesystem::path &outputPath) const {
+  if (outputPath.empty()) {
+    throw std::runtime_error("telemetry trace output path is empty");
+  }
+  if (!subs_.rendererTelemetry) {
+    throw std::runtime_error("renderer telemetry is not initialized");
+  }
+
+  const std::string trace = exportRendererChromeTrace(
+      subs_.rendererTelemetry->capturedFrames(
+          0, std::numeric_limits<uint64_t>::max()));
+  if (outputPath.has_parent_path()) {
+    std::filesystem::create_directories(outputPath.parent_path());
+  }
+  std::ofstream output(outputPath, std::ios::binary);
+  output << trace;
+  if (!output) {
+    throw std::runtime_error("failed to write telemetry trace: " +
+                             container::util::pathToUtf8(outputPath));
+  }
+}
+
 bool RendererFrontend::reloadSceneModel(const std::string &path,
                                         float importScale) {
   if (!subs_.sceneController || !subs_.sceneManager)
@@ -3813,16 +3870,16 @@ bool RendererFrontend::bimObjectVisibleByLayer(uint32_t objectIndex) const {
   if (!subs_.bimManager) {
     return false;
   }
-  const BimElementMetadata *metadata =
+  const BimElementMetadataView metadata =
       subs_.bimManager->metadataForObject(objectIndex);
-  if (metadata == nullptr) {
+  if (!metadata) {
     return false;
   }
   if (!subs_.guiManager) {
     return true;
   }
   const auto &layerState = subs_.guiManager->bimLayerVisibilityState();
-  switch (metadata->geometryKind) {
+  switch (metadata.geometryKind()) {
   case BimGeometryKind::Points:
     return layerState.pointCloudVisible;
   case BimGeometryKind::Curves:
@@ -3847,12 +3904,12 @@ RendererFrontend::currentViewpointSnapshot() const {
   }
   if (subs_.bimManager && subs_.bimManager->hasScene()) {
     snapshot.bimModelPath = subs_.bimManager->modelPath();
-    if (const auto *metadata =
+    if (const BimElementMetadataView metadata =
             subs_.bimManager->metadataForObject(selectedBimObjectIndex_)) {
-      snapshot.selectedBimObjectIndex = metadata->objectIndex;
-      snapshot.selectedBimGuid = metadata->guid;
-      snapshot.selectedBimType = metadata->type;
-      snapshot.selectedBimSourceId = metadata->sourceId;
+      snapshot.selectedBimObjectIndex = metadata.objectIndex();
+      snapshot.selectedBimGuid = metadata.guid();
+      snapshot.selectedBimType = metadata.type();
+      snapshot.selectedBimSourceId = metadata.sourceId();
     }
   }
   return snapshot;
@@ -3908,11 +3965,10 @@ bool RendererFrontend::restoreViewpointSnapshot(
         return snapshot.selectedBimObjectIndex;
       }
       for (uint32_t objectIndex : objectIndices) {
-        const BimElementMetadata *metadata =
+        const BimElementMetadataView metadata =
             subs_.bimManager->metadataForObject(objectIndex);
         if (snapshot.selectedBimType.empty() ||
-            (metadata != nullptr &&
-             metadata->type == snapshot.selectedBimType)) {
+            (metadata && metadata.type() == snapshot.selectedBimType)) {
           return objectIndex;
         }
       }
@@ -3934,18 +3990,17 @@ bool RendererFrontend::restoreViewpointSnapshot(
     if (sameBimScene && restoredBimObjectIndex == invalidObjectIndex &&
         snapshot.selectedBimObjectIndex <
             subs_.bimManager->objectData().size()) {
-      const auto *metadata =
+      const BimElementMetadataView metadata =
           subs_.bimManager->metadataForObject(snapshot.selectedBimObjectIndex);
       const bool guidCompatible =
           snapshot.selectedBimGuid.empty() ||
-          (metadata != nullptr && metadata->guid == snapshot.selectedBimGuid);
+          (metadata && metadata.guid() == snapshot.selectedBimGuid);
       const bool sourceIdCompatible =
           snapshot.selectedBimSourceId.empty() ||
-          (metadata != nullptr &&
-           metadata->sourceId == snapshot.selectedBimSourceId);
+          (metadata && metadata.sourceId() == snapshot.selectedBimSourceId);
       const bool typeCompatible =
           snapshot.selectedBimType.empty() ||
-          (metadata != nullptr && metadata->type == snapshot.selectedBimType);
+          (metadata && metadata.type() == snapshot.selectedBimType);
       if (guidCompatible && sourceIdCompatible && typeCompatible) {
         restoredBimObjectIndex = snapshot.selectedBimObjectIndex;
       }
@@ -4371,12 +4426,10 @@ void RendererFrontend::presentSceneControls() {
   const auto selectedEditableLight =
       subs_.lightingManager ? subs_.lightingManager->selectedEditableLightId()
                             : container::renderer::EditableLightId{};
-  std::vector<BimScheduleElement> bimScheduleElements;
-  std::vector<BimScheduleRow> bimScheduleByClassAndStoreyRows;
-  std::vector<BimScheduleRow> bimScheduleByTypeAndStoreyRows;
-  std::vector<BimScheduleRow> bimScheduleByMaterialRows;
-  std::vector<BimModelCompareElement> bimModelCompareElements;
   container::ui::BimInspectionState bimInspection{};
+  // Owns the selected element's properties referenced by bimInspection.
+  BimElementMetadata selectedBimMetadata{};
+  bimSnapCandidates_.clear();
   if (subs_.bimManager && subs_.bimManager->hasScene()) {
     const BimSceneStats stats = subs_.bimManager->sceneStats();
     const BimOptimizedModelMetadata &optimizedMetadata =
@@ -4394,17 +4447,26 @@ void RendererFrontend::presentSceneControls() {
     const auto &elementStatuses = subs_.bimManager->elementStatuses();
     const auto &elementStoreyRanges = subs_.bimManager->elementStoreyRanges();
     const auto &elementMetadata = subs_.bimManager->elementMetadata();
-    bimScheduleElements = buildBimScheduleElements(elementMetadata);
-    bimScheduleByClassAndStoreyRows =
-        buildBimScheduleByIfcClassAndStorey(bimScheduleElements);
-    bimScheduleByTypeAndStoreyRows =
-        buildBimScheduleByTypeAndStorey(bimScheduleElements);
-    bimScheduleByMaterialRows =
-        buildBimScheduleMaterialTotals(bimScheduleElements);
-    bimModelCompareElements = buildBimModelCompareElements(elementMetadata);
+    const uint64_t bimDataRevision = subs_.bimManager->objectDataRevision();
+    if (!bimScheduleCache_.valid ||
+        bimScheduleCache_.revision != bimDataRevision) {
+      const std::vector<BimScheduleElement> scheduleElements =
+          buildBimScheduleElements(elementMetadata);
+      bimScheduleCache_.byClassAndStorey =
+          buildBimScheduleByIfcClassAndStorey(scheduleElements);
+      bimScheduleCache_.byTypeAndStorey =
+          buildBimScheduleByTypeAndStorey(scheduleElements);
+      bimScheduleCache_.byMaterial =
+          buildBimScheduleMaterialTotals(scheduleElements);
+      bimScheduleCache_.compareElements =
+          buildBimModelCompareElements(elementMetadata);
+      bimScheduleCache_.revision = bimDataRevision;
+      bimScheduleCache_.valid = true;
+    }
     bimInspection.hasScene = true;
     bimInspection.modelPath = subs_.bimManager->modelPath();
     bimInspection.objectCount = stats.objectCount;
+    bimInspection.dataRevision = bimDataRevision;
     bimInspection.meshObjectCount = stats.meshObjectCount;
     bimInspection.pointObjectCount = stats.pointObjectCount;
     bimInspection.curveObjectCount = stats.curveObjectCount;
@@ -4490,17 +4552,14 @@ void RendererFrontend::presentSceneControls() {
     const BimGeoreferenceMetadata coordinateReadoutMetadata =
         buildBimGeoreferenceMetadata(unitMetadata, georeferenceMetadata);
     bimInspection.scheduleByClassAndStoreyRows =
-        std::span<const BimScheduleRow>(bimScheduleByClassAndStoreyRows.data(),
-                                        bimScheduleByClassAndStoreyRows.size());
+        std::span<const BimScheduleRow>(bimScheduleCache_.byClassAndStorey);
     bimInspection.scheduleByTypeAndStoreyRows =
-        std::span<const BimScheduleRow>(bimScheduleByTypeAndStoreyRows.data(),
-                                        bimScheduleByTypeAndStoreyRows.size());
+        std::span<const BimScheduleRow>(bimScheduleCache_.byTypeAndStorey);
     bimInspection.scheduleByMaterialRows =
-        std::span<const BimScheduleRow>(bimScheduleByMaterialRows.data(),
-                                        bimScheduleByMaterialRows.size());
+        std::span<const BimScheduleRow>(bimScheduleCache_.byMaterial);
     bimInspection.modelCompareElements =
-        std::span<const BimModelCompareElement>(bimModelCompareElements.data(),
-                                                bimModelCompareElements.size());
+        std::span<const BimModelCompareElement>(
+            bimScheduleCache_.compareElements);
     bimInspection.hasOriginRebaseRecommendation =
         hasBimGeoreferenceReadoutMetadata(coordinateReadoutMetadata);
     bimInspection.originRebaseRecommendation =
@@ -4524,35 +4583,37 @@ void RendererFrontend::presentSceneControls() {
     bimInspection.elementStoreyRanges = std::span<const BimStoreyRange>(
         elementStoreyRanges.data(), elementStoreyRanges.size());
     bimInspection.relationshipGraph = &subs_.bimManager->relationshipGraph();
-    if (const auto *metadata =
+    if (const BimElementMetadataView selected =
             subs_.bimManager->metadataForObject(selectedBimObjectIndex_)) {
+      selectedBimMetadata = selected.toMetadata();
+      const BimElementMetadata &metadata = selectedBimMetadata;
       bimInspection.hasSelection = true;
-      bimInspection.selectedObjectIndex = metadata->objectIndex;
-      bimInspection.sourceElementIndex = metadata->sourceElementIndex;
-      bimInspection.meshId = metadata->meshId;
-      bimInspection.sourceMaterialIndex = metadata->sourceMaterialIndex;
-      bimInspection.materialIndex = metadata->materialIndex;
-      bimInspection.semanticTypeId = metadata->semanticTypeId;
-      bimInspection.sourceColor = metadata->sourceColor;
-      bimInspection.guid = metadata->guid;
-      bimInspection.type = metadata->type;
-      bimInspection.displayName = metadata->displayName;
-      bimInspection.objectType = metadata->objectType;
-      bimInspection.storeyName = metadata->storeyName;
-      bimInspection.storeyId = metadata->storeyId;
-      bimInspection.materialName = metadata->materialName;
-      bimInspection.materialCategory = metadata->materialCategory;
-      bimInspection.discipline = metadata->discipline;
-      bimInspection.phase = metadata->phase;
-      bimInspection.fireRating = metadata->fireRating;
-      bimInspection.loadBearing = metadata->loadBearing;
-      bimInspection.status = metadata->status;
-      bimInspection.sourceId = metadata->sourceId;
-      bimInspection.geometryKind = bimGeometryKindLabel(metadata->geometryKind);
+      bimInspection.selectedObjectIndex = metadata.objectIndex;
+      bimInspection.sourceElementIndex = metadata.sourceElementIndex;
+      bimInspection.meshId = metadata.meshId;
+      bimInspection.sourceMaterialIndex = metadata.sourceMaterialIndex;
+      bimInspection.materialIndex = metadata.materialIndex;
+      bimInspection.semanticTypeId = metadata.semanticTypeId;
+      bimInspection.sourceColor = metadata.sourceColor;
+      bimInspection.guid = metadata.guid;
+      bimInspection.type = metadata.type;
+      bimInspection.displayName = metadata.displayName;
+      bimInspection.objectType = metadata.objectType;
+      bimInspection.storeyName = metadata.storeyName;
+      bimInspection.storeyId = metadata.storeyId;
+      bimInspection.materialName = metadata.materialName;
+      bimInspection.materialCategory = metadata.materialCategory;
+      bimInspection.discipline = metadata.discipline;
+      bimInspection.phase = metadata.phase;
+      bimInspection.fireRating = metadata.fireRating;
+      bimInspection.loadBearing = metadata.loadBearing;
+      bimInspection.status = metadata.status;
+      bimInspection.sourceId = metadata.sourceId;
+      bimInspection.geometryKind = bimGeometryKindLabel(metadata.geometryKind);
       bimInspection.properties = std::span<const BimElementProperty>(
-          metadata->properties.data(), metadata->properties.size());
-      bimInspection.transparent = metadata->transparent;
-      bimInspection.doubleSided = metadata->doubleSided;
+          metadata.properties.data(), metadata.properties.size());
+      bimInspection.transparent = metadata.transparent;
+      bimInspection.doubleSided = metadata.doubleSided;
       const BimElementBounds elementBounds =
           subs_.bimManager->elementBoundsForObject(selectedBimObjectIndex_);
       if (elementBounds.valid) {
@@ -4570,6 +4631,44 @@ void RendererFrontend::presentSceneControls() {
         bimInspection.originRebaseRecommendation = recommendBimOriginRebase(
             glm::dvec3(elementBounds.center), coordinateReadoutMetadata);
       }
+      if (subs_.guiManager &&
+          container::ui::BimMeasurementSnapModeUsesGeometry(
+              subs_.guiManager->bimMeasurementSnapState().mode)) {
+        // Snap around the cursor while it is over the selected element, and
+        // around the point the element was picked at otherwise.
+        std::optional<glm::vec3> snapPoint;
+        if (bimSnapCursorHit_.valid) {
+          const BimElementMetadataView cursorMetadata =
+              subs_.bimManager->metadataForObject(
+                  bimSnapCursorHit_.objectIndex);
+          if (bimSnapCursorHit_.objectIndex == selectedBimObjectIndex_ ||
+              (cursorMetadata &&
+               sameBimProductIdentity(selected, cursorMetadata))) {
+            snapPoint = bimSnapCursorHit_.point;
+          }
+        }
+        if (!snapPoint && selectionNavigationAnchor_.valid &&
+            selectionNavigationAnchor_.bimObject == selectedBimObjectIndex_) {
+          snapPoint = selectionNavigationAnchor_.point;
+        }
+        if (snapPoint) {
+          const VkExtent2D extent = svc_.swapChainManager.extent();
+          subs_.bimManager->collectSnapCandidatesForObject(
+              selectedBimObjectIndex_,
+              BimSnapFeatureQuery{
+                  .hitPoint = *snapPoint,
+                  .viewProj = buffers_.cameraData.viewProj,
+                  .inverseViewProj = buffers_.cameraData.inverseViewProj,
+                  .viewportSize = {static_cast<float>(extent.width),
+                                   static_cast<float>(extent.height)},
+                  .maxScreenDistancePixels =
+                      subs_.guiManager->bimMeasurementSnapState()
+                          .maxScreenDistancePixels,
+              },
+              bimSnapCandidates_);
+          bimInspection.geometricSnapCandidates = bimSnapCandidates_;
+        }
+      }
     }
   }
   const container::ui::ViewpointSnapshotState currentViewpoint =
@@ -5311,6 +5410,9 @@ RendererFrontend::buildFrameRecordParams(uint32_t imageIndex) {
 
   FrameRecordParams p{};
   p.runtime.imageIndex = imageIndex;
+  if (frame_.currentFrame < frame_.arenas.size()) {
+    p.runtime.frameArena = frame_.arenas[frame_.currentFrame].get();
+  }
   p.registries.resourceContracts = subs_.frameResourceRegistry.get();
   p.registries.pipelineRecipes = subs_.pipelineRegistry.get();
   p.registries.resourceBindings = subs_.frameRuntimeResourceRegistry.get();
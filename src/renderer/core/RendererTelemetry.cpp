@@ -26,21 +26,6 @@ const RenderPassExecutionStatus* findStatus(
   return it == statuses.end() ? nullptr : &*it;
 }
 
-std::string blockerText(const RenderPassExecutionStatus& status) {
-  switch (status.skipReason) {
-    case RenderPassSkipReason::MissingPassDependency:
-      return std::string(renderPassName(status.blockingPass));
-    case RenderPassSkipReason::MissingResource:
-      return std::string(renderResourceName(status.blockingResource));
-    case RenderPassSkipReason::None:
-    case RenderPassSkipReason::Disabled:
-    case RenderPassSkipReason::MissingRecordCallback:
-    case RenderPassSkipReason::NotNeeded:
-      break;
-  }
-  return {};
-}
-
 float percentile95(std::vector<float> values) {
   if (values.empty()) return 0.0f;
   std::ranges::sort(values);
@@ -53,11 +38,9 @@ float percentile95(std::vector<float> values) {
 
 RendererTelemetry::RendererTelemetry(size_t historyCapacity)
     : historyCapacity_(std::max<size_t>(historyCapacity, 1u)) {
-  history_.reserve(historyCapacity_);
-  activePassCpuMs_.assign(kRenderPassIdCount, 0.0f);
-  activePassGpuMs_.assign(kRenderPassIdCount, 0.0f);
-  activePassCpuRecorded_.assign(kRenderPassIdCount, 0u);
-  activePassGpuRecorded_.assign(kRenderPassIdCount, 0u);
+  frames_.resize(historyCapacity_);
+  strings_.reserve(kRendererTelemetryMaxStrings);
+  strings_.emplace_back();
 }
 
 void RendererTelemetry::beginFrame(uint64_t frameIndex,
@@ -71,29 +54,13 @@ void RendererTelemetry::beginFrame(uint64_t frameIndex,
   active_.sync.frameSlot = frameSlot;
   active_.sync.maxFramesInFlight = maxFramesInFlight;
   active_.sync.serializedConcurrency = serializedConcurrency;
-  active_.sync.concurrencyReason = std::string(concurrencyReason);
+  active_.sync.concurrencyReason = intern(concurrencyReason);
   active_.sync.swapchainRecreateCount = swapchainRecreateCount_;
   active_.sync.deviceWaitIdleCount = deviceWaitIdleCount_;
-  if (activePassCpuMs_.size() != kRenderPassIdCount) {
-    activePassCpuMs_.assign(kRenderPassIdCount, 0.0f);
-  } else {
-    std::ranges::fill(activePassCpuMs_, 0.0f);
-  }
-  if (activePassGpuMs_.size() != kRenderPassIdCount) {
-    activePassGpuMs_.assign(kRenderPassIdCount, 0.0f);
-  } else {
-    std::ranges::fill(activePassGpuMs_, 0.0f);
-  }
-  if (activePassCpuRecorded_.size() != kRenderPassIdCount) {
-    activePassCpuRecorded_.assign(kRenderPassIdCount, 0u);
-  } else {
-    std::ranges::fill(activePassCpuRecorded_, 0u);
-  }
-  if (activePassGpuRecorded_.size() != kRenderPassIdCount) {
-    activePassGpuRecorded_.assign(kRenderPassIdCount, 0u);
-  } else {
-    std::ranges::fill(activePassGpuRecorded_, 0u);
-  }
+  activePassCpuMs_.fill(0.0f);
+  activePassGpuMs_.fill(0.0f);
+  activePassCpuRecorded_.fill(0u);
+  activePassGpuRecorded_.fill(0u);
   activePassGpuTimingAvailable_ = false;
   activeRecording_ = true;
 }
@@ -119,6 +86,8 @@ void RendererTelemetry::setCullingStats(const CullStats& stats) {
   active_.culling.inputCount = stats.totalInputCount;
   active_.culling.frustumPassedCount = stats.frustumPassedCount;
   active_.culling.occlusionPassedCount = stats.occlusionPassedCount;
+  active_.culling.descriptorWrites = stats.descriptorWrites;
+  active_.culling.uploadedBytes = stats.uploadedBytes;
 }
 
 void RendererTelemetry::setLightCullingStats(
@@ -153,25 +122,15 @@ void RendererTelemetry::recordPassCpuTime(RenderPassId id,
   const auto index = static_cast<size_t>(id);
   if (index >= activePassCpuMs_.size()) return;
   activePassCpuMs_[index] += std::max(milliseconds, 0.0f);
-  if (index < activePassCpuRecorded_.size()) {
-    activePassCpuRecorded_[index] = 1u;
-  }
+  activePassCpuRecorded_[index] = 1u;
 }
 
 void RendererTelemetry::setPassGpuTimings(
     std::span<const RendererPassGpuTiming> timings,
     RendererGpuTimingSource source) {
   if (!activeRecording_) return;
-  if (activePassGpuMs_.size() != kRenderPassIdCount) {
-    activePassGpuMs_.assign(kRenderPassIdCount, 0.0f);
-  } else {
-    std::ranges::fill(activePassGpuMs_, 0.0f);
-  }
-  if (activePassGpuRecorded_.size() != kRenderPassIdCount) {
-    activePassGpuRecorded_.assign(kRenderPassIdCount, 0u);
-  } else {
-    std::ranges::fill(activePassGpuRecorded_, 0u);
-  }
+  activePassGpuMs_.fill(0.0f);
+  activePassGpuRecorded_.fill(0u);
 
   float totalGpuMs = 0.0f;
   bool recordedAnyGpuTiming = false;
@@ -194,9 +153,10 @@ void RendererTelemetry::setPassGpuTimings(
 }
 
 void RendererTelemetry::setGpuProfilerStatus(
-    RendererGpuProfilerTelemetry status) {
+    RendererGpuProfilerTelemetry profiler, std::string_view status) {
   if (!activeRecording_) return;
-  active_.gpuProfiler = std::move(status);
+  profiler.status = intern(status);
+  active_.gpuProfiler = profiler;
 }
 
 void RendererTelemetry::setWorkload(RendererWorkloadTelemetry workload) {
@@ -215,16 +175,17 @@ void RendererTelemetry::setResources(RendererResourceTelemetry resources) {
 void RendererTelemetry::setRenderGraph(const RenderGraph& graph) {
   if (!activeRecording_) return;
 
-  active_.passes.clear();
-  active_.passes.reserve(graph.passes().size());
+  active_.passCount = 0;
   active_.graph = {};
   active_.graph.totalPasses = graph.passCount();
   active_.graph.enabledPasses = graph.enabledPassCount();
 
   const auto statuses = graph.lastFrameExecutionStatuses();
   for (const auto& node : graph.passes()) {
-    RendererPassTelemetry pass{};
-    pass.name = node.name;
+    if (active_.passCount == active_.passes.size()) break;
+    RendererPassTelemetry& pass = active_.passes[active_.passCount++];
+    pass = {};
+    pass.id = node.id;
     pass.enabled = node.enabled;
     const auto passIndex = static_cast<size_t>(node.id);
     if (passIndex < activePassCpuMs_.size()) {
@@ -239,14 +200,11 @@ void RendererTelemetry::setRenderGraph(const RenderGraph& graph) {
                     activePassGpuRecorded_[passIndex] != 0u;
 
     if (const auto* status = findStatus(statuses, node.id)) {
+      pass.statusKnown = true;
       pass.active = status->active;
-      pass.status = status->active
-                        ? "Active"
-                        : std::string(renderPassSkipReasonName(
-                              status->skipReason));
-      pass.blocker = blockerText(*status);
-    } else {
-      pass.status = node.enabled ? "Unknown" : "Disabled";
+      pass.skipReason = status->skipReason;
+      pass.blockingPass = status->blockingPass;
+      pass.blockingResource = status->blockingResource;
     }
 
     if (pass.active) {
@@ -260,8 +218,6 @@ void RendererTelemetry::setRenderGraph(const RenderGraph& graph) {
     if (pass.gpuTimed) {
       ++active_.graph.gpuTimedPasses;
     }
-
-    active_.passes.push_back(std::move(pass));
   }
 }
 
@@ -282,50 +238,94 @@ void RendererTelemetry::noteDeviceWaitIdle() {
 void RendererTelemetry::endFrame() {
   if (!activeRecording_) return;
 
-  latest_ = active_;
-  if (history_.size() == historyCapacity_) {
-    history_.erase(history_.begin());
-  }
-  history_.push_back(RendererTelemetryHistorySample{
-      .frameIndex = latest_.frameIndex,
-      .cpuFrameMs =
-          latest_.timing.cpuMs[phaseIndex(RendererTelemetryPhase::Frame)],
-      .gpuKnownMs = latest_.timing.gpuKnownMs,
-      .waitForFrameMs =
-          latest_.timing.cpuMs[phaseIndex(RendererTelemetryPhase::WaitForFrame)],
-      .presentMs =
-          latest_.timing.cpuMs[phaseIndex(RendererTelemetryPhase::Present)],
-  });
+  frames_[frameHead_] = active_;
+  frameHead_ = (frameHead_ + 1u) % frames_.size();
+  frameCount_ = std::min(frameCount_ + 1u, frames_.size());
   activeRecording_ = false;
 }
 
+const RendererTelemetrySnapshot& RendererTelemetry::latest() const {
+  static const RendererTelemetrySnapshot kEmpty{};
+  return frameCount_ == 0 ? kEmpty : frames_[frameSlot(frameCount_ - 1u)];
+}
+
+size_t RendererTelemetry::frameSlot(size_t i) const {
+  return (frameHead_ + frames_.size() - frameCount_ + i) % frames_.size();
+}
+
 RendererTelemetryView RendererTelemetry::view() const {
-  return RendererTelemetryView{
-      .latest = latest_,
-      .history = history_,
-      .summary = buildSummary(),
-  };
+  RendererTelemetryView view{.latest = latest(),
+                             .summary = buildSummary(),
+                             .strings = strings_};
+  view.history.reserve(frameCount_);
+  for (size_t i = 0; i < frameCount_; ++i) {
+    const RendererTelemetrySnapshot& frame = frames_[frameSlot(i)];
+    view.history.push_back(RendererTelemetryHistorySample{
+        .frameIndex = frame.frameIndex,
+        .cpuFrameMs =
+            frame.timing.cpuMs[phaseIndex(RendererTelemetryPhase::Frame)],
+        .gpuKnownMs = frame.timing.gpuKnownMs,
+        .waitForFrameMs = frame.timing.cpuMs[phaseIndex(
+            RendererTelemetryPhase::WaitForFrame)],
+        .presentMs =
+            frame.timing.cpuMs[phaseIndex(RendererTelemetryPhase::Present)],
+    });
+  }
+  return view;
+}
+
+std::vector<RendererTelemetrySnapshot> RendererTelemetry::capturedFrames(
+    uint64_t firstFrame, uint64_t lastFrame) const {
+  std::vector<RendererTelemetrySnapshot> frames;
+  for (size_t i = 0; i < frameCount_; ++i) {
+    const RendererTelemetrySnapshot& frame = frames_[frameSlot(i)];
+    if (frame.frameIndex >= firstFrame && frame.frameIndex <= lastFrame) {
+      frames.push_back(frame);
+    }
+  }
+  return frames;
+}
+
+RendererTelemetryStringId RendererTelemetry::intern(std::string_view value) {
+  if (value.empty()) return kRendererTelemetryNoString;
+  const auto it = std::ranges::find(strings_, value);
+  if (it != strings_.end()) {
+    return static_cast<RendererTelemetryStringId>(it - strings_.begin());
+  }
+  if (strings_.size() >= kRendererTelemetryMaxStrings) {
+    return kRendererTelemetryNoString;
+  }
+  strings_.emplace_back(value);
+  return static_cast<RendererTelemetryStringId>(strings_.size() - 1u);
+}
+
+std::string_view RendererTelemetry::text(RendererTelemetryStringId id) const {
+  return id < strings_.size() ? std::string_view(strings_[id])
+                              : std::string_view{};
 }
 
 RendererTelemetrySummary RendererTelemetry::buildSummary() const {
   RendererTelemetrySummary summary{};
-  summary.frameCount = static_cast<uint32_t>(history_.size());
-  if (history_.empty()) return summary;
+  summary.frameCount = static_cast<uint32_t>(frameCount_);
+  if (frameCount_ == 0) return summary;
 
   std::vector<float> cpuFrames;
-  cpuFrames.reserve(history_.size());
+  cpuFrames.reserve(frameCount_);
 
   float totalCpu = 0.0f;
   float totalGpu = 0.0f;
-  for (const auto& sample : history_) {
-    cpuFrames.push_back(sample.cpuFrameMs);
-    totalCpu += sample.cpuFrameMs;
-    totalGpu += sample.gpuKnownMs;
-    summary.maxCpuFrameMs = std::max(summary.maxCpuFrameMs, sample.cpuFrameMs);
-    summary.maxGpuKnownMs = std::max(summary.maxGpuKnownMs, sample.gpuKnownMs);
+  for (size_t i = 0; i < frameCount_; ++i) {
+    const RendererFrameTiming& timing = frames_[frameSlot(i)].timing;
+    const float cpuFrameMs =
+        timing.cpuMs[phaseIndex(RendererTelemetryPhase::Frame)];
+    cpuFrames.push_back(cpuFrameMs);
+    totalCpu += cpuFrameMs;
+    totalGpu += timing.gpuKnownMs;
+    summary.maxCpuFrameMs = std::max(summary.maxCpuFrameMs, cpuFrameMs);
+    summary.maxGpuKnownMs = std::max(summary.maxGpuKnownMs, timing.gpuKnownMs);
   }
 
-  const float frameCount = static_cast<float>(history_.size());
+  const float frameCount = static_cast<float>(frameCount_);
   summary.averageCpuFrameMs = totalCpu / frameCount;
   summary.averageGpuKnownMs = totalGpu / frameCount;
   summary.p95CpuFrameMs = percentile95(std::move(cpuFrames));
@@ -355,6 +355,30 @@ std::string_view rendererTelemetryPhaseName(RendererTelemetryPhase phase) {
   return kNames[phaseIndex(phase)];
 }
 
+std::string_view rendererPassTelemetryStatus(
+    const RendererPassTelemetry& pass) {
+  if (!pass.statusKnown) return pass.enabled ? "Unknown" : "Disabled";
+  if (pass.active) return "Active";
+  return renderPassSkipReasonName(pass.skipReason);
+}
+
+std::string_view rendererPassTelemetryBlocker(
+    const RendererPassTelemetry& pass) {
+  if (!pass.statusKnown || pass.active) return {};
+  switch (pass.skipReason) {
+    case RenderPassSkipReason::MissingPassDependency:
+      return renderPassName(pass.blockingPass);
+    case RenderPassSkipReason::MissingResource:
+      return renderResourceName(pass.blockingResource);
+    case RenderPassSkipReason::None:
+    case RenderPassSkipReason::Disabled:
+    case RenderPassSkipReason::MissingRecordCallback:
+    case RenderPassSkipReason::NotNeeded:
+      break;
+  }
+  return {};
+}
+
 std::string_view rendererGpuTimingSourceName(RendererGpuTimingSource source) {
   switch (source) {
     case RendererGpuTimingSource::None:
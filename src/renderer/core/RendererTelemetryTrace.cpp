@@ -0,0 +1,142 @@
+#include "Container/renderer/core/RendererTelemetryTrace.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <string_view>
+
+namespace container::renderer {
+
+namespace {
+
+constexpr int kTraceProcessId = 1;
+constexpr int kCpuPhaseThread = 1;
+constexpr int kPassRecordThread = 2;
+constexpr int kPassGpuThread = 3;
+
+class TraceWriter {
+ public:
+  TraceWriter() {
+    out_ << std::fixed << std::setprecision(3);
+    out_ << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  }
+
+  void threadName(int tid, std::string_view name) {
+    beginEvent();
+    out_ << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":"
+         << kTraceProcessId << ",\"tid\":" << tid
+         << ",\"args\":{\"name\":";
+    writeString(name);
+    out_ << "}}";
+  }
+
+  void complete(int tid, std::string_view category, std::string_view name,
+                double startMs, double durationMs, uint64_t frameIndex) {
+    beginEvent();
+    out_ << "{\"name\":";
+    writeString(name);
+    out_ << ",\"cat\":";
+    writeString(category);
+    out_ << ",\"ph\":\"X\",\"ts\":" << startMs * 1000.0
+         << ",\"dur\":" << durationMs * 1000.0
+         << ",\"pid\":" << kTraceProcessId << ",\"tid\":" << tid
+         << ",\"args\":{\"frame\":" << frameIndex << "}}";
+  }
+
+  [[nodiscard]] std::string finish() {
+    out_ << "\n]}\n";
+    return out_.str();
+  }
+
+ private:
+  void beginEvent() {
+    out_ << (firstEvent_ ? "\n" : ",\n");
+    firstEvent_ = false;
+  }
+
+  void writeString(std::string_view value) {
+    out_ << '"';
+    for (const char ch : value) {
+      switch (ch) {
+        case '"':
+          out_ << "\\\"";
+          break;
+        case '\\':
+          out_ << "\\\\";
+          break;
+        case '\n':
+          out_ << "\\n";
+          break;
+        default:
+          if (static_cast<unsigned char>(ch) < 0x20u) {
+            out_ << ' ';
+          } else {
+            out_ << ch;
+          }
+          break;
+      }
+    }
+    out_ << '"';
+  }
+
+  std::ostringstream out_{};
+  bool firstEvent_{true};
+};
+
+}  // namespace
+
+std::string exportRendererChromeTrace(
+    std::span<const RendererTelemetrySnapshot> frames) {
+  TraceWriter writer;
+  writer.threadName(kCpuPhaseThread, "CPU frame");
+  writer.threadName(kPassRecordThread, "Render graph record");
+  writer.threadName(kPassGpuThread, "GPU passes");
+
+  double frameStartMs = 0.0;
+  for (const RendererTelemetrySnapshot& frame : frames) {
+    if (!frame.valid) continue;
+
+    double phaseStartMs = frameStartMs;
+    double commandRecordStartMs = frameStartMs;
+    for (size_t i = 0; i < kRendererTelemetryPhaseCount; ++i) {
+      const auto phase = static_cast<RendererTelemetryPhase>(i);
+      if (phase == RendererTelemetryPhase::Frame) continue;
+      if (phase == RendererTelemetryPhase::CommandRecord) {
+        commandRecordStartMs = phaseStartMs;
+      }
+      const double durationMs = frame.timing.cpuMs[i];
+      if (durationMs <= 0.0) continue;
+      writer.complete(kCpuPhaseThread, "cpu", rendererTelemetryPhaseName(phase),
+                      phaseStartMs, durationMs, frame.frameIndex);
+      phaseStartMs += durationMs;
+    }
+
+    const double frameMs =
+        std::max<double>(frame.timing.cpuMs[static_cast<size_t>(
+                             RendererTelemetryPhase::Frame)],
+                         phaseStartMs - frameStartMs);
+    writer.complete(kCpuPhaseThread, "cpu",
+                    rendererTelemetryPhaseName(RendererTelemetryPhase::Frame),
+                    frameStartMs, frameMs, frame.frameIndex);
+
+    double recordStartMs = commandRecordStartMs;
+    double gpuStartMs = frameStartMs;
+    for (const RendererPassTelemetry& pass : frame.passList()) {
+      if (pass.cpuTimed) {
+        writer.complete(kPassRecordThread, "record", renderPassName(pass.id),
+                        recordStartMs, pass.cpuRecordMs, frame.frameIndex);
+        recordStartMs += pass.cpuRecordMs;
+      }
+      if (pass.gpuTimed) {
+        writer.complete(kPassGpuThread, "gpu", renderPassName(pass.id),
+                        gpuStartMs, pass.gpuKnownMs, frame.frameIndex);
+        gpuStartMs += pass.gpuKnownMs;
+      }
+    }
+
+    frameStartMs += frameMs;
+  }
+  return writer.finish();
+}
+
+}  // namespace container::renderer
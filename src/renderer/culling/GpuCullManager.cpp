@@ -14,10 +14,25 @@
 
 namespace container::renderer {
 
+using container::gpu::CullEmitPushConstants;
 using container::gpu::CullPushConstants;
+using container::gpu::GpuCullInstance;
+using container::gpu::GpuCullRun;
 using container::gpu::GpuDrawIndexedIndirectCommand;
 using container::gpu::HiZPushConstants;
 
+namespace {
+
+// Per-instance culling is opt-in (ENABLE_GPU_INSTANCE_CULLING) until its
+// shaders have been validated on hardware.
+#if defined(CONTAINER_GPU_INSTANCE_CULLING)
+constexpr bool kInstanceCulling = true;
+#else
+constexpr bool kInstanceCulling = false;
+#endif
+
+}  // namespace
+
 GpuCullManager::GpuCullManager(
     std::shared_ptr<container::gpu::VulkanDevice> device,
     container::gpu::AllocationManager&            allocationManager,
@@ -28,8 +43,18 @@ GpuCullManager::GpuCullManager(
 }
 
 GpuCullManager::~GpuCullManager() {
+  if (cullRunBuffer_.buffer != VK_NULL_HANDLE)
+    allocationManager_.destroyBuffer(cullRunBuffer_);
+  if (cullInstanceBuffer_.buffer != VK_NULL_HANDLE)
+    allocationManager_.destroyBuffer(cullInstanceBuffer_);
   if (inputDrawBuffer_.buffer != VK_NULL_HANDLE)
     allocationManager_.destroyBuffer(inputDrawBuffer_);
+  if (culledInstanceBuffer_.buffer != VK_NULL_HANDLE)
+    allocationManager_.destroyBuffer(culledInstanceBuffer_);
+  if (frustumRunCountBuffer_.buffer != VK_NULL_HANDLE)
+    allocationManager_.destroyBuffer(frustumRunCountBuffer_);
+  if (occlusionRunCountBuffer_.buffer != VK_NULL_HANDLE)
+    allocationManager_.destroyBuffer(occlusionRunCountBuffer_);
   if (indirectDrawBuffer_.buffer != VK_NULL_HANDLE)
     allocationManager_.destroyBuffer(indirectDrawBuffer_);
   if (drawCountBuffer_.buffer != VK_NULL_HANDLE)
@@ -48,6 +73,11 @@ GpuCullManager::~GpuCullManager() {
   pipelineManager_.destroyDescriptorPool(frustumCullPool_);
   pipelineManager_.destroyDescriptorSetLayout(frustumCullSetLayout_);
 
+  pipelineManager_.destroyPipeline(emitDrawsPipeline_);
+  pipelineManager_.destroyPipelineLayout(emitDrawsPipelineLayout_);
+  pipelineManager_.destroyDescriptorPool(emitDrawsPool_);
+  pipelineManager_.destroyDescriptorSetLayout(emitDrawsSetLayout_);
+
   destroyHiZImage();
   if (hizSampler_ != VK_NULL_HANDLE)
     vkDestroySampler(device_->device(), hizSampler_, nullptr);
@@ -62,8 +92,13 @@ GpuCullManager::~GpuCullManager() {
   pipelineManager_.destroyDescriptorSetLayout(occlusionCullSetLayout_);
 }
 
+bool GpuCullManager::instanceCullingEnabled() {
+  return kInstanceCulling;
+}
+
 bool GpuCullManager::isReady() const {
   return frustumCullPipeline_ != VK_NULL_HANDLE &&
+         (!kInstanceCulling || emitDrawsPipeline_ != VK_NULL_HANDLE) &&
          device_->enabledFeatures().drawIndirectFirstInstance == VK_TRUE;
 }
 
@@ -73,6 +108,9 @@ bool GpuCullManager::canRecordOcclusionCull() const {
          hizGeneratedThisFrame_ &&
          occlusionCullPipeline_ != VK_NULL_HANDLE &&
          occlusionCullSet_ != VK_NULL_HANDLE &&
+         (!kInstanceCulling ||
+          (occlusionEmitSet_ != VK_NULL_HANDLE &&
+           occlusionRunCountBuffer_.buffer != VK_NULL_HANDLE)) &&
          occlusionIndirectBuffer_.buffer != VK_NULL_HANDLE &&
          occlusionCountBuffer_.buffer != VK_NULL_HANDLE &&
          drawCountBuffer_.buffer != VK_NULL_HANDLE &&
@@ -95,20 +133,39 @@ void GpuCullManager::beginFrameCulling() {
 
 void GpuCullManager::createResources(const std::filesystem::path& shaderDir) {
   createFrustumCullPipeline(shaderDir);
+  if (kInstanceCulling) createEmitDrawsPipeline(shaderDir);
   createHiZPipeline(shaderDir);
   createOcclusionCullPipeline(shaderDir);
 }
 
-bool GpuCullManager::ensureBufferCapacity(uint32_t maxObjectCount) {
-  if (maxObjectCount <= maxObjectCount_ &&
+bool GpuCullManager::ensureBufferCapacity(uint32_t runCount,
+                                          uint32_t instanceCount) {
+  if (runCount <= maxRunCount_ && instanceCount <= maxInstanceCount_ &&
       indirectDrawBuffer_.buffer != VK_NULL_HANDLE) {
     return false;
   }
 
-  const uint32_t capacity = std::max(maxObjectCount, 64u);
+  const uint32_t runCapacity = growCullBufferCapacity(maxRunCount_, runCount);
+  const uint32_t instanceCapacity =
+      growCullBufferCapacity(maxInstanceCount_, instanceCount);
+
+  // Frames in flight may still read the old buffers through the cull and
+  // scene descriptor sets. Growth is rare, so wait rather than defer.
+  if (indirectDrawBuffer_.buffer != VK_NULL_HANDLE)
+    vkDeviceWaitIdle(device_->device());
 
+  if (cullRunBuffer_.buffer != VK_NULL_HANDLE)
+    allocationManager_.destroyBuffer(cullRunBuffer_);
+  if (cullInstanceBuffer_.buffer != VK_NULL_HANDLE)
+    allocationManager_.destroyBuffer(cullInstanceBuffer_);
   if (inputDrawBuffer_.buffer != VK_NULL_HANDLE)
     allocationManager_.destroyBuffer(inputDrawBuffer_);
+  if (culledInstanceBuffer_.buffer != VK_NULL_HANDLE)
+    allocationManager_.destroyBuffer(culledInstanceBuffer_);
+  if (frustumRunCountBuffer_.buffer != VK_NULL_HANDLE)
+    allocationManager_.destroyBuffer(frustumRunCountBuffer_);
+  if (occlusionRunCountBuffer_.buffer != VK_NULL_HANDLE)
+    allocationManager_.destroyBuffer(occlusionRunCountBuffer_);
   if (indirectDrawBuffer_.buffer != VK_NULL_HANDLE)
     allocationManager_.destroyBuffer(indirectDrawBuffer_);
   if (drawCountBuffer_.buffer != VK_NULL_HANDLE)
@@ -118,24 +175,56 @@ bool GpuCullManager::ensureBufferCapacity(uint32_t maxObjectCount) {
   if (occlusionCountBuffer_.buffer != VK_NULL_HANDLE)
     allocationManager_.destroyBuffer(occlusionCountBuffer_);
 
-  // Input draw command SSBO (CPU-writable).
-  inputDrawBuffer_ = allocationManager_.createBuffer(
-      sizeof(GpuDrawIndexedIndirectCommand) * capacity,
-      VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
-      VMA_MEMORY_USAGE_AUTO,
-      VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT |
-          VMA_ALLOCATION_CREATE_MAPPED_BIT);
+  if (kInstanceCulling) {
+    // Run table and per-instance input (CPU-writable).
+    cullRunBuffer_ = allocationManager_.createBuffer(
+        sizeof(GpuCullRun) * runCapacity,
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+        VMA_MEMORY_USAGE_AUTO,
+        VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT |
+            VMA_ALLOCATION_CREATE_MAPPED_BIT);
+    cullInstanceBuffer_ = allocationManager_.createBuffer(
+        sizeof(GpuCullInstance) * instanceCapacity,
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+        VMA_MEMORY_USAGE_AUTO,
+        VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT |
+            VMA_ALLOCATION_CREATE_MAPPED_BIT);
+
+    // Compacted instance lists for both passes (read by vertex shaders).
+    culledInstanceBuffer_ = allocationManager_.createBuffer(
+        sizeof(uint32_t) * instanceCapacity * 2u,
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+        VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE);
+
+    // Per-run survivor counts, zeroed before each cull dispatch.
+    frustumRunCountBuffer_ = allocationManager_.createBuffer(
+        sizeof(uint32_t) * runCapacity,
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+        VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE);
+    occlusionRunCountBuffer_ = allocationManager_.createBuffer(
+        sizeof(uint32_t) * runCapacity,
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+        VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE);
+  } else {
+    // One single-instance command per object (CPU-writable).
+    inputDrawBuffer_ = allocationManager_.createBuffer(
+        sizeof(GpuDrawIndexedIndirectCommand) * runCapacity,
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+        VMA_MEMORY_USAGE_AUTO,
+        VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT |
+            VMA_ALLOCATION_CREATE_MAPPED_BIT);
+  }
 
   // Output indirect draw buffer (GPU-only, also usable as indirect source).
   indirectDrawBuffer_ = allocationManager_.createBuffer(
-      sizeof(GpuDrawIndexedIndirectCommand) * capacity,
+      sizeof(GpuDrawIndexedIndirectCommand) * runCapacity,
       VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
           VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
       VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE);
 
-  // Draw count buffer (single uint32, GPU-only + indirect).
+  // Draw count + surviving instance count (GPU-only + indirect).
   drawCountBuffer_ = allocationManager_.createBuffer(
-      sizeof(uint32_t),
+      sizeof(uint32_t) * 2,
       VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
           VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT |
           VK_BUFFER_USAGE_TRANSFER_DST_BIT |
@@ -144,13 +233,13 @@ bool GpuCullManager::ensureBufferCapacity(uint32_t maxObjectCount) {
 
   // Occlusion-culled output (second pass for G-Buffer).
   occlusionIndirectBuffer_ = allocationManager_.createBuffer(
-      sizeof(GpuDrawIndexedIndirectCommand) * capacity,
+      sizeof(GpuDrawIndexedIndirectCommand) * runCapacity,
       VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
           VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
       VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE);
 
   occlusionCountBuffer_ = allocationManager_.createBuffer(
-      sizeof(uint32_t),
+      sizeof(uint32_t) * 2,
       VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
           VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT |
           VK_BUFFER_USAGE_TRANSFER_DST_BIT |
@@ -167,7 +256,9 @@ bool GpuCullManager::ensureBufferCapacity(uint32_t maxObjectCount) {
       VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT |
           VMA_ALLOCATION_CREATE_MAPPED_BIT);
 
-  maxObjectCount_ = capacity;
+  maxRunCount_      = runCapacity;
+  maxInstanceCount_ = instanceCapacity;
+  cullInputUploaded_ = false;
 
   writeDescriptorSets();
   return true;
@@ -178,29 +269,96 @@ bool GpuCullManager::ensureBufferCapacity(uint32_t maxObjectCount) {
 // ---------------------------------------------------------------------------
 
 void GpuCullManager::uploadDrawCommands(
-    const std::vector<DrawCommand>& commands) {
-  if (inputDrawBuffer_.buffer == VK_NULL_HANDLE || commands.empty()) return;
-
-  const uint32_t count =
-      std::min(static_cast<uint32_t>(commands.size()), maxObjectCount_);
-
-  // Convert DrawCommand to GpuDrawIndexedIndirectCommand.
-  // objectIndex is encoded in firstInstance so vertex shaders can read it.
-  uploadScratch_.resize(count);
-  auto& gpuCmds = uploadScratch_;
-  for (uint32_t i = 0; i < count; ++i) {
-    gpuCmds[i].indexCount    = commands[i].indexCount;
-    gpuCmds[i].instanceCount = 1;
-    gpuCmds[i].firstIndex    = commands[i].firstIndex;
-    gpuCmds[i].vertexOffset  = 0;
-    gpuCmds[i].firstInstance = commands[i].objectIndex;
+    const std::vector<DrawCommand>& commands, uint64_t revision) {
+  // Same list at the same revision: the input buffers already hold it.
+  if (revision != 0 && revision == uploadedDrawRevision_ &&
+      &commands == uploadedDrawCommands_ && cullInputUploaded_) {
+    return;
+  }
+  uploadedDrawCommands_ = &commands;
+  uploadedDrawRevision_ = revision;
+
+  if (!kInstanceCulling) {
+    std::swap(previousObjectDraws_, objectDraws_);
+    packObjectCullDraws(commands, objectDraws_);
+    const auto drawCount = static_cast<uint32_t>(objectDraws_.size());
+    lastStats_.totalInputCount = drawCount;
+    if (drawCount == 0) return;
+
+    ensureBufferCapacity(drawCount, drawCount);
+    if (inputDrawBuffer_.buffer == VK_NULL_HANDLE) return;
+
+    const CullUploadRange draws =
+        cullInputUploaded_
+            ? changedCullDrawRange(previousObjectDraws_, objectDraws_)
+            : CullUploadRange{0, objectDraws_.size()};
+    if (!draws.empty()) {
+      SceneController::writeToBuffer(
+          allocationManager_, inputDrawBuffer_,
+          objectDraws_.data() + draws.first,
+          sizeof(GpuDrawIndexedIndirectCommand) * draws.count,
+          sizeof(GpuDrawIndexedIndirectCommand) * draws.first);
+      frameUploadedBytes_ +=
+          sizeof(GpuDrawIndexedIndirectCommand) * draws.count;
+    }
+    cullInputUploaded_ = true;
+    return;
   }
 
-  SceneController::writeToBuffer(allocationManager_, inputDrawBuffer_,
-                                 gpuCmds.data(),
-                                 sizeof(GpuDrawIndexedIndirectCommand) * count);
+  // Keep what the buffers hold as the diff base for the new input.
+  std::swap(previousCullInput_, cullInput_);
+  packInstanceCullInput(commands, cullInput_);
+  lastStats_.totalInputCount = cullInput_.instanceCount();
+  if (cullInput_.runs.empty()) return;
+
+  // Grow rather than truncate: every instance gets a cull thread and a slot.
+  ensureBufferCapacity(cullInput_.runCount(), cullInput_.instanceCount());
+  if (cullRunBuffer_.buffer == VK_NULL_HANDLE ||
+      cullInstanceBuffer_.buffer == VK_NULL_HANDLE) return;
+
+  // Recreated buffers start empty, so everything counts as changed.
+  const CullUploadRange runs =
+      cullInputUploaded_
+          ? changedCullRunRange(previousCullInput_.runs, cullInput_.runs)
+          : CullUploadRange{0, cullInput_.runs.size()};
+  const CullUploadRange instances =
+      cullInputUploaded_
+          ? changedCullInstanceRange(previousCullInput_.instances,
+                                     cullInput_.instances)
+          : CullUploadRange{0, cullInput_.instances.size()};
+
+  if (!runs.empty()) {
+    SceneController::writeToBuffer(
+        allocationManager_, cullRunBuffer_, cullInput_.runs.data() + runs.first,
+        sizeof(GpuCullRun) * runs.count, sizeof(GpuCullRun) * runs.first);
+    frameUploadedBytes_ += sizeof(GpuCullRun) * runs.count;
+  }
+  if (!instances.empty()) {
+    SceneController::writeToBuffer(
+        allocationManager_, cullInstanceBuffer_,
+        cullInput_.instances.data() + instances.first,
+        sizeof(GpuCullInstance) * instances.count,
+        sizeof(GpuCullInstance) * instances.first);
+    frameUploadedBytes_ += sizeof(GpuCullInstance) * instances.count;
+  }
+  cullInputUploaded_ = true;
+}
 
-  lastStats_.totalInputCount = count;
+void GpuCullManager::updateSceneInstanceDescriptor(
+    VkDescriptorSet sceneDescriptorSet) {
+  if (sceneDescriptorSet == VK_NULL_HANDLE ||
+      culledInstanceBuffer_.buffer == VK_NULL_HANDLE) return;
+
+  VkDescriptorBufferInfo listInfo{
+      culledInstanceBuffer_.buffer, 0,
+      sizeof(uint32_t) * maxInstanceCount_ * 2u};
+  VkWriteDescriptorSet w{VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+  w.dstSet          = sceneDescriptorSet;
+  w.dstBinding      = 7;
+  w.descriptorCount = 1;
+  w.descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+  w.pBufferInfo     = &listInfo;
+  updateDescriptorSets({&w, 1});
 }
 
 // ---------------------------------------------------------------------------
@@ -209,17 +367,25 @@ void GpuCullManager::uploadDrawCommands(
 
 void GpuCullManager::dispatchFrustumCull(VkCommandBuffer cmd,
                                           VkBuffer cameraBuffer,
-                                          VkDeviceSize cameraBufferSize,
-                                          uint32_t objectCount) {
+                                          VkDeviceSize cameraBufferSize) {
   frustumDrawsValid_ = false;
+  const uint32_t instanceCount =
+      kInstanceCulling ? cullInput_.instanceCount()
+                       : static_cast<uint32_t>(objectDraws_.size());
   if (frustumCullPipeline_ == VK_NULL_HANDLE ||
+      (kInstanceCulling && (emitDrawsPipeline_ == VK_NULL_HANDLE ||
+                            frustumEmitSet_ == VK_NULL_HANDLE)) ||
       indirectDrawBuffer_.buffer == VK_NULL_HANDLE ||
       drawCountBuffer_.buffer == VK_NULL_HANDLE ||
       frustumCullSet_ == VK_NULL_HANDLE ||
-      objectCount == 0) return;
+      instanceCount == 0) return;
 
-  // Zero the draw count buffer.
-  vkCmdFillBuffer(cmd, drawCountBuffer_.buffer, 0, sizeof(uint32_t), 0);
+  // Zero the draw/instance counters and the per-run survivor counts.
+  vkCmdFillBuffer(cmd, drawCountBuffer_.buffer, 0, sizeof(uint32_t) * 2, 0);
+  if (kInstanceCulling) {
+    vkCmdFillBuffer(cmd, frustumRunCountBuffer_.buffer, 0,
+                    sizeof(uint32_t) * cullInput_.runCount(), 0);
+  }
 
   VkMemoryBarrier fillBarrier{};
   fillBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
@@ -241,7 +407,7 @@ void GpuCullManager::dispatchFrustumCull(VkCommandBuffer cmd,
     w.descriptorCount = 1;
     w.descriptorType  = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
     w.pBufferInfo     = &camInfo;
-    vkUpdateDescriptorSets(device_->device(), 1, &w, 0, nullptr);
+    updateDescriptorSets({&w, 1});
   }
 
   vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, frustumCullPipeline_);
@@ -249,16 +415,22 @@ void GpuCullManager::dispatchFrustumCull(VkCommandBuffer cmd,
                           frustumCullPipelineLayout_, 0, 1,
                           &frustumCullSet_, 0, nullptr);
 
+  // One thread per instance; frustum lists start at the front of the
+  // shared instance buffer. The per-object shader ignores the offset.
   CullPushConstants pc{};
-  pc.objectCount = objectCount;
+  pc.objectCount        = instanceCount;
+  pc.instanceListOffset = 0;
   vkCmdPushConstants(cmd, frustumCullPipelineLayout_,
                      VK_SHADER_STAGE_COMPUTE_BIT, 0,
                      sizeof(CullPushConstants), &pc);
 
-  const uint32_t groupCount = (objectCount + 63) / 64;
+  const uint32_t groupCount = (instanceCount + 63) / 64;
   vkCmdDispatch(cmd, groupCount, 1, 1);
 
-  // Barrier: compute writes → indirect draw reads + occlusion cull reads.
+  if (kInstanceCulling) recordEmitDraws(cmd, frustumEmitSet_, 0);
+
+  // Barrier: compute writes → indirect draw reads, vertex shader instance
+  // list reads + occlusion cull reads.
   VkMemoryBarrier barrier{};
   barrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
   barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
@@ -273,6 +445,32 @@ void GpuCullManager::dispatchFrustumCull(VkCommandBuffer cmd,
   frustumDrawsValid_ = true;
 }
 
+void GpuCullManager::recordEmitDraws(VkCommandBuffer cmd,
+                                     VkDescriptorSet emitSet,
+                                     uint32_t instanceListOffset) {
+  // Barrier: per-run survivor counts from the cull dispatch → emit reads.
+  VkMemoryBarrier countBarrier{VK_STRUCTURE_TYPE_MEMORY_BARRIER};
+  countBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+  countBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+  vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                       VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                       0, 1, &countBarrier, 0, nullptr, 0, nullptr);
+
+  vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, emitDrawsPipeline_);
+  vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_COMPUTE,
+                          emitDrawsPipelineLayout_, 0, 1, &emitSet, 0,
+                          nullptr);
+
+  CullEmitPushConstants pc{};
+  pc.runCount           = cullInput_.runCount();
+  pc.instanceListOffset = instanceListOffset;
+  vkCmdPushConstants(cmd, emitDrawsPipelineLayout_,
+                     VK_SHADER_STAGE_COMPUTE_BIT, 0,
+                     sizeof(CullEmitPushConstants), &pc);
+
+  vkCmdDispatch(cmd, (pc.runCount + 63) / 64, 1, 1);
+}
+
 // ---------------------------------------------------------------------------
 // Hi-Z generation
 // ---------------------------------------------------------------------------
@@ -350,12 +548,14 @@ void GpuCullManager::ensureHiZImage(uint32_t width, uint32_t height) {
     throw std::runtime_error("failed to create Hi-Z sampler");
 
   createHiZDescriptorSets();
+  writeHiZDescriptorSets();
 }
 
 void GpuCullManager::destroyHiZImage() {
   VkDevice dev = device_->device();
   pipelineManager_.destroyDescriptorPool(hizPool_);
   hizSets_.clear();
+  hizDepthSources_ = {};
 
   for (auto v : hizMipViews_)
     if (v != VK_NULL_HANDLE) vkDestroyImageView(dev, v, nullptr);
@@ -404,53 +604,21 @@ void GpuCullManager::dispatchHiZGenerate(VkCommandBuffer cmd,
                          0, 0, nullptr, 0, nullptr, 1, &b);
   }
 
+  // Descriptors are pre-baked per pyramid; only a new depth source writes.
+  const HiZDepthSource& source =
+      acquireHiZDepthSource(depthView, depthSampler);
+
   vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, hizPipeline_);
 
   uint32_t srcW = width;
   uint32_t srcH = height;
 
+  // Mips 1 and up read the previous mip; mip 0 reads the depth buffer
+  // through the depth source's own set.
   for (uint32_t mip = 0; mip < hizMipLevels_; ++mip) {
-    // Update descriptor set for this mip level.
-    VkDescriptorImageInfo srcInfo{};
-    srcInfo.imageLayout = (mip == 0)
-        ? VK_IMAGE_LAYOUT_DEPTH_READ_ONLY_STENCIL_ATTACHMENT_OPTIMAL
-        : VK_IMAGE_LAYOUT_GENERAL;
-    srcInfo.imageView = (mip == 0) ? depthView : hizMipViews_[mip - 1];
-
-    VkDescriptorImageInfo samplerInfo{};
-    samplerInfo.sampler = (mip == 0) ? depthSampler : hizSampler_;
-
-    VkDescriptorImageInfo dstInfo{};
-    dstInfo.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
-    dstInfo.imageView   = hizMipViews_[mip];
-
-    std::array<VkWriteDescriptorSet, 3> writes{};
-    writes[0] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
-    writes[0].dstSet          = hizSets_[mip];
-    writes[0].dstBinding      = 0;
-    writes[0].descriptorCount = 1;
-    writes[0].descriptorType  = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
-    writes[0].pImageInfo      = &srcInfo;
-    writes[1] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
-    writes[1].dstSet          = hizSets_[mip];
-    writes[1].dstBinding      = 1;
-    writes[1].descriptorCount = 1;
-    writes[1].descriptorType  = VK_DESCRIPTOR_TYPE_SAMPLER;
-    writes[1].pImageInfo      = &samplerInfo;
-    writes[2] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
-    writes[2].dstSet          = hizSets_[mip];
-    writes[2].dstBinding      = 2;
-    writes[2].descriptorCount = 1;
-    writes[2].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
-    writes[2].pImageInfo      = &dstInfo;
-
-    vkUpdateDescriptorSets(device_->device(),
-                           static_cast<uint32_t>(writes.size()),
-                           writes.data(), 0, nullptr);
-
+    const VkDescriptorSet set = mip == 0 ? source.levelSet : hizSets_[mip];
     vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_COMPUTE,
-                            hizPipelineLayout_, 0, 1, &hizSets_[mip], 0,
-                            nullptr);
+                            hizPipelineLayout_, 0, 1, &set, 0, nullptr);
 
     HiZPushConstants hpc{};
     hpc.srcWidth  = srcW;
@@ -506,13 +674,19 @@ void GpuCullManager::dispatchHiZGenerate(VkCommandBuffer cmd,
 
 void GpuCullManager::dispatchOcclusionCull(VkCommandBuffer cmd,
                                             VkBuffer cameraBuffer,
-                                            VkDeviceSize cameraBufferSize,
-                                            uint32_t objectCount) {
+                                            VkDeviceSize cameraBufferSize) {
   occlusionDrawsValid_ = false;
-  if (!canRecordOcclusionCull() || objectCount == 0) return;
-
-  // Zero the occlusion draw count.
-  vkCmdFillBuffer(cmd, occlusionCountBuffer_.buffer, 0, sizeof(uint32_t), 0);
+  const uint32_t instanceCount =
+      kInstanceCulling ? cullInput_.instanceCount()
+                       : static_cast<uint32_t>(objectDraws_.size());
+  if (!canRecordOcclusionCull() || instanceCount == 0) return;
+
+  // Zero the occlusion draw/instance counters and per-run survivor counts.
+  vkCmdFillBuffer(cmd, occlusionCountBuffer_.buffer, 0, sizeof(uint32_t) * 2, 0);
+  if (kInstanceCulling) {
+    vkCmdFillBuffer(cmd, occlusionRunCountBuffer_.buffer, 0,
+                    sizeof(uint32_t) * cullInput_.runCount(), 0);
+  }
 
   VkMemoryBarrier fillBarrier{VK_STRUCTURE_TYPE_MEMORY_BARRIER};
   fillBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
@@ -521,83 +695,20 @@ void GpuCullManager::dispatchOcclusionCull(VkCommandBuffer cmd,
                        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
                        0, 1, &fillBarrier, 0, nullptr, 0, nullptr);
 
-  // Update occlusion cull descriptor set.
+  // Update the camera descriptor for this frame. Buffer bindings are written
+  // by writeDescriptorSets and the Hi-Z bindings with the pyramid.
   // When culling is frozen, use the snapshot buffer instead of the live one.
   {
     const VkBuffer activeCam = (cullingFrozen_ && frozenCameraBuffer_.buffer != VK_NULL_HANDLE)
                                  ? frozenCameraBuffer_.buffer : cameraBuffer;
     VkDescriptorBufferInfo camInfo{activeCam, 0, cameraBufferSize};
-
-    // Binding 2: input draws from frustum-culled indirect buffer.
-    VkDescriptorBufferInfo inputInfo{
-        indirectDrawBuffer_.buffer, 0,
-        sizeof(GpuDrawIndexedIndirectCommand) * maxObjectCount_};
-    // Binding 3: output draws (occlusion-culled).
-    VkDescriptorBufferInfo outputInfo{
-        occlusionIndirectBuffer_.buffer, 0,
-        sizeof(GpuDrawIndexedIndirectCommand) * maxObjectCount_};
-    // Binding 4: occlusion draw count (RW).
-    VkDescriptorBufferInfo countInfo{
-        occlusionCountBuffer_.buffer, 0, sizeof(uint32_t)};
-    // Binding 5: Hi-Z pyramid (sampled image).
-    VkDescriptorImageInfo hizInfo{};
-    hizInfo.imageView   = hizFullView_;
-    hizInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-    // Binding 6: frustum-culled draw count (read-only, from frustum cull pass).
-    VkDescriptorBufferInfo frustumCountInfo{
-        drawCountBuffer_.buffer, 0, sizeof(uint32_t)};
-    // Binding 7: Hi-Z sampler.
-    VkDescriptorImageInfo samplerInfo{};
-    samplerInfo.sampler = hizSampler_;
-
-    std::array<VkWriteDescriptorSet, 7> writes{};
-    // Binding 0: camera UBO.
-    writes[0] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
-    writes[0].dstSet = occlusionCullSet_; writes[0].dstBinding = 0;
-    writes[0].descriptorCount = 1;
-    writes[0].descriptorType  = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-    writes[0].pBufferInfo     = &camInfo;
-    // Binding 1: object SSBO — written via updateObjectSsboDescriptor; skip here.
-    // Binding 2: input draws (frustum-culled output).
-    writes[1] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
-    writes[1].dstSet = occlusionCullSet_; writes[1].dstBinding = 2;
-    writes[1].descriptorCount = 1;
-    writes[1].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-    writes[1].pBufferInfo     = &inputInfo;
-    // Binding 3: output draws (occlusion-culled).
-    writes[2] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
-    writes[2].dstSet = occlusionCullSet_; writes[2].dstBinding = 3;
-    writes[2].descriptorCount = 1;
-    writes[2].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-    writes[2].pBufferInfo     = &outputInfo;
-    // Binding 4: occlusion draw count.
-    writes[3] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
-    writes[3].dstSet = occlusionCullSet_; writes[3].dstBinding = 4;
-    writes[3].descriptorCount = 1;
-    writes[3].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-    writes[3].pBufferInfo     = &countInfo;
-    // Binding 5: Hi-Z sampled image.
-    writes[4] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
-    writes[4].dstSet = occlusionCullSet_; writes[4].dstBinding = 5;
-    writes[4].descriptorCount = 1;
-    writes[4].descriptorType  = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
-    writes[4].pImageInfo      = &hizInfo;
-    // Binding 6: frustum-culled draw count (read-only).
-    writes[5] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
-    writes[5].dstSet = occlusionCullSet_; writes[5].dstBinding = 6;
-    writes[5].descriptorCount = 1;
-    writes[5].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-    writes[5].pBufferInfo     = &frustumCountInfo;
-    // Binding 7: Hi-Z sampler.
-    writes[6] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
-    writes[6].dstSet = occlusionCullSet_; writes[6].dstBinding = 7;
-    writes[6].descriptorCount = 1;
-    writes[6].descriptorType  = VK_DESCRIPTOR_TYPE_SAMPLER;
-    writes[6].pImageInfo      = &samplerInfo;
-
-    vkUpdateDescriptorSets(device_->device(),
-                           static_cast<uint32_t>(writes.size()),
-                           writes.data(), 0, nullptr);
+    VkWriteDescriptorSet w{VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+    w.dstSet          = occlusionCullSet_;
+    w.dstBinding      = 0;
+    w.descriptorCount = 1;
+    w.descriptorType  = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    w.pBufferInfo     = &camInfo;
+    updateDescriptorSets({&w, 1});
   }
 
   vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, occlusionCullPipeline_);
@@ -605,15 +716,23 @@ void GpuCullManager::dispatchOcclusionCull(VkCommandBuffer cmd,
                           occlusionCullPipelineLayout_, 0, 1,
                           &occlusionCullSet_, 0, nullptr);
 
+  // One thread per frustum list slot (per-object: per frustum survivor
+  // slot); occlusion lists follow the frustum lists in the shared instance
+  // buffer.
   CullPushConstants pc{};
-  pc.objectCount = objectCount;
+  pc.objectCount        = instanceCount;
+  pc.instanceListOffset = maxInstanceCount_;
   vkCmdPushConstants(cmd, occlusionCullPipelineLayout_,
                      VK_SHADER_STAGE_COMPUTE_BIT, 0,
                      sizeof(CullPushConstants), &pc);
 
-  const uint32_t groupCount = (objectCount + 63) / 64;
+  const uint32_t groupCount = (instanceCount + 63) / 64;
   vkCmdDispatch(cmd, groupCount, 1, 1);
 
+  if (kInstanceCulling) {
+    recordEmitDraws(cmd, occlusionEmitSet_, maxInstanceCount_);
+  }
+
   // Barrier: compute writes → indirect draw reads.
   VkMemoryBarrier barrier{VK_STRUCTURE_TYPE_MEMORY_BARRIER};
   barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
@@ -640,7 +759,7 @@ void GpuCullManager::drawIndirect(VkCommandBuffer cmd) const {
       cmd,
       indirectDrawBuffer_.buffer, 0,
       drawCountBuffer_.buffer, 0,
-      maxObjectCount_,
+      maxRunCount_,
       sizeof(GpuDrawIndexedIndirectCommand));
 }
 
@@ -653,7 +772,7 @@ void GpuCullManager::drawIndirectOccluded(VkCommandBuffer cmd) const {
       cmd,
       occlusionIndirectBuffer_.buffer, 0,
       occlusionCountBuffer_.buffer, 0,
-      maxObjectCount_,
+      maxRunCount_,
       sizeof(GpuDrawIndexedIndirectCommand));
 }
 
@@ -663,24 +782,28 @@ void GpuCullManager::drawIndirectOccluded(VkCommandBuffer cmd) const {
 
 void GpuCullManager::createFrustumCullPipeline(
     const std::filesystem::path& shaderDir) {
-  // Descriptor set layout: binding 0 = camera UBO, 1 = object SSBO,
-  // 2 = input draw SSBO, 3 = output draw SSBO, 4 = draw count SSBO.
+  // Descriptor set layout: binding 0 = camera UBO, 1 = object SSBO, then
+  // storage buffers. Per object: 2 = input draws, 3 = output draws,
+  // 4 = draw count. Per instance: 2 = cull instances, 3 = cull runs,
+  // 4 = frustum run counts, 5 = culled instance ids, 6 = draw/instance
+  // counters.
+  const uint32_t storageBindings = kInstanceCulling ? 6u : 4u;
   {
-    const std::array<VkDescriptorSetLayoutBinding, 5> bindings = {{
+    std::vector<VkDescriptorSetLayoutBinding> bindings = {
         {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,  1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
-        {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,  1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
-        {2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,  1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
-        {3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,  1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
-        {4, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,  1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
-    }};
+    };
+    for (uint32_t binding = 1; binding <= storageBindings; ++binding) {
+      bindings.push_back({binding, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1,
+                          VK_SHADER_STAGE_COMPUTE_BIT, nullptr});
+    }
     const std::vector<VkDescriptorBindingFlags> flags(bindings.size(), 0);
-    frustumCullSetLayout_ = pipelineManager_.createDescriptorSetLayout(
-        {bindings.begin(), bindings.end()}, flags);
+    frustumCullSetLayout_ =
+        pipelineManager_.createDescriptorSetLayout(bindings, flags);
   }
 
   frustumCullPool_ = pipelineManager_.createDescriptorPool(
       {{VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1},
-       {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 4}},
+       {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, storageBindings}},
       1, 0);
 
   {
@@ -700,7 +823,9 @@ void GpuCullManager::createFrustumCullPipeline(
   frustumCullPipelineLayout_ = pipelineManager_.createPipelineLayout(
       {frustumCullSetLayout_}, {pcRange});
 
-  auto compPath = shaderDir / "spv_shaders" / "frustum_cull.comp.spv";
+  auto compPath = shaderDir / "spv_shaders" /
+                  (kInstanceCulling ? "frustum_cull_instances.comp.spv"
+                                    : "frustum_cull.comp.spv");
   const auto spvData = container::util::readFile(compPath);
   VkShaderModule compModule =
       container::gpu::createShaderModule(device_->device(), spvData);
@@ -722,6 +847,70 @@ void GpuCullManager::createFrustumCullPipeline(
   vkDestroyShaderModule(device_->device(), compModule, nullptr);
 }
 
+void GpuCullManager::createEmitDrawsPipeline(
+    const std::filesystem::path& shaderDir) {
+  // Descriptor set layout: binding 0 = cull runs, 1 = run survivor counts,
+  // 2 = output draw SSBO, 3 = draw/instance counters. One set per cull pass.
+  {
+    const std::array<VkDescriptorSetLayoutBinding, 4> bindings = {{
+        {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,  1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,  1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,  1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+        {3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,  1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+    }};
+    const std::vector<VkDescriptorBindingFlags> flags(bindings.size(), 0);
+    emitDrawsSetLayout_ = pipelineManager_.createDescriptorSetLayout(
+        {bindings.begin(), bindings.end()}, flags);
+  }
+
+  emitDrawsPool_ = pipelineManager_.createDescriptorPool(
+      {{VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 8}},
+      2, 0);
+
+  {
+    const std::array<VkDescriptorSetLayout, 2> layouts = {
+        emitDrawsSetLayout_, emitDrawsSetLayout_};
+    std::array<VkDescriptorSet, 2> sets{};
+    VkDescriptorSetAllocateInfo ai{VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO};
+    ai.descriptorPool     = emitDrawsPool_;
+    ai.descriptorSetCount = static_cast<uint32_t>(layouts.size());
+    ai.pSetLayouts        = layouts.data();
+    if (vkAllocateDescriptorSets(device_->device(), &ai,
+                                 sets.data()) != VK_SUCCESS)
+      throw std::runtime_error("failed to allocate cull emit descriptor sets");
+    frustumEmitSet_   = sets[0];
+    occlusionEmitSet_ = sets[1];
+  }
+
+  VkPushConstantRange pcRange{};
+  pcRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+  pcRange.size       = sizeof(CullEmitPushConstants);
+
+  emitDrawsPipelineLayout_ = pipelineManager_.createPipelineLayout(
+      {emitDrawsSetLayout_}, {pcRange});
+
+  auto compPath = shaderDir / "spv_shaders" / "cull_emit_draws.comp.spv";
+  const auto spvData = container::util::readFile(compPath);
+  VkShaderModule compModule =
+      container::gpu::createShaderModule(device_->device(), spvData);
+
+  VkPipelineShaderStageCreateInfo stage{};
+  stage.sType  = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+  stage.stage  = VK_SHADER_STAGE_COMPUTE_BIT;
+  stage.module = compModule;
+  stage.pName  = "computeMain";
+
+  VkComputePipelineCreateInfo ci{};
+  ci.sType  = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+  ci.stage  = stage;
+  ci.layout = emitDrawsPipelineLayout_;
+
+  emitDrawsPipeline_ =
+      pipelineManager_.createComputePipeline(ci, "cull_emit_draws");
+
+  vkDestroyShaderModule(device_->device(), compModule, nullptr);
+}
+
 void GpuCullManager::createHiZPipeline(
     const std::filesystem::path& shaderDir) {
   auto compPath = shaderDir / "spv_shaders" / "hiz_generate.comp.spv";
@@ -769,51 +958,201 @@ void GpuCullManager::createHiZDescriptorSets() {
 
   pipelineManager_.destroyDescriptorPool(hizPool_);
   hizSets_.clear();
+  hizDepthSources_ = {};
 
+  // hizSets_[0] stays null: mip 0 reads the depth buffer and uses the set
+  // of the matching depth source instead.
+  const uint32_t setCount = hizMipLevels_ - 1u + kHiZDepthSourceSlots;
   hizPool_ = pipelineManager_.createDescriptorPool(
-      {{VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, hizMipLevels_},
-       {VK_DESCRIPTOR_TYPE_SAMPLER, hizMipLevels_},
-       {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, hizMipLevels_}},
-      hizMipLevels_, 0);
+      {{VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, setCount},
+       {VK_DESCRIPTOR_TYPE_SAMPLER, setCount},
+       {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, setCount}},
+      setCount, 0);
 
-  std::vector<VkDescriptorSetLayout> layouts(hizMipLevels_, hizSetLayout_);
-  hizSets_.resize(hizMipLevels_, VK_NULL_HANDLE);
+  std::vector<VkDescriptorSetLayout> layouts(setCount, hizSetLayout_);
+  std::vector<VkDescriptorSet> sets(setCount, VK_NULL_HANDLE);
 
   VkDescriptorSetAllocateInfo ai{VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO};
   ai.descriptorPool     = hizPool_;
-  ai.descriptorSetCount = hizMipLevels_;
+  ai.descriptorSetCount = setCount;
   ai.pSetLayouts        = layouts.data();
-  if (vkAllocateDescriptorSets(device_->device(), &ai, hizSets_.data()) !=
+  if (vkAllocateDescriptorSets(device_->device(), &ai, sets.data()) !=
       VK_SUCCESS) {
-    hizSets_.clear();
     throw std::runtime_error("failed to allocate Hi-Z descriptor sets");
   }
+  for (uint32_t slot = 0; slot < kHiZDepthSourceSlots; ++slot)
+    hizDepthSources_[slot].levelSet = sets[slot];
+  hizSets_.resize(hizMipLevels_, VK_NULL_HANDLE);
+  std::copy(sets.begin() + kHiZDepthSourceSlots, sets.end(),
+            hizSets_.begin() + 1);
+}
+
+void GpuCullManager::writeHiZDescriptorSets() {
+  if (hizSets_.size() != hizMipLevels_ || hizMipLevels_ == 0) return;
+
+  // Storage targets of every level, plus the mip-to-mip reads of mips 1+.
+  std::vector<VkDescriptorImageInfo> srcInfos(hizMipLevels_);
+  std::vector<VkDescriptorImageInfo> dstInfos(hizMipLevels_);
+  VkDescriptorImageInfo samplerInfo{};
+  samplerInfo.sampler = hizSampler_;
+
+  std::vector<VkWriteDescriptorSet> writes;
+  writes.reserve(hizMipLevels_ * 3u + kHiZDepthSourceSlots);
+  auto addImageWrite = [&writes](VkDescriptorSet set, uint32_t binding,
+                                 VkDescriptorType type,
+                                 const VkDescriptorImageInfo* info,
+                                 uint32_t count) {
+    VkWriteDescriptorSet w{VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+    w.dstSet          = set;
+    w.dstBinding      = binding;
+    w.descriptorCount = count;
+    w.descriptorType  = type;
+    w.pImageInfo      = info;
+    writes.push_back(w);
+  };
+
+  for (uint32_t mip = 0; mip < hizMipLevels_; ++mip) {
+    dstInfos[mip].imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+    dstInfos[mip].imageView   = hizMipViews_[mip];
+    if (mip == 0) {
+      for (const HiZDepthSource& source : hizDepthSources_)
+        addImageWrite(source.levelSet, 2, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+                      &dstInfos[0], 1);
+      continue;
+    }
+    srcInfos[mip].imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+    srcInfos[mip].imageView   = hizMipViews_[mip - 1];
+    addImageWrite(hizSets_[mip], 0, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+                  &srcInfos[mip], 1);
+    addImageWrite(hizSets_[mip], 1, VK_DESCRIPTOR_TYPE_SAMPLER,
+                  &samplerInfo, 1);
+    addImageWrite(hizSets_[mip], 2, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+                  &dstInfos[mip], 1);
+  }
+
+  updateDescriptorSets(writes);
+  writeOcclusionHiZDescriptors();
+}
+
+const GpuCullManager::HiZDepthSource& GpuCullManager::acquireHiZDepthSource(
+    VkImageView depthView, VkSampler depthSampler) {
+  ++hizDepthSourceClock_;
+  HiZDepthSource* oldest = &hizDepthSources_[0];
+  for (HiZDepthSource& source : hizDepthSources_) {
+    if (source.depthView == depthView && source.depthSampler == depthSampler) {
+      source.lastUsed = hizDepthSourceClock_;
+      return source;
+    }
+    if (source.lastUsed < oldest->lastUsed) oldest = &source;
+  }
+
+  // New depth source: point the least recently used slot at it.
+  VkDescriptorImageInfo srcInfo{};
+  srcInfo.imageLayout =
+      VK_IMAGE_LAYOUT_DEPTH_READ_ONLY_STENCIL_ATTACHMENT_OPTIMAL;
+  srcInfo.imageView = depthView;
+  VkDescriptorImageInfo samplerInfo{};
+  samplerInfo.sampler = depthSampler;
+
+  std::array<VkWriteDescriptorSet, 2> writes{};
+  uint32_t writeCount = 0;
+  auto addWrite = [&](VkDescriptorSet set, uint32_t binding,
+                      VkDescriptorType type,
+                      const VkDescriptorImageInfo* info) {
+    VkWriteDescriptorSet& w = writes[writeCount++];
+    w = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+    w.dstSet          = set;
+    w.dstBinding      = binding;
+    w.descriptorCount = 1;
+    w.descriptorType  = type;
+    w.pImageInfo      = info;
+  };
+  addWrite(oldest->levelSet, 0, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, &srcInfo);
+  addWrite(oldest->levelSet, 1, VK_DESCRIPTOR_TYPE_SAMPLER, &samplerInfo);
+  updateDescriptorSets({writes.data(), writeCount});
+
+  oldest->depthView    = depthView;
+  oldest->depthSampler = depthSampler;
+  oldest->lastUsed     = hizDepthSourceClock_;
+  return *oldest;
+}
+
+void GpuCullManager::invalidateHiZDepthSources() {
+  for (HiZDepthSource& source : hizDepthSources_) {
+    source.depthView    = VK_NULL_HANDLE;
+    source.depthSampler = VK_NULL_HANDLE;
+    source.lastUsed     = 0;
+  }
+}
+
+void GpuCullManager::writeOcclusionHiZDescriptors() {
+  if (occlusionCullSet_ == VK_NULL_HANDLE || hizFullView_ == VK_NULL_HANDLE ||
+      hizSampler_ == VK_NULL_HANDLE) return;
+
+  // Binding 5: Hi-Z pyramid (sampled image).
+  VkDescriptorImageInfo hizInfo{};
+  hizInfo.imageView   = hizFullView_;
+  hizInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+  // Binding 7: Hi-Z sampler.
+  VkDescriptorImageInfo samplerInfo{};
+  samplerInfo.sampler = hizSampler_;
+
+  std::array<VkWriteDescriptorSet, 2> writes{};
+  writes[0] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+  writes[0].dstSet = occlusionCullSet_; writes[0].dstBinding = 5;
+  writes[0].descriptorCount = 1;
+  writes[0].descriptorType  = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+  writes[0].pImageInfo      = &hizInfo;
+  writes[1] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+  writes[1].dstSet = occlusionCullSet_; writes[1].dstBinding = 7;
+  writes[1].descriptorCount = 1;
+  writes[1].descriptorType  = VK_DESCRIPTOR_TYPE_SAMPLER;
+  writes[1].pImageInfo      = &samplerInfo;
+  updateDescriptorSets(writes);
+}
+
+void GpuCullManager::updateDescriptorSets(
+    std::span<const VkWriteDescriptorSet> writes) {
+  if (writes.empty()) return;
+  vkUpdateDescriptorSets(device_->device(),
+                         static_cast<uint32_t>(writes.size()),
+                         writes.data(), 0, nullptr);
+  frameDescriptorWrites_ += static_cast<uint32_t>(writes.size());
 }
 
 void GpuCullManager::createOcclusionCullPipeline(
     const std::filesystem::path& shaderDir) {
-  auto compPath = shaderDir / "spv_shaders" / "occlusion_cull.comp.spv";
+  auto compPath = shaderDir / "spv_shaders" /
+                  (kInstanceCulling ? "occlusion_cull_instances.comp.spv"
+                                    : "occlusion_cull.comp.spv");
   if (!std::filesystem::exists(compPath)) return;
 
+  // Descriptor set layout: binding 0 = camera UBO, 1 = object SSBO,
+  // 5 = Hi-Z, 7 = Hi-Z sampler, the rest storage buffers. Per object:
+  // 2 = input draws, 3 = output draws, 4 = draw count, 6 = frustum draw
+  // count. Per instance: 2 = cull instances, 3 = cull runs, 4 = frustum run
+  // counts, 6 = occlusion run counts, 8 = culled instance ids,
+  // 9 = occlusion draw/instance counters.
+  const uint32_t bindingCount = kInstanceCulling ? 10u : 8u;
   {
-    const std::array<VkDescriptorSetLayoutBinding, 8> bindings = {{
-        {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,  1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
-        {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,  1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
-        {2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,  1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
-        {3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,  1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
-        {4, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,  1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
-        {5, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,   1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
-        {6, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,  1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
-        {7, VK_DESCRIPTOR_TYPE_SAMPLER,          1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
-    }};
+    std::vector<VkDescriptorSetLayoutBinding> bindings;
+    bindings.reserve(bindingCount);
+    for (uint32_t binding = 0; binding < bindingCount; ++binding) {
+      VkDescriptorType type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+      if (binding == 0) type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+      if (binding == 5) type = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+      if (binding == 7) type = VK_DESCRIPTOR_TYPE_SAMPLER;
+      bindings.push_back(
+          {binding, type, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr});
+    }
     const std::vector<VkDescriptorBindingFlags> flags(bindings.size(), 0);
-    occlusionCullSetLayout_ = pipelineManager_.createDescriptorSetLayout(
-        {bindings.begin(), bindings.end()}, flags);
+    occlusionCullSetLayout_ =
+        pipelineManager_.createDescriptorSetLayout(bindings, flags);
   }
 
   occlusionCullPool_ = pipelineManager_.createDescriptorPool(
       {{VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1},
-       {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 5},
+       {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, bindingCount - 3u},
        {VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 1},
        {VK_DESCRIPTOR_TYPE_SAMPLER, 1}},
       1, 0);
@@ -853,6 +1192,8 @@ void GpuCullManager::createOcclusionCullPipeline(
   occlusionCullPipeline_ =
       pipelineManager_.createComputePipeline(ci, "occlusion_cull");
   vkDestroyShaderModule(device_->device(), compModule, nullptr);
+
+  writeOcclusionHiZDescriptors();
 }
 
 // ---------------------------------------------------------------------------
@@ -862,43 +1203,94 @@ void GpuCullManager::createOcclusionCullPipeline(
 void GpuCullManager::writeDescriptorSets() {
   if (frustumCullSet_ == VK_NULL_HANDLE) return;
 
-  // Bindings 1-4: object SSBO, input draw, output draw, draw count.
-  // Binding 0 (camera) is updated per-frame in dispatchFrustumCull.
-  VkDescriptorBufferInfo inputInfo{
-      inputDrawBuffer_.buffer, 0,
-      sizeof(GpuDrawIndexedIndirectCommand) * maxObjectCount_};
+  // Buffer bindings of the frustum, occlusion and emit sets. The camera and
+  // object SSBO bindings are updated per frame, the Hi-Z ones per pyramid.
+  const VkDeviceSize runBytes = sizeof(uint32_t) * maxRunCount_;
+  VkDescriptorBufferInfo instanceInfo{
+      cullInstanceBuffer_.buffer, 0,
+      sizeof(GpuCullInstance) * maxInstanceCount_};
+  VkDescriptorBufferInfo runInfo{
+      cullRunBuffer_.buffer, 0, sizeof(GpuCullRun) * maxRunCount_};
+  VkDescriptorBufferInfo frustumRunCountInfo{
+      frustumRunCountBuffer_.buffer, 0, runBytes};
+  VkDescriptorBufferInfo occlusionRunCountInfo{
+      occlusionRunCountBuffer_.buffer, 0, runBytes};
+  VkDescriptorBufferInfo culledInfo{
+      culledInstanceBuffer_.buffer, 0,
+      sizeof(uint32_t) * maxInstanceCount_ * 2};
   VkDescriptorBufferInfo outputInfo{
       indirectDrawBuffer_.buffer, 0,
-      sizeof(GpuDrawIndexedIndirectCommand) * maxObjectCount_};
+      sizeof(GpuDrawIndexedIndirectCommand) * maxRunCount_};
   VkDescriptorBufferInfo countInfo{
-      drawCountBuffer_.buffer, 0, sizeof(uint32_t)};
+      drawCountBuffer_.buffer, 0, sizeof(uint32_t) * 2};
+  VkDescriptorBufferInfo occlusionOutputInfo{
+      occlusionIndirectBuffer_.buffer, 0,
+      sizeof(GpuDrawIndexedIndirectCommand) * maxRunCount_};
+  VkDescriptorBufferInfo occlusionCountInfo{
+      occlusionCountBuffer_.buffer, 0, sizeof(uint32_t) * 2};
 
-  std::array<VkWriteDescriptorSet, 3> writes{};
-  // Binding 2: input draw commands.
-  writes[0].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-  writes[0].dstSet          = frustumCullSet_;
-  writes[0].dstBinding      = 2;
-  writes[0].descriptorCount = 1;
-  writes[0].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-  writes[0].pBufferInfo     = &inputInfo;
-  // Binding 3: output indirect commands.
-  writes[1].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-  writes[1].dstSet          = frustumCullSet_;
-  writes[1].dstBinding      = 3;
-  writes[1].descriptorCount = 1;
-  writes[1].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-  writes[1].pBufferInfo     = &outputInfo;
-  // Binding 4: draw count.
-  writes[2].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-  writes[2].dstSet          = frustumCullSet_;
-  writes[2].dstBinding      = 4;
-  writes[2].descriptorCount = 1;
-  writes[2].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-  writes[2].pBufferInfo     = &countInfo;
+  VkDescriptorBufferInfo inputDrawInfo{
+      inputDrawBuffer_.buffer, 0,
+      sizeof(GpuDrawIndexedIndirectCommand) * maxRunCount_};
 
-  vkUpdateDescriptorSets(device_->device(),
-                         static_cast<uint32_t>(writes.size()),
-                         writes.data(), 0, nullptr);
+  std::vector<VkWriteDescriptorSet> writes;
+  writes.reserve(19);
+  auto addWrite = [&writes](VkDescriptorSet set, uint32_t binding,
+                            const VkDescriptorBufferInfo* info) {
+    VkWriteDescriptorSet w{VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+    w.dstSet          = set;
+    w.dstBinding      = binding;
+    w.descriptorCount = 1;
+    w.descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    w.pBufferInfo     = info;
+    writes.push_back(w);
+  };
+
+  if (!kInstanceCulling) {
+    // Occlusion culls the frustum survivors: its input is the frustum output.
+    addWrite(frustumCullSet_, 2, &inputDrawInfo);
+    addWrite(frustumCullSet_, 3, &outputInfo);
+    addWrite(frustumCullSet_, 4, &countInfo);
+    if (occlusionCullSet_ != VK_NULL_HANDLE) {
+      addWrite(occlusionCullSet_, 2, &outputInfo);
+      addWrite(occlusionCullSet_, 3, &occlusionOutputInfo);
+      addWrite(occlusionCullSet_, 4, &occlusionCountInfo);
+      addWrite(occlusionCullSet_, 6, &countInfo);
+    }
+    updateDescriptorSets(writes);
+    return;
+  }
+
+  addWrite(frustumCullSet_, 2, &instanceInfo);
+  addWrite(frustumCullSet_, 3, &runInfo);
+  addWrite(frustumCullSet_, 4, &frustumRunCountInfo);
+  addWrite(frustumCullSet_, 5, &culledInfo);
+  addWrite(frustumCullSet_, 6, &countInfo);
+
+  if (frustumEmitSet_ != VK_NULL_HANDLE) {
+    addWrite(frustumEmitSet_, 0, &runInfo);
+    addWrite(frustumEmitSet_, 1, &frustumRunCountInfo);
+    addWrite(frustumEmitSet_, 2, &outputInfo);
+    addWrite(frustumEmitSet_, 3, &countInfo);
+  }
+
+  if (occlusionCullSet_ != VK_NULL_HANDLE) {
+    addWrite(occlusionCullSet_, 2, &instanceInfo);
+    addWrite(occlusionCullSet_, 3, &runInfo);
+    addWrite(occlusionCullSet_, 4, &frustumRunCountInfo);
+    addWrite(occlusionCullSet_, 6, &occlusionRunCountInfo);
+    addWrite(occlusionCullSet_, 8, &culledInfo);
+    addWrite(occlusionCullSet_, 9, &occlusionCountInfo);
+  }
+
+  if (occlusionEmitSet_ != VK_NULL_HANDLE) {
+    addWrite(occlusionEmitSet_, 0, &runInfo);
+    addWrite(occlusionEmitSet_, 1, &occlusionRunCountInfo);
+    addWrite(occlusionEmitSet_, 2, &occlusionOutputInfo);
+    addWrite(occlusionEmitSet_, 3, &occlusionCountInfo);
+  }
+
+  updateDescriptorSets(writes);
 }
 
 void GpuCullManager::updateObjectSsboDescriptor(
@@ -935,10 +1327,7 @@ void GpuCullManager::updateObjectSsboDescriptor(
     writes.push_back(w);
   }
 
-  if (!writes.empty())
-    vkUpdateDescriptorSets(device_->device(),
-                           static_cast<uint32_t>(writes.size()),
-                           writes.data(), 0, nullptr);
+  updateDescriptorSets(writes);
 }
 
 // ---------------------------------------------------------------------------
@@ -973,21 +1362,24 @@ void GpuCullManager::scheduleStatsReadback(VkCommandBuffer cmd) {
       VK_PIPELINE_STAGE_TRANSFER_BIT,
       0, 1, &preBarrier, 0, nullptr, 0, nullptr);
 
-  // Copy frustum-culled draw count → statsReadbackBuffer_[0].
+  // Copy frustum-surviving instance count → statsReadbackBuffer_[0]. Word 0
+  // of each count buffer is the indirect draw count, word 1 the instances;
+  // per-object draws are single instances, so word 0 is the count there.
+  const VkDeviceSize countOffset = kInstanceCulling ? sizeof(uint32_t) : 0;
   VkBufferCopy frustumCopy{};
-  frustumCopy.srcOffset = 0;
+  frustumCopy.srcOffset = countOffset;
   frustumCopy.dstOffset = 0;
   frustumCopy.size      = sizeof(uint32_t);
   vkCmdCopyBuffer(cmd, drawCountBuffer_.buffer,
                   statsReadbackBuffer_.buffer, 1, &frustumCopy);
 
-  // Copy occlusion-culled draw count → statsReadbackBuffer_[1].
+  // Copy occlusion-surviving instance count → statsReadbackBuffer_[1].
   const VkBuffer occlusionStatsSource =
       occlusionDrawsValid_ ? occlusionCountBuffer_.buffer
                            : drawCountBuffer_.buffer;
 
   VkBufferCopy occlusionCopy{};
-  occlusionCopy.srcOffset = 0;
+  occlusionCopy.srcOffset = countOffset;
   occlusionCopy.dstOffset = sizeof(uint32_t);
   occlusionCopy.size      = sizeof(uint32_t);
   vkCmdCopyBuffer(cmd, occlusionStatsSource,
@@ -1004,6 +1396,12 @@ void GpuCullManager::scheduleStatsReadback(VkCommandBuffer cmd) {
 }
 
 void GpuCullManager::collectStats() {
+  // CPU-side counters cover everything recorded since the last call.
+  lastStats_.descriptorWrites = frameDescriptorWrites_;
+  lastStats_.uploadedBytes    = frameUploadedBytes_;
+  frameDescriptorWrites_ = 0;
+  frameUploadedBytes_    = 0;
+
   if (statsReadbackBuffer_.buffer == VK_NULL_HANDLE ||
       statsReadbackBuffer_.allocation == nullptr) return;
 
@@ -0,0 +1,189 @@
+#include "Container/renderer/culling/InstanceCullPacking.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace container::renderer {
+
+namespace {
+
+using container::gpu::GpuCullInstance;
+using container::gpu::GpuCullRun;
+using container::gpu::GpuDrawIndexedIndirectCommand;
+
+// Instances of a run that still fit below kCulledInstanceListBit.
+[[nodiscard]] uint32_t addressableInstanceCount(const DrawCommand &command) {
+  if (command.objectIndex >= kCulledInstanceListBit) {
+    return 0u;
+  }
+  return std::min(command.instanceCount,
+                  kCulledInstanceListBit - command.objectIndex);
+}
+
+template <typename T>
+[[nodiscard]] CullUploadRange changedRange(std::span<const T> uploaded,
+                                           std::span<const T> next) {
+  const auto differs = [&](size_t i) {
+    return std::memcmp(&uploaded[i], &next[i], sizeof(T)) != 0;
+  };
+  const size_t common = std::min(uploaded.size(), next.size());
+  size_t first = 0;
+  while (first < common && !differs(first)) {
+    ++first;
+  }
+  size_t end = next.size();
+  if (next.size() <= uploaded.size()) {
+    while (end > first && !differs(end - 1u)) {
+      --end;
+    }
+  }
+  return {.first = first, .count = end - first};
+}
+
+} // namespace
+
+CullUploadRange changedCullRunRange(std::span<const GpuCullRun> uploaded,
+                                    std::span<const GpuCullRun> next) {
+  return changedRange(uploaded, next);
+}
+
+CullUploadRange
+changedCullInstanceRange(std::span<const GpuCullInstance> uploaded,
+                         std::span<const GpuCullInstance> next) {
+  return changedRange(uploaded, next);
+}
+
+CullUploadRange
+changedCullDrawRange(std::span<const GpuDrawIndexedIndirectCommand> uploaded,
+                     std::span<const GpuDrawIndexedIndirectCommand> next) {
+  return changedRange(uploaded, next);
+}
+
+void packObjectCullDraws(std::span<const DrawCommand> commands,
+                         std::vector<GpuDrawIndexedIndirectCommand> &draws) {
+  draws.clear();
+
+  size_t totalInstances = 0;
+  for (const DrawCommand &command : commands) {
+    if (command.indexCount != 0u) {
+      totalInstances += command.instanceCount;
+    }
+  }
+  draws.reserve(totalInstances);
+
+  for (const DrawCommand &command : commands) {
+    if (command.indexCount == 0u) {
+      continue;
+    }
+    for (uint32_t i = 0; i < command.instanceCount; ++i) {
+      draws.push_back(GpuDrawIndexedIndirectCommand{
+          .indexCount = command.indexCount,
+          .instanceCount = 1u,
+          .firstIndex = command.firstIndex,
+          .vertexOffset = 0,
+          .firstInstance = command.objectIndex + i});
+    }
+  }
+}
+
+void packInstanceCullInput(std::span<const DrawCommand> commands,
+                           InstanceCullInput &input) {
+  input.runs.clear();
+  input.instances.clear();
+
+  size_t totalInstances = 0;
+  for (const DrawCommand &command : commands) {
+    if (command.indexCount != 0u) {
+      totalInstances += addressableInstanceCount(command);
+    }
+  }
+  input.runs.reserve(commands.size());
+  input.instances.reserve(totalInstances);
+
+  for (const DrawCommand &command : commands) {
+    const uint32_t instanceCount = addressableInstanceCount(command);
+    if (command.indexCount == 0u || instanceCount == 0u) {
+      continue;
+    }
+
+    const uint32_t runIndex = static_cast<uint32_t>(input.runs.size());
+    input.runs.push_back(
+        GpuCullRun{.indexCount = command.indexCount,
+                   .firstIndex = command.firstIndex,
+                   .instanceOffset =
+                       static_cast<uint32_t>(input.instances.size()),
+                   .instanceCount = instanceCount});
+    for (uint32_t i = 0; i < instanceCount; ++i) {
+      input.instances.push_back(GpuCullInstance{
+          .objectIndex = command.objectIndex + i, .runIndex = runIndex});
+    }
+  }
+}
+
+uint32_t growCullBufferCapacity(uint32_t capacity, uint32_t required) {
+  if (required <= capacity) {
+    return std::max(capacity, kMinCullBufferCapacity);
+  }
+  const uint64_t grown = static_cast<uint64_t>(capacity) + capacity / 2u;
+  const uint64_t next = std::max<uint64_t>(
+      {grown, required, kMinCullBufferCapacity});
+  return static_cast<uint32_t>(
+      std::min<uint64_t>(next, std::numeric_limits<uint32_t>::max()));
+}
+
+CompactedInstanceCull compactVisibleInstances(const InstanceCullInput &input,
+                                              std::span<const uint8_t> visible) {
+  CompactedInstanceCull result{};
+  result.runVisibleCounts.assign(input.runs.size(), 0u);
+  result.instanceIds.assign(input.instances.size(), 0u);
+
+  const size_t count = std::min(input.instances.size(), visible.size());
+  for (size_t i = 0; i < count; ++i) {
+    if (visible[i] == 0u) {
+      continue;
+    }
+    const GpuCullInstance &instance = input.instances[i];
+    const GpuCullRun &run = input.runs[instance.runIndex];
+    const uint32_t slot = result.runVisibleCounts[instance.runIndex]++;
+    result.instanceIds[run.instanceOffset + slot] = instance.objectIndex;
+  }
+  return result;
+}
+
+std::vector<GpuDrawIndexedIndirectCommand>
+buildCompactedDrawCommands(const InstanceCullInput &input,
+                           std::span<const uint32_t> runVisibleCounts,
+                           uint32_t instanceListOffset) {
+  std::vector<GpuDrawIndexedIndirectCommand> draws;
+  const size_t count = std::min(input.runs.size(), runVisibleCounts.size());
+  for (size_t i = 0; i < count; ++i) {
+    const uint32_t visibleCount =
+        std::min(runVisibleCounts[i], input.runs[i].instanceCount);
+    if (visibleCount == 0u) {
+      continue;
+    }
+    const GpuCullRun &run = input.runs[i];
+    draws.push_back(GpuDrawIndexedIndirectCommand{
+        .indexCount = run.indexCount,
+        .instanceCount = visibleCount,
+        .firstIndex = run.firstIndex,
+        .vertexOffset = 0,
+        .firstInstance = (instanceListOffset + run.instanceOffset) |
+                         kCulledInstanceListBit});
+  }
+  return draws;
+}
+
+uint32_t resolveCulledObjectIndex(uint32_t firstInstance, uint32_t instanceId,
+                                  std::span<const uint32_t> culledInstanceIds) {
+  if ((firstInstance & kCulledInstanceListBit) == 0u) {
+    return firstInstance + instanceId;
+  }
+  const size_t slot =
+      static_cast<size_t>(firstInstance & ~kCulledInstanceListBit) +
+      instanceId;
+  return slot < culledInstanceIds.size() ? culledInstanceIds[slot] : 0u;
+}
+
+} // namespace container::renderer
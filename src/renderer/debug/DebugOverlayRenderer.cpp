@@ -20,7 +20,7 @@ uint32_t drawInstanceCount(const DrawCommand& command) {
 
 void DebugOverlayRenderer::drawScene(VkCommandBuffer cmd,
                                       VkPipelineLayout layout,
-                                      const std::vector<DrawCommand>& commands,
+                                      std::span<const DrawCommand> commands,
                                       BindlessPushConstants& pc) const {
   if (commands.empty()) {
     return;
@@ -37,7 +37,7 @@ void DebugOverlayRenderer::drawScene(VkCommandBuffer cmd,
 
 void DebugOverlayRenderer::drawWireframe(VkCommandBuffer cmd,
                                           VkPipelineLayout layout,
-                                          const std::vector<DrawCommand>& commands,
+                                          std::span<const DrawCommand> commands,
                                           const glm::vec3& color,
                                           float intensity,
                                           float lineWidth,
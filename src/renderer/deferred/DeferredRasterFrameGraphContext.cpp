@@ -168,7 +168,7 @@ void DeferredRasterFrameGraphContext::afterPrepareFrame(
     const FrameRecordParams &p, const RenderGraph &) const {
   shadowCascadeFramePassRecorder_.prepareFrame(p,
                                                shadowCascadeFramePassContext());
-  prepareBimFrameGpuVisibility(p.services.bimManager);
+  prepareBimFrameGpuVisibility(p.services.bimManager, p.runtime.frameArena);
 }
 
 void DeferredRasterFrameGraphContext::afterCommandBufferBegin(
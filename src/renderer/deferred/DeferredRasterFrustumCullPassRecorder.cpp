@@ -14,12 +14,16 @@ bool recordDeferredRasterFrustumCullPassCommands(
     return false;
   }
 
-  inputs.gpuCullManager->ensureBufferCapacity(plan.drawCount);
   if (plan.updateObjectDescriptor) {
     inputs.gpuCullManager->updateObjectSsboDescriptor(inputs.objectBuffer,
                                                       inputs.objectBufferSize);
   }
-  inputs.gpuCullManager->uploadDrawCommands(*inputs.drawCommands);
+  // Grows the cull buffers as needed, so the scene instance-list binding is
+  // written afterwards.
+  inputs.gpuCullManager->uploadDrawCommands(*inputs.drawCommands,
+                                            inputs.drawCommandsRevision);
+  inputs.gpuCullManager->updateSceneInstanceDescriptor(
+      inputs.sceneDescriptorSet);
 
   switch (plan.freezeAction) {
   case DeferredRasterFrustumCullFreezeAction::Freeze:
@@ -34,7 +38,7 @@ bool recordDeferredRasterFrustumCullPassCommands(
   }
 
   inputs.gpuCullManager->dispatchFrustumCull(
-      cmd, inputs.cameraBuffer, inputs.cameraBufferSize, plan.drawCount);
+      cmd, inputs.cameraBuffer, inputs.cameraBufferSize);
   return true;
 }
 
@@ -302,12 +302,14 @@ void registerDeferredRasterPipelineRecipes(PipelineRegistry &registry) {
   registry.registerRecipe(
       PipelineRecipe{.key = {kDeferredRasterTechnique, "frustum-cull"},
                      .kind = PipelineRecipeKind::Compute,
-                     .shaderStages = {"spv_shaders/frustum_cull.comp.spv"},
+                     .shaderStages = {"spv_shaders/frustum_cull.comp.spv",
+                                      "spv_shaders/cull_emit_draws.comp.spv"},
                      .layoutName = "gpu-cull"});
   registry.registerRecipe(
       PipelineRecipe{.key = {kDeferredRasterTechnique, "occlusion-cull"},
                      .kind = PipelineRecipeKind::Compute,
-                     .shaderStages = {"spv_shaders/occlusion_cull.comp.spv"},
+                     .shaderStages = {"spv_shaders/occlusion_cull.comp.spv",
+                                      "spv_shaders/cull_emit_draws.comp.spv"},
                      .layoutName = "gpu-cull"});
   registry.registerRecipe(
       PipelineRecipe{.key = {kDeferredRasterTechnique, "hi-z-generate"},
@@ -858,8 +860,8 @@ bool deferredRasterBimProviderRasterBatchReady(const FrameRecordParams &p) {
 }
 
 bool deferredRasterBimProviderExtractionPresent(const FrameRecordParams &p) {
-  for (const container::scene::SceneProviderSnapshot &provider :
-       p.sceneExtraction.snapshots) {
+  for (const container::scene::SceneProviderView &provider :
+       p.sceneExtraction.providers) {
     if (provider.kind == container::scene::SceneProviderKind::Bim) {
       return true;
     }
@@ -1114,10 +1116,12 @@ void DeferredRasterTechnique::buildFrameGraph(RenderSystemContext &context) {
             cmd, {.gpuCullManager = deferred->gpuCullManager(),
                   .plan = frustumCullPlan,
                   .drawCommands = p.draws.opaqueSingleSidedDrawCommands,
+                  .drawCommandsRevision = p.scene.objectDataRevision,
                   .cameraBuffer = deferredRasterCameraBuffer(p),
                   .cameraBufferSize = deferredRasterCameraBufferSize(p),
                   .objectBuffer = p.scene.objectBuffer,
-                  .objectBufferSize = p.scene.objectBufferSize}));
+                  .objectBufferSize = p.scene.objectBufferSize,
+                  .sceneDescriptorSet = deferredRasterSceneDescriptorSet(p)}));
       });
 
   graph.addPass(
@@ -1184,8 +1188,8 @@ void DeferredRasterTechnique::buildFrameGraph(RenderSystemContext &context) {
         p.draws.opaqueSingleSidedDrawCommands &&
         !p.draws.opaqueSingleSidedDrawCommands->empty()) {
       deferred->gpuCullManager()->dispatchOcclusionCull(
-          cmd, deferredRasterCameraBuffer(p), deferredRasterCameraBufferSize(p),
-          static_cast<uint32_t>(p.draws.opaqueSingleSidedDrawCommands->size()));
+          cmd, deferredRasterCameraBuffer(p),
+          deferredRasterCameraBufferSize(p));
     }
   });
 
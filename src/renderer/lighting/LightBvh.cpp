@@ -0,0 +1,237 @@
+#include "Container/renderer/lighting/LightBvh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace container::renderer {
+
+using container::gpu::kUnboundedPointLightRange;
+using container::gpu::PointLightData;
+
+namespace {
+
+[[nodiscard]] bool hasRenderableIntensity(const PointLightData &light) {
+  const glm::vec4 &color = light.colorIntensity;
+  return std::isfinite(color.r) && std::isfinite(color.g) &&
+         std::isfinite(color.b) && std::isfinite(color.a) && color.a > 0.0f &&
+         (color.r > 0.0f || color.g > 0.0f || color.b > 0.0f);
+}
+
+// Mirrors the light rejection in tile_light_cull.slang.
+[[nodiscard]] bool isCullableLight(const PointLightData &light) {
+  const glm::vec4 &positionRadius = light.positionRadius;
+  return hasRenderableIntensity(light) && std::isfinite(positionRadius.x) &&
+         std::isfinite(positionRadius.y) && std::isfinite(positionRadius.z) &&
+         std::isfinite(positionRadius.w) &&
+         positionRadius.w >= kUnboundedPointLightRange;
+}
+
+[[nodiscard]] bool isUnbounded(const PointLightData &light) {
+  return light.positionRadius.w == kUnboundedPointLightRange;
+}
+
+[[nodiscard]] bool sphereOutsideAnyPlane(std::span<const glm::vec4> planes,
+                                         const glm::vec3 &center,
+                                         float radius) {
+  return std::ranges::any_of(planes, [&](const glm::vec4 &plane) {
+    return glm::dot(glm::vec3(plane), center) + plane.w < -radius;
+  });
+}
+
+[[nodiscard]] bool aabbOutsideAnyPlane(std::span<const glm::vec4> planes,
+                                       const glm::vec3 &boundsMin,
+                                       const glm::vec3 &boundsMax) {
+  return std::ranges::any_of(planes, [&](const glm::vec4 &plane) {
+    const glm::vec3 farthest{plane.x >= 0.0f ? boundsMax.x : boundsMin.x,
+                             plane.y >= 0.0f ? boundsMax.y : boundsMin.y,
+                             plane.z >= 0.0f ? boundsMax.z : boundsMin.z};
+    return glm::dot(glm::vec3(plane), farthest) + plane.w < 0.0f;
+  });
+}
+
+} // namespace
+
+void LightBvh::clear() {
+  nodes_.clear();
+  lightIndices_.clear();
+  lightSpheres_.clear();
+  unboundedLights_.clear();
+  sourceLightCount_ = 0u;
+}
+
+void LightBvh::build(std::span<const PointLightData> lights) {
+  clear();
+  sourceLightCount_ = static_cast<uint32_t>(lights.size());
+
+  buildItems_.clear();
+  buildItems_.reserve(lights.size());
+  for (uint32_t index = 0u; index < lights.size(); ++index) {
+    const PointLightData &light = lights[index];
+    if (!isCullableLight(light)) {
+      continue;
+    }
+    if (isUnbounded(light)) {
+      unboundedLights_.push_back(index);
+      continue;
+    }
+    buildItems_.push_back({.center = glm::vec3(light.positionRadius),
+                           .radius = light.positionRadius.w,
+                           .light = index});
+  }
+  if (buildItems_.empty()) {
+    return;
+  }
+
+  nodes_.reserve(buildItems_.size() + 1u);
+  nodes_.emplace_back();
+  lightIndices_.resize(buildItems_.size());
+  lightSpheres_.resize(buildItems_.size());
+  buildNode(0u, buildItems_, 0u);
+  buildItems_.clear();
+}
+
+void LightBvh::buildNode(uint32_t nodeIndex, std::span<BuildItem> items,
+                         uint32_t firstItem) {
+  glm::vec3 boundsMin{std::numeric_limits<float>::max()};
+  glm::vec3 boundsMax{std::numeric_limits<float>::lowest()};
+  glm::vec3 centerMin = boundsMin;
+  glm::vec3 centerMax = boundsMax;
+  for (const BuildItem &item : items) {
+    boundsMin = glm::min(boundsMin, item.center - glm::vec3(item.radius));
+    boundsMax = glm::max(boundsMax, item.center + glm::vec3(item.radius));
+    centerMin = glm::min(centerMin, item.center);
+    centerMax = glm::max(centerMax, item.center);
+  }
+  nodes_[nodeIndex].boundsMin = boundsMin;
+  nodes_[nodeIndex].boundsMax = boundsMax;
+
+  const glm::vec3 centerExtent = centerMax - centerMin;
+  if (items.size() <= kMaxLeafLights ||
+      std::max({centerExtent.x, centerExtent.y, centerExtent.z}) <= 0.0f) {
+    for (size_t i = 0; i < items.size(); ++i) {
+      lightIndices_[firstItem + i] = items[i].light;
+      lightSpheres_[firstItem + i] =
+          glm::vec4(items[i].center, items[i].radius);
+    }
+    nodes_[nodeIndex].firstOrChild = firstItem;
+    nodes_[nodeIndex].lightCount = static_cast<uint32_t>(items.size());
+    return;
+  }
+
+  // Median split along the widest axis of the light centres keeps the tree
+  // balanced for the dense, regular fixture layouts of building models.
+  const int axis = centerExtent.x >= centerExtent.y
+                       ? (centerExtent.x >= centerExtent.z ? 0 : 2)
+                       : (centerExtent.y >= centerExtent.z ? 1 : 2);
+  const size_t half = items.size() / 2u;
+  std::nth_element(items.begin(), items.begin() + half, items.end(),
+                   [axis](const BuildItem &lhs, const BuildItem &rhs) {
+                     return lhs.center[axis] < rhs.center[axis];
+                   });
+
+  const auto leftChild = static_cast<uint32_t>(nodes_.size());
+  nodes_.emplace_back();
+  nodes_.emplace_back();
+  nodes_[nodeIndex].firstOrChild = leftChild;
+  nodes_[nodeIndex].lightCount = 0u;
+  buildNode(leftChild, items.first(half), firstItem);
+  buildNode(leftChild + 1u, items.subspan(half),
+            firstItem + static_cast<uint32_t>(half));
+}
+
+void LightBvh::queryFrustum(std::span<const glm::vec4> planes,
+                            std::vector<uint32_t> &out) const {
+  if (nodes_.empty()) {
+    return;
+  }
+  traversalStack_.clear();
+  traversalStack_.push_back(0u);
+  while (!traversalStack_.empty()) {
+    const Node &node = nodes_[traversalStack_.back()];
+    traversalStack_.pop_back();
+    if (aabbOutsideAnyPlane(planes, node.boundsMin, node.boundsMax)) {
+      continue;
+    }
+    if (!node.isLeaf()) {
+      traversalStack_.push_back(node.firstOrChild + 1u);
+      traversalStack_.push_back(node.firstOrChild);
+      continue;
+    }
+    const uint32_t leafEnd = node.firstOrChild + node.lightCount;
+    for (uint32_t i = node.firstOrChild; i < leafEnd; ++i) {
+      const glm::vec4 &sphere = lightSpheres_[i];
+      if (!sphereOutsideAnyPlane(planes, glm::vec3(sphere), sphere.w)) {
+        out.push_back(lightIndices_[i]);
+      }
+    }
+  }
+}
+
+std::array<glm::vec4, 5> lightCullFrustumPlanes(const glm::mat4 &viewProj) {
+  auto row = [&](int index) {
+    return glm::vec4(viewProj[0][index], viewProj[1][index],
+                     viewProj[2][index], viewProj[3][index]);
+  };
+  const glm::vec4 w = row(3);
+  std::array<glm::vec4, 5> planes{w + row(0), w - row(0), w + row(1),
+                                  w - row(1), w};
+  for (glm::vec4 &plane : planes) {
+    const float length = glm::length(glm::vec3(plane));
+    if (length > 0.0f && std::isfinite(length)) {
+      plane /= length;
+    }
+  }
+  return planes;
+}
+
+float pointLightScreenImportance(const PointLightData &light,
+                                 const glm::mat4 &viewProj) {
+  if (isUnbounded(light)) {
+    return std::numeric_limits<float>::max();
+  }
+  const glm::vec4 &color = light.colorIntensity;
+  const float peakRadiance = color.a * std::max({color.r, color.g, color.b});
+  const float radius = light.positionRadius.w;
+  const float viewDepth =
+      (viewProj * glm::vec4(glm::vec3(light.positionRadius), 1.0f)).w;
+  // Once the camera is inside the light's sphere the light covers the whole
+  // view; clamp so near lights tie instead of exploding.
+  const float projectedRadius =
+      viewDepth > radius ? radius / viewDepth : 1.0f;
+  return projectedRadius * projectedRadius * peakRadiance;
+}
+
+LightWorkingSetStats selectLightWorkingSet(
+    const LightBvh &bvh, std::span<const PointLightData> lights,
+    const glm::mat4 &viewProj, uint32_t budget, std::vector<uint32_t> &out,
+    std::vector<float> &scratch) {
+  out.clear();
+  out.insert(out.end(), bvh.unboundedLights().begin(),
+             bvh.unboundedLights().end());
+  const std::array<glm::vec4, 5> planes = lightCullFrustumPlanes(viewProj);
+  bvh.queryFrustum(planes, out);
+
+  LightWorkingSetStats stats{};
+  stats.visibleLights = static_cast<uint32_t>(out.size());
+  if (out.size() > budget) {
+    scratch.resize(lights.size());
+    for (const uint32_t index : out) {
+      scratch[index] = pointLightScreenImportance(lights[index], viewProj);
+    }
+    // Ties fall back to the light index so the selection is deterministic.
+    std::nth_element(out.begin(), out.begin() + budget, out.end(),
+                     [&](uint32_t lhs, uint32_t rhs) {
+                       return scratch[lhs] != scratch[rhs]
+                                  ? scratch[lhs] > scratch[rhs]
+                                  : lhs < rhs;
+                     });
+    out.resize(budget);
+  }
+  std::ranges::sort(out);
+  stats.selectedLights = static_cast<uint32_t>(out.size());
+  stats.droppedVisibleLights = stats.visibleLights - stats.selectedLights;
+  return stats;
+}
+
+} // namespace container::renderer
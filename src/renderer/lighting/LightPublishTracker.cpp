@@ -0,0 +1,119 @@
+#include "Container/renderer/lighting/LightPublishTracker.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace container::renderer {
+
+using container::gpu::AreaLightData;
+using container::gpu::PointLightData;
+
+namespace {
+
+// Light payloads are plain vec4 blocks without padding, so a byte compare is
+// exact and matches what the GPU would see.
+template <typename Light>
+[[nodiscard]] bool sameLightBytes(const Light &lhs, const Light &rhs) {
+  static_assert(std::is_trivially_copyable_v<Light>);
+  static_assert(sizeof(Light) % sizeof(glm::vec4) == 0u);
+  return std::memcmp(&lhs, &rhs, sizeof(Light)) == 0;
+}
+
+template <typename Light>
+[[nodiscard]] LightUploadRange changedLightRange(std::span<const Light> previous,
+                                                 std::span<const Light> next) {
+  const size_t common = std::min(previous.size(), next.size());
+  size_t first = 0;
+  while (first < common && sameLightBytes(previous[first], next[first])) {
+    ++first;
+  }
+  if (first == next.size()) {
+    return {};
+  }
+
+  size_t end = next.size();
+  if (next.size() <= previous.size()) {
+    while (end > first && sameLightBytes(previous[end - 1u], next[end - 1u])) {
+      --end;
+    }
+  }
+  return {.first = static_cast<uint32_t>(first),
+          .count = static_cast<uint32_t>(end - first)};
+}
+
+template <typename Light>
+void storePublished(std::vector<Light> &published,
+                    std::span<const Light> lights) {
+  // assign() reuses the existing capacity, so a republish of a same-sized
+  // light set does not allocate.
+  published.assign(lights.begin(), lights.end());
+}
+
+} // namespace
+
+void LightUploadRange::merge(LightUploadRange other) {
+  if (other.empty()) {
+    return;
+  }
+  if (empty()) {
+    *this = other;
+    return;
+  }
+  const uint32_t mergedFirst = std::min(first, other.first);
+  const uint32_t mergedEnd = std::max(end(), other.end());
+  first = mergedFirst;
+  count = mergedEnd - mergedFirst;
+}
+
+LightUploadRange
+changedPointLightRange(std::span<const PointLightData> previous,
+                       std::span<const PointLightData> next) {
+  return changedLightRange(previous, next);
+}
+
+LightUploadRange changedAreaLightRange(std::span<const AreaLightData> previous,
+                                       std::span<const AreaLightData> next) {
+  return changedLightRange(previous, next);
+}
+
+bool LightPublishTracker::needsPublish(const LightPublishInputs &inputs) const {
+  return !published_ || *published_ != inputs;
+}
+
+void LightPublishTracker::markPublished(
+    const LightPublishInputs &inputs,
+    std::span<const PointLightData> pointLights,
+    std::span<const AreaLightData> areaLights) {
+  updatePointLights(pointLights);
+  pendingAreaUpload_.merge(
+      changedAreaLightRange(publishedAreaLights_, areaLights));
+  storePublished(publishedAreaLights_, areaLights);
+  published_ = inputs;
+  ++publishCount_;
+}
+
+void LightPublishTracker::updatePointLights(
+    std::span<const PointLightData> pointLights) {
+  pendingPointUpload_.merge(
+      changedPointLightRange(publishedPointLights_, pointLights));
+  storePublished(publishedPointLights_, pointLights);
+}
+
+void LightPublishTracker::invalidateUploads() {
+  pendingPointUpload_ = {
+      .first = 0u, .count = static_cast<uint32_t>(publishedPointLights_.size())};
+  pendingAreaUpload_ = {
+      .first = 0u, .count = static_cast<uint32_t>(publishedAreaLights_.size())};
+}
+
+LightUploadRange LightPublishTracker::takePointLightUpload() {
+  return std::exchange(pendingPointUpload_, {});
+}
+
+LightUploadRange LightPublishTracker::takeAreaLightUpload() {
+  return std::exchange(pendingAreaUpload_, {});
+}
+
+} // namespace container::renderer
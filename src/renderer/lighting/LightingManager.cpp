@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <filesystem>
 #include <glm/gtc/matrix_transform.hpp>
+#include <numeric>
 #include <span>
 #include <stdexcept>
 #include <vector>
@@ -412,6 +413,7 @@ void LightingManager::uploadLightingData(uint32_t imageIndex) const {
 void LightingManager::setLightingSettings(const LightingSettings &settings) {
   const bool generatorSettingsChanged =
       lightingSettingsDiffer(lightingSettings_, settings);
+  const LightingSettings previousSettings = lightingSettings_;
   lightingSettings_.preset = std::min(settings.preset, 3u);
   lightingSettings_.density = std::clamp(settings.density, 0.1f, 16.0f);
   lightingSettings_.radiusScale = std::clamp(settings.radiusScale, 0.05f, 8.0f);
@@ -425,6 +427,10 @@ void LightingManager::setLightingSettings(const LightingSettings &settings) {
       std::clamp(settings.bounceIntensity, 0.0f, 2.0f);
   lightingSettings_.localShadowPointBudget =
       std::min(settings.localShadowPointBudget, kMaxLocalShadowPointBudget);
+  if (generatorSettingsChanged ||
+      lightingSettingsDiffer(previousSettings, lightingSettings_)) {
+    ++lightEditRevision_;
+  }
   if (generatorSettingsChanged) {
     generatedPointOverrides_.clear();
     generatedAreaOverrides_.clear();
@@ -519,10 +525,6 @@ void LightingManager::appendAuthoredPointLights(
 
   for (const PointLightData &authoredLight :
        sceneManager_->authoredPointLights()) {
-    if (pointLightsSsbo_.size() >= kMaxClusteredLights) {
-      return;
-    }
-
     PointLightData light = authoredLight;
     light.positionRadius = glm::vec4(
         glm::vec3(anchor.sceneTransform *
@@ -633,7 +635,9 @@ void LightingManager::publishPointLights() {
   world_.replacePointLights(pointLightsSsbo_);
   rebuildPointLightSsboFromEcs();
   assignLocalShadowLayerMetadata();
-  syncLightingPointCount(lightingData_, pointLightsSsbo_);
+  rebuildLightBvh();
+  (void)selectClusteredPointLights();
+  syncLightingPointCount(lightingData_, pointLightsSsbo());
 }
 
 void LightingManager::publishAreaLights() {
@@ -642,15 +646,55 @@ void LightingManager::publishAreaLights() {
 
 void LightingManager::rebuildPointLightSsboFromEcs() {
   pointLightsSsbo_.clear();
-  pointLightsSsbo_.reserve(
-      std::min<uint32_t>(world_.pointLightCount(), kMaxClusteredLights));
+  pointLightsSsbo_.reserve(world_.pointLightCount());
   world_.forEachPointLight([&](const container::ecs::LightComponent &light) {
-    if (pointLightsSsbo_.size() >= kMaxClusteredLights)
-      return;
     pointLightsSsbo_.push_back(light.data);
   });
 }
 
+void LightingManager::rebuildLightBvh() {
+  // Light sets within the clustered budget are uploaded as-is; only larger
+  // ones need a hierarchy to pick a per-view working set from.
+  lightWorkingSetActive_ = pointLightsSsbo_.size() > kMaxClusteredLights;
+  lightWorkingSetStats_ = {};
+  lightWorkingSet_.clear();
+  clusteredPointLights_.clear();
+  if (!lightWorkingSetActive_) {
+    lightBvh_.clear();
+    return;
+  }
+  lightBvh_.build(pointLightsSsbo_);
+}
+
+bool LightingManager::selectClusteredPointLights() {
+  if (!lightWorkingSetActive_) {
+    return false;
+  }
+  if (lightWorkingSetViewProj_) {
+    lightWorkingSetStats_ = selectLightWorkingSet(
+        lightBvh_, pointLightsSsbo_, *lightWorkingSetViewProj_,
+        kMaxClusteredLights, nextLightWorkingSet_, lightImportanceScratch_);
+  } else {
+    // No camera yet: fall back to the leading lights.
+    nextLightWorkingSet_.resize(kMaxClusteredLights);
+    std::iota(nextLightWorkingSet_.begin(), nextLightWorkingSet_.end(), 0u);
+    lightWorkingSetStats_ = {};
+  }
+  if (nextLightWorkingSet_ == lightWorkingSet_ &&
+      clusteredPointLights_.size() == lightWorkingSet_.size()) {
+    return false;
+  }
+
+  std::swap(lightWorkingSet_, nextLightWorkingSet_);
+  clusteredPointLights_.clear();
+  clusteredPointLights_.reserve(lightWorkingSet_.size());
+  for (const uint32_t index : lightWorkingSet_) {
+    clusteredPointLights_.push_back(pointLightsSsbo_[index]);
+  }
+  syncLightingPointCount(lightingData_, clusteredPointLights_);
+  return true;
+}
+
 std::optional<EditableLightEntity>
 LightingManager::selectedEditableLight() const {
   for (const EditableLightEntity &light : editableLights_) {
@@ -673,6 +717,7 @@ bool LightingManager::updateEditableLight(const EditableLightEntity &entity) {
     return false;
   }
 
+  ++lightEditRevision_;
   EditableLightEntity edited = entity;
   edited.type = entity.id.type;
   edited.source = entity.id.source;
@@ -730,6 +775,7 @@ bool LightingManager::updateEditableLight(const EditableLightEntity &entity) {
 
 EditableLightId
 LightingManager::addManualEditableLight(EditableLightType type) {
+  ++lightEditRevision_;
   const SceneLightingAnchor anchor = computeSceneLightingAnchor();
   const glm::vec3 center = anchor.center;
   const float radius = std::max(anchor.worldRadius, 1.0f);
@@ -865,12 +911,8 @@ void LightingManager::applyEditableLightOverrides(
 }
 
 void LightingManager::appendManualEditableLights(const SceneLightingAnchor &) {
-  for (const PointLightData &light : manualPointLights_) {
-    if (pointLightsSsbo_.size() >= kMaxClusteredLights) {
-      break;
-    }
-    pointLightsSsbo_.push_back(light);
-  }
+  pointLightsSsbo_.insert(pointLightsSsbo_.end(), manualPointLights_.begin(),
+                          manualPointLights_.end());
   for (const AreaLightData &light : manualAreaLights_) {
     if (areaLightsSsbo_.size() >= kMaxAreaLights) {
       break;
@@ -929,8 +971,28 @@ void LightingManager::rebuildEditableLights(
   }
 }
 
+LightPublishInputs
+LightingManager::lightPublishInputs(const SceneLightingAnchor &anchor) const {
+  LightPublishInputs inputs{};
+  inputs.sceneTransform = anchor.sceneTransform;
+  inputs.rootNode = rootNode_;
+  inputs.editRevision = lightEditRevision_;
+  inputs.ecsPointLightRevision = world_.pointLightRevision();
+  if (sceneManager_) {
+    const auto &bounds = sceneManager_->modelBounds();
+    inputs.modelCenter = bounds.center;
+    inputs.modelRadius = bounds.radius;
+    inputs.modelBoundsValid = bounds.valid;
+    inputs.authoredLightRevision = sceneManager_->authoredLightRevision();
+  }
+  return inputs;
+}
+
 void LightingManager::updateLightingData() {
   const SceneLightingAnchor anchor = computeSceneLightingAnchor();
+  if (!lightPublishTracker_.needsPublish(lightPublishInputs(anchor))) {
+    return;
+  }
   const glm::mat4 &sceneTransform = anchor.sceneTransform;
 
   lightingData_ = {};
@@ -970,6 +1032,9 @@ void LightingManager::updateLightingData() {
   publishAreaLights();
   rebuildEditableLights(directionalSource, pointSource, sourcePointCount,
                         areaSource, sourceAreaCount);
+  // Sampled after publishing so the ECS light revision includes this publish.
+  lightPublishTracker_.markPublished(lightPublishInputs(anchor),
+                                     pointLightsSsbo(), areaLightsSsbo_);
 }
 
 void LightingManager::updateLightingData(
@@ -978,7 +1043,13 @@ void LightingManager::updateLightingData(
 }
 
 void LightingManager::updateLightingDataForActiveCamera() {
+  if (const auto *activeCamera = world_.activeCamera()) {
+    lightWorkingSetViewProj_ = activeCamera->data.viewProj;
+  }
   updateLightingData(nullptr);
+  if (selectClusteredPointLights()) {
+    lightPublishTracker_.updatePointLights(clusteredPointLights_);
+  }
 }
 
 void LightingManager::drawLightGizmos(
@@ -1202,6 +1273,8 @@ void LightingManager::createTiledResources(
       VMA_MEMORY_USAGE_AUTO,
       VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT |
           VMA_ALLOCATION_CREATE_MAPPED_BIT);
+  // Fresh SSBOs hold none of the already-published lights.
+  lightPublishTracker_.invalidateUploads();
 
   lightStatsBuffer_ = allocationManager_.createBuffer(
       sizeof(uint32_t) * 4,
@@ -1363,25 +1436,32 @@ void LightingManager::createTiledResources(
 void LightingManager::uploadLightSsbo() const {
   if (lightSsbo_.buffer == VK_NULL_HANDLE)
     return;
-  const uint32_t count = std::min(
-      static_cast<uint32_t>(pointLightsSsbo_.size()), kMaxClusteredLights);
-  if (count == 0)
+  const LightUploadRange range = lightPublishTracker_.takePointLightUpload();
+  const std::vector<PointLightData> &pointLights = pointLightsSsbo();
+  const uint32_t count = std::min(static_cast<uint32_t>(pointLights.size()),
+                                  kMaxClusteredLights);
+  const uint32_t end = std::min(range.end(), count);
+  if (range.first >= end)
     return;
-  SceneController::writeToBuffer(allocationManager_, lightSsbo_,
-                                 pointLightsSsbo_.data(),
-                                 sizeof(PointLightData) * count);
+  SceneController::writeToBuffer(
+      allocationManager_, lightSsbo_, pointLights.data() + range.first,
+      sizeof(PointLightData) * (end - range.first),
+      sizeof(PointLightData) * range.first);
 }
 
 void LightingManager::uploadAreaLightSsbo() const {
   if (areaLightSsbo_.buffer == VK_NULL_HANDLE)
     return;
+  const LightUploadRange range = lightPublishTracker_.takeAreaLightUpload();
   const uint32_t count =
       std::min(static_cast<uint32_t>(areaLightsSsbo_.size()), kMaxAreaLights);
-  if (count == 0)
+  const uint32_t end = std::min(range.end(), count);
+  if (range.first >= end)
     return;
-  SceneController::writeToBuffer(allocationManager_, areaLightSsbo_,
-                                 areaLightsSsbo_.data(),
-                                 sizeof(AreaLightData) * count);
+  SceneController::writeToBuffer(
+      allocationManager_, areaLightSsbo_, areaLightsSsbo_.data() + range.first,
+      sizeof(AreaLightData) * (end - range.first),
+      sizeof(AreaLightData) * range.first);
 }
 
 void LightingManager::dispatchTileCull(VkCommandBuffer cmd,
@@ -1398,7 +1478,7 @@ void LightingManager::dispatchTileCull(VkCommandBuffer cmd,
   const uint32_t tileCountY =
       std::max(1u, (screenExtent.height + kTileSize - 1u) / kTileSize);
   const uint32_t totalLights = std::min(
-      static_cast<uint32_t>(pointLightsSsbo_.size()), kMaxClusteredLights);
+      static_cast<uint32_t>(pointLightsSsbo().size()), kMaxClusteredLights);
   lastDispatchClusterCount_ = tileCountX * tileCountY * kClusterDepthSlices;
   if (lastDispatchClusterCount_ > maxClusterCount_ ||
       tileGridSsbo_.buffer == VK_NULL_HANDLE ||
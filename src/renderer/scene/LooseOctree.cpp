@@ -0,0 +1,622 @@
+#include "Container/renderer/scene/LooseOctree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CONTAINER_LOOSE_OCTREE_SSE2 1
+#endif
+
+namespace container::renderer {
+
+namespace {
+
+constexpr uint32_t kAllLanes = 0xfu;
+// Traversal stack entries carry "node is fully inside the query" in the top
+// bit so the subtree is emitted without per-box tests.
+constexpr uint32_t kInsideBit = 0x80000000u;
+
+// Four boxes' worth of one coordinate.  Every query is written once against
+// these helpers; the SSE2 build maps them to single instructions.
+#if defined(CONTAINER_LOOSE_OCTREE_SSE2)
+struct Lanes {
+  __m128 value;
+};
+
+[[nodiscard]] Lanes load(const std::array<float, 4> &values) {
+  return {_mm_loadu_ps(values.data())};
+}
+[[nodiscard]] Lanes splat(float value) { return {_mm_set1_ps(value)}; }
+[[nodiscard]] Lanes operator+(Lanes a, Lanes b) {
+  return {_mm_add_ps(a.value, b.value)};
+}
+[[nodiscard]] Lanes operator-(Lanes a, Lanes b) {
+  return {_mm_sub_ps(a.value, b.value)};
+}
+[[nodiscard]] Lanes operator*(Lanes a, Lanes b) {
+  return {_mm_mul_ps(a.value, b.value)};
+}
+[[nodiscard]] Lanes min(Lanes a, Lanes b) {
+  return {_mm_min_ps(a.value, b.value)};
+}
+[[nodiscard]] Lanes max(Lanes a, Lanes b) {
+  return {_mm_max_ps(a.value, b.value)};
+}
+// Bit i is set where a[i] <= b[i].
+[[nodiscard]] uint32_t lessEqual(Lanes a, Lanes b) {
+  return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(a.value, b.value)));
+}
+void store(Lanes lanes, std::array<float, 4> &out) {
+  _mm_storeu_ps(out.data(), lanes.value);
+}
+#else
+struct Lanes {
+  std::array<float, 4> value;
+};
+
+template <typename Op>
+[[nodiscard]] Lanes apply(Lanes a, Lanes b, Op op) {
+  Lanes result{};
+  for (size_t lane = 0; lane < 4u; ++lane) {
+    result.value[lane] = op(a.value[lane], b.value[lane]);
+  }
+  return result;
+}
+
+[[nodiscard]] Lanes load(const std::array<float, 4> &values) {
+  return {values};
+}
+[[nodiscard]] Lanes splat(float value) { return {{value, value, value, value}}; }
+[[nodiscard]] Lanes operator+(Lanes a, Lanes b) {
+  return apply(a, b, [](float x, float y) { return x + y; });
+}
+[[nodiscard]] Lanes operator-(Lanes a, Lanes b) {
+  return apply(a, b, [](float x, float y) { return x - y; });
+}
+[[nodiscard]] Lanes operator*(Lanes a, Lanes b) {
+  return apply(a, b, [](float x, float y) { return x * y; });
+}
+[[nodiscard]] Lanes min(Lanes a, Lanes b) {
+  return apply(a, b, [](float x, float y) { return x < y ? x : y; });
+}
+[[nodiscard]] Lanes max(Lanes a, Lanes b) {
+  return apply(a, b, [](float x, float y) { return x > y ? x : y; });
+}
+[[nodiscard]] uint32_t lessEqual(Lanes a, Lanes b) {
+  uint32_t mask = 0u;
+  for (size_t lane = 0; lane < 4u; ++lane) {
+    mask |= a.value[lane] <= b.value[lane] ? 1u << lane : 0u;
+  }
+  return mask;
+}
+void store(Lanes lanes, std::array<float, 4> &out) { out = lanes.value; }
+#endif
+
+template <typename Block>
+[[nodiscard]] uint32_t boxOverlapMask(const Block &block,
+                                      const LooseOctreeBounds &box) {
+  return lessEqual(load(block.minX), splat(box.max.x)) &
+         lessEqual(load(block.minY), splat(box.max.y)) &
+         lessEqual(load(block.minZ), splat(box.max.z)) &
+         lessEqual(splat(box.min.x), load(block.maxX)) &
+         lessEqual(splat(box.min.y), load(block.maxY)) &
+         lessEqual(splat(box.min.z), load(block.maxZ));
+}
+
+template <typename Block>
+[[nodiscard]] uint32_t sphereOverlapMask(const Block &block,
+                                         const glm::vec3 &center,
+                                         float radius) {
+  const Lanes zero = splat(0.0f);
+  auto axisGap = [&](const std::array<float, 4> &lo,
+                     const std::array<float, 4> &hi, float c) {
+    const Lanes value = splat(c);
+    return max(max(load(lo) - value, value - load(hi)), zero);
+  };
+  const Lanes dx = axisGap(block.minX, block.maxX, center.x);
+  const Lanes dy = axisGap(block.minY, block.maxY, center.y);
+  const Lanes dz = axisGap(block.minZ, block.maxZ, center.z);
+  return lessEqual(dx * dx + dy * dy + dz * dz, splat(radius * radius));
+}
+
+// Signed distances of the farthest (hi) and nearest (lo) corner of each box
+// along the plane normal.
+template <typename Block>
+void planeCornerDistances(const Block &block, const glm::vec4 &plane,
+                          Lanes &lo, Lanes &hi) {
+  const Lanes nx = splat(plane.x);
+  const Lanes ny = splat(plane.y);
+  const Lanes nz = splat(plane.z);
+  const Lanes x0 = nx * load(block.minX);
+  const Lanes x1 = nx * load(block.maxX);
+  const Lanes y0 = ny * load(block.minY);
+  const Lanes y1 = ny * load(block.maxY);
+  const Lanes z0 = nz * load(block.minZ);
+  const Lanes z1 = nz * load(block.maxZ);
+  const Lanes d = splat(plane.w);
+  hi = max(x0, x1) + max(y0, y1) + max(z0, z1) + d;
+  lo = min(x0, x1) + min(y0, y1) + min(z0, z1) + d;
+}
+
+template <typename Block>
+[[nodiscard]] uint32_t frustumMask(const Block &block,
+                                   std::span<const glm::vec4> planes) {
+  const Lanes zero = splat(0.0f);
+  uint32_t mask = kAllLanes;
+  for (const glm::vec4 &plane : planes) {
+    Lanes lo{};
+    Lanes hi{};
+    planeCornerDistances(block, plane, lo, hi);
+    mask &= lessEqual(zero, hi);
+    if (mask == 0u) {
+      break;
+    }
+  }
+  return mask;
+}
+
+template <typename Block>
+[[nodiscard]] uint32_t planeCrossingMask(const Block &block,
+                                         const glm::vec4 &plane) {
+  const Lanes zero = splat(0.0f);
+  Lanes lo{};
+  Lanes hi{};
+  planeCornerDistances(block, plane, lo, hi);
+  return lessEqual(zero, hi) & lessEqual(lo, zero);
+}
+
+struct RaySetup {
+  glm::vec3 origin{0.0f};
+  glm::vec3 inverseDirection{0.0f};
+  float maxDistance{0.0f};
+};
+
+// Axis-parallel rays get a huge but finite reciprocal so the slab products
+// never turn into 0 * inf.
+[[nodiscard]] float safeReciprocal(float value) {
+  constexpr float kTiny = 1.0e-20f;
+  return std::abs(value) > kTiny ? 1.0f / value : std::copysign(1.0e20f, value);
+}
+
+template <typename Block>
+[[nodiscard]] uint32_t rayMask(const Block &block, const RaySetup &ray,
+                               std::array<float, 4> &entryDistance) {
+  auto slab = [](const std::array<float, 4> &lo, const std::array<float, 4> &hi,
+                 float origin, float inverse, Lanes &nearT, Lanes &farT) {
+    const Lanes o = splat(origin);
+    const Lanes inv = splat(inverse);
+    const Lanes t0 = (load(lo) - o) * inv;
+    const Lanes t1 = (load(hi) - o) * inv;
+    nearT = max(nearT, min(t0, t1));
+    farT = min(farT, max(t0, t1));
+  };
+  Lanes nearT = splat(0.0f);
+  Lanes farT = splat(ray.maxDistance);
+  slab(block.minX, block.maxX, ray.origin.x, ray.inverseDirection.x, nearT,
+       farT);
+  slab(block.minY, block.maxY, ray.origin.y, ray.inverseDirection.y, nearT,
+       farT);
+  slab(block.minZ, block.maxZ, ray.origin.z, ray.inverseDirection.z, nearT,
+       farT);
+  store(nearT, entryDistance);
+  return lessEqual(nearT, farT);
+}
+
+[[nodiscard]] glm::vec3 boxCenter(const LooseOctreeBounds &bounds) {
+  return (bounds.min + bounds.max) * 0.5f;
+}
+
+[[nodiscard]] float boxExtent(const LooseOctreeBounds &bounds) {
+  const glm::vec3 half = (bounds.max - bounds.min) * 0.5f;
+  return std::max({half.x, half.y, half.z});
+}
+
+[[nodiscard]] bool isFinite(const glm::vec3 &value) {
+  return std::isfinite(value.x) && std::isfinite(value.y) &&
+         std::isfinite(value.z);
+}
+
+[[nodiscard]] bool insideCell(const glm::vec3 &point, const glm::vec3 &center,
+                              float halfSize) {
+  const glm::vec3 offset = glm::abs(point - center);
+  return offset.x <= halfSize && offset.y <= halfSize && offset.z <= halfSize;
+}
+
+// Corner of `box` farthest along `normal`; the nearest corner is the
+// farthest along -normal.
+[[nodiscard]] glm::vec3 farthestCorner(const LooseOctreeBounds &box,
+                                       const glm::vec3 &normal) {
+  return {normal.x >= 0.0f ? box.max.x : box.min.x,
+          normal.y >= 0.0f ? box.max.y : box.min.y,
+          normal.z >= 0.0f ? box.max.z : box.min.z};
+}
+
+[[nodiscard]] glm::vec3 nearestCorner(const LooseOctreeBounds &box,
+                                      const glm::vec3 &normal) {
+  return {normal.x >= 0.0f ? box.min.x : box.max.x,
+          normal.y >= 0.0f ? box.min.y : box.max.y,
+          normal.z >= 0.0f ? box.min.z : box.max.z};
+}
+
+// Per-node lane writes; BoxBlock is private to the octree, so these stay
+// templated like the query helpers.
+template <typename Block>
+void writeLane(Block &block, uint32_t lane, const LooseOctreeBounds &bounds) {
+  block.minX[lane] = bounds.min.x;
+  block.minY[lane] = bounds.min.y;
+  block.minZ[lane] = bounds.min.z;
+  block.maxX[lane] = bounds.max.x;
+  block.maxY[lane] = bounds.max.y;
+  block.maxZ[lane] = bounds.max.z;
+}
+
+template <typename Block>
+[[nodiscard]] LooseOctreeBounds readLane(const Block &block, uint32_t lane) {
+  return {.min = {block.minX[lane], block.minY[lane], block.minZ[lane]},
+          .max = {block.maxX[lane], block.maxY[lane], block.maxZ[lane]}};
+}
+
+} // namespace
+
+LooseOctree::LooseOctree(const LooseOctreeBounds &worldBounds,
+                         uint32_t maxDepth) {
+  reset(worldBounds, maxDepth);
+}
+
+void LooseOctree::reset(const LooseOctreeBounds &worldBounds,
+                        uint32_t maxDepth) {
+  nodes_.clear();
+  items_.clear();
+  itemCount_ = 0u;
+  inPlaceMoves_ = 0u;
+  relinkedMoves_ = 0u;
+  worldBounds_ = worldBounds;
+  maxDepth_ = std::min(maxDepth, kMaxDepthLimit);
+
+  Node root{};
+  const glm::vec3 center = boxCenter(worldBounds);
+  const float halfSize = boxExtent(worldBounds);
+  const bool usable =
+      isFinite(center) && std::isfinite(halfSize) && halfSize > 0.0f;
+  root.center = usable ? center : glm::vec3(0.0f);
+  root.halfSize = usable ? halfSize : 1.0f;
+  nodes_.push_back(std::move(root));
+}
+
+void LooseOctree::clear() { reset(worldBounds_, maxDepth_); }
+
+void LooseOctree::insert(uint32_t id, const LooseOctreeBounds &bounds) {
+  if (contains(id)) {
+    throw std::invalid_argument("loose octree id is already present");
+  }
+  if (nodes_.empty()) {
+    reset(worldBounds_, maxDepth_);
+  }
+  if (id >= items_.size()) {
+    items_.resize(static_cast<size_t>(id) + 1u);
+  }
+  link(id, targetNode(bounds), bounds);
+  ++itemCount_;
+}
+
+void LooseOctree::move(uint32_t id, const LooseOctreeBounds &bounds) {
+  if (!contains(id)) {
+    throw std::out_of_range("loose octree id is not present");
+  }
+  const ItemSlot item = items_[id];
+  Node &node = nodes_[item.node];
+  if (staysInNode(node, bounds)) {
+    writeLane(node.boxes[item.slot / 4u], item.slot % 4u, bounds);
+    ++inPlaceMoves_;
+    return;
+  }
+  unlink(id);
+  link(id, targetNode(bounds), bounds);
+  ++relinkedMoves_;
+}
+
+bool LooseOctree::remove(uint32_t id) {
+  if (!contains(id)) {
+    return false;
+  }
+  unlink(id);
+  --itemCount_;
+  return true;
+}
+
+LooseOctreeBounds LooseOctree::bounds(uint32_t id) const {
+  if (!contains(id)) {
+    throw std::out_of_range("loose octree id is not present");
+  }
+  const ItemSlot item = items_[id];
+  return readLane(nodes_[item.node].boxes[item.slot / 4u], item.slot % 4u);
+}
+
+LooseOctreeStats LooseOctree::stats() const {
+  LooseOctreeStats stats{};
+  stats.itemCount = itemCount_;
+  stats.nodeCount = nodes_.size();
+  for (const Node &node : nodes_) {
+    if (!node.ids.empty()) {
+      stats.deepestOccupiedDepth =
+          std::max(stats.deepestOccupiedDepth, node.depth);
+    }
+  }
+  stats.inPlaceMoves = inPlaceMoves_;
+  stats.relinkedMoves = relinkedMoves_;
+  return stats;
+}
+
+uint32_t LooseOctree::targetNode(const LooseOctreeBounds &bounds) {
+  const glm::vec3 center = boxCenter(bounds);
+  const float extent = boxExtent(bounds);
+  if (!isFinite(center) || !std::isfinite(extent) ||
+      !insideCell(center, nodes_.front().center, nodes_.front().halfSize)) {
+    return 0u;
+  }
+
+  uint32_t nodeIndex = 0u;
+  while (nodes_[nodeIndex].depth < maxDepth_) {
+    const Node &node = nodes_[nodeIndex];
+    const float childHalf = node.halfSize * 0.5f;
+    if (extent > childHalf) {
+      break;
+    }
+    const uint32_t octant = (center.x >= node.center.x ? 1u : 0u) |
+                            (center.y >= node.center.y ? 2u : 0u) |
+                            (center.z >= node.center.z ? 4u : 0u);
+    uint32_t child = node.children[octant];
+    if (child == kInvalid) {
+      Node created{};
+      created.center =
+          node.center + glm::vec3((octant & 1u) != 0u ? childHalf : -childHalf,
+                                  (octant & 2u) != 0u ? childHalf : -childHalf,
+                                  (octant & 4u) != 0u ? childHalf : -childHalf);
+      created.halfSize = childHalf;
+      created.parent = nodeIndex;
+      created.depth = node.depth + 1u;
+      child = static_cast<uint32_t>(nodes_.size());
+      // `node` dangles once nodes_ grows.
+      nodes_[nodeIndex].children[octant] = child;
+      nodes_.push_back(std::move(created));
+    }
+    nodeIndex = child;
+  }
+  return nodeIndex;
+}
+
+bool LooseOctree::staysInNode(const Node &node,
+                              const LooseOctreeBounds &bounds) const {
+  const glm::vec3 center = boxCenter(bounds);
+  const float extent = boxExtent(bounds);
+  const bool isRoot = node.parent == kInvalid;
+  if (!isFinite(center) || !std::isfinite(extent)) {
+    return isRoot;
+  }
+  if (!insideCell(center, node.center, node.halfSize)) {
+    // Only the root keeps boxes centred outside its cell.
+    return isRoot;
+  }
+  if (!isRoot && extent > node.halfSize) {
+    return false;
+  }
+  // Stay unless the box would now fit one level deeper.
+  return node.depth >= maxDepth_ || extent > node.halfSize * 0.5f;
+}
+
+void LooseOctree::link(uint32_t id, uint32_t nodeIndex,
+                       const LooseOctreeBounds &bounds) {
+  Node &node = nodes_[nodeIndex];
+  const auto slot = static_cast<uint32_t>(node.ids.size());
+  node.ids.push_back(id);
+  if (slot % 4u == 0u) {
+    node.boxes.emplace_back();
+  }
+  writeLane(node.boxes[slot / 4u], slot % 4u, bounds);
+  items_[id] = {.node = nodeIndex, .slot = slot};
+  adjustSubtreeCounts(nodeIndex, 1);
+}
+
+void LooseOctree::unlink(uint32_t id) {
+  const ItemSlot item = items_[id];
+  Node &node = nodes_[item.node];
+  const auto last = static_cast<uint32_t>(node.ids.size() - 1u);
+  if (item.slot != last) {
+    const uint32_t moved = node.ids[last];
+    node.ids[item.slot] = moved;
+    writeLane(node.boxes[item.slot / 4u], item.slot % 4u,
+              readLane(node.boxes[last / 4u], last % 4u));
+    items_[moved].slot = item.slot;
+  }
+  node.ids.pop_back();
+  if (node.ids.size() % 4u == 0u) {
+    node.boxes.pop_back();
+  }
+  items_[id] = {};
+  adjustSubtreeCounts(item.node, -1);
+}
+
+void LooseOctree::adjustSubtreeCounts(uint32_t nodeIndex, int32_t delta) {
+  while (nodeIndex != kInvalid) {
+    Node &node = nodes_[nodeIndex];
+    node.subtreeItemCount =
+        static_cast<uint32_t>(static_cast<int64_t>(node.subtreeItemCount) +
+                              delta);
+    nodeIndex = node.parent;
+  }
+}
+
+template <typename NodeTest, typename VisitBlock>
+void LooseOctree::traverse(const NodeTest &nodeTest,
+                           const VisitBlock &visitBlock) const {
+  if (itemCount_ == 0u) {
+    return;
+  }
+  traversalStack_.clear();
+  traversalStack_.push_back(0u);
+  while (!traversalStack_.empty()) {
+    const uint32_t entry = traversalStack_.back();
+    traversalStack_.pop_back();
+    const uint32_t nodeIndex = entry & ~kInsideBit;
+    const Node &node = nodes_[nodeIndex];
+    bool inside = (entry & kInsideBit) != 0u;
+    // The root may hold boxes outside its loose bounds, so it is never
+    // rejected as a whole.
+    if (!inside && nodeIndex != 0u) {
+      const glm::vec3 extent(node.halfSize * 2.0f);
+      const Overlap overlap = nodeTest(LooseOctreeBounds{
+          .min = node.center - extent, .max = node.center + extent});
+      if (overlap == Overlap::Outside) {
+        continue;
+      }
+      inside = overlap == Overlap::Inside;
+    }
+
+    const auto count = static_cast<uint32_t>(node.ids.size());
+    for (uint32_t block = 0u; block * 4u < count; ++block) {
+      visitBlock(node, block, std::min(count - block * 4u, 4u), inside);
+    }
+    for (const uint32_t child : node.children) {
+      if (child != kInvalid && nodes_[child].subtreeItemCount > 0u) {
+        traversalStack_.push_back(child | (inside ? kInsideBit : 0u));
+      }
+    }
+  }
+}
+
+void LooseOctree::queryFrustum(std::span<const glm::vec4> planes,
+                               std::vector<uint32_t> &out) const {
+  traverse(
+      [&](const LooseOctreeBounds &cell) {
+        bool inside = true;
+        for (const glm::vec4 &plane : planes) {
+          const glm::vec3 normal(plane);
+          if (glm::dot(normal, farthestCorner(cell, normal)) + plane.w <
+              0.0f) {
+            return Overlap::Outside;
+          }
+          inside = inside &&
+                   glm::dot(normal, nearestCorner(cell, normal)) + plane.w >=
+                       0.0f;
+        }
+        return inside ? Overlap::Inside : Overlap::Partial;
+      },
+      [&](const Node &node, uint32_t block, uint32_t laneCount, bool inside) {
+        const uint32_t mask =
+            inside ? kAllLanes : frustumMask(node.boxes[block], planes);
+        for (uint32_t lane = 0u; lane < laneCount; ++lane) {
+          if ((mask & (1u << lane)) != 0u) {
+            out.push_back(node.ids[block * 4u + lane]);
+          }
+        }
+      });
+}
+
+void LooseOctree::querySphere(const glm::vec3 &center, float radius,
+                              std::vector<uint32_t> &out) const {
+  traverse(
+      [&](const LooseOctreeBounds &cell) {
+        const glm::vec3 gap =
+            glm::max(glm::max(cell.min - center, center - cell.max), 0.0f);
+        if (glm::dot(gap, gap) > radius * radius) {
+          return Overlap::Outside;
+        }
+        const glm::vec3 reach =
+            glm::max(glm::abs(cell.min - center), glm::abs(cell.max - center));
+        return glm::dot(reach, reach) <= radius * radius ? Overlap::Inside
+                                                         : Overlap::Partial;
+      },
+      [&](const Node &node, uint32_t block, uint32_t laneCount, bool inside) {
+        const uint32_t mask =
+            inside ? kAllLanes
+                   : sphereOverlapMask(node.boxes[block], center, radius);
+        for (uint32_t lane = 0u; lane < laneCount; ++lane) {
+          if ((mask & (1u << lane)) != 0u) {
+            out.push_back(node.ids[block * 4u + lane]);
+          }
+        }
+      });
+}
+
+void LooseOctree::queryBox(const LooseOctreeBounds &box,
+                           std::vector<uint32_t> &out) const {
+  traverse(
+      [&](const LooseOctreeBounds &cell) {
+        if (cell.min.x > box.max.x || cell.min.y > box.max.y ||
+            cell.min.z > box.max.z || cell.max.x < box.min.x ||
+            cell.max.y < box.min.y || cell.max.z < box.min.z) {
+          return Overlap::Outside;
+        }
+        const bool inside =
+            cell.min.x >= box.min.x && cell.min.y >= box.min.y &&
+            cell.min.z >= box.min.z && cell.max.x <= box.max.x &&
+            cell.max.y <= box.max.y && cell.max.z <= box.max.z;
+        return inside ? Overlap::Inside : Overlap::Partial;
+      },
+      [&](const Node &node, uint32_t block, uint32_t laneCount, bool inside) {
+        const uint32_t mask =
+            inside ? kAllLanes : boxOverlapMask(node.boxes[block], box);
+        for (uint32_t lane = 0u; lane < laneCount; ++lane) {
+          if ((mask & (1u << lane)) != 0u) {
+            out.push_back(node.ids[block * 4u + lane]);
+          }
+        }
+      });
+}
+
+void LooseOctree::queryPlane(const glm::vec4 &plane,
+                             std::vector<uint32_t> &out) const {
+  const glm::vec3 normal(plane);
+  traverse(
+      [&](const LooseOctreeBounds &cell) {
+        const float hi =
+            glm::dot(normal, farthestCorner(cell, normal)) + plane.w;
+        const float lo =
+            glm::dot(normal, nearestCorner(cell, normal)) + plane.w;
+        return hi < 0.0f || lo > 0.0f ? Overlap::Outside : Overlap::Partial;
+      },
+      [&](const Node &node, uint32_t block, uint32_t laneCount, bool) {
+        const uint32_t mask = planeCrossingMask(node.boxes[block], plane);
+        for (uint32_t lane = 0u; lane < laneCount; ++lane) {
+          if ((mask & (1u << lane)) != 0u) {
+            out.push_back(node.ids[block * 4u + lane]);
+          }
+        }
+      });
+}
+
+void LooseOctree::queryRay(const glm::vec3 &origin, const glm::vec3 &direction,
+                           float maxDistance,
+                           std::vector<LooseOctreeRayHit> &out) const {
+  const RaySetup ray{.origin = origin,
+                     .inverseDirection = {safeReciprocal(direction.x),
+                                          safeReciprocal(direction.y),
+                                          safeReciprocal(direction.z)},
+                     .maxDistance = maxDistance};
+  traverse(
+      [&](const LooseOctreeBounds &cell) {
+        const glm::vec3 t0 = (cell.min - ray.origin) * ray.inverseDirection;
+        const glm::vec3 t1 = (cell.max - ray.origin) * ray.inverseDirection;
+        const glm::vec3 nearT = glm::min(t0, t1);
+        const glm::vec3 farT = glm::max(t0, t1);
+        const float entry = std::max({nearT.x, nearT.y, nearT.z, 0.0f});
+        const float exit = std::min({farT.x, farT.y, farT.z, ray.maxDistance});
+        return entry <= exit ? Overlap::Partial : Overlap::Outside;
+      },
+      [&](const Node &node, uint32_t block, uint32_t laneCount, bool) {
+        std::array<float, 4> entry{};
+        const uint32_t mask = rayMask(node.boxes[block], ray, entry);
+        for (uint32_t lane = 0u; lane < laneCount; ++lane) {
+          if ((mask & (1u << lane)) != 0u) {
+            out.push_back({.id = node.ids[block * 4u + lane],
+                           .distance = entry[lane]});
+          }
+        }
+      });
+}
+
+} // namespace container::renderer
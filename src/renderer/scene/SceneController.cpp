@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <cstring>
 #include <limits>
 #include <span>
@@ -277,7 +278,8 @@ void SceneController::writeToBuffer(
     container::gpu::AllocationManager&      allocationManager,
     const container::gpu::AllocatedBuffer&  buffer,
     const void*                              data,
-    size_t                                   size) {
+    size_t                                   size,
+    size_t                                   offset) {
   void* mapped = buffer.allocation_info.pMappedData;
   bool  mappedHere = false;
   if (mapped == nullptr) {
@@ -288,9 +290,9 @@ void SceneController::writeToBuffer(
     mappedHere = true;
   }
 
-  std::memcpy(mapped, data, size);
+  std::memcpy(static_cast<std::byte*>(mapped) + offset, data, size);
   if (vmaFlushAllocation(allocationManager.memoryManager()->allocator(),
-                         buffer.allocation, 0,
+                         buffer.allocation, static_cast<VkDeviceSize>(offset),
                          static_cast<VkDeviceSize>(size)) != VK_SUCCESS) {
     if (mappedHere) {
       vmaUnmapMemory(allocationManager.memoryManager()->allocator(),
@@ -396,6 +398,7 @@ void SceneController::syncObjectDataFromSceneGraph(bool showDiagCube) {
 
   objectData_.clear();
   objectNodeIndices_.clear();
+  objectPickRanges_.clear();
   opaqueDrawCommands_.clear();
   transparentDrawCommands_.clear();
   opaqueSingleSidedDrawCommands_.clear();
@@ -407,6 +410,7 @@ void SceneController::syncObjectDataFromSceneGraph(bool showDiagCube) {
   const uint32_t renderableCount = world_->renderableCount();
   objectData_.reserve(renderableCount);
   objectNodeIndices_.reserve(renderableCount);
+  objectPickRanges_.reserve(renderableCount);
   opaqueDrawCommands_.reserve(renderableCount);
   transparentDrawCommands_.reserve(renderableCount);
   opaqueSingleSidedDrawCommands_.reserve(renderableCount);
@@ -471,6 +475,12 @@ void SceneController::syncObjectDataFromSceneGraph(bool showDiagCube) {
             static_cast<uint32_t>(objectData_.size());
         objectData_.push_back(object);
         objectNodeIndices_.push_back(nodeRef.nodeIndex);
+        objectPickRanges_.push_back({.firstIndex = primitive.firstIndex,
+                                     .indexCount = primitive.indexCount,
+                                     .pickable = true,
+                                     .transparent = materialTransparent,
+                                     .doubleSided = rasterDoubleSided,
+                                     .windingFlipped = windingFlipped});
 
         DrawCommand drawCommand{};
         drawCommand.objectIndex = objectIndex;
@@ -523,7 +533,9 @@ void SceneController::syncObjectDataFromSceneGraph(bool showDiagCube) {
     diagCubeObjectIndex_ = static_cast<uint32_t>(objectData_.size());
     objectData_.push_back(cubeObject);
     objectNodeIndices_.push_back(container::scene::SceneGraph::kInvalidNode);
+    objectPickRanges_.push_back({});
   }
+  syncObjectSpatialIndex();
 
   cachedSceneGraphRevision_ = sceneGraph_.revision();
   cachedShowDiagCube_ = showDiagCube;
@@ -532,6 +544,69 @@ void SceneController::syncObjectDataFromSceneGraph(bool showDiagCube) {
   ++objectDataRevision_;
 }
 
+void SceneController::syncObjectSpatialIndex() {
+  auto indexable = [&](uint32_t objectIndex) {
+    const glm::vec4& sphere = objectData_[objectIndex].boundingSphere;
+    return objectPickRanges_[objectIndex].pickable && sphere.w > 0.0f &&
+           std::isfinite(sphere.x) && std::isfinite(sphere.y) &&
+           std::isfinite(sphere.z) && std::isfinite(sphere.w);
+  };
+  auto sphereBounds = [&](uint32_t objectIndex) {
+    const glm::vec4& sphere = objectData_[objectIndex].boundingSphere;
+    return LooseOctreeBounds{.min = glm::vec3(sphere) - glm::vec3(sphere.w),
+                             .max = glm::vec3(sphere) + glm::vec3(sphere.w)};
+  };
+
+  const auto objectCount = static_cast<uint32_t>(objectData_.size());
+  glm::vec3 sceneMin{std::numeric_limits<float>::max()};
+  glm::vec3 sceneMax{std::numeric_limits<float>::lowest()};
+  bool hasBounds = false;
+  for (uint32_t objectIndex = 0u; objectIndex < objectCount; ++objectIndex) {
+    if (indexable(objectIndex)) {
+      const LooseOctreeBounds bounds = sphereBounds(objectIndex);
+      expandBounds(sceneMin, sceneMax, bounds.min);
+      expandBounds(sceneMin, sceneMax, bounds.max);
+      hasBounds = true;
+    }
+  }
+
+  // Re-root only when the scene outgrows the tree; the slack keeps edits
+  // near the edge from rebuilding it on every sync. Otherwise objects are
+  // moved in place, which is O(1) for the ones that did not move far.
+  const LooseOctreeBounds& root = objectOctree_.worldBounds();
+  const bool covered = hasBounds && sceneMin.x >= root.min.x &&
+                       sceneMin.y >= root.min.y && sceneMin.z >= root.min.z &&
+                       sceneMax.x <= root.max.x && sceneMax.y <= root.max.y &&
+                       sceneMax.z <= root.max.z;
+  if (!covered) {
+    const glm::vec3 slack = (sceneMax - sceneMin) * 0.25f + glm::vec3(1.0f);
+    objectOctree_.reset(hasBounds ? LooseOctreeBounds{.min = sceneMin - slack,
+                                                      .max = sceneMax + slack}
+                                  : LooseOctreeBounds{});
+  }
+
+  unboundedPickObjects_.clear();
+  for (uint32_t objectIndex = 0u; objectIndex < objectCount; ++objectIndex) {
+    if (indexable(objectIndex)) {
+      if (objectOctree_.contains(objectIndex)) {
+        objectOctree_.move(objectIndex, sphereBounds(objectIndex));
+      } else {
+        objectOctree_.insert(objectIndex, sphereBounds(objectIndex));
+      }
+      continue;
+    }
+    objectOctree_.remove(objectIndex);
+    if (objectPickRanges_[objectIndex].pickable) {
+      unboundedPickObjects_.push_back(objectIndex);
+    }
+  }
+  for (size_t objectIndex = objectCount; objectIndex < indexedObjectCount_;
+       ++objectIndex) {
+    objectOctree_.remove(static_cast<uint32_t>(objectIndex));
+  }
+  indexedObjectCount_ = objectCount;
+}
+
 // ---------------------------------------------------------------------------
 // updateObjectBuffer
 // ---------------------------------------------------------------------------
@@ -619,119 +694,93 @@ SceneNodePickHit SceneController::pickRenderableNodeHitForDraws(
   const auto& vertices = sceneManager_.vertices();
   const auto& indices = sceneManager_.indices();
   SceneNodePickHit nearest{};
-  auto testDrawCommands = [&](const std::vector<DrawCommand>& commands,
-                              TriangleCullMode cullMode) {
-    for (const DrawCommand& command : commands) {
-      if (command.firstIndex >= indices.size() || command.indexCount < 3u) {
+  auto testObject = [&](uint32_t objectIndex, const ObjectPickRange& range) {
+    if (range.firstIndex >= indices.size() || range.indexCount < 3u) {
+      return;
+    }
+    const uint32_t nodeIndex = objectNodeIndices_[objectIndex];
+    if (nodeIndex == container::scene::SceneGraph::kInvalidNode) {
+      return;
+    }
+
+    const glm::vec4 sphere = objectData_[objectIndex].boundingSphere;
+    float sphereDistance = 0.0f;
+    if (sphere.w > 0.0f &&
+        (!intersectRaySphere(ray.origin, ray.direction, glm::vec3(sphere),
+                             sphere.w, sphereDistance) ||
+         sphereDistance > nearest.distance)) {
+      return;
+    }
+
+    const TriangleCullMode cullMode =
+        range.doubleSided      ? TriangleCullMode::None
+        : range.windingFlipped ? TriangleCullMode::Front
+                               : TriangleCullMode::Back;
+    const size_t firstIndex = range.firstIndex;
+    const size_t endIndex =
+        firstIndex + std::min(static_cast<size_t>(range.indexCount),
+                              indices.size() - firstIndex);
+    const glm::mat4& model = objectData_[objectIndex].model;
+    for (size_t index = firstIndex; index + 2u < endIndex; index += 3u) {
+      const uint32_t i0 = indices[index];
+      const uint32_t i1 = indices[index + 1u];
+      const uint32_t i2 = indices[index + 2u];
+      if (i0 >= vertices.size() || i1 >= vertices.size() ||
+          i2 >= vertices.size()) {
         continue;
       }
-      const size_t firstIndex = command.firstIndex;
-      const size_t indexCount =
-          std::min(static_cast<size_t>(command.indexCount),
-                   indices.size() - firstIndex);
-      const size_t endIndex = firstIndex + indexCount;
-      const uint32_t instanceCount = std::max(command.instanceCount, 1u);
 
-      for (uint32_t instanceOffset = 0u; instanceOffset < instanceCount;
-           ++instanceOffset) {
-        if (command.objectIndex >
-            std::numeric_limits<uint32_t>::max() - instanceOffset) {
-          break;
-        }
-        const uint32_t objectIndex = command.objectIndex + instanceOffset;
-        if (objectIndex >= objectData_.size() ||
-            objectIndex >= objectNodeIndices_.size()) {
-          continue;
-        }
-        const uint32_t nodeIndex = objectNodeIndices_[objectIndex];
-        if (nodeIndex == container::scene::SceneGraph::kInvalidNode) {
-          continue;
-        }
-
-        const glm::vec4 sphere = objectData_[objectIndex].boundingSphere;
-        float sphereDistance = 0.0f;
-        if (sphere.w > 0.0f &&
-            (!intersectRaySphere(ray.origin, ray.direction, glm::vec3(sphere),
-                                 sphere.w, sphereDistance) ||
-             sphereDistance > nearest.distance)) {
+      const glm::vec3 v0 =
+          glm::vec3(model * glm::vec4(vertices[i0].position, 1.0f));
+      const glm::vec3 v1 =
+          glm::vec3(model * glm::vec4(vertices[i1].position, 1.0f));
+      const glm::vec3 v2 =
+          glm::vec3(model * glm::vec4(vertices[i2].position, 1.0f));
+      float hitDistance = 0.0f;
+      if (intersectRayTriangle(ray.origin, ray.direction, v0, v1, v2,
+                               cullMode, hitDistance) &&
+          hitDistance < nearest.distance) {
+        const glm::vec3 hitPosition =
+            ray.origin + ray.direction * hitDistance;
+        if (sectionPlaneClips(hitPosition, sectionPlaneEnabled,
+                              sectionPlane)) {
           continue;
         }
-
-        const glm::mat4& model = objectData_[objectIndex].model;
-        for (size_t index = firstIndex; index + 2u < endIndex; index += 3u) {
-          const uint32_t i0 = indices[index];
-          const uint32_t i1 = indices[index + 1u];
-          const uint32_t i2 = indices[index + 2u];
-          if (i0 >= vertices.size() || i1 >= vertices.size() ||
-              i2 >= vertices.size()) {
-            continue;
-          }
-
-          const glm::vec3 v0 =
-              glm::vec3(model * glm::vec4(vertices[i0].position, 1.0f));
-          const glm::vec3 v1 =
-              glm::vec3(model * glm::vec4(vertices[i1].position, 1.0f));
-          const glm::vec3 v2 =
-              glm::vec3(model * glm::vec4(vertices[i2].position, 1.0f));
-          float hitDistance = 0.0f;
-          if (intersectRayTriangle(ray.origin, ray.direction, v0, v1, v2,
-                                   cullMode, hitDistance) &&
-              hitDistance < nearest.distance) {
-            const glm::vec3 hitPosition =
-                ray.origin + ray.direction * hitDistance;
-            if (sectionPlaneClips(hitPosition, sectionPlaneEnabled,
-                                  sectionPlane)) {
-              continue;
-            }
-            nearest.nodeIndex = nodeIndex;
-            nearest.distance = hitDistance;
-            nearest.depth = projectDepth(cameraData, hitPosition);
-            nearest.worldPosition = hitPosition;
-            nearest.hasWorldPosition = true;
-            nearest.hit = true;
-          }
-        }
+        nearest.nodeIndex = nodeIndex;
+        nearest.distance = hitDistance;
+        nearest.depth = projectDepth(cameraData, hitPosition);
+        nearest.worldPosition = hitPosition;
+        nearest.hasWorldPosition = true;
+        nearest.hit = true;
       }
     }
   };
 
-  const bool hasSplitDrawCommands =
-      !opaqueSingleSidedDrawCommands_.empty() ||
-      !transparentSingleSidedDrawCommands_.empty() ||
-      !opaqueWindingFlippedDrawCommands_.empty() ||
-      !transparentWindingFlippedDrawCommands_.empty() ||
-      !opaqueDoubleSidedDrawCommands_.empty() ||
-      !transparentDoubleSidedDrawCommands_.empty();
-  if (hasSplitDrawCommands) {
-    if (includeOpaque) {
-      testDrawCommands(opaqueSingleSidedDrawCommands_, TriangleCullMode::Back);
-    }
-    if (includeTransparent) {
-      testDrawCommands(transparentSingleSidedDrawCommands_,
-                       TriangleCullMode::Back);
+  // Walk the objects whose bounds the ray enters from near to far and stop
+  // once the next one starts beyond the nearest hit.
+  pickCandidates_.clear();
+  objectOctree_.queryRay(ray.origin, ray.direction,
+                         std::numeric_limits<float>::max(), pickCandidates_);
+  for (const uint32_t objectIndex : unboundedPickObjects_) {
+    pickCandidates_.push_back({.id = objectIndex, .distance = 0.0f});
+  }
+  std::ranges::sort(pickCandidates_, [](const LooseOctreeRayHit& lhs,
+                                        const LooseOctreeRayHit& rhs) {
+    return lhs.distance != rhs.distance ? lhs.distance < rhs.distance
+                                        : lhs.id < rhs.id;
+  });
+  for (const LooseOctreeRayHit& candidate : pickCandidates_) {
+    if (candidate.distance > nearest.distance) {
+      break;
     }
-    if (includeOpaque) {
-      testDrawCommands(opaqueWindingFlippedDrawCommands_,
-                       TriangleCullMode::Front);
-    }
-    if (includeTransparent) {
-      testDrawCommands(transparentWindingFlippedDrawCommands_,
-                       TriangleCullMode::Front);
-    }
-    if (includeOpaque) {
-      testDrawCommands(opaqueDoubleSidedDrawCommands_, TriangleCullMode::None);
-    }
-    if (includeTransparent) {
-      testDrawCommands(transparentDoubleSidedDrawCommands_,
-                       TriangleCullMode::None);
-    }
-  } else {
-    if (includeOpaque) {
-      testDrawCommands(opaqueDrawCommands_, TriangleCullMode::None);
+    if (candidate.id >= objectPickRanges_.size()) {
+      continue;
     }
-    if (includeTransparent) {
-      testDrawCommands(transparentDrawCommands_, TriangleCullMode::None);
+    const ObjectPickRange& range = objectPickRanges_[candidate.id];
+    if (range.transparent ? !includeTransparent : !includeOpaque) {
+      continue;
     }
+    testObject(candidate.id, range);
   }
 
   return nearest;
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <initializer_list>
 #include <utility>
 
 namespace container::renderer {
@@ -218,6 +219,19 @@ uint64_t ShadowCascadeDrawPlanner::signature() const {
 
 ShadowCascadeDrawPlan ShadowCascadeDrawPlanner::build() const {
   ShadowCascadeDrawPlan plan{};
+  build(plan);
+  return plan;
+}
+
+void ShadowCascadeDrawPlanner::build(ShadowCascadeDrawPlan &plan) const {
+  for (auto *lists :
+       {&plan.sceneSingleSided, &plan.sceneWindingFlipped,
+        &plan.sceneDoubleSided, &plan.bimSingleSided, &plan.bimWindingFlipped,
+        &plan.bimDoubleSided}) {
+    for (std::vector<DrawCommand> &commands : *lists) {
+      commands.clear();
+    }
+  }
   plan.signature = signature();
 
   filterCommands(inputs_, inputs_.sceneDraws.singleSided, inputs_.scene,
@@ -244,8 +258,6 @@ ShadowCascadeDrawPlan ShadowCascadeDrawPlanner::build() const {
                      plan.bimDoubleSided, false);
     }
   }
-
-  return plan;
 }
 
 uint64_t computeShadowCascadeDrawSignature(
@@ -416,7 +416,7 @@ void ShadowCascadeFramePassRecorder::prepareDrawCommands(
     return;
   }
 
-  drawPlanCache_ = planner.build();
+  planner.build(drawPlanCache_);
   drawCommandCacheValid_ = true;
 }
 
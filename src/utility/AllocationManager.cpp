@@ -131,6 +131,49 @@ AllocatedBuffer AllocationManager::uploadBuffer(
   return buffer;
 }
 
+void AllocationManager::updateBufferRanges(
+    const AllocatedBuffer& buffer, std::span<const BufferRangeWrite> writes) {
+  if (buffer.buffer == VK_NULL_HANDLE) return;
+
+  std::vector<std::byte> packed;
+  std::vector<VkBufferCopy> regions;
+  regions.reserve(writes.size());
+  for (const BufferRangeWrite& write : writes) {
+    if (write.bytes.empty()) continue;
+    VkBufferCopy region{};
+    region.srcOffset = static_cast<VkDeviceSize>(packed.size());
+    region.dstOffset = write.offset;
+    region.size = static_cast<VkDeviceSize>(write.bytes.size());
+    regions.push_back(region);
+    packed.insert(packed.end(), write.bytes.begin(), write.bytes.end());
+  }
+  if (regions.empty()) return;
+
+  StagingBuffer stagingBuffer(*memoryManager_,
+                              static_cast<VkDeviceSize>(packed.size()));
+  stagingBuffer.upload(packed);
+
+  VkCommandBuffer cmd = beginSingleTimeCommands();
+  // The buffer is already bound as vertex or index input by earlier draws;
+  // their reads have to finish before the copy overwrites the ranges.
+  VkBufferMemoryBarrier inputReadsDone{};
+  inputReadsDone.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+  inputReadsDone.srcAccessMask =
+      VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT;
+  inputReadsDone.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+  inputReadsDone.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+  inputReadsDone.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+  inputReadsDone.buffer = buffer.buffer;
+  inputReadsDone.offset = 0;
+  inputReadsDone.size = VK_WHOLE_SIZE;
+  vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+                       VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 1,
+                       &inputReadsDone, 0, nullptr);
+  vkCmdCopyBuffer(cmd, stagingBuffer.buffer().buffer, buffer.buffer,
+                  static_cast<uint32_t>(regions.size()), regions.data());
+  endSingleTimeCommands(cmd);
+}
+
 AllocatedBuffer AllocationManager::createBuffer(
     VkDeviceSize size, VkBufferUsageFlags usage, VmaMemoryUsage memoryUsage,
     VmaAllocationCreateFlags allocationFlags, VkSharingMode sharingMode) {
@@ -29,6 +29,7 @@
 #include <string>
 #include <string_view>
 #include <system_error>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -247,6 +248,33 @@ void RefreshSceneHierarchyParentCandidateCache(
   }
 }
 
+// Submits only the rows of a list that fall inside its visible region. Rows
+// must share one height, since the clipper measures the first row only; in a
+// table `drawRow(row)` starts with ImGui::TableNextRow().
+template <typename DrawRow>
+void DrawClippedRows(size_t rowCount, DrawRow &&drawRow) {
+  ImGuiListClipper clipper;
+  clipper.Begin(GuiClipperItemCount(rowCount));
+  while (clipper.Step()) {
+    for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+      drawRow(static_cast<size_t>(row));
+    }
+  }
+}
+
+// Copies the primary sort column of the current table into `key`.
+void ReadTableSortSpecs(GuiTableRowKey &key) {
+  const ImGuiTableSortSpecs *specs = ImGui::TableGetSortSpecs();
+  if (specs == nullptr || specs->SpecsCount <= 0) {
+    key.sortColumn = -1;
+    key.sortDescending = false;
+    return;
+  }
+  key.sortColumn = specs->Specs[0].ColumnIndex;
+  key.sortDescending =
+      specs->Specs[0].SortDirection == ImGuiSortDirection_Descending;
+}
+
 struct SceneHierarchyPanelActions {
   uint32_t rootSceneNode{container::scene::SceneGraph::kInvalidNode};
   uint32_t selectedMeshNode{container::scene::SceneGraph::kInvalidNode};
@@ -263,13 +291,6 @@ struct SceneHierarchyParentChange {
   std::optional<uint32_t> parent{};
 };
 
-void DrawSceneHierarchyNode(const container::scene::SceneGraph &sceneGraph,
-                            uint32_t nodeIndex,
-                            const SceneHierarchyPanelActions &actions,
-                            SceneHierarchyParentChange &parentChange,
-                            SceneHierarchyParentCandidateCacheState
-                                &candidateCache);
-
 SceneHierarchyParentChange DrawSceneHierarchyParentCombo(
     const container::scene::SceneGraph &sceneGraph, uint32_t nodeIndex,
     const container::scene::SceneNode &node,
@@ -292,9 +313,7 @@ SceneHierarchyParentChange DrawSceneHierarchyParentCombo(
     RefreshSceneHierarchyParentCandidateCache(sceneGraph, nodeIndex,
                                               currentParent, candidateCache);
     ImGuiListClipper clipper;
-    clipper.Begin(static_cast<int>(std::min<size_t>(
-        candidateCache.rows.size(), static_cast<size_t>(
-                                       std::numeric_limits<int>::max()))));
+    clipper.Begin(GuiClipperItemCount(candidateCache.rows.size()));
     while (clipper.Step() && !change.requested) {
       for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
         const auto &candidate = candidateCache.rows[static_cast<size_t>(row)];
@@ -321,32 +340,78 @@ SceneHierarchyParentChange DrawSceneHierarchyParentCombo(
   return change;
 }
 
-void DrawSceneHierarchyNode(const container::scene::SceneGraph &sceneGraph,
-                            uint32_t nodeIndex,
-                            const SceneHierarchyPanelActions &actions,
-                            SceneHierarchyParentChange &parentChange,
-                            SceneHierarchyParentCandidateCacheState
-                                &candidateCache) {
+void RefreshSceneHierarchyRowCache(
+    const container::scene::SceneGraph &sceneGraph,
+    SceneHierarchyRowCacheState &rowCache) {
+  if (rowCache.expanded.size() != sceneGraph.nodeCount()) {
+    rowCache.expanded.resize(sceneGraph.nodeCount(), 0u);
+    ++rowCache.expansionRevision;
+  }
+  if (rowCache.revision == sceneGraph.revision() &&
+      rowCache.nodeCount == sceneGraph.nodeCount() &&
+      rowCache.rowsExpansionRevision == rowCache.expansionRevision) {
+    return;
+  }
+
+  rowCache.revision = sceneGraph.revision();
+  rowCache.nodeCount = sceneGraph.nodeCount();
+  rowCache.rowsExpansionRevision = rowCache.expansionRevision;
+  static const std::vector<uint32_t> kNoChildren{};
+  GuiFlattenTreeRows(
+      sceneGraph.rootNodes(),
+      [&](uint32_t nodeIndex) -> const std::vector<uint32_t> & {
+        const auto *node = sceneGraph.getNode(nodeIndex);
+        return node != nullptr ? node->children : kNoChildren;
+      },
+      [&](uint32_t nodeIndex) {
+        return nodeIndex < rowCache.expanded.size() &&
+               rowCache.expanded[nodeIndex] != 0u;
+      },
+      rowCache.rows);
+}
+
+void DrawSceneHierarchyRow(const container::scene::SceneGraph &sceneGraph,
+                           const GuiTreeRow &row,
+                           const SceneHierarchyPanelActions &actions,
+                           SceneHierarchyParentChange &parentChange,
+                           SceneHierarchyParentCandidateCacheState
+                               &candidateCache,
+                           SceneHierarchyRowCacheState &rowCache) {
+  const uint32_t nodeIndex = row.node;
+  ImGui::TableNextRow();
   const auto *node = sceneGraph.getNode(nodeIndex);
   if (node == nullptr) {
     return;
   }
 
-  ImGui::TableNextRow();
   ImGui::TableNextColumn();
-  ImGuiTreeNodeFlags flags =
-      ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanFullWidth;
+  ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_OpenOnArrow |
+                             ImGuiTreeNodeFlags_SpanFullWidth |
+                             ImGuiTreeNodeFlags_NoTreePushOnOpen;
   if (node->children.empty()) {
-    flags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+    flags |= ImGuiTreeNodeFlags_Leaf;
   }
   if (nodeIndex == actions.selectedMeshNode) {
     flags |= ImGuiTreeNodeFlags_Selected;
   }
 
+  // Rows are flattened, so depth comes from an explicit indent and the open
+  // state lives in the row cache rather than ImGui's tree storage.
+  const float indent =
+      static_cast<float>(row.depth) * ImGui::GetStyle().IndentSpacing;
+  if (indent > 0.0f) {
+    ImGui::Indent(indent);
+  }
+  const bool expanded = rowCache.expanded[nodeIndex] != 0u;
+  ImGui::SetNextItemOpen(expanded, ImGuiCond_Always);
   const std::string label = SceneHierarchyNodeName(sceneGraph, nodeIndex) +
                             "##SceneHierarchyNode" +
                             std::to_string(nodeIndex);
   const bool open = ImGui::TreeNodeEx(label.c_str(), flags);
+  if (open != expanded && !node->children.empty()) {
+    rowCache.expanded[nodeIndex] = open ? 1u : 0u;
+    ++rowCache.expansionRevision;
+  }
   if (ImGui::IsItemClicked(ImGuiMouseButton_Left) &&
       !ImGui::IsItemToggledOpen() && actions.selectSceneNode != nullptr) {
     (*actions.selectSceneNode)(nodeIndex);
@@ -354,6 +419,9 @@ void DrawSceneHierarchyNode(const container::scene::SceneGraph &sceneGraph,
   if (ImGui::IsItemHovered()) {
     ImGui::SetTooltip("Select node %u", nodeIndex);
   }
+  if (indent > 0.0f) {
+    ImGui::Unindent(indent);
+  }
 
   ImGui::TableNextColumn();
   bool visible = node->visible;
@@ -377,27 +445,19 @@ void DrawSceneHierarchyNode(const container::scene::SceneGraph &sceneGraph,
   }
 
   ImGui::TableNextColumn();
-  const std::vector<uint32_t> children = node->children;
   SceneHierarchyParentChange nodeParentChange =
       DrawSceneHierarchyParentCombo(sceneGraph, nodeIndex, *node, actions,
                                     candidateCache);
   if (!parentChange.requested && nodeParentChange.requested) {
     parentChange = nodeParentChange;
   }
-
-  if (open && !children.empty()) {
-    for (const uint32_t child : children) {
-      DrawSceneHierarchyNode(sceneGraph, child, actions, parentChange,
-                             candidateCache);
-    }
-    ImGui::TreePop();
-  }
 }
 
 void DrawSceneHierarchyPanel(const container::scene::SceneGraph &sceneGraph,
                              const SceneHierarchyPanelActions &actions,
                              SceneHierarchyParentCandidateCacheState
-                                 &candidateCache) {
+                                 &candidateCache,
+                             SceneHierarchyRowCacheState &rowCache) {
   if (sceneGraph.nodeCount() == 0 || !ImGui::TreeNode("Scene Hierarchy")) {
     return;
   }
@@ -406,8 +466,11 @@ void DrawSceneHierarchyPanel(const container::scene::SceneGraph &sceneGraph,
                         ImGuiTableFlags_BordersInnerV |
                             ImGuiTableFlags_RowBg |
                             ImGuiTableFlags_Resizable |
-                            ImGuiTableFlags_SizingStretchProp)) {
+                            ImGuiTableFlags_SizingStretchProp |
+                            ImGuiTableFlags_ScrollY,
+                        ImVec2(0.0f, 320.0f))) {
     SceneHierarchyParentChange parentChange{};
+    ImGui::TableSetupScrollFreeze(0, 1);
     ImGui::TableSetupColumn("Node", ImGuiTableColumnFlags_WidthStretch, 0.48f);
     ImGui::TableSetupColumn("Visible", ImGuiTableColumnFlags_WidthFixed,
                             82.0f);
@@ -415,10 +478,11 @@ void DrawSceneHierarchyPanel(const container::scene::SceneGraph &sceneGraph,
     ImGui::TableSetupColumn("Parent", ImGuiTableColumnFlags_WidthStretch,
                             0.32f);
     ImGui::TableHeadersRow();
-    for (const uint32_t root : sceneGraph.rootNodes()) {
-      DrawSceneHierarchyNode(sceneGraph, root, actions, parentChange,
-                             candidateCache);
-    }
+    RefreshSceneHierarchyRowCache(sceneGraph, rowCache);
+    DrawClippedRows(rowCache.rows.size(), [&](size_t row) {
+      DrawSceneHierarchyRow(sceneGraph, rowCache.rows[row], actions,
+                            parentChange, candidateCache, rowCache);
+    });
     ImGui::EndTable();
     if (parentChange.requested && actions.reparentSceneNode != nullptr) {
       (*actions.reparentSceneNode)(parentChange.nodeIndex,
@@ -832,7 +896,9 @@ GuiRendererTelemetryView GuiRendererTelemetry(
   latest.culling = {.inputCount = source.culling.inputCount,
                     .frustumPassedCount = source.culling.frustumPassedCount,
                     .occlusionPassedCount =
-                        source.culling.occlusionPassedCount};
+                        source.culling.occlusionPassedCount,
+                    .descriptorWrites = source.culling.descriptorWrites,
+                    .uploadedBytes = source.culling.uploadedBytes};
   latest.lightCulling = {
       .submittedLights = source.lightCulling.submittedLights,
       .activeClusters = source.lightCulling.activeClusters,
@@ -857,7 +923,8 @@ GuiRendererTelemetryView GuiRendererTelemetry(
   latest.sync = {.frameSlot = source.sync.frameSlot,
                  .maxFramesInFlight = source.sync.maxFramesInFlight,
                  .serializedConcurrency = source.sync.serializedConcurrency,
-                 .concurrencyReason = source.sync.concurrencyReason,
+                 .concurrencyReason = std::string(
+                     telemetry.text(source.sync.concurrencyReason)),
                  .swapchainRecreateCount = source.sync.swapchainRecreateCount,
                  .deviceWaitIdleCount = source.sync.deviceWaitIdleCount};
   latest.graph = {.totalPasses = source.graph.totalPasses,
@@ -871,18 +938,21 @@ GuiRendererTelemetryView GuiRendererTelemetry(
           source.gpuProfiler.source)),
       .available = source.gpuProfiler.available,
       .resultLatencyFrames = source.gpuProfiler.resultLatencyFrames,
-      .status = source.gpuProfiler.status};
-  latest.passes.reserve(source.passes.size());
-  for (const auto &pass : source.passes) {
-    latest.passes.push_back({.name = pass.name,
-                             .enabled = pass.enabled,
-                             .active = pass.active,
-                             .cpuTimed = pass.cpuTimed,
-                             .gpuTimed = pass.gpuTimed,
-                             .cpuRecordMs = pass.cpuRecordMs,
-                             .gpuKnownMs = pass.gpuKnownMs,
-                             .status = pass.status,
-                             .blocker = pass.blocker});
+      .status = std::string(telemetry.text(source.gpuProfiler.status))};
+  latest.passes.reserve(source.passCount);
+  for (const auto &pass : source.passList()) {
+    using container::renderer::rendererPassTelemetryBlocker;
+    using container::renderer::rendererPassTelemetryStatus;
+    latest.passes.push_back(
+        {.name = std::string(container::renderer::renderPassName(pass.id)),
+         .enabled = pass.enabled,
+         .active = pass.active,
+         .cpuTimed = pass.cpuTimed,
+         .gpuTimed = pass.gpuTimed,
+         .cpuRecordMs = pass.cpuRecordMs,
+         .gpuKnownMs = pass.gpuKnownMs,
+         .status = std::string(rendererPassTelemetryStatus(pass)),
+         .blocker = std::string(rendererPassTelemetryBlocker(pass))});
   }
   return uiTelemetry;
 }
@@ -1268,7 +1338,8 @@ captureBimMeasurementPointFromSelection(
   }
 
   using container::renderer::BimSnapKind;
-  static constexpr std::array kVertexKinds{BimSnapKind::BoundsCorner};
+  static constexpr std::array kVertexKinds{BimSnapKind::Vertex,
+                                           BimSnapKind::BoundsCorner};
   static constexpr std::array kEdgeKinds{BimSnapKind::EdgeMidpoint};
   static constexpr std::array kFaceKinds{BimSnapKind::FaceCenter};
   static constexpr std::array kBoundsKinds{BimSnapKind::BoundsCorner,
@@ -1296,6 +1367,22 @@ captureBimMeasurementPointFromSelection(
     return captured;
   }
 
+  // Real geometry wins over the bounds box whenever a feature is in reach;
+  // bounds candidates carry no screen distance and would otherwise tie.
+  std::optional<container::renderer::BimSnapCandidate> best =
+      container::renderer::BestBimSnapCandidate(
+          inspection.geometricSnapCandidates,
+          snapState.maxScreenDistancePixels, allowedKinds);
+  if (best.has_value()) {
+    captured.center = best->worldPosition;
+    captured.objectIndex = best->objectIndex;
+    captured.snapKind = best->kind;
+    captured.label += best->kind == BimSnapKind::Vertex         ? " vertex"
+                      : best->kind == BimSnapKind::EdgeMidpoint ? " edge"
+                                                                : " face";
+    return captured;
+  }
+
   const container::renderer::BimBoundsSnapInput snapInput{
       .objectIndex = inspection.selectedObjectIndex,
       .min = inspection.selectionBoundsMin,
@@ -1307,9 +1394,8 @@ captureBimMeasurementPointFromSelection(
   };
   const std::vector<container::renderer::BimSnapCandidate> candidates =
       container::renderer::BuildBimBoundsSnapCandidates(snapInput);
-  const std::optional<container::renderer::BimSnapCandidate> best =
-      container::renderer::BestBimSnapCandidate(
-          candidates, snapState.maxScreenDistancePixels, allowedKinds);
+  best = container::renderer::BestBimSnapCandidate(
+      candidates, snapState.maxScreenDistancePixels, allowedKinds);
   if (!best.has_value()) {
     return captured;
   }
@@ -1358,7 +1444,8 @@ void DrawBimCoordinateReadout(
 
 void DrawBimScheduleRows(std::string_view tableId,
                          std::span<const container::renderer::BimScheduleRow>
-                             rows) {
+                             rows,
+                         uint64_t dataRevision, GuiTableRowIndex &rowIndex) {
   if (rows.empty()) {
     ImGui::TextDisabled("No rows");
     return;
@@ -1366,32 +1453,53 @@ void DrawBimScheduleRows(std::string_view tableId,
   if (ImGui::BeginTable(std::string(tableId).c_str(), 5,
                         ImGuiTableFlags_BordersInnerV |
                             ImGuiTableFlags_RowBg |
-                            ImGuiTableFlags_SizingStretchProp)) {
+                            ImGuiTableFlags_SizingStretchProp |
+                            ImGuiTableFlags_Sortable |
+                            ImGuiTableFlags_SortTristate |
+                            ImGuiTableFlags_ScrollY,
+                        ImVec2(0.0f, 220.0f))) {
+    ImGui::TableSetupScrollFreeze(0, 1);
     ImGui::TableSetupColumn("Key");
     ImGui::TableSetupColumn("Storey");
     ImGui::TableSetupColumn("Count");
     ImGui::TableSetupColumn("Area");
     ImGui::TableSetupColumn("Volume");
     ImGui::TableHeadersRow();
-    const size_t visibleRows = std::min<size_t>(rows.size(), 24u);
-    for (size_t i = 0; i < visibleRows; ++i) {
-      const auto &row = rows[i];
+    GuiTableRowKey key{.dataRevision = dataRevision, .rowCount = rows.size()};
+    ReadTableSortSpecs(key);
+    rowIndex.refresh(
+        key, [](uint32_t) { return true; },
+        [&](uint32_t lhsIndex, uint32_t rhsIndex) {
+          const auto &lhs = rows[lhsIndex];
+          const auto &rhs = rows[rhsIndex];
+          switch (key.sortColumn) {
+          case 1:
+            return GuiRowCompareText(lhs.storey, rhs.storey) < 0;
+          case 2:
+            return lhs.count < rhs.count;
+          case 3:
+            return lhs.estimatedArea < rhs.estimatedArea;
+          case 4:
+            return lhs.estimatedVolume < rhs.estimatedVolume;
+          default:
+            return GuiRowCompareText(lhs.key, rhs.key) < 0;
+          }
+        });
+    DrawClippedRows(rowIndex.size(), [&](size_t visibleRow) {
+      const auto &row = rows[rowIndex.rows()[visibleRow]];
       ImGui::TableNextRow();
       ImGui::TableNextColumn();
-      ImGui::TextWrapped("%s", row.key.c_str());
+      ImGui::TextUnformatted(row.key.c_str());
       ImGui::TableNextColumn();
-      ImGui::TextWrapped("%s", row.storey.empty() ? "-" : row.storey.c_str());
+      ImGui::TextUnformatted(row.storey.empty() ? "-" : row.storey.c_str());
       ImGui::TableNextColumn();
       ImGui::Text("%u", row.count);
       ImGui::TableNextColumn();
       ImGui::Text("%.2f", row.estimatedArea);
       ImGui::TableNextColumn();
       ImGui::Text("%.2f", row.estimatedVolume);
-    }
+    });
     ImGui::EndTable();
-    if (visibleRows < rows.size()) {
-      ImGui::TextDisabled("%zu more rows", rows.size() - visibleRows);
-    }
   }
 }
 
@@ -1492,15 +1600,6 @@ std::optional<size_t> FindStringIndex(std::span<const std::string> values,
   return static_cast<size_t>(std::distance(values.begin(), it));
 }
 
-bool ContainsCaseInsensitive(std::string_view haystack,
-                             std::string_view needle) {
-  if (needle.empty()) {
-    return true;
-  }
-  return ToLowerAscii(std::string(haystack))
-             .find(ToLowerAscii(std::string(needle))) != std::string::npos;
-}
-
 const char *
 BimDisciplinePresetLabel(container::renderer::BimDisciplinePreset preset) {
   switch (preset) {
@@ -1516,11 +1615,39 @@ BimDisciplinePresetLabel(container::renderer::BimDisciplinePreset preset) {
 
 bool PropertyMatchesSearch(
     const container::renderer::BimElementProperty &property,
-    std::string_view search) {
-  return ContainsCaseInsensitive(property.set, search) ||
-         ContainsCaseInsensitive(property.name, search) ||
-         ContainsCaseInsensitive(property.value, search) ||
-         ContainsCaseInsensitive(property.category, search);
+    const GuiRowTextFilter &search) {
+  return search.matches(property.set) || search.matches(property.name) ||
+         search.matches(property.value) || search.matches(property.category);
+}
+
+// Groups the selected element's properties by set and category, in order of
+// first appearance.
+void RefreshBimPropertySetSummaryCache(
+    const GuiTableRowKey &key,
+    std::span<const container::renderer::BimElementProperty> properties,
+    BimPropertySetSummaryCacheState &cache) {
+  if (cache.valid && cache.key == key) {
+    return;
+  }
+  cache.key = key;
+  cache.valid = true;
+  cache.rows.clear();
+  std::unordered_map<std::string, size_t> rowByKey;
+  for (const container::renderer::BimElementProperty &property : properties) {
+    std::string setName =
+        !property.set.empty() ? property.set : "(unassigned set)";
+    std::string categoryName = !property.category.empty()
+                                   ? property.category
+                                   : "(unassigned category)";
+    const auto [it, inserted] = rowByKey.try_emplace(
+        setName + "\n" + categoryName, cache.rows.size());
+    if (inserted) {
+      cache.rows.push_back(
+          BimPropertySetSummaryRow{.set = std::move(setName),
+                                   .category = std::move(categoryName)});
+    }
+    ++cache.rows[it->second].propertyCount;
+  }
 }
 
 std::string RelationshipNodeLabel(
@@ -1555,6 +1682,12 @@ void DrawSemanticLegendEntry(container::renderer::BimSemanticColorMode mode,
 
 } // namespace
 
+bool BimMeasurementSnapModeUsesGeometry(BimMeasurementSnapMode mode) {
+  return mode == BimMeasurementSnapMode::Vertex ||
+         mode == BimMeasurementSnapMode::Edge ||
+         mode == BimMeasurementSnapMode::Face;
+}
+
 std::optional<BimMeasurementCapturedPoint>
 CaptureBimMeasurementPointFromSelection(
     const BimInspectionState &inspection,
@@ -2527,7 +2660,7 @@ void GuiManager::drawSceneControls(
                                  .focusSceneNode = &focusSceneNode,
                                  .setSceneNodeVisible = &setSceneNodeVisible,
                                  .reparentSceneNode = &reparentSceneNode},
-      sceneHierarchyParentCandidateCache_);
+      sceneHierarchyParentCandidateCache_, sceneHierarchyRowCache_);
 
   if (!bimInspection.hasScene) {
     bimMeasurementModelPath_.clear();
@@ -2765,15 +2898,21 @@ void GuiManager::drawSceneControls(
       if (ImGui::TreeNode("Schedules and Quantities")) {
         ImGui::Text("By IFC class and storey");
         DrawBimScheduleRows("BimScheduleClassStoreyRows",
-                            bimInspection.scheduleByClassAndStoreyRows);
+                            bimInspection.scheduleByClassAndStoreyRows,
+                            bimInspection.dataRevision,
+                            bimScheduleRowIndices_[0]);
         ImGui::Separator();
         ImGui::Text("By type and storey");
         DrawBimScheduleRows("BimScheduleTypeStoreyRows",
-                            bimInspection.scheduleByTypeAndStoreyRows);
+                            bimInspection.scheduleByTypeAndStoreyRows,
+                            bimInspection.dataRevision,
+                            bimScheduleRowIndices_[1]);
         ImGui::Separator();
         ImGui::Text("Material totals");
         DrawBimScheduleRows("BimScheduleMaterialTotals",
-                            bimInspection.scheduleByMaterialRows);
+                            bimInspection.scheduleByMaterialRows,
+                            bimInspection.dataRevision,
+                            bimScheduleRowIndices_[2]);
         ImGui::TreePop();
       }
 
@@ -2807,26 +2946,28 @@ void GuiManager::drawSceneControls(
           } else if (ImGui::BeginTable("BimModelCompareChanges", 4,
                                        ImGuiTableFlags_BordersInnerV |
                                            ImGuiTableFlags_RowBg |
-                                           ImGuiTableFlags_SizingStretchProp)) {
+                                           ImGuiTableFlags_SizingStretchProp |
+                                           ImGuiTableFlags_ScrollY,
+                                       ImVec2(0.0f, 220.0f))) {
+            ImGui::TableSetupScrollFreeze(0, 1);
             ImGui::TableSetupColumn("Kind");
             ImGui::TableSetupColumn("Element");
             ImGui::TableSetupColumn("Before");
             ImGui::TableSetupColumn("After");
             ImGui::TableHeadersRow();
-            const size_t visibleChanges =
-                std::min<size_t>(bimCompareChanges_.size(), 32u);
-            for (size_t i = 0; i < visibleChanges; ++i) {
+            DrawClippedRows(bimCompareChanges_.size(), [&](size_t i) {
               const auto &change = bimCompareChanges_[i];
               ImGui::TableNextRow();
               ImGui::TableNextColumn();
-              ImGui::Text("%s", BimModelCompareChangeKindLabel(change.kind));
+              ImGui::TextUnformatted(
+                  BimModelCompareChangeKindLabel(change.kind));
               ImGui::TableNextColumn();
-              ImGui::TextWrapped("%s", change.identity.c_str());
+              ImGui::TextUnformatted(change.identity.c_str());
               ImGui::TableNextColumn();
-              ImGui::TextWrapped("%s", change.beforeValue.c_str());
+              ImGui::TextUnformatted(change.beforeValue.c_str());
               ImGui::TableNextColumn();
-              ImGui::TextWrapped("%s", change.afterValue.c_str());
-            }
+              ImGui::TextUnformatted(change.afterValue.c_str());
+            });
             ImGui::EndTable();
           }
         }
@@ -2934,7 +3075,8 @@ void GuiManager::drawSceneControls(
           if (allSelected) {
             ImGui::SetItemDefaultFocus();
           }
-          for (const std::string &value : values) {
+          DrawClippedRows(values.size(), [&](size_t i) {
+            const std::string &value = values[i];
             const bool selected = filterEnabled && filterValue == value;
             if (ImGui::Selectable(value.c_str(), selected)) {
               filterEnabled = true;
@@ -2943,7 +3085,7 @@ void GuiManager::drawSceneControls(
             if (selected) {
               ImGui::SetItemDefaultFocus();
             }
-          }
+          });
           ImGui::EndCombo();
         }
       };
@@ -3186,73 +3328,92 @@ void GuiManager::drawSceneControls(
         } else if (ImGui::BeginTable("BimQuickFilterMatches", 3,
                                      ImGuiTableFlags_Borders |
                                          ImGuiTableFlags_RowBg |
-                                         ImGuiTableFlags_SizingStretchProp,
+                                         ImGuiTableFlags_SizingStretchProp |
+                                         ImGuiTableFlags_ScrollY,
                                      ImVec2(0.0f, 220.0f))) {
+          struct QuickFilterCategory {
+            const char *label;
+            std::span<const std::string> values;
+            bool &filterEnabled;
+            std::string &filterValue;
+          };
+          const std::array<QuickFilterCategory, 8> categories{{
+              {"Type", bimInspection.elementTypes,
+               bimFilterState_.typeFilterEnabled, bimFilterState_.type},
+              {"Storey", bimInspection.elementStoreys,
+               bimFilterState_.storeyFilterEnabled, bimFilterState_.storey},
+              {"Material", bimInspection.elementMaterials,
+               bimFilterState_.materialFilterEnabled,
+               bimFilterState_.material},
+              {"Discipline", bimInspection.elementDisciplines,
+               bimFilterState_.disciplineFilterEnabled,
+               bimFilterState_.discipline},
+              {"Phase", bimInspection.elementPhases,
+               bimFilterState_.phaseFilterEnabled, bimFilterState_.phase},
+              {"Fire rating", bimInspection.elementFireRatings,
+               bimFilterState_.fireRatingFilterEnabled,
+               bimFilterState_.fireRating},
+              {"Load-bearing", bimInspection.elementLoadBearingValues,
+               bimFilterState_.loadBearingFilterEnabled,
+               bimFilterState_.loadBearing},
+              {"Status", bimInspection.elementStatuses,
+               bimFilterState_.statusFilterEnabled, bimFilterState_.status},
+          }};
+          // Rows index the categories' values back to back.
+          size_t valueCount = 0u;
+          for (const QuickFilterCategory &category : categories) {
+            valueCount += category.values.size();
+          }
+          auto resolveRow = [&](size_t row) {
+            size_t categoryIndex = 0u;
+            while (row >= categories[categoryIndex].values.size()) {
+              row -= categories[categoryIndex].values.size();
+              ++categoryIndex;
+            }
+            return std::pair{categoryIndex, row};
+          };
+          const GuiRowTextFilter filter(bimQuickFilterSearch_);
+          bimQuickFilterMatchRows_.refresh(
+              GuiTableRowKey{.dataRevision = bimInspection.dataRevision,
+                             .rowCount = valueCount,
+                             .filter = bimQuickFilterSearch_},
+              [&](uint32_t row) {
+                const auto [categoryIndex, valueIndex] = resolveRow(row);
+                return filter.matches(
+                    categories[categoryIndex].values[valueIndex]);
+              },
+              [](uint32_t, uint32_t) { return false; });
+          ImGui::TableSetupScrollFreeze(0, 1);
           ImGui::TableSetupColumn("Category");
           ImGui::TableSetupColumn("Value");
           ImGui::TableSetupColumn("Action");
           ImGui::TableHeadersRow();
-          size_t visibleMatches = 0u;
-          size_t totalMatches = 0u;
-          auto drawFilterMatches =
-              [&](const char *category, std::span<const std::string> values,
-                  bool &filterEnabled, std::string &filterValue) {
-                for (const std::string &value : values) {
-                  if (!ContainsCaseInsensitive(value, bimQuickFilterSearch_)) {
-                    continue;
-                  }
-                  ++totalMatches;
-                  if (visibleMatches >= 96u) {
-                    continue;
-                  }
-                  ImGui::PushID(category);
-                  ImGui::PushID(static_cast<int>(visibleMatches));
-                  ImGui::TableNextRow();
-                  ImGui::TableNextColumn();
-                  ImGui::TextUnformatted(category);
-                  ImGui::TableNextColumn();
-                  ImGui::TextWrapped("%s", value.c_str());
-                  ImGui::TableNextColumn();
-                  if (ImGui::SmallButton("Use")) {
-                    filterEnabled = true;
-                    filterValue = value;
-                  }
-                  ImGui::PopID();
-                  ImGui::PopID();
-                  ++visibleMatches;
+          DrawClippedRows(
+              bimQuickFilterMatchRows_.size(), [&](size_t visibleRow) {
+                const auto [categoryIndex, valueIndex] =
+                    resolveRow(bimQuickFilterMatchRows_.rows()[visibleRow]);
+                const QuickFilterCategory &category =
+                    categories[categoryIndex];
+                const std::string &value = category.values[valueIndex];
+                ImGui::PushID(static_cast<int>(visibleRow));
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(category.label);
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(value.c_str());
+                ImGui::TableNextColumn();
+                if (ImGui::SmallButton("Use")) {
+                  category.filterEnabled = true;
+                  category.filterValue = value;
                 }
-              };
-          drawFilterMatches("Type", bimInspection.elementTypes,
-                            bimFilterState_.typeFilterEnabled,
-                            bimFilterState_.type);
-          drawFilterMatches("Storey", bimInspection.elementStoreys,
-                            bimFilterState_.storeyFilterEnabled,
-                            bimFilterState_.storey);
-          drawFilterMatches("Material", bimInspection.elementMaterials,
-                            bimFilterState_.materialFilterEnabled,
-                            bimFilterState_.material);
-          drawFilterMatches("Discipline", bimInspection.elementDisciplines,
-                            bimFilterState_.disciplineFilterEnabled,
-                            bimFilterState_.discipline);
-          drawFilterMatches("Phase", bimInspection.elementPhases,
-                            bimFilterState_.phaseFilterEnabled,
-                            bimFilterState_.phase);
-          drawFilterMatches("Fire rating", bimInspection.elementFireRatings,
-                            bimFilterState_.fireRatingFilterEnabled,
-                            bimFilterState_.fireRating);
-          drawFilterMatches("Load-bearing",
-                            bimInspection.elementLoadBearingValues,
-                            bimFilterState_.loadBearingFilterEnabled,
-                            bimFilterState_.loadBearing);
-          drawFilterMatches("Status", bimInspection.elementStatuses,
-                            bimFilterState_.statusFilterEnabled,
-                            bimFilterState_.status);
+                ImGui::PopID();
+              });
           ImGui::EndTable();
-          if (totalMatches == 0u) {
+          if (bimQuickFilterMatchRows_.empty()) {
             ImGui::TextDisabled("No filter values match the search");
-          } else if (visibleMatches < totalMatches) {
-            ImGui::TextDisabled("%zu more matches",
-                                totalMatches - visibleMatches);
+          } else {
+            ImGui::TextDisabled("%zu matches",
+                                bimQuickFilterMatchRows_.size());
           }
         }
         ImGui::TreePop();
@@ -3393,26 +3554,28 @@ void GuiManager::drawSceneControls(
               ImGui::BeginTable("BimSelectionSetMembers", 5,
                                 ImGuiTableFlags_Borders |
                                     ImGuiTableFlags_RowBg |
-                                    ImGuiTableFlags_SizingStretchProp,
+                                    ImGuiTableFlags_SizingStretchProp |
+                                    ImGuiTableFlags_ScrollY,
                                 ImVec2(0.0f, 180.0f))) {
+            ImGui::TableSetupScrollFreeze(0, 1);
             ImGui::TableSetupColumn("Element");
             ImGui::TableSetupColumn("Type");
             ImGui::TableSetupColumn("Storey");
             ImGui::TableSetupColumn("Material");
             ImGui::TableSetupColumn("Action");
             ImGui::TableHeadersRow();
-            for (size_t i = 0; i < set.members.size(); ++i) {
+            DrawClippedRows(set.members.size(), [&](size_t i) {
               const BimSelectionSetMemberState &member = set.members[i];
               ImGui::PushID(static_cast<int>(i));
               ImGui::TableNextRow();
               ImGui::TableNextColumn();
-              ImGui::TextWrapped("%s", member.label.c_str());
+              ImGui::TextUnformatted(member.label.c_str());
               ImGui::TableNextColumn();
-              ImGui::TextWrapped("%s", member.type.c_str());
+              ImGui::TextUnformatted(member.type.c_str());
               ImGui::TableNextColumn();
-              ImGui::TextWrapped("%s", member.storey.c_str());
+              ImGui::TextUnformatted(member.storey.c_str());
               ImGui::TableNextColumn();
-              ImGui::TextWrapped("%s", member.material.c_str());
+              ImGui::TextUnformatted(member.material.c_str());
               ImGui::TableNextColumn();
               if (ImGui::SmallButton("Restore")) {
                 const bool restored = restoreViewpoint
@@ -3427,7 +3590,7 @@ void GuiManager::drawSceneControls(
                 removeMemberIndex = static_cast<int>(i);
               }
               ImGui::PopID();
-            }
+            });
             ImGui::EndTable();
           }
           if (removeMemberIndex >= 0) {
@@ -3507,43 +3670,67 @@ void GuiManager::drawSceneControls(
               if (ImGui::BeginTable("BimExtendedProperties", 4,
                                     ImGuiTableFlags_Borders |
                                         ImGuiTableFlags_RowBg |
-                                        ImGuiTableFlags_SizingStretchProp,
+                                        ImGuiTableFlags_SizingStretchProp |
+                                        ImGuiTableFlags_Sortable |
+                                        ImGuiTableFlags_SortTristate |
+                                        ImGuiTableFlags_ScrollY,
                                     ImVec2(0.0f, 220.0f))) {
+                ImGui::TableSetupScrollFreeze(0, 1);
                 ImGui::TableSetupColumn("Set");
                 ImGui::TableSetupColumn("Name");
                 ImGui::TableSetupColumn("Value");
                 ImGui::TableSetupColumn("Category");
                 ImGui::TableHeadersRow();
-                size_t visiblePropertyCount = 0u;
-                size_t matchedPropertyCount = 0u;
-                for (size_t i = 0; i < bimInspection.properties.size(); ++i) {
-                  const container::renderer::BimElementProperty &property =
-                      bimInspection.properties[i];
-                  if (!PropertyMatchesSearch(property, bimPropertySearch_)) {
-                    continue;
-                  }
-                  ++matchedPropertyCount;
-                  if (visiblePropertyCount >= 128u) {
-                    continue;
-                  }
-                  ++visiblePropertyCount;
-                  ImGui::TableNextRow();
-                  ImGui::TableNextColumn();
-                  ImGui::TextWrapped("%s", property.set.c_str());
-                  ImGui::TableNextColumn();
-                  ImGui::TextWrapped("%s", property.name.c_str());
-                  ImGui::TableNextColumn();
-                  ImGui::TextWrapped("%s", property.value.c_str());
-                  ImGui::TableNextColumn();
-                  ImGui::TextWrapped("%s", property.category.c_str());
-                }
+                const auto properties = bimInspection.properties;
+                GuiTableRowKey key{
+                    .dataRevision = bimInspection.dataRevision,
+                    .scope = bimInspection.selectedObjectIndex,
+                    .rowCount = properties.size(),
+                    .filter = bimPropertySearch_};
+                ReadTableSortSpecs(key);
+                const GuiRowTextFilter filter(bimPropertySearch_);
+                bimPropertyRows_.refresh(
+                    key,
+                    [&](uint32_t row) {
+                      return PropertyMatchesSearch(properties[row], filter);
+                    },
+                    [&](uint32_t lhsIndex, uint32_t rhsIndex) {
+                      const auto &lhs = properties[lhsIndex];
+                      const auto &rhs = properties[rhsIndex];
+                      switch (key.sortColumn) {
+                      case 1:
+                        return GuiRowCompareText(lhs.name, rhs.name) < 0;
+                      case 2:
+                        return GuiRowCompareText(lhs.value, rhs.value) < 0;
+                      case 3:
+                        return GuiRowCompareText(lhs.category,
+                                                 rhs.category) < 0;
+                      default:
+                        return GuiRowCompareText(lhs.set, rhs.set) < 0;
+                      }
+                    });
+                DrawClippedRows(
+                    bimPropertyRows_.size(), [&](size_t visibleRow) {
+                      const container::renderer::BimElementProperty
+                          &property =
+                              properties[bimPropertyRows_.rows()[visibleRow]];
+                      ImGui::TableNextRow();
+                      ImGui::TableNextColumn();
+                      ImGui::TextUnformatted(property.set.c_str());
+                      ImGui::TableNextColumn();
+                      ImGui::TextUnformatted(property.name.c_str());
+                      ImGui::TableNextColumn();
+                      ImGui::TextUnformatted(property.value.c_str());
+                      ImGui::TableNextColumn();
+                      ImGui::TextUnformatted(property.category.c_str());
+                    });
                 ImGui::EndTable();
-                if (matchedPropertyCount == 0u) {
+                if (bimPropertyRows_.empty()) {
                   ImGui::TextDisabled("No properties match the search");
-                } else if (visiblePropertyCount < matchedPropertyCount) {
-                  ImGui::TextDisabled("%zu more matching properties",
-                                      matchedPropertyCount -
-                                          visiblePropertyCount);
+                } else if (bimPropertyRows_.size() < properties.size()) {
+                  ImGui::TextDisabled("%zu of %zu properties match",
+                                      bimPropertyRows_.size(),
+                                      properties.size());
                 }
               }
             }
@@ -3570,7 +3757,9 @@ void GuiManager::drawSceneControls(
             bimRelationshipSearch_.clear();
           }
           if (!bimRelationshipSearch_.empty()) {
-            const auto hits = relationshipGraph->search(bimRelationshipSearch_);
+            const auto page = relationshipGraph->searchPage(
+                bimRelationshipSearch_, 0u, 64u);
+            const auto &hits = page.results;
             if (hits.empty()) {
               ImGui::TextDisabled("No graph matches");
             } else if (ImGui::BeginTable(
@@ -3582,9 +3771,7 @@ void GuiManager::drawSceneControls(
               ImGui::TableSetupColumn("Reason");
               ImGui::TableSetupColumn("Match");
               ImGui::TableHeadersRow();
-              const size_t visibleHitCount = std::min<size_t>(hits.size(), 64u);
-              for (size_t i = 0; i < visibleHitCount; ++i) {
-                const auto &hit = hits[i];
+              for (const auto &hit : hits) {
                 ImGui::TableNextRow();
                 ImGui::TableNextColumn();
                 ImGui::Text("%u", hit.objectIndex);
@@ -3594,9 +3781,9 @@ void GuiManager::drawSceneControls(
                 ImGui::TextWrapped("%s", hit.matchedText.c_str());
               }
               ImGui::EndTable();
-              if (visibleHitCount < hits.size()) {
+              if (hits.size() < page.totalMatches) {
                 ImGui::TextDisabled("%zu more matches",
-                                    hits.size() - visibleHitCount);
+                                    page.totalMatches - hits.size());
               }
             }
           }
@@ -3644,47 +3831,52 @@ void GuiManager::drawSceneControls(
                 ImGui::BeginTable("BimSelectedRelationshipEdges", 4,
                                   ImGuiTableFlags_Borders |
                                       ImGuiTableFlags_RowBg |
-                                      ImGuiTableFlags_SizingStretchProp,
+                                      ImGuiTableFlags_SizingStretchProp |
+                                      ImGuiTableFlags_ScrollY,
                                   ImVec2(0.0f, 150.0f))) {
+              ImGui::TableSetupScrollFreeze(0, 1);
               ImGui::TableSetupColumn("Relationship");
               ImGui::TableSetupColumn("Direction");
               ImGui::TableSetupColumn("Related node");
               ImGui::TableSetupColumn("Label");
               ImGui::TableHeadersRow();
               const auto nodes = relationshipGraph->nodes();
-              const size_t visibleEdgeCount =
-                  std::min<size_t>(selectedEdges.size(), 64u);
-              for (size_t i = 0; i < visibleEdgeCount; ++i) {
-                const auto &edge = selectedEdges[i];
-                if (edge.from >= nodes.size() || edge.to >= nodes.size()) {
-                  continue;
-                }
-                const bool selectedIsFrom =
-                    nodes[edge.from].objectIndex ==
-                    bimInspection.selectedObjectIndex;
-                const auto &relatedNode =
-                    selectedIsFrom ? nodes[edge.to] : nodes[edge.from];
-                ImGui::TableNextRow();
-                ImGui::TableNextColumn();
-                ImGui::TextWrapped(
-                    "%s",
-                    std::string(container::renderer::bimRelationshipKindLabel(
-                                    edge.kind))
-                        .c_str());
-                ImGui::TableNextColumn();
-                ImGui::TextDisabled("%s", selectedIsFrom ? "out" : "in");
-                ImGui::TableNextColumn();
-                const std::string relatedLabel =
-                    RelationshipNodeLabel(relatedNode);
-                ImGui::TextWrapped("%s", relatedLabel.c_str());
-                ImGui::TableNextColumn();
-                ImGui::TextWrapped("%s", edge.label.c_str());
-              }
+              bimSelectedRelationshipEdgeRows_.refresh(
+                  GuiTableRowKey{.dataRevision = bimInspection.dataRevision,
+                                 .scope = bimInspection.selectedObjectIndex,
+                                 .rowCount = selectedEdges.size()},
+                  [&](uint32_t row) {
+                    const auto &edge = selectedEdges[row];
+                    return edge.from < nodes.size() && edge.to < nodes.size();
+                  },
+                  [](uint32_t, uint32_t) { return false; });
+              DrawClippedRows(
+                  bimSelectedRelationshipEdgeRows_.size(),
+                  [&](size_t visibleRow) {
+                    const auto &edge =
+                        selectedEdges[bimSelectedRelationshipEdgeRows_
+                                          .rows()[visibleRow]];
+                    const bool selectedIsFrom =
+                        nodes[edge.from].objectIndex ==
+                        bimInspection.selectedObjectIndex;
+                    const auto &relatedNode =
+                        selectedIsFrom ? nodes[edge.to] : nodes[edge.from];
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    const std::string kindLabel(
+                        container::renderer::bimRelationshipKindLabel(
+                            edge.kind));
+                    ImGui::TextUnformatted(kindLabel.c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::TextDisabled("%s", selectedIsFrom ? "out" : "in");
+                    ImGui::TableNextColumn();
+                    const std::string relatedLabel =
+                        RelationshipNodeLabel(relatedNode);
+                    ImGui::TextUnformatted(relatedLabel.c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(edge.label.c_str());
+                  });
               ImGui::EndTable();
-              if (visibleEdgeCount < selectedEdges.size()) {
-                ImGui::TextDisabled("%zu more relationships",
-                                    selectedEdges.size() - visibleEdgeCount);
-              }
             }
           }
           if (ImGui::BeginTable("BimIfcRelationshipBrowser", 3,
@@ -3769,20 +3961,24 @@ void GuiManager::drawSceneControls(
                 if (ImGui::BeginTable("BimIfcPropertySetProperties", 3,
                                       ImGuiTableFlags_Borders |
                                           ImGuiTableFlags_RowBg |
-                                          ImGuiTableFlags_SizingStretchProp)) {
+                                          ImGuiTableFlags_SizingStretchProp |
+                                          ImGuiTableFlags_ScrollY,
+                                      ImVec2(0.0f, 180.0f))) {
+                  ImGui::TableSetupScrollFreeze(0, 1);
                   ImGui::TableSetupColumn("Name");
                   ImGui::TableSetupColumn("Value");
                   ImGui::TableSetupColumn("Category");
                   ImGui::TableHeadersRow();
-                  for (const auto &property : group.properties) {
+                  DrawClippedRows(group.properties.size(), [&](size_t i) {
+                    const auto &property = group.properties[i];
                     ImGui::TableNextRow();
                     ImGui::TableNextColumn();
-                    ImGui::TextWrapped("%s", property.name.c_str());
+                    ImGui::TextUnformatted(property.name.c_str());
                     ImGui::TableNextColumn();
-                    ImGui::TextWrapped("%s", property.value.c_str());
+                    ImGui::TextUnformatted(property.value.c_str());
                     ImGui::TableNextColumn();
-                    ImGui::TextWrapped("%s", property.category.c_str());
-                  }
+                    ImGui::TextUnformatted(property.category.c_str());
+                  });
                   ImGui::EndTable();
                 }
                 ImGui::TreePop();
@@ -3800,57 +3996,31 @@ void GuiManager::drawSceneControls(
           } else if (ImGui::BeginTable("BimIfcPropertySetSummary", 3,
                                        ImGuiTableFlags_Borders |
                                            ImGuiTableFlags_RowBg |
-                                           ImGuiTableFlags_SizingStretchProp,
+                                           ImGuiTableFlags_SizingStretchProp |
+                                           ImGuiTableFlags_ScrollY,
                                        ImVec2(0.0f, 160.0f))) {
+            ImGui::TableSetupScrollFreeze(0, 1);
             ImGui::TableSetupColumn("Property set");
             ImGui::TableSetupColumn("Category");
             ImGui::TableSetupColumn("Properties");
             ImGui::TableHeadersRow();
-            size_t visiblePropertySetCount = 0u;
-            std::vector<std::string> visiblePropertySetKeys;
-            for (const container::renderer::BimElementProperty &property :
-                 bimInspection.properties) {
-              const std::string setName =
-                  !property.set.empty() ? property.set : "(unassigned set)";
-              const std::string categoryName = !property.category.empty()
-                                                   ? property.category
-                                                   : "(unassigned category)";
-              const std::string key = setName + "\n" + categoryName;
-              if (std::ranges::contains(visiblePropertySetKeys, key)) {
-                continue;
-              }
-              size_t propertyCount = 0u;
-              for (const container::renderer::BimElementProperty &candidate :
-                   bimInspection.properties) {
-                const std::string candidateSet =
-                    !candidate.set.empty() ? candidate.set : "(unassigned set)";
-                const std::string candidateCategory =
-                    !candidate.category.empty() ? candidate.category
-                                                : "(unassigned category)";
-                if (candidateSet == setName &&
-                    candidateCategory == categoryName) {
-                  ++propertyCount;
-                }
-              }
-              visiblePropertySetKeys.push_back(key);
-              if (visiblePropertySetCount >= 32u) {
-                continue;
-              }
-              ++visiblePropertySetCount;
+            RefreshBimPropertySetSummaryCache(
+                GuiTableRowKey{.dataRevision = bimInspection.dataRevision,
+                               .scope = bimInspection.selectedObjectIndex,
+                               .rowCount = bimInspection.properties.size()},
+                bimInspection.properties, bimPropertySetSummaryCache_);
+            const auto &summaryRows = bimPropertySetSummaryCache_.rows;
+            DrawClippedRows(summaryRows.size(), [&](size_t i) {
+              const BimPropertySetSummaryRow &row = summaryRows[i];
               ImGui::TableNextRow();
               ImGui::TableNextColumn();
-              ImGui::TextWrapped("%s", setName.c_str());
+              ImGui::TextUnformatted(row.set.c_str());
               ImGui::TableNextColumn();
-              ImGui::TextWrapped("%s", categoryName.c_str());
+              ImGui::TextUnformatted(row.category.c_str());
               ImGui::TableNextColumn();
-              ImGui::Text("%zu", propertyCount);
-            }
+              ImGui::Text("%zu", row.propertyCount);
+            });
             ImGui::EndTable();
-            if (visiblePropertySetCount < visiblePropertySetKeys.size()) {
-              ImGui::TextDisabled("%zu more property sets",
-                                  visiblePropertySetKeys.size() -
-                                  visiblePropertySetCount);
-            }
           }
         } else {
           ImGui::TextDisabled(
@@ -3868,40 +4038,43 @@ void GuiManager::drawSceneControls(
           if (ImGui::BeginTable("BimGraphSpatialEdges", 3,
                                 ImGuiTableFlags_Borders |
                                     ImGuiTableFlags_RowBg |
-                                    ImGuiTableFlags_SizingStretchProp,
+                                    ImGuiTableFlags_SizingStretchProp |
+                                    ImGuiTableFlags_ScrollY,
                                 ImVec2(0.0f, 180.0f))) {
+            ImGui::TableSetupScrollFreeze(0, 1);
             ImGui::TableSetupColumn("Parent");
             ImGui::TableSetupColumn("Child");
             ImGui::TableSetupColumn("Label");
             ImGui::TableHeadersRow();
-            size_t visibleSpatialEdgeCount = 0u;
-            size_t spatialEdgeCount = 0u;
-            for (const auto &edge : edges) {
-              if (edge.kind !=
-                      container::renderer::BimRelationshipKind::SpatialParent ||
-                  edge.from >= nodes.size() || edge.to >= nodes.size()) {
-                continue;
-              }
-              ++spatialEdgeCount;
-              if (visibleSpatialEdgeCount >= 128u) {
-                continue;
-              }
-              ++visibleSpatialEdgeCount;
-              const std::string parent = RelationshipNodeLabel(nodes[edge.from]);
-              const std::string child = RelationshipNodeLabel(nodes[edge.to]);
-              ImGui::TableNextRow();
-              ImGui::TableNextColumn();
-              ImGui::TextWrapped("%s", parent.c_str());
-              ImGui::TableNextColumn();
-              ImGui::TextWrapped("%s", child.c_str());
-              ImGui::TableNextColumn();
-              ImGui::TextWrapped("%s", edge.label.c_str());
-            }
+            bimSpatialEdgeRows_.refresh(
+                GuiTableRowKey{.dataRevision = bimInspection.dataRevision,
+                               .rowCount = edges.size()},
+                [&](uint32_t row) {
+                  const auto &edge = edges[row];
+                  return edge.kind == container::renderer::BimRelationshipKind::
+                                          SpatialParent &&
+                         edge.from < nodes.size() && edge.to < nodes.size();
+                },
+                [](uint32_t, uint32_t) { return false; });
+            DrawClippedRows(
+                bimSpatialEdgeRows_.size(), [&](size_t visibleRow) {
+                  const auto &edge =
+                      edges[bimSpatialEdgeRows_.rows()[visibleRow]];
+                  const std::string parent =
+                      RelationshipNodeLabel(nodes[edge.from]);
+                  const std::string child =
+                      RelationshipNodeLabel(nodes[edge.to]);
+                  ImGui::TableNextRow();
+                  ImGui::TableNextColumn();
+                  ImGui::TextUnformatted(parent.c_str());
+                  ImGui::TableNextColumn();
+                  ImGui::TextUnformatted(child.c_str());
+                  ImGui::TableNextColumn();
+                  ImGui::TextUnformatted(edge.label.c_str());
+                });
             ImGui::EndTable();
-            if (visibleSpatialEdgeCount < spatialEdgeCount) {
-              ImGui::TextDisabled("%zu more spatial edges",
-                                  spatialEdgeCount - visibleSpatialEdgeCount);
-            }
+            ImGui::TextDisabled("%zu spatial edges",
+                                bimSpatialEdgeRows_.size());
           }
           ImGui::TreePop();
         }
@@ -4017,20 +4190,24 @@ void GuiManager::drawSceneControls(
           if (ImGui::BeginTable("BimSpatialStoreys", 4,
                                 ImGuiTableFlags_Borders |
                                     ImGuiTableFlags_RowBg |
-                                    ImGuiTableFlags_SizingStretchProp,
+                                    ImGuiTableFlags_SizingStretchProp |
+                                    ImGuiTableFlags_ScrollY,
                                 ImVec2(0.0f, 220.0f))) {
+            ImGui::TableSetupScrollFreeze(0, 1);
             ImGui::TableSetupColumn("Storey");
             ImGui::TableSetupColumn("Elevation");
             ImGui::TableSetupColumn("Objects");
             ImGui::TableSetupColumn("Preset");
             ImGui::TableHeadersRow();
-            for (int i = 0; i < storeyRangeCount; ++i) {
-              const auto &storeyRange =
-                  bimInspection.elementStoreyRanges[static_cast<size_t>(i)];
+            const size_t storeyRowCount =
+                static_cast<size_t>(storeyRangeCount);
+            DrawClippedRows(storeyRowCount, [&](size_t row) {
+              const int i = static_cast<int>(row);
+              const auto &storeyRange = bimInspection.elementStoreyRanges[row];
               ImGui::PushID(i);
               ImGui::TableNextRow();
               ImGui::TableNextColumn();
-              ImGui::TextWrapped("%s", storeyRange.label.c_str());
+              ImGui::TextUnformatted(storeyRange.label.c_str());
               ImGui::TableNextColumn();
               ImGui::Text("%.2f..%.2f", storeyRange.minElevation,
                           storeyRange.maxElevation);
@@ -4051,7 +4228,7 @@ void GuiManager::drawSceneControls(
                 ImGui::TextDisabled("active");
               }
               ImGui::PopID();
-            }
+            });
             ImGui::EndTable();
           }
         } else {
@@ -6154,6 +6331,9 @@ void GuiManager::drawRendererTelemetryWindow() {
                 latest.culling.frustumPassedCount, frustumCulled);
     ImGui::Text("Occlusion passed: %u, culled: %u",
                 latest.culling.occlusionPassedCount, occlusionCulled);
+    ImGui::Text("Descriptor writes: %u, uploaded: %llu bytes",
+                latest.culling.descriptorWrites,
+                static_cast<unsigned long long>(latest.culling.uploadedBytes));
 
     ImGui::Separator();
     ImGui::Text("Lighting");
@@ -0,0 +1,56 @@
+#include "Container/utility/GuiTableRowModel.h"
+
+#include <cctype>
+
+namespace container::ui {
+namespace {
+
+char FoldAscii(char c) {
+  return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+}
+
+} // namespace
+
+GuiRowTextFilter::GuiRowTextFilter(std::string_view needle)
+    : needle_(needle) {
+  std::ranges::transform(needle_, needle_.begin(), FoldAscii);
+}
+
+bool GuiRowTextFilter::matches(std::string_view haystack) const {
+  if (needle_.empty()) {
+    return true;
+  }
+  if (haystack.size() < needle_.size()) {
+    return false;
+  }
+  const auto match = std::search(
+      haystack.begin(), haystack.end(), needle_.begin(), needle_.end(),
+      [](char lhs, char rhs) { return FoldAscii(lhs) == rhs; });
+  return match != haystack.end();
+}
+
+int GuiRowCompareText(std::string_view lhs, std::string_view rhs) {
+  const size_t count = std::min(lhs.size(), rhs.size());
+  for (size_t i = 0u; i < count; ++i) {
+    const char left = FoldAscii(lhs[i]);
+    const char right = FoldAscii(rhs[i]);
+    if (left != right) {
+      return static_cast<unsigned char>(left) <
+                     static_cast<unsigned char>(right)
+                 ? -1
+                 : 1;
+    }
+  }
+  if (lhs.size() != rhs.size()) {
+    return lhs.size() < rhs.size() ? -1 : 1;
+  }
+  const int exact = lhs.compare(rhs);
+  return exact < 0 ? -1 : (exact > 0 ? 1 : 0);
+}
+
+int GuiClipperItemCount(size_t rowCount) {
+  return static_cast<int>(std::min<size_t>(
+      rowCount, static_cast<size_t>(std::numeric_limits<int>::max())));
+}
+
+} // namespace container::ui
@@ -1628,7 +1628,7 @@ bool SceneManager::isMaterialUnlit(uint32_t materialIndex) const {
 /* ---------- Vulkan setup ---------- */
 
 void SceneManager::createDescriptorSetLayout() {
-  std::array<VkDescriptorSetLayoutBinding, 7> bindings{};
+  std::array<VkDescriptorSetLayoutBinding, 8> bindings{};
 
   bindings[0] = {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1,
                  VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_GEOMETRY_BIT |
@@ -1661,11 +1661,16 @@ void SceneManager::createDescriptorSetLayout() {
                      VK_SHADER_STAGE_FRAGMENT_BIT,
                  nullptr};
 
-  std::array<VkDescriptorBindingFlags, 7> bindingFlags{
+  // Compacted instance lists for GPU-culled draws. GpuCullManager owns the
+  // buffer and writes it when it records the frustum cull pass.
+  bindings[7] = {7, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1,
+                 VK_SHADER_STAGE_VERTEX_BIT, nullptr};
+
+  std::array<VkDescriptorBindingFlags, 8> bindingFlags{
       0, 0, 0, 0, 0,
       VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT |
           VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT,
-      0};
+      0, VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT};
 
   descriptorSetLayout_ = pipelineManager_->createDescriptorSetLayout(
       std::vector<VkDescriptorSetLayoutBinding>(bindings.begin(),
@@ -1766,6 +1771,7 @@ void SceneManager::loadGltfAssets() {
   authoredPointLights_.clear();
   authoredDirectionalLights_.clear();
   authoredAreaLights_.clear();
+  ++authoredLightRevision_;
 
    if (isDefaultSceneRequest(config_.modelPath)) {
     loadDefaultTestSceneAssets();
@@ -1927,6 +1933,7 @@ void SceneManager::collectAuthoredPunctualLights() {
   authoredPointLights_.clear();
   authoredDirectionalLights_.clear();
   authoredAreaLights_.clear();
+  ++authoredLightRevision_;
   if (gltfModel_.nodes.empty()) {
     return;
   }
@@ -2366,7 +2373,7 @@ void SceneManager::allocateDescriptorSets(uint32_t descriptorSetCount) {
 
   std::vector<VkDescriptorPoolSize> poolSizes = {
       {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, setCount * 2u},
-      {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, setCount * 3u},
+      {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, setCount * 4u},
       {VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
        textureDescriptorCapacity_ * setCount},
       {VK_DESCRIPTOR_TYPE_SAMPLER,
@@ -2554,6 +2561,7 @@ void SceneManager::resetLoadedAssets() {
   authoredPointLights_.clear();
   authoredDirectionalLights_.clear();
   authoredAreaLights_.clear();
+  ++authoredLightRevision_;
 }
 
 }  // namespace container::scene
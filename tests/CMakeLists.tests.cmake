@@ -12,11 +12,14 @@ set(TEST_PLATFORM_DIR "${TESTS_DIR}/platform")
 set(TEST_RENDERER_DIR "${TESTS_DIR}/renderer")
 set(TEST_RENDERER_BIM_DIR "${TEST_RENDERER_DIR}/bim")
 set(TEST_RENDERER_CORE_DIR "${TEST_RENDERER_DIR}/core")
+set(TEST_RENDERER_CULLING_DIR "${TEST_RENDERER_DIR}/culling")
 set(TEST_RENDERER_DEFERRED_DIR "${TEST_RENDERER_DIR}/deferred")
+set(TEST_RENDERER_LIGHTING_DIR "${TEST_RENDERER_DIR}/lighting")
 set(TEST_RENDERER_PICKING_DIR "${TEST_RENDERER_DIR}/picking")
 set(TEST_RENDERER_SCENE_DIR "${TEST_RENDERER_DIR}/scene")
 set(TEST_RENDERER_SHADOW_DIR "${TEST_RENDERER_DIR}/shadow")
 set(TEST_SCENE_DIR "${TESTS_DIR}/scene")
+set(TEST_SUPPORT_DIR "${TESTS_DIR}/support")
 set(TEST_UI_DIR "${TESTS_DIR}/ui")
 set(TEST_VALIDATION_DIR "${TESTS_DIR}/validation")
 set(TEST_CMAKE_DIR "${TESTS_DIR}/cmake")
@@ -100,6 +103,23 @@ add_custom_test(ecs_tests
     VulkanSceneRenderer_ecs  VulkanSceneRenderer_scene
 )
 
+add_custom_test(light_publish_tracker_tests
+    ${TEST_RENDERER_LIGHTING_DIR}/light_publish_tracker_tests.cpp  ""  ${TEST_RESULTS_DIR}
+    VulkanSceneRenderer_renderer
+)
+target_sources(light_publish_tracker_tests PRIVATE
+    ${TEST_SUPPORT_DIR}/allocation_counter.cpp
+)
+
+add_custom_test(light_cluster_tests
+    ${TEST_RENDERER_LIGHTING_DIR}/light_cluster_tests.cpp  ""  ${TEST_RESULTS_DIR}
+    Dep_Math
+)
+target_sources(light_cluster_tests PRIVATE
+    ${CMAKE_SOURCE_DIR}/src/renderer/lighting/LightBvh.cpp
+    ${TEST_SUPPORT_DIR}/light_cluster_reference.cpp
+)
+
 add_custom_test(scene_graph_tests
     ${TEST_SCENE_DIR}/scene_graph_tests.cpp  ""  ${TEST_RESULTS_DIR}
     VulkanSceneRenderer_scene
@@ -115,16 +135,44 @@ add_custom_test(gltf_loader_tests
     VulkanSceneRenderer_geometry
 )
 
+add_custom_test(gltf_accessor_decoder_tests
+    ${TEST_GEOMETRY_DIR}/gltf_accessor_decoder_tests.cpp  ""  ${TEST_RESULTS_DIR}
+    VulkanSceneRenderer_geometry
+)
+
+add_custom_test(gltf_parallel_loader_tests
+    ${TEST_GEOMETRY_DIR}/gltf_parallel_loader_tests.cpp  ""  ${TEST_RESULTS_DIR}
+    VulkanSceneRenderer_geometry
+)
+
 add_custom_test(dotbim_loader_tests
     ${TEST_GEOMETRY_DIR}/dotbim_loader_tests.cpp  ""  ${TEST_RESULTS_DIR}
     VulkanSceneRenderer_geometry
 )
 
+add_custom_test(dotbim_stream_loader_tests
+    ${TEST_GEOMETRY_DIR}/dotbim_stream_loader_tests.cpp  ""  ${TEST_RESULTS_DIR}
+    VulkanSceneRenderer_geometry
+)
+target_sources(dotbim_stream_loader_tests PRIVATE
+    ${TEST_SUPPORT_DIR}/allocation_counter.cpp
+)
+
 add_custom_test(ifc_tessellated_loader_tests
     ${TEST_GEOMETRY_DIR}/ifc_tessellated_loader_tests.cpp  ""  ${TEST_RESULTS_DIR}
     VulkanSceneRenderer_geometry
 )
 
+add_custom_test(ifc_parallel_loader_tests
+    ${TEST_GEOMETRY_DIR}/ifc_parallel_loader_tests.cpp  ""  ${TEST_RESULTS_DIR}
+    VulkanSceneRenderer_geometry
+)
+
+add_custom_test(mesh_optimizer_tests
+    ${TEST_GEOMETRY_DIR}/mesh_optimizer_tests.cpp  ""  ${TEST_RESULTS_DIR}
+    VulkanSceneRenderer_geometry
+)
+
 add_custom_test(ifcx_loader_tests
     ${TEST_GEOMETRY_DIR}/ifcx_loader_tests.cpp  ""  ${TEST_RESULTS_DIR}
     VulkanSceneRenderer_geometry
@@ -143,6 +191,11 @@ target_compile_definitions(usd_loader_tests PRIVATE
 )
 add_dependencies(usd_loader_tests generate_models)
 
+add_custom_test(usd_tokenizer_tests
+    ${TEST_GEOMETRY_DIR}/usd_tokenizer_tests.cpp  ""  ${TEST_RESULTS_DIR}
+    VulkanSceneRenderer_geometry
+)
+
 add_custom_test(sample_model_regression_tests
     ${TEST_GEOMETRY_DIR}/sample_model_regression_tests.cpp  ""  ${TEST_RESULTS_DIR}
     VulkanSceneRenderer_geometry
@@ -164,6 +217,11 @@ add_custom_test(bcf_viewpoint_tests
     VulkanSceneRenderer_renderer
 )
 
+add_custom_test(gui_table_row_model_tests
+    ${TEST_UI_DIR}/gui_table_row_model_tests.cpp  ""  ${TEST_RESULTS_DIR}
+    VulkanSceneRenderer_ui
+)
+
 add_custom_test(rendering_convention_tests
     ${TEST_VALIDATION_DIR}/rendering_convention_tests.cpp  ""  ${TEST_RESULTS_DIR}
     Dep_Math
@@ -190,6 +248,16 @@ add_custom_test(command_buffer_scope_recorder_tests
     VulkanSceneRenderer_renderer
 )
 
+add_custom_test(frame_arena_tests
+    ${TEST_RENDERER_CORE_DIR}/frame_arena_tests.cpp  ""  ${TEST_RESULTS_DIR}
+    VulkanSceneRenderer_renderer
+)
+
+add_custom_test(instance_cull_packing_tests
+    ${TEST_RENDERER_CULLING_DIR}/instance_cull_packing_tests.cpp  ""  ${TEST_RESULTS_DIR}
+    VulkanSceneRenderer_renderer
+)
+
 add_custom_test(deferred_raster_post_process_tests
     ${TEST_RENDERER_DEFERRED_DIR}/deferred_raster_post_process_tests.cpp  ""  ${TEST_RESULTS_DIR}
     VulkanSceneRenderer_renderer
@@ -310,6 +378,11 @@ add_custom_test(scene_viewport_tests
     VulkanSceneRenderer_renderer
 )
 
+add_custom_test(loose_octree_tests
+    ${TEST_RENDERER_SCENE_DIR}/loose_octree_tests.cpp  ""  ${TEST_RESULTS_DIR}
+    VulkanSceneRenderer_renderer
+)
+
 add_custom_test(scene_opaque_draw_planner_tests
     ${TEST_RENDERER_SCENE_DIR}/scene_opaque_draw_planner_tests.cpp  ""  ${TEST_RESULTS_DIR}
     VulkanSceneRenderer_renderer
@@ -400,6 +473,11 @@ add_custom_test(bim_measurement_snapping_tests
     VulkanSceneRenderer_renderer
 )
 
+add_custom_test(bim_snap_feature_grid_tests
+    ${TEST_RENDERER_BIM_DIR}/bim_snap_feature_grid_tests.cpp  ""  ${TEST_RESULTS_DIR}
+    VulkanSceneRenderer_renderer
+)
+
 add_custom_test(bim_schedule_extractor_tests
     ${TEST_RENDERER_BIM_DIR}/bim_schedule_extractor_tests.cpp  ""  ${TEST_RESULTS_DIR}
     Dep_Math
@@ -452,6 +530,11 @@ add_custom_test(bim_frame_gpu_visibility_recorder_tests
     VulkanSceneRenderer_renderer
 )
 
+add_custom_test(bim_element_metadata_store_tests
+    ${TEST_RENDERER_BIM_DIR}/bim_element_metadata_store_tests.cpp  ""  ${TEST_RESULTS_DIR}
+    VulkanSceneRenderer_renderer
+)
+
 add_custom_test(bim_metadata_catalog_tests
     ${TEST_RENDERER_BIM_DIR}/bim_metadata_catalog_tests.cpp  ""  ${TEST_RESULTS_DIR}
     VulkanSceneRenderer_renderer
@@ -462,6 +545,19 @@ add_custom_test(bim_metadata_index_tests
     VulkanSceneRenderer_renderer
 )
 
+add_custom_test(bim_object_bitmap_tests
+    ${TEST_RENDERER_BIM_DIR}/bim_object_bitmap_tests.cpp  ""  ${TEST_RESULTS_DIR}
+    VulkanSceneRenderer_renderer
+)
+
+add_custom_test(bim_object_ordering_tests
+    ${TEST_RENDERER_BIM_DIR}/bim_object_ordering_tests.cpp  ""  ${TEST_RESULTS_DIR}
+    Dep_Math
+)
+target_sources(bim_object_ordering_tests PRIVATE
+    ${CMAKE_SOURCE_DIR}/src/renderer/bim/BimObjectOrdering.cpp
+)
+
 add_custom_test(bim_primitive_pass_planner_tests
     ${TEST_RENDERER_BIM_DIR}/bim_primitive_pass_planner_tests.cpp  ""  ${TEST_RESULTS_DIR}
     VulkanSceneRenderer_renderer
@@ -595,6 +691,16 @@ add_custom_test(bim_section_cap_builder_tests
 )
 target_sources(bim_section_cap_builder_tests PRIVATE
     ${CMAKE_SOURCE_DIR}/src/renderer/bim/BimSectionCapBuilder.cpp
+    ${TEST_SUPPORT_DIR}/bim_section_cap_reference.cpp
+)
+
+add_custom_test(bim_section_cap_cache_tests
+    ${TEST_RENDERER_BIM_DIR}/bim_section_cap_cache_tests.cpp  ""  ${TEST_RESULTS_DIR}
+    Dep_Math
+)
+target_sources(bim_section_cap_cache_tests PRIVATE
+    ${CMAKE_SOURCE_DIR}/src/renderer/bim/BimSectionCapBuilder.cpp
+    ${CMAKE_SOURCE_DIR}/src/renderer/bim/BimSectionCapCache.cpp
 )
 
 add_custom_test(realistic_rendering_validation_tests
@@ -624,6 +730,15 @@ add_custom_test(renderer_telemetry_tests
     ${TEST_RENDERER_CORE_DIR}/renderer_telemetry_tests.cpp  ""  ${TEST_RESULTS_DIR}
     VulkanSceneRenderer_renderer
 )
+target_sources(renderer_telemetry_tests PRIVATE
+    ${TEST_SUPPORT_DIR}/allocation_counter.cpp
+)
+
+add_custom_test(renderer_telemetry_trace_tests
+    ${TEST_RENDERER_CORE_DIR}/renderer_telemetry_trace_tests.cpp  ""  ${TEST_RESULTS_DIR}
+    VulkanSceneRenderer_renderer
+    nlohmann_json::nlohmann_json
+)
 
 # ── Tests that need Vulkan / windowing runtime ───────────────────────────────
 
@@ -342,6 +342,31 @@ TEST(ECS_World, ReplacePointLightsClearsPreviousLightEntitiesOnly) {
   EXPECT_EQ(world.entityCount(), 3u);
 }
 
+TEST(ECS_World, PointLightRevisionOnlyChangesWithLightEntities) {
+  container::scene::SceneGraph graph;
+  graph.createNode(glm::mat4(1.0f), 0, true, 0);
+
+  container::ecs::World world;
+  const uint64_t initial = world.pointLightRevision();
+  world.syncFromSceneGraph(graph);
+  (void)world.setActiveCamera(container::gpu::CameraData{});
+  EXPECT_EQ(world.pointLightRevision(), initial);
+
+  world.replacePointLights(std::vector<container::gpu::PointLightData>(3));
+  const uint64_t published = world.pointLightRevision();
+  EXPECT_NE(published, initial);
+
+  std::vector<container::gpu::PointLightData> visited;
+  world.forEachPointLight([&](const container::ecs::LightComponent &light) {
+    visited.push_back(light.data);
+  });
+  EXPECT_EQ(visited.size(), 3u);
+  EXPECT_EQ(world.pointLightRevision(), published);
+
+  world.clearPointLights();
+  EXPECT_NE(world.pointLightRevision(), published);
+}
+
 // ============================================================================
 // World â€” active camera
 // ============================================================================
@@ -0,0 +1,312 @@
+#include "Container/geometry/DotBimLoader.h"
+
+#include "../support/allocation_counter.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+namespace dotbim = container::geometry::dotbim;
+
+using container::geometry::dotbim::detail::LoadFromJsonDom;
+using container::test::liveAllocationBytes;
+using container::test::peakAllocationBytes;
+using container::test::resetPeakAllocationBytes;
+
+void expectSameModel(const dotbim::Model &expected,
+                     const dotbim::Model &actual) {
+  ASSERT_EQ(expected.vertices.size(), actual.vertices.size());
+  EXPECT_EQ(std::memcmp(expected.vertices.data(), actual.vertices.data(),
+                        expected.vertices.size() *
+                            sizeof(expected.vertices[0])),
+            0);
+  EXPECT_EQ(expected.indices, actual.indices);
+
+  ASSERT_EQ(expected.meshRanges.size(), actual.meshRanges.size());
+  for (size_t i = 0; i < expected.meshRanges.size(); ++i) {
+    const dotbim::MeshRange &lhs = expected.meshRanges[i];
+    const dotbim::MeshRange &rhs = actual.meshRanges[i];
+    EXPECT_EQ(lhs.meshId, rhs.meshId) << "mesh " << i;
+    EXPECT_EQ(lhs.firstIndex, rhs.firstIndex) << "mesh " << i;
+    EXPECT_EQ(lhs.indexCount, rhs.indexCount) << "mesh " << i;
+    EXPECT_EQ(lhs.boundsCenter, rhs.boundsCenter) << "mesh " << i;
+    EXPECT_EQ(lhs.boundsRadius, rhs.boundsRadius) << "mesh " << i;
+  }
+
+  ASSERT_EQ(expected.elements.size(), actual.elements.size());
+  for (size_t i = 0; i < expected.elements.size(); ++i) {
+    const dotbim::Element &lhs = expected.elements[i];
+    const dotbim::Element &rhs = actual.elements[i];
+    SCOPED_TRACE(i);
+    EXPECT_EQ(lhs.meshId, rhs.meshId);
+    EXPECT_EQ(std::memcmp(&lhs.transform, &rhs.transform,
+                          sizeof(lhs.transform)),
+              0);
+    EXPECT_EQ(lhs.color, rhs.color);
+    EXPECT_EQ(lhs.guid, rhs.guid);
+    EXPECT_EQ(lhs.type, rhs.type);
+    EXPECT_EQ(lhs.displayName, rhs.displayName);
+    EXPECT_EQ(lhs.objectType, rhs.objectType);
+    EXPECT_EQ(lhs.storeyName, rhs.storeyName);
+    EXPECT_EQ(lhs.storeyId, rhs.storeyId);
+    EXPECT_EQ(lhs.materialName, rhs.materialName);
+    EXPECT_EQ(lhs.materialCategory, rhs.materialCategory);
+    EXPECT_EQ(lhs.discipline, rhs.discipline);
+    EXPECT_EQ(lhs.phase, rhs.phase);
+    EXPECT_EQ(lhs.fireRating, rhs.fireRating);
+    EXPECT_EQ(lhs.loadBearing, rhs.loadBearing);
+    EXPECT_EQ(lhs.status, rhs.status);
+    EXPECT_EQ(lhs.sourceId, rhs.sourceId);
+    ASSERT_EQ(lhs.properties.size(), rhs.properties.size());
+    for (size_t p = 0; p < lhs.properties.size(); ++p) {
+      EXPECT_EQ(lhs.properties[p].set, rhs.properties[p].set);
+      EXPECT_EQ(lhs.properties[p].name, rhs.properties[p].name);
+      EXPECT_EQ(lhs.properties[p].value, rhs.properties[p].value);
+      EXPECT_EQ(lhs.properties[p].category, rhs.properties[p].category);
+    }
+  }
+
+  ASSERT_EQ(expected.relationships.size(), actual.relationships.size());
+  for (size_t i = 0; i < expected.relationships.size(); ++i) {
+    EXPECT_EQ(expected.relationships[i].fromGuid,
+              actual.relationships[i].fromGuid);
+    EXPECT_EQ(expected.relationships[i].toGuid,
+              actual.relationships[i].toGuid);
+    EXPECT_EQ(expected.relationships[i].kind, actual.relationships[i].kind);
+    EXPECT_EQ(expected.relationships[i].label, actual.relationships[i].label);
+  }
+
+  EXPECT_EQ(expected.unitMetadata.importScale,
+            actual.unitMetadata.importScale);
+  const dotbim::ModelGeoreferenceMetadata &lhsGeo =
+      expected.georeferenceMetadata;
+  const dotbim::ModelGeoreferenceMetadata &rhsGeo = actual.georeferenceMetadata;
+  EXPECT_EQ(lhsGeo.hasSourceUpAxis, rhsGeo.hasSourceUpAxis);
+  EXPECT_EQ(lhsGeo.sourceUpAxis, rhsGeo.sourceUpAxis);
+  EXPECT_EQ(lhsGeo.hasCoordinateOffset, rhsGeo.hasCoordinateOffset);
+  EXPECT_EQ(lhsGeo.coordinateOffset, rhsGeo.coordinateOffset);
+  EXPECT_EQ(lhsGeo.crsName, rhsGeo.crsName);
+  EXPECT_EQ(lhsGeo.crsCode, rhsGeo.crsCode);
+}
+
+std::string loadError(dotbim::Model (*load)(std::string_view, float),
+                      std::string_view json) {
+  try {
+    (void)load(json, 1.0f);
+  } catch (const std::exception &error) {
+    return error.what();
+  }
+  return {};
+}
+
+TEST(DotBimStreamLoader, MatchesDomLoaderOnAwkwardDocuments) {
+  const std::vector<std::string_view> documents = {
+      R"json({
+  "info": {"georeference": {"sourceUpAxis": "Z", "crsCode": "2056",
+                            "coordinateOffset": [2600000, 1200000, 400]}},
+  "elements": [
+    {"mesh_id": 4, "guid": "a", "type": "Slab", "name": "Floor",
+     "storey_name": "Level 1", "loadBearing": false, "phase": 3,
+     "vector": {"x": 1, "y": 2, "z": 3},
+     "rotation": {"qx": 0, "qy": 0, "qz": 0.7071068, "qw": 0.7071068},
+     "color": {"r": 200, "g": 100, "b": 50, "a": 128},
+     "properties": [{"set": "P", "name": "n", "value": [1, {"x": null}]}],
+     "info": {"Name": "Floor", "Nested": {"deep": [true, false]}}},
+    {"mesh_id": 9, "guid": "b", "name": "first", "name": "second"},
+    {"mesh_id": 4, "rotation": {"qx": 0, "qy": 0, "qz": 0, "qw": 0}}
+  ],
+  "meshes": [
+    {"mesh_id": 4, "coordinates": [0, 0, 0, 1.5, 0, 0, 0, 2, 0, 1, 1, 1],
+     "indices": [0, 1, 2, 0, 2, 3], "extra": {"ignored": [1, 2, 3]}},
+    {"indices": [2, 1, 0], "mesh_id": 9,
+     "vertices_coordinates": [0, 0, 0, 0, 0, 1, 18446744073709551615, 0, 0]},
+    {"mesh_id": 12, "coordinates": [], "indices": []}
+  ],
+  "relationships": [{"from": "a", "to": "b", "kind": "hosts"}],
+  "schema_version": "1.1.0"
+})json",
+      R"json({"meshes": [], "elements": []})json",
+      R"json({"meshes": 1, "meshes": [], "elements": [{"mesh_id": 0}],
+              "elements": []})json",
+      R"json({"meshes": [{"mesh_id": 1, "coordinates": [0, 0, 0],
+                          "indices": [0, 0, 0], "coordinates": [1, 2, 3]}],
+              "elements": []})json",
+  };
+  for (size_t i = 0; i < documents.size(); ++i) {
+    SCOPED_TRACE(i);
+    const dotbim::Model dom = LoadFromJsonDom(documents[i], 2.0f);
+    const dotbim::Model streamed = dotbim::LoadFromJson(documents[i], 2.0f);
+    expectSameModel(dom, streamed);
+  }
+}
+
+TEST(DotBimStreamLoader, ReportsTheSameErrorsAsDomLoader) {
+  const std::vector<std::string_view> documents = {
+      R"json({"elements": []})json",
+      R"json({"meshes": []})json",
+      R"json({"meshes": {}, "elements": 3})json",
+      R"json([{"meshes": [], "elements": []}])json",
+      R"json("meshes")json",
+      R"json({"meshes": [], "elements": [], )json",
+      R"json({"meshes": [{"coordinates": [0, 0, 0], "indices": []}],
+              "elements": []})json",
+      R"json({"meshes": [{"mesh_id": 1, "coordinates": [0, 0, 0],
+                          "indices": []},
+                         {"mesh_id": 1, "coordinates": [], "indices": []}],
+              "elements": []})json",
+      R"json({"meshes": [{"mesh_id": 1, "coordinates": [0, 0],
+                          "indices": []}], "elements": []})json",
+      R"json({"meshes": [{"mesh_id": 1, "coordinates": [0, "0", 0],
+                          "indices": []}], "elements": []})json",
+      R"json({"meshes": [{"mesh_id": 1, "coordinates": [0, [0], 0],
+                          "indices": []}], "elements": []})json",
+      R"json({"meshes": [{"mesh_id": 1, "coordinates": 5, "indices": []}],
+              "elements": []})json",
+      R"json({"meshes": [{"mesh_id": 1, "vertices_coordinates": [0, 0, 0]}],
+              "elements": []})json",
+      R"json({"meshes": [{"mesh_id": 1, "coordinates": [0, 0, 0],
+                          "indices": [0, 0]}], "elements": []})json",
+      R"json({"meshes": [{"mesh_id": 1, "coordinates": [0, 0, 0],
+                          "indices": [0, 1.0, 7]}], "elements": []})json",
+      R"json({"meshes": [{"mesh_id": 1, "coordinates": [0, 0, 0],
+                          "indices": [0, 7, 1.0]}], "elements": []})json",
+      R"json({"meshes": [{"mesh_id": 1, "coordinates": [0, 0, 0],
+                          "indices": [0, -1, 0]}], "elements": []})json",
+      R"json({"meshes": [[1, 2, 3]], "elements": []})json",
+      R"json({"meshes": [{"mesh_id": 1, "coordinates": [], "indices": [0,
+                          0, 0]}], "elements": [{"guid": "x"}]})json",
+      R"json({"meshes": [], "elements": [{"mesh_id": 1}, 4]})json",
+      R"json({"meshes": [], "elements": [{"mesh_id": -3}]})json",
+  };
+  for (size_t i = 0; i < documents.size(); ++i) {
+    SCOPED_TRACE(documents[i]);
+    const std::string domError = loadError(LoadFromJsonDom, documents[i]);
+    ASSERT_FALSE(domError.empty());
+    EXPECT_EQ(loadError(dotbim::LoadFromJson, documents[i]), domError);
+  }
+}
+
+// Writes a triangle-soup .bim of roughly `targetBytes`, the layout IFC
+// exporters produce: every triangle owns its three vertices.
+std::filesystem::path writeSyntheticDotBim(std::string_view name,
+                                           size_t targetBytes) {
+  const std::filesystem::path dir =
+      std::filesystem::temp_directory_path() / "container_dotbim_tests";
+  std::filesystem::create_directories(dir);
+  const std::filesystem::path path = dir / (std::string(name) + ".bim");
+  std::ofstream out(path, std::ios::binary);
+  out << "{\"schema_version\": \"1.1.0\",\n\"meshes\": [\n";
+
+  constexpr uint32_t kTrianglesPerMesh = 2048u;
+  std::string line;
+  uint32_t meshCount = 0;
+  while (static_cast<size_t>(out.tellp()) < targetBytes) {
+    out << (meshCount > 0 ? ",\n" : "") << "{\"mesh_id\": " << meshCount
+        << ", \"coordinates\": [";
+    for (uint32_t v = 0; v < kTrianglesPerMesh * 3u; ++v) {
+      const uint32_t seed = v * 2654435761u + meshCount * 40503u;
+      line = std::to_string((seed % 100000u) * 0.001f) + ", " +
+             std::to_string(((seed >> 8u) % 100000u) * 0.001f) + ", " +
+             std::to_string(((seed >> 16u) % 100000u) * 0.001f);
+      out << (v > 0 ? ", " : "") << line;
+    }
+    out << "], \"indices\": [";
+    for (uint32_t i = 0; i < kTrianglesPerMesh * 3u; ++i) {
+      out << (i > 0 ? ", " : "") << i;
+    }
+    out << "]}";
+    ++meshCount;
+  }
+
+  out << "\n],\n\"elements\": [\n";
+  for (uint32_t mesh = 0; mesh < meshCount; ++mesh) {
+    out << (mesh > 0 ? ",\n" : "") << "{\"mesh_id\": " << mesh
+        << ", \"guid\": \"element-" << mesh
+        << "\", \"type\": \"IfcWall\", \"storeyName\": \"Level "
+        << mesh % 12u
+        << "\", \"vector\": {\"x\": 1, \"y\": 2, \"z\": 3}, \"properties\": "
+           "[{\"set\": \"Pset_WallCommon\", \"name\": \"IsExternal\", "
+           "\"value\": true}]}";
+  }
+  out << "\n]}\n";
+  return path;
+}
+
+struct LoadFootprint {
+  size_t peakBytes{0};
+  size_t retainedBytes{0};
+};
+
+template <typename Load> LoadFootprint measure(Load &&load) {
+  const size_t baseline = liveAllocationBytes();
+  resetPeakAllocationBytes();
+  dotbim::Model model = load();
+  LoadFootprint footprint{};
+  footprint.peakBytes = peakAllocationBytes() - baseline;
+  footprint.retainedBytes = liveAllocationBytes() - baseline;
+  return footprint;
+}
+
+size_t syntheticFileMegabytes() {
+  if (const char *value = std::getenv("CONTAINER_DOTBIM_STREAM_BENCH_MB")) {
+    const long megabytes = std::strtol(value, nullptr, 10);
+    if (megabytes > 0) {
+      return static_cast<size_t>(megabytes);
+    }
+  }
+  return 24u;
+}
+
+// Set CONTAINER_DOTBIM_STREAM_BENCH_MB=500 for the full-size measurement.
+TEST(DotBimStreamLoader, StreamingPeakMemoryStaysBelowDomPeak) {
+  const size_t megabytes = syntheticFileMegabytes();
+  const std::filesystem::path path =
+      writeSyntheticDotBim("stream_peak", megabytes << 20u);
+  const size_t fileBytes = std::filesystem::file_size(path);
+
+  const LoadFootprint streamed =
+      measure([&] { return dotbim::LoadFromFile(path); });
+  const LoadFootprint dom = measure([&] {
+    std::ifstream file(path, std::ios::binary);
+    const std::string text((std::istreambuf_iterator<char>(file)),
+                           std::istreambuf_iterator<char>());
+    return LoadFromJsonDom(text);
+  });
+
+  RecordProperty("file_bytes", std::to_string(fileBytes));
+  RecordProperty("streamed_peak_bytes", std::to_string(streamed.peakBytes));
+  RecordProperty("dom_peak_bytes", std::to_string(dom.peakBytes));
+  RecordProperty("model_bytes", std::to_string(dom.retainedBytes));
+
+  // Beyond the model and its growth the streaming reader holds one mesh;
+  // the DOM path also holds the text and the whole document tree.
+  EXPECT_LT(streamed.peakBytes - streamed.retainedBytes,
+            (dom.peakBytes - dom.retainedBytes) / 2u);
+  EXPECT_LT(streamed.peakBytes, dom.peakBytes);
+
+  std::filesystem::remove(path);
+}
+
+TEST(DotBimStreamLoader, FileLoadMatchesDomLoader) {
+  const std::filesystem::path path =
+      writeSyntheticDotBim("stream_identity", 1u << 20u);
+  std::ifstream file(path, std::ios::binary);
+  const std::string text((std::istreambuf_iterator<char>(file)),
+                         std::istreambuf_iterator<char>());
+  expectSameModel(LoadFromJsonDom(text), dotbim::LoadFromFile(path));
+  std::filesystem::remove(path);
+}
+
+} // namespace
@@ -0,0 +1,197 @@
+#include "Container/geometry/GltfAccessorDecoder.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+using container::geometry::Vertex;
+using container::geometry::gltf::AccessorComponentType;
+using container::geometry::gltf::AccessorSource;
+using container::geometry::gltf::decodeAccessorComponent;
+using container::geometry::gltf::decodeAccessorFloats;
+using container::geometry::gltf::decodeVertexAttribute;
+using container::geometry::gltf::VertexAttribute;
+
+constexpr std::array<AccessorComponentType, 6> kComponentTypes{
+    AccessorComponentType::Byte,          AccessorComponentType::UnsignedByte,
+    AccessorComponentType::Short,         AccessorComponentType::UnsignedShort,
+    AccessorComponentType::UnsignedInt,   AccessorComponentType::Float,
+};
+
+size_t componentSize(AccessorComponentType type) {
+  switch (type) {
+    case AccessorComponentType::Byte:
+    case AccessorComponentType::UnsignedByte:
+      return 1;
+    case AccessorComponentType::Short:
+    case AccessorComponentType::UnsignedShort:
+      return 2;
+    case AccessorComponentType::UnsignedInt:
+    case AccessorComponentType::Float:
+      return 4;
+  }
+  return 0;
+}
+
+// Random element bytes, including the extreme values of every integer type
+// (e.g. -128 and -32768, which normalization clamps to -1).
+std::vector<uint8_t> makeAccessorBytes(AccessorComponentType type,
+                                       size_t count, size_t stride,
+                                       uint32_t components, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::vector<uint8_t> bytes(stride * (count - 1) +
+                             components * componentSize(type));
+  for (uint8_t& byte : bytes) {
+    byte = static_cast<uint8_t>(rng());
+  }
+  std::uniform_real_distribution<float> floats(-1000.0f, 1000.0f);
+  for (size_t i = 0; i < count; ++i) {
+    for (uint32_t c = 0; c < components; ++c) {
+      uint8_t* component = bytes.data() + i * stride + c * componentSize(type);
+      if (type == AccessorComponentType::Float) {
+        const float value = floats(rng);
+        std::memcpy(component, &value, sizeof(value));
+      } else if (i == 0) {
+        std::memset(component, c % 2 == 0 ? 0x00 : 0xff, componentSize(type));
+        if (c == 2) component[componentSize(type) - 1] = 0x80;
+      }
+    }
+  }
+  return bytes;
+}
+
+TEST(GltfAccessorDecoder, BulkDecodeMatchesPerComponentReference) {
+  constexpr size_t kCount = 67;
+  for (const AccessorComponentType type : kComponentTypes) {
+    for (const bool normalized : {false, true}) {
+      for (uint32_t components = 1; components <= 4; ++components) {
+        const size_t elementSize = components * componentSize(type);
+        for (const size_t padding : {size_t{0}, size_t{1}, size_t{4},
+                                     size_t{7}}) {
+          const size_t stride = elementSize + padding;
+          const std::vector<uint8_t> bytes = makeAccessorBytes(
+              type, kCount, stride, components,
+              static_cast<uint32_t>(stride * 31 + components));
+          const AccessorSource source{.data = bytes.data(),
+                                      .count = kCount,
+                                      .strideBytes = stride,
+                                      .componentType = type,
+                                      .componentCount = components,
+                                      .normalized = normalized};
+
+          for (uint32_t outComponents = 1; outComponents <= components;
+               ++outComponents) {
+            // Interleave the output with a canary lane to catch overruns.
+            const size_t outStride = (outComponents + 1) * sizeof(float);
+            std::vector<float> decoded(kCount * (outComponents + 1), -7.0f);
+            decodeAccessorFloats(source, outComponents, kCount,
+                                 decoded.data(), outStride);
+
+            for (size_t i = 0; i < kCount; ++i) {
+              for (uint32_t c = 0; c < outComponents; ++c) {
+                const float expected = decodeAccessorComponent(
+                    bytes.data() + i * stride + c * componentSize(type), type,
+                    normalized);
+                const float actual = decoded[i * (outComponents + 1) + c];
+                ASSERT_EQ(std::memcmp(&expected, &actual, sizeof(float)), 0)
+                    << "type " << static_cast<int>(type) << " normalized "
+                    << normalized << " components " << components
+                    << " stride " << stride << " element " << i
+                    << " component " << c;
+              }
+              ASSERT_EQ(decoded[i * (outComponents + 1) + outComponents],
+                        -7.0f);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(GltfAccessorDecoder, NormalizedSignedExtremesClampToMinusOne) {
+  const std::array<int16_t, 4> shorts{-32768, -32767, 0, 32767};
+  const AccessorSource source{
+      .data = reinterpret_cast<const uint8_t*>(shorts.data()),
+      .count = 1,
+      .strideBytes = sizeof(shorts),
+      .componentType = AccessorComponentType::Short,
+      .componentCount = 4,
+      .normalized = true};
+  std::array<float, 4> decoded{};
+  decodeAccessorFloats(source, 4, 1, decoded.data(), sizeof(decoded));
+  EXPECT_EQ(decoded, (std::array<float, 4>{-1.0f, -1.0f, 0.0f, 1.0f}));
+}
+
+TEST(GltfAccessorDecoder, VertexAttributesWriteOnlyTheirOwnField) {
+  constexpr size_t kCount = 5;
+  std::vector<uint8_t> colors(kCount * 4);
+  for (size_t i = 0; i < colors.size(); ++i) {
+    colors[i] = static_cast<uint8_t>(i * 13);
+  }
+  std::vector<float> tangents(kCount * 4);
+  for (size_t i = 0; i < tangents.size(); ++i) {
+    tangents[i] = static_cast<float>(i) * 0.25f - 1.0f;
+  }
+
+  std::vector<Vertex> vertices(kCount);
+  decodeVertexAttribute({.data = colors.data(),
+                         .count = kCount,
+                         .strideBytes = 4,
+                         .componentType = AccessorComponentType::UnsignedByte,
+                         .componentCount = 4,
+                         .normalized = true},
+                        VertexAttribute::Color, vertices);
+  decodeVertexAttribute(
+      {.data = reinterpret_cast<const uint8_t*>(tangents.data()),
+       .count = kCount,
+       .strideBytes = 4 * sizeof(float),
+       .componentType = AccessorComponentType::Float,
+       .componentCount = 4},
+      VertexAttribute::Tangent, vertices);
+
+  const Vertex defaults{};
+  for (size_t i = 0; i < kCount; ++i) {
+    EXPECT_EQ(vertices[i].color,
+              glm::vec3(colors[i * 4] / 255.0f, colors[i * 4 + 1] / 255.0f,
+                        colors[i * 4 + 2] / 255.0f));
+    EXPECT_EQ(vertices[i].tangent,
+              glm::vec4(tangents[i * 4], tangents[i * 4 + 1],
+                        tangents[i * 4 + 2], tangents[i * 4 + 3]));
+    EXPECT_EQ(vertices[i].position, defaults.position);
+    EXPECT_EQ(vertices[i].texCoord, defaults.texCoord);
+    EXPECT_EQ(vertices[i].texCoord1, defaults.texCoord1);
+    EXPECT_EQ(vertices[i].normal, defaults.normal);
+  }
+}
+
+TEST(GltfAccessorDecoder, RejectsShortAccessors) {
+  const std::array<float, 6> positions{};
+  const AccessorSource source{
+      .data = reinterpret_cast<const uint8_t*>(positions.data()),
+      .count = 3,
+      .strideBytes = 2 * sizeof(float),
+      .componentType = AccessorComponentType::Float,
+      .componentCount = 2};
+  std::vector<Vertex> vertices(3);
+  EXPECT_THROW(
+      decodeVertexAttribute(source, VertexAttribute::Position, vertices),
+      std::runtime_error);
+  vertices.resize(4);
+  EXPECT_THROW(
+      decodeVertexAttribute(source, VertexAttribute::TexCoord0, vertices),
+      std::runtime_error);
+  vertices.resize(3);
+  EXPECT_NO_THROW(
+      decodeVertexAttribute(source, VertexAttribute::TexCoord0, vertices));
+}
+
+}  // namespace
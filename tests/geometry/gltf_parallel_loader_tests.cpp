@@ -0,0 +1,268 @@
+#include "Container/geometry/GltfModelLoader.h"
+
+#include "../support/parallel_loader_fixture.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+using container::geometry::GltfLoadOptions;
+using container::geometry::Mesh;
+using container::geometry::Model;
+
+template <typename T>
+void appendValue(std::vector<char>& bytes, T value) {
+  const auto* raw = reinterpret_cast<const char*>(&value);
+  bytes.insert(bytes.end(), raw, raw + sizeof(T));
+}
+
+// Writes `primitiveCount` height-field patches of gridSize x gridSize
+// vertices. Primitives rotate through the loader's code paths: positions
+// only (generated normals), normals with flipped triangles (winding repair),
+// authored tangents with degenerate entries (tangent repair) and normals
+// with UVs (MikkTSpace generation).
+std::filesystem::path writePatchGridGltf(std::string_view name,
+                                         uint32_t primitiveCount,
+                                         uint32_t gridSize) {
+  const std::filesystem::path dir =
+      container::test::loaderTestDirectory("container_gltf_loader_tests");
+  const std::filesystem::path gltfPath = dir / (std::string(name) + ".gltf");
+  const std::filesystem::path binPath = dir / (std::string(name) + ".bin");
+
+  const uint32_t vertexCount = gridSize * gridSize;
+  std::vector<char> bytes;
+  std::ostringstream views;
+  std::ostringstream accessors;
+  std::ostringstream primitives;
+  uint32_t viewCount = 0;
+
+  const auto addView = [&](size_t begin, uint32_t componentType,
+                           uint32_t count, std::string_view type,
+                           std::string_view extra = {}) {
+    if (viewCount > 0) {
+      views << ",\n";
+      accessors << ",\n";
+    }
+    views << "    {\"buffer\": 0, \"byteOffset\": " << begin
+          << ", \"byteLength\": " << bytes.size() - begin << "}";
+    accessors << "    {\"bufferView\": " << viewCount
+              << ", \"componentType\": " << componentType
+              << ", \"count\": " << count << ", \"type\": \"" << type << "\""
+              << extra << "}";
+    while (bytes.size() % 4 != 0) bytes.push_back(0);
+    return viewCount++;
+  };
+
+  for (uint32_t p = 0; p < primitiveCount; ++p) {
+    const uint32_t variant = p % 4;
+    const float offset = static_cast<float>(p) * 1.5f;
+    const auto height = [p](uint32_t x, uint32_t y) {
+      return 0.2f * std::sin(0.7f * static_cast<float>(x + p)) *
+             std::cos(0.5f * static_cast<float>(y));
+    };
+
+    size_t begin = bytes.size();
+    for (uint32_t y = 0; y < gridSize; ++y) {
+      for (uint32_t x = 0; x < gridSize; ++x) {
+        appendValue(bytes, offset + static_cast<float>(x) * 0.1f);
+        appendValue(bytes, static_cast<float>(y) * 0.1f);
+        appendValue(bytes, height(x, y));
+      }
+    }
+    const float extent = static_cast<float>(gridSize - 1) * 0.1f;
+    std::ostringstream bounds;
+    bounds << ", \"min\": [" << offset << ", 0, -0.2], \"max\": ["
+           << offset + extent << ", " << extent << ", 0.2]";
+    std::ostringstream attributes;
+    attributes << "\"POSITION\": "
+               << addView(begin, 5126, vertexCount, "VEC3", bounds.str());
+
+    if (variant != 0) {
+      begin = bytes.size();
+      for (uint32_t i = 0; i < vertexCount; ++i) {
+        appendValue(bytes, 0.0f);
+        appendValue(bytes, 0.0f);
+        appendValue(bytes, 1.0f);
+      }
+      attributes << ", \"NORMAL\": "
+                 << addView(begin, 5126, vertexCount, "VEC3");
+    }
+    if (variant >= 2) {
+      begin = bytes.size();
+      for (uint32_t y = 0; y < gridSize; ++y) {
+        for (uint32_t x = 0; x < gridSize; ++x) {
+          appendValue(bytes, static_cast<uint16_t>(x * 65535u / gridSize));
+          appendValue(bytes, static_cast<uint16_t>(y * 65535u / gridSize));
+        }
+      }
+      attributes << ", \"TEXCOORD_0\": "
+                 << addView(begin, 5123, vertexCount, "VEC2",
+                            ", \"normalized\": true");
+    }
+    if (variant == 2) {
+      begin = bytes.size();
+      for (uint32_t i = 0; i < vertexCount; ++i) {
+        const bool degenerate = i % 5 == 0;
+        appendValue(bytes, degenerate ? 0.0f : 1.0f);
+        appendValue(bytes, 0.0f);
+        appendValue(bytes, 0.0f);
+        appendValue(bytes, 1.0f);
+      }
+      attributes << ", \"TANGENT\": "
+                 << addView(begin, 5126, vertexCount, "VEC4");
+    }
+
+    begin = bytes.size();
+    uint32_t indexCount = 0;
+    for (uint32_t y = 0; y + 1 < gridSize; ++y) {
+      for (uint32_t x = 0; x + 1 < gridSize; ++x) {
+        const auto i0 = static_cast<uint16_t>(y * gridSize + x);
+        const auto i1 = static_cast<uint16_t>(i0 + 1);
+        const auto i2 = static_cast<uint16_t>(i0 + gridSize);
+        const auto i3 = static_cast<uint16_t>(i2 + 1);
+        const bool flip = variant == 1 && (x + y) % 7 == 0;
+        for (const uint16_t index :
+             {i0, flip ? i3 : i1, flip ? i1 : i3, i0, i3, i2}) {
+          appendValue(bytes, index);
+        }
+        indexCount += 6;
+      }
+    }
+    const uint32_t indices = addView(begin, 5123, indexCount, "SCALAR");
+
+    primitives << (p > 0 ? ",\n" : "") << "    {\"attributes\": {"
+               << attributes.str() << "}, \"indices\": " << indices
+               << ", \"mode\": 4, \"material\": " << p % 3 << "}";
+  }
+
+  {
+    std::ofstream bin(binPath, std::ios::binary);
+    bin.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+  }
+
+  std::ofstream gltf(gltfPath);
+  gltf << "{\n"
+       << "  \"asset\": {\"version\": \"2.0\"},\n"
+       << "  \"buffers\": [{\"uri\": \""
+       << binPath.filename().generic_string()
+       << "\", \"byteLength\": " << bytes.size() << "}],\n"
+       << "  \"bufferViews\": [\n" << views.str() << "\n  ],\n"
+       << "  \"accessors\": [\n" << accessors.str() << "\n  ],\n"
+       << "  \"materials\": [{}, {}, {}],\n"
+       << "  \"meshes\": [{\"primitives\": [\n" << primitives.str()
+       << "\n  ]}],\n"
+       << "  \"nodes\": [{\"mesh\": 0}],\n"
+       << "  \"scenes\": [{\"nodes\": [0]}],\n"
+       << "  \"scene\": 0\n"
+       << "}\n";
+  return gltfPath;
+}
+
+Model loadWithWorkers(const std::filesystem::path& path, size_t workers) {
+  return container::geometry::gltf::LoadModelFromFile(
+      path.string(), GltfLoadOptions{.workerCount = workers});
+}
+
+void expectByteIdentical(const Model& expected, const Model& actual) {
+  ASSERT_EQ(expected.meshes().size(), actual.meshes().size());
+  for (size_t m = 0; m < expected.meshes().size(); ++m) {
+    const Mesh& lhs = expected.meshes()[m];
+    const Mesh& rhs = actual.meshes()[m];
+    ASSERT_EQ(lhs.vertices().size(), rhs.vertices().size()) << "mesh " << m;
+    ASSERT_EQ(lhs.indices(), rhs.indices()) << "mesh " << m;
+    EXPECT_EQ(lhs.materialIndex(), rhs.materialIndex()) << "mesh " << m;
+    EXPECT_EQ(lhs.disableBackfaceCulling(), rhs.disableBackfaceCulling())
+        << "mesh " << m;
+    EXPECT_EQ(std::memcmp(lhs.vertices().data(), rhs.vertices().data(),
+                          lhs.vertices().size() * sizeof(lhs.vertices()[0])),
+              0)
+        << "mesh " << m;
+  }
+  ASSERT_EQ(expected.vertices().size(), actual.vertices().size());
+  EXPECT_EQ(std::memcmp(expected.vertices().data(), actual.vertices().data(),
+                        expected.vertices().size() *
+                            sizeof(expected.vertices()[0])),
+            0);
+  EXPECT_EQ(expected.indices(), actual.indices());
+}
+
+TEST(GltfParallelLoader, ParallelOutputMatchesSerialByteForByte) {
+  const auto path = writePatchGridGltf("parallel_patches", 37, 9);
+  const Model serial = loadWithWorkers(path, 1);
+  ASSERT_EQ(serial.meshes().size(), 37u);
+  for (size_t m = 0; m < serial.meshes().size(); ++m) {
+    EXPECT_EQ(serial.meshes()[m].materialIndex(), static_cast<int32_t>(m % 3));
+  }
+
+  for (const size_t workers : container::test::kParallelLoaderWorkerCounts) {
+    SCOPED_TRACE(workers);
+    expectByteIdentical(serial, loadWithWorkers(path, workers));
+  }
+}
+
+TEST(GltfParallelLoader, FirstFailingPrimitiveIsReported) {
+  // Primitive 2 points its indices at a VEC3 accessor and primitive 9 is not
+  // a triangle list. Both fail, with different errors; the lower index must
+  // win regardless of which worker finishes first.
+  const auto path = writePatchGridGltf("parallel_bad_primitives", 12, 4);
+  std::vector<std::string> lines;
+  {
+    std::ifstream in(path);
+    for (std::string line; std::getline(in, line);) {
+      lines.push_back(std::move(line));
+    }
+  }
+  size_t primitive = 0;
+  for (std::string& line : lines) {
+    if (line.find("{\"attributes\"") == std::string::npos) continue;
+    if (primitive == 2) {
+      const size_t indices = line.find("\"indices\": ");
+      const size_t end = line.find(',', indices);
+      line.replace(indices, end - indices, "\"indices\": 0");
+    } else if (primitive == 9) {
+      line.replace(line.find("\"mode\": 4"), 9, "\"mode\": 1");
+    }
+    ++primitive;
+  }
+  {
+    std::ofstream out(path);
+    for (const std::string& line : lines) out << line << '\n';
+  }
+
+  std::string serialError;
+  try {
+    (void)loadWithWorkers(path, 1);
+  } catch (const std::exception& error) {
+    serialError = error.what();
+  }
+  EXPECT_EQ(serialError, "glTF indices accessor must be scalar");
+  for (const size_t workers : {size_t{4}, size_t{12}}) {
+    SCOPED_TRACE(workers);
+    try {
+      (void)loadWithWorkers(path, workers);
+      ADD_FAILURE() << "expected a load failure";
+    } catch (const std::exception& error) {
+      EXPECT_EQ(serialError, error.what());
+    }
+  }
+}
+
+TEST(GltfParallelLoader, ManyPrimitivesRecordSerialAndParallelLoadTimes) {
+  const auto path = writePatchGridGltf("parallel_timing", 2000, 16);
+  container::test::recordSerialAndParallelLoadTimes(
+      [&](size_t workers) { return loadWithWorkers(path, workers); },
+      [](const Model& model) { EXPECT_EQ(model.meshes().size(), 2000u); });
+}
+
+}  // namespace
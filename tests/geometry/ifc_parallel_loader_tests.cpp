@@ -0,0 +1,239 @@
+#include "Container/geometry/IfcTessellatedLoader.h"
+
+#include "../support/parallel_loader_fixture.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+using container::geometry::ifc::IfcLoadOptions;
+using container::geometry::ifc::Model;
+
+// Writes a STEP file with `productCount` products that rotate through the
+// builder's geometry paths: coloured face-set patches of gridSize x gridSize
+// points, swept-solid walls with a single through opening, and mapped items
+// instancing one shared representation map. Every product hangs off a chain
+// of nested local placements and sits in a storey with a material.
+std::filesystem::path writeProductGridIfc(std::string_view name,
+                                          uint32_t productCount,
+                                          uint32_t gridSize) {
+  const std::filesystem::path path =
+      container::test::loaderTestDirectory("container_ifc_loader_tests") /
+      (std::string(name) + ".ifc");
+
+  std::ostringstream data;
+  data << "#1=IFCSIUNIT(*,.LENGTHUNIT.,.MILLI.,.METRE.);\n"
+       << "#2=IFCCARTESIANPOINT((0.,0.,0.));\n"
+       << "#3=IFCDIRECTION((0.,0.,1.));\n"
+       << "#4=IFCDIRECTION((1.,0.,0.));\n"
+       << "#5=IFCAXIS2PLACEMENT3D(#2,#3,#4);\n"
+       << "#6=IFCLOCALPLACEMENT($,#5);\n"
+       << "#7=IFCCARTESIANPOINT((0.,0.,3000.));\n"
+       << "#8=IFCAXIS2PLACEMENT3D(#7,#3,#4);\n"
+       << "#9=IFCLOCALPLACEMENT(#6,#8);\n"
+       << "#10=IFCBUILDINGSTOREY('storey-guid',$,'Level 01',$,$,#9,$,$,$);\n"
+       << "#11=IFCMATERIAL('Concrete',$,'Structural');\n"
+       << "#20=IFCCARTESIANPOINTLIST3D(((0.,0.,0.),(500.,0.,0.),(0.,500.,0.),"
+          "(0.,0.,500.)));\n"
+       << "#21=IFCTRIANGULATEDFACESET(#20,$,.T.,((1,2,3),(1,3,4),(1,4,2)),$);\n"
+       << "#22=IFCSHAPEREPRESENTATION($,'Body','Tessellation',(#21));\n"
+       << "#23=IFCREPRESENTATIONMAP(#5,#22);\n";
+
+  std::ostringstream products;
+  for (uint32_t p = 0; p < productCount; ++p) {
+    const uint32_t base = 100u + p * 40u;
+    const uint32_t variant = p % 3u;
+    const float offset = static_cast<float>(p) * 1500.0f;
+    const auto ref = [base](uint32_t local) {
+      return "#" + std::to_string(base + local);
+    };
+    const auto line = [&](uint32_t local, const std::string &value) {
+      data << ref(local) << "=" << value << ";\n";
+    };
+
+    line(0, "IFCCARTESIANPOINT((" + std::to_string(offset) + ",0.,0.))");
+    line(1, "IFCAXIS2PLACEMENT3D(" + ref(0) + ",#3,#4)");
+    line(2, "IFCLOCALPLACEMENT(#9," + ref(1) + ")");
+
+    std::string item;
+    if (variant == 0u) {
+      std::string points = "IFCCARTESIANPOINTLIST3D((";
+      for (uint32_t y = 0; y < gridSize; ++y) {
+        for (uint32_t x = 0; x < gridSize; ++x) {
+          points += (x | y) != 0u ? ",(" : "(";
+          points += std::to_string(x * 100u) + ".," +
+                    std::to_string(y * 100u) + ".," +
+                    std::to_string((x * 7u + y * 3u + p) % 11u * 10u) + ".)";
+        }
+      }
+      line(3, points + "))");
+      std::string faces = "IFCTRIANGULATEDFACESET(" + ref(3) + ",$,.T.,(";
+      std::string colorIndices = "(";
+      uint32_t faceCount = 0;
+      for (uint32_t y = 0; y + 1u < gridSize; ++y) {
+        for (uint32_t x = 0; x + 1u < gridSize; ++x) {
+          const uint32_t i = y * gridSize + x + 1u;
+          faces += faceCount != 0u ? ",(" : "(";
+          faces += std::to_string(i) + "," + std::to_string(i + 1u) + "," +
+                   std::to_string(i + gridSize) + "),(" +
+                   std::to_string(i + 1u) + "," +
+                   std::to_string(i + gridSize + 1u) + "," +
+                   std::to_string(i + gridSize) + ")";
+          colorIndices += faceCount != 0u ? ",1,2" : "1,2";
+          faceCount += 2u;
+        }
+      }
+      line(4, faces + "),$)");
+      line(5, "IFCCOLOURRGBLIST(((1.,0.,0.),(0.,0.5,1.)))");
+      line(6, "IFCINDEXEDCOLOURMAP(" + ref(4) + ",$," + ref(5) + "," +
+                  colorIndices + "))");
+      item = ref(4);
+    } else if (variant == 1u) {
+      line(3, "IFCCARTESIANPOINT((0.,0.,0.))");
+      line(4, "IFCCARTESIANPOINT((1000.,0.,0.))");
+      line(5, "IFCCARTESIANPOINT((1000.,100.,0.))");
+      line(6, "IFCCARTESIANPOINT((0.,100.,0.))");
+      line(7, "IFCPOLYLINE((" + ref(3) + "," + ref(4) + "," + ref(5) + "," +
+                  ref(6) + "," + ref(3) + "))");
+      line(8, "IFCARBITRARYCLOSEDPROFILEDEF(.AREA.,$," + ref(7) + ")");
+      line(9, "IFCEXTRUDEDAREASOLID(" + ref(8) + ",#5,#3,1000.)");
+      item = ref(9);
+
+      line(20, "IFCCARTESIANPOINT((250.,0.,250.))");
+      line(21, "IFCAXIS2PLACEMENT3D(" + ref(20) + ",#3,#4)");
+      line(22, "IFCLOCALPLACEMENT(" + ref(2) + "," + ref(21) + ")");
+      line(23, "IFCCARTESIANPOINT((500.,0.,0.))");
+      line(24, "IFCCARTESIANPOINT((500.,100.,0.))");
+      line(25, "IFCPOLYLINE((" + ref(3) + "," + ref(23) + "," + ref(24) +
+                   "," + ref(6) + "," + ref(3) + "))");
+      line(26, "IFCARBITRARYCLOSEDPROFILEDEF(.AREA.,$," + ref(25) + ")");
+      line(27, "IFCEXTRUDEDAREASOLID(" + ref(26) + ",#5,#3,500.)");
+      line(28, "IFCSHAPEREPRESENTATION($,'Body','SweptSolid',(" + ref(27) +
+                   "))");
+      line(29, "IFCPRODUCTDEFINITIONSHAPE($,$,(" + ref(28) + "))");
+      line(30, "IFCOPENINGELEMENT('opening-" + std::to_string(p) +
+                   "',$,$,$,$," + ref(22) + "," + ref(29) + ",$)");
+      line(31, "IFCRELVOIDSELEMENT('void-" + std::to_string(p) +
+                   "',$,$,$," + ref(12) + "," + ref(30) + ")");
+    } else {
+      line(3, "IFCDIRECTION((0.,1.,0.))");
+      line(4, "IFCDIRECTION((-1.,0.,0.))");
+      line(5, "IFCCARTESIANPOINT((0.,250.,0.))");
+      line(6, "IFCCARTESIANTRANSFORMATIONOPERATOR3D(" + ref(3) + "," +
+                  ref(4) + "," + ref(5) + ",2.,#3)");
+      line(7, "IFCMAPPEDITEM(#23," + ref(6) + ")");
+      item = ref(7);
+    }
+
+    line(10, "IFCSHAPEREPRESENTATION($,'Body','Model',(" + item + "))");
+    line(11, "IFCPRODUCTDEFINITIONSHAPE($,$,(" + ref(10) + "))");
+    const std::string type =
+        variant == 1u ? "IFCWALL" : "IFCBUILDINGELEMENTPROXY";
+    line(12, type + "('product-" + std::to_string(p) + "',$,'Product " +
+                 std::to_string(p) + "',$,$," + ref(2) + "," + ref(11) +
+                 ",$,$)");
+    products << (p != 0u ? "," : "") << ref(12);
+  }
+  data << "#12=IFCRELCONTAINEDINSPATIALSTRUCTURE('containment-guid',$,$,$,("
+       << products.str() << "),#10);\n"
+       << "#13=IFCRELASSOCIATESMATERIAL('material-guid',$,$,$,("
+       << products.str() << "),#11);\n";
+
+  std::ofstream file(path, std::ios::binary);
+  file << "ISO-10303-21;\nHEADER;\nENDSEC;\nDATA;\n"
+       << data.str() << "ENDSEC;\nEND-ISO-10303-21;\n";
+  return path;
+}
+
+Model loadWithWorkers(const std::filesystem::path &path, size_t workers) {
+  return container::geometry::ifc::LoadFromFile(
+      path, 1.0f, IfcLoadOptions{.workerCount = workers});
+}
+
+void expectIdentical(const Model &expected, const Model &actual) {
+  ASSERT_EQ(expected.vertices.size(), actual.vertices.size());
+  EXPECT_EQ(std::memcmp(expected.vertices.data(), actual.vertices.data(),
+                        expected.vertices.size() *
+                            sizeof(expected.vertices[0])),
+            0);
+  EXPECT_EQ(expected.indices, actual.indices);
+
+  ASSERT_EQ(expected.meshRanges.size(), actual.meshRanges.size());
+  for (size_t i = 0; i < expected.meshRanges.size(); ++i) {
+    const auto &lhs = expected.meshRanges[i];
+    const auto &rhs = actual.meshRanges[i];
+    EXPECT_EQ(lhs.meshId, rhs.meshId) << "range " << i;
+    EXPECT_EQ(lhs.firstIndex, rhs.firstIndex) << "range " << i;
+    EXPECT_EQ(lhs.indexCount, rhs.indexCount) << "range " << i;
+    EXPECT_EQ(std::memcmp(&lhs.boundsCenter, &rhs.boundsCenter,
+                          sizeof(lhs.boundsCenter)),
+              0)
+        << "range " << i;
+    EXPECT_EQ(lhs.boundsRadius, rhs.boundsRadius) << "range " << i;
+  }
+
+  ASSERT_EQ(expected.elements.size(), actual.elements.size());
+  for (size_t i = 0; i < expected.elements.size(); ++i) {
+    const auto &lhs = expected.elements[i];
+    const auto &rhs = actual.elements[i];
+    EXPECT_EQ(lhs.meshId, rhs.meshId) << "element " << i;
+    EXPECT_EQ(
+        std::memcmp(&lhs.transform, &rhs.transform, sizeof(lhs.transform)), 0)
+        << "element " << i;
+    EXPECT_EQ(std::memcmp(&lhs.color, &rhs.color, sizeof(lhs.color)), 0)
+        << "element " << i;
+    EXPECT_EQ(lhs.guid, rhs.guid) << "element " << i;
+    EXPECT_EQ(lhs.type, rhs.type) << "element " << i;
+    EXPECT_EQ(lhs.displayName, rhs.displayName) << "element " << i;
+    EXPECT_EQ(lhs.storeyId, rhs.storeyId) << "element " << i;
+    EXPECT_EQ(lhs.materialName, rhs.materialName) << "element " << i;
+    EXPECT_EQ(lhs.sourceId, rhs.sourceId) << "element " << i;
+    EXPECT_EQ(lhs.properties.size(), rhs.properties.size()) << "element " << i;
+  }
+}
+
+TEST(IfcParallelLoader, ParallelOutputMatchesSerialByteForByte) {
+  const auto path = writeProductGridIfc("parallel_products", 150, 6);
+  const Model serial = loadWithWorkers(path, 1);
+  // 50 patches with two colour groups, 50 voided walls, 50 mapped items of
+  // the shared map, plus every wall's un-voided source solid.
+  ASSERT_EQ(serial.elements.size(), 200u);
+  ASSERT_EQ(serial.meshRanges.size(), 1u + 100u + 100u + 50u);
+  EXPECT_EQ(serial.elements[0].storeyName, "Level 01");
+  EXPECT_EQ(serial.elements[0].materialName, "Concrete");
+
+  for (const size_t workers : container::test::kParallelLoaderWorkerCounts) {
+    SCOPED_TRACE(workers);
+    expectIdentical(serial, loadWithWorkers(path, workers));
+  }
+}
+
+TEST(IfcParallelLoader, StepTextAndFileLoadAgreeAcrossWorkerCounts) {
+  const auto path = writeProductGridIfc("parallel_text", 40, 4);
+  std::ifstream file(path, std::ios::binary);
+  const std::string text((std::istreambuf_iterator<char>(file)),
+                         std::istreambuf_iterator<char>());
+  const Model serial = container::geometry::ifc::LoadFromStep(
+      text, 1.0f, IfcLoadOptions{.workerCount = 1});
+  expectIdentical(serial, container::geometry::ifc::LoadFromStep(text));
+  expectIdentical(serial, loadWithWorkers(path, 3));
+}
+
+TEST(IfcParallelLoader, ManyProductsRecordSerialAndParallelLoadTimes) {
+  const auto path = writeProductGridIfc("parallel_timing", 3000, 12);
+  container::test::recordSerialAndParallelLoadTimes(
+      [&](size_t workers) { return loadWithWorkers(path, workers); },
+      [](const Model &model) { EXPECT_EQ(model.elements.size(), 4000u); });
+}
+
+} // namespace
@@ -850,6 +850,53 @@ TEST(IfcxLoader, ComposesLocalIfcImports) {
   std::filesystem::remove_all(tempDir);
 }
 
+TEST(IfcxLoader, FileLoadIgnoresHeaderMembersLikeJsonLoad) {
+  constexpr const char *kIfcJson = R"json(
+{
+  "header": { "id": "header-test", "ifcxVersion": "ifcx_alpha" },
+  "schemas": { "example::flag": { "value": { "dataType": "Boolean" } } },
+  "data": [
+    {
+      "path": "wall",
+      "children": { "Body": "wall-body" },
+      "attributes": { "bsi::ifc::class": { "code": "IfcWall" } }
+    },
+    {
+      "path": "wall-body",
+      "attributes": {
+        "usd::usdgeom::mesh": {
+          "faceVertexIndices": [0, 1, 2],
+          "points": [[0, 0, 0], [1, 0, 0], [0, 1, 0]]
+        }
+      }
+    }
+  ],
+  "data_stats": { "data": [1, 2, 3] }
+}
+)json";
+  const std::filesystem::path path =
+      std::filesystem::temp_directory_path() / "container_ifcx_header.ifcx";
+  {
+    std::ofstream file(path, std::ios::binary);
+    file << kIfcJson;
+  }
+
+  const auto fromJson = container::geometry::ifcx::LoadFromJson(kIfcJson);
+  const auto fromFile = container::geometry::ifcx::LoadFromFile(path);
+
+  ASSERT_EQ(fromFile.elements.size(), 1u);
+  ASSERT_EQ(fromFile.elements.size(), fromJson.elements.size());
+  EXPECT_EQ(fromFile.elements[0].guid, fromJson.elements[0].guid);
+  EXPECT_EQ(fromFile.elements[0].type, fromJson.elements[0].type);
+  EXPECT_EQ(fromFile.indices, fromJson.indices);
+  ASSERT_EQ(fromFile.vertices.size(), fromJson.vertices.size());
+  for (size_t i = 0; i < fromFile.vertices.size(); ++i) {
+    EXPECT_EQ(fromFile.vertices[i].position, fromJson.vertices[i].position);
+  }
+
+  std::filesystem::remove(path);
+}
+
 TEST(IfcxLoader, LoadsDownloadedBuildingSmartIfc5Sample) {
   const std::filesystem::path sample =
       std::filesystem::path(CONTAINER_BINARY_DIR) / "models" /
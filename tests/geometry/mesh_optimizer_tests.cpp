@@ -0,0 +1,373 @@
+#include "Container/geometry/IfcTessellatedLoader.h"
+#include "Container/geometry/MeshOptimizer.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <glm/geometric.hpp>
+
+namespace {
+
+using container::geometry::MeshOptimizationOptions;
+using container::geometry::Vertex;
+using container::geometry::VertexCacheStatistics;
+using container::geometry::dotbim::Model;
+
+// Smooth-shaded height field, the best case for index reuse.
+void makeGrid(uint32_t size, std::vector<Vertex>& vertices,
+              std::vector<uint32_t>& indices) {
+  vertices.clear();
+  indices.clear();
+  for (uint32_t y = 0; y < size; ++y) {
+    for (uint32_t x = 0; x < size; ++x) {
+      Vertex vertex{};
+      vertex.position = {static_cast<float>(x),
+                         0.1f * static_cast<float>((x * 7u + y * 3u) % 5u),
+                         static_cast<float>(y)};
+      vertex.texCoord = {static_cast<float>(x) / static_cast<float>(size),
+                         static_cast<float>(y) / static_cast<float>(size)};
+      vertices.push_back(vertex);
+    }
+  }
+  for (uint32_t y = 0; y + 1u < size; ++y) {
+    for (uint32_t x = 0; x + 1u < size; ++x) {
+      const uint32_t i = y * size + x;
+      indices.insert(indices.end(), {i, i + size, i + 1u, i + 1u, i + size,
+                                     i + size + 1u});
+    }
+  }
+}
+
+void shuffleTriangles(std::vector<uint32_t>& indices, uint32_t seed) {
+  std::vector<std::array<uint32_t, 3>> triangles;
+  for (size_t i = 0; i < indices.size(); i += 3u) {
+    triangles.push_back({indices[i], indices[i + 1u], indices[i + 2u]});
+  }
+  std::mt19937 rng(seed);
+  std::ranges::shuffle(triangles, rng);
+  indices.clear();
+  for (const auto& triangle : triangles) {
+    indices.insert(indices.end(), triangle.begin(), triangle.end());
+  }
+}
+
+// Expands every triangle to its own three vertices, as IFC face sets arrive.
+void expandToTriangleSoup(std::vector<Vertex>& vertices,
+                          std::vector<uint32_t>& indices) {
+  std::vector<Vertex> soup;
+  soup.reserve(indices.size());
+  for (uint32_t& index : indices) {
+    soup.push_back(vertices[index]);
+    index = static_cast<uint32_t>(soup.size() - 1u);
+  }
+  vertices = std::move(soup);
+}
+
+// Index count of the 64-triangle meshlet clusters the loaders build.
+constexpr uint32_t kBlockIndexCount = 64u * 3u;
+
+using TriangleKey = std::array<float, 9>;
+
+// Triangles by position, rotated so the smallest corner comes first. The
+// rotation keeps winding, so a flipped triangle would not compare equal.
+std::vector<TriangleKey> triangleKeys(std::span<const Vertex> vertices,
+                                      std::span<const uint32_t> indices) {
+  std::vector<TriangleKey> keys;
+  for (size_t i = 0; i + 2u < indices.size(); i += 3u) {
+    std::array<std::array<float, 3>, 3> corners{};
+    for (size_t corner = 0; corner < 3u; ++corner) {
+      const glm::vec3& p = vertices[indices[i + corner]].position;
+      corners[corner] = {p.x, p.y, p.z};
+    }
+    const auto first = std::ranges::min_element(corners);
+    std::ranges::rotate(corners, first);
+    TriangleKey key{};
+    for (size_t corner = 0; corner < 3u; ++corner) {
+      std::ranges::copy(corners[corner], key.begin() + corner * 3u);
+    }
+    keys.push_back(key);
+  }
+  std::ranges::sort(keys);
+  return keys;
+}
+
+void recordStatistics(const std::string& prefix,
+                      const VertexCacheStatistics& stats) {
+  ::testing::Test::RecordProperty(prefix + "_acmr", std::to_string(stats.acmr));
+  ::testing::Test::RecordProperty(prefix + "_atvr", std::to_string(stats.atvr));
+}
+
+TEST(MeshOptimizer, VertexCacheOrderImprovesShuffledGrid) {
+  std::vector<Vertex> vertices;
+  std::vector<uint32_t> indices;
+  makeGrid(64u, vertices, indices);
+  shuffleTriangles(indices, 7u);
+  const auto before =
+      container::geometry::analyzeVertexCache(indices, vertices.size());
+  const auto keys = triangleKeys(vertices, indices);
+
+  container::geometry::optimizeVertexCache(indices, vertices.size());
+  const auto after =
+      container::geometry::analyzeVertexCache(indices, vertices.size());
+  recordStatistics("shuffled", before);
+  recordStatistics("optimized", after);
+
+  EXPECT_GT(before.acmr, 2.0f);
+  EXPECT_LT(after.acmr, 0.8f);
+  EXPECT_LT(after.atvr, 1.5f);
+  EXPECT_EQ(after.triangleCount, before.triangleCount);
+  EXPECT_EQ(triangleKeys(vertices, indices), keys);
+}
+
+TEST(MeshOptimizer, AnalyzeVertexCacheCountsFifoMisses) {
+  // 0,1,2 miss; 2,1,3 misses once; with a two-entry cache 0 is evicted by 3.
+  const std::vector<uint32_t> indices{0, 1, 2, 2, 1, 3, 0, 2, 3};
+  const auto large = container::geometry::analyzeVertexCache(indices, 4u);
+  EXPECT_EQ(large.vertexTransforms, 4u);
+  EXPECT_EQ(large.vertexCount, 4u);
+  EXPECT_FLOAT_EQ(large.acmr, 4.0f / 3.0f);
+  EXPECT_FLOAT_EQ(large.atvr, 1.0f);
+
+  const auto small = container::geometry::analyzeVertexCache(indices, 4u, 2u);
+  EXPECT_GT(small.vertexTransforms, large.vertexTransforms);
+}
+
+TEST(MeshOptimizer, WeldsTriangleSoupAndOptimizesEndToEnd) {
+  std::vector<Vertex> vertices;
+  std::vector<uint32_t> indices;
+  makeGrid(48u, vertices, indices);
+  const size_t gridVertexCount = vertices.size();
+  shuffleTriangles(indices, 11u);
+  expandToTriangleSoup(vertices, indices);
+  const auto keys = triangleKeys(vertices, indices);
+  const auto before =
+      container::geometry::analyzeVertexCache(indices, vertices.size());
+
+  container::geometry::optimizeMesh(vertices, indices,
+                                    MeshOptimizationOptions{.enabled = true});
+  const auto after =
+      container::geometry::analyzeVertexCache(indices, vertices.size());
+  recordStatistics("soup", before);
+  recordStatistics("optimized", after);
+
+  EXPECT_FLOAT_EQ(before.acmr, 3.0f);
+  EXPECT_EQ(vertices.size(), gridVertexCount);
+  EXPECT_LT(after.acmr, 0.9f);
+  EXPECT_LT(after.atvr, 1.6f);
+  EXPECT_EQ(triangleKeys(vertices, indices), keys);
+
+  // Vertex fetch leaves the buffer in first-use order.
+  uint32_t nextNew = 0;
+  for (const uint32_t index : indices) {
+    ASSERT_LE(index, nextNew);
+    nextNew = std::max(nextNew, index + 1u);
+  }
+  EXPECT_EQ(nextNew, vertices.size());
+}
+
+TEST(MeshOptimizer, WeldKeepsVerticesWithDifferentAttributes) {
+  std::vector<Vertex> vertices(4);
+  vertices[1].normal = {0.0f, 0.0f, 1.0f};
+  vertices[3].texCoord = {0.5f, 0.0f};
+  std::vector<uint32_t> indices{0, 1, 2, 3, 2, 1};
+  EXPECT_EQ(container::geometry::weldVertices(vertices, indices), 3u);
+  EXPECT_EQ(indices, (std::vector<uint32_t>{0, 1, 0, 2, 0, 1}));
+}
+
+TEST(MeshOptimizer, VertexFetchDropsUnreferencedVertices) {
+  std::vector<Vertex> vertices(6);
+  for (size_t i = 0; i < vertices.size(); ++i) {
+    vertices[i].position = {static_cast<float>(i), 0.0f, 0.0f};
+  }
+  std::vector<uint32_t> indices{4, 2, 5, 5, 2, 0};
+  container::geometry::optimizeVertexFetch(vertices, indices);
+  ASSERT_EQ(vertices.size(), 4u);
+  EXPECT_EQ(indices, (std::vector<uint32_t>{0, 1, 2, 2, 1, 3}));
+  EXPECT_EQ(vertices[0].position.x, 4.0f);
+  EXPECT_EQ(vertices[3].position.x, 0.0f);
+}
+
+TEST(MeshOptimizer, OverdrawOrderDrawsOutwardFacingClustersFirst) {
+  // Two disjoint quads facing +Z: the upper one faces away from the mesh
+  // centroid and should draw before the lower one.
+  std::vector<Vertex> vertices(8);
+  for (uint32_t i = 0; i < 8u; ++i) {
+    vertices[i].position = {static_cast<float>(i & 1u),
+                            static_cast<float>((i >> 1u) & 1u),
+                            i < 4u ? -1.0f : 1.0f};
+  }
+  std::vector<uint32_t> indices{0, 1, 3, 0, 3, 2, 4, 5, 7, 4, 7, 6};
+  const auto keys = triangleKeys(vertices, indices);
+  container::geometry::optimizeOverdraw(indices, vertices);
+  EXPECT_EQ(indices, (std::vector<uint32_t>{4, 5, 7, 4, 7, 6, 0, 1, 3, 0, 3,
+                                            2}));
+  EXPECT_EQ(triangleKeys(vertices, indices), keys);
+}
+
+TEST(MeshOptimizer, OverdrawOrderStaysWithinAcmrThreshold) {
+  std::vector<Vertex> vertices;
+  std::vector<uint32_t> indices;
+  makeGrid(64u, vertices, indices);
+  shuffleTriangles(indices, 3u);
+  container::geometry::optimizeVertexCache(indices, vertices.size());
+  const auto cacheOrdered =
+      container::geometry::analyzeVertexCache(indices, vertices.size());
+  const auto keys = triangleKeys(vertices, indices);
+
+  container::geometry::optimizeOverdraw(indices, vertices, 1.05f);
+  const auto overdrawOrdered =
+      container::geometry::analyzeVertexCache(indices, vertices.size());
+  recordStatistics("cache_ordered", cacheOrdered);
+  recordStatistics("overdraw_ordered", overdrawOrdered);
+
+  EXPECT_LE(overdrawOrdered.acmr, cacheOrdered.acmr * 1.1f);
+  EXPECT_EQ(triangleKeys(vertices, indices), keys);
+}
+
+TEST(MeshOptimizer, ModelGeometryKeepsTrianglesInsideTheirClusters) {
+  std::vector<Vertex> vertices;
+  std::vector<uint32_t> first;
+  makeGrid(16u, vertices, first);
+  shuffleTriangles(first, 5u);
+  std::vector<uint32_t> second(first.begin(), first.begin() + 60);
+
+  Model model{};
+  model.vertices = vertices;
+  model.indices = first;
+  model.indices.insert(model.indices.end(), second.begin(), second.end());
+  expandToTriangleSoup(model.vertices, model.indices);
+  const auto firstCount = static_cast<uint32_t>(first.size());
+  model.meshRanges.push_back({1u, 0u, firstCount, {}, 0.0f});
+  model.meshRanges.push_back({2u, firstCount, 60u, {}, 0.0f});
+  // Loader-style clusters of 64 triangles, plus one whose end (index 96)
+  // falls inside the first of them.
+  for (uint32_t begin = 0; begin < firstCount; begin += kBlockIndexCount) {
+    model.meshletClusters.push_back({});
+    model.meshletClusters.back().meshId = 1u;
+    model.meshletClusters.back().firstIndex = begin;
+    model.meshletClusters.back().indexCount =
+        std::min(kBlockIndexCount, firstCount - begin);
+  }
+  model.meshletClusters.push_back({});
+  model.meshletClusters.back().meshId = 1u;
+  model.meshletClusters.back().indexCount = 96u;
+
+  const std::span<const uint32_t> allIndices(model.indices);
+  const auto firstKeys =
+      triangleKeys(model.vertices, allIndices.subspan(0, firstCount));
+  const auto secondKeys =
+      triangleKeys(model.vertices, allIndices.subspan(firstCount));
+  std::vector<std::vector<TriangleKey>> clusterKeys;
+  for (const auto& cluster : model.meshletClusters) {
+    clusterKeys.push_back(triangleKeys(
+        model.vertices,
+        allIndices.subspan(cluster.firstIndex, cluster.indexCount)));
+  }
+  const auto before = container::geometry::analyzeVertexCache(
+      allIndices.subspan(0, firstCount), model.vertices.size());
+  const size_t soupVertexCount = model.vertices.size();
+
+  container::geometry::optimizeModelGeometry(
+      model, MeshOptimizationOptions{.enabled = true});
+
+  EXPECT_EQ(model.vertices.size(), vertices.size());
+  EXPECT_LT(model.vertices.size(), soupVertexCount);
+  const std::span<const uint32_t> optimized(model.indices);
+  EXPECT_EQ(triangleKeys(model.vertices, optimized.subspan(0, firstCount)),
+            firstKeys);
+  EXPECT_EQ(triangleKeys(model.vertices, optimized.subspan(firstCount)),
+            secondKeys);
+  for (size_t i = 0; i < model.meshletClusters.size(); ++i) {
+    const auto& cluster = model.meshletClusters[i];
+    EXPECT_EQ(triangleKeys(model.vertices,
+                           optimized.subspan(cluster.firstIndex,
+                                             cluster.indexCount)),
+              clusterKeys[i])
+        << "cluster " << i;
+  }
+  const auto after = container::geometry::analyzeVertexCache(
+      optimized.subspan(0, firstCount), model.vertices.size());
+  recordStatistics("shuffled_model", before);
+  recordStatistics("optimized_model", after);
+  EXPECT_LT(after.acmr, before.acmr);
+}
+
+TEST(MeshOptimizer, IfcLoaderOptimizesByDefault) {
+  std::string points = "#20=IFCCARTESIANPOINTLIST3D((";
+  std::string faces = "#21=IFCTRIANGULATEDFACESET(#20,$,.T.,(";
+  constexpr uint32_t kSize = 12u;
+  for (uint32_t y = 0; y < kSize; ++y) {
+    for (uint32_t x = 0; x < kSize; ++x) {
+      points += (x | y) != 0u ? ",(" : "(";
+      points += std::to_string(x * 100u) + ".," + std::to_string(y * 100u) +
+                ".,0.)";
+    }
+  }
+  for (uint32_t y = 0; y + 1u < kSize; ++y) {
+    for (uint32_t x = 0; x + 1u < kSize; ++x) {
+      const uint32_t i = y * kSize + x + 1u;
+      faces += (x | y) != 0u ? ",(" : "(";
+      faces += std::to_string(i) + "," + std::to_string(i + 1u) + "," +
+               std::to_string(i + kSize) + "),(" + std::to_string(i + 1u) +
+               "," + std::to_string(i + kSize + 1u) + "," +
+               std::to_string(i + kSize) + ")";
+    }
+  }
+  const std::string ifc =
+      "ISO-10303-21;\nDATA;\n"
+      "#10=IFCCARTESIANPOINT((0.,0.,0.));\n"
+      "#11=IFCDIRECTION((0.,0.,1.));\n"
+      "#12=IFCDIRECTION((1.,0.,0.));\n"
+      "#13=IFCAXIS2PLACEMENT3D(#10,#11,#12);\n"
+      "#14=IFCLOCALPLACEMENT($,#13);\n" +
+      points + "));\n" + faces + "),$);\n" +
+      "#30=IFCSHAPEREPRESENTATION($,'Body','Tessellation',(#21));\n"
+      "#31=IFCPRODUCTDEFINITIONSHAPE($,$,(#30));\n"
+      "#40=IFCSLAB('slab-guid',$,'Slab',$,$,#14,#31,$,$);\n"
+      "ENDSEC;\nEND-ISO-10303-21;\n";
+
+  const Model raw = container::geometry::ifc::LoadFromStep(
+      ifc, 1.0f,
+      container::geometry::ifc::IfcLoadOptions{.meshOptimization = {}});
+  const Model optimized = container::geometry::ifc::LoadFromStep(ifc);
+  const auto before =
+      container::geometry::analyzeVertexCache(raw.indices, raw.vertices.size());
+  const auto after = container::geometry::analyzeVertexCache(
+      optimized.indices, optimized.vertices.size());
+  recordStatistics("ifc", before);
+  recordStatistics("ifc_optimized", after);
+
+  ASSERT_EQ(optimized.meshRanges.size(), raw.meshRanges.size());
+  EXPECT_EQ(optimized.indices.size(), raw.indices.size());
+  EXPECT_LT(optimized.vertices.size() * 2u, raw.vertices.size());
+  EXPECT_LT(after.acmr, before.acmr);
+  EXPECT_LT(after.atvr, 1.5f);
+  EXPECT_EQ(triangleKeys(optimized.vertices, optimized.indices),
+            triangleKeys(raw.vertices, raw.indices));
+  // BimManager cuts IFC ranges into 64-triangle clusters in index order;
+  // each of them must keep its triangles.
+  const std::span<const uint32_t> rawIndices(raw.indices);
+  const std::span<const uint32_t> optimizedIndices(optimized.indices);
+  for (const auto& range : raw.meshRanges) {
+    for (uint32_t begin = range.firstIndex;
+         begin < range.firstIndex + range.indexCount;
+         begin += kBlockIndexCount) {
+      const uint32_t count = std::min(
+          kBlockIndexCount, range.firstIndex + range.indexCount - begin);
+      EXPECT_EQ(
+          triangleKeys(optimized.vertices,
+                       optimizedIndices.subspan(begin, count)),
+          triangleKeys(raw.vertices, rawIndices.subspan(begin, count)))
+          << "block at " << begin;
+    }
+  }
+}
+
+}  // namespace
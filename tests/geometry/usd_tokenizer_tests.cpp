@@ -0,0 +1,294 @@
+#include "Container/geometry/UsdLoader.h"
+#include "Container/geometry/UsdTokenizer.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+using container::geometry::usd::Token;
+using container::geometry::usd::TokenizeOptions;
+using container::geometry::usd::TokenKind;
+using container::geometry::usd::TokenStream;
+
+struct ReferenceToken {
+  TokenKind kind{TokenKind::End};
+  std::string text{};
+  double number{0.0};
+};
+
+bool referenceIsSymbol(char c) {
+  return std::string_view("{}[](),=;").find(c) != std::string_view::npos;
+}
+
+// The owning-string, strtod-based tokenizer the loader used before tokens
+// became views. Kept verbatim as the reference.
+std::vector<ReferenceToken> referenceTokenize(const std::string &text) {
+  std::vector<ReferenceToken> tokens;
+  size_t cursor = 0;
+  const auto isNumberStart = [&](size_t offset) {
+    const char c = text[offset];
+    if (std::isdigit(static_cast<unsigned char>(c))) {
+      return true;
+    }
+    if ((c == '+' || c == '-' || c == '.') && offset + 1u < text.size()) {
+      return std::isdigit(static_cast<unsigned char>(text[offset + 1u])) != 0;
+    }
+    return false;
+  };
+  while (cursor < text.size()) {
+    const char c = text[cursor];
+    if (std::isspace(static_cast<unsigned char>(c))) {
+      ++cursor;
+      continue;
+    }
+    if (c == '#') {
+      while (cursor < text.size() && text[cursor] != '\n') {
+        ++cursor;
+      }
+      continue;
+    }
+    if (c == '"') {
+      ++cursor;
+      std::string value;
+      while (cursor < text.size()) {
+        const char current = text[cursor++];
+        if (current == '"') {
+          break;
+        }
+        if (current == '\\' && cursor < text.size()) {
+          value.push_back(text[cursor++]);
+        } else {
+          value.push_back(current);
+        }
+      }
+      tokens.push_back({TokenKind::String, std::move(value), 0.0});
+      continue;
+    }
+    if (referenceIsSymbol(c)) {
+      tokens.push_back({TokenKind::Symbol, std::string(1, c), 0.0});
+      ++cursor;
+      continue;
+    }
+    if (isNumberStart(cursor)) {
+      const char *begin = text.data() + cursor;
+      char *end = nullptr;
+      const double value = std::strtod(begin, &end);
+      if (end != begin) {
+        tokens.push_back({TokenKind::Number,
+                          std::string(begin, static_cast<size_t>(end - begin)),
+                          value});
+        cursor += static_cast<size_t>(end - begin);
+        continue;
+      }
+    }
+
+    const size_t start = cursor;
+    while (cursor < text.size() &&
+           !std::isspace(static_cast<unsigned char>(text[cursor])) &&
+           !referenceIsSymbol(text[cursor]) && text[cursor] != '"' &&
+           text[cursor] != '#') {
+      ++cursor;
+    }
+    tokens.push_back({TokenKind::Identifier,
+                      text.substr(start, cursor - start), 0.0});
+  }
+  tokens.push_back({TokenKind::End, {}, 0.0});
+  return tokens;
+}
+
+bool sameNumber(double lhs, double rhs) {
+  return std::bit_cast<uint64_t>(lhs) == std::bit_cast<uint64_t>(rhs);
+}
+
+// Compares one-to-one, except that a NumberArray stands for the reference's
+// numbers, commas and parentheses up to the closing bracket.
+::testing::AssertionResult
+matchesReference(const std::vector<ReferenceToken> &expected,
+                 const TokenStream &actual) {
+  size_t e = 0;
+  for (size_t a = 0; a < actual.tokens.size(); ++a) {
+    const Token &token = actual.tokens[a];
+    if (token.kind == TokenKind::NumberArray) {
+      for (const double number : actual.numbersOf(token)) {
+        while (e < expected.size() && expected[e].kind == TokenKind::Symbol &&
+               std::string_view("(),").find(expected[e].text) !=
+                   std::string_view::npos) {
+          ++e;
+        }
+        if (e == expected.size() || expected[e].kind != TokenKind::Number ||
+            !sameNumber(expected[e].number, number)) {
+          return ::testing::AssertionFailure()
+                 << "array number " << number << " at reference token " << e;
+        }
+        ++e;
+      }
+      while (e < expected.size() && expected[e].text != "]") {
+        ++e;
+      }
+      continue;
+    }
+    if (e == expected.size()) {
+      return ::testing::AssertionFailure() << "extra token " << a;
+    }
+    const ReferenceToken &reference = expected[e++];
+    if (reference.kind != token.kind || reference.text != token.text ||
+        !sameNumber(reference.number, token.number)) {
+      return ::testing::AssertionFailure()
+             << "token " << a << " '" << token.text << "' != reference '"
+             << reference.text << "'";
+    }
+  }
+  if (e != expected.size()) {
+    return ::testing::AssertionFailure() << "missing reference tokens";
+  }
+  return ::testing::AssertionSuccess();
+}
+
+std::string randomDocument(std::mt19937 &rng) {
+  static constexpr std::string_view kFragments[] = {
+      "1", "-2.5", "+3", ".5", "-.5", "+.5", "1e3", "-7E-2", "1e400",
+      "-1e400", "1e-400", "4.9e-324", "0x1p3", "-0X1.8P1", "0x", "0xg", "1.",
+      "007", "1e", "1e+", "2.5.3", "12abc", "--1", "-", "+", ".", "nan",
+      "inf", "def", "Mesh", "\"quoted\"", "\"esc\\\"aped\\\\\"",
+      "\"open", "\\", "# comment\n", "#", "points", "xformOp:translate",
+      "[", "]", "(", ")", "{", "}", ",", "=", ";", " ", "\n", "\t", "\v",
+      "[(0, 0, 0), (1, 0.5, -2)]", "[1, 2, 3]", "[]", "[ 1,2,, ( 3 ) ]",
+      "[1, \"x\"]", "[1 2]", "[1e5,-1e-5]", "[1, [2]]", "[(1, 2), 3a]",
+      "[0x10, 1]", "[+1, +.5]", "[1 # c\n]", "[1, 2",
+  };
+  std::uniform_int_distribution<size_t> pick(0, std::size(kFragments) - 1u);
+  std::uniform_int_distribution<int> length(0, 40);
+  std::uniform_int_distribution<int> coin(0, 3);
+  std::string document;
+  for (int i = length(rng); i > 0; --i) {
+    document += kFragments[pick(rng)];
+    if (coin(rng) != 0) {
+      document += ' ';
+    }
+  }
+  return document;
+}
+
+TEST(UsdTokenizer, MatchesReferenceTokenizerOnRandomDocuments) {
+  std::mt19937 rng(1234u);
+  for (int iteration = 0; iteration < 20000; ++iteration) {
+    const std::string document = randomDocument(rng);
+    const std::vector<ReferenceToken> reference = referenceTokenize(document);
+    SCOPED_TRACE(document);
+    ASSERT_TRUE(matchesReference(
+        reference, container::geometry::usd::tokenize(
+                       document, TokenizeOptions{.bulkNumberArrays = false})));
+    ASSERT_TRUE(matchesReference(reference,
+                                 container::geometry::usd::tokenize(document)));
+  }
+}
+
+TEST(UsdTokenizer, MatchesReferenceTokenizerOnRandomBytes) {
+  std::mt19937 rng(99u);
+  std::uniform_int_distribution<int> byte(0, 255);
+  std::uniform_int_distribution<int> length(0, 64);
+  constexpr std::string_view kAlphabet = "0123456789+-.eExXpP\"\\#[](),= \n";
+  std::uniform_int_distribution<size_t> pick(0, kAlphabet.size() - 1u);
+  for (int iteration = 0; iteration < 20000; ++iteration) {
+    std::string document;
+    for (int i = length(rng); i > 0; --i) {
+      document.push_back(byte(rng) < 200 ? kAlphabet[pick(rng)]
+                                         : static_cast<char>(byte(rng)));
+    }
+    SCOPED_TRACE(document);
+    ASSERT_TRUE(matchesReference(referenceTokenize(document),
+                                 container::geometry::usd::tokenize(document)));
+  }
+}
+
+TEST(UsdTokenizer, BulkParsesHomogeneousArrayLiterals) {
+  const TokenStream stream = container::geometry::usd::tokenize(
+      "point3f[] points = [(0, 1, 2), (-3.5, 4e1, +5)] (\n"
+      "    interpolation = \"vertex\"\n)\n"
+      "int[] indices = [0, \"1\"]\n");
+  std::vector<TokenKind> kinds;
+  for (const Token &token : stream.tokens) {
+    kinds.push_back(token.kind);
+  }
+  ASSERT_GE(kinds.size(), 8u);
+  EXPECT_EQ(stream.tokens[5].text, "[");
+  ASSERT_EQ(stream.tokens[6].kind, TokenKind::NumberArray);
+  EXPECT_EQ(stream.tokens[7].text, "]");
+  const std::span<const double> numbers = stream.numbersOf(stream.tokens[6]);
+  EXPECT_EQ(std::vector<double>(numbers.begin(), numbers.end()),
+            (std::vector<double>{0.0, 1.0, 2.0, -3.5, 40.0, 5.0}));
+  // The mixed array falls back to per-element tokens.
+  EXPECT_EQ(std::ranges::count(kinds, TokenKind::NumberArray), 1);
+  EXPECT_EQ(stream.numbers.size(), 6u);
+}
+
+std::string denseMeshUsda(uint32_t gridSize) {
+  std::string text = "#usda 1.0\n(\n    upAxis = \"Y\"\n)\n\n"
+                     "def Mesh \"Terrain\"\n{\n    point3f[] points = [";
+  for (uint32_t y = 0; y < gridSize; ++y) {
+    for (uint32_t x = 0; x < gridSize; ++x) {
+      text += (x | y) != 0u ? ", (" : "(";
+      text += std::to_string(x * 0.25f) + ", " +
+              std::to_string(0.01f * static_cast<float>((x * 7u + y) % 13u)) +
+              ", " + std::to_string(y * 0.25f) + ")";
+    }
+  }
+  text += "]\n    int[] faceVertexCounts = [";
+  const uint32_t quads = (gridSize - 1u) * (gridSize - 1u);
+  for (uint32_t i = 0; i < quads; ++i) {
+    text += i > 0u ? ", 4" : "4";
+  }
+  text += "]\n    int[] faceVertexIndices = [";
+  for (uint32_t y = 0; y + 1u < gridSize; ++y) {
+    for (uint32_t x = 0; x + 1u < gridSize; ++x) {
+      const uint32_t i = y * gridSize + x;
+      text += (x | y) != 0u ? ", " : "";
+      text += std::to_string(i) + ", " + std::to_string(i + gridSize) + ", " +
+              std::to_string(i + gridSize + 1u) + ", " +
+              std::to_string(i + 1u);
+    }
+  }
+  text += "]\n}\n";
+  return text;
+}
+
+TEST(UsdTokenizer, DenseArraysCollapseIntoFewTokens) {
+  const std::string text = denseMeshUsda(400u);
+  const auto model = container::geometry::usd::LoadFromText(text);
+  ASSERT_EQ(model.meshRanges.size(), 1u);
+  EXPECT_EQ(model.indices.size(), 399u * 399u * 6u);
+
+  const auto time = [](auto &&work) {
+    const auto start = std::chrono::steady_clock::now();
+    work();
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+  };
+  size_t referenceTokens = 0;
+  size_t bulkTokens = 0;
+  const double referenceMs =
+      time([&] { referenceTokens = referenceTokenize(text).size(); });
+  const double bulkMs = time([&] {
+    bulkTokens = container::geometry::usd::tokenize(text).tokens.size();
+  });
+  RecordProperty("reference_ms", std::to_string(referenceMs));
+  RecordProperty("tokenize_ms", std::to_string(bulkMs));
+  RecordProperty("reference_tokens", std::to_string(referenceTokens));
+  RecordProperty("tokenize_tokens", std::to_string(bulkTokens));
+  EXPECT_LT(bulkTokens * 1000u, referenceTokens);
+}
+
+} // namespace
@@ -2,7 +2,11 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
+#include <limits>
+#include <random>
+#include <string>
 #include <vector>
 
 namespace {
@@ -12,21 +16,124 @@ using container::renderer::BimDrawFilter;
 using container::renderer::BimDrawFilterState;
 using container::renderer::BimDrawFilterStateInputs;
 using container::renderer::BimElementMetadata;
+using container::renderer::BimElementMetadataStore;
+using container::renderer::BimMetadataCatalog;
 using container::renderer::DrawCommand;
 
+[[nodiscard]] BimElementMetadataStore
+makeStore(const std::vector<BimElementMetadata> &metadata) {
+  BimElementMetadataStore store;
+  store.reserve(metadata.size());
+  for (const BimElementMetadata &element : metadata) {
+    store.append(element);
+  }
+  return store;
+}
+
 [[nodiscard]] BimDrawFilterStateInputs
-makeInputs(uint64_t revision, const std::vector<BimElementMetadata> &metadata,
+makeInputs(uint64_t revision, const BimElementMetadataStore &metadata,
            const std::vector<DrawCommand> &opaqueSingleSided,
            std::span<const std::string> phaseOrder = {}) {
   return BimDrawFilterStateInputs{
       .revision = revision,
       .objectCount = metadata.size(),
-      .metadata = {metadata.data(), metadata.size()},
+      .metadata = &metadata,
       .phaseOrder = phaseOrder,
       .opaqueSingleSidedDrawCommands = &opaqueSingleSided,
   };
 }
 
+[[nodiscard]] std::string pickLabel(std::mt19937 &rng,
+                                    std::span<const std::string> labels) {
+  std::uniform_int_distribution<size_t> pick(0u, labels.size());
+  const size_t index = pick(rng);
+  return index == labels.size() ? std::string{} : labels[index];
+}
+
+[[nodiscard]] std::vector<BimElementMetadata>
+randomMetadata(std::mt19937 &rng, size_t count) {
+  const std::array<std::string, 4u> types{"IfcWall", "IfcDoor",
+                                          "IfcPipeSegment", "IfcDuctSegment"};
+  const std::array<std::string, 3u> storeys{"Level 1", "Level 2", "Roof"};
+  const std::array<std::string, 3u> materials{"Concrete", "Steel", "Glass"};
+  const std::array<std::string, 2u> disciplines{"Architecture", "MEP"};
+  const std::array<std::string, 3u> phases{"Existing", "New", "Future"};
+  const std::array<std::string, 2u> ratings{"60", "120"};
+  const std::array<std::string, 2u> loadBearing{"true", "false"};
+  const std::array<std::string, 3u> statuses{"Existing", "New",
+                                             "Demolished"};
+  const std::array<std::string, 5u> guids{"a", "b", "c", "d", "e"};
+  std::vector<BimElementMetadata> metadata(count);
+  for (size_t index = 0; index < count; ++index) {
+    BimElementMetadata &element = metadata[index];
+    element.objectIndex = static_cast<uint32_t>(index);
+    element.guid = pickLabel(rng, guids);
+    element.sourceId = element.guid.empty() ? pickLabel(rng, guids) : "";
+    element.type = pickLabel(rng, types);
+    element.storeyName = pickLabel(rng, storeys);
+    element.materialName = pickLabel(rng, materials);
+    element.discipline = pickLabel(rng, disciplines);
+    element.phase = pickLabel(rng, phases);
+    element.fireRating = pickLabel(rng, ratings);
+    element.loadBearing = pickLabel(rng, loadBearing);
+    element.status = pickLabel(rng, statuses);
+  }
+  return metadata;
+}
+
+[[nodiscard]] BimDrawFilter randomFilter(std::mt19937 &rng,
+                                         const BimElementMetadata &sample,
+                                         uint32_t objectCount) {
+  std::bernoulli_distribution enabled(0.3);
+  BimDrawFilter filter{};
+  filter.typeFilterEnabled = enabled(rng);
+  filter.type = sample.type;
+  filter.storeyFilterEnabled = enabled(rng);
+  filter.storey = sample.storeyName;
+  filter.materialFilterEnabled = enabled(rng);
+  filter.material = sample.materialName;
+  filter.disciplineFilterEnabled = enabled(rng);
+  filter.discipline = sample.discipline;
+  filter.phaseFilterEnabled = enabled(rng);
+  filter.phase = sample.phase;
+  filter.fireRatingFilterEnabled = enabled(rng);
+  filter.fireRating = sample.fireRating;
+  filter.loadBearingFilterEnabled = enabled(rng);
+  filter.loadBearing = sample.loadBearing;
+  filter.statusFilterEnabled = enabled(rng);
+  filter.status = sample.status;
+  filter.isolateSelection = enabled(rng);
+  filter.hideSelection = !filter.isolateSelection && enabled(rng);
+  filter.selectedObjectIndex =
+      std::uniform_int_distribution<uint32_t>(0u, objectCount)(rng);
+  filter.disciplinePreset = static_cast<BimDisciplinePreset>(
+      std::uniform_int_distribution<int>(0, 2)(rng));
+  filter.phaseTimelineEnabled = enabled(rng);
+  filter.phaseTimelineActiveIndex =
+      std::uniform_int_distribution<uint32_t>(0u, 3u)(rng);
+  filter.phaseTimelineShowExisting = !enabled(rng);
+  filter.phaseTimelineShowNew = !enabled(rng);
+  filter.phaseTimelineShowDemolished = enabled(rng);
+  filter.phaseTimelineGhostFuture = enabled(rng);
+  return filter;
+}
+
+void expectBitmapMatchesReference(BimDrawFilterState &state,
+                                  const BimDrawFilter &filter,
+                                  const BimDrawFilterStateInputs &inputs) {
+  const auto &visible = state.visibleObjects(filter, inputs);
+  size_t expectedCount = 0u;
+  for (uint32_t objectIndex = 0u; objectIndex < inputs.objectCount;
+       ++objectIndex) {
+    const bool expected = state.objectMatchesFilter(objectIndex, filter,
+                                                    inputs);
+    expectedCount += expected ? 1u : 0u;
+    EXPECT_EQ(visible.contains(objectIndex), expected)
+        << "object " << objectIndex;
+  }
+  EXPECT_EQ(visible.cardinality(), expectedCount);
+}
+
 TEST(BimDrawFilterStateTests, FiltersAndMergesInstancedSurfaceCommands) {
   std::vector<BimElementMetadata> metadata(3u);
   metadata[0].objectIndex = 0u;
@@ -48,7 +155,8 @@ TEST(BimDrawFilterStateTests, FiltersAndMergesInstancedSurfaceCommands) {
   filter.type = "Wall";
 
   BimDrawFilterState state;
-  const auto inputs = makeInputs(7u, metadata, opaqueSingleSided);
+  const BimElementMetadataStore store = makeStore(metadata);
+  const auto inputs = makeInputs(7u, store, opaqueSingleSided);
   const auto &lists = state.filteredDrawLists(filter, inputs);
 
   ASSERT_EQ(lists.opaqueSingleSidedDrawCommands.size(), 1u);
@@ -75,7 +183,8 @@ TEST(BimDrawFilterStateTests, SelectionFiltersUseProductIdentity) {
   isolate.selectedObjectIndex = 0u;
 
   BimDrawFilterState state;
-  const auto inputs = makeInputs(1u, metadata, opaqueSingleSided);
+  const BimElementMetadataStore store = makeStore(metadata);
+  const auto inputs = makeInputs(1u, store, opaqueSingleSided);
   EXPECT_TRUE(state.objectMatchesFilter(0u, isolate, inputs));
   EXPECT_TRUE(state.objectMatchesFilter(1u, isolate, inputs));
   EXPECT_FALSE(state.objectMatchesFilter(2u, isolate, inputs));
@@ -106,7 +215,8 @@ TEST(BimDrawFilterStateTests, CachedListsRefreshOnlyWhenRevisionChanges) {
   filter.type = "Wall";
 
   BimDrawFilterState state;
-  auto inputs = makeInputs(1u, metadata, opaqueSingleSided);
+  const BimElementMetadataStore store = makeStore(metadata);
+  auto inputs = makeInputs(1u, store, opaqueSingleSided);
   size_t filteredCount = state.filteredDrawLists(filter, inputs)
                              .opaqueSingleSidedDrawCommands.size();
   ASSERT_EQ(filteredCount, 1u);
@@ -151,7 +261,8 @@ TEST(BimDrawFilterStateTests, PhaseTimelineHidesFutureAndDemolishedElements) {
   filter.phaseTimelineGhostFuture = false;
 
   BimDrawFilterState state;
-  const auto inputs = makeInputs(3u, metadata, opaqueSingleSided, phases);
+  const BimElementMetadataStore store = makeStore(metadata);
+  const auto inputs = makeInputs(3u, store, opaqueSingleSided, phases);
 
   EXPECT_TRUE(state.objectMatchesFilter(0u, filter, inputs));
   EXPECT_TRUE(state.objectMatchesFilter(1u, filter, inputs));
@@ -173,7 +284,8 @@ TEST(BimDrawFilterStateTests, ArchitecturePresetHidesMepClasses) {
   filter.disciplinePreset = BimDisciplinePreset::Architecture;
 
   BimDrawFilterState state;
-  const auto inputs = makeInputs(4u, metadata, opaqueSingleSided);
+  const BimElementMetadataStore store = makeStore(metadata);
+  const auto inputs = makeInputs(4u, store, opaqueSingleSided);
 
   EXPECT_TRUE(state.objectMatchesFilter(0u, filter, inputs));
   EXPECT_FALSE(state.objectMatchesFilter(1u, filter, inputs));
@@ -198,7 +310,8 @@ TEST(BimDrawFilterStateTests, MepXrayPresetShowsMepServiceClasses) {
   filter.disciplinePreset = BimDisciplinePreset::MepXray;
 
   BimDrawFilterState state;
-  const auto inputs = makeInputs(5u, metadata, opaqueSingleSided);
+  const BimElementMetadataStore store = makeStore(metadata);
+  const auto inputs = makeInputs(5u, store, opaqueSingleSided);
 
   EXPECT_FALSE(state.objectMatchesFilter(0u, filter, inputs));
   EXPECT_TRUE(state.objectMatchesFilter(1u, filter, inputs));
@@ -226,7 +339,8 @@ TEST(BimDrawFilterStateTests, DisciplinePresetsIgnoreMepWordsOutsideTypeFields)
   const std::vector<DrawCommand> opaqueSingleSided;
 
   BimDrawFilterState state;
-  const auto inputs = makeInputs(6u, metadata, opaqueSingleSided);
+  const BimElementMetadataStore store = makeStore(metadata);
+  const auto inputs = makeInputs(6u, store, opaqueSingleSided);
 
   BimDrawFilter architecture{};
   architecture.disciplinePreset = BimDisciplinePreset::Architecture;
@@ -245,4 +359,80 @@ TEST(BimDrawFilterStateTests, DisciplinePresetsIgnoreMepWordsOutsideTypeFields)
   EXPECT_TRUE(state.objectMatchesFilter(4u, mepXray, inputs));
 }
 
+TEST(BimDrawFilterStateTests, BitmapIndexMatchesPerObjectFilterReference) {
+  std::mt19937 rng(0xb17);
+  const std::vector<BimElementMetadata> metadata = randomMetadata(rng, 600u);
+  std::vector<DrawCommand> opaqueSingleSided;
+  for (uint32_t objectIndex = 0u; objectIndex < metadata.size();
+       ++objectIndex) {
+    opaqueSingleSided.push_back(DrawCommand{.objectIndex = objectIndex,
+                                            .firstIndex = objectIndex * 3u,
+                                            .indexCount = 3u,
+                                            .instanceCount = 1u});
+  }
+  const std::array<std::string, 3u> phases{"Existing", "New", "Future"};
+
+  BimMetadataCatalog catalog;
+  for (const BimElementMetadata &element : metadata) {
+    (void)catalog.registerType(element.type);
+    catalog.registerStorey(element, {});
+    catalog.registerMaterial(element);
+    catalog.registerDiscipline(element.discipline);
+    catalog.registerPhase(element.phase);
+    catalog.registerFireRating(element.fireRating);
+    catalog.registerLoadBearing(element.loadBearing);
+    catalog.registerStatus(element.status);
+  }
+
+  BimDrawFilterState localState;
+  BimDrawFilterState catalogState;
+  const BimElementMetadataStore store = makeStore(metadata);
+  const auto inputs = makeInputs(11u, store, opaqueSingleSided, phases);
+  auto catalogInputs = inputs;
+  catalogInputs.catalog = &catalog;
+  std::uniform_int_distribution<size_t> sample(0u, metadata.size() - 1u);
+  for (int iteration = 0; iteration < 200; ++iteration) {
+    const BimDrawFilter filter =
+        randomFilter(rng, metadata[sample(rng)],
+                     static_cast<uint32_t>(metadata.size()));
+    expectBitmapMatchesReference(localState, filter, inputs);
+    expectBitmapMatchesReference(catalogState, filter, catalogInputs);
+
+    const auto &lists = localState.filteredDrawLists(filter, inputs);
+    size_t expectedDraws = 0u;
+    for (uint32_t objectIndex = 0u; objectIndex < metadata.size();
+         ++objectIndex) {
+      expectedDraws +=
+          localState.objectMatchesFilter(objectIndex, filter, inputs) ? 1u
+                                                                      : 0u;
+    }
+    size_t filteredDraws = 0u;
+    for (const DrawCommand &command : lists.opaqueSingleSidedDrawCommands) {
+      filteredDraws += command.instanceCount;
+    }
+    EXPECT_EQ(filteredDraws, expectedDraws);
+  }
+  EXPECT_GT(localState.indexMemoryBytes(), 0u);
+}
+
+TEST(BimDrawFilterStateTests, DrawBudgetPastObjectCountKeepsEveryObject) {
+  std::mt19937 rng(0xb0d);
+  const std::vector<BimElementMetadata> metadata = randomMetadata(rng, 300u);
+  const std::vector<DrawCommand> opaqueSingleSided;
+  const BimElementMetadataStore store = makeStore(metadata);
+  const auto inputs = makeInputs(5u, store, opaqueSingleSided);
+
+  BimDrawFilterState state;
+  for (const uint32_t budget :
+       {120u, 300u, 301u, std::numeric_limits<uint32_t>::max() - 1u}) {
+    BimDrawFilter filter{};
+    filter.drawBudgetEnabled = true;
+    filter.drawBudgetMaxObjects = budget;
+    expectBitmapMatchesReference(state, filter, inputs);
+    EXPECT_EQ(state.visibleObjects(filter, inputs).cardinality(),
+              std::min<size_t>(budget, metadata.size()))
+        << "budget " << budget;
+  }
+}
+
 } // namespace
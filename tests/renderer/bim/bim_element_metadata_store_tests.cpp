@@ -0,0 +1,221 @@
+#include "Container/renderer/bim/BimElementMetadataStore.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace {
+
+using container::renderer::BimElementMetadata;
+using container::renderer::BimElementMetadataStore;
+using container::renderer::BimElementMetadataView;
+using container::renderer::BimElementProperty;
+using container::renderer::BimElementStringField;
+using container::renderer::BimGeometryKind;
+using container::renderer::BimStringTable;
+
+[[nodiscard]] size_t heapStringBytes(const std::string &value) {
+  // Strings that fit the small-string buffer never touch the heap.
+  const std::string empty;
+  return value.capacity() > empty.capacity() ? value.capacity() + 1u : 0u;
+}
+
+[[nodiscard]] size_t
+vectorMetadataBytes(const std::vector<BimElementMetadata> &metadata) {
+  size_t bytes = metadata.capacity() * sizeof(BimElementMetadata);
+  for (const BimElementMetadata &element : metadata) {
+    for (const std::string *value :
+         {&element.guid, &element.type, &element.displayName,
+          &element.objectType, &element.storeyName, &element.storeyId,
+          &element.materialName, &element.materialCategory,
+          &element.discipline, &element.phase, &element.fireRating,
+          &element.loadBearing, &element.status, &element.sourceId}) {
+      bytes += heapStringBytes(*value);
+    }
+    bytes += element.properties.capacity() * sizeof(BimElementProperty);
+    for (const BimElementProperty &property : element.properties) {
+      bytes += heapStringBytes(property.set) + heapStringBytes(property.name) +
+               heapStringBytes(property.value) +
+               heapStringBytes(property.category);
+    }
+  }
+  return bytes;
+}
+
+[[nodiscard]] BimElementMetadata makeElement(uint32_t index) {
+  static const std::array<std::string, 4u> types{
+      "IfcWall", "IfcSlab", "IfcDoor", "IfcFlowSegment"};
+  static const std::array<std::string, 3u> materials{
+      "Concrete, Cast-in-Place gray", "Gypsum Wall Board",
+      "Steel ASTM A992"};
+
+  BimElementMetadata element{};
+  element.objectIndex = index;
+  element.sourceElementIndex = index / 2u;
+  element.meshId = index % 97u;
+  element.materialIndex = index % 3u;
+  element.semanticTypeId = index % 4u;
+  element.productIdentityId = index + 1u;
+  element.guid = "2O2Fr$t4X7Zf8NOew3F" + std::to_string(100000u + index);
+  element.type = types[index % types.size()];
+  element.displayName =
+      "Basic Wall:Generic - 200mm:" + std::to_string(300000u + index);
+  element.objectType = "Basic Wall:Generic - 200mm";
+  element.storeyName = "Level " + std::to_string(index % 12u);
+  element.materialName = materials[index % materials.size()];
+  element.discipline = "Architecture";
+  element.phase = index % 5u == 0u ? "Existing" : "New Construction";
+  element.fireRating = index % 2u == 0u ? "2 HR" : "";
+  element.loadBearing = index % 3u == 0u ? "TRUE" : "FALSE";
+  element.status = "New";
+  element.sourceId = "revit-element-" + std::to_string(index);
+  element.transparent = index % 7u == 0u;
+  element.doubleSided = index % 11u == 0u;
+  element.geometryKind =
+      index % 13u == 0u ? BimGeometryKind::Curves : BimGeometryKind::Mesh;
+  element.bounds.valid = true;
+  element.bounds.min = {static_cast<float>(index), 0.0f, 0.0f};
+  element.bounds.max = {static_cast<float>(index) + 1.0f, 3.0f, 0.2f};
+  element.properties = {
+      {"Pset_WallCommon", "IsExternal", index % 2u ? "TRUE" : "FALSE",
+       "Identity Data"},
+      {"Pset_WallCommon", "FireRating", "2 HR", "Identity Data"},
+      {"Pset_WallCommon", "ThermalTransmittance", "0.235", "Analytical"},
+      {"Dimensions", "Length", std::to_string(index % 40u) + ".000 m",
+       "Dimensions"},
+      {"Dimensions", "Area", std::to_string(index % 25u) + ".500 m2",
+       "Dimensions"},
+      {"Other", "Mark", "W-" + std::to_string(index), "Identity Data"},
+  };
+  return element;
+}
+
+void expectSameMetadata(const BimElementMetadata &expected,
+                        const BimElementMetadata &actual) {
+  EXPECT_EQ(actual.objectIndex, expected.objectIndex);
+  EXPECT_EQ(actual.sourceElementIndex, expected.sourceElementIndex);
+  EXPECT_EQ(actual.meshId, expected.meshId);
+  EXPECT_EQ(actual.sourceMaterialIndex, expected.sourceMaterialIndex);
+  EXPECT_EQ(actual.materialIndex, expected.materialIndex);
+  EXPECT_EQ(actual.semanticTypeId, expected.semanticTypeId);
+  EXPECT_EQ(actual.productIdentityId, expected.productIdentityId);
+  EXPECT_EQ(actual.guid, expected.guid);
+  EXPECT_EQ(actual.type, expected.type);
+  EXPECT_EQ(actual.displayName, expected.displayName);
+  EXPECT_EQ(actual.objectType, expected.objectType);
+  EXPECT_EQ(actual.storeyName, expected.storeyName);
+  EXPECT_EQ(actual.storeyId, expected.storeyId);
+  EXPECT_EQ(actual.materialName, expected.materialName);
+  EXPECT_EQ(actual.materialCategory, expected.materialCategory);
+  EXPECT_EQ(actual.discipline, expected.discipline);
+  EXPECT_EQ(actual.phase, expected.phase);
+  EXPECT_EQ(actual.fireRating, expected.fireRating);
+  EXPECT_EQ(actual.loadBearing, expected.loadBearing);
+  EXPECT_EQ(actual.status, expected.status);
+  EXPECT_EQ(actual.sourceId, expected.sourceId);
+  EXPECT_EQ(actual.transparent, expected.transparent);
+  EXPECT_EQ(actual.doubleSided, expected.doubleSided);
+  EXPECT_EQ(actual.bounds.valid, expected.bounds.valid);
+  EXPECT_EQ(actual.bounds.min, expected.bounds.min);
+  EXPECT_EQ(actual.bounds.max, expected.bounds.max);
+  EXPECT_EQ(actual.geometryKind, expected.geometryKind);
+  ASSERT_EQ(actual.properties.size(), expected.properties.size());
+  for (size_t i = 0; i < expected.properties.size(); ++i) {
+    EXPECT_EQ(actual.properties[i].set, expected.properties[i].set);
+    EXPECT_EQ(actual.properties[i].name, expected.properties[i].name);
+    EXPECT_EQ(actual.properties[i].value, expected.properties[i].value);
+    EXPECT_EQ(actual.properties[i].category, expected.properties[i].category);
+  }
+}
+
+TEST(BimElementMetadataStoreTests, StringTableInternsAndKeepsEmptyAtZero) {
+  BimStringTable strings;
+  EXPECT_EQ(strings.intern(""), BimStringTable::kEmptyStringId);
+  const uint32_t wall = strings.intern("IfcWall");
+  EXPECT_NE(wall, BimStringTable::kEmptyStringId);
+  EXPECT_EQ(strings.intern(std::string("IfcWall")), wall);
+  EXPECT_EQ(strings.find("IfcWall"), wall);
+  EXPECT_EQ(strings.find("IfcSlab"), BimStringTable::kInvalidStringId);
+  EXPECT_EQ(strings.view(wall), "IfcWall");
+
+  const std::string oversized(100000u, 'x');
+  const uint32_t large = strings.intern(oversized);
+  EXPECT_EQ(strings.view(large), oversized);
+  EXPECT_EQ(strings.view(wall), "IfcWall");
+  EXPECT_EQ(strings.size(), 3u);
+
+  strings.clear();
+  EXPECT_EQ(strings.size(), 1u);
+  EXPECT_EQ(strings.find("IfcWall"), BimStringTable::kInvalidStringId);
+}
+
+TEST(BimElementMetadataStoreTests, RowsRoundTripThroughViews) {
+  BimElementMetadataStore store;
+  std::vector<BimElementMetadata> metadata;
+  for (uint32_t index = 0u; index < 64u; ++index) {
+    metadata.push_back(makeElement(index));
+    EXPECT_EQ(store.append(metadata.back()), index);
+  }
+  metadata[5].properties.clear();
+  store.clear();
+  for (const BimElementMetadata &element : metadata) {
+    (void)store.append(element);
+  }
+
+  ASSERT_EQ(store.size(), metadata.size());
+  uint32_t row = 0u;
+  for (const BimElementMetadataView view : store) {
+    ASSERT_TRUE(view.valid());
+    EXPECT_EQ(view.row(), row);
+    expectSameMetadata(metadata[row], view.toMetadata());
+    ++row;
+  }
+  EXPECT_EQ(store[5].propertyCount(), 0u);
+  EXPECT_EQ(store[6].property(5).value, "W-6");
+  EXPECT_EQ(store.back().guid(), metadata.back().guid);
+  EXPECT_FALSE(BimElementMetadataView{});
+}
+
+TEST(BimElementMetadataStoreTests, RepeatedLabelsShareStringIds) {
+  BimElementMetadataStore store;
+  for (uint32_t index = 0u; index < 200u; ++index) {
+    (void)store.append(makeElement(index));
+  }
+
+  EXPECT_EQ(store[0].fieldId(BimElementStringField::Type),
+            store[4].fieldId(BimElementStringField::Type));
+  EXPECT_NE(store[0].fieldId(BimElementStringField::Type),
+            store[1].fieldId(BimElementStringField::Type));
+  EXPECT_EQ(store[3].fieldId(BimElementStringField::StoreyId),
+            BimStringTable::kEmptyStringId);
+  EXPECT_EQ(store.fieldIds(BimElementStringField::Guid).size(), 200u);
+  EXPECT_EQ(store.propertyRecords().size(), 200u * 6u);
+  EXPECT_EQ(store[10].propertyRecords().front().setId,
+            store[11].propertyRecords().front().setId);
+
+  // Four strings are unique per element (guid, display name, source id and
+  // mark); everything else comes from a small shared vocabulary.
+  EXPECT_LT(store.strings().size(), 200u * 4u + 150u);
+}
+
+TEST(BimElementMetadataStoreTests, ColumnarStorageIsSmallerThanStructVector) {
+  constexpr uint32_t kElementCount = 50'000u;
+  std::vector<BimElementMetadata> metadata;
+  metadata.reserve(kElementCount);
+  BimElementMetadataStore store;
+  store.reserve(kElementCount);
+  for (uint32_t index = 0u; index < kElementCount; ++index) {
+    metadata.push_back(makeElement(index));
+    (void)store.append(metadata.back());
+  }
+
+  const size_t vectorBytes = vectorMetadataBytes(metadata);
+  const size_t storeBytes = store.memoryBytes();
+  RecordProperty("vector_metadata_bytes", std::to_string(vectorBytes));
+  RecordProperty("columnar_metadata_bytes", std::to_string(storeBytes));
+  EXPECT_LT(storeBytes, vectorBytes * 3u / 4u);
+}
+
+} // namespace
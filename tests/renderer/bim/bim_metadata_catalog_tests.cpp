@@ -6,6 +6,8 @@ namespace {
 
 using container::renderer::BimElementBounds;
 using container::renderer::BimElementMetadata;
+using container::renderer::BimElementMetadataStore;
+using container::renderer::BimElementMetadataView;
 using container::renderer::BimGeometryKind;
 using container::renderer::BimMetadataCatalog;
 using container::renderer::BimMetadataSemanticCategory;
@@ -72,19 +74,20 @@ TEST(BimMetadataCatalogTests, ProducesSemanticAndVisibilityIds) {
   catalog.registerLoadBearing(metadata.loadBearing);
   catalog.registerStatus(metadata.status);
 
-  EXPECT_EQ(catalog.semanticIdForMetadata(metadata, BimSemanticColorMode::Type),
+  BimElementMetadataStore store;
+  store.append(metadata);
+  const BimElementMetadataView row = store[0];
+
+  EXPECT_EQ(catalog.semanticIdForMetadata(row, BimSemanticColorMode::Type), 1u);
+  EXPECT_EQ(catalog.semanticIdForMetadata(row, BimSemanticColorMode::Storey),
+            1u);
+  EXPECT_EQ(catalog.semanticIdForMetadata(row, BimSemanticColorMode::Material),
             1u);
-  EXPECT_EQ(
-      catalog.semanticIdForMetadata(metadata, BimSemanticColorMode::Storey),
-      1u);
-  EXPECT_EQ(
-      catalog.semanticIdForMetadata(metadata, BimSemanticColorMode::Material),
-      1u);
   EXPECT_EQ(catalog.semanticIdForCategory(
                 BimMetadataSemanticCategory::Discipline, "Architecture"),
             1u);
 
-  const auto gpuMetadata = catalog.visibilityGpuMetadata(metadata);
+  const auto gpuMetadata = catalog.visibilityGpuMetadata(row);
   EXPECT_EQ(gpuMetadata.semanticIds.x, 1u);
   EXPECT_EQ(gpuMetadata.semanticIds.y, 1u);
   EXPECT_EQ(gpuMetadata.semanticIds.z, 1u);
@@ -4,16 +4,26 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <random>
+#include <string>
 #include <string_view>
 #include <vector>
 
 namespace {
 
 using container::renderer::BimModelCompareBounds;
+using container::renderer::BimModelCompareChange;
 using container::renderer::BimModelCompareChangeKind;
 using container::renderer::BimModelCompareElement;
+using container::renderer::BimModelCompareOptions;
 using container::renderer::compareBimModels;
 
+constexpr size_t kNoIndex = std::numeric_limits<size_t>::max();
+
 [[nodiscard]] BimModelCompareBounds bounds(glm::vec3 min, glm::vec3 max) {
   return {.valid = true, .min = min, .max = max};
 }
@@ -26,6 +36,175 @@ using container::renderer::compareBimModels;
   });
 }
 
+// Straightforward string-map comparison with the original grouping rules:
+// GUID groups first, then source ids of the still unmatched elements, both
+// in key order and paired by occurrence.
+[[nodiscard]] std::vector<BimModelCompareChange> referenceCompare(
+    std::span<const BimModelCompareElement> before,
+    std::span<const BimModelCompareElement> after, float tolerance) {
+  const auto identityOf = [](const BimModelCompareElement& element) {
+    return !element.guid.empty() ? element.guid : element.sourceId;
+  };
+  const auto typeOf = [](const BimModelCompareElement& element) {
+    if (!element.ifcClass.empty() && !element.type.empty()) {
+      return element.ifcClass + " / " + element.type;
+    }
+    return element.type.empty() ? element.ifcClass : element.type;
+  };
+  const auto validOf = [](const BimModelCompareBounds& value) {
+    return value.valid && std::isfinite(value.min.x) &&
+           std::isfinite(value.min.y) && std::isfinite(value.min.z) &&
+           std::isfinite(value.max.x) && std::isfinite(value.max.y) &&
+           std::isfinite(value.max.z) && value.max.x >= value.min.x &&
+           value.max.y >= value.min.y && value.max.z >= value.min.z;
+  };
+  const auto boundsChanged = [&](const BimModelCompareBounds& lhs,
+                                 const BimModelCompareBounds& rhs) {
+    if (validOf(lhs) != validOf(rhs)) {
+      return true;
+    }
+    if (!validOf(lhs)) {
+      return false;
+    }
+    const float limit = std::max(tolerance, 0.0f);
+    for (int axis = 0; axis < 3; ++axis) {
+      if (std::abs(lhs.min[axis] - rhs.min[axis]) > limit ||
+          std::abs(lhs.max[axis] - rhs.max[axis]) > limit) {
+        return true;
+      }
+    }
+    return false;
+  };
+  const auto suffixed = [](const std::string& identity, size_t occurrence) {
+    return occurrence <= 1u ? identity
+                            : identity + "#" + std::to_string(occurrence);
+  };
+
+  std::vector<BimModelCompareChange> changes;
+  std::vector<bool> beforeMatched(before.size(), false);
+  std::vector<bool> afterMatched(after.size(), false);
+  for (const bool byGuid : {true, false}) {
+    using Groups = std::map<std::string, std::vector<size_t>>;
+    const auto group = [byGuid](std::span<const BimModelCompareElement> side,
+                                const std::vector<bool>& matched) {
+      Groups groups;
+      for (size_t index = 0; index < side.size(); ++index) {
+        const std::string& key =
+            byGuid ? side[index].guid : side[index].sourceId;
+        if (!matched[index] && !key.empty()) {
+          groups[key].push_back(index);
+        }
+      }
+      return groups;
+    };
+    const Groups beforeGroups = group(before, beforeMatched);
+    const Groups afterGroups = group(after, afterMatched);
+    for (const auto& [key, beforeIndices] : beforeGroups) {
+      const auto found = afterGroups.find(key);
+      if (found == afterGroups.end()) {
+        continue;
+      }
+      const size_t count = std::min(beforeIndices.size(), found->second.size());
+      for (size_t occurrence = 0; occurrence < count; ++occurrence) {
+        const size_t b = beforeIndices[occurrence];
+        const size_t a = found->second[occurrence];
+        beforeMatched[b] = true;
+        afterMatched[a] = true;
+        const std::string identity = suffixed(key, occurrence + 1u);
+        const auto add = [&](BimModelCompareChangeKind kind,
+                             std::string beforeValue,
+                             std::string afterValue) {
+          changes.push_back({kind, identity, b, a, std::move(beforeValue),
+                             std::move(afterValue)});
+        };
+        if (typeOf(before[b]) != typeOf(after[a])) {
+          add(BimModelCompareChangeKind::ChangedType, typeOf(before[b]),
+              typeOf(after[a]));
+        }
+        if (before[b].storey != after[a].storey) {
+          add(BimModelCompareChangeKind::ChangedStorey, before[b].storey,
+              after[a].storey);
+        }
+        if (before[b].material != after[a].material) {
+          add(BimModelCompareChangeKind::ChangedMaterial, before[b].material,
+              after[a].material);
+        }
+        if (boundsChanged(before[b].bounds, after[a].bounds)) {
+          add(BimModelCompareChangeKind::ChangedBounds, {}, {});
+        }
+      }
+    }
+  }
+
+  const auto unmatched = [&](std::span<const BimModelCompareElement> side,
+                             const std::vector<bool>& matched,
+                             BimModelCompareChangeKind kind) {
+    std::map<std::string, size_t> seen;
+    for (size_t index = 0; index < side.size(); ++index) {
+      const std::string identity = identityOf(side[index]);
+      const size_t occurrence = ++seen[identity];
+      if (matched[index] || identity.empty()) {
+        continue;
+      }
+      const bool removed = kind == BimModelCompareChangeKind::Removed;
+      changes.push_back({kind, suffixed(identity, occurrence),
+                         removed ? index : kNoIndex,
+                         removed ? kNoIndex : index, {}, {}});
+    }
+  };
+  unmatched(before, beforeMatched, BimModelCompareChangeKind::Removed);
+  unmatched(after, afterMatched, BimModelCompareChangeKind::Added);
+  return changes;
+}
+
+void expectSameChanges(const std::vector<BimModelCompareChange>& expected,
+                       const std::vector<BimModelCompareChange>& actual) {
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t index = 0; index < expected.size(); ++index) {
+    SCOPED_TRACE(index);
+    EXPECT_EQ(actual[index].kind, expected[index].kind);
+    EXPECT_EQ(actual[index].identity, expected[index].identity);
+    EXPECT_EQ(actual[index].beforeIndex, expected[index].beforeIndex);
+    EXPECT_EQ(actual[index].afterIndex, expected[index].afterIndex);
+    EXPECT_EQ(actual[index].beforeValue, expected[index].beforeValue);
+    EXPECT_EQ(actual[index].afterValue, expected[index].afterValue);
+  }
+}
+
+// Small key vocabularies force duplicate GUIDs, GUIDs that collide with
+// source ids, elements without identity and bounds near the tolerance.
+[[nodiscard]] std::vector<BimModelCompareElement> randomRevision(
+    std::mt19937& rng, size_t count, uint32_t keySpace) {
+  static const std::array<std::string, 4u> classes{"", "IfcWall", "IfcSlab",
+                                                   "IfcDoor"};
+  static const std::array<std::string, 3u> storeys{"", "Level 01",
+                                                   "Level 02"};
+  std::uniform_int_distribution<uint32_t> key(0u, keySpace);
+  std::uniform_int_distribution<uint32_t> pick(0u, 9u);
+  std::uniform_real_distribution<float> jitter(-0.002f, 0.002f);
+
+  std::vector<BimModelCompareElement> elements(count);
+  for (BimModelCompareElement& element : elements) {
+    if (pick(rng) < 7u) {
+      element.guid = "id-" + std::to_string(key(rng));
+    }
+    if (pick(rng) < 6u) {
+      element.sourceId = pick(rng) < 2u ? "id-" + std::to_string(key(rng))
+                                        : "#" + std::to_string(key(rng));
+    }
+    element.ifcClass = classes[pick(rng) % classes.size()];
+    element.type = pick(rng) < 5u ? "" : classes[pick(rng) % classes.size()];
+    element.storey = storeys[pick(rng) % storeys.size()];
+    element.material = pick(rng) < 8u ? "Concrete" : "Timber";
+    if (pick(rng) < 8u) {
+      const float offset = pick(rng) < 5u ? 0.0f : jitter(rng);
+      element.bounds = bounds({offset, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f});
+      element.bounds.valid = pick(rng) != 0u;
+    }
+  }
+  return elements;
+}
+
 TEST(BimModelCompareTests, DetectsAddedAndRemovedByGuidOrSourceId) {
   const std::array before{
       BimModelCompareElement{.guid = "guid-wall",
@@ -174,4 +353,65 @@ TEST(BimModelCompareTests, DuplicateIdentityCountDifferencesAreReported) {
   EXPECT_EQ(result.changes.front().beforeIndex, 1u);
 }
 
+TEST(BimModelCompareTests, HashedComparisonMatchesStringMapReference) {
+  std::mt19937 rng(0xc0ffee);
+  for (const auto& [count, keySpace] :
+       std::array<std::pair<size_t, uint32_t>, 4u>{
+           {{8u, 4u}, {200u, 60u}, {2000u, 3000u}, {40000u, 30000u}}}) {
+    const std::vector<BimModelCompareElement> before =
+        randomRevision(rng, count, keySpace);
+    const std::vector<BimModelCompareElement> after =
+        randomRevision(rng, count + count / 10u, keySpace);
+    for (const float tolerance : {0.001f, 0.0f, -1.0f}) {
+      SCOPED_TRACE(count);
+      const std::vector<BimModelCompareChange> expected =
+          referenceCompare(before, after, tolerance);
+      for (const uint32_t workers : {1u, 4u}) {
+        expectSameChanges(expected,
+                          compareBimModels(before, after,
+                                           BimModelCompareOptions{
+                                               .boundsTolerance = tolerance,
+                                               .workerCount = workers})
+                              .changes);
+      }
+    }
+  }
+}
+
+TEST(BimModelCompareTests, LargeRevisionReportsOnlyEditedElements) {
+  constexpr size_t kElementCount = 200'000u;
+  std::vector<BimModelCompareElement> before(kElementCount);
+  for (size_t index = 0; index < kElementCount; ++index) {
+    const float x = static_cast<float>(index % 1000u);
+    before[index] = {.guid = "3cUkl32yn9qRSPvBJVyWw" + std::to_string(index),
+                     .sourceId = "#" + std::to_string(index),
+                     .ifcClass = "IfcWall",
+                     .type = "Basic Wall:Generic - 200mm",
+                     .storey = "Level " + std::to_string(index % 12u),
+                     .material = "Concrete",
+                     .bounds = bounds({x, 0.0f, 0.0f}, {x + 1.0f, 3.0f, 0.2f})};
+  }
+  std::vector<BimModelCompareElement> after = before;
+  after[17].storey = "Level 99";
+  after[90'000].bounds.max.x += 0.5f;
+  after[150'000].guid = "regenerated";
+  after.push_back({.guid = "new-wall", .type = "IfcWall"});
+
+  const auto start = std::chrono::steady_clock::now();
+  const auto result = compareBimModels(before, after);
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  RecordProperty(
+      "compare_ms",
+      std::to_string(
+          std::chrono::duration<double, std::milli>(elapsed).count()));
+
+  ASSERT_EQ(result.changes.size(), 3u);
+  EXPECT_EQ(result.changes[0].kind, BimModelCompareChangeKind::ChangedStorey);
+  EXPECT_EQ(result.changes[0].beforeIndex, 17u);
+  EXPECT_EQ(result.changes[1].kind, BimModelCompareChangeKind::ChangedBounds);
+  EXPECT_EQ(result.changes[1].afterIndex, 90'000u);
+  EXPECT_EQ(result.changes[2].kind, BimModelCompareChangeKind::Added);
+  EXPECT_EQ(result.changes[2].identity, "new-wall");
+}
+
 } // namespace
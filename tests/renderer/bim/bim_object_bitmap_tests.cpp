@@ -0,0 +1,116 @@
+#include "Container/renderer/bim/BimObjectBitmap.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace {
+
+using container::renderer::BimObjectBitmap;
+using container::renderer::kBimObjectBitmapArrayLimit;
+
+[[nodiscard]] std::vector<uint32_t> sorted(const std::set<uint32_t> &values) {
+  return {values.begin(), values.end()};
+}
+
+[[nodiscard]] std::set<uint32_t> randomSet(std::mt19937 &rng, size_t count,
+                                           uint32_t maxValue) {
+  std::uniform_int_distribution<uint32_t> value(0u, maxValue);
+  std::set<uint32_t> values;
+  for (size_t i = 0; i < count; ++i) {
+    values.insert(value(rng));
+  }
+  return values;
+}
+
+[[nodiscard]] BimObjectBitmap toBitmap(const std::set<uint32_t> &values) {
+  const std::vector<uint32_t> indices = sorted(values);
+  return BimObjectBitmap::fromIndices(indices);
+}
+
+TEST(BimObjectBitmapTests, AddContainsAndIterateAcrossBuckets) {
+  BimObjectBitmap bitmap;
+  bitmap.add(70000u);
+  bitmap.add(3u);
+  bitmap.add(65535u);
+  bitmap.add(3u);
+  bitmap.add(1u);
+
+  EXPECT_EQ(bitmap.cardinality(), 4u);
+  EXPECT_EQ(bitmap.containerCount(), 2u);
+  EXPECT_TRUE(bitmap.contains(1u));
+  EXPECT_TRUE(bitmap.contains(65535u));
+  EXPECT_TRUE(bitmap.contains(70000u));
+  EXPECT_FALSE(bitmap.contains(2u));
+  EXPECT_FALSE(bitmap.contains(65536u));
+  EXPECT_EQ(bitmap.toVector(),
+            (std::vector<uint32_t>{1u, 3u, 65535u, 70000u}));
+}
+
+TEST(BimObjectBitmapTests, DenseBucketsUseBitsetsAndShrinkBack) {
+  const BimObjectBitmap full = BimObjectBitmap::range(0u, 65536u);
+  EXPECT_EQ(full.cardinality(), 65536u);
+  EXPECT_LT(full.memoryBytes(), 65536u * sizeof(uint16_t));
+
+  BimObjectBitmap sparse;
+  for (uint32_t index = 0u; index < kBimObjectBitmapArrayLimit; index += 2u) {
+    sparse.add(index);
+  }
+  const BimObjectBitmap intersection = full & sparse;
+  EXPECT_EQ(intersection, sparse);
+  EXPECT_EQ(intersection.cardinality(), kBimObjectBitmapArrayLimit / 2u);
+
+  const BimObjectBitmap remainder = full - sparse;
+  EXPECT_EQ(remainder.cardinality(), 65536u - kBimObjectBitmapArrayLimit / 2u);
+  EXPECT_FALSE(remainder.contains(0u));
+  EXPECT_TRUE(remainder.contains(1u));
+}
+
+TEST(BimObjectBitmapTests, RangeMatchesIndividualAdds) {
+  const BimObjectBitmap range = BimObjectBitmap::range(65530u, 140000u);
+  BimObjectBitmap added;
+  for (uint32_t index = 65530u; index < 140000u; ++index) {
+    added.add(index);
+  }
+  EXPECT_EQ(range, added);
+  EXPECT_TRUE(BimObjectBitmap::range(5u, 5u).empty());
+}
+
+TEST(BimObjectBitmapTests, SetAlgebraMatchesStdSetReference) {
+  std::mt19937 rng(0x5eed);
+  const std::array<std::pair<size_t, uint32_t>, 4u> shapes{{
+      {64u, 1000u},
+      {6000u, 20000u},
+      {30000u, 200000u},
+      {90000u, 140000u},
+  }};
+  for (const auto &[lhsCount, lhsMax] : shapes) {
+    for (const auto &[rhsCount, rhsMax] : shapes) {
+      const std::set<uint32_t> lhs = randomSet(rng, lhsCount, lhsMax);
+      const std::set<uint32_t> rhs = randomSet(rng, rhsCount, rhsMax);
+
+      std::vector<uint32_t> expectedAnd;
+      std::ranges::set_intersection(lhs, rhs, std::back_inserter(expectedAnd));
+      std::vector<uint32_t> expectedOr;
+      std::ranges::set_union(lhs, rhs, std::back_inserter(expectedOr));
+      std::vector<uint32_t> expectedAndNot;
+      std::ranges::set_difference(lhs, rhs,
+                                  std::back_inserter(expectedAndNot));
+
+      const BimObjectBitmap lhsBitmap = toBitmap(lhs);
+      const BimObjectBitmap rhsBitmap = toBitmap(rhs);
+      EXPECT_EQ(lhsBitmap.toVector(), sorted(lhs));
+      EXPECT_EQ((lhsBitmap & rhsBitmap).toVector(), expectedAnd);
+      EXPECT_EQ((lhsBitmap | rhsBitmap).toVector(), expectedOr);
+      EXPECT_EQ((lhsBitmap - rhsBitmap).toVector(), expectedAndNot);
+      EXPECT_EQ((lhsBitmap | rhsBitmap).cardinality(), expectedOr.size());
+    }
+  }
+}
+
+} // namespace
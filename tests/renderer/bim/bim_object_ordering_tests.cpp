@@ -0,0 +1,213 @@
+#include "Container/renderer/bim/BimObjectOrdering.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <span>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+using container::renderer::BimObjectOrderKey;
+using container::renderer::countBimInstancedDrawRuns;
+using container::renderer::orderBimObjects;
+
+struct SyntheticBuilding {
+  std::vector<std::string> storeyNames;
+  std::vector<BimObjectOrderKey> keys;
+};
+
+// `storeys` floors of `windowsPerStorey` windows drawn from four shared
+// window meshes plus a unique wall mesh per storey. Elements are listed in a
+// shuffled order, as exporters that group by type or facade tend to do.
+SyntheticBuilding makeRepetitiveBuilding(uint32_t storeys,
+                                         uint32_t windowsPerStorey) {
+  SyntheticBuilding building;
+  building.storeyNames.reserve(storeys);
+  for (uint32_t storey = 0; storey < storeys; ++storey) {
+    building.storeyNames.push_back("Level " + std::to_string(storey));
+  }
+
+  for (uint32_t storey = 0; storey < storeys; ++storey) {
+    const float elevation = static_cast<float>(storey) * 3.0f;
+    for (uint32_t window = 0; window < windowsPerStorey; ++window) {
+      const uint32_t mesh = window % 4u;
+      building.keys.push_back(BimObjectOrderKey{
+          .firstIndex = mesh * 36u,
+          .indexCount = 36u,
+          .storey = building.storeyNames[storey],
+          .materialIndex = 1u + (window / 4u) % 3u,
+          .hasBounds = true,
+          .center = {static_cast<float>(window) * 1.5f, elevation + 1.5f,
+                     0.0f},
+          .floorElevation = elevation + 0.9f,
+      });
+    }
+    building.keys.push_back(BimObjectOrderKey{
+        .firstIndex = 1000u + storey * 600u,
+        .indexCount = 600u,
+        .storey = building.storeyNames[storey],
+        .materialIndex = 0u,
+        .hasBounds = true,
+        .center = {0.0f, elevation + 1.5f, 0.0f},
+        .floorElevation = elevation,
+    });
+  }
+
+  std::mt19937 rng(7u);
+  std::ranges::shuffle(building.keys, rng);
+  for (size_t i = 0; i < building.keys.size(); ++i) {
+    building.keys[i].sourceElementIndex = static_cast<uint32_t>(i);
+  }
+  return building;
+}
+
+// Object order before load-time ordering: draw groups only, source order
+// inside each group.
+std::vector<uint32_t>
+drawGroupOnlyOrder(std::span<const BimObjectOrderKey> keys) {
+  std::vector<uint32_t> order(keys.size());
+  std::iota(order.begin(), order.end(), 0u);
+  std::ranges::stable_sort(order, [&](uint32_t lhs, uint32_t rhs) {
+    return std::tie(keys[lhs].bucket, keys[lhs].geometryKind,
+                    keys[lhs].firstIndex, keys[lhs].indexCount) <
+           std::tie(keys[rhs].bucket, keys[rhs].geometryKind,
+                    keys[rhs].firstIndex, keys[rhs].indexCount);
+  });
+  return order;
+}
+
+std::vector<uint8_t> visibleWhere(std::span<const BimObjectOrderKey> keys,
+                                  auto predicate) {
+  std::vector<uint8_t> visible(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    visible[i] = predicate(keys[i]) ? 1u : 0u;
+  }
+  return visible;
+}
+
+size_t runs(std::span<const BimObjectOrderKey> keys,
+            std::span<const uint32_t> order,
+            const std::vector<uint8_t> &visible) {
+  return countBimInstancedDrawRuns(keys, order, visible);
+}
+
+TEST(BimObjectOrdering, ProducesDeterministicPermutationWithContiguousGroups) {
+  SyntheticBuilding building = makeRepetitiveBuilding(6u, 40u);
+  const std::vector<uint32_t> order = orderBimObjects(building.keys);
+
+  std::vector<uint32_t> sorted = order;
+  std::ranges::sort(sorted);
+  std::vector<uint32_t> identity(building.keys.size());
+  std::iota(identity.begin(), identity.end(), 0u);
+  EXPECT_EQ(sorted, identity);
+
+  // Every draw group occupies a single contiguous object range.
+  std::vector<uint32_t> seenGroups;
+  for (size_t i = 0; i < order.size(); ++i) {
+    const uint32_t group = building.keys[order[i]].firstIndex;
+    if (i == 0 || building.keys[order[i - 1u]].firstIndex != group) {
+      EXPECT_EQ(std::ranges::count(seenGroups, group), 0) << group;
+      seenGroups.push_back(group);
+    }
+  }
+
+  // Reshuffling the input only relabels it: the source-element sequence in
+  // object order is unchanged.
+  std::vector<uint32_t> expectedSources;
+  for (const uint32_t index : order) {
+    expectedSources.push_back(building.keys[index].sourceElementIndex);
+  }
+  std::mt19937 rng(99u);
+  std::ranges::shuffle(building.keys, rng);
+  std::vector<uint32_t> reshuffledSources;
+  for (const uint32_t index : orderBimObjects(building.keys)) {
+    reshuffledSources.push_back(building.keys[index].sourceElementIndex);
+  }
+  EXPECT_EQ(reshuffledSources, expectedSources);
+}
+
+TEST(BimObjectOrdering, GroupsStoreysBottomUpInsideEachMesh) {
+  SyntheticBuilding building = makeRepetitiveBuilding(4u, 8u);
+  // Name the storeys top-down so that name order and elevation order
+  // disagree; the ordering has to follow elevation.
+  const std::vector<std::string> topDownNames = {"Roof", "Level B", "Level A",
+                                                 "Basement"};
+  for (BimObjectOrderKey &key : building.keys) {
+    const auto storey = std::ranges::find(building.storeyNames, key.storey);
+    ASSERT_NE(storey, building.storeyNames.end());
+    key.storey = topDownNames[static_cast<size_t>(
+        std::distance(building.storeyNames.begin(), storey))];
+  }
+
+  const std::vector<uint32_t> order = orderBimObjects(building.keys);
+  size_t storeyChanges = 0;
+  for (size_t i = 1; i < order.size(); ++i) {
+    const BimObjectOrderKey &previous = building.keys[order[i - 1u]];
+    const BimObjectOrderKey &current = building.keys[order[i]];
+    if (previous.firstIndex == current.firstIndex &&
+        previous.storey != current.storey) {
+      ++storeyChanges;
+      EXPECT_LT(previous.floorElevation, current.floorElevation);
+      EXPECT_GT(previous.storey, current.storey);
+    }
+  }
+  // Three storey boundaries inside each of the four shared window meshes.
+  EXPECT_EQ(storeyChanges, 12u);
+}
+
+TEST(BimObjectOrdering, StoreyAndMaterialFiltersKeepLongInstanceRuns) {
+  const SyntheticBuilding building = makeRepetitiveBuilding(10u, 2000u);
+  const std::vector<BimObjectOrderKey> &keys = building.keys;
+  const std::vector<uint32_t> baseline = drawGroupOnlyOrder(keys);
+  const std::vector<uint32_t> ordered = orderBimObjects(keys);
+
+  const std::vector<uint8_t> all(keys.size(), 1u);
+  EXPECT_EQ(runs(keys, ordered, all), runs(keys, baseline, all));
+
+  const auto storey = visibleWhere(keys, [&](const BimObjectOrderKey &key) {
+    return key.storey == building.storeyNames[3];
+  });
+  const auto material = visibleWhere(keys, [](const BimObjectOrderKey &key) {
+    return key.materialIndex == 2u;
+  });
+  const size_t baselineStoreyRuns = runs(keys, baseline, storey);
+  const size_t orderedStoreyRuns = runs(keys, ordered, storey);
+  const size_t baselineMaterialRuns = runs(keys, baseline, material);
+  const size_t orderedMaterialRuns = runs(keys, ordered, material);
+  RecordProperty("storey_filter_draws_before",
+                 std::to_string(baselineStoreyRuns));
+  RecordProperty("storey_filter_draws_after",
+                 std::to_string(orderedStoreyRuns));
+  RecordProperty("material_filter_draws_before",
+                 std::to_string(baselineMaterialRuns));
+  RecordProperty("material_filter_draws_after",
+                 std::to_string(orderedMaterialRuns));
+
+  // One run per window mesh plus the storey's wall.
+  EXPECT_EQ(orderedStoreyRuns, 5u);
+  EXPECT_GT(baselineStoreyRuns, 100u * orderedStoreyRuns);
+  // Materials are nested inside storeys: one run per (storey, mesh) pair.
+  EXPECT_EQ(orderedMaterialRuns, 40u);
+  EXPECT_GT(baselineMaterialRuns, 10u * orderedMaterialRuns);
+}
+
+TEST(BimObjectOrdering, ObjectsWithoutBoundsFollowPositionedOnes) {
+  std::vector<BimObjectOrderKey> keys(3);
+  for (uint32_t i = 0; i < keys.size(); ++i) {
+    keys[i].indexCount = 3u;
+    keys[i].sourceElementIndex = i;
+  }
+  keys[1].hasBounds = true;
+  keys[1].center = {5.0f, 0.0f, 0.0f};
+  keys[2].hasBounds = true;
+  keys[2].center = {-5.0f, 0.0f, 0.0f};
+  EXPECT_EQ(orderBimObjects(keys), (std::vector<uint32_t>{2u, 1u, 0u}));
+}
+
+} // namespace
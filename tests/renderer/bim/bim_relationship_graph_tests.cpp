@@ -1,11 +1,15 @@
 #include "Container/renderer/bim/BimRelationshipGraph.h"
 
 #include "Container/geometry/DotBimLoader.h"
+#include "Container/renderer/bim/BimElementMetadataStore.h"
 #include "Container/renderer/bim/BimManager.h"
 
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -13,11 +17,22 @@ namespace {
 
 using container::geometry::dotbim::ElementRelationship;
 using container::renderer::BimElementMetadata;
+using container::renderer::BimElementMetadataStore;
 using container::renderer::BimElementProperty;
 using container::renderer::BimRelationshipEdge;
 using container::renderer::BimRelationshipGraph;
 using container::renderer::BimRelationshipKind;
 
+[[nodiscard]] BimElementMetadataStore
+makeStore(const std::vector<BimElementMetadata> &metadata) {
+  BimElementMetadataStore store;
+  store.reserve(metadata.size());
+  for (const BimElementMetadata &element : metadata) {
+    store.append(element);
+  }
+  return store;
+}
+
 [[nodiscard]] BimElementMetadata makeElement(uint32_t objectIndex,
                                              std::string_view guid,
                                              std::string_view sourceId,
@@ -49,6 +64,18 @@ using container::renderer::BimRelationshipKind;
   });
 }
 
+[[nodiscard]] bool containsIgnoringCase(std::string_view text,
+                                        std::string_view query) {
+  const auto lower = [](std::string_view value) {
+    std::string result(value);
+    std::ranges::transform(result, result.begin(), [](unsigned char c) {
+      return static_cast<char>(std::tolower(c));
+    });
+    return result;
+  };
+  return lower(text).find(lower(query)) != std::string::npos;
+}
+
 TEST(BimRelationshipGraphTests, BuildsSpatialContainmentAndPropertySets) {
   std::vector<BimElementMetadata> metadata;
   metadata.push_back(makeElement(0u, "building-guid", "building-1",
@@ -79,7 +106,7 @@ TEST(BimRelationshipGraphTests, BuildsSpatialContainmentAndPropertySets) {
                                               .label = "contains"});
 
   BimRelationshipGraph graph;
-  graph.build(metadata, relationships);
+  graph.build(makeStore(metadata), relationships);
 
   EXPECT_GE(graph.nodes().size(), metadata.size() + 3u);
   EXPECT_TRUE(hasEdge(graph.edgesForObject(2u),
@@ -135,7 +162,7 @@ TEST(BimRelationshipGraphTests, FindsSystemsZonesAndClassificationsByGuid) {
                                               .label = "OmniClass"});
 
   BimRelationshipGraph graph;
-  graph.build(metadata, relationships);
+  graph.build(makeStore(metadata), relationships);
 
   const auto edges = graph.edgesForObject(0u);
   EXPECT_TRUE(hasEdge(edges, BimRelationshipKind::SystemAssignment));
@@ -159,7 +186,7 @@ TEST(BimRelationshipGraphTests, ReusesRealStoreyNodeForInferredSpatialParent) {
   metadata.push_back(std::move(wall));
 
   BimRelationshipGraph graph;
-  graph.build(metadata, {});
+  graph.build(makeStore(metadata), {});
 
   const auto children = graph.childrenForObject(1u);
   EXPECT_NE(std::ranges::find_if(children,
@@ -193,7 +220,7 @@ TEST(BimRelationshipGraphTests,
                                               .label = "Supply Air"});
 
   BimRelationshipGraph graph;
-  graph.build(metadata, relationships);
+  graph.build(makeStore(metadata), relationships);
 
   EXPECT_TRUE(hasEdge(graph.edgesForObject(10u),
                       BimRelationshipKind::SystemAssignment));
@@ -213,7 +240,7 @@ TEST(BimRelationshipGraphTests,
                                                .category = "IfcPropertySet"});
 
   BimRelationshipGraph graph;
-  graph.build(std::vector<BimElementMetadata>{wall}, {});
+  graph.build(makeStore({wall}), {});
 
   EXPECT_TRUE(hasSearchHit(graph, "Lobby", 4u, "element name"));
   EXPECT_TRUE(hasSearchHit(graph, "wall-guid", 4u, "guid"));
@@ -224,4 +251,99 @@ TEST(BimRelationshipGraphTests,
   EXPECT_TRUE(hasSearchHit(graph, "2HR", 4u, "property value"));
 }
 
+TEST(BimRelationshipGraphTests, SearchRanksExactPrefixAndWordMatchesFirst) {
+  std::vector<BimElementMetadata> metadata;
+  metadata.push_back(makeElement(0u, "g0", "s0", "IfcSlab", "Subpanel"));
+  metadata.push_back(makeElement(1u, "g1", "s1", "IfcSlab", "Roof Panel"));
+  metadata.push_back(makeElement(2u, "g2", "s2", "IfcSlab", "Panel Frame"));
+  metadata.push_back(makeElement(3u, "g3", "s3", "IfcSlab", "PANEL"));
+
+  BimRelationshipGraph graph;
+  graph.build(makeStore(metadata), {});
+
+  const auto hits = graph.search("panel");
+  ASSERT_EQ(hits.size(), 4u);
+  EXPECT_EQ(hits[0].objectIndex, 3u);
+  EXPECT_EQ(hits[1].objectIndex, 2u);
+  EXPECT_EQ(hits[2].objectIndex, 1u);
+  EXPECT_EQ(hits[3].objectIndex, 0u);
+
+  const auto page = graph.searchPage("panel", 1u, 2u);
+  EXPECT_EQ(page.totalMatches, 4u);
+  ASSERT_EQ(page.results.size(), 2u);
+  EXPECT_EQ(page.results[0].objectIndex, 2u);
+  EXPECT_EQ(page.results[1].objectIndex, 1u);
+  EXPECT_TRUE(graph.searchPage("panel", 4u, 2u).results.empty());
+  EXPECT_TRUE(graph.search("panels").empty());
+}
+
+TEST(BimRelationshipGraphTests, TrigramIndexMatchesLinearSubstringScan) {
+  std::vector<BimElementMetadata> metadata;
+  for (uint32_t index = 0u; index < 500u; ++index) {
+    BimElementMetadata element =
+        makeElement(index, "guid-" + std::to_string(index * 7919u % 1000u),
+                    "src-" + std::to_string(index), "IfcWall",
+                    "Wall " + std::to_string(index % 37u));
+    element.materialName = index % 3u == 0u ? "Concrete" : "Steel Stud";
+    element.storeyName = "Level " + std::to_string(index % 5u);
+    metadata.push_back(std::move(element));
+  }
+  BimRelationshipGraph graph;
+  graph.build(makeStore(metadata), {});
+
+  for (const std::string_view query :
+       {"w", "al", "wall 1", "GUID-9", "ncr", "steel s", "level 4", "l 3",
+        "src-49", "zzz", "ifcwall"}) {
+    size_t expected = 0u;
+    for (const BimElementMetadata &element : metadata) {
+      for (const std::string_view field :
+           {std::string_view(element.displayName),
+            std::string_view(element.guid), std::string_view(element.sourceId),
+            std::string_view(element.type),
+            std::string_view(element.storeyName),
+            std::string_view(element.materialName)}) {
+        expected += containsIgnoringCase(field, query) ? 1u : 0u;
+      }
+    }
+    const auto hits = graph.search(query);
+    EXPECT_EQ(hits.size(), expected) << query;
+    for (const auto &hit : hits) {
+      EXPECT_TRUE(containsIgnoringCase(hit.matchedText, query)) << query;
+    }
+  }
+}
+
+TEST(BimRelationshipGraphTests, SearchBenchmarkOnMillionElementCorpus) {
+  constexpr uint32_t kElementCount = 1'000'000u;
+  std::vector<BimElementMetadata> metadata;
+  metadata.reserve(kElementCount);
+  for (uint32_t index = 0u; index < kElementCount; ++index) {
+    BimElementMetadata element{};
+    element.objectIndex = index;
+    element.guid = "3vB2" + std::to_string(index * 2654435761u);
+    element.displayName = "Element " + std::to_string(index);
+    metadata.push_back(std::move(element));
+  }
+
+  const BimElementMetadataStore store = makeStore(metadata);
+
+  using Clock = std::chrono::steady_clock;
+  BimRelationshipGraph graph;
+  const auto buildStart = Clock::now();
+  graph.build(store, {});
+  const auto buildTime = Clock::now() - buildStart;
+
+  const auto queryStart = Clock::now();
+  const auto page = graph.searchPage("element 123456", 0u, 64u);
+  const auto queryTime = Clock::now() - queryStart;
+
+  ASSERT_EQ(page.totalMatches, 1u);
+  EXPECT_EQ(page.results.front().objectIndex, 123456u);
+  const auto toMs = [](auto duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+  };
+  RecordProperty("build_ms", std::to_string(toMs(buildTime)));
+  RecordProperty("query_ms", std::to_string(toMs(queryTime)));
+}
+
 } // namespace
@@ -0,0 +1,340 @@
+#include "Container/renderer/bim/BimSectionCapCache.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using container::renderer::appendBimSectionMarkerGeometry;
+using container::renderer::BimSectionCapBuildOptions;
+using container::renderer::BimSectionCapCache;
+using container::renderer::BimSectionCapCacheUpdate;
+using container::renderer::BimSectionCapGeneratedMesh;
+using container::renderer::BimSectionCapTriangle;
+using container::renderer::BuildBimSectionCapMesh;
+using container::renderer::DrawCommand;
+
+using CapScene = std::vector<std::vector<BimSectionCapTriangle>>;
+
+std::vector<BimSectionCapTriangle> boxTriangles(uint32_t objectIndex,
+                                                uint32_t materialIndex,
+                                                const glm::vec3& center,
+                                                const glm::vec3& halfExtent,
+                                                float yawRadians) {
+  const float c = std::cos(yawRadians);
+  const float s = std::sin(yawRadians);
+  auto corner = [&](float x, float y, float z) {
+    const glm::vec3 local = glm::vec3{x, y, z} * halfExtent;
+    return center + glm::vec3{c * local.x + s * local.z, local.y,
+                              -s * local.x + c * local.z};
+  };
+  const std::array<glm::vec3, 8> v{{
+      corner(-1.0f, -1.0f, -1.0f),
+      corner(1.0f, -1.0f, -1.0f),
+      corner(1.0f, 1.0f, -1.0f),
+      corner(-1.0f, 1.0f, -1.0f),
+      corner(-1.0f, -1.0f, 1.0f),
+      corner(1.0f, -1.0f, 1.0f),
+      corner(1.0f, 1.0f, 1.0f),
+      corner(-1.0f, 1.0f, 1.0f),
+  }};
+  const std::array<std::array<uint32_t, 3>, 12> faces{{
+      {{0u, 1u, 2u}},
+      {{0u, 2u, 3u}},
+      {{4u, 6u, 5u}},
+      {{4u, 7u, 6u}},
+      {{0u, 4u, 5u}},
+      {{0u, 5u, 1u}},
+      {{1u, 5u, 6u}},
+      {{1u, 6u, 2u}},
+      {{2u, 6u, 7u}},
+      {{2u, 7u, 3u}},
+      {{3u, 7u, 4u}},
+      {{3u, 4u, 0u}},
+  }};
+
+  std::vector<BimSectionCapTriangle> triangles;
+  triangles.reserve(faces.size());
+  for (const auto& face : faces) {
+    triangles.push_back({
+        .objectIndex = objectIndex,
+        .materialIndex = materialIndex,
+        .p0 = v[face[0]],
+        .p1 = v[face[1]],
+        .p2 = v[face[2]],
+    });
+  }
+  return triangles;
+}
+
+// A 6 x 6 grid of boxes of varying size, height and yaw, stacked over about
+// ten units so a horizontal plane cuts only a few of them.
+CapScene gridScene() {
+  std::mt19937 random(7u);
+  std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+  CapScene scene;
+  for (uint32_t row = 0; row < 6u; ++row) {
+    for (uint32_t column = 0; column < 6u; ++column) {
+      const auto objectIndex = static_cast<uint32_t>(scene.size());
+      const glm::vec3 center{static_cast<float>(column) * 4.0f,
+                             unit(random) * 10.0f,
+                             static_cast<float>(row) * 4.0f};
+      const glm::vec3 halfExtent{0.5f + unit(random), 0.4f + unit(random),
+                                 0.5f + unit(random)};
+      scene.push_back(boxTriangles(objectIndex, objectIndex % 3u, center,
+                                   halfExtent, unit(random) * 1.5f));
+    }
+  }
+  return scene;
+}
+
+BimSectionCapBuildOptions baseOptions() {
+  BimSectionCapBuildOptions options{};
+  options.hatchSpacing = 0.3f;
+  options.workerCount = 1u;
+  return options;
+}
+
+BimSectionCapCacheUpdate buildCaps(BimSectionCapCache& cache,
+                                   const CapScene& scene,
+                                   const BimSectionCapBuildOptions& options) {
+  for (uint32_t objectIndex = 0; objectIndex < scene.size(); ++objectIndex) {
+    if (!cache.needsRebuild(objectIndex, options)) {
+      continue;
+    }
+    cache.store(objectIndex, options, scene[objectIndex],
+                BuildBimSectionCapMesh(scene[objectIndex], options));
+  }
+  return cache.commit();
+}
+
+struct ResolvedCommand {
+  uint32_t objectIndex{0};
+  std::vector<glm::vec3> positions{};
+  float lineWidth{0.0f};
+};
+
+struct ResolvedCaps {
+  std::vector<ResolvedCommand> fill{};
+  std::vector<ResolvedCommand> hatch{};
+  std::vector<std::pair<glm::vec3, glm::vec3>> markers{};
+};
+
+// Geometry as drawn, independent of where each cap sits in the buffers.
+void resolveInto(const BimSectionCapGeneratedMesh& mesh, ResolvedCaps& out) {
+  auto resolve = [&](const std::vector<DrawCommand>& commands,
+                     const auto& styles, std::vector<ResolvedCommand>& list) {
+    for (size_t i = 0; i < commands.size(); ++i) {
+      ResolvedCommand resolved{.objectIndex = commands[i].objectIndex,
+                               .lineWidth = styles[i].lineWidth};
+      for (uint32_t index = 0; index < commands[i].indexCount; ++index) {
+        resolved.positions.push_back(
+            mesh.vertices[mesh.indices[commands[i].firstIndex + index]]
+                .position);
+      }
+      list.push_back(std::move(resolved));
+    }
+  };
+  resolve(mesh.fillDrawCommands, mesh.fillDrawStyles, out.fill);
+  resolve(mesh.hatchDrawCommands, mesh.hatchDrawStyles, out.hatch);
+  for (const auto& marker : mesh.sectionMarkerLines) {
+    out.markers.emplace_back(marker.a, marker.b);
+  }
+}
+
+// Reference: every object built from scratch, concatenated in object order.
+ResolvedCaps fullRebuild(const CapScene& scene,
+                         const BimSectionCapBuildOptions& options) {
+  ResolvedCaps caps;
+  for (uint32_t objectIndex = 0; objectIndex < scene.size(); ++objectIndex) {
+    BimSectionCapGeneratedMesh mesh =
+        BuildBimSectionCapMesh(scene[objectIndex], options);
+    if (!mesh.valid()) {
+      continue;
+    }
+    appendBimSectionMarkerGeometry(mesh, objectIndex);
+    resolveInto(mesh, caps);
+  }
+  return caps;
+}
+
+void expectSameCommands(const std::vector<ResolvedCommand>& expected,
+                        const std::vector<ResolvedCommand>& actual) {
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(actual[i].objectIndex, expected[i].objectIndex);
+    EXPECT_EQ(actual[i].lineWidth, expected[i].lineWidth);
+    EXPECT_EQ(actual[i].positions, expected[i].positions);
+  }
+}
+
+void expectSameAsFullRebuild(const BimSectionCapCache& cache,
+                             const CapScene& scene,
+                             const BimSectionCapBuildOptions& options) {
+  ResolvedCaps actual;
+  resolveInto(cache.geometry(), actual);
+  const ResolvedCaps expected = fullRebuild(scene, options);
+  expectSameCommands(expected.fill, actual.fill);
+  expectSameCommands(expected.hatch, actual.hatch);
+  EXPECT_EQ(actual.markers, expected.markers);
+}
+
+}  // namespace
+
+TEST(BimSectionCapCache, RandomSectionPlaneMovesMatchFullRebuild) {
+  const CapScene scene = gridScene();
+  BimSectionCapBuildOptions options = baseOptions();
+  options.sectionPlane = {0.0f, 1.0f, 0.0f, -5.0f};
+
+  BimSectionCapCache cache;
+  const BimSectionCapCacheUpdate first = buildCaps(cache, scene, options);
+  EXPECT_EQ(first.rebuiltObjectCount, scene.size());
+  expectSameAsFullRebuild(cache, scene, options);
+
+  std::mt19937 random(1234u);
+  std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+  constexpr uint32_t kMoves = 200u;
+  uint32_t rebuilt = 0;
+  float height = 5.0f;
+  glm::vec3 normal{0.0f, 1.0f, 0.0f};
+  for (uint32_t move = 0; move < kMoves; ++move) {
+    const float kind = unit(random);
+    if (kind < 0.7f) {
+      height += (unit(random) - 0.5f) * 0.2f;
+    } else if (kind < 0.9f) {
+      height = unit(random) * 12.0f - 1.0f;
+    } else {
+      normal = glm::normalize(glm::vec3{(unit(random) - 0.5f) * 0.4f, 1.0f,
+                                        (unit(random) - 0.5f) * 0.4f});
+    }
+    options.sectionPlane = glm::vec4{normal, -height};
+
+    const BimSectionCapCacheUpdate update = buildCaps(cache, scene, options);
+    rebuilt += update.rebuiltObjectCount;
+    expectSameAsFullRebuild(cache, scene, options);
+    if (HasFailure()) {
+      FAIL() << "caps diverged after move " << move;
+    }
+  }
+  // Each plane only reaches a slice of the stack.
+  EXPECT_LT(rebuilt, kMoves * static_cast<uint32_t>(scene.size()) / 2u);
+}
+
+TEST(BimSectionCapCache, RandomBoxClipFaceMovesMatchFullRebuild) {
+  const CapScene scene = gridScene();
+  BimSectionCapBuildOptions options = baseOptions();
+  // x in [2, 14], y in [2, 8], z in [1, 15].
+  std::array<float, 6> faces{2.0f, 14.0f, 2.0f, 8.0f, 1.0f, 15.0f};
+  auto applyFaces = [&]() {
+    options.clipPlaneCount = 0u;
+    for (uint32_t axis = 0; axis < 3u; ++axis) {
+      glm::vec3 normal{0.0f};
+      normal[static_cast<int>(axis)] = 1.0f;
+      container::renderer::appendBimSectionCapClipPlane(
+          options, glm::vec4{normal, -faces[axis * 2u]});
+      container::renderer::appendBimSectionCapClipPlane(
+          options, glm::vec4{-normal, faces[axis * 2u + 1u]});
+    }
+  };
+  applyFaces();
+
+  BimSectionCapCache cache;
+  (void)buildCaps(cache, scene, options);
+  expectSameAsFullRebuild(cache, scene, options);
+
+  std::mt19937 random(99u);
+  std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+  std::uniform_int_distribution<uint32_t> face(0u, 5u);
+  for (uint32_t move = 0; move < 120u; ++move) {
+    const uint32_t faceIndex = face(random);
+    faces[faceIndex] += (unit(random) - 0.5f) * (move % 4u == 0u ? 6.0f : 0.6f);
+    // Keep every face pair ordered.
+    const uint32_t low = faceIndex & ~1u;
+    if (faces[low] > faces[low + 1u] - 0.5f) {
+      std::swap(faces[low], faces[low + 1u]);
+      faces[low + 1u] = std::max(faces[low + 1u], faces[low] + 0.5f);
+    }
+    applyFaces();
+
+    (void)buildCaps(cache, scene, options);
+    expectSameAsFullRebuild(cache, scene, options);
+    if (HasFailure()) {
+      FAIL() << "caps diverged after move " << move;
+    }
+  }
+}
+
+TEST(BimSectionCapCache, RebuildsOnlySweptObjectsAndWritesTheirSlices) {
+  CapScene scene;
+  scene.push_back(boxTriangles(0u, 0u, {0.0f, 0.0f, 0.0f}, glm::vec3{1.0f},
+                               0.0f));
+  scene.push_back(boxTriangles(1u, 0u, {4.0f, 0.0f, 0.0f}, glm::vec3{1.0f},
+                               0.0f));
+  scene.push_back(boxTriangles(2u, 0u, {8.0f, 10.0f, 0.0f}, glm::vec3{1.0f},
+                               0.0f));
+  BimSectionCapBuildOptions options = baseOptions();
+  options.sectionPlane = {0.0f, 1.0f, 0.0f, 0.0f};
+
+  BimSectionCapCache cache;
+  const BimSectionCapCacheUpdate first = buildCaps(cache, scene, options);
+  EXPECT_TRUE(first.reallocated);
+  EXPECT_EQ(first.rebuiltObjectCount, 3u);
+  ASSERT_EQ(cache.geometry().fillDrawCommands.size(), 2u);
+
+  // Same plane: nothing to do.
+  const BimSectionCapCacheUpdate unchanged = buildCaps(cache, scene, options);
+  EXPECT_EQ(unchanged.rebuiltObjectCount, 0u);
+  EXPECT_FALSE(unchanged.reallocated);
+
+  // Sliding within the lower boxes recuts both of them in place; the box
+  // above stays untouched.
+  options.sectionPlane = {0.0f, 1.0f, 0.0f, -0.3f};
+  const BimSectionCapCacheUpdate slide = buildCaps(cache, scene, options);
+  EXPECT_EQ(slide.rebuiltObjectCount, 2u);
+  EXPECT_FALSE(slide.reallocated);
+  EXPECT_EQ(slide.vertexRanges.size(), 2u);
+  EXPECT_EQ(slide.indexRanges.size(), 2u);
+  expectSameAsFullRebuild(cache, scene, options);
+
+  // Jumping to the upper box sweeps past all three.
+  options.sectionPlane = {0.0f, 1.0f, 0.0f, -10.0f};
+  const BimSectionCapCacheUpdate jump = buildCaps(cache, scene, options);
+  EXPECT_EQ(jump.rebuiltObjectCount, 3u);
+  ASSERT_EQ(cache.geometry().fillDrawCommands.size(), 1u);
+  EXPECT_EQ(cache.geometry().fillDrawCommands.front().objectIndex, 2u);
+  expectSameAsFullRebuild(cache, scene, options);
+
+  // A plane that stays clear of the upper box leaves it alone.
+  options.sectionPlane = {0.0f, 1.0f, 0.0f, -10.5f};
+  (void)buildCaps(cache, scene, options);
+  options.sectionPlane = {0.0f, 1.0f, 0.0f, -20.0f};
+  const BimSectionCapCacheUpdate above = buildCaps(cache, scene, options);
+  EXPECT_EQ(above.rebuiltObjectCount, 1u);
+  EXPECT_TRUE(cache.geometry().fillDrawCommands.empty());
+  options.sectionPlane = {0.0f, 1.0f, 0.0f, -30.0f};
+  EXPECT_EQ(buildCaps(cache, scene, options).rebuiltObjectCount, 0u);
+}
+
+TEST(BimSectionCapCache, ExpandsMarkerLinesIntoWideHatchCommands) {
+  const std::vector<BimSectionCapTriangle> triangles =
+      boxTriangles(5u, 0u, {0.0f, 0.0f, 0.0f}, glm::vec3{1.0f}, 0.0f);
+  BimSectionCapBuildOptions options = baseOptions();
+  options.sectionMarkerLineWidth = 3.0f;
+  BimSectionCapGeneratedMesh mesh = BuildBimSectionCapMesh(triangles, options);
+  ASSERT_EQ(mesh.sectionMarkerLines.size(), 1u);
+  const size_t hatchCommands = mesh.hatchDrawCommands.size();
+
+  appendBimSectionMarkerGeometry(mesh, 5u);
+
+  ASSERT_EQ(mesh.hatchDrawCommands.size(), hatchCommands + 1u);
+  ASSERT_EQ(mesh.hatchDrawStyles.size(), mesh.hatchDrawCommands.size());
+  EXPECT_EQ(mesh.hatchDrawCommands.back().objectIndex, 5u);
+  // Line plus two arrow heads of two segments each.
+  EXPECT_EQ(mesh.hatchDrawCommands.back().indexCount, 10u);
+  EXPECT_FLOAT_EQ(mesh.hatchDrawStyles.back().lineWidth, 3.0f);
+}
@@ -0,0 +1,402 @@
+#include "Container/renderer/bim/BimSnapFeatureGrid.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <random>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using container::renderer::BestBimSnapCandidate;
+using container::renderer::BimSnapCandidate;
+using container::renderer::BimSnapFeature;
+using container::renderer::BimSnapFeatureGrid;
+using container::renderer::BimSnapFeatureQuery;
+using container::renderer::BimSnapFeatureQueryStats;
+using container::renderer::BimSnapKind;
+using container::renderer::BimSnapTriangle;
+
+namespace {
+
+void AppendQuad(std::vector<BimSnapTriangle> &triangles, uint32_t objectIndex,
+                glm::vec3 a, glm::vec3 b, glm::vec3 c, glm::vec3 d) {
+  triangles.push_back({.objectIndex = objectIndex, .p0 = a, .p1 = b, .p2 = c});
+  triangles.push_back({.objectIndex = objectIndex, .p0 = a, .p1 = c, .p2 = d});
+}
+
+// Unit cube with every face triangulated on its own corners, the way
+// loaders emit flat-shaded boxes.
+std::vector<BimSnapTriangle> MakeCube(uint32_t objectIndex) {
+  std::vector<BimSnapTriangle> triangles;
+  const glm::vec3 p000{0, 0, 0}, p100{1, 0, 0}, p110{1, 1, 0}, p010{0, 1, 0};
+  const glm::vec3 p001{0, 0, 1}, p101{1, 0, 1}, p111{1, 1, 1}, p011{0, 1, 1};
+  AppendQuad(triangles, objectIndex, p000, p010, p110, p100);
+  AppendQuad(triangles, objectIndex, p001, p101, p111, p011);
+  AppendQuad(triangles, objectIndex, p000, p100, p101, p001);
+  AppendQuad(triangles, objectIndex, p010, p011, p111, p110);
+  AppendQuad(triangles, objectIndex, p000, p001, p011, p010);
+  AppendQuad(triangles, objectIndex, p100, p110, p111, p101);
+  return triangles;
+}
+
+// Straight pipe runs along the axes with many radial segments and rings,
+// like tessellated MEP ducts and conduits.
+std::vector<BimSnapTriangle> MakePipeNetwork(uint32_t pipeCount,
+                                             uint32_t segments,
+                                             uint32_t rings, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> position(-20.0f, 20.0f);
+  std::uniform_real_distribution<float> length(2.0f, 8.0f);
+  std::uniform_int_distribution<int> axisPick(0, 2);
+  std::vector<BimSnapTriangle> triangles;
+  for (uint32_t pipe = 0; pipe < pipeCount; ++pipe) {
+    const int axis = axisPick(rng);
+    const glm::vec3 start{position(rng), position(rng), position(rng)};
+    const float pipeLength = length(rng);
+    const float radius = 0.05f + 0.01f * static_cast<float>(pipe % 5u);
+    auto ringPoint = [&](uint32_t ring, uint32_t segment) {
+      const float angle = 6.2831853f * static_cast<float>(segment % segments) /
+                          static_cast<float>(segments);
+      const float along =
+          pipeLength * static_cast<float>(ring) / static_cast<float>(rings);
+      glm::vec3 local{std::cos(angle) * radius, std::sin(angle) * radius,
+                      along};
+      glm::vec3 world = start;
+      world[axis] += local.z;
+      world[(axis + 1) % 3] += local.x;
+      world[(axis + 2) % 3] += local.y;
+      return world;
+    };
+    for (uint32_t ring = 0; ring < rings; ++ring) {
+      for (uint32_t segment = 0; segment < segments; ++segment) {
+        AppendQuad(triangles, pipe, ringPoint(ring, segment),
+                   ringPoint(ring, segment + 1u),
+                   ringPoint(ring + 1u, segment + 1u),
+                   ringPoint(ring + 1u, segment));
+      }
+    }
+  }
+  return triangles;
+}
+
+BimSnapFeatureQuery MakeQuery(glm::vec3 eye, glm::vec3 hitPoint,
+                              float maxScreenDistancePixels) {
+  const glm::mat4 view =
+      container::math::lookAt(eye, hitPoint, glm::vec3(0.0f, 1.0f, 0.0f));
+  const glm::mat4 projection = container::math::perspectiveRH_ReverseZ(
+      0.9f, 16.0f / 9.0f, 0.05f, 500.0f);
+  const glm::mat4 viewProj = projection * view;
+  return BimSnapFeatureQuery{.hitPoint = hitPoint,
+                             .viewProj = viewProj,
+                             .inverseViewProj = glm::inverse(viewProj),
+                             .viewportSize = {1920.0f, 1080.0f},
+                             .maxScreenDistancePixels =
+                                 maxScreenDistancePixels};
+}
+
+// Snap features of `triangles` by definition: distinct corners, midpoints
+// of edges not shared by exactly two coplanar triangles, and area-weighted
+// centres of coplanar triangles joined through shared edges. Shared corners
+// must be bitwise equal, as they are in the generated meshes.
+std::vector<BimSnapFeature>
+ReferenceFeatures(std::span<const BimSnapTriangle> triangles) {
+  using Corner = std::tuple<float, float, float>;
+  auto corner = [](glm::vec3 p) { return Corner{p.x, p.y, p.z}; };
+  constexpr float kCoplanarCosine = 0.99985f;  // About one degree.
+
+  std::map<Corner, uint32_t> vertexObjects;
+  std::map<std::pair<Corner, Corner>, std::vector<uint32_t>> edgeTriangles;
+  std::vector<glm::vec3> normals(triangles.size());
+  for (uint32_t index = 0; index < triangles.size(); ++index) {
+    const BimSnapTriangle &triangle = triangles[index];
+    normals[index] = glm::normalize(
+        glm::cross(triangle.p1 - triangle.p0, triangle.p2 - triangle.p0));
+    const std::array<glm::vec3, 3> points{triangle.p0, triangle.p1,
+                                          triangle.p2};
+    for (size_t edge = 0; edge < points.size(); ++edge) {
+      vertexObjects.try_emplace(corner(points[edge]), triangle.objectIndex);
+      edgeTriangles[std::minmax(corner(points[edge]),
+                                corner(points[(edge + 1u) % 3u]))]
+          .push_back(index);
+    }
+  }
+
+  std::vector<BimSnapFeature> features;
+  for (const auto &[position, objectIndex] : vertexObjects) {
+    features.push_back({.kind = BimSnapKind::Vertex,
+                        .objectIndex = objectIndex,
+                        .position = {std::get<0>(position),
+                                     std::get<1>(position),
+                                     std::get<2>(position)}});
+  }
+
+  std::vector<uint32_t> faces(triangles.size());
+  for (uint32_t index = 0; index < faces.size(); ++index) {
+    faces[index] = index;
+  }
+  auto faceOf = [&faces](uint32_t index) {
+    while (faces[index] != index) {
+      index = faces[index];
+    }
+    return index;
+  };
+  for (const auto &[edge, sharing] : edgeTriangles) {
+    if (sharing.size() == 2u &&
+        glm::dot(normals[sharing[0]], normals[sharing[1]]) >=
+            kCoplanarCosine) {
+      const uint32_t a = faceOf(sharing[0]);
+      const uint32_t b = faceOf(sharing[1]);
+      faces[std::max(a, b)] = std::min(a, b);
+      continue;
+    }
+    const glm::vec3 a{std::get<0>(edge.first), std::get<1>(edge.first),
+                      std::get<2>(edge.first)};
+    const glm::vec3 b{std::get<0>(edge.second), std::get<1>(edge.second),
+                      std::get<2>(edge.second)};
+    features.push_back({.kind = BimSnapKind::EdgeMidpoint,
+                        .objectIndex = triangles[sharing[0]].objectIndex,
+                        .position = (a + b) * 0.5f});
+  }
+
+  std::map<uint32_t, std::pair<glm::vec3, float>> faceSums;
+  for (uint32_t index = 0; index < triangles.size(); ++index) {
+    const BimSnapTriangle &triangle = triangles[index];
+    const float area =
+        0.5f * glm::length(glm::cross(triangle.p1 - triangle.p0,
+                                      triangle.p2 - triangle.p0));
+    auto &[weighted, total] = faceSums[faceOf(index)];
+    weighted += (triangle.p0 + triangle.p1 + triangle.p2) / 3.0f * area;
+    total += area;
+  }
+  for (const auto &[face, sums] : faceSums) {
+    features.push_back({.kind = BimSnapKind::FaceCenter,
+                        .objectIndex = triangles[face].objectIndex,
+                        .position = sums.first / sums.second});
+  }
+  return features;
+}
+
+std::optional<glm::vec2> ProjectToPixels(const BimSnapFeatureQuery &query,
+                                         glm::vec3 position) {
+  const glm::vec4 clip = query.viewProj * glm::vec4(position, 1.0f);
+  if (!(clip.w > 1.0e-6f)) {
+    return std::nullopt;
+  }
+  return (glm::vec2(clip.x, clip.y) / clip.w * 0.5f + 0.5f) *
+         query.viewportSize;
+}
+
+// Every feature whose projection lies within `maxScreenDistancePixels` of
+// the hit point's, found by projecting them all.
+std::vector<BimSnapCandidate>
+BruteForceQuery(std::span<const BimSnapFeature> features,
+                const BimSnapFeatureQuery &query,
+                float maxScreenDistancePixels) {
+  std::vector<BimSnapCandidate> out;
+  const std::optional<glm::vec2> hit = ProjectToPixels(query, query.hitPoint);
+  if (!hit.has_value()) {
+    return out;
+  }
+  for (const BimSnapFeature &feature : features) {
+    const std::optional<glm::vec2> projected =
+        ProjectToPixels(query, feature.position);
+    if (!projected.has_value()) {
+      continue;
+    }
+    const float screenDistance = glm::length(*projected - *hit);
+    if (screenDistance <= maxScreenDistancePixels) {
+      out.push_back({.kind = feature.kind,
+                     .objectIndex = feature.objectIndex,
+                     .worldPosition = feature.position,
+                     .screenDistancePixels = screenDistance});
+    }
+  }
+  return out;
+}
+
+// Candidates grouped by kind and object, so matching stays cheap when a
+// distant camera puts thousands of features under the cursor.
+using CandidateIndex =
+    std::map<std::pair<BimSnapKind, uint32_t>, std::vector<BimSnapCandidate>>;
+
+CandidateIndex IndexCandidates(std::span<const BimSnapCandidate> candidates) {
+  CandidateIndex index;
+  for (const BimSnapCandidate &candidate : candidates) {
+    index[{candidate.kind, candidate.objectIndex}].push_back(candidate);
+  }
+  return index;
+}
+
+// Tolerates the rounding of centres summed in a different order.
+bool ContainsCandidate(const CandidateIndex &candidates,
+                       const BimSnapCandidate &wanted) {
+  const auto group = candidates.find({wanted.kind, wanted.objectIndex});
+  return group != candidates.end() &&
+         std::ranges::any_of(group->second, [&](const BimSnapCandidate &c) {
+           return glm::length(c.worldPosition - wanted.worldPosition) <=
+                      1.0e-4f &&
+                  std::abs(c.screenDistancePixels -
+                           wanted.screenDistancePixels) <= 1.0e-2f;
+         });
+}
+
+size_t CountKind(const BimSnapFeatureGrid &grid, BimSnapKind kind) {
+  return static_cast<size_t>(
+      std::ranges::count(grid.features(), kind, &BimSnapFeature::kind));
+}
+
+} // namespace
+
+TEST(BimSnapFeatureGridTests, CubeYieldsCornersEdgesAndFaces) {
+  const std::vector<BimSnapTriangle> cube = MakeCube(7u);
+  const BimSnapFeatureGrid grid(cube);
+
+  EXPECT_EQ(CountKind(grid, BimSnapKind::Vertex), 8u);
+  // Face diagonals are coplanar and never offered as edges.
+  EXPECT_EQ(CountKind(grid, BimSnapKind::EdgeMidpoint), 12u);
+  EXPECT_EQ(CountKind(grid, BimSnapKind::FaceCenter), 6u);
+  for (const BimSnapFeature &feature : grid.features()) {
+    EXPECT_EQ(feature.objectIndex, 7u);
+    if (feature.kind == BimSnapKind::FaceCenter) {
+      const glm::vec3 offset = glm::abs(feature.position - glm::vec3(0.5f));
+      const float largest = std::max({offset.x, offset.y, offset.z});
+      EXPECT_NEAR(largest, 0.5f, 1.0e-5f);
+      EXPECT_NEAR(offset.x + offset.y + offset.z, 0.5f, 1.0e-5f);
+    }
+  }
+}
+
+TEST(BimSnapFeatureGridTests, DegenerateAndNonFiniteTrianglesAreIgnored) {
+  std::vector<BimSnapTriangle> triangles = MakeCube(0u);
+  triangles.push_back({.objectIndex = 1u,
+                       .p0 = {0.0f, 0.0f, 0.0f},
+                       .p1 = {0.0f, 0.0f, 0.0f},
+                       .p2 = {1.0f, 0.0f, 0.0f}});
+  triangles.push_back({.objectIndex = 2u,
+                       .p0 = {std::nanf(""), 0.0f, 0.0f},
+                       .p1 = {5.0f, 0.0f, 0.0f},
+                       .p2 = {5.0f, 1.0f, 0.0f}});
+  const BimSnapFeatureGrid grid(triangles);
+
+  EXPECT_EQ(grid.features().size(), 26u);
+  EXPECT_TRUE(BimSnapFeatureGrid(std::span<const BimSnapTriangle>{}).empty());
+}
+
+TEST(BimSnapFeatureGridTests, QueryPrefersTheCornerUnderTheCursor) {
+  const std::vector<BimSnapTriangle> cube = MakeCube(3u);
+  const BimSnapFeatureGrid grid(cube);
+  // A hit just inside the top face near the (1, 1, 1) corner.
+  const BimSnapFeatureQuery query =
+      MakeQuery({4.0f, 5.0f, 6.0f}, {0.995f, 1.0f, 0.99f}, 12.0f);
+
+  std::vector<BimSnapCandidate> candidates;
+  grid.query(query, candidates);
+  const std::array vertexKinds{BimSnapKind::Vertex};
+  const auto best = BestBimSnapCandidate(
+      candidates, query.maxScreenDistancePixels, vertexKinds);
+
+  ASSERT_TRUE(best.has_value());
+  EXPECT_EQ(best->objectIndex, 3u);
+  EXPECT_NEAR(best->worldPosition.x, 1.0f, 1.0e-6f);
+  EXPECT_NEAR(best->worldPosition.y, 1.0f, 1.0e-6f);
+  EXPECT_NEAR(best->worldPosition.z, 1.0f, 1.0e-6f);
+  for (const BimSnapCandidate &candidate : candidates) {
+    EXPECT_LE(candidate.screenDistancePixels, query.maxScreenDistancePixels);
+  }
+}
+
+TEST(BimSnapFeatureGridTests, QueriesMatchBruteForceOnDenseMepMeshes) {
+  const std::vector<BimSnapTriangle> pipes =
+      MakePipeNetwork(400u, 24u, 16u, 0x5eedu);
+  const BimSnapFeatureGrid grid(pipes);
+  ASSERT_FALSE(grid.empty());
+  EXPECT_GT(grid.cellCount(), 1000u);
+  const std::vector<BimSnapFeature> reference = ReferenceFeatures(pipes);
+  ASSERT_EQ(reference.size(), grid.features().size());
+
+  std::mt19937 rng(42u);
+  std::uniform_int_distribution<size_t> pickFeature(
+      0u, grid.features().size() - 1u);
+  std::uniform_real_distribution<float> jitter(-0.05f, 0.05f);
+  std::uniform_real_distribution<float> eyeOffset(-30.0f, 30.0f);
+  std::uniform_real_distribution<float> radius(2.0f, 40.0f);
+  size_t totalCandidates = 0u;
+  for (int iteration = 0; iteration < 150; ++iteration) {
+    const glm::vec3 hitPoint = grid.features()[pickFeature(rng)].position +
+                               glm::vec3(jitter(rng), jitter(rng), jitter(rng));
+    const glm::vec3 eye =
+        hitPoint + glm::vec3(eyeOffset(rng), 15.0f + eyeOffset(rng) * 0.5f,
+                             eyeOffset(rng));
+    const BimSnapFeatureQuery query = MakeQuery(eye, hitPoint, radius(rng));
+
+    std::vector<BimSnapCandidate> actual;
+    grid.query(query, actual);
+    const float radius = query.maxScreenDistancePixels;
+    const std::vector<BimSnapCandidate> expected =
+        BruteForceQuery(reference, query, radius + 1.0e-2f);
+    const CandidateIndex returned = IndexCandidates(actual);
+    const CandidateIndex admitted = IndexCandidates(expected);
+    // Candidates within rounding of the radius may fall either way.
+    for (const BimSnapCandidate &candidate : expected) {
+      if (candidate.screenDistancePixels > radius - 1.0e-2f) {
+        continue;
+      }
+      EXPECT_TRUE(ContainsCandidate(returned, candidate))
+          << "iteration " << iteration << " missed a feature at "
+          << candidate.screenDistancePixels << " px";
+    }
+    for (const BimSnapCandidate &candidate : actual) {
+      EXPECT_TRUE(ContainsCandidate(admitted, candidate))
+          << "iteration " << iteration << " returned a feature at "
+          << candidate.screenDistancePixels << " px";
+    }
+    totalCandidates += actual.size();
+  }
+  EXPECT_GT(totalCandidates, 0u);
+}
+
+TEST(BimSnapFeatureGridTests, DenseMeshQueriesVisitOnlyNearbyFeatures) {
+  const std::vector<BimSnapTriangle> pipes =
+      MakePipeNetwork(800u, 32u, 24u, 0xb1du);
+  const BimSnapFeatureGrid grid(pipes);
+  ASSERT_FALSE(grid.empty());
+  const size_t featureCount = grid.features().size();
+
+  std::mt19937 rng(7u);
+  std::uniform_int_distribution<size_t> pickFeature(0u, featureCount - 1u);
+  std::vector<BimSnapCandidate> candidates;
+  size_t totalVisitedFeatures = 0u;
+  size_t maxVisitedFeatures = 0u;
+  size_t maxVisitedCells = 0u;
+  constexpr int kQueryCount = 2000;
+  for (int index = 0; index < kQueryCount; ++index) {
+    const glm::vec3 hitPoint = grid.features()[pickFeature(rng)].position;
+    const BimSnapFeatureQuery query =
+        MakeQuery(hitPoint + glm::vec3(3.0f, 4.0f, 5.0f), hitPoint, 12.0f);
+    candidates.clear();
+    const BimSnapFeatureQueryStats stats = grid.query(query, candidates);
+    ASSERT_GE(stats.visitedFeatures, candidates.size());
+    totalVisitedFeatures += stats.visitedFeatures;
+    maxVisitedFeatures =
+        std::max<size_t>(maxVisitedFeatures, stats.visitedFeatures);
+    maxVisitedCells = std::max<size_t>(maxVisitedCells, stats.visitedCells);
+  }
+
+  RecordProperty("features", static_cast<int>(featureCount));
+  RecordProperty("mean_visited_features",
+                 static_cast<int>(totalVisitedFeatures / kQueryCount));
+  RecordProperty("max_visited_features",
+                 static_cast<int>(maxVisitedFeatures));
+  RecordProperty("max_visited_cells", static_cast<int>(maxVisitedCells));
+  // A brute-force scan tests every feature; a local query only tests the
+  // few cells under the cursor.
+  EXPECT_LT(maxVisitedCells, grid.cellCount() / 100u);
+  EXPECT_LT(maxVisitedFeatures, featureCount / 100u);
+}
@@ -0,0 +1,176 @@
+#include "Container/renderer/core/FrameArena.h"
+#include "Container/renderer/bim/BimDrawCompactionPlanner.h"
+#include "Container/renderer/bim/BimManager.h"
+#include "Container/renderer/scene/DrawCommand.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace {
+
+using container::renderer::BimDrawCompactionPlanner;
+using container::renderer::DrawCommand;
+using container::renderer::FrameArena;
+
+// Upstream that counts the blocks the arena asks for.
+class CountingResource final : public std::pmr::memory_resource {
+ public:
+  size_t allocations{0};
+  size_t deallocations{0};
+
+ private:
+  void* do_allocate(size_t bytes, size_t alignment) override {
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void* memory, size_t bytes, size_t alignment) override {
+    ++deallocations;
+    std::pmr::new_delete_resource()->deallocate(memory, bytes, alignment);
+  }
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+// Builds the kind of transient output a planner produces in one frame.
+void buildFrameOutputs(std::pmr::memory_resource* arena, size_t drawCount) {
+  std::pmr::vector<DrawCommand> draws(arena);
+  for (size_t index = 0; index < drawCount; ++index) {
+    draws.push_back(DrawCommand{.objectIndex = static_cast<uint32_t>(index),
+                                .firstIndex = 0u,
+                                .indexCount = 3u,
+                                .instanceCount = 1u});
+  }
+  std::pmr::vector<uint32_t> order(draws.size(), 0u, arena);
+  ASSERT_EQ(order.size(), drawCount);
+}
+
+TEST(FrameArenaTests, AllocationsAreAlignedAndDistinct) {
+  FrameArena arena(1024u, false);
+  void* a = arena.allocate(3u, 1u);
+  void* b = arena.allocate(16u, 16u);
+  void* c = arena.allocate(64u, 64u);
+
+  EXPECT_NE(a, b);
+  EXPECT_NE(b, c);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(b) % 16u, 0u);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(c) % 64u, 0u);
+  EXPECT_EQ(arena.stats().allocationCount, 3u);
+  EXPECT_EQ(arena.stats().bytesAllocated, 83u);
+}
+
+TEST(FrameArenaTests, ResetReusesTheSameMemory) {
+  FrameArena arena(1024u, false);
+  void* first = arena.allocate(128u, 8u);
+  arena.reset();
+  void* second = arena.allocate(128u, 8u);
+
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(arena.stats().allocationCount, 1u);
+  EXPECT_EQ(arena.stats().resetCount, 1u);
+}
+
+TEST(FrameArenaTests, OverflowIsFoldedIntoOneBlockOnReset) {
+  CountingResource upstream;
+  {
+    FrameArena arena(256u, false, &upstream);
+    EXPECT_EQ(upstream.allocations, 1u);
+
+    for (int i = 0; i < 8; ++i) {
+      static_cast<void>(arena.allocate(200u, 8u));
+    }
+    EXPECT_GT(upstream.allocations, 1u);
+    const size_t capacity = arena.stats().capacityBytes;
+
+    arena.reset();
+    EXPECT_EQ(arena.stats().capacityBytes, capacity);
+    const size_t allocationsAfterFold = upstream.allocations;
+
+    // The same frame footprint now fits in the folded block.
+    for (int frame = 0; frame < 4; ++frame) {
+      for (int i = 0; i < 8; ++i) {
+        static_cast<void>(arena.allocate(200u, 8u));
+      }
+      arena.reset();
+    }
+    EXPECT_EQ(upstream.allocations, allocationsAfterFold);
+    EXPECT_GE(arena.stats().highWaterBytes, 1600u);
+  }
+  EXPECT_EQ(upstream.deallocations, upstream.allocations);
+}
+
+TEST(FrameArenaTests, PoisonsResetMemory) {
+  FrameArena arena(1024u, true);
+  auto* bytes = static_cast<unsigned char*>(arena.allocate(32u, 1u));
+  for (size_t i = 0; i < 32u; ++i) {
+    bytes[i] = 0x11u;
+  }
+  arena.reset();
+
+  // Reading after reset is exactly the bug the poison exposes; the arena
+  // still owns the block, so the bytes are inspectable here.
+  for (size_t i = 0; i < 32u; ++i) {
+    EXPECT_EQ(bytes[i], FrameArena::kPoisonByte) << "byte " << i;
+  }
+}
+
+TEST(FrameArenaTests, LeavesResetMemoryAloneWithoutPoison) {
+  FrameArena arena(1024u, false);
+  auto* bytes = static_cast<unsigned char*>(arena.allocate(4u, 1u));
+  bytes[0] = 0x11u;
+  arena.reset();
+  EXPECT_EQ(bytes[0], 0x11u);
+}
+
+TEST(FrameArenaTests, SteadyStateFramesDoNotAllocate) {
+  CountingResource upstream;
+  FrameArena arena(FrameArena::kDefaultInitialCapacity, true, &upstream);
+  // Warm-up frames let the arena reach its high-water mark.
+  for (int frame = 0; frame < 2; ++frame) {
+    buildFrameOutputs(&arena, 2048u);
+    arena.reset();
+  }
+
+  const size_t allocationsBefore = upstream.allocations;
+  const size_t deallocationsBefore = upstream.deallocations;
+  for (int frame = 0; frame < 64; ++frame) {
+    buildFrameOutputs(&arena, 2048u);
+    arena.reset();
+  }
+  EXPECT_EQ(upstream.allocations, allocationsBefore);
+  EXPECT_EQ(upstream.deallocations, deallocationsBefore);
+  EXPECT_EQ(arena.stats().upstreamAllocationCount, upstream.allocations);
+  EXPECT_EQ(arena.stats().resetCount, 66u);
+}
+
+TEST(FrameArenaTests, SteadyStateCompactionPlansDoNotAllocate) {
+  const std::vector<DrawCommand> draws{DrawCommand{.indexCount = 3u}};
+  const BimDrawCompactionPlanner planner(
+      {.opaqueSingleSided = &draws,
+       .opaqueWindingFlipped = &draws,
+       .opaqueDoubleSided = &draws,
+       .transparentSingleSided = &draws,
+       .nativePointOpaque = &draws,
+       .nativeCurveTransparent = &draws});
+  CountingResource upstream;
+  FrameArena arena(FrameArena::kDefaultInitialCapacity,
+                   container::renderer::kFrameArenaPoisonOnResetDefault,
+                   &upstream);
+  ASSERT_EQ(upstream.allocations, 1u);
+
+  for (int frame = 0; frame < 64; ++frame) {
+    const auto plan = planner.build(&arena);
+    ASSERT_EQ(plan.size(), 6u);
+    arena.reset();
+  }
+  EXPECT_EQ(upstream.allocations, 1u);
+  EXPECT_EQ(upstream.deallocations, 0u);
+  EXPECT_EQ(arena.stats().resetCount, 64u);
+}
+
+}  // namespace
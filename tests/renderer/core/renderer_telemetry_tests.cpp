@@ -1,15 +1,20 @@
 #include "Container/renderer/core/RendererTelemetry.h"
 #include "Container/renderer/core/RenderGraph.h"
+#include "Container/renderer/culling/GpuCullManager.h"
+
+#include "../../support/allocation_counter.h"
 
 #include <gtest/gtest.h>
 
 #include <array>
 
+using container::renderer::CullStats;
 using container::renderer::RendererTelemetry;
 using container::renderer::RendererTelemetryPhase;
 using container::renderer::RendererGpuTimingSource;
 using container::renderer::RenderGraph;
 using container::renderer::RenderPassId;
+using container::renderer::renderPassName;
 
 namespace {
 
@@ -99,15 +104,15 @@ TEST(RendererTelemetryTests, AttachesPassCpuAndKnownGpuTimings) {
   telemetry.endFrame();
 
   const auto view = telemetry.view();
-  ASSERT_EQ(view.latest.passes.size(), 2u);
+  ASSERT_EQ(view.latest.passCount, 2u);
   EXPECT_EQ(view.latest.graph.cpuTimedPasses, 2u);
   EXPECT_EQ(view.latest.graph.gpuTimedPasses, 2u);
-  EXPECT_EQ(view.latest.passes[0].name, "TileCull");
+  EXPECT_EQ(renderPassName(view.latest.passes[0].id), "TileCull");
   EXPECT_TRUE(view.latest.passes[0].cpuTimed);
   EXPECT_TRUE(view.latest.passes[0].gpuTimed);
   EXPECT_FLOAT_EQ(view.latest.passes[0].cpuRecordMs, 0.25f);
   EXPECT_FLOAT_EQ(view.latest.passes[0].gpuKnownMs, 0.75f);
-  EXPECT_EQ(view.latest.passes[1].name, "Lighting");
+  EXPECT_EQ(renderPassName(view.latest.passes[1].id), "Lighting");
   EXPECT_TRUE(view.latest.passes[1].cpuTimed);
   EXPECT_TRUE(view.latest.passes[1].gpuTimed);
   EXPECT_FLOAT_EQ(view.latest.passes[1].cpuRecordMs, 0.5f);
@@ -140,7 +145,7 @@ TEST(RendererTelemetryTests, PassGpuTimingsOverrideFallbackLightingTimers) {
   telemetry.endFrame();
 
   const auto view = telemetry.view();
-  ASSERT_EQ(view.latest.passes.size(), 2u);
+  ASSERT_EQ(view.latest.passCount, 2u);
   EXPECT_FLOAT_EQ(view.latest.timing.gpuKnownMs, 5.0f);
   EXPECT_EQ(view.latest.timing.gpuSource,
             RendererGpuTimingSource::PerformanceQuery);
@@ -165,7 +170,7 @@ TEST(RendererTelemetryTests, CountsZeroMillisecondGpuTimingsAsAvailable) {
   telemetry.endFrame();
 
   const auto view = telemetry.view();
-  ASSERT_EQ(view.latest.passes.size(), 1u);
+  ASSERT_EQ(view.latest.passCount, 1u);
   EXPECT_EQ(view.latest.graph.gpuTimedPasses, 1u);
   EXPECT_TRUE(view.latest.passes[0].gpuTimed);
   EXPECT_FLOAT_EQ(view.latest.passes[0].gpuKnownMs, 0.0f);
@@ -175,13 +180,13 @@ TEST(RendererTelemetryTests, StoresGpuProfilerStatus) {
   RendererTelemetry telemetry{8};
 
   telemetry.beginFrame(7u, 1u, 2u, true, "serialized resources");
-  telemetry.setGpuProfilerStatus(container::renderer::RendererGpuProfilerTelemetry{
-      .source = RendererGpuTimingSource::TimestampQuery,
-      .available = true,
-      .resultLatencyFrames = 1u,
-      .status =
-          "using timestamp queries; performance queries unavailable",
-  });
+  telemetry.setGpuProfilerStatus(
+      container::renderer::RendererGpuProfilerTelemetry{
+          .source = RendererGpuTimingSource::TimestampQuery,
+          .available = true,
+          .resultLatencyFrames = 1u,
+      },
+      "using timestamp queries; performance queries unavailable");
   telemetry.endFrame();
 
   const auto view = telemetry.view();
@@ -189,6 +194,89 @@ TEST(RendererTelemetryTests, StoresGpuProfilerStatus) {
             RendererGpuTimingSource::TimestampQuery);
   EXPECT_TRUE(view.latest.gpuProfiler.available);
   EXPECT_EQ(view.latest.gpuProfiler.resultLatencyFrames, 1u);
-  EXPECT_EQ(view.latest.gpuProfiler.status,
+  EXPECT_EQ(view.text(view.latest.gpuProfiler.status),
             "using timestamp queries; performance queries unavailable");
+  EXPECT_EQ(view.text(view.latest.sync.concurrencyReason),
+            "serialized resources");
+}
+
+TEST(RendererTelemetryTests, CarriesCullUploadCounters) {
+  RendererTelemetry telemetry{4};
+
+  telemetry.beginFrame(7u, 0u, 2u, false, "per-frame resources");
+  CullStats stats{};
+  stats.totalInputCount = 120u;
+  stats.frustumPassedCount = 80u;
+  stats.occlusionPassedCount = 50u;
+  stats.descriptorWrites = 3u;
+  stats.uploadedBytes = 4096u;
+  telemetry.setCullingStats(stats);
+  telemetry.endFrame();
+
+  const auto view = telemetry.view();
+  ASSERT_TRUE(view.latest.valid);
+  EXPECT_EQ(view.latest.culling.inputCount, 120u);
+  EXPECT_EQ(view.latest.culling.descriptorWrites, 3u);
+  EXPECT_EQ(view.latest.culling.uploadedBytes, 4096u);
+}
+
+TEST(RendererTelemetryTests, SteadyStateFramesDoNotAllocate) {
+  RendererTelemetry telemetry{16};
+  RenderGraph graph;
+  graph.addPass(RenderPassId::TileCull, {}, [](VkCommandBuffer,
+                                               const auto&) {});
+  graph.addPass(RenderPassId::Lighting, {}, [](VkCommandBuffer,
+                                               const auto&) {});
+  graph.setPassResourceAccess(RenderPassId::TileCull, {}, {}, {});
+  graph.setPassResourceAccess(RenderPassId::Lighting, {}, {}, {});
+  const std::array<container::renderer::RendererPassGpuTiming, 2> gpuTimings{{
+      {.id = RenderPassId::TileCull, .milliseconds = 0.5f},
+      {.id = RenderPassId::Lighting, .milliseconds = 1.5f},
+  }};
+
+  const auto frame = [&](uint64_t frameIndex) {
+    telemetry.beginFrame(frameIndex, 0u, 2u, true, "serialized resources");
+    telemetry.setCpuPhase(RendererTelemetryPhase::WaitForFrame, 0.1f);
+    telemetry.setPassGpuTimings(gpuTimings,
+                                RendererGpuTimingSource::TimestampQuery);
+    telemetry.setGpuProfilerStatus(
+        container::renderer::RendererGpuProfilerTelemetry{
+            .source = RendererGpuTimingSource::TimestampQuery,
+            .available = true,
+        },
+        "using timestamp queries");
+    telemetry.setCullingStats(CullStats{});
+    telemetry.recordPassCpuTime(RenderPassId::TileCull, 0.2f);
+    telemetry.recordPassCpuTime(RenderPassId::Lighting, 0.3f);
+    telemetry.setRenderGraph(graph);
+    telemetry.setCpuPhase(RendererTelemetryPhase::Frame, 4.0f);
+    telemetry.endFrame();
+  };
+
+  // Interns the strings and lets the graph cache its execution statuses.
+  frame(0u);
+  const size_t allocationsBefore = container::test::allocationCount();
+  for (uint64_t frameIndex = 1u; frameIndex <= 64u; ++frameIndex) {
+    frame(frameIndex);
+  }
+  EXPECT_EQ(container::test::allocationCount() - allocationsBefore, 0u);
+
+  const auto view = telemetry.view();
+  EXPECT_EQ(view.latest.frameIndex, 64u);
+  EXPECT_EQ(view.latest.passCount, 2u);
+  ASSERT_EQ(view.history.size(), 16u);
+  EXPECT_EQ(view.history.front().frameIndex, 49u);
+}
+
+TEST(RendererTelemetryTests, CapturesFrameRangeFromRing) {
+  RendererTelemetry telemetry{4};
+  for (uint64_t frameIndex = 1u; frameIndex <= 6u; ++frameIndex) {
+    recordFrame(telemetry, frameIndex, static_cast<float>(frameIndex));
+  }
+
+  const auto frames = telemetry.capturedFrames(2u, 5u);
+  ASSERT_EQ(frames.size(), 3u);
+  EXPECT_EQ(frames[0].frameIndex, 3u);
+  EXPECT_EQ(frames[2].frameIndex, 5u);
+  EXPECT_EQ(telemetry.latest().frameIndex, 6u);
 }
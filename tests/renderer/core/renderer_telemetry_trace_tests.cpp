@@ -0,0 +1,97 @@
+#include "Container/renderer/core/RendererTelemetryTrace.h"
+
+#include <gtest/gtest.h>
+
+#include <nlohmann/json.hpp>
+
+#include <array>
+#include <string>
+#include <vector>
+
+using container::renderer::RendererPassTelemetry;
+using container::renderer::RendererTelemetryPhase;
+using container::renderer::RendererTelemetrySnapshot;
+using container::renderer::RenderPassId;
+using container::renderer::exportRendererChromeTrace;
+
+namespace {
+
+RendererTelemetrySnapshot frameSnapshot(uint64_t frameIndex) {
+  RendererTelemetrySnapshot frame{};
+  frame.valid = true;
+  frame.frameIndex = frameIndex;
+  frame.timing.cpuMs[static_cast<size_t>(RendererTelemetryPhase::Frame)] =
+      10.0f;
+  frame.timing.cpuMs[static_cast<size_t>(
+      RendererTelemetryPhase::WaitForFrame)] = 2.0f;
+  frame.timing.cpuMs[static_cast<size_t>(
+      RendererTelemetryPhase::CommandRecord)] = 3.0f;
+  frame.passes[0] = RendererPassTelemetry{.id = RenderPassId::TileCull,
+                                          .cpuTimed = true,
+                                          .gpuTimed = true,
+                                          .cpuRecordMs = 0.5f,
+                                          .gpuKnownMs = 1.0f};
+  frame.passes[1] = RendererPassTelemetry{.id = RenderPassId::Lighting,
+                                          .cpuTimed = true,
+                                          .cpuRecordMs = 1.5f};
+  frame.passCount = 2u;
+  return frame;
+}
+
+const nlohmann::json* findEvent(const nlohmann::json& events,
+                                std::string_view name, uint64_t frame,
+                                int tid) {
+  for (const auto& event : events) {
+    if (event.value("ph", "") == "X" && event.value("name", "") == name &&
+        event["args"].value("frame", uint64_t{0}) == frame &&
+        event.value("tid", 0) == tid) {
+      return &event;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+TEST(RendererTelemetryTraceTests, ExportsPhasesPassesAndGpuTracks) {
+  const std::array<RendererTelemetrySnapshot, 2> frames{frameSnapshot(7u),
+                                                        frameSnapshot(8u)};
+  const auto trace = nlohmann::json::parse(exportRendererChromeTrace(frames));
+  ASSERT_TRUE(trace.contains("traceEvents"));
+  const auto& events = trace["traceEvents"];
+
+  size_t threadNames = 0;
+  for (const auto& event : events) {
+    if (event.value("ph", "") == "M") ++threadNames;
+  }
+  EXPECT_EQ(threadNames, 3u);
+
+  const auto* frame = findEvent(events, "Frame", 8u, 1);
+  ASSERT_NE(frame, nullptr);
+  EXPECT_DOUBLE_EQ((*frame)["ts"].get<double>(), 10000.0);
+  EXPECT_DOUBLE_EQ((*frame)["dur"].get<double>(), 10000.0);
+
+  // Wait (2 ms) precedes command recording, whose passes follow in order.
+  const auto* record = findEvent(events, "Command record", 8u, 1);
+  ASSERT_NE(record, nullptr);
+  EXPECT_DOUBLE_EQ((*record)["ts"].get<double>(), 12000.0);
+  const auto* lightingRecord = findEvent(events, "Lighting", 8u, 2);
+  ASSERT_NE(lightingRecord, nullptr);
+  EXPECT_DOUBLE_EQ((*lightingRecord)["ts"].get<double>(), 12500.0);
+  EXPECT_DOUBLE_EQ((*lightingRecord)["dur"].get<double>(), 1500.0);
+
+  const auto* tileCullGpu = findEvent(events, "TileCull", 7u, 3);
+  ASSERT_NE(tileCullGpu, nullptr);
+  EXPECT_DOUBLE_EQ((*tileCullGpu)["ts"].get<double>(), 0.0);
+  EXPECT_DOUBLE_EQ((*tileCullGpu)["dur"].get<double>(), 1000.0);
+  EXPECT_EQ(findEvent(events, "Lighting", 7u, 3), nullptr);
+}
+
+TEST(RendererTelemetryTraceTests, EmptyRangeIsValidJson) {
+  const auto trace = nlohmann::json::parse(
+      exportRendererChromeTrace(std::vector<RendererTelemetrySnapshot>{}));
+  EXPECT_EQ(trace.value("displayTimeUnit", ""), "ms");
+  for (const auto& event : trace["traceEvents"]) {
+    EXPECT_EQ(event.value("ph", ""), "M");
+  }
+}
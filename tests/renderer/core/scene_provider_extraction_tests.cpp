@@ -9,6 +9,7 @@
 
 #include <filesystem>
 #include <fstream>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -50,6 +51,7 @@ using container::scene::SceneProviderRegistry;
 using container::scene::SceneProviderRevision;
 using container::scene::SceneProviderSnapshot;
 using container::scene::SceneProviderTriangleBatch;
+using container::scene::SceneProviderView;
 using container::scene::buildMeshSceneProviderAsset;
 using container::scene::buildMeshSceneAsset;
 
@@ -62,24 +64,32 @@ class TestProvider final : public IRenderSceneProvider {
     snapshot_.displayName = snapshot_.id.value;
   }
 
-  [[nodiscard]] SceneProviderSnapshot snapshot() const override {
-    return snapshot_;
+  [[nodiscard]] SceneProviderView view() const override {
+    ++viewCount_;
+    return snapshot_.view();
+  }
+
+  [[nodiscard]] std::size_t viewCount() const { return viewCount_; }
+
+  void addTriangleBatch(const SceneProviderTriangleBatch& batch) {
+    snapshot_.triangleBatches.push_back(batch);
   }
 
  private:
   SceneProviderSnapshot snapshot_{};
+  mutable std::size_t viewCount_{0};
 };
 
 class TestRayTracingExtractor final : public RayTracingSceneExtractor {
  public:
   [[nodiscard]] std::vector<RayTracingGeometryBuildInput> extract(
-      const std::vector<SceneProviderSnapshot>& providers) const override {
+      std::span<const SceneProviderView> providers) const override {
     std::vector<RayTracingGeometryBuildInput> inputs;
-    for (const SceneProviderSnapshot& provider : providers) {
+    for (const SceneProviderView& provider : providers) {
       if (provider.kind == SceneProviderKind::Mesh ||
           provider.kind == SceneProviderKind::Bim) {
         inputs.push_back({
-            .providerId = provider.id,
+            .providerId = SceneProviderId{std::string(provider.id)},
             .triangleGeometryCount = provider.elementCount,
             .instanceCount = provider.elementCount > 0 ? 1u : 0u,
             .geometryRevision = provider.revision.geometry,
@@ -94,11 +104,11 @@ class TestRayTracingExtractor final : public RayTracingSceneExtractor {
 class TestSplattingExtractor final : public SplattingExtractor {
  public:
   [[nodiscard]] std::vector<SplattingDispatchInput> extract(
-      const std::vector<SceneProviderSnapshot>& providers) const override {
+      std::span<const SceneProviderView> providers) const override {
     std::vector<SplattingDispatchInput> inputs;
-    for (const SceneProviderSnapshot& provider : providers) {
+    for (const SceneProviderView& provider : providers) {
       if (provider.kind == SceneProviderKind::GaussianSplatting) {
-        inputs.push_back({.providerId = provider.id,
+        inputs.push_back({.providerId = SceneProviderId{std::string(provider.id)},
                           .splatCount = provider.elementCount,
                           .geometryRevision = provider.revision.geometry});
       }
@@ -110,11 +120,11 @@ class TestSplattingExtractor final : public SplattingExtractor {
 class TestRadianceFieldExtractor final : public RadianceFieldExtractor {
  public:
   [[nodiscard]] std::vector<RadianceFieldDispatchInput> extract(
-      const std::vector<SceneProviderSnapshot>& providers) const override {
+      std::span<const SceneProviderView> providers) const override {
     std::vector<RadianceFieldDispatchInput> inputs;
-    for (const SceneProviderSnapshot& provider : providers) {
+    for (const SceneProviderView& provider : providers) {
       if (provider.kind == SceneProviderKind::RadianceField) {
-        inputs.push_back({.providerId = provider.id,
+        inputs.push_back({.providerId = SceneProviderId{std::string(provider.id)},
                           .fieldCount = 1u,
                           .geometryRevision = provider.revision.geometry,
                           .usesOccupancyData = true});
@@ -173,6 +183,57 @@ TEST(SceneProviderRegistryTests, RejectsEmptyAndDuplicateProviderIds) {
   EXPECT_THROW(registry.registerProvider(empty), std::invalid_argument);
 }
 
+TEST(SceneProviderRegistryTests, LookupsDoNotQueryProviders) {
+  TestProvider mesh{SceneProviderKind::Mesh, "mesh-scene", 4};
+  TestProvider bim{SceneProviderKind::Bim, "bim-scene", 12};
+  SceneProviderRegistry registry;
+  registry.registerProvider(mesh);
+  registry.registerProvider(bim);
+  EXPECT_EQ(mesh.viewCount(), 1u);
+  EXPECT_EQ(bim.viewCount(), 1u);
+
+  for (int frame = 0; frame < 16; ++frame) {
+    EXPECT_EQ(registry.find(SceneProviderId{"bim-scene"}), &bim);
+    EXPECT_EQ(registry.find(SceneProviderId{"missing"}), nullptr);
+    ASSERT_EQ(registry.providersForKind(SceneProviderKind::Mesh).size(), 1u);
+    EXPECT_EQ(registry.providersForKind(SceneProviderKind::Mesh).front(),
+              &mesh);
+    EXPECT_TRUE(
+        registry.providersForKind(SceneProviderKind::RadianceField).empty());
+  }
+  EXPECT_EQ(mesh.viewCount(), 1u);
+  EXPECT_EQ(bim.viewCount(), 1u);
+
+  registry.clear();
+  EXPECT_EQ(registry.find(SceneProviderId{"bim-scene"}), nullptr);
+  EXPECT_TRUE(registry.providersForKind(SceneProviderKind::Bim).empty());
+  registry.registerProvider(bim);
+  EXPECT_EQ(registry.find(SceneProviderId{"bim-scene"}), &bim);
+}
+
+TEST(SceneProviderRegistryTests, ViewsAndExtractionBorrowTriangleBatches) {
+  TestProvider mesh{SceneProviderKind::Mesh, "mesh-scene", 4};
+  mesh.addTriangleBatch({.firstIndex = 3, .indexCount = 30});
+  mesh.addTriangleBatch({.firstIndex = 33, .indexCount = 6});
+  SceneProviderRegistry registry;
+  registry.registerProvider(mesh);
+
+  const std::vector<SceneProviderView> views = registry.views();
+  ASSERT_EQ(views.size(), 1u);
+  const std::span<const SceneProviderTriangleBatch> batches =
+      mesh.view().triangleBatches;
+  EXPECT_EQ(views.front().triangleBatches.data(), batches.data());
+  EXPECT_EQ(views.front().id, "mesh-scene");
+
+  const ProviderSceneExtraction extraction =
+      extractProviderSceneFrameInputs(registry);
+  ASSERT_EQ(extraction.rayTracingBuildInputs.size(), 1u);
+  EXPECT_EQ(extraction.rayTracingBuildInputs.front().triangleBatches.data(),
+            batches.data());
+  EXPECT_EQ(extraction.rayTracingBuildInputs.front().triangleGeometryCount,
+            2u);
+}
+
 TEST(SceneProviderAdapterTests, MeshAndBimProvidersExposeNeutralSnapshots) {
   MeshSceneProvider mesh{SceneProviderId{"primary-mesh-scene"},
                          "Primary mesh"};
@@ -416,18 +477,18 @@ TEST(RenderExtractionTests, ExtractorsRouteProvidersByRepresentation) {
   registry.registerProvider(bim);
   registry.registerProvider(splats);
   registry.registerProvider(field);
-  const std::vector<SceneProviderSnapshot> snapshots = registry.snapshots();
+  const std::vector<SceneProviderView> views = registry.views();
 
   const TestRayTracingExtractor rayTracingExtractor;
   const TestSplattingExtractor splattingExtractor;
   const TestRadianceFieldExtractor radianceFieldExtractor;
 
   const std::vector<RayTracingGeometryBuildInput> rayInputs =
-      rayTracingExtractor.extract(snapshots);
+      rayTracingExtractor.extract(views);
   const std::vector<SplattingDispatchInput> splatInputs =
-      splattingExtractor.extract(snapshots);
+      splattingExtractor.extract(views);
   const std::vector<RadianceFieldDispatchInput> fieldInputs =
-      radianceFieldExtractor.extract(snapshots);
+      radianceFieldExtractor.extract(views);
 
   EXPECT_EQ(rayInputs.size(), 2u);
   EXPECT_EQ(splatInputs.size(), 1u);
@@ -496,14 +557,14 @@ TEST(RenderExtractionTests,
 
   const ProviderBackedMeshRasterExtractor meshRasterExtractor;
   const RasterDrawBatchDesc meshRaster =
-      meshRasterExtractor.extract(mesh.snapshot());
+      meshRasterExtractor.extract(mesh.view());
   EXPECT_EQ(meshRaster.providerId.value, "primary-mesh-scene");
   EXPECT_EQ(meshRaster.opaqueBatchCount, 7u);
   EXPECT_EQ(meshRaster.transparentBatchCount, 0u);
 
   const ProviderBackedBimRasterExtractor bimRasterExtractor;
   const RasterDrawBatchDesc bimRaster =
-      bimRasterExtractor.extract(bim.snapshot());
+      bimRasterExtractor.extract(bim.view());
   EXPECT_EQ(bimRaster.providerId.value, "auxiliary-bim-scene");
   EXPECT_EQ(bimRaster.opaqueBatchCount, 8u);
   EXPECT_EQ(bimRaster.transparentBatchCount, 4u);
@@ -514,7 +575,7 @@ TEST(RenderExtractionTests,
 
   const ProviderBackedRayTracingSceneExtractor rayTracingExtractor;
   const std::vector<RayTracingGeometryBuildInput> rayInputs =
-      rayTracingExtractor.extract(registry.snapshots());
+      rayTracingExtractor.extract(registry.views());
   ASSERT_EQ(rayInputs.size(), 2u);
   EXPECT_EQ(rayInputs[0].providerId.value, "primary-mesh-scene");
   EXPECT_EQ(rayInputs[0].triangleGeometryCount, 2u);
@@ -570,7 +631,7 @@ TEST(RenderExtractionTests,
   const ProviderSceneExtraction extraction =
       extractProviderSceneFrameInputs(registry);
 
-  EXPECT_EQ(extraction.snapshots.size(), 4u);
+  EXPECT_EQ(extraction.providers.size(), 4u);
   EXPECT_EQ(extraction.rasterBatches.size(), 2u);
   EXPECT_EQ(extraction.rayTracingBuildInputs.size(), 2u);
   ASSERT_EQ(extraction.splattingDispatchInputs.size(), 1u);
@@ -712,7 +773,7 @@ TEST(RenderExtractionTests,
   EXPECT_EQ(snapshot.nativeCurveOpaqueRangeCount, 3u);
 
   const ProviderBackedBimRasterExtractor extractor;
-  const RasterDrawBatchDesc raster = extractor.extract(snapshot);
+  const RasterDrawBatchDesc raster = extractor.extract(snapshot.view());
   EXPECT_EQ(raster.opaqueBatchCount, 0u);
   EXPECT_EQ(raster.transparentBatchCount, 0u);
 }
@@ -790,7 +851,7 @@ TEST(SceneDebugModelTests, BuildsUiNeutralProviderDebugState) {
   registry.registerProvider(splats);
 
   const container::renderer::SceneDebugModel debugModel =
-      container::renderer::buildSceneDebugModel(registry.snapshots());
+      container::renderer::buildSceneDebugModel(registry.views());
 
   ASSERT_EQ(debugModel.providers.size(), 2u);
   EXPECT_EQ(debugModel.providers[0].providerId, "mesh-scene");
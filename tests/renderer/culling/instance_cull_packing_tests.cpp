@@ -0,0 +1,215 @@
+#include "Container/renderer/culling/InstanceCullPacking.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+using container::gpu::GpuDrawIndexedIndirectCommand;
+using container::renderer::CompactedInstanceCull;
+using container::renderer::CullUploadRange;
+using container::renderer::DrawCommand;
+using container::renderer::InstanceCullInput;
+using container::renderer::buildCompactedDrawCommands;
+using container::renderer::changedCullDrawRange;
+using container::renderer::changedCullInstanceRange;
+using container::renderer::changedCullRunRange;
+using container::renderer::compactVisibleInstances;
+using container::renderer::growCullBufferCapacity;
+using container::renderer::kCulledInstanceListBit;
+using container::renderer::kMinCullBufferCapacity;
+using container::renderer::packInstanceCullInput;
+using container::renderer::packObjectCullDraws;
+using container::renderer::resolveCulledObjectIndex;
+
+namespace {
+
+std::vector<DrawCommand> mixedRuns() {
+  return {
+      {.objectIndex = 10u, .firstIndex = 0u, .indexCount = 36u,
+       .instanceCount = 1u},
+      {.objectIndex = 20u, .firstIndex = 36u, .indexCount = 6u,
+       .instanceCount = 4u},
+      {.objectIndex = 40u, .firstIndex = 42u, .indexCount = 12u,
+       .instanceCount = 3u},
+  };
+}
+
+}  // namespace
+
+TEST(InstanceCullPackingTests, ExpandsRunsIntoContiguousInstances) {
+  InstanceCullInput input;
+  packInstanceCullInput(mixedRuns(), input);
+
+  ASSERT_EQ(input.runCount(), 3u);
+  ASSERT_EQ(input.instanceCount(), 8u);
+  EXPECT_EQ(input.runs[0].instanceOffset, 0u);
+  EXPECT_EQ(input.runs[1].instanceOffset, 1u);
+  EXPECT_EQ(input.runs[1].instanceCount, 4u);
+  EXPECT_EQ(input.runs[1].indexCount, 6u);
+  EXPECT_EQ(input.runs[1].firstIndex, 36u);
+  EXPECT_EQ(input.runs[2].instanceOffset, 5u);
+
+  const std::vector<uint32_t> objects = {10u, 20u, 21u, 22u,
+                                         23u, 40u, 41u, 42u};
+  const std::vector<uint32_t> runs = {0u, 1u, 1u, 1u, 1u, 2u, 2u, 2u};
+  for (size_t i = 0; i < objects.size(); ++i) {
+    EXPECT_EQ(input.instances[i].objectIndex, objects[i]) << i;
+    EXPECT_EQ(input.instances[i].runIndex, runs[i]) << i;
+  }
+}
+
+TEST(InstanceCullPackingTests, DropsEmptyAndUnaddressableRuns) {
+  const std::vector<DrawCommand> commands = {
+      {.objectIndex = 1u, .firstIndex = 0u, .indexCount = 0u,
+       .instanceCount = 2u},
+      {.objectIndex = 2u, .firstIndex = 0u, .indexCount = 3u,
+       .instanceCount = 0u},
+      {.objectIndex = kCulledInstanceListBit - 2u, .firstIndex = 3u,
+       .indexCount = 3u, .instanceCount = 5u},
+      {.objectIndex = kCulledInstanceListBit, .firstIndex = 6u,
+       .indexCount = 3u, .instanceCount = 1u},
+  };
+
+  InstanceCullInput input;
+  input.instances.resize(32u);
+  packInstanceCullInput(commands, input);
+
+  ASSERT_EQ(input.runCount(), 1u);
+  EXPECT_EQ(input.runs[0].instanceCount, 2u);
+  ASSERT_EQ(input.instanceCount(), 2u);
+  EXPECT_EQ(input.instances[1].objectIndex, kCulledInstanceListBit - 1u);
+
+  packInstanceCullInput({}, input);
+  EXPECT_EQ(input.runCount(), 0u);
+  EXPECT_EQ(input.instanceCount(), 0u);
+}
+
+TEST(InstanceCullPackingTests, CompactsSurvivorsPerRun) {
+  InstanceCullInput input;
+  packInstanceCullInput(mixedRuns(), input);
+
+  const std::vector<uint8_t> visible = {0u, 1u, 0u, 1u, 1u, 0u, 0u, 0u};
+  const CompactedInstanceCull compacted =
+      compactVisibleInstances(input, visible);
+
+  ASSERT_EQ(compacted.runVisibleCounts.size(), 3u);
+  EXPECT_EQ(compacted.runVisibleCounts[0], 0u);
+  EXPECT_EQ(compacted.runVisibleCounts[1], 3u);
+  EXPECT_EQ(compacted.runVisibleCounts[2], 0u);
+  EXPECT_EQ(compacted.instanceIds[1], 20u);
+  EXPECT_EQ(compacted.instanceIds[2], 22u);
+  EXPECT_EQ(compacted.instanceIds[3], 23u);
+
+  const auto draws =
+      buildCompactedDrawCommands(input, compacted.runVisibleCounts, 0u);
+  ASSERT_EQ(draws.size(), 1u);
+  EXPECT_EQ(draws[0].indexCount, 6u);
+  EXPECT_EQ(draws[0].instanceCount, 3u);
+  EXPECT_EQ(draws[0].firstIndex, 36u);
+  EXPECT_EQ(draws[0].firstInstance, 1u | kCulledInstanceListBit);
+}
+
+TEST(InstanceCullPackingTests, CompactedDrawsResolveToVisibleObjects) {
+  InstanceCullInput input;
+  packInstanceCullInput(mixedRuns(), input);
+
+  const std::vector<uint8_t> visible = {1u, 1u, 1u, 0u, 1u, 1u, 0u, 1u};
+  const CompactedInstanceCull compacted =
+      compactVisibleInstances(input, visible);
+
+  // The occlusion pass writes its lists after the frustum lists.
+  const uint32_t listOffset = input.instanceCount();
+  std::vector<uint32_t> culledIds(listOffset, 0u);
+  culledIds.insert(culledIds.end(), compacted.instanceIds.begin(),
+                   compacted.instanceIds.end());
+  const auto draws = buildCompactedDrawCommands(
+      input, compacted.runVisibleCounts, listOffset);
+  ASSERT_EQ(draws.size(), 3u);
+
+  std::vector<uint32_t> resolved;
+  for (const GpuDrawIndexedIndirectCommand& draw : draws) {
+    for (uint32_t instance = 0; instance < draw.instanceCount; ++instance) {
+      resolved.push_back(
+          resolveCulledObjectIndex(draw.firstInstance, instance, culledIds));
+    }
+  }
+  EXPECT_EQ(resolved,
+            (std::vector<uint32_t>{10u, 20u, 21u, 23u, 40u, 42u}));
+
+  // Draws recorded without the list bit keep firstInstance + instance.
+  EXPECT_EQ(resolveCulledObjectIndex(7u, 2u, culledIds), 9u);
+}
+
+TEST(InstanceCullPackingTests, CapacityGrowsInsteadOfTruncating) {
+  EXPECT_EQ(growCullBufferCapacity(0u, 0u), kMinCullBufferCapacity);
+  EXPECT_EQ(growCullBufferCapacity(0u, 10u), kMinCullBufferCapacity);
+  EXPECT_EQ(growCullBufferCapacity(128u, 100u), 128u);
+  EXPECT_EQ(growCullBufferCapacity(128u, 129u), 192u);
+  EXPECT_EQ(growCullBufferCapacity(128u, 1000u), 1000u);
+  EXPECT_EQ(growCullBufferCapacity(0xF0000000u, 0xF0000001u), 0xFFFFFFFFu);
+}
+
+TEST(InstanceCullPackingTests, UploadRangeCoversOnlyChangedEntries) {
+  InstanceCullInput uploaded;
+  packInstanceCullInput(mixedRuns(), uploaded);
+
+  InstanceCullInput next;
+  packInstanceCullInput(mixedRuns(), next);
+  EXPECT_TRUE(changedCullRunRange(uploaded.runs, next.runs).empty());
+  EXPECT_TRUE(
+      changedCullInstanceRange(uploaded.instances, next.instances).empty());
+
+  std::vector<DrawCommand> moved = mixedRuns();
+  moved[1].objectIndex = 30u;
+  packInstanceCullInput(moved, next);
+  EXPECT_TRUE(changedCullRunRange(uploaded.runs, next.runs).empty());
+  const CullUploadRange instances =
+      changedCullInstanceRange(uploaded.instances, next.instances);
+  EXPECT_EQ(instances.first, 1u);
+  EXPECT_EQ(instances.count, 4u);
+
+  // Growing uploads through the new end; shrinking uploads nothing extra.
+  std::vector<DrawCommand> grown = mixedRuns();
+  grown.push_back({.objectIndex = 50u, .firstIndex = 54u, .indexCount = 3u,
+                   .instanceCount = 2u});
+  packInstanceCullInput(grown, next);
+  const CullUploadRange runs = changedCullRunRange(uploaded.runs, next.runs);
+  EXPECT_EQ(runs.first, 3u);
+  EXPECT_EQ(runs.count, 1u);
+
+  std::vector<DrawCommand> shrunk = mixedRuns();
+  shrunk.pop_back();
+  packInstanceCullInput(shrunk, next);
+  EXPECT_TRUE(changedCullRunRange(uploaded.runs, next.runs).empty());
+}
+
+TEST(InstanceCullPackingTests, ObjectDrawsExpandEveryInstance) {
+  std::vector<DrawCommand> commands = mixedRuns();
+  commands.push_back({.objectIndex = 60u, .firstIndex = 54u,
+                      .indexCount = 0u, .instanceCount = 2u});
+
+  std::vector<GpuDrawIndexedIndirectCommand> draws;
+  packObjectCullDraws(commands, draws);
+
+  const std::vector<uint32_t> objects = {10u, 20u, 21u, 22u,
+                                         23u, 40u, 41u, 42u};
+  ASSERT_EQ(draws.size(), objects.size());
+  for (size_t i = 0; i < objects.size(); ++i) {
+    EXPECT_EQ(draws[i].firstInstance, objects[i]) << i;
+    EXPECT_EQ(draws[i].instanceCount, 1u) << i;
+    EXPECT_EQ(draws[i].vertexOffset, 0) << i;
+  }
+  EXPECT_EQ(draws[2].indexCount, 6u);
+  EXPECT_EQ(draws[2].firstIndex, 36u);
+  EXPECT_EQ(draws[7].indexCount, 12u);
+  EXPECT_EQ(draws[7].firstIndex, 42u);
+
+  std::vector<DrawCommand> moved = mixedRuns();
+  moved[2].objectIndex = 70u;
+  std::vector<GpuDrawIndexedIndirectCommand> next;
+  packObjectCullDraws(moved, next);
+  const CullUploadRange range = changedCullDrawRange(draws, next);
+  EXPECT_EQ(range.first, 5u);
+  EXPECT_EQ(range.count, 3u);
+}
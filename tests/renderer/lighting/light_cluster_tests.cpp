@@ -0,0 +1,314 @@
+#include "Container/common/CommonMath.h"
+#include "Container/renderer/lighting/LightBvh.h"
+
+#include "../../support/light_cluster_reference.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+using container::gpu::kClusterDepthSlices;
+using container::gpu::kMaxClusteredLights;
+using container::gpu::kTileSize;
+using container::gpu::kUnboundedPointLightRange;
+using container::gpu::PointLightData;
+using container::renderer::LightBvh;
+using container::renderer::lightCullFrustumPlanes;
+using container::renderer::pointLightScreenImportance;
+using container::renderer::selectLightWorkingSet;
+using container::test::assignLightsToClustersReference;
+using container::test::ClusterLightAssignment;
+using container::test::clusterSliceBoundaryDepth;
+using container::test::depthToClusterSlice;
+
+constexpr float kNear = 0.1f;
+constexpr float kFar = 200.0f;
+
+struct TestView {
+  glm::mat4 viewProj{1.0f};
+  glm::mat4 inverseViewProj{1.0f};
+};
+
+[[nodiscard]] TestView makeView(const glm::vec3 &eye, const glm::vec3 &target,
+                                float aspect) {
+  const glm::mat4 view =
+      container::math::lookAt(eye, target, glm::vec3(0.0f, 1.0f, 0.0f));
+  const glm::mat4 projection = container::math::perspectiveRH_ReverseZ(
+      glm::radians(60.0f), aspect, kNear, kFar);
+  TestView result{};
+  result.viewProj = projection * view;
+  result.inverseViewProj = glm::inverse(result.viewProj);
+  return result;
+}
+
+[[nodiscard]] PointLightData makeLight(const glm::vec3 &position, float range,
+                                       float intensity) {
+  PointLightData light{};
+  light.positionRadius = glm::vec4(position, range);
+  light.colorIntensity = glm::vec4(1.0f, 0.95f, 0.9f, intensity);
+  return light;
+}
+
+// A campus-sized fixture layout: several buildings of stacked storeys with a
+// ceiling light every few metres.
+[[nodiscard]] std::vector<PointLightData> campusLights(uint32_t count,
+                                                       uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> jitter(-0.4f, 0.4f);
+  std::uniform_real_distribution<float> range(2.0f, 9.0f);
+  std::uniform_real_distribution<float> intensity(0.5f, 20.0f);
+  std::vector<PointLightData> lights;
+  lights.reserve(count);
+  for (uint32_t index = 0u; index < count; ++index) {
+    const uint32_t column = index % 60u;
+    const uint32_t row = (index / 60u) % 60u;
+    const uint32_t storey = index / 3600u;
+    lights.push_back(makeLight(
+        {static_cast<float>(column) * 5.0f - 150.0f + jitter(rng),
+         static_cast<float>(storey) * 3.5f + 2.8f,
+         static_cast<float>(row) * 5.0f - 150.0f + jitter(rng)},
+        range(rng), intensity(rng)));
+  }
+  return lights;
+}
+
+[[nodiscard]] std::vector<uint32_t>
+bruteForceVisibleLights(const std::vector<PointLightData> &lights,
+                        const glm::mat4 &viewProj) {
+  const auto planes = lightCullFrustumPlanes(viewProj);
+  std::vector<uint32_t> visible;
+  for (uint32_t index = 0u; index < lights.size(); ++index) {
+    const glm::vec4 &sphere = lights[index].positionRadius;
+    if (sphere.w == kUnboundedPointLightRange) {
+      visible.push_back(index);
+      continue;
+    }
+    const bool outside =
+        std::ranges::any_of(planes, [&](const glm::vec4 &plane) {
+          return glm::dot(glm::vec3(plane), glm::vec3(sphere)) + plane.w <
+                 -sphere.w;
+        });
+    if (!outside) {
+      visible.push_back(index);
+    }
+  }
+  return visible;
+}
+
+TEST(LightClusterTests, BvhFrustumQueryMatchesBruteForce) {
+  std::vector<PointLightData> lights = campusLights(12000u, 7u);
+  lights.push_back(makeLight({0.0f, 0.0f, 0.0f}, kUnboundedPointLightRange,
+                             1.0f));
+  lights.push_back(makeLight({5.0f, 3.0f, 5.0f}, 4.0f, 0.0f));
+
+  LightBvh bvh;
+  bvh.build(lights);
+  ASSERT_FALSE(bvh.empty());
+  ASSERT_EQ(bvh.unboundedLights().size(), 1u);
+  EXPECT_EQ(bvh.lightIndices().size(), 12000u);
+
+  const std::array<TestView, 3> views{
+      makeView({0.0f, 5.0f, 0.0f}, {40.0f, 4.0f, 30.0f}, 16.0f / 9.0f),
+      makeView({-170.0f, 20.0f, -170.0f}, {0.0f, 0.0f, 0.0f}, 1.0f),
+      makeView({0.0f, 300.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, 4.0f / 3.0f)};
+  for (const TestView &view : views) {
+    std::vector<uint32_t> queried;
+    bvh.queryFrustum(lightCullFrustumPlanes(view.viewProj), queried);
+    queried.insert(queried.end(), bvh.unboundedLights().begin(),
+                   bvh.unboundedLights().end());
+    std::ranges::sort(queried);
+
+    std::vector<uint32_t> expected =
+        bruteForceVisibleLights(lights, view.viewProj);
+    std::erase(expected, static_cast<uint32_t>(lights.size() - 1u));
+    EXPECT_EQ(queried, expected);
+  }
+}
+
+TEST(LightClusterTests, WorkingSetFitsBudgetAndKeepsMostImportantLights) {
+  std::vector<PointLightData> lights = campusLights(43200u, 11u);
+  lights[20000].positionRadius.w = kUnboundedPointLightRange;
+  ASSERT_GT(lights.size(), kMaxClusteredLights);
+
+  LightBvh bvh;
+  bvh.build(lights);
+  const TestView view =
+      makeView({-200.0f, 60.0f, -200.0f}, {0.0f, 10.0f, 0.0f}, 16.0f / 9.0f);
+
+  std::vector<uint32_t> selected;
+  std::vector<float> scratch;
+  const auto stats = selectLightWorkingSet(
+      bvh, lights, view.viewProj, kMaxClusteredLights, selected, scratch);
+
+  const std::vector<uint32_t> visible =
+      bruteForceVisibleLights(lights, view.viewProj);
+  ASSERT_GT(visible.size(), kMaxClusteredLights);
+  EXPECT_EQ(stats.visibleLights, visible.size());
+  EXPECT_EQ(stats.selectedLights, kMaxClusteredLights);
+  EXPECT_EQ(stats.droppedVisibleLights,
+            visible.size() - kMaxClusteredLights);
+  ASSERT_EQ(selected.size(), kMaxClusteredLights);
+  EXPECT_TRUE(std::ranges::is_sorted(selected));
+  EXPECT_TRUE(std::ranges::binary_search(selected, 20000u));
+
+  float weakestSelected = std::numeric_limits<float>::max();
+  for (const uint32_t index : selected) {
+    EXPECT_TRUE(std::ranges::binary_search(visible, index));
+    weakestSelected = std::min(
+        weakestSelected, pointLightScreenImportance(lights[index],
+                                                    view.viewProj));
+  }
+  for (const uint32_t index : visible) {
+    if (!std::ranges::binary_search(selected, index)) {
+      EXPECT_LE(pointLightScreenImportance(lights[index], view.viewProj),
+                weakestSelected);
+    }
+  }
+}
+
+TEST(LightClusterTests, WorkingSetKeepsEveryVisibleContribution) {
+  const std::vector<PointLightData> lights = campusLights(7200u, 3u);
+  LightBvh bvh;
+  bvh.build(lights);
+  const TestView view =
+      makeView({0.0f, 4.5f, -20.0f}, {10.0f, 3.0f, 40.0f}, 96.0f / 64.0f);
+
+  std::vector<uint32_t> selected;
+  std::vector<float> scratch;
+  const auto stats =
+      selectLightWorkingSet(bvh, lights, view.viewProj, 4096u, selected,
+                            scratch);
+  ASSERT_LT(stats.visibleLights, 4096u);
+  ASSERT_LT(selected.size(), lights.size());
+  EXPECT_EQ(stats.droppedVisibleLights, 0u);
+
+  std::vector<PointLightData> workingSet;
+  for (const uint32_t index : selected) {
+    workingSet.push_back(lights[index]);
+  }
+
+  // Every light that reaches a visible point must survive the selection and
+  // be listed in that point's cluster, unless the cluster overflowed.
+  constexpr uint32_t kWidth = 96u;
+  constexpr uint32_t kHeight = 64u;
+  const ClusterLightAssignment clusters = assignLightsToClustersReference(
+      workingSet, {.inverseViewProj = view.inverseViewProj,
+                   .width = kWidth,
+                   .height = kHeight,
+                   .cameraNear = kNear,
+                   .cameraFar = kFar});
+  uint32_t checkedContributions = 0u;
+  for (uint32_t slice = 0u; slice < kClusterDepthSlices; ++slice) {
+    const float depth =
+        0.5f * (clusterSliceBoundaryDepth(slice, kNear, kFar,
+                                          kClusterDepthSlices) +
+                clusterSliceBoundaryDepth(slice + 1u, kNear, kFar,
+                                          kClusterDepthSlices));
+    for (uint32_t y = 2u; y < kHeight; y += 4u) {
+      for (uint32_t x = 2u; x < kWidth; x += 4u) {
+        const glm::vec4 clip{(static_cast<float>(x) + 0.5f) / kWidth * 2.0f -
+                                 1.0f,
+                             -((static_cast<float>(y) + 0.5f) / kHeight *
+                                   2.0f -
+                               1.0f),
+                             depth, 1.0f};
+        const glm::vec4 world = view.inverseViewProj * clip;
+        const glm::vec3 point = glm::vec3(world) / world.w;
+        const auto clusterLights = clusters.clusterLights(
+            clusters.clusterIndex(x / kTileSize, y / kTileSize, slice));
+        for (uint32_t index = 0u; index < lights.size(); ++index) {
+          const glm::vec4 &sphere = lights[index].positionRadius;
+          if (glm::length(point - glm::vec3(sphere)) > sphere.w) {
+            continue;
+          }
+          ++checkedContributions;
+          const auto found = std::ranges::lower_bound(selected, index);
+          ASSERT_TRUE(found != selected.end() && *found == index);
+          if (clusterLights.size() < container::gpu::kMaxLightsPerTile) {
+            EXPECT_TRUE(std::ranges::find(
+                            clusterLights,
+                            static_cast<uint32_t>(found - selected.begin())) !=
+                        clusterLights.end());
+          }
+        }
+      }
+    }
+  }
+  EXPECT_GT(checkedContributions, 0u);
+}
+
+TEST(LightClusterTests, SliceBoundariesRoundTripThroughDepthToSlice) {
+  float previous = clusterSliceBoundaryDepth(0u, kNear, kFar,
+                                             kClusterDepthSlices);
+  EXPECT_FLOAT_EQ(previous, 1.0f);
+  for (uint32_t slice = 0u; slice < kClusterDepthSlices; ++slice) {
+    const float next = clusterSliceBoundaryDepth(slice + 1u, kNear, kFar,
+                                                 kClusterDepthSlices);
+    // Reverse-Z: depth decreases with distance.
+    EXPECT_LT(next, previous);
+    EXPECT_EQ(depthToClusterSlice(0.5f * (previous + next), kNear, kFar,
+                                  kClusterDepthSlices),
+              slice);
+    previous = next;
+  }
+  EXPECT_NEAR(previous, 0.0f, 1.0e-6f);
+  EXPECT_EQ(depthToClusterSlice(0.0f, kNear, kFar, kClusterDepthSlices),
+            kClusterDepthSlices - 1u);
+}
+
+TEST(LightClusterTests, ReferencePlacesLightInItsScreenCluster) {
+  constexpr uint32_t kWidth = 160u;
+  constexpr uint32_t kHeight = 96u;
+  const TestView view = makeView({0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f},
+                                 static_cast<float>(kWidth) / kHeight);
+  const glm::vec3 lightPosition{1.5f, 0.8f, -12.0f};
+  const std::vector<PointLightData> lights{
+      makeLight(lightPosition, 0.25f, 5.0f),
+      makeLight({0.0f, 0.0f, 50.0f}, 1.0f, 5.0f)};
+
+  std::vector<float> depth(static_cast<size_t>(kWidth) * kHeight);
+  const glm::vec4 clip = view.viewProj * glm::vec4(lightPosition, 1.0f);
+  const glm::vec3 ndc = glm::vec3(clip) / clip.w;
+  std::ranges::fill(depth, ndc.z);
+
+  const ClusterLightAssignment assignment = assignLightsToClustersReference(
+      lights, {.inverseViewProj = view.inverseViewProj,
+               .width = kWidth,
+               .height = kHeight,
+               .cameraNear = kNear,
+               .cameraFar = kFar,
+               .depth = depth});
+
+  // Scene NDC +Y is up while framebuffer rows grow downwards.
+  const auto pixelX = static_cast<uint32_t>((ndc.x * 0.5f + 0.5f) * kWidth);
+  const auto pixelY = static_cast<uint32_t>((-ndc.y * 0.5f + 0.5f) * kHeight);
+  const uint32_t slice =
+      depthToClusterSlice(ndc.z, kNear, kFar, kClusterDepthSlices);
+  const uint32_t cluster = assignment.clusterIndex(
+      pixelX / kTileSize, pixelY / kTileSize, slice);
+  ASSERT_EQ(assignment.clusterLights(cluster).size(), 1u);
+  EXPECT_EQ(assignment.clusterLights(cluster)[0], 0u);
+
+  uint32_t occupiedClusters = 0u;
+  uint32_t litClusters = 0u;
+  for (uint32_t index = 0u; index < assignment.grid.size(); ++index) {
+    EXPECT_EQ(assignment.grid[index].offset,
+              index * container::gpu::kMaxLightsPerTile);
+    litClusters += assignment.grid[index].count;
+    occupiedClusters += assignment.grid[index].count > 0u ? 1u : 0u;
+  }
+  // The light behind the camera never lands anywhere, and only the slice
+  // holding depth samples can receive lights.
+  EXPECT_EQ(litClusters, occupiedClusters);
+  EXPECT_LT(occupiedClusters, assignment.tileCountX * assignment.tileCountY);
+  EXPECT_EQ(assignment.maxLightsPerCluster, 1u);
+}
+
+} // namespace
@@ -0,0 +1,226 @@
+#include "Container/renderer/lighting/LightPublishTracker.h"
+#include "Container/renderer/lighting/LightingManager.h"
+#include "Container/ecs/World.h"
+#include "Container/utility/AllocationManager.h"
+#include "Container/utility/PipelineManager.h"
+
+#include "../../support/allocation_counter.h"
+
+#include <gtest/gtest.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+namespace {
+
+using container::ecs::World;
+using container::gpu::AreaLightData;
+using container::gpu::PointLightData;
+using container::renderer::changedPointLightRange;
+using container::renderer::EditableLightEntity;
+using container::renderer::EditableLightId;
+using container::renderer::EditableLightSource;
+using container::renderer::EditableLightType;
+using container::renderer::LightingManager;
+using container::renderer::LightPublishInputs;
+using container::renderer::LightPublishTracker;
+using container::renderer::LightUploadRange;
+using container::test::allocationCount;
+
+[[nodiscard]] PointLightData pointLight(uint32_t index) {
+  PointLightData light{};
+  light.positionRadius = {static_cast<float>(index % 64u) * 4.0f, 3.0f,
+                          static_cast<float>(index / 64u) * 4.0f, 6.0f};
+  light.colorIntensity = {1.0f, 0.9f, 0.8f, 5.0f};
+  return light;
+}
+
+// A LightingManager without a device or scene: only the CPU publish path
+// (manual lights, ECS mirror, tracker) runs, which is what these tests cover.
+class LightingManagerPublishTest : public ::testing::Test {
+protected:
+  LightingManagerPublishTest()
+      : manager_(nullptr, allocationManager_, pipelineManager_, nullptr,
+                 sceneGraph_, world_) {}
+
+  void addManualPointLights(uint32_t count) {
+    for (uint32_t index = 0u; index < count; ++index) {
+      (void)manager_.addManualEditableLight(EditableLightType::Point);
+    }
+  }
+
+  [[nodiscard]] std::optional<EditableLightEntity>
+  manualPointLight(uint32_t index) const {
+    for (const EditableLightEntity &light : manager_.editableLights()) {
+      if (light.id == EditableLightId{.type = EditableLightType::Point,
+                                      .source = EditableLightSource::Manual,
+                                      .index = index}) {
+        return light;
+      }
+    }
+    return std::nullopt;
+  }
+
+  [[nodiscard]] std::vector<PointLightData> ecsPointLights() const {
+    std::vector<PointLightData> lights;
+    world_.forEachPointLight([&](const container::ecs::LightComponent &light) {
+      lights.push_back(light.data);
+    });
+    return lights;
+  }
+
+  World world_{};
+  container::scene::SceneGraph sceneGraph_{};
+  container::gpu::AllocationManager allocationManager_{};
+  container::gpu::PipelineManager pipelineManager_{VK_NULL_HANDLE};
+  LightingManager manager_;
+};
+
+TEST(LightPublishTrackerTests, ChangedRangeCoversOnlyDifferingLights) {
+  std::vector<PointLightData> previous;
+  for (uint32_t index = 0u; index < 16u; ++index) {
+    previous.push_back(pointLight(index));
+  }
+
+  std::vector<PointLightData> next = previous;
+  EXPECT_TRUE(changedPointLightRange(previous, next).empty());
+
+  next[3].colorIntensity.a = 9.0f;
+  next[7].positionRadius.w = 2.0f;
+  LightUploadRange range = changedPointLightRange(previous, next);
+  EXPECT_EQ(range.first, 3u);
+  EXPECT_EQ(range.count, 5u);
+
+  next = previous;
+  next.push_back(pointLight(16u));
+  range = changedPointLightRange(previous, next);
+  EXPECT_EQ(range.first, 16u);
+  EXPECT_EQ(range.count, 1u);
+
+  next.assign(previous.begin(), previous.begin() + 8);
+  EXPECT_TRUE(changedPointLightRange(previous, next).empty());
+  next[7].colorIntensity.r = 0.0f;
+  range = changedPointLightRange(previous, next);
+  EXPECT_EQ(range.first, 7u);
+  EXPECT_EQ(range.count, 1u);
+
+  LightUploadRange merged{.first = 10u, .count = 2u};
+  merged.merge({.first = 2u, .count = 3u});
+  merged.merge({});
+  EXPECT_EQ(merged.first, 2u);
+  EXPECT_EQ(merged.end(), 12u);
+}
+
+TEST(LightPublishTrackerTests, QueuesOnlyRangesThatDifferFromLastPublish) {
+  std::vector<PointLightData> pointLights;
+  for (uint32_t index = 0u; index < 1024u; ++index) {
+    pointLights.push_back(pointLight(index));
+  }
+  const std::vector<AreaLightData> areaLights(8u);
+  LightPublishTracker tracker;
+  LightPublishInputs inputs{.authoredLightRevision = 1u};
+
+  EXPECT_TRUE(tracker.needsPublish(inputs));
+  tracker.markPublished(inputs, pointLights, areaLights);
+  EXPECT_FALSE(tracker.needsPublish(inputs));
+  EXPECT_EQ(tracker.takePointLightUpload().count, 1024u);
+  EXPECT_EQ(tracker.takeAreaLightUpload().count, 8u);
+  EXPECT_TRUE(tracker.takePointLightUpload().empty());
+
+  pointLights[600].colorIntensity.a = 12.0f;
+  ++inputs.editRevision;
+  EXPECT_TRUE(tracker.needsPublish(inputs));
+  tracker.markPublished(inputs, pointLights, areaLights);
+  const LightUploadRange upload = tracker.takePointLightUpload();
+  EXPECT_EQ(upload.first, 600u);
+  EXPECT_EQ(upload.count, 1u);
+  EXPECT_TRUE(tracker.takeAreaLightUpload().empty());
+
+  inputs.sceneTransform =
+      glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 2.0f, 0.0f));
+  EXPECT_TRUE(tracker.needsPublish(inputs));
+  tracker.markPublished(inputs, pointLights, areaLights);
+  EXPECT_TRUE(tracker.takePointLightUpload().empty());
+
+  tracker.invalidateUploads();
+  EXPECT_EQ(tracker.takePointLightUpload().count, 1024u);
+  tracker.invalidate();
+  EXPECT_TRUE(tracker.needsPublish(inputs));
+  EXPECT_EQ(tracker.publishCount(), 3u);
+}
+
+TEST_F(LightingManagerPublishTest, StaticFramesSkipEcsWritesAndAllocations) {
+  addManualPointLights(256u);
+  manager_.updateLightingDataForActiveCamera();
+  ASSERT_EQ(manager_.lightPublishCount(), 1u);
+  ASSERT_EQ(world_.pointLightCount(), 256u);
+  ASSERT_EQ(manager_.pointLightsSsbo().size(), 256u);
+
+  const uint64_t ecsRevision = world_.pointLightRevision();
+  const size_t allocationsBefore = allocationCount();
+  for (uint32_t frame = 0u; frame < 240u; ++frame) {
+    manager_.updateLightingDataForActiveCamera();
+  }
+  const size_t allocations = allocationCount() - allocationsBefore;
+
+  EXPECT_EQ(allocations, 0u);
+  EXPECT_EQ(world_.pointLightRevision(), ecsRevision);
+  EXPECT_EQ(world_.pointLightCount(), 256u);
+  EXPECT_EQ(manager_.lightPublishCount(), 1u);
+}
+
+TEST_F(LightingManagerPublishTest, EditRepublishesThroughTheEcs) {
+  addManualPointLights(64u);
+  manager_.updateLightingData();
+  ASSERT_EQ(manager_.lightPublishCount(), 1u);
+
+  std::optional<EditableLightEntity> light = manualPointLight(40u);
+  ASSERT_TRUE(light.has_value());
+  light->intensity = 12.0f;
+  ASSERT_TRUE(manager_.updateEditableLight(*light));
+  manager_.updateLightingData();
+  EXPECT_EQ(manager_.lightPublishCount(), 2u);
+
+  const auto isEdited = [](const PointLightData &data) {
+    return data.colorIntensity.a == 12.0f;
+  };
+  const std::vector<PointLightData> ecsLights = ecsPointLights();
+  ASSERT_EQ(ecsLights.size(), 64u);
+  EXPECT_EQ(std::ranges::count_if(ecsLights, isEdited), 1);
+  EXPECT_EQ(std::ranges::count_if(manager_.pointLightsSsbo(), isEdited), 1);
+
+  manager_.updateLightingData();
+  EXPECT_EQ(manager_.lightPublishCount(), 2u);
+}
+
+TEST_F(LightingManagerPublishTest, EcsAndSettingsChangesForceRepublish) {
+  addManualPointLights(32u);
+  manager_.updateLightingData();
+  ASSERT_EQ(manager_.lightPublishCount(), 1u);
+
+  world_.clearPointLights();
+  manager_.updateLightingData();
+  EXPECT_EQ(manager_.lightPublishCount(), 2u);
+  EXPECT_EQ(world_.pointLightCount(), 32u);
+
+  (void)world_.createPointLight(pointLight(0u));
+  manager_.updateLightingData();
+  EXPECT_EQ(manager_.lightPublishCount(), 3u);
+  EXPECT_EQ(world_.pointLightCount(), 32u);
+
+  container::gpu::LightingSettings settings = manager_.lightingSettings();
+  settings.environmentIntensity += 0.5f;
+  manager_.setLightingSettings(settings);
+  manager_.updateLightingData();
+  EXPECT_EQ(manager_.lightPublishCount(), 4u);
+  EXPECT_EQ(manager_.lightingData().environmentIntensity,
+            settings.environmentIntensity);
+
+  manager_.updateLightingData();
+  EXPECT_EQ(manager_.lightPublishCount(), 4u);
+}
+
+} // namespace
@@ -0,0 +1,316 @@
+#include "Container/renderer/scene/LooseOctree.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+using container::renderer::LooseOctree;
+using container::renderer::LooseOctreeBounds;
+using container::renderer::LooseOctreeRayHit;
+
+constexpr float kWorldHalf = 500.0f;
+constexpr uint32_t kLargeBoxCount = 1000000u;
+
+[[nodiscard]] LooseOctreeBounds worldBounds() {
+  return {.min = glm::vec3(-kWorldHalf), .max = glm::vec3(kWorldHalf)};
+}
+
+[[nodiscard]] LooseOctreeBounds boxAt(const glm::vec3 &center,
+                                      const glm::vec3 &halfSize) {
+  return {.min = center - halfSize, .max = center + halfSize};
+}
+
+// Mostly small boxes spread over the world with a tail of large ones, plus a
+// few centred outside the root so the out-of-bounds path is exercised.
+[[nodiscard]] std::vector<LooseOctreeBounds> randomBoxes(uint32_t count,
+                                                         uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> position(-kWorldHalf, kWorldHalf);
+  std::uniform_real_distribution<float> logSize(std::log(0.05f),
+                                                std::log(40.0f));
+  std::uniform_real_distribution<float> aspect(0.3f, 1.0f);
+  std::vector<LooseOctreeBounds> boxes;
+  boxes.reserve(count);
+  for (uint32_t index = 0u; index < count; ++index) {
+    const float size = std::exp(logSize(rng));
+    const float spread = index % 1000u == 0u ? 1.3f : 1.0f;
+    boxes.push_back(boxAt(
+        {position(rng) * spread, position(rng) * spread,
+         position(rng) * spread},
+        {size * aspect(rng), size * aspect(rng), size * aspect(rng)}));
+  }
+  return boxes;
+}
+
+[[nodiscard]] bool boxesOverlap(const LooseOctreeBounds &a,
+                                const LooseOctreeBounds &b) {
+  return a.min.x <= b.max.x && a.min.y <= b.max.y && a.min.z <= b.max.z &&
+         b.min.x <= a.max.x && b.min.y <= a.max.y && b.min.z <= a.max.z;
+}
+
+[[nodiscard]] float planeDistance(const glm::vec4 &plane,
+                                  const glm::vec3 &point) {
+  return glm::dot(glm::vec3(plane), point) + plane.w;
+}
+
+[[nodiscard]] glm::vec3 farthestCorner(const LooseOctreeBounds &box,
+                                       const glm::vec3 &normal) {
+  return {normal.x >= 0.0f ? box.max.x : box.min.x,
+          normal.y >= 0.0f ? box.max.y : box.min.y,
+          normal.z >= 0.0f ? box.max.z : box.min.z};
+}
+
+[[nodiscard]] glm::vec3 nearestCorner(const LooseOctreeBounds &box,
+                                      const glm::vec3 &normal) {
+  return {normal.x >= 0.0f ? box.min.x : box.max.x,
+          normal.y >= 0.0f ? box.min.y : box.max.y,
+          normal.z >= 0.0f ? box.min.z : box.max.z};
+}
+
+// Brute-force references over the same ids the tree holds.
+struct Reference {
+  std::vector<LooseOctreeBounds> boxes;
+  std::vector<bool> present;
+
+  template <typename Predicate>
+  [[nodiscard]] std::vector<uint32_t> select(Predicate predicate) const {
+    std::vector<uint32_t> ids;
+    for (uint32_t id = 0u; id < boxes.size(); ++id) {
+      if (present[id] && predicate(boxes[id])) {
+        ids.push_back(id);
+      }
+    }
+    return ids;
+  }
+};
+
+[[nodiscard]] std::vector<uint32_t> sorted(std::vector<uint32_t> ids) {
+  std::ranges::sort(ids);
+  return ids;
+}
+
+// A convex cell bounded by planes facing a random point.
+[[nodiscard]] std::vector<glm::vec4> randomFrustum(std::mt19937 &rng) {
+  std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+  std::uniform_real_distribution<float> position(-300.0f, 300.0f);
+  std::uniform_real_distribution<float> reach(20.0f, 200.0f);
+  const glm::vec3 center{position(rng), position(rng), position(rng)};
+  std::vector<glm::vec4> planes;
+  for (int i = 0; i < 6; ++i) {
+    glm::vec3 normal{unit(rng), unit(rng), unit(rng)};
+    normal = glm::normalize(normal + glm::vec3(0.0f, 0.0f, 1.0e-3f));
+    planes.emplace_back(normal, reach(rng) - glm::dot(normal, center));
+  }
+  return planes;
+}
+
+void expectQueriesMatch(const LooseOctree &tree, const Reference &reference,
+                        uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> position(-450.0f, 450.0f);
+  std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+  std::uniform_real_distribution<float> radius(1.0f, 80.0f);
+  std::vector<uint32_t> ids;
+
+  for (int query = 0; query < 4; ++query) {
+    const std::vector<glm::vec4> planes = randomFrustum(rng);
+    ids.clear();
+    tree.queryFrustum(planes, ids);
+    EXPECT_EQ(sorted(ids), reference.select([&](const LooseOctreeBounds &box) {
+      return std::ranges::none_of(planes, [&](const glm::vec4 &plane) {
+        return planeDistance(plane, farthestCorner(box, glm::vec3(plane))) <
+               0.0f;
+      });
+    })) << "frustum query " << query;
+
+    const glm::vec3 center{position(rng), position(rng), position(rng)};
+    const float sphereRadius = radius(rng);
+    ids.clear();
+    tree.querySphere(center, sphereRadius, ids);
+    EXPECT_EQ(sorted(ids), reference.select([&](const LooseOctreeBounds &box) {
+      const glm::vec3 gap =
+          glm::max(glm::max(box.min - center, center - box.max), 0.0f);
+      return glm::dot(gap, gap) <= sphereRadius * sphereRadius;
+    })) << "sphere query " << query;
+
+    const LooseOctreeBounds region =
+        boxAt(center, glm::vec3(radius(rng), radius(rng), radius(rng)));
+    ids.clear();
+    tree.queryBox(region, ids);
+    EXPECT_EQ(sorted(ids), reference.select([&](const LooseOctreeBounds &box) {
+      return boxesOverlap(box, region);
+    })) << "box query " << query;
+
+    glm::vec3 normal{unit(rng), unit(rng), unit(rng)};
+    normal = glm::normalize(normal + glm::vec3(1.0e-3f, 0.0f, 0.0f));
+    const glm::vec4 plane(normal, -glm::dot(normal, center));
+    ids.clear();
+    tree.queryPlane(plane, ids);
+    EXPECT_EQ(sorted(ids), reference.select([&](const LooseOctreeBounds &box) {
+      return planeDistance(plane, farthestCorner(box, normal)) >= 0.0f &&
+             planeDistance(plane, nearestCorner(box, normal)) <= 0.0f;
+    })) << "plane query " << query;
+
+    const glm::vec3 origin{position(rng), position(rng), position(rng)};
+    glm::vec3 direction{unit(rng), unit(rng), unit(rng)};
+    direction = glm::normalize(direction + glm::vec3(0.0f, 1.0e-3f, 0.0f));
+    const float maxDistance = 600.0f;
+    std::vector<LooseOctreeRayHit> hits;
+    tree.queryRay(origin, direction, maxDistance, hits);
+    std::ranges::sort(hits, {}, &LooseOctreeRayHit::id);
+    const glm::vec3 inverse = 1.0f / direction;
+    std::vector<LooseOctreeRayHit> expected;
+    for (uint32_t id = 0u; id < reference.boxes.size(); ++id) {
+      if (!reference.present[id]) {
+        continue;
+      }
+      const LooseOctreeBounds &box = reference.boxes[id];
+      const glm::vec3 t0 = (box.min - origin) * inverse;
+      const glm::vec3 t1 = (box.max - origin) * inverse;
+      const glm::vec3 nearT = glm::min(t0, t1);
+      const glm::vec3 farT = glm::max(t0, t1);
+      const float entry = std::max({nearT.x, nearT.y, nearT.z, 0.0f});
+      const float exit = std::min({farT.x, farT.y, farT.z, maxDistance});
+      if (entry <= exit) {
+        expected.push_back({.id = id, .distance = entry});
+      }
+    }
+    ASSERT_EQ(hits.size(), expected.size()) << "ray query " << query;
+    for (size_t i = 0; i < hits.size(); ++i) {
+      EXPECT_EQ(hits[i].id, expected[i].id);
+      EXPECT_NEAR(hits[i].distance, expected[i].distance, 1.0e-3f);
+    }
+  }
+}
+
+TEST(LooseOctreeTests, InsertMoveAndRemoveTrackBounds) {
+  LooseOctree tree(worldBounds());
+  const LooseOctreeBounds first = boxAt({10.0f, 0.0f, 0.0f}, glm::vec3(1.0f));
+  const LooseOctreeBounds second = boxAt({-10.0f, 0.0f, 0.0f}, glm::vec3(2.0f));
+  tree.insert(3u, first);
+  tree.insert(7u, second);
+  EXPECT_EQ(tree.size(), 2u);
+  EXPECT_TRUE(tree.contains(3u));
+  EXPECT_FALSE(tree.contains(4u));
+  EXPECT_EQ(tree.bounds(7u).min, second.min);
+  EXPECT_THROW(tree.insert(3u, first), std::invalid_argument);
+  EXPECT_THROW(tree.move(4u, first), std::out_of_range);
+
+  const LooseOctreeBounds moved = boxAt({200.0f, 50.0f, -80.0f},
+                                        glm::vec3(1.0f));
+  tree.move(3u, moved);
+  EXPECT_EQ(tree.bounds(3u).max, moved.max);
+  std::vector<uint32_t> ids;
+  tree.querySphere({10.0f, 0.0f, 0.0f}, 2.0f, ids);
+  EXPECT_TRUE(ids.empty());
+  tree.querySphere({200.0f, 50.0f, -80.0f}, 0.5f, ids);
+  EXPECT_EQ(ids, std::vector<uint32_t>{3u});
+
+  EXPECT_TRUE(tree.remove(3u));
+  EXPECT_FALSE(tree.remove(3u));
+  EXPECT_EQ(tree.size(), 1u);
+  ids.clear();
+  tree.queryBox(worldBounds(), ids);
+  EXPECT_EQ(ids, std::vector<uint32_t>{7u});
+
+  tree.clear();
+  EXPECT_TRUE(tree.empty());
+  EXPECT_FALSE(tree.contains(7u));
+}
+
+TEST(LooseOctreeTests, BoxesOutsideTheRootAreStillFound) {
+  LooseOctree tree({.min = glm::vec3(-1.0f), .max = glm::vec3(1.0f)});
+  tree.insert(0u, boxAt({50.0f, 0.0f, 0.0f}, glm::vec3(0.5f)));
+  tree.insert(1u, boxAt({0.25f, 0.25f, 0.25f}, glm::vec3(0.01f)));
+
+  std::vector<uint32_t> ids;
+  tree.queryBox(boxAt({50.0f, 0.0f, 0.0f}, glm::vec3(1.0f)), ids);
+  EXPECT_EQ(ids, std::vector<uint32_t>{0u});
+
+  std::vector<LooseOctreeRayHit> hits;
+  tree.queryRay({0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, 100.0f, hits);
+  ASSERT_EQ(hits.size(), 1u);
+  EXPECT_EQ(hits.front().id, 0u);
+  EXPECT_FLOAT_EQ(hits.front().distance, 49.5f);
+  EXPECT_GT(tree.stats().deepestOccupiedDepth, 0u);
+}
+
+TEST(LooseOctreeTests, DefaultConstructedTreeAcceptsInserts) {
+  LooseOctree tree;
+  std::vector<uint32_t> ids;
+  tree.queryFrustum(std::vector<glm::vec4>{}, ids);
+  EXPECT_TRUE(ids.empty());
+
+  tree.insert(0u, boxAt({3.0f, 3.0f, 3.0f}, glm::vec3(0.5f)));
+  tree.queryFrustum(std::vector<glm::vec4>{}, ids);
+  EXPECT_EQ(ids, std::vector<uint32_t>{0u});
+}
+
+TEST(LooseOctreeTests, QueriesMatchBruteForceOnAMillionBoxes) {
+  Reference reference{.boxes = randomBoxes(kLargeBoxCount, 11u),
+                      .present = std::vector<bool>(kLargeBoxCount, true)};
+  LooseOctree tree(worldBounds());
+  for (uint32_t id = 0u; id < kLargeBoxCount; ++id) {
+    tree.insert(id, reference.boxes[id]);
+  }
+  ASSERT_EQ(tree.size(), kLargeBoxCount);
+  expectQueriesMatch(tree, reference, 5u);
+
+  // Removing every third box keeps the remaining answers exact.
+  for (uint32_t id = 0u; id < kLargeBoxCount; id += 3u) {
+    ASSERT_TRUE(tree.remove(id));
+    reference.present[id] = false;
+  }
+  expectQueriesMatch(tree, reference, 6u);
+}
+
+TEST(LooseOctreeTests, SmallMovesOfAMillionBoxesStayInPlace) {
+  Reference reference{.boxes = randomBoxes(kLargeBoxCount, 23u),
+                      .present = std::vector<bool>(kLargeBoxCount, true)};
+  LooseOctree tree(worldBounds());
+  for (uint32_t id = 0u; id < kLargeBoxCount; ++id) {
+    tree.insert(id, reference.boxes[id]);
+  }
+  const size_t nodesBefore = tree.stats().nodeCount;
+
+  // Per-frame animation sized nudges: one percent of each box's extent.
+  std::mt19937 rng(29u);
+  std::uniform_real_distribution<float> nudge(-0.01f, 0.01f);
+  for (int frame = 0; frame < 2; ++frame) {
+    for (uint32_t id = 0u; id < kLargeBoxCount; ++id) {
+      LooseOctreeBounds &box = reference.boxes[id];
+      const glm::vec3 extent = box.max - box.min;
+      const glm::vec3 offset =
+          extent * glm::vec3(nudge(rng), nudge(rng), nudge(rng));
+      box = {.min = box.min + offset, .max = box.max + offset};
+      tree.move(id, box);
+    }
+  }
+
+  const auto stats = tree.stats();
+  EXPECT_EQ(stats.inPlaceMoves + stats.relinkedMoves, 2u * kLargeBoxCount);
+  EXPECT_LT(stats.relinkedMoves, stats.inPlaceMoves / 20u);
+  EXPECT_LT(stats.nodeCount, nodesBefore + nodesBefore / 10u);
+  expectQueriesMatch(tree, reference, 31u);
+
+  // Teleporting boxes across the world relinks them and stays exact.
+  std::uniform_real_distribution<float> position(-kWorldHalf, kWorldHalf);
+  for (uint32_t id = 0u; id < kLargeBoxCount; id += 97u) {
+    LooseOctreeBounds &box = reference.boxes[id];
+    const glm::vec3 half = (box.max - box.min) * 0.5f;
+    box = boxAt({position(rng), position(rng), position(rng)}, half);
+    tree.move(id, box);
+  }
+  EXPECT_GT(tree.stats().relinkedMoves, stats.relinkedMoves);
+  expectQueriesMatch(tree, reference, 37u);
+}
+
+}  // namespace
@@ -11,6 +11,8 @@ using container::gpu::ObjectData;
 using container::renderer::buildShadowCascadeDrawPlan;
 using container::renderer::computeShadowCascadeDrawSignature;
 using container::renderer::DrawCommand;
+using container::renderer::ShadowCascadeDrawPlan;
+using container::renderer::ShadowCascadeDrawPlanner;
 using container::renderer::ShadowCascadeDrawPlannerInputs;
 
 [[nodiscard]] DrawCommand drawCommand(uint32_t objectIndex,
@@ -175,4 +177,30 @@ TEST(ShadowCascadeDrawPlannerTests, SignatureTracksPolicyAndDrawChanges) {
   EXPECT_NE(computeShadowCascadeDrawSignature(inputs), initial);
 }
 
+TEST(ShadowCascadeDrawPlannerTests, RebuildReplacesContentsAndKeepsStorage) {
+  const std::vector<DrawCommand> first = {drawCommand(1u), drawCommand(2u)};
+  const std::vector<DrawCommand> second = {drawCommand(3u)};
+
+  ShadowCascadeDrawPlannerInputs inputs{};
+  inputs.sceneDraws = {.windingFlipped = &first};
+  activateAllCascades(inputs);
+  ShadowCascadeDrawPlan plan{};
+  ShadowCascadeDrawPlanner(inputs).build(plan);
+  ASSERT_EQ(plan.sceneWindingFlipped[0].size(), 2u);
+  const DrawCommand *storage = plan.sceneWindingFlipped[0].data();
+
+  inputs.sceneDraws = {.doubleSided = &second};
+  const ShadowCascadeDrawPlanner planner(inputs);
+  planner.build(plan);
+
+  EXPECT_EQ(plan.signature, planner.signature());
+  for (uint32_t cascadeIndex = 0; cascadeIndex < kShadowCascadeCount;
+       ++cascadeIndex) {
+    EXPECT_TRUE(plan.sceneWindingFlipped[cascadeIndex].empty());
+    ASSERT_EQ(plan.sceneDoubleSided[cascadeIndex].size(), 1u);
+    EXPECT_EQ(plan.sceneDoubleSided[cascadeIndex][0].objectIndex, 3u);
+  }
+  EXPECT_EQ(plan.sceneWindingFlipped[0].data(), storage);
+}
+
 } // namespace
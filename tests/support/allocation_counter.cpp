@@ -0,0 +1,84 @@
+#include "allocation_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+// Every block carries its size in a header so unsized deletes can be
+// accounted. Only the unaligned forms are replaced; over-aligned allocations
+// keep the runtime's own operator new and are not counted.
+namespace {
+
+constexpr std::size_t kAllocationHeader = alignof(std::max_align_t);
+std::atomic<std::size_t> gAllocationCount{0};
+std::atomic<std::size_t> gLiveBytes{0};
+std::atomic<std::size_t> gPeakBytes{0};
+
+void *countedAllocate(std::size_t size) {
+  auto *block =
+      static_cast<std::byte *>(std::malloc(size + kAllocationHeader));
+  if (block == nullptr) {
+    return nullptr;
+  }
+  std::memcpy(block, &size, sizeof(size));
+  ++gAllocationCount;
+  const std::size_t live = gLiveBytes.fetch_add(size) + size;
+  std::size_t peak = gPeakBytes.load();
+  while (live > peak && !gPeakBytes.compare_exchange_weak(peak, live)) {
+  }
+  return block + kAllocationHeader;
+}
+
+void countedFree(void *pointer) {
+  if (pointer == nullptr) {
+    return;
+  }
+  auto *block = static_cast<std::byte *>(pointer) - kAllocationHeader;
+  std::size_t size = 0;
+  std::memcpy(&size, block, sizeof(size));
+  gLiveBytes.fetch_sub(size);
+  std::free(block);
+}
+
+} // namespace
+
+namespace container::test {
+
+std::size_t allocationCount() { return gAllocationCount.load(); }
+
+std::size_t liveAllocationBytes() { return gLiveBytes.load(); }
+
+std::size_t peakAllocationBytes() { return gPeakBytes.load(); }
+
+void resetPeakAllocationBytes() { gPeakBytes.store(gLiveBytes.load()); }
+
+} // namespace container::test
+
+void *operator new(std::size_t size) {
+  if (void *pointer = countedAllocate(size)) {
+    return pointer;
+  }
+  throw std::bad_alloc{};
+}
+void *operator new[](std::size_t size) { return ::operator new(size); }
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+  return countedAllocate(size);
+}
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+  return countedAllocate(size);
+}
+void operator delete(void *pointer) noexcept { countedFree(pointer); }
+void operator delete[](void *pointer) noexcept { countedFree(pointer); }
+void operator delete(void *pointer, std::size_t) noexcept {
+  countedFree(pointer);
+}
+void operator delete[](void *pointer, std::size_t) noexcept {
+  countedFree(pointer);
+}
+void operator delete(void *pointer, const std::nothrow_t &) noexcept {
+  countedFree(pointer);
+}
+void operator delete[](void *pointer, const std::nothrow_t &) noexcept {
+  countedFree(pointer);
+}
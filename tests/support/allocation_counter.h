@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+
+namespace container::test {
+
+// Heap accounting for test binaries that link allocation_counter.cpp, which
+// replaces the global operator new and delete. Tests take differences around
+// the code they measure.
+
+// Number of calls to the global operator new made so far.
+[[nodiscard]] std::size_t allocationCount();
+// Bytes currently allocated through the global operator new.
+[[nodiscard]] std::size_t liveAllocationBytes();
+// Highest liveAllocationBytes() since the last resetPeakAllocationBytes().
+[[nodiscard]] std::size_t peakAllocationBytes();
+void resetPeakAllocationBytes();
+
+} // namespace container::test
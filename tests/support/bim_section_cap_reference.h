@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Container/renderer/bim/BimSectionCapBuilder.h"
+
+#include <span>
+
+namespace container::test {
+
+// The single-threaded section cap builder as it was before surfaces were
+// built in parallel, kept as an independent reference for the production
+// builder. It intersects every triangle with the planes one at a time and
+// welds loop points with a quadratic scan, so keep its inputs small.
+[[nodiscard]] container::renderer::BimSectionCapGeneratedMesh
+BuildReferenceBimSectionCapMesh(
+    std::span<const container::renderer::BimSectionCapTriangle> triangles,
+    const container::renderer::BimSectionCapBuildOptions& options);
+
+}  // namespace container::test
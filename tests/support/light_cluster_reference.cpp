@@ -0,0 +1,241 @@
+#include "light_cluster_reference.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <optional>
+
+namespace container::test {
+
+using container::gpu::kMaxLightsPerTile;
+using container::gpu::kTileSize;
+using container::gpu::kUnboundedPointLightRange;
+using container::gpu::PointLightData;
+using container::gpu::TileLightGrid;
+
+namespace {
+
+[[nodiscard]] float sanitizeNear(float cameraNear) {
+  return std::isfinite(cameraNear) ? std::max(cameraNear, 1.0e-4f) : 0.1f;
+}
+
+[[nodiscard]] float sanitizeFar(float cameraNear, float cameraFar) {
+  const float n = sanitizeNear(cameraNear);
+  const float f = std::isfinite(cameraFar) ? cameraFar : 100.0f;
+  return std::max(f, n + 1.0e-3f);
+}
+
+[[nodiscard]] float viewDepthToReverseZ(float viewDepth, float n, float f) {
+  const float z = std::clamp(viewDepth, n, f);
+  return std::clamp(n * (f / z - 1.0f) / (f - n), 0.0f, 1.0f);
+}
+
+[[nodiscard]] float linearizeReverseZ(float depth, float n, float f) {
+  return (n * f) / (std::clamp(depth, 0.0f, 1.0f) * (f - n) + n);
+}
+
+[[nodiscard]] bool allFinite(const glm::vec4 &value) {
+  return std::isfinite(value.x) && std::isfinite(value.y) &&
+         std::isfinite(value.z) && std::isfinite(value.w);
+}
+
+[[nodiscard]] std::optional<glm::vec3>
+reconstructWorldPosition(const glm::vec4 &clip,
+                         const glm::mat4 &inverseViewProj) {
+  if (!allFinite(clip)) {
+    return std::nullopt;
+  }
+  const glm::vec4 projected = inverseViewProj * clip;
+  if (!allFinite(projected) || projected.w <= 1.0e-6f) {
+    return std::nullopt;
+  }
+  const glm::vec3 world = glm::vec3(projected) / projected.w;
+  if (!std::isfinite(world.x) || !std::isfinite(world.y) ||
+      !std::isfinite(world.z)) {
+    return std::nullopt;
+  }
+  return world;
+}
+
+[[nodiscard]] bool hasRenderableIntensity(const PointLightData &light) {
+  return allFinite(light.colorIntensity) && light.colorIntensity.a > 0.0f &&
+         (light.colorIntensity.r > 0.0f || light.colorIntensity.g > 0.0f ||
+          light.colorIntensity.b > 0.0f);
+}
+
+[[nodiscard]] bool sphereIntersectsAabb(const glm::vec3 &center, float radius,
+                                        const ClusterAabb &aabb) {
+  const glm::vec3 closest = glm::clamp(center, aabb.min, aabb.max);
+  const glm::vec3 diff = center - closest;
+  return glm::dot(diff, diff) <= radius * radius;
+}
+
+// Per-cluster flag: does any depth sample fall into the cluster's slice?
+[[nodiscard]] std::vector<uint8_t>
+occupiedClusters(const ClusterGridReferenceParams &params,
+                 const ClusterLightAssignment &assignment) {
+  const size_t clusterCount = assignment.grid.size();
+  if (params.depth.empty()) {
+    return std::vector<uint8_t>(clusterCount, 1u);
+  }
+  std::vector<uint8_t> occupied(clusterCount, 0u);
+  for (uint32_t y = 0u; y < params.height; ++y) {
+    for (uint32_t x = 0u; x < params.width; ++x) {
+      const size_t pixel = static_cast<size_t>(y) * params.width + x;
+      if (pixel >= params.depth.size()) {
+        continue;
+      }
+      const float depth = params.depth[pixel];
+      if (!std::isfinite(depth) || depth <= 0.0f || depth > 1.0f) {
+        continue;
+      }
+      const uint32_t slice =
+          depthToClusterSlice(depth, params.cameraNear, params.cameraFar,
+                              assignment.depthSliceCount);
+      occupied[assignment.clusterIndex(x / kTileSize, y / kTileSize, slice)] =
+          1u;
+    }
+  }
+  return occupied;
+}
+
+} // namespace
+
+std::span<const uint32_t>
+ClusterLightAssignment::clusterLights(uint32_t cluster) const {
+  const TileLightGrid &entry = grid[cluster];
+  return std::span<const uint32_t>(lightIndices)
+      .subspan(entry.offset, entry.count);
+}
+
+float clusterSliceBoundaryDepth(uint32_t sliceBoundary, float cameraNear,
+                                float cameraFar, uint32_t depthSliceCount) {
+  const uint32_t sliceCount = std::max(depthSliceCount, 1u);
+  const float n = sanitizeNear(cameraNear);
+  const float f = sanitizeFar(n, cameraFar);
+  const float t = static_cast<float>(std::min(sliceBoundary, sliceCount)) /
+                  static_cast<float>(sliceCount);
+  const float viewDepth = n * std::exp2(std::log2(f / n) * t);
+  return viewDepthToReverseZ(viewDepth, n, f);
+}
+
+uint32_t depthToClusterSlice(float depth, float cameraNear, float cameraFar,
+                             uint32_t depthSliceCount) {
+  const uint32_t sliceCount = std::max(depthSliceCount, 1u);
+  const float n = sanitizeNear(cameraNear);
+  const float f = sanitizeFar(n, cameraFar);
+  const float viewDepth = std::clamp(linearizeReverseZ(depth, n, f), n, f);
+  const float logRange = std::max(std::log2(f / n), 1.0e-6f);
+  const float normalized =
+      std::clamp(std::log2(viewDepth / n) / logRange, 0.0f, 1.0f);
+  const auto slice =
+      static_cast<uint32_t>(normalized * static_cast<float>(sliceCount));
+  return std::min(slice, sliceCount - 1u);
+}
+
+ClusterAabb clusterWorldBounds(const ClusterGridReferenceParams &params,
+                               uint32_t tileX, uint32_t tileY,
+                               uint32_t slice) {
+  const float width = static_cast<float>(std::max(params.width, 1u));
+  const float height = static_cast<float>(std::max(params.height, 1u));
+  // Framebuffer +Y is down while scene NDC +Y is up (negative-height
+  // viewport), matching the shader.
+  const float left = static_cast<float>(tileX * kTileSize) / width * 2.0f - 1.0f;
+  const float right =
+      static_cast<float>(std::min((tileX + 1u) * kTileSize, params.width)) /
+          width * 2.0f -
+      1.0f;
+  const float top =
+      -(static_cast<float>(tileY * kTileSize) / height * 2.0f - 1.0f);
+  const float bottom =
+      -(static_cast<float>(std::min((tileY + 1u) * kTileSize, params.height)) /
+            height * 2.0f -
+        1.0f);
+  const uint32_t sliceCount = std::max(params.depthSliceCount, 1u);
+  const float nearDepth = clusterSliceBoundaryDepth(
+      slice, params.cameraNear, params.cameraFar, sliceCount);
+  const float farDepth = clusterSliceBoundaryDepth(
+      slice + 1u, params.cameraNear, params.cameraFar, sliceCount);
+
+  const std::array<glm::vec4, 8> corners{
+      glm::vec4(left, top, nearDepth, 1.0f),
+      glm::vec4(right, top, nearDepth, 1.0f),
+      glm::vec4(left, bottom, nearDepth, 1.0f),
+      glm::vec4(right, bottom, nearDepth, 1.0f),
+      glm::vec4(left, top, farDepth, 1.0f),
+      glm::vec4(right, top, farDepth, 1.0f),
+      glm::vec4(left, bottom, farDepth, 1.0f),
+      glm::vec4(right, bottom, farDepth, 1.0f)};
+
+  ClusterAabb bounds{};
+  for (size_t i = 0; i < corners.size(); ++i) {
+    const std::optional<glm::vec3> world =
+        reconstructWorldPosition(corners[i], params.inverseViewProj);
+    if (!world) {
+      return {};
+    }
+    bounds.min = i == 0u ? *world : glm::min(bounds.min, *world);
+    bounds.max = i == 0u ? *world : glm::max(bounds.max, *world);
+  }
+  bounds.valid = true;
+  return bounds;
+}
+
+ClusterLightAssignment
+assignLightsToClustersReference(std::span<const PointLightData> lights,
+                                const ClusterGridReferenceParams &params) {
+  ClusterLightAssignment assignment{};
+  assignment.tileCountX =
+      std::max(1u, (params.width + kTileSize - 1u) / kTileSize);
+  assignment.tileCountY =
+      std::max(1u, (params.height + kTileSize - 1u) / kTileSize);
+  assignment.depthSliceCount = std::max(params.depthSliceCount, 1u);
+  const size_t clusterCount = static_cast<size_t>(assignment.tileCountX) *
+                              assignment.tileCountY *
+                              assignment.depthSliceCount;
+  assignment.grid.resize(clusterCount);
+  assignment.lightIndices.assign(clusterCount * kMaxLightsPerTile, 0u);
+
+  const std::vector<uint8_t> occupied = occupiedClusters(params, assignment);
+  for (uint32_t slice = 0u; slice < assignment.depthSliceCount; ++slice) {
+    for (uint32_t tileY = 0u; tileY < assignment.tileCountY; ++tileY) {
+      for (uint32_t tileX = 0u; tileX < assignment.tileCountX; ++tileX) {
+        const uint32_t cluster = assignment.clusterIndex(tileX, tileY, slice);
+        TileLightGrid &entry = assignment.grid[cluster];
+        entry.offset = cluster * kMaxLightsPerTile;
+        if (lights.empty() || occupied[cluster] == 0u) {
+          continue;
+        }
+
+        const ClusterAabb bounds =
+            clusterWorldBounds(params, tileX, tileY, slice);
+        uint32_t hits = 0u;
+        for (uint32_t index = 0u; index < lights.size(); ++index) {
+          const PointLightData &light = lights[index];
+          if (!hasRenderableIntensity(light) ||
+              !allFinite(light.positionRadius) ||
+              light.positionRadius.w < kUnboundedPointLightRange) {
+            continue;
+          }
+          const bool unbounded =
+              light.positionRadius.w == kUnboundedPointLightRange;
+          if (unbounded || !bounds.valid ||
+              sphereIntersectsAabb(glm::vec3(light.positionRadius),
+                                   light.positionRadius.w * 1.03f, bounds)) {
+            if (hits < kMaxLightsPerTile) {
+              assignment.lightIndices[entry.offset + hits] = index;
+            }
+            ++hits;
+          }
+        }
+        entry.count = std::min(hits, kMaxLightsPerTile);
+        assignment.maxLightsPerCluster =
+            std::max(assignment.maxLightsPerCluster, entry.count);
+        assignment.droppedLights += hits - entry.count;
+      }
+    }
+  }
+  return assignment;
+}
+
+} // namespace container::test
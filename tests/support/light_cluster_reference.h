@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Container/utility/SceneData.h"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace container::test {
+
+// CPU mirror of shaders/tile_light_cull.slang.  Used to validate the light
+// working set and the clustered cull against each other in unit tests; it is
+// far too slow for per-frame use.
+struct ClusterGridReferenceParams {
+  glm::mat4 inverseViewProj{1.0f};
+  uint32_t width{0};
+  uint32_t height{0};
+  float cameraNear{0.1f};
+  float cameraFar{100.0f};
+  uint32_t depthSliceCount{container::gpu::kClusterDepthSlices};
+  // Optional reverse-Z depth buffer (width * height, row-major).  When set,
+  // clusters without a depth sample in their slice stay empty like on the
+  // GPU; when empty every cluster is treated as occupied.
+  std::span<const float> depth{};
+};
+
+struct ClusterAabb {
+  glm::vec3 min{-1.0e20f};
+  glm::vec3 max{1.0e20f};
+  // False when a corner failed to unproject; the cull then accepts every
+  // light for the cluster.
+  bool valid{false};
+};
+
+struct ClusterLightAssignment {
+  uint32_t tileCountX{0};
+  uint32_t tileCountY{0};
+  uint32_t depthSliceCount{0};
+  // Same layout as the GPU buffers: cluster i owns the kMaxLightsPerTile
+  // index slots starting at grid[i].offset.  Indices are ascending.
+  std::vector<container::gpu::TileLightGrid> grid{};
+  std::vector<uint32_t> lightIndices{};
+  uint32_t maxLightsPerCluster{0};
+  uint32_t droppedLights{0};
+
+  [[nodiscard]] uint32_t clusterIndex(uint32_t tileX, uint32_t tileY,
+                                      uint32_t slice) const {
+    return (slice * tileCountY + tileY) * tileCountX + tileX;
+  }
+  [[nodiscard]] std::span<const uint32_t> clusterLights(uint32_t cluster) const;
+};
+
+[[nodiscard]] float clusterSliceBoundaryDepth(uint32_t sliceBoundary,
+                                              float cameraNear,
+                                              float cameraFar,
+                                              uint32_t depthSliceCount);
+[[nodiscard]] uint32_t depthToClusterSlice(float depth, float cameraNear,
+                                           float cameraFar,
+                                           uint32_t depthSliceCount);
+
+[[nodiscard]] ClusterAabb
+clusterWorldBounds(const ClusterGridReferenceParams &params, uint32_t tileX,
+                   uint32_t tileY, uint32_t slice);
+
+[[nodiscard]] ClusterLightAssignment assignLightsToClustersReference(
+    std::span<const container::gpu::PointLightData> lights,
+    const ClusterGridReferenceParams &params);
+
+} // namespace container::test
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace container::test {
+
+// Worker counts the parallel loader tests compare against a serial load. Zero
+// lets the loader size its pool from the hardware.
+inline constexpr std::array<size_t, 4> kParallelLoaderWorkerCounts = {2u, 4u,
+                                                                      8u, 0u};
+
+// Directory under the system temp directory for the files a loader test
+// generates, created on first use.
+[[nodiscard]] inline std::filesystem::path
+loaderTestDirectory(std::string_view name) {
+  const std::filesystem::path dir =
+      std::filesystem::temp_directory_path() / std::string(name);
+  std::filesystem::create_directories(dir);
+  return dir;
+}
+
+// Loads once to warm the file cache, then times a serial and a default
+// parallel load and records them as the serial_ms and parallel_ms test
+// properties. `check` runs on every loaded model. Nothing is asserted about
+// the times: they depend on the machine.
+template <typename Load, typename Check>
+void recordSerialAndParallelLoadTimes(Load &&load, Check &&check) {
+  const auto timeLoad = [&](size_t workers) {
+    const auto start = std::chrono::steady_clock::now();
+    const auto model = load(workers);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    check(model);
+    return std::chrono::duration<double, std::milli>(elapsed).count();
+  };
+
+  (void)timeLoad(0);
+  const double serialMs = timeLoad(1);
+  const double parallelMs = timeLoad(0);
+  ::testing::Test::RecordProperty("serial_ms", std::to_string(serialMs));
+  ::testing::Test::RecordProperty("parallel_ms", std::to_string(parallelMs));
+}
+
+} // namespace container::test
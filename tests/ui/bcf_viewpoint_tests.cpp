@@ -130,6 +130,52 @@ TEST(BimMeasurementCapture, AppliesConfiguredSnapModeToSelectedBounds) {
   EXPECT_EQ(captured->center, glm::vec3(2.0f, 9.5f, 24.0f));
 }
 
+TEST(BimMeasurementCapture, PrefersGeometricSnapFeaturesOverBounds) {
+  using container::renderer::BimSnapCandidate;
+  using container::renderer::BimSnapKind;
+  container::ui::BimInspectionState inspection{};
+  inspection.hasSelection = true;
+  inspection.hasSelectionBounds = true;
+  inspection.selectedObjectIndex = 42u;
+  inspection.displayName = "Duct";
+  inspection.selectionBoundsMin = {0.0f, 10.0f, 20.0f};
+  inspection.selectionBoundsMax = {4.0f, 16.0f, 28.0f};
+  inspection.selectionBoundsCenter = {2.0f, 13.0f, 24.0f};
+  const std::array geometric{
+      BimSnapCandidate{.kind = BimSnapKind::Vertex,
+                       .objectIndex = 43u,
+                       .worldPosition = {1.0f, 11.0f, 21.0f},
+                       .screenDistancePixels = 4.0f},
+      BimSnapCandidate{.kind = BimSnapKind::EdgeMidpoint,
+                       .objectIndex = 43u,
+                       .worldPosition = {1.5f, 11.0f, 21.0f},
+                       .screenDistancePixels = 20.0f},
+  };
+  inspection.geometricSnapCandidates = geometric;
+
+  container::ui::BimMeasurementSnapUiState snap{};
+  snap.maxScreenDistancePixels = 12.0f;
+  snap.mode = container::ui::BimMeasurementSnapMode::Vertex;
+  auto captured =
+      container::ui::CaptureBimMeasurementPointFromSelection(inspection, snap);
+  ASSERT_TRUE(captured.has_value());
+  EXPECT_EQ(captured->snapKind, BimSnapKind::Vertex);
+  EXPECT_EQ(captured->center, glm::vec3(1.0f, 11.0f, 21.0f));
+  EXPECT_EQ(captured->objectIndex, 43u);
+  EXPECT_EQ(captured->label, "Duct vertex");
+
+  // The edge feature is out of reach, so edge snapping keeps the bounds.
+  snap.mode = container::ui::BimMeasurementSnapMode::Edge;
+  captured =
+      container::ui::CaptureBimMeasurementPointFromSelection(inspection, snap);
+  ASSERT_TRUE(captured.has_value());
+  EXPECT_EQ(captured->snapKind, BimSnapKind::EdgeMidpoint);
+  EXPECT_EQ(captured->center, glm::vec3(2.0f, 10.0f, 20.0f));
+  EXPECT_TRUE(container::ui::BimMeasurementSnapModeUsesGeometry(snap.mode));
+  EXPECT_FALSE(container::ui::BimMeasurementSnapModeUsesGeometry(
+      container::ui::BimMeasurementSnapMode::Bounds));
+}
+
 TEST(BcfViewpoint, RoundTripsContainerSnapshotFields) {
   const auto snapshot = sampleSnapshot();
   const std::string xml =
@@ -0,0 +1,235 @@
+#include "Container/utility/GuiTableRowModel.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using container::ui::GuiClipperItemCount;
+using container::ui::GuiFlattenTreeRows;
+using container::ui::GuiRowCompareText;
+using container::ui::GuiRowTextFilter;
+using container::ui::GuiTableRowIndex;
+using container::ui::GuiTableRowKey;
+using container::ui::GuiTreeRow;
+
+struct PropertyRow {
+  std::string name;
+  std::string value;
+};
+
+std::vector<PropertyRow> sampleRows() {
+  return {
+      {"FireRating", "EI 60"},   {"LoadBearing", "true"},
+      {"fireExit", "false"},     {"Reference", "Door-01"},
+      {"IsExternal", "false"},   {"Reference", "door-02"},
+  };
+}
+
+std::vector<uint32_t> toVector(std::span<const uint32_t> rows) {
+  return {rows.begin(), rows.end()};
+}
+
+bool refreshByName(GuiTableRowIndex& index, const GuiTableRowKey& key,
+                   const std::vector<PropertyRow>& rows) {
+  const GuiRowTextFilter filter(key.filter);
+  return index.refresh(
+      key,
+      [&](uint32_t row) {
+        return filter.matches(rows[row].name) ||
+               filter.matches(rows[row].value);
+      },
+      [&](uint32_t lhs, uint32_t rhs) {
+        const std::string& left =
+            key.sortColumn == 1 ? rows[lhs].value : rows[lhs].name;
+        const std::string& right =
+            key.sortColumn == 1 ? rows[rhs].value : rows[rhs].name;
+        return GuiRowCompareText(left, right) < 0;
+      });
+}
+
+}  // namespace
+
+TEST(GuiRowTextFilter, MatchesSubstringsIgnoringAsciiCase) {
+  const GuiRowTextFilter filter("FIRE");
+  EXPECT_TRUE(filter.matches("FireRating"));
+  EXPECT_TRUE(filter.matches("has fire exit"));
+  EXPECT_FALSE(filter.matches("Fir"));
+  EXPECT_FALSE(filter.matches(""));
+
+  const GuiRowTextFilter empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_TRUE(empty.matches(""));
+  EXPECT_TRUE(empty.matches("anything"));
+}
+
+TEST(GuiRowCompareText, OrdersCaseInsensitivelyWithByteTieBreak) {
+  EXPECT_LT(GuiRowCompareText("apple", "Banana"), 0);
+  EXPECT_GT(GuiRowCompareText("banana", "Apple"), 0);
+  EXPECT_LT(GuiRowCompareText("door", "door-01"), 0);
+  EXPECT_EQ(GuiRowCompareText("Door", "Door"), 0);
+  // Case-only differences still order deterministically.
+  EXPECT_NE(GuiRowCompareText("Door", "door"), 0);
+  EXPECT_EQ(GuiRowCompareText("Door", "door"),
+            -GuiRowCompareText("door", "Door"));
+}
+
+TEST(GuiTableRowIndex, FiltersAndSortsRowIndices) {
+  const std::vector<PropertyRow> rows = sampleRows();
+  GuiTableRowIndex index;
+
+  GuiTableRowKey key{.dataRevision = 1u, .rowCount = rows.size()};
+  EXPECT_TRUE(refreshByName(index, key, rows));
+  EXPECT_EQ(toVector(index.rows()),
+            (std::vector<uint32_t>{0u, 1u, 2u, 3u, 4u, 5u}));
+
+  key.filter = "fire";
+  EXPECT_TRUE(refreshByName(index, key, rows));
+  EXPECT_EQ(toVector(index.rows()), (std::vector<uint32_t>{0u, 2u}));
+
+  key.filter = "door";
+  key.sortColumn = 1;
+  key.sortDescending = true;
+  EXPECT_TRUE(refreshByName(index, key, rows));
+  EXPECT_EQ(toVector(index.rows()), (std::vector<uint32_t>{5u, 3u}));
+
+  key.filter.clear();
+  key.sortColumn = 0;
+  key.sortDescending = false;
+  EXPECT_TRUE(refreshByName(index, key, rows));
+  EXPECT_EQ(toVector(index.rows()),
+            (std::vector<uint32_t>{2u, 0u, 4u, 1u, 3u, 5u}));
+}
+
+TEST(GuiTableRowIndex, EqualRowsKeepSourceOrderInBothDirections) {
+  const std::vector<PropertyRow> rows = sampleRows();
+  GuiTableRowIndex index;
+  GuiTableRowKey key{.dataRevision = 1u,
+                     .rowCount = rows.size(),
+                     .sortColumn = 1};
+  ASSERT_TRUE(refreshByName(index, key, rows));
+  // "false" appears at rows 2 and 4.
+  EXPECT_EQ(toVector(index.rows()),
+            (std::vector<uint32_t>{3u, 5u, 0u, 2u, 4u, 1u}));
+
+  key.sortDescending = true;
+  ASSERT_TRUE(refreshByName(index, key, rows));
+  EXPECT_EQ(toVector(index.rows()),
+            (std::vector<uint32_t>{1u, 2u, 4u, 0u, 5u, 3u}));
+}
+
+TEST(GuiTableRowIndex, RebuildsOnlyWhenTheKeyChanges) {
+  std::vector<PropertyRow> rows = sampleRows();
+  GuiTableRowIndex index;
+  GuiTableRowKey key{.dataRevision = 7u,
+                     .scope = 3u,
+                     .rowCount = rows.size(),
+                     .filter = "ref"};
+  ASSERT_TRUE(refreshByName(index, key, rows));
+  for (int frame = 0; frame < 16; ++frame) {
+    EXPECT_FALSE(refreshByName(index, key, rows));
+  }
+  EXPECT_EQ(index.rebuildCount(), 1u);
+
+  // Same revision but a different element's rows.
+  key.scope = 4u;
+  EXPECT_TRUE(refreshByName(index, key, rows));
+
+  rows.push_back({"Reference", "Door-03"});
+  key.dataRevision = 8u;
+  key.rowCount = rows.size();
+  EXPECT_TRUE(refreshByName(index, key, rows));
+  EXPECT_EQ(toVector(index.rows()), (std::vector<uint32_t>{3u, 5u, 6u}));
+
+  index.invalidate();
+  EXPECT_TRUE(refreshByName(index, key, rows));
+  EXPECT_EQ(index.rebuildCount(), 4u);
+}
+
+TEST(GuiTableRowIndex, UnchangedHugeTableCostsNoRefilter) {
+  std::vector<PropertyRow> rows;
+  rows.reserve(250000u);
+  for (uint32_t i = 0; i < 250000u; ++i) {
+    rows.push_back({"Pset_" + std::to_string(i % 977u),
+                    "value " + std::to_string(i)});
+  }
+  GuiTableRowIndex index;
+  const GuiTableRowKey key{.dataRevision = 1u,
+                           .rowCount = rows.size(),
+                           .filter = "pset_12",
+                           .sortColumn = 0};
+  ASSERT_TRUE(refreshByName(index, key, rows));
+  ASSERT_FALSE(index.empty());
+
+  for (int frame = 0; frame < 1000; ++frame) {
+    EXPECT_FALSE(refreshByName(index, key, rows));
+  }
+  EXPECT_EQ(index.rebuildCount(), 1u);
+}
+
+TEST(GuiClipperItemCount, SaturatesAtIntMax) {
+  EXPECT_EQ(GuiClipperItemCount(0u), 0);
+  EXPECT_EQ(GuiClipperItemCount(200000u), 200000);
+  EXPECT_EQ(GuiClipperItemCount(static_cast<size_t>(1) << 40u),
+            std::numeric_limits<int>::max());
+}
+
+TEST(GuiFlattenTreeRows, EmitsOnlyExpandedSubtreesDepthFirst) {
+  // 0 -> {1, 2}, 1 -> {3}, 2 -> {4}; roots 0 and 5.
+  const std::vector<std::vector<uint32_t>> children{
+      {1u, 2u}, {3u}, {4u}, {}, {}, {}};
+  std::vector<uint8_t> expanded(children.size(), 0u);
+  const std::vector<uint32_t> roots{0u, 5u};
+  std::vector<GuiTreeRow> rows;
+  auto flatten = [&]() {
+    GuiFlattenTreeRows(
+        roots,
+        [&](uint32_t node) -> const std::vector<uint32_t>& {
+          return children[node];
+        },
+        [&](uint32_t node) { return expanded[node] != 0u; }, rows);
+  };
+  auto nodesAndDepths = [&]() {
+    std::vector<std::pair<uint32_t, uint32_t>> result;
+    for (const GuiTreeRow& row : rows) {
+      result.emplace_back(row.node, row.depth);
+    }
+    return result;
+  };
+
+  flatten();
+  EXPECT_EQ(nodesAndDepths(),
+            (std::vector<std::pair<uint32_t, uint32_t>>{{0u, 0u}, {5u, 0u}}));
+
+  expanded[0] = 1u;
+  expanded[2] = 1u;
+  flatten();
+  EXPECT_EQ(nodesAndDepths(),
+            (std::vector<std::pair<uint32_t, uint32_t>>{
+                {0u, 0u}, {1u, 1u}, {2u, 1u}, {4u, 2u}, {5u, 0u}}));
+}
+
+TEST(GuiFlattenTreeRows, HandlesDeepChainsWithoutRecursion) {
+  constexpr uint32_t kDepth = 200000u;
+  std::vector<std::vector<uint32_t>> children(kDepth);
+  for (uint32_t node = 0; node + 1u < kDepth; ++node) {
+    children[node].push_back(node + 1u);
+  }
+  const std::vector<uint32_t> roots{0u};
+  std::vector<GuiTreeRow> rows;
+  GuiFlattenTreeRows(
+      roots,
+      [&](uint32_t node) -> const std::vector<uint32_t>& {
+        return children[node];
+      },
+      [](uint32_t) { return true; }, rows);
+  ASSERT_EQ(rows.size(), kDepth);
+  EXPECT_EQ(rows.back().node, kDepth - 1u);
+  EXPECT_EQ(rows.back().depth, kDepth - 1u);
+}
@@ -2084,11 +2084,13 @@ TEST(RenderingConventionTests, IndirectDrawObjectIndexUsesBaseInstance) {
                        "ResolveObjectIndex(uint pushedObjectIndex, "
                        "uint instanceID, uint startInstance)"));
   EXPECT_TRUE(contains(objectIndexCommon, "? instanceID + startInstance"));
+  EXPECT_TRUE(contains(objectIndexCommon,
+                       "ResolveCulledObjectIndex(uint pushedObjectIndex, "
+                       "uint instanceID,"));
+  EXPECT_TRUE(contains(objectIndexCommon, "kCulledInstanceListBit"));
 
-  constexpr std::array<std::string_view, 10> kObjectIndexedVertexShaders = {{
-      "shaders/depth_prepass.slang",
+  constexpr std::array<std::string_view, 8> kObjectIndexedVertexShaders = {{
       "shaders/forward_transparent.slang",
-      "shaders/gbuffer.slang",
       "shaders/geometry_debug.slang",
       "shaders/normal_validation.slang",
       "shaders/object_normals.slang",
@@ -2109,6 +2111,28 @@ TEST(RenderingConventionTests, IndirectDrawObjectIndexUsesBaseInstance) {
         "ResolveObjectIndex(pc.objectIndex, instanceID, startInstance)"))
         << shaderPath;
   }
+
+  // Consumers of GpuCullManager's indirect draws resolve the compacted
+  // per-run instance lists.
+  constexpr std::array<std::string_view, 3> kCulledInstanceVertexShaders = {{
+      "shaders/depth_prepass.slang",
+      "shaders/gbuffer.slang",
+      "shaders/transparent_pick.slang",
+  }};
+
+  for (const std::string_view shaderPath : kCulledInstanceVertexShaders) {
+    const std::string shader =
+        readRepoTextFile(std::filesystem::path(shaderPath));
+    EXPECT_TRUE(
+        contains(shader, "uint startInstance : SV_StartInstanceLocation"))
+        << shaderPath;
+    EXPECT_TRUE(contains(shader, "[[vk::binding(7, 0)]] "
+                                 "StructuredBuffer<uint> uCulledInstanceIds"))
+        << shaderPath;
+    EXPECT_TRUE(contains(shader, "pc.objectIndex, instanceID, startInstance, "
+                                 "uCulledInstanceIds"))
+        << shaderPath;
+  }
 }
 
 TEST(RenderingConventionTests, SectionPlanePushConstantsMatchShaderContracts) {
@@ -3145,20 +3169,21 @@ TEST(RenderingConventionTests, DeferredFrustumCullUsesPlannerAndRecorder) {
       contains(readinessBlock,
                "renderPassMissingResource(RenderResourceId::ObjectBuffer)"));
 
-  const size_t ensureCapacity = recorder.find("ensureBufferCapacity");
   const size_t updateDescriptor = recorder.find("updateObjectSsboDescriptor");
   const size_t uploadDraws = recorder.find("uploadDrawCommands");
+  const size_t sceneInstances = recorder.find("updateSceneInstanceDescriptor");
   const size_t freeze = recorder.find("freezeCulling");
   const size_t unfreeze = recorder.find("unfreezeCulling");
   const size_t dispatch = recorder.find("dispatchFrustumCull");
-  ASSERT_NE(ensureCapacity, std::string::npos);
   ASSERT_NE(updateDescriptor, std::string::npos);
   ASSERT_NE(uploadDraws, std::string::npos);
+  ASSERT_NE(sceneInstances, std::string::npos);
   ASSERT_NE(freeze, std::string::npos);
   ASSERT_NE(unfreeze, std::string::npos);
   ASSERT_NE(dispatch, std::string::npos);
-  EXPECT_LT(ensureCapacity, updateDescriptor);
+  EXPECT_FALSE(contains(recorder, "ensureBufferCapacity"));
   EXPECT_LT(updateDescriptor, uploadDraws);
+  EXPECT_LT(uploadDraws, sceneInstances);
   EXPECT_LT(uploadDraws, freeze);
   EXPECT_LT(uploadDraws, unfreeze);
   EXPECT_LT(freeze, dispatch);
@@ -5783,7 +5808,7 @@ TEST(RenderingConventionTests, BimStoreyMaterialAndHideFiltersArePlumbed) {
   EXPECT_TRUE(contains(bimManager, "drawFilterState_->objectMatchesFilter"));
   EXPECT_TRUE(contains(bimManager, "drawFilterState_->filteredDrawLists"));
   EXPECT_TRUE(
-      contains(bimDrawFilterState, "sameBimProductIdentity(*selectedMetadata"));
+      contains(bimDrawFilterState, "sameBimProductIdentity(selectedMetadata"));
   EXPECT_TRUE(contains(bimDrawFilterState, "filter.storeyFilterEnabled"));
   EXPECT_TRUE(contains(bimDrawFilterState, "filter.materialFilterEnabled"));
   EXPECT_TRUE(contains(bimDrawFilterState, "filter.disciplineFilterEnabled"));
@@ -5957,9 +5982,9 @@ TEST(RenderingConventionTests,
   EXPECT_TRUE(contains(bimManager, "includeBoundsPoint"));
   EXPECT_TRUE(contains(bimManager, "includeBoundsBox"));
   EXPECT_TRUE(contains(bimManager, "includeIndexedBounds"));
-  EXPECT_TRUE(contains(bimManager, "objectIndicesForGuid(metadata->guid)"));
+  EXPECT_TRUE(contains(bimManager, "objectIndicesForGuid(metadata.guid())"));
   EXPECT_TRUE(
-      contains(bimManager, "objectIndicesForSourceId(metadata->sourceId)"));
+      contains(bimManager, "objectIndicesForSourceId(metadata.sourceId())"));
   EXPECT_TRUE(contains(bimManagerHeader, "objectDrawCommands_"));
   EXPECT_TRUE(contains(bimManager, "appendCommandsForObject"));
   EXPECT_TRUE(contains(guiManagerHeader, "hasSelectionBounds"));
@@ -7870,7 +7895,7 @@ TEST(RenderingConventionTests, BimGpuVisibilityFeedsShadowCasterSlots) {
   const std::string prepareBlock = shadowFramePassRecorder.substr(
       prepareCascade, prepareCascadeEnd - prepareCascade);
   EXPECT_TRUE(contains(prepareBlock, "ShadowCascadeDrawPlanner"));
-  EXPECT_TRUE(contains(prepareBlock, "planner.build()"));
+  EXPECT_TRUE(contains(prepareBlock, "planner.build(drawPlanCache_)"));
   EXPECT_TRUE(contains(shadowFramePassRecorder,
                        "params.bim.opaqueMeshDrawsUseGpuVisibility"));
 }
@@ -8123,7 +8148,7 @@ TEST(RenderingConventionTests, ShadowCascadeDrawPlanningUsesPlanner) {
                        "ShadowCascadeDrawPlannerInputs"));
   EXPECT_TRUE(contains(shadowFramePassRecorder, "drawPlannerInputs"));
   EXPECT_TRUE(contains(prepareBlock, "ShadowCascadeDrawPlanner planner"));
-  EXPECT_TRUE(contains(prepareBlock, "drawPlanCache_ = planner.build()"));
+  EXPECT_TRUE(contains(prepareBlock, "planner.build(drawPlanCache_)"));
   EXPECT_TRUE(
       contains(shadowFramePassRecorder, "drawPlanCache_.sceneSingleSided"));
   EXPECT_FALSE(contains(prepareBlock, "cascadeIntersectsSphere"));
@@ -8347,6 +8372,8 @@ TEST(RenderingConventionTests, BimSectionClipCapsExposeShaderStyleContract) {
       readRepoTextFile("src/renderer/core/RendererFrontend.cpp");
   const std::string bimManager =
       readRepoTextFile("src/renderer/bim/BimManager.cpp");
+  const std::string sectionCapCache =
+      readRepoTextFile("src/renderer/bim/BimSectionCapCache.cpp");
   const std::string guiManagerHeader =
       readRepoTextFile("include/Container/utility/GuiManager.h");
   const std::string guiManager = readRepoTextFile("src/utility/GuiManager.cpp");
@@ -8464,10 +8491,11 @@ TEST(RenderingConventionTests, BimSectionClipCapsExposeShaderStyleContract) {
   EXPECT_TRUE(contains(capStyleEnabledBlock, "capUi.sectionMarkersPreview"));
   EXPECT_TRUE(contains(bimManager, "sameSectionCapBuildOptions"));
   EXPECT_TRUE(contains(bimManager, "sectionClipCapBuildOptionsValid_"));
-  EXPECT_TRUE(contains(bimManager, "appendSectionMarkerGeometry"));
-  EXPECT_TRUE(contains(bimManager,
-                       "sectionClipCapDrawData_.hatchDrawCommands.push_back"));
-  EXPECT_TRUE(contains(bimManager, ".lineWidth = marker.lineWidth"));
+  EXPECT_TRUE(contains(bimManager, "sectionClipCapCache_.store"));
+  EXPECT_TRUE(contains(bimManager, "updateBufferRanges"));
+  EXPECT_TRUE(contains(sectionCapCache, "appendBimSectionMarkerGeometry"));
+  EXPECT_TRUE(contains(sectionCapCache, "mesh.hatchDrawCommands.push_back"));
+  EXPECT_TRUE(contains(sectionCapCache, ".lineWidth = marker.lineWidth"));
   EXPECT_TRUE(contains(guiManagerHeader, "BimClipCapHatchingUiState"));
   EXPECT_TRUE(contains(guiManagerHeader, "BimBoxClipUiState"));
   EXPECT_TRUE(contains(guiManagerHeader, "bimBoxClipState()"));